@@ -37,6 +37,15 @@ void ATTR_ROW::Resize(const uint16_t newWidth)
     _data.resize_trailing_extent(newWidth);
 }
 
+// Routine Description:
+// - Releases run capacity left over from a past peak - a row that once held
+//   many attribute runs keeps the larger allocation even after it's back to
+//   one run. The attributes themselves are untouched.
+void ATTR_ROW::TrimExcess()
+{
+    _data.shrink_to_fit();
+}
+
 // Routine Description:
 // - returns a copy of the TextAttribute at the specified column
 // Arguments:
@@ -108,6 +117,30 @@ void ATTR_ROW::Replace(const uint16_t beginIndex, const uint16_t endIndex, const
     _data.replace(beginIndex, endIndex, newAttr);
 }
 
+// Routine Description:
+// - Replaces a range of this row's attributes with the attributes covering a
+//   range of another row (or another part of this row), moving whole runs
+//   instead of committing one attribute per column.
+// Arguments:
+// - source - the attribute row to copy from.
+// - sourceIndex - the first column in source to copy.
+// - targetIndex - the first column in this row to overwrite.
+// - length - the number of columns to copy.
+// Return Value:
+// - <none>
+void ATTR_ROW::CopyRangeFrom(const ATTR_ROW& source, const uint16_t sourceIndex, const uint16_t targetIndex, const uint16_t length)
+{
+    if (length == 0)
+    {
+        return;
+    }
+
+    // slice() materializes the covered runs into a new vector, so this stays
+    // correct when source is *this and the two ranges overlap.
+    const auto slice = source._data.slice(sourceIndex, gsl::narrow<uint16_t>(sourceIndex + length));
+    _data.replace(targetIndex, gsl::narrow<uint16_t>(targetIndex + length), { slice.runs().data(), slice.runs().size() });
+}
+
 ATTR_ROW::const_iterator ATTR_ROW::begin() const noexcept
 {
     return _data.begin();
@@ -46,7 +46,9 @@ public:
     bool SetAttrToEnd(uint16_t beginIndex, TextAttribute attr);
     void ReplaceAttrs(const TextAttribute& toBeReplacedAttr, const TextAttribute& replaceWith);
     void Resize(uint16_t newWidth);
+    void TrimExcess();
     void Replace(uint16_t beginIndex, uint16_t endIndex, const TextAttribute& newAttr);
+    void CopyRangeFrom(const ATTR_ROW& source, const uint16_t sourceIndex, const uint16_t targetIndex, const uint16_t length);
 
     const_iterator begin() const noexcept;
     const_iterator end() const noexcept;
@@ -12,13 +12,16 @@
 // Arguments:
 // - rowWidth - the size (in wchar_t) of the char and attribute rows
 // - pParent - the parent ROW
+// - resource - the memory resource to draw heap storage from when the row
+//              is wider than the inline capacity
 // Return Value:
 // - instantiated object
 // Note: will through if unable to allocate char/attribute buffers
 #pragma warning(push)
 #pragma warning(disable : 26447) // small_vector's constructor says it can throw but it should not given how we use it.  This suppresses this error for the AuditMode build.
-CharRow::CharRow(size_t rowWidth, ROW* const pParent) noexcept :
-    _data(rowWidth, value_type()),
+CharRow::CharRow(size_t rowWidth, ROW* const pParent, std::pmr::memory_resource* const resource) noexcept :
+    _chars(rowWidth, UNICODE_SPACE, std::pmr::polymorphic_allocator<wchar_t>{ resource }),
+    _attrs(rowWidth, DbcsAttribute{}, std::pmr::polymorphic_allocator<DbcsAttribute>{ resource }),
     _pParent{ FAIL_FAST_IF_NULL(pParent) }
 {
 }
@@ -32,7 +35,7 @@ CharRow::CharRow(size_t rowWidth, ROW* const pParent) noexcept :
 // - the size of the row
 size_t CharRow::size() const noexcept
 {
-    return _data.size();
+    return _chars.size();
 }
 
 // Routine Description:
@@ -43,10 +46,9 @@ size_t CharRow::size() const noexcept
 // - <none>
 void CharRow::Reset() noexcept
 {
-    for (auto& cell : _data)
-    {
-        cell.Reset();
-    }
+    std::fill(_chars.begin(), _chars.end(), UNICODE_SPACE);
+    std::fill(_attrs.begin(), _attrs.end(), DbcsAttribute{});
+    _overflow.clear();
 }
 
 // Routine Description:
@@ -59,32 +61,45 @@ void CharRow::Reset() noexcept
 {
     try
     {
-        const value_type insertVals;
-        _data.resize(newSize, insertVals);
+        _chars.resize(newSize, UNICODE_SPACE);
+        _attrs.resize(newSize, DbcsAttribute{});
+
+        // drop overflow glyphs for columns that no longer exist
+        _overflow.erase(std::remove_if(_overflow.begin(),
+                                       _overflow.end(),
+                                       [newSize](const auto& entry) { return entry.first >= newSize; }),
+                        _overflow.end());
     }
     CATCH_RETURN();
 
     return S_OK;
 }
 
-typename CharRow::iterator CharRow::begin() noexcept
-{
-    return _data.begin();
-}
-
-typename CharRow::const_iterator CharRow::cbegin() const noexcept
-{
-    return _data.cbegin();
-}
-
-typename CharRow::iterator CharRow::end() noexcept
+// Routine Description:
+// - releases the expanded columnar storage while the owning row is packed
+//   into the cold-scrollback representation. The runs shrink back down to
+//   (at most) the inline capacity; ROW::Decompress restores them via Resize.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void CharRow::ReleaseStorage() noexcept
 {
-    return _data.end();
+    _chars.clear();
+    _chars.shrink_to_fit();
+    _attrs.clear();
+    _attrs.shrink_to_fit();
 }
 
-typename CharRow::const_iterator CharRow::cend() const noexcept
+// Routine Description:
+// - checks whether the given column holds nothing but a plain space
+// Arguments:
+// - column - the column to inspect
+// Return Value:
+// - true if the column is a space glyph with no overflow storage
+bool CharRow::_isSpace(const size_t column) const noexcept
 {
-    return _data.cend();
+    return !til::at(_attrs, column).IsGlyphStored() && til::at(_chars, column) == UNICODE_SPACE;
 }
 
 // Routine Description:
@@ -95,12 +110,13 @@ typename CharRow::const_iterator CharRow::cend() const noexcept
 // - The calculated left boundary of the internal string.
 size_t CharRow::MeasureLeft() const noexcept
 {
-    const_iterator it = _data.cbegin();
-    while (it != _data.cend() && it->IsSpace())
+    size_t column = 0;
+    const size_t width = _chars.size();
+    while (column < width && _isSpace(column))
     {
-        ++it;
+        ++column;
     }
-    return it - _data.cbegin();
+    return column;
 }
 
 // Routine Description:
@@ -109,19 +125,21 @@ size_t CharRow::MeasureLeft() const noexcept
 // - <none>
 // Return Value:
 // - The calculated right boundary of the internal string.
-size_t CharRow::MeasureRight() const
+size_t CharRow::MeasureRight() const noexcept
 {
-    const_reverse_iterator it = _data.crbegin();
-    while (it != _data.crend() && it->IsSpace())
+    size_t column = _chars.size();
+    while (column > 0 && _isSpace(column - 1))
     {
-        ++it;
+        --column;
     }
-    return _data.crend() - it;
+    return column;
 }
 
 void CharRow::ClearCell(const size_t column)
 {
-    _data.at(column).Reset();
+    _chars.at(column) = UNICODE_SPACE;
+    _attrs.at(column) = DbcsAttribute{};
+    EraseOverflowText(column);
 }
 
 // Routine Description:
@@ -132,9 +150,9 @@ void CharRow::ClearCell(const size_t column)
 // - True if there is valid text in this row. False otherwise.
 bool CharRow::ContainsText() const noexcept
 {
-    for (const value_type& cell : _data)
+    for (size_t column = 0; column < _chars.size(); ++column)
     {
-        if (!cell.IsSpace())
+        if (!_isSpace(column))
         {
             return true;
         }
@@ -151,7 +169,7 @@ bool CharRow::ContainsText() const noexcept
 // Note: will throw exception if column is out of bounds
 const DbcsAttribute& CharRow::DbcsAttrAt(const size_t column) const
 {
-    return _data.at(column).DbcsAttr();
+    return _attrs.at(column);
 }
 
 // Routine Description:
@@ -163,7 +181,7 @@ const DbcsAttribute& CharRow::DbcsAttrAt(const size_t column) const
 // Note: will throw exception if column is out of bounds
 DbcsAttribute& CharRow::DbcsAttrAt(const size_t column)
 {
-    return _data.at(column).DbcsAttr();
+    return _attrs.at(column);
 }
 
 // Routine Description:
@@ -175,7 +193,13 @@ DbcsAttribute& CharRow::DbcsAttrAt(const size_t column)
 // Note: will throw exception if column is out of bounds
 void CharRow::ClearGlyph(const size_t column)
 {
-    _data.at(column).EraseChars();
+    auto& attr = _attrs.at(column);
+    if (attr.IsGlyphStored())
+    {
+        attr.SetGlyphStored(false);
+        EraseOverflowText(column);
+    }
+    _chars.at(column) = UNICODE_SPACE;
 }
 
 // Routine Description:
@@ -187,7 +211,7 @@ void CharRow::ClearGlyph(const size_t column)
 // - Note: will throw exception if column is out of bounds
 const CharRow::reference CharRow::GlyphAt(const size_t column) const
 {
-    THROW_HR_IF(E_INVALIDARG, column >= _data.size());
+    THROW_HR_IF(E_INVALIDARG, column >= _chars.size());
     return { const_cast<CharRow&>(*this), column };
 }
 
@@ -200,23 +224,32 @@ const CharRow::reference CharRow::GlyphAt(const size_t column) const
 // - Note: will throw exception if column is out of bounds
 CharRow::reference CharRow::GlyphAt(const size_t column)
 {
-    THROW_HR_IF(E_INVALIDARG, column >= _data.size());
+    THROW_HR_IF(E_INVALIDARG, column >= _chars.size());
     return { *this, column };
 }
 
 std::wstring CharRow::GetText() const
 {
     std::wstring wstr;
-    wstr.reserve(_data.size());
+    wstr.reserve(_chars.size());
 
-    for (size_t i = 0; i < _data.size(); ++i)
+    for (size_t i = 0; i < _chars.size(); ++i)
     {
-        const auto glyph = GlyphAt(i);
-        if (!DbcsAttrAt(i).IsTrailing())
+        const auto& attr = til::at(_attrs, i);
+        if (!attr.IsTrailing())
         {
-            for (const auto wch : glyph)
+            if (!attr.IsGlyphStored())
             {
-                wstr.push_back(wch);
+                // the overwhelmingly common case: the glyph lives inline in
+                // the contiguous character run, so append it directly.
+                wstr.push_back(til::at(_chars, i));
+            }
+            else
+            {
+                for (const auto wch : GlyphAt(i))
+                {
+                    wstr.push_back(wch);
+                }
             }
         }
     }
@@ -233,9 +266,76 @@ std::wstring CharRow::GetText() const
 // - the delimiter class for the given char
 const DelimiterClass CharRow::DelimiterClassAt(const size_t column, const std::wstring_view wordDelimiters) const
 {
-    THROW_HR_IF(E_INVALIDARG, column >= _data.size());
+    THROW_HR_IF(E_INVALIDARG, column >= _chars.size());
+
+    return _DelimiterClassOf(*GlyphAt(column).begin(), wordDelimiters);
+}
+
+// Method Description:
+// - find the first column of the run of cells that share the delimiter class
+//   of the given column, scanning left within this row
+// - used to batch word navigation: one call over the contiguous character run
+//   replaces a cell-by-cell walk that re-resolves the row at every step
+// Arguments:
+// - column: a column inside the run
+// - wordDelimiters: the delimiters defined as a part of the DelimiterClass::DelimiterChar
+// Return Value:
+// - the first column of the run (inclusive)
+size_t CharRow::DelimiterRunStartAt(const size_t column, const std::wstring_view wordDelimiters) const
+{
+    THROW_HR_IF(E_INVALIDARG, column >= _chars.size());
 
-    const auto glyph = *GlyphAt(column).begin();
+    const auto initial = DelimiterClassAt(column, wordDelimiters);
+    auto start = column;
+    while (start > 0)
+    {
+        const auto prev = start - 1;
+        const auto glyph = til::at(_attrs, prev).IsGlyphStored() ? *GlyphAt(prev).begin() : til::at(_chars, prev);
+        if (_DelimiterClassOf(glyph, wordDelimiters) != initial)
+        {
+            break;
+        }
+        start = prev;
+    }
+    return start;
+}
+
+// Method Description:
+// - find the column just past the run of cells that share the delimiter class
+//   of the given column, scanning right within this row
+// Arguments:
+// - column: a column inside the run
+// - wordDelimiters: the delimiters defined as a part of the DelimiterClass::DelimiterChar
+// Return Value:
+// - one past the last column of the run (exclusive); the row width if the run
+//   reaches the end of the row
+size_t CharRow::DelimiterRunEndAt(const size_t column, const std::wstring_view wordDelimiters) const
+{
+    THROW_HR_IF(E_INVALIDARG, column >= _chars.size());
+
+    const auto initial = DelimiterClassAt(column, wordDelimiters);
+    auto end = column + 1;
+    while (end < _chars.size())
+    {
+        const auto glyph = til::at(_attrs, end).IsGlyphStored() ? *GlyphAt(end).begin() : til::at(_chars, end);
+        if (_DelimiterClassOf(glyph, wordDelimiters) != initial)
+        {
+            break;
+        }
+        ++end;
+    }
+    return end;
+}
+
+// Method Description:
+// - classify a single glyph for word navigation purposes
+// Arguments:
+// - glyph: the first character of the glyph under observation
+// - wordDelimiters: the delimiters defined as a part of the DelimiterClass::DelimiterChar
+// Return Value:
+// - the delimiter class for the given char
+DelimiterClass CharRow::_DelimiterClassOf(const wchar_t glyph, const std::wstring_view wordDelimiters) noexcept
+{
     if (glyph <= UNICODE_SPACE)
     {
         return DelimiterClass::ControlChar;
@@ -250,25 +350,61 @@ const DelimiterClass CharRow::DelimiterClassAt(const size_t column, const std::w
     }
 }
 
-UnicodeStorage& CharRow::GetUnicodeStorage() noexcept
+// Routine Description:
+// - fetches the overflow glyph text stored for the given column
+// Arguments:
+// - column - the column to look up
+// Return Value:
+// - the stored glyph text
+// Note: will throw exception if no overflow text is stored for the column
+const std::wstring& CharRow::GetOverflowText(const size_t column) const
 {
-    return _pParent->GetUnicodeStorage();
+    for (const auto& entry : _overflow)
+    {
+        if (entry.first == column)
+        {
+            return entry.second;
+        }
+    }
+    THROW_HR(E_INVALIDARG);
 }
 
-const UnicodeStorage& CharRow::GetUnicodeStorage() const noexcept
+// Routine Description:
+// - stores (or overwrites) overflow glyph text for the given column
+// Arguments:
+// - column - the column to store the text for
+// - chars - the glyph text to store
+// Return Value:
+// - <none>
+void CharRow::StoreOverflowText(const size_t column, const std::wstring_view chars)
 {
-    return _pParent->GetUnicodeStorage();
+    for (auto& entry : _overflow)
+    {
+        if (entry.first == column)
+        {
+            entry.second = chars;
+            return;
+        }
+    }
+    _overflow.emplace_back(gsl::narrow<uint16_t>(column), std::wstring{ chars });
 }
 
 // Routine Description:
-// - calculates the key used by the given column of the char row to store glyph data in UnicodeStorage
+// - removes any overflow glyph text stored for the given column
 // Arguments:
-// - column - the column to generate the key for
+// - column - the column to remove the text for
 // Return Value:
-// - the COORD key for data access from UnicodeStorage for the column
-COORD CharRow::GetStorageKey(const size_t column) const noexcept
+// - <none>
+void CharRow::EraseOverflowText(const size_t column) noexcept
 {
-    return { gsl::narrow<SHORT>(column), _pParent->GetId() };
+    for (auto it = _overflow.begin(); it != _overflow.end(); ++it)
+    {
+        if (it->first == column)
+        {
+            _overflow.erase(it);
+            return;
+        }
+    }
 }
 
 // Routine Description:
@@ -22,8 +22,6 @@ Revision History:
 
 #include "DbcsAttribute.hpp"
 #include "CharRowCellReference.hpp"
-#include "CharRowCell.hpp"
-#include "UnicodeStorage.hpp"
 
 class ROW;
 
@@ -44,45 +42,56 @@ enum class DelimiterClass
 //       ^    ^                  ^                     ^
 //       |    |                  |                     |
 //     Chars Left               Right                end of Chars buffer
+//
+// storage is columnar: one contiguous run of glyph data and one parallel
+// run of DbcsAttributes, so that bulk writes and renderer scans touch
+// cache-linear memory instead of hopping between interleaved cells.
 class CharRow final
 {
 public:
     using glyph_type = typename wchar_t;
-    using value_type = typename CharRowCell;
-    using iterator = typename boost::container::small_vector_base<value_type>::iterator;
-    using const_iterator = typename boost::container::small_vector_base<value_type>::const_iterator;
-    using const_reverse_iterator = typename boost::container::small_vector_base<value_type>::const_reverse_iterator;
     using reference = typename CharRowCellReference;
 
-    CharRow(size_t rowWidth, ROW* const pParent) noexcept;
+    // columnar runs draw their heap storage (when the row is wider than the
+    // inline capacity) from the owning TextBuffer's slab allocator.
+    template<typename T>
+    using run_storage = boost::container::small_vector<T, 120, std::pmr::polymorphic_allocator<T>>;
+
+    CharRow(size_t rowWidth, ROW* const pParent, std::pmr::memory_resource* const resource) noexcept;
 
     size_t size() const noexcept;
     [[nodiscard]] HRESULT Resize(const size_t newSize) noexcept;
+    void ReleaseStorage() noexcept;
     size_t MeasureLeft() const noexcept;
-    size_t MeasureRight() const;
+    size_t MeasureRight() const noexcept;
     bool ContainsText() const noexcept;
     const DbcsAttribute& DbcsAttrAt(const size_t column) const;
     DbcsAttribute& DbcsAttrAt(const size_t column);
     void ClearGlyph(const size_t column);
 
     const DelimiterClass DelimiterClassAt(const size_t column, const std::wstring_view wordDelimiters) const;
+    size_t DelimiterRunStartAt(const size_t column, const std::wstring_view wordDelimiters) const;
+    size_t DelimiterRunEndAt(const size_t column, const std::wstring_view wordDelimiters) const;
 
     // working with glyphs
     const reference GlyphAt(const size_t column) const;
     reference GlyphAt(const size_t column);
 
-    // iterators
-    iterator begin() noexcept;
-    const_iterator cbegin() const noexcept;
-    const_iterator begin() const noexcept { return cbegin(); }
-
-    iterator end() noexcept;
-    const_iterator cend() const noexcept;
-    const_iterator end() const noexcept { return cend(); }
-
-    UnicodeStorage& GetUnicodeStorage() noexcept;
-    const UnicodeStorage& GetUnicodeStorage() const noexcept;
-    COORD GetStorageKey(const size_t column) const noexcept;
+    // contiguous views over the columnar storage, one entry per column.
+    // Chars() does not resolve overflow glyphs; columns whose DbcsAttribute
+    // has the glyph-stored flag set hold a placeholder.
+    std::wstring_view Chars() const noexcept { return { _chars.data(), _chars.size() }; }
+    gsl::span<wchar_t> Chars() noexcept { return { _chars.data(), _chars.size() }; }
+    gsl::span<const DbcsAttribute> Attrs() const noexcept { return { _attrs.data(), _attrs.size() }; }
+    gsl::span<DbcsAttribute> Attrs() noexcept { return { _attrs.data(), _attrs.size() }; }
+
+    // per-row side storage for glyphs too long to fit inline in the char run.
+    // overflow is rare (a handful of cells per row at most), so lookups are a
+    // short row-local scan and the entries travel with the row through
+    // rotates, scrolls and reflow with no global re-keying.
+    const std::wstring& GetOverflowText(const size_t column) const;
+    void StoreOverflowText(const size_t column, const std::wstring_view chars);
+    void EraseOverflowText(const size_t column) noexcept;
 
     void UpdateParent(ROW* const pParent);
 
@@ -94,22 +103,29 @@ private:
     void ClearCell(const size_t column);
     std::wstring GetText() const;
 
+    bool _isSpace(const size_t column) const noexcept;
+
+    static DelimiterClass _DelimiterClassOf(const wchar_t glyph, const std::wstring_view wordDelimiters) noexcept;
+
 protected:
-    // storage for glyph data and dbcs attributes
-    boost::container::small_vector<value_type, 120> _data;
+    // columnar storage for glyph data and dbcs attributes.
+    // the two runs are always the same length (one entry per column).
+    run_storage<wchar_t> _chars;
+    run_storage<DbcsAttribute> _attrs;
+
+    // overflow glyph text, keyed by column. kept unsorted; the vector is
+    // almost always empty and rarely holds more than a couple of entries.
+    boost::container::small_vector<std::pair<uint16_t, std::wstring>, 1> _overflow;
 
     // ROW that this CharRow belongs to
     ROW* _pParent;
 };
 
 template<typename InputIt1, typename InputIt2>
-void OverwriteColumns(InputIt1 startChars, InputIt1 endChars, InputIt2 startAttrs, CharRow::iterator outIt)
+void OverwriteColumns(InputIt1 startChars, InputIt1 endChars, InputIt2 startAttrs, CharRow& row)
 {
-    std::transform(startChars,
-                   endChars,
-                   startAttrs,
-                   outIt,
-                   [](const wchar_t wch, const DbcsAttribute attr) {
-                       return CharRow::value_type{ wch, attr };
-                   });
+    const auto chars = row.Chars();
+    const auto attrs = row.Attrs();
+    std::copy(startChars, endChars, chars.begin());
+    std::copy_n(startAttrs, endChars - startChars, attrs.begin());
 }
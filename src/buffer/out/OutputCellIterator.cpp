@@ -108,6 +108,25 @@ OutputCellIterator::OutputCellIterator(const std::wstring_view utf16Text, const
 {
 }
 
+// Routine Description:
+// - This is an iterator over a single glyph whose column width the caller
+//   already knows, so the usual width classification can be skipped. Used
+//   when conpty supplies glyph width hints alongside the text.
+// Arguments:
+// - utf16Glyph - UTF-16 text for exactly one glyph
+// - dbcsAttribute - the known width of the glyph (leading means full-width)
+// - attribute - Color to apply to the glyph
+OutputCellIterator::OutputCellIterator(const std::wstring_view utf16Glyph, const DbcsAttribute dbcsAttribute, const TextAttribute& attribute) :
+    _mode(Mode::Loose),
+    _currentView(s_GenerateView(utf16Glyph, dbcsAttribute, attribute)),
+    _run(utf16Glyph),
+    _attr(attribute),
+    _distance(0),
+    _pos(0),
+    _fillLimit(0)
+{
+}
+
 // Routine Description:
 // - This is an iterator over legacy colors only. The text is not modified.
 // Arguments:
@@ -408,6 +427,26 @@ OutputCellView OutputCellIterator::s_GenerateView(const std::wstring_view view,
     return OutputCellView(glyph, dbcsAttr, attr, behavior);
 }
 
+// Routine Description:
+// - Static function to create a view.
+// - It's pulled out statically so it can be used during construction with just the given
+//   variables (so OutputCellView doesn't need an empty default constructor)
+// - Unlike the variants above, the width of the glyph is supplied by the
+//   caller rather than inferred, for when it's already known.
+// Arguments:
+// - view - View representing characters corresponding to a single glyph
+// - dbcsAttr - The known width of the glyph
+// - attr - Color attributes to apply to the text
+// Return Value:
+// - Object representing the view into this cell
+OutputCellView OutputCellIterator::s_GenerateView(const std::wstring_view view,
+                                                  const DbcsAttribute dbcsAttr,
+                                                  const TextAttribute attr)
+{
+    const auto glyph = Utf16Parser::ParseNext(view);
+    return OutputCellView(glyph, dbcsAttr, attr, TextAttributeBehavior::Stored);
+}
+
 // Routine Description:
 // - Static function to create a view.
 // - It's pulled out statically so it can be used during construction with just the given
@@ -527,6 +566,47 @@ OutputCellView OutputCellIterator::s_GenerateView(const OutputCell& cell)
     return OutputCellView(cell.Chars(), cell.DbcsAttr(), cell.TextAttr(), cell.TextAttrBehavior());
 }
 
+// Routine Description:
+// - Retrieves the not-yet-consumed portion of the backing text when this
+//   iterator is a "loose" text + attribute run. Lets ROW::WriteCells bulk
+//   commit a run of simple glyphs instead of stepping cell by cell.
+// Return Value:
+// - The remaining text of a loose run, or an empty view if this iterator is
+//   in any other mode (or is parked on the trailing half of a wide glyph).
+std::wstring_view OutputCellIterator::GetLooseTextRun() const
+{
+    if (_mode != Mode::Loose || _currentView.DbcsAttr().IsTrailing())
+    {
+        return {};
+    }
+    return std::get<std::wstring_view>(_run).substr(_pos);
+}
+
+// Routine Description:
+// - Retrieves the uniform attribute of a loose run. Only meaningful when
+//   GetLooseTextRun returned a non-empty view.
+// Return Value:
+// - The attribute the whole loose run is to be written with.
+TextAttribute OutputCellIterator::GetLooseAttr() const noexcept
+{
+    return _attr;
+}
+
+// Routine Description:
+// - Advances this iterator past characters that the caller committed in bulk,
+//   one cell per character. The counterpart of GetLooseTextRun.
+// Arguments:
+// - charCount - the number of characters (== cells) consumed by the caller
+void OutputCellIterator::ConsumeLooseChars(const size_t charCount)
+{
+    _pos += charCount;
+    _distance += charCount;
+    if (operator bool())
+    {
+        _currentView = s_GenerateView(std::get<std::wstring_view>(_run).substr(_pos), _attr);
+    }
+}
+
 // Routine Description:
 // - Gets the distance between two iterators relative to the input data given in.
 // Return Value:
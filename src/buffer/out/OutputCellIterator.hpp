@@ -39,6 +39,7 @@ public:
     OutputCellIterator(const CHAR_INFO& charInfo, const size_t fillLimit = 0) noexcept;
     OutputCellIterator(const std::wstring_view utf16Text);
     OutputCellIterator(const std::wstring_view utf16Text, const TextAttribute& attribute, const size_t fillLimit = 0);
+    OutputCellIterator(const std::wstring_view utf16Glyph, const DbcsAttribute dbcsAttribute, const TextAttribute& attribute);
     OutputCellIterator(const gsl::span<const WORD> legacyAttributes) noexcept;
     OutputCellIterator(const gsl::span<const CHAR_INFO> charInfos) noexcept;
     OutputCellIterator(const gsl::span<const OutputCell> cells);
@@ -52,6 +53,10 @@ public:
     ptrdiff_t GetInputDistance(OutputCellIterator other) const noexcept;
     friend ptrdiff_t operator-(OutputCellIterator one, OutputCellIterator two) = delete;
 
+    std::wstring_view GetLooseTextRun() const;
+    TextAttribute GetLooseAttr() const noexcept;
+    void ConsumeLooseChars(const size_t charCount);
+
     OutputCellIterator& operator++();
     OutputCellIterator operator++(int);
 
@@ -109,6 +114,10 @@ private:
                                          const TextAttribute attr,
                                          const TextAttributeBehavior behavior);
 
+    static OutputCellView s_GenerateView(const std::wstring_view view,
+                                         const DbcsAttribute dbcsAttr,
+                                         const TextAttribute attr);
+
     static OutputCellView s_GenerateView(const wchar_t& wch) noexcept;
     static OutputCellView s_GenerateViewLegacyAttr(const WORD& legacyAttr) noexcept;
     static OutputCellView s_GenerateView(const TextAttribute& attr) noexcept;
@@ -19,7 +19,7 @@
 ROW::ROW(const SHORT rowId, const unsigned short rowWidth, const TextAttribute fillAttribute, TextBuffer* const pParent) :
     _id{ rowId },
     _rowWidth{ rowWidth },
-    _charRow{ rowWidth, this },
+    _charRow{ rowWidth, this, pParent->GetRowStorageResource() },
     _attrRow{ rowWidth, fillAttribute },
     _lineRendition{ LineRendition::SingleWidth },
     _wrapForced{ false },
@@ -36,9 +36,29 @@ ROW::ROW(const SHORT rowId, const unsigned short rowWidth, const TextAttribute f
 // - <none>
 bool ROW::Reset(const TextAttribute Attr)
 {
+    BumpVersion();
     _lineRendition = LineRendition::SingleWidth;
     _wrapForced = false;
     _doubleBytePadded = false;
+    try
+    {
+        // A packed row is about to be overwritten wholesale, so the packed
+        // data can be discarded without rehydrating it first. We only need
+        // to restore the expanded storage to the row's width.
+        if (_compressed)
+        {
+            _compressed.reset();
+            if (FAILED(_charRow.Resize(_rowWidth)))
+            {
+                return false;
+            }
+        }
+    }
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION();
+        return false;
+    }
     _charRow.Reset();
     try
     {
@@ -60,6 +80,15 @@ bool ROW::Reset(const TextAttribute Attr)
 // - S_OK if successful, otherwise relevant error
 [[nodiscard]] HRESULT ROW::Resize(const unsigned short width)
 {
+    BumpVersion();
+    // the packed representation is tied to the old width, so rehydrate before
+    // resizing (resizes are rare relative to rows going cold).
+    try
+    {
+        Decompress();
+    }
+    CATCH_RETURN();
+
     RETURN_IF_FAILED(_charRow.Resize(width));
     try
     {
@@ -73,25 +102,145 @@ bool ROW::Reset(const TextAttribute Attr)
 }
 
 // Routine Description:
-// - clears char data in column in row
+// - packs this row into the compact cold-scrollback representation and
+//   releases the expanded char/attribute storage. No-op if already packed,
+//   or if the row holds an unpaired surrogate the packed UTF-8 form couldn't
+//   represent. Glyphs that overflowed into the row's side buffer stay there;
+//   packing only releases the columnar char/attribute runs.
 // Arguments:
-// - column - 0-indexed column index
+// - <none>
 // Return Value:
 // - <none>
-void ROW::ClearColumn(const size_t column)
+void ROW::Compress()
 {
-    THROW_HR_IF(E_INVALIDARG, column >= _charRow.size());
-    _charRow.ClearCell(column);
+    if (_compressed)
+    {
+        return;
+    }
+
+    const auto chars = _charRow.Chars();
+
+    // A surrogate code unit in the columnar run is always unpaired - proper
+    // pairs arrive as multi-unit glyphs and overflow into the side buffer -
+    // and UTF-8 cannot represent one; the conversion below would quietly
+    // substitute U+FFFD and the row would rehydrate changed. Such rows are
+    // vanishingly rare, so leave them expanded rather than packing a lossy
+    // copy.
+    for (const auto wch : chars)
+    {
+        if (wch >= 0xD800 && wch <= 0xDFFF)
+        {
+            return;
+        }
+    }
+
+    auto packed = std::make_unique<CompressedRowData>(_pParent->GetRowStorageResource());
+
+    THROW_IF_FAILED(til::u16u8(std::wstring_view{ chars.data(), chars.size() }, packed->chars));
+    // the conversion sizes its output for the worst case (3 bytes per code
+    // unit); packed rows live a long time, so give the slack back.
+    packed->chars.shrink_to_fit();
+
+    // run length encode the DBCS attributes; rows are overwhelmingly a
+    // single run of "single" cells, which packs into one entry.
+    typename decltype(CompressedRowData::dbcsAttrs)::container runs;
+    for (const auto& attr : _charRow.Attrs())
+    {
+        if (!runs.empty() && runs.back().value == attr)
+        {
+            ++runs.back().length;
+        }
+        else
+        {
+            runs.emplace_back(attr, uint16_t{ 1 });
+        }
+    }
+    packed->dbcsAttrs = { std::move(runs) };
+
+    _charRow.ReleaseStorage();
+    _compressed = std::move(packed);
 }
 
-UnicodeStorage& ROW::GetUnicodeStorage() noexcept
+// Routine Description:
+// - rehydrates a packed row back into expanded storage. No-op if the row is
+//   not packed; callers on the read path can use it unconditionally.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void ROW::Decompress()
 {
-    return _pParent->GetUnicodeStorage();
+    if (!_compressed)
+    {
+        return;
+    }
+
+    const auto packed = std::move(_compressed);
+
+    THROW_IF_FAILED(_charRow.Resize(_rowWidth));
+
+    std::wstring text;
+    THROW_IF_FAILED(til::u8u16(std::string_view{ packed->chars }, text));
+    const auto chars = _charRow.Chars();
+    std::copy_n(text.cbegin(), std::min(text.size(), chars.size()), chars.begin());
+
+    const auto attrs = _charRow.Attrs();
+    size_t column = 0;
+    for (const auto& run : packed->dbcsAttrs.runs())
+    {
+        for (auto length = run.length; length > 0 && column < attrs.size(); --length, ++column)
+        {
+            attrs[column] = run.value;
+        }
+    }
 }
 
-const UnicodeStorage& ROW::GetUnicodeStorage() const noexcept
+// Routine Description:
+// - surrenders the packed payload of a cold row, reclaiming its memory at the
+//   cost of its contents; the row reads back as blank in the given attribute
+//   when it is next rehydrated. Only packed rows are eligible - anything
+//   still expanded may be part of the active region - so this is a no-op for
+//   hot rows.
+// Arguments:
+// - attr - the attribute (color) the emptied row should carry
+// Return Value:
+// - true if a payload was surrendered, false if the row wasn't packed
+bool ROW::TrimCompressed(const TextAttribute attr)
+{
+    if (!_compressed)
+    {
+        return false;
+    }
+
+    BumpVersion();
+    _compressed->chars.clear();
+    _compressed->chars.shrink_to_fit();
+    _compressed->dbcsAttrs = {};
+    try
+    {
+        _attrRow.Reset(attr);
+    }
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION();
+    }
+    _lineRendition = LineRendition::SingleWidth;
+    _wrapForced = false;
+    _doubleBytePadded = false;
+    return true;
+}
+
+// Routine Description:
+// - clears char data in column in row
+// Arguments:
+// - column - 0-indexed column index
+// Return Value:
+// - <none>
+void ROW::ClearColumn(const size_t column)
 {
-    return _pParent->GetUnicodeStorage();
+    THROW_HR_IF(E_INVALIDARG, column >= _charRow.size());
+    BumpVersion();
+    _charRow.ClearCell(column);
 }
 
 // Routine Description:
@@ -108,13 +257,63 @@ OutputCellIterator ROW::WriteCells(OutputCellIterator it, const size_t index, co
     THROW_HR_IF(E_INVALIDARG, index >= _charRow.size());
     THROW_HR_IF(E_INVALIDARG, limitRight.value_or(0) >= _charRow.size());
 
+    // the row's contents are about to change; let consumers know
+    BumpVersion();
+
     // If we're given a right-side column limit, use it. Otherwise, the write limit is the final column index available in the char row.
     const auto finalColumnInRow = limitRight.value_or(_charRow.size() - 1);
 
+    uint16_t currentIndex = gsl::narrow_cast<uint16_t>(index);
+
+    // Bulk fast path: when the iterator is a loose text + attribute run, the
+    // longest prefix of simple narrow glyphs can be committed in one pass -
+    // a straight copy into the contiguous char run, one fill of the DBCS
+    // attributes and a single ATTR_ROW run insert - instead of paying the
+    // iterator increment, width classification and attribute compare per
+    // glyph. Anything past the simple prefix (wide glyphs, controls,
+    // surrogates) falls through to the cell-by-cell loop below.
+    const auto looseRun = it.GetLooseTextRun();
+    if (!looseRun.empty())
+    {
+        const size_t columnsAvailable = finalColumnInRow - currentIndex + 1;
+        const size_t bulkMax = std::min(columnsAvailable, looseRun.size());
+        size_t bulkCount = 0;
+        while (bulkCount < bulkMax)
+        {
+            const auto wch = til::at(looseRun, bulkCount);
+            if (wch < UNICODE_SPACE || wch >= L'\x7f')
+            {
+                break;
+            }
+            ++bulkCount;
+        }
+
+        if (bulkCount > 0)
+        {
+            const auto chars = _charRow.Chars();
+            std::copy_n(looseRun.cbegin(), bulkCount, chars.begin() + currentIndex);
+            const auto attrs = _charRow.Attrs();
+            std::fill_n(attrs.begin() + currentIndex, bulkCount, DbcsAttribute{});
+            _attrRow.Replace(currentIndex, gsl::narrow_cast<uint16_t>(currentIndex + bulkCount), it.GetLooseAttr());
+            it.ConsumeLooseChars(bulkCount);
+            currentIndex = gsl::narrow_cast<uint16_t>(currentIndex + bulkCount);
+
+            // mirror the per-cell loop's wrap handling if we filled the last column
+            if (wrap.has_value() && currentIndex == finalColumnInRow + 1)
+            {
+                SetWrapForced(*wrap);
+            }
+        }
+    }
+
+    if (!it || currentIndex > finalColumnInRow)
+    {
+        return it;
+    }
+
     auto currentColor = it->TextAttr();
     uint16_t colorUses = 0;
-    uint16_t colorStarts = gsl::narrow_cast<uint16_t>(index);
-    uint16_t currentIndex = colorStarts;
+    uint16_t colorStarts = currentIndex;
 
     while (it && currentIndex <= finalColumnInRow)
     {
@@ -196,3 +395,151 @@ OutputCellIterator ROW::WriteCells(OutputCellIterator it, const size_t index, co
 
     return it;
 }
+
+// Routine Description:
+// - fills a run of cells with a single narrow glyph and attribute.
+// - the columnar glyph and DBCS runs are committed with one fill each and the
+//   color lands in the attribute row as a single run, instead of paying the
+//   iterator increment and attribute compare per cell like a fill-mode
+//   OutputCellIterator through WriteCells would.
+// Arguments:
+// - index - column to start filling at
+// - count - number of cells to fill
+// - glyph - narrow glyph to store in every filled cell
+// - attr - color attribute to apply to every filled cell
+// - wrap - change the wrap flag if the fill covers the final column of the row. (see WriteCells)
+// Return Value:
+// - <none>
+void ROW::FillRange(const size_t index, const size_t count, const wchar_t glyph, const TextAttribute attr, const std::optional<bool> wrap)
+{
+    THROW_HR_IF(E_INVALIDARG, index + count > _charRow.size());
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    // the row's contents are about to change; let consumers know
+    BumpVersion();
+
+    // Release any overflow glyphs stored for the cells we're about to
+    // overwrite; the raw fill below bypasses the cell reference that would
+    // normally do this.
+    const auto attrs = _charRow.Attrs();
+    for (size_t column = index; column < index + count; ++column)
+    {
+        if (til::at(attrs, column).IsGlyphStored())
+        {
+            _charRow.EraseOverflowText(column);
+        }
+    }
+
+    const auto chars = _charRow.Chars();
+    std::fill_n(chars.begin() + index, count, glyph);
+    std::fill_n(attrs.begin() + index, count, DbcsAttribute{});
+    _attrRow.Replace(gsl::narrow<uint16_t>(index), gsl::narrow<uint16_t>(index + count), attr);
+
+    // The fill can bisect a DBCS pair at either edge; pad the orphaned
+    // neighboring halves out with blanks, the same way CopyRangeFrom does.
+    if (index > 0 && til::at(attrs, index - 1).IsLeading())
+    {
+        _charRow.ClearCell(index - 1);
+    }
+    if (index + count < _charRow.size() && til::at(attrs, index + count).IsTrailing())
+    {
+        _charRow.ClearCell(index + count);
+    }
+
+    // mirror WriteCells' wrap handling if the fill covered the final column
+    if (wrap.has_value() && index + count == _charRow.size())
+    {
+        SetWrapForced(*wrap);
+    }
+}
+
+// Routine Description:
+// - copies a run of cells from another row (or another part of this row) into
+//   this row, operating on the columnar glyph/DBCS runs and the attribute
+//   run list directly instead of round-tripping every cell through OutputCell.
+// - overlapping ranges within the same row behave like memmove.
+// - both rows must be in their expanded (not compressed) representation.
+// Arguments:
+// - source - row to copy cells from
+// - sourceIndex - first column in source to copy
+// - targetIndex - first column in this row to overwrite
+// - length - number of columns to copy
+// Return Value:
+// - <none>
+void ROW::CopyRangeFrom(const ROW& source, const size_t sourceIndex, const size_t targetIndex, const size_t length)
+{
+    THROW_HR_IF(E_INVALIDARG, sourceIndex + length > source._charRow.size());
+    THROW_HR_IF(E_INVALIDARG, targetIndex + length > _charRow.size());
+
+    if (length == 0)
+    {
+        return;
+    }
+
+    // the row's contents are about to change; let consumers know
+    BumpVersion();
+
+    // Save the overflow glyphs covered by the source range up front; a
+    // same-row overlapping move could otherwise clobber them mid-copy.
+    boost::container::small_vector<std::pair<size_t, std::wstring>, 2> overflow;
+    {
+        const auto sourceAttrs = source._charRow.Attrs();
+        for (size_t i = 0; i < length; ++i)
+        {
+            if (til::at(sourceAttrs, sourceIndex + i).IsGlyphStored())
+            {
+                overflow.emplace_back(i, source._charRow.GetOverflowText(sourceIndex + i));
+            }
+        }
+    }
+
+    // The glyph and DBCS runs are trivially copyable columnar storage;
+    // memmove gives the right answer for every overlap direction.
+    const auto sourceChars = source._charRow.Chars();
+    const auto targetChars = _charRow.Chars();
+    memmove(targetChars.data() + targetIndex, sourceChars.data() + sourceIndex, length * sizeof(wchar_t));
+
+    const auto sourceAttrs = source._charRow.Attrs();
+    const auto targetAttrs = _charRow.Attrs();
+    memmove(targetAttrs.data() + targetIndex, sourceAttrs.data() + sourceIndex, length * sizeof(DbcsAttribute));
+
+    // Color attributes move as runs, not cells.
+    _attrRow.CopyRangeFrom(source._attrRow,
+                           gsl::narrow<uint16_t>(sourceIndex),
+                           gsl::narrow<uint16_t>(targetIndex),
+                           gsl::narrow<uint16_t>(length));
+
+    // Refresh the overflow side storage for the overwritten range.
+    for (size_t i = 0; i < length; ++i)
+    {
+        _charRow.EraseOverflowText(targetIndex + i);
+    }
+    for (const auto& [offset, text] : overflow)
+    {
+        _charRow.StoreOverflowText(targetIndex + offset, text);
+    }
+
+    // The copy can bisect a DBCS pair at either edge of the target range (or
+    // of the cells neighboring it). Pad the orphaned halves out with blanks,
+    // the same way WriteCells does at the ends of a row.
+    if (til::at(targetAttrs, targetIndex).IsTrailing())
+    {
+        _charRow.ClearCell(targetIndex);
+    }
+    if (til::at(targetAttrs, targetIndex + length - 1).IsLeading())
+    {
+        _charRow.ClearCell(targetIndex + length - 1);
+    }
+    if (targetIndex > 0 && til::at(targetAttrs, targetIndex - 1).IsLeading())
+    {
+        _charRow.ClearCell(targetIndex - 1);
+    }
+    if (targetIndex + length < _charRow.size() && til::at(targetAttrs, targetIndex + length).IsTrailing())
+    {
+        _charRow.ClearCell(targetIndex + length);
+    }
+}
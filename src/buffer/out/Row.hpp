@@ -25,10 +25,27 @@ Revision History:
 #include "OutputCell.hpp"
 #include "OutputCellIterator.hpp"
 #include "CharRow.hpp"
-#include "UnicodeStorage.hpp"
 
 class TextBuffer;
 
+// Packed representation of a row that has scrolled out of the active region.
+// Cold scrollback is written once and almost never re-read, so the glyph run
+// is held as UTF-8 and the DBCS attributes as a run length encoding while the
+// expanded CharRow storage is released. Attribute (color) data is untouched;
+// ATTR_ROW is already run length encoded. The glyph run draws from the owning
+// buffer's row storage resource so packed rows count against the buffer's
+// memory tally like everything else it holds.
+struct CompressedRowData
+{
+    explicit CompressedRowData(std::pmr::memory_resource* const resource) noexcept :
+        chars{ resource }
+    {
+    }
+
+    std::pmr::string chars;
+    til::small_rle<DbcsAttribute, uint16_t, 1> dbcsAttrs;
+};
+
 class ROW final
 {
 public:
@@ -54,16 +71,28 @@ public:
     SHORT GetId() const noexcept { return _id; }
     void SetId(const SHORT id) noexcept { _id = id; }
 
+    // Monotonically advances whenever the row's contents change through one
+    // of the mutation entry points (Reset/Resize/ClearColumn/WriteCells).
+    // Consumers can remember a version and compare to skip unchanged rows
+    // instead of diffing cell contents.
+    uint64_t GetVersion() const noexcept { return _version; }
+    void BumpVersion() noexcept { ++_version; }
+
     bool Reset(const TextAttribute Attr);
     [[nodiscard]] HRESULT Resize(const unsigned short width);
 
+    bool IsCompressed() const noexcept { return static_cast<bool>(_compressed); }
+    void Compress();
+    void Decompress();
+    bool TrimCompressed(const TextAttribute attr);
+
     void ClearColumn(const size_t column);
     std::wstring GetText() const { return _charRow.GetText(); }
 
-    UnicodeStorage& GetUnicodeStorage() noexcept;
-    const UnicodeStorage& GetUnicodeStorage() const noexcept;
-
     OutputCellIterator WriteCells(OutputCellIterator it, const size_t index, const std::optional<bool> wrap = std::nullopt, std::optional<size_t> limitRight = std::nullopt);
+    void FillRange(const size_t index, const size_t count, const wchar_t glyph, const TextAttribute attr, const std::optional<bool> wrap = std::nullopt);
+
+    void CopyRangeFrom(const ROW& source, const size_t sourceIndex, const size_t targetIndex, const size_t length);
 
 #ifdef UNIT_TESTING
     friend constexpr bool operator==(const ROW& a, const ROW& b) noexcept;
@@ -81,6 +110,10 @@ private:
     // Occurs when the user runs out of text to support a double byte character and we're forced to the next line
     bool _doubleBytePadded;
     TextBuffer* _pParent; // non ownership pointer
+    // non-null while this row is packed into the cold-scrollback representation
+    std::unique_ptr<CompressedRowData> _compressed;
+    // bumped on every mutation; see GetVersion
+    uint64_t _version = 0;
 };
 
 #ifdef UNIT_TESTING
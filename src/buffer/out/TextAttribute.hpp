@@ -31,32 +31,32 @@ class TextAttribute final
 {
 public:
     constexpr TextAttribute() noexcept :
-        _wAttrLegacy{ 0 },
-        _foreground{},
-        _background{},
+        _legacyMeta{ 0 },
         _extendedAttrs{ ExtendedAttributes::Normal },
-        _hyperlinkId{ 0 }
+        _hyperlinkId{ 0 },
+        _foreground{},
+        _background{}
     {
     }
 
     explicit constexpr TextAttribute(const WORD wLegacyAttr) noexcept :
-        _wAttrLegacy{ gsl::narrow_cast<WORD>(wLegacyAttr & META_ATTRS) },
-        _foreground{ gsl::at(s_legacyForegroundColorMap, wLegacyAttr & FG_ATTRS) },
-        _background{ gsl::at(s_legacyBackgroundColorMap, (wLegacyAttr & BG_ATTRS) >> 4) },
+        _legacyMeta{ _MetaByte(wLegacyAttr & META_ATTRS) },
         _extendedAttrs{ ExtendedAttributes::Normal },
-        _hyperlinkId{ 0 }
+        _hyperlinkId{ 0 },
+        _foreground{ gsl::at(s_legacyForegroundColorMap, wLegacyAttr & FG_ATTRS) },
+        _background{ gsl::at(s_legacyBackgroundColorMap, (wLegacyAttr & BG_ATTRS) >> 4) }
     {
         // If we're given lead/trailing byte information with the legacy color, strip it.
-        WI_ClearAllFlags(_wAttrLegacy, COMMON_LVB_SBCSDBCS);
+        WI_ClearAllFlags(_legacyMeta, _MetaByte(COMMON_LVB_SBCSDBCS));
     }
 
     constexpr TextAttribute(const COLORREF rgbForeground,
                             const COLORREF rgbBackground) noexcept :
-        _wAttrLegacy{ 0 },
-        _foreground{ rgbForeground },
-        _background{ rgbBackground },
+        _legacyMeta{ 0 },
         _extendedAttrs{ ExtendedAttributes::Normal },
-        _hyperlinkId{ 0 }
+        _hyperlinkId{ 0 },
+        _foreground{ rgbForeground },
+        _background{ rgbBackground }
     {
     }
 
@@ -147,7 +147,7 @@ public:
                // hyperlinks have a visual representation
                !IsHyperlink() &&
                // all other attributes do not have a visual representation
-               (_wAttrLegacy & META_ATTRS) == (other._wAttrLegacy & META_ATTRS) &&
+               _legacyMeta == other._legacyMeta &&
                ((checkForeground && _foreground == other._foreground) ||
                 (!checkForeground && _background == other._background)) &&
                _extendedAttrs == other._extendedAttrs &&
@@ -156,18 +156,26 @@ public:
 
     constexpr bool IsAnyGridLineEnabled() const noexcept
     {
-        return WI_IsAnyFlagSet(_wAttrLegacy, COMMON_LVB_GRID_HORIZONTAL | COMMON_LVB_GRID_LVERTICAL | COMMON_LVB_GRID_RVERTICAL | COMMON_LVB_UNDERSCORE);
+        return WI_IsAnyFlagSet(_legacyMeta, _MetaByte(COMMON_LVB_GRID_HORIZONTAL | COMMON_LVB_GRID_LVERTICAL | COMMON_LVB_GRID_RVERTICAL | COMMON_LVB_UNDERSCORE));
     }
 
 private:
+    // The legacy meta attributes (the COMMON_LVB bits) all live in the high
+    // byte of a legacy attribute WORD, so we only store that byte and
+    // translate the flag constants down to it.
+    static constexpr uint8_t _MetaByte(const WORD metaAttrs) noexcept
+    {
+        return gsl::narrow_cast<uint8_t>(metaAttrs >> 8);
+    }
+
     static std::array<TextColor, 16> s_legacyForegroundColorMap;
     static std::array<TextColor, 16> s_legacyBackgroundColorMap;
 
-    uint16_t _wAttrLegacy; // sizeof: 2, alignof: 2
+    uint8_t _legacyMeta; // sizeof: 1, alignof: 1
+    ExtendedAttributes _extendedAttrs; // sizeof: 1, alignof: 1
     uint16_t _hyperlinkId; // sizeof: 2, alignof: 2
     TextColor _foreground; // sizeof: 4, alignof: 1
     TextColor _background; // sizeof: 4, alignof: 1
-    ExtendedAttributes _extendedAttrs; // sizeof: 1, alignof: 1
 
 #ifdef UNIT_TESTING
     friend class TextBufferTests;
@@ -186,7 +194,7 @@ enum class TextAttributeBehavior
 
 constexpr bool operator==(const TextAttribute& a, const TextAttribute& b) noexcept
 {
-    return a._wAttrLegacy == b._wAttrLegacy &&
+    return a._legacyMeta == b._legacyMeta &&
            a._foreground == b._foreground &&
            a._background == b._background &&
            a._extendedAttrs == b._extendedAttrs &&
@@ -218,7 +226,7 @@ namespace WEX
                     VerifyOutputTraits<TextColor>::ToString(attr._foreground).GetBuffer(),
                     VerifyOutputTraits<TextColor>::ToString(attr._background).GetBuffer(),
                     attr.IsIntense(),
-                    attr._wAttrLegacy,
+                    static_cast<WORD>(attr._legacyMeta) << 8,
                     static_cast<DWORD>(attr._extendedAttrs));
             }
         };
@@ -29,6 +29,7 @@ Search::Search(IUiaData& uiaData,
     _direction(direction),
     _sensitivity(sensitivity),
     _needle(s_CreateNeedleFromString(str)),
+    _needleText(s_CreateFlatNeedle(str, sensitivity)),
     _uiaData(uiaData),
     _coordAnchor(s_GetInitialAnchor(uiaData, direction))
 {
@@ -54,6 +55,7 @@ Search::Search(IUiaData& uiaData,
     _direction(direction),
     _sensitivity(sensitivity),
     _needle(s_CreateNeedleFromString(str)),
+    _needleText(s_CreateFlatNeedle(str, sensitivity)),
     _coordAnchor(anchor),
     _uiaData(uiaData)
 {
@@ -77,7 +79,24 @@ bool Search::FindNext()
 
     do
     {
-        if (_FindNeedleInHaystackAt(_coordNext, _coordSelStart, _coordSelEnd))
+        // Check the buffer's cached row text first: if this row doesn't
+        // contain the first character of the needle anywhere, no match can
+        // start in it and the whole row can be skipped without stepping a
+        // cell iterator across it. (Matches that merely continue into this
+        // row were already found from their starting row.) We never skip the
+        // anchor row, since the stop condition below must see the anchor.
+        if (_coordNext.Y != _coordAnchor.Y && !_RowMayContainNeedle(_coordNext.Y))
+        {
+            // Jump to the edge of the row and let the normal advance step
+            // carry us into the neighboring row (it also handles wrapping).
+            _coordNext.X = _direction == Direction::Forward ?
+                               _uiaData.GetTextBuffer().GetSize().RightInclusive() :
+                               0;
+            _UpdateNextPosition();
+            continue;
+        }
+
+        if (_HasMatchAt(_coordNext, _coordSelStart, _coordSelEnd))
         {
             _UpdateNextPosition();
             _reachedEnd = _coordNext == _coordAnchor;
@@ -177,6 +196,203 @@ COORD Search::s_GetInitialAnchor(IUiaData& uiaData, const Direction direction)
     }
 }
 
+// Routine Description:
+// - Installs a precomputed per-row prefilter. Entries map 1:1 to buffer rows;
+//   a false entry means no match can start in that row and the search loop
+//   will skip it without reading the buffer at all. Callers are responsible
+//   for only installing a filter that still describes the live buffer (e.g.
+//   by comparing content versions with the snapshot it was computed from).
+// Arguments:
+// - rowMayMatch - one entry per buffer row, false to rule the row out
+void Search::ConstrainToRows(std::vector<bool> rowMayMatch) noexcept
+{
+    _rowFilter = std::move(rowMayMatch);
+}
+
+// Routine Description:
+// - Computes the per-row prefilter for ConstrainToRows() from snapshotted row
+//   text. This reads nothing but its arguments, so it can run on any thread
+//   without the terminal lock - the expensive full-buffer text scan happens
+//   here instead of inside the locked search loop.
+// Arguments:
+// - rows - the text of every buffer row, top to bottom
+// - needle - the string being searched for
+// - sensitivity - whether the comparison is case sensitive
+// Return Value:
+// - one entry per row: true if a match could start in that row
+std::vector<bool> Search::s_RowsThatMayContainNeedle(const std::vector<std::wstring>& rows,
+                                                     const std::wstring& needle,
+                                                     const Sensitivity sensitivity)
+{
+    std::vector<bool> rowMayMatch(rows.size(), true);
+    if (needle.empty())
+    {
+        return rowMayMatch;
+    }
+
+    const auto apply = [sensitivity](const wchar_t wch) noexcept {
+        return sensitivity == Sensitivity::CaseInsensitive ? ::towlower(wch) : wch;
+    };
+    const auto first = apply(needle.front());
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        auto mayMatch = false;
+        for (const auto wch : til::at(rows, i))
+        {
+            if (apply(wch) == first)
+            {
+                mayMatch = true;
+                break;
+            }
+        }
+        rowMayMatch.at(i) = mayMatch;
+    }
+    return rowMayMatch;
+}
+
+// Routine Description:
+// - Cheap per-row prefilter for the search loop. Scans the buffer's cached
+//   plain text for the row (built once per row and invalidated only when the
+//   row changes) for the first character of the needle.
+// Arguments:
+// - row - the row to test
+// Return Value:
+// - False if no match can possibly start in this row. True if the row needs
+//   the full cell-accurate comparison (or if there is nothing to prefilter).
+bool Search::_RowMayContainNeedle(const SHORT row) const
+{
+    if (_needle.empty())
+    {
+        return true;
+    }
+
+    // A row filter computed ahead of time (see s_RowsThatMayContainNeedle)
+    // replaces the text scan entirely; it was built from the same row text,
+    // just without the terminal lock held.
+    if (!_rowFilter.empty())
+    {
+        const auto index = gsl::narrow_cast<size_t>(row);
+        return index >= _rowFilter.size() || til::at(_rowFilter, index);
+    }
+
+    const auto first = _ApplySensitivity(til::at(_needle, 0).front());
+    for (const auto wch : _uiaData.GetTextBuffer().GetRowSearchText(row))
+    {
+        if (_ApplySensitivity(wch) == first)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Routine Description:
+// - Tests whether a match starts at the given position, using the per-row
+//   match cache. The row's matches are found in one pass over its flat text
+//   (see _UpdateRowHits) the first time any position in the row is tested, so
+//   stepping through the row costs a binary search per position instead of a
+//   cell-by-cell needle comparison.
+// Arguments:
+// - pos - The position in the haystack (screen buffer) to compare
+// - start - If we found it, this is filled with the coordinate of the first character of the needle.
+// - end - If we found it, this is filled with the coordinate of the last character of the needle.
+// Return Value:
+// - True if a match starts exactly at pos. False if not.
+bool Search::_HasMatchAt(const COORD pos, COORD& start, COORD& end) const
+{
+    if (_needle.empty())
+    {
+        return _FindNeedleInHaystackAt(pos, start, end);
+    }
+
+    _UpdateRowHits(pos.Y);
+    if (!std::binary_search(_rowHits.begin(), _rowHits.end(), pos.X))
+    {
+        return false;
+    }
+
+    // The cell-accurate comparison fills in the end coordinate (and re-walks
+    // the cells, but only for genuine hits).
+    return _FindNeedleInHaystackAt(pos, start, end);
+}
+
+// Routine Description:
+// - Finds every column of the given row where a match starts and caches the
+//   result (keyed on the row's content version). The row's text is extracted
+//   into a flat, case-folded buffer together with a map from text offset back
+//   to column, then scanned for the flat needle; cell mapping and the
+//   cell-accurate comparison only run for candidate positions. Positions near
+//   the right edge, where a match would have to continue into the next row,
+//   can't be decided from the row text alone and are checked cell-by-cell.
+// Arguments:
+// - row - the row to examine
+void Search::_UpdateRowHits(const SHORT row) const
+{
+    const auto& textBuffer = _uiaData.GetTextBuffer();
+    const auto version = textBuffer.GetRowVersion(gsl::narrow_cast<size_t>(row));
+    if (_hitsRow == row && _hitsVersion == version)
+    {
+        return;
+    }
+    _hitsRow = row;
+    _hitsVersion = version;
+    _rowHits.clear();
+
+    const auto width = textBuffer.GetSize().Dimensions().X;
+
+    // Build the flat text of the row and the offset-to-column map in a single
+    // pass. Trailing cells of fullwidth glyphs are skipped, so each glyph
+    // appears once, the same way the flat needle stores it.
+    _rowText.clear();
+    _rowTextColumns.clear();
+    auto iter = textBuffer.GetCellLineDataAt({ 0, row });
+    for (SHORT col = 0; col < width && iter; ++col, ++iter)
+    {
+        const auto cell = *iter;
+        if (!cell.DbcsAttr().IsTrailing())
+        {
+            for (const auto wch : cell.Chars())
+            {
+                _rowText.push_back(_ApplySensitivity(wch));
+                _rowTextColumns.push_back(col);
+            }
+        }
+    }
+
+    // The first column from which the needle no longer fits in this row.
+    // Everything to the right of it can only match by spilling into the next
+    // row, which the flat scan can't see.
+    const auto spillColumn = width - gsl::narrow_cast<int>(_needle.size()) + 1;
+
+    const std::wstring_view rowView{ _rowText };
+    for (auto offset = rowView.find(_needleText); offset != std::wstring_view::npos; offset = rowView.find(_needleText, offset + 1))
+    {
+        const auto col = til::at(_rowTextColumns, offset);
+        if (col < spillColumn)
+        {
+            // Confirm with the cell-accurate comparison; it still owns the
+            // wide-cell handling, so a flat text match whose glyph widths
+            // don't line up with the buffer's cells is rejected here.
+            COORD start = { 0 };
+            COORD end = { 0 };
+            if (_FindNeedleInHaystackAt({ col, row }, start, end))
+            {
+                _rowHits.push_back(col);
+            }
+        }
+    }
+
+    for (auto col = gsl::narrow_cast<SHORT>(std::max(spillColumn, 0)); col < width; ++col)
+    {
+        COORD start = { 0 };
+        COORD end = { 0 };
+        if (_FindNeedleInHaystackAt({ col, row }, start, end))
+        {
+            _rowHits.push_back(col);
+        }
+    }
+}
+
 // Routine Description:
 // - Attempts to compare the search term (the needle) to the screen buffer (the haystack)
 //   at the given coordinate position of the screen buffer.
@@ -344,3 +560,26 @@ std::vector<std::vector<wchar_t>> Search::s_CreateNeedleFromString(const std::ws
     }
     return cells;
 }
+
+// Routine Description:
+// - Creates the flat, case-folded text form of the needle used for the fast
+//   row text scan. Unlike s_CreateNeedleFromString, fullwidth glyphs appear
+//   only once, matching how the flat row text stores them.
+// Arguments:
+// - wstr - String that will be our search term
+// - sensitivity - Whether or not the search cares about case
+// Return Value:
+// - Flat text for comparison against a row's extracted text.
+std::wstring Search::s_CreateFlatNeedle(const std::wstring& wstr, const Sensitivity sensitivity)
+{
+    std::wstring flat;
+    flat.reserve(wstr.size());
+    for (const auto& chars : Utf16Parser::Parse(wstr))
+    {
+        for (const auto wch : chars)
+        {
+            flat.push_back(sensitivity == Sensitivity::CaseInsensitive ? ::towlower(wch) : wch);
+        }
+    }
+    return flat;
+}
@@ -55,10 +55,19 @@ public:
     void Select() const;
     void Color(const TextAttribute attr) const;
 
+    void ConstrainToRows(std::vector<bool> rowMayMatch) noexcept;
+
     std::pair<COORD, COORD> GetFoundLocation() const noexcept;
 
+    static std::vector<bool> s_RowsThatMayContainNeedle(const std::vector<std::wstring>& rows,
+                                                        const std::wstring& needle,
+                                                        const Sensitivity sensitivity);
+
 private:
     wchar_t _ApplySensitivity(const wchar_t wch) const noexcept;
+    bool _RowMayContainNeedle(const SHORT row) const;
+    bool _HasMatchAt(const COORD pos, COORD& start, COORD& end) const;
+    void _UpdateRowHits(const SHORT row) const;
     bool _FindNeedleInHaystackAt(const COORD pos, COORD& start, COORD& end) const;
     bool _CompareChars(const std::wstring_view one, const std::wstring_view two) const noexcept;
     void _UpdateNextPosition();
@@ -69,6 +78,7 @@ private:
     static COORD s_GetInitialAnchor(Microsoft::Console::Types::IUiaData& uiaData, const Direction dir);
 
     static std::vector<std::vector<wchar_t>> s_CreateNeedleFromString(const std::wstring& wstr);
+    static std::wstring s_CreateFlatNeedle(const std::wstring& wstr, const Sensitivity sensitivity);
 
     bool _reachedEnd = false;
     COORD _coordNext = { 0 };
@@ -77,10 +87,22 @@ private:
 
     const COORD _coordAnchor;
     const std::vector<std::vector<wchar_t>> _needle;
+    const std::wstring _needleText;
     const Direction _direction;
     const Sensitivity _sensitivity;
+    std::vector<bool> _rowFilter;
     Microsoft::Console::Types::IUiaData& _uiaData;
 
+    // Per-row match cache for the search loop: the columns where a match
+    // starts in the row last examined, found with one flat text scan instead
+    // of a cell-by-cell comparison at every column. Invalidated by row
+    // version, so buffer edits between FindNext calls are picked up.
+    mutable SHORT _hitsRow = -1;
+    mutable uint64_t _hitsVersion = 0;
+    mutable std::vector<SHORT> _rowHits;
+    mutable std::wstring _rowText;
+    mutable std::vector<SHORT> _rowTextColumns;
+
 #ifdef UNIT_TESTING
     friend class SearchTests;
 #endif
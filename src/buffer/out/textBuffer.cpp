@@ -19,6 +19,119 @@ using namespace Microsoft::Console::Types;
 
 using PointTree = interval_tree::IntervalTree<til::point, size_t>;
 
+// Routine Description:
+// - Buckets a buffer geometry into a history key. Trivially different sizes
+//   (a pane one cell narrower, a scrollback a few lines deeper) should share
+//   an entry, so the width rounds up to the next multiple of 16 columns and
+//   the row count to the next power of two. The row count also cleanly
+//   separates a main buffer (viewport plus scrollback) from its small alt
+//   buffer at the same width, so the two never pollute each other's history.
+uint32_t BufferUsageHistory::_KeyFor(const COORD size) noexcept
+{
+    const auto width = static_cast<uint32_t>(std::max<SHORT>(size.X, 1));
+    const auto rows = static_cast<uint32_t>(std::max<SHORT>(size.Y, 1));
+    uint32_t rowBits = 0;
+    while ((1u << rowBits) < rows)
+    {
+        ++rowBits;
+    }
+    return (((width + 15) / 16) << 8) | rowBits;
+}
+
+// Routine Description:
+// - Notes the row storage high-water mark a tearing-down buffer reached, so
+//   the next buffer of the same geometry can prime for it.
+// Arguments:
+// - size - the buffer's dimensions
+// - highWaterBytes - the most row storage the buffer ever held live
+void BufferUsageHistory::Record(const COORD size, const uint64_t highWaterBytes) noexcept
+try
+{
+    const auto key = _KeyFor(size);
+    std::lock_guard guard{ _lock };
+    auto& expected = _expectedBytes[key];
+    // Blend rather than overwrite, so one atypical session (a pane closed
+    // right after opening, a one-off giant log dump) doesn't whipsaw the
+    // estimate for everyone after it.
+    expected = expected == 0 ? highWaterBytes : (expected + highWaterBytes) / 2;
+}
+CATCH_LOG()
+
+// Routine Description:
+// - Returns the row storage footprint buffers of this geometry have
+//   historically settled at, or 0 when there's no history for it yet.
+uint64_t BufferUsageHistory::ExpectedBytes(const COORD size) const noexcept
+{
+    const auto key = _KeyFor(size);
+    std::lock_guard guard{ _lock };
+    const auto it = _expectedBytes.find(key);
+    return it == _expectedBytes.end() ? 0 : it->second;
+}
+
+// Routine Description:
+// - Flattens the ledger into a "key:bytes;" run for hosts that persist state
+//   across launches. The format is an implementation detail shared only with
+//   Deserialize.
+std::wstring BufferUsageHistory::Serialize() const
+{
+    std::lock_guard guard{ _lock };
+    std::wstring result;
+    for (const auto& [key, bytes] : _expectedBytes)
+    {
+        result.append(std::to_wstring(key));
+        result.push_back(L':');
+        result.append(std::to_wstring(bytes));
+        result.push_back(L';');
+    }
+    return result;
+}
+
+// Routine Description:
+// - Reseeds the ledger from a previously serialized run. Malformed entries
+//   are skipped - the state file is user-editable, so garbage in must not
+//   mean garbage remembered.
+void BufferUsageHistory::Deserialize(const std::wstring_view state) noexcept
+try
+{
+    const auto parseNumber = [](const std::wstring_view str, uint64_t& value) {
+        value = 0;
+        if (str.empty() || str.size() > 20)
+        {
+            return false;
+        }
+        for (const auto ch : str)
+        {
+            if (ch < L'0' || ch > L'9')
+            {
+                return false;
+            }
+            value = value * 10 + (ch - L'0');
+        }
+        return true;
+    };
+
+    std::lock_guard guard{ _lock };
+    size_t pos = 0;
+    while (pos < state.size())
+    {
+        const auto end = state.find(L';', pos);
+        const auto entry = state.substr(pos, end == std::wstring_view::npos ? std::wstring_view::npos : end - pos);
+        pos = end == std::wstring_view::npos ? state.size() : end + 1;
+
+        const auto sep = entry.find(L':');
+        uint64_t key = 0;
+        uint64_t bytes = 0;
+        if (sep != std::wstring_view::npos &&
+            parseNumber(entry.substr(0, sep), key) &&
+            parseNumber(entry.substr(sep + 1), bytes) &&
+            key <= UINT32_MAX)
+        {
+            _expectedBytes.insert_or_assign(gsl::narrow_cast<uint32_t>(key), bytes);
+        }
+    }
+}
+CATCH_LOG()
+
 // Routine Description:
 // - Creates a new instance of TextBuffer
 // Arguments:
@@ -38,8 +151,7 @@ TextBuffer::TextBuffer(const COORD screenBufferSize,
     _firstRow{ 0 },
     _currentAttributes{ defaultAttributes },
     _cursor{ cursorSize, *this },
-    _storage{},
-    _unicodeStorage{},
+    _storage{ &_instanceResource },
     _isActiveBuffer{ isActiveBuffer },
     _renderer{ renderer },
     _size{},
@@ -54,6 +166,21 @@ TextBuffer::TextBuffer(const COORD screenBufferSize,
     }
 
     _UpdateSize();
+
+    // If buffers of this geometry have a known steady-state footprint, map
+    // the row pool's slabs for it now rather than mid-burst later.
+    if (const auto expected = BufferUsageHistory::Instance().ExpectedBytes(screenBufferSize))
+    {
+        _PrimeRowStorage(expected);
+    }
+
+    BufferMemoryBudget::Instance().OnBufferCreated();
+}
+
+TextBuffer::~TextBuffer()
+{
+    BufferUsageHistory::Instance().Record(_size.Dimensions(), _instanceAllocations.highWaterBytes.load(std::memory_order_relaxed));
+    BufferMemoryBudget::Instance().OnBufferDestroyed();
 }
 
 // Routine Description:
@@ -88,11 +215,9 @@ UINT TextBuffer::TotalRowCount() const noexcept
 // - const reference to the requested row. Asserts if out of bounds.
 const ROW& TextBuffer::GetRowByOffset(const size_t index) const
 {
-    const size_t totalRows = TotalRowCount();
-
-    // Rows are stored circularly, so the index you ask for is offset by the start position and mod the total of rows.
-    const size_t offsetIndex = (_firstRow + index) % totalRows;
-    return _storage.at(offsetIndex);
+    // Rehydrating a cold row mutates its storage, but not the text the row
+    // logically contains, so this cast doesn't violate logical constness.
+    return const_cast<TextBuffer*>(this)->GetRowByOffset(index);
 }
 
 // Routine Description:
@@ -108,7 +233,236 @@ ROW& TextBuffer::GetRowByOffset(const size_t index)
 
     // Rows are stored circularly, so the index you ask for is offset by the start position and mod the total of rows.
     const size_t offsetIndex = (_firstRow + index) % totalRows;
-    return _storage.at(offsetIndex);
+    auto& row = _storage.at(offsetIndex);
+
+    // If this row went cold and was packed, rehydrate it on demand. The
+    // common (hot) case is a single null check. Keep count of how many rows
+    // come back this way so budget enforcement knows whether a re-pack pass
+    // over the cold region would find anything.
+    if (row.IsCompressed())
+    {
+        row.Decompress();
+        ++_rehydratedColdRowCount;
+    }
+    return row;
+}
+
+// Routine Description:
+// - Packs every row above the given offset into the compact cold-scrollback
+//   representation. Hosts call this for the region above the viewport once
+//   rows scroll out of the active area; the rows rehydrate transparently on
+//   the next access through GetRowByOffset.
+// Arguments:
+// - firstActiveRow - offset (from the first row) of the first row that is
+//                    still part of the active region and must stay expanded
+// Return Value:
+// - <none>
+void TextBuffer::CompressColdRows(const size_t firstActiveRow)
+{
+    const size_t totalRows = TotalRowCount();
+    const size_t limit = std::min(firstActiveRow, totalRows);
+    // _coldRowWatermark remembers how far down we've already packed, so a
+    // steadily scrolling buffer only ever packs the newly cold rows.
+    for (size_t index = _coldRowWatermark; index < limit; ++index)
+    {
+        const size_t offsetIndex = (_firstRow + index) % totalRows;
+        _storage.at(offsetIndex).Compress();
+    }
+    _coldRowWatermark = std::max(_coldRowWatermark, limit);
+}
+
+// Routine Description:
+// - One slice of background housekeeping for a long-lived buffer. Walks at
+//   most maxRows cold rows from where the previous slice stopped: re-packs
+//   rows that a scrollback read rehydrated (CompressColdRows' watermark never
+//   revisits them) and gives back attribute run capacity left over from past
+//   peaks. Each slice is small enough to abandon the cadence the moment the
+//   buffer becomes busy again - the caller simply stops calling.
+// Arguments:
+// - firstActiveRow - rows at or beyond this offset are hot and untouched
+// - maxRows - how many rows this slice may visit
+// Return Value:
+// - true when the sweep wrapped around, i.e. a full pass is complete
+bool TextBuffer::PerformIdleMaintenance(const size_t firstActiveRow, const size_t maxRows)
+{
+    const size_t totalRows = TotalRowCount();
+    const size_t limit = std::min(firstActiveRow, totalRows);
+    for (size_t visited = 0; visited < maxRows; ++visited)
+    {
+        if (_maintenanceCursor >= limit)
+        {
+            _maintenanceCursor = 0;
+            return true;
+        }
+        const size_t offsetIndex = (_firstRow + _maintenanceCursor) % totalRows;
+        auto& row = _storage.at(offsetIndex);
+        row.Compress();
+        row.GetAttrRow().TrimExcess();
+        ++_maintenanceCursor;
+    }
+    return false;
+}
+
+// Routine Description:
+// - Returns the number of bytes of row storage this buffer holds live right
+//   now: the expanded char/attribute runs plus the packed cold-row payloads.
+//   Blocks the row pool has mapped but that no row currently occupies count
+//   against the process-wide tally, not here.
+// Return Value:
+// - live row storage, in bytes
+uint64_t TextBuffer::GetMemoryUsage() const noexcept
+{
+    return _instanceAllocations.bytes.load(std::memory_order_relaxed);
+}
+
+// Routine Description:
+// - Primes the row pool up to the steady-state footprint buffers of this
+//   geometry have historically reached. Construction already places every
+//   row, so what grows afterwards is pool-backed side storage - chiefly the
+//   packed payloads cold rows take on as content scrolls past - and without
+//   priming the pool maps those slabs piecemeal, in the middle of the very
+//   output burst that's filling the buffer. Allocating the expected
+//   remainder up front and handing it straight back leaves the blocks on the
+//   pool's free lists, ready for the rows to claim.
+// - Best effort: a failed or budget-constrained priming just means the pool
+//   grows on demand, as it always did.
+// Arguments:
+// - expectedBytes - the historical high-water mark for this geometry
+void TextBuffer::_PrimeRowStorage(const uint64_t expectedBytes) noexcept
+try
+{
+    const auto current = _instanceAllocations.bytes.load(std::memory_order_relaxed);
+    if (expectedBytes <= current)
+    {
+        return;
+    }
+    // The history can come from a user-editable state file, so never let it
+    // talk us into mapping something absurd.
+    auto remaining = std::min<uint64_t>(expectedBytes - current, 256 * 1024 * 1024);
+
+    // Stay clear of the process-wide ceiling: primed slabs count against it,
+    // and evicting real contents to make room for an educated guess would be
+    // backwards. Half the headroom leaves the other buffers theirs.
+    if (BufferMemoryBudget::Instance().GetCeiling() != 0)
+    {
+        const auto ceiling = BufferMemoryBudget::Instance().GetCeiling();
+        const auto inUse = Microsoft::Console::PerfCounters::Instance().bufferAllocations.bytes.load(std::memory_order_relaxed);
+        remaining = std::min(remaining, inUse < ceiling ? (ceiling - inUse) / 2 : 0);
+    }
+
+    // The predicted growth is mostly packed cold-row payloads, which run
+    // about a byte per column, so prime in blocks of that shape.
+    const auto blockSize = std::clamp<size_t>(_storage.empty() ? 0 : _storage.front().size(), 64, 1024);
+    std::vector<void*> blocks;
+    blocks.reserve(gsl::narrow_cast<size_t>(remaining / blockSize));
+    while (remaining >= blockSize)
+    {
+        blocks.push_back(_rowAllocator.allocate(blockSize));
+        remaining -= blockSize;
+    }
+    for (const auto block : blocks)
+    {
+        _rowAllocator.deallocate(block, blockSize);
+    }
+}
+CATCH_LOG()
+
+// Routine Description:
+// - Cooperative enforcement of the process-wide buffer memory budget, called
+//   as the buffer takes on a new row. When the process is over its ceiling
+//   and this buffer holds more than its fair share, it reclaims its own
+//   storage: first re-packing cold rows that reads rehydrated, then
+//   surrendering the payloads of its oldest packed rows - losing their
+//   contents, which is the deal the ceiling offers. Other buffers reclaim
+//   themselves the next time they scroll; rows are only safe to touch under
+//   their owner's lock, so the budget never trims a buffer from outside.
+// - The pool retains reclaimed blocks for reuse, so enforcement primarily
+//   caps further growth - new rows are carved out of reclaimed ones instead
+//   of fresh slabs - rather than handing memory back to the OS immediately.
+// Return Value:
+// - <none>
+void TextBuffer::_EnforceMemoryBudget()
+{
+    const auto& budget = BufferMemoryBudget::Instance();
+    if (!budget.IsOverCeiling())
+    {
+        return;
+    }
+
+    const auto fairShare = budget.GetFairShareBytes();
+    if (GetMemoryUsage() <= fairShare)
+    {
+        return;
+    }
+
+    try
+    {
+        const size_t totalRows = TotalRowCount();
+
+        // First pass: rows below the cold watermark that a read rehydrated
+        // stayed expanded; pack them again before giving up any content.
+        if (_rehydratedColdRowCount > 0)
+        {
+            for (size_t index = 0; index < _coldRowWatermark; ++index)
+            {
+                _storage.at((_firstRow + index) % totalRows).Compress();
+            }
+            _rehydratedColdRowCount = 0;
+        }
+
+        // Second pass: surrender the payloads of the oldest packed rows,
+        // oldest first, until this buffer fits its share again or there is
+        // nothing packed left to take.
+        while (_trimmedRowWatermark < _coldRowWatermark && GetMemoryUsage() > fairShare)
+        {
+            _storage.at((_firstRow + _trimmedRowWatermark) % totalRows).TrimCompressed(_currentAttributes);
+            ++_trimmedRowWatermark;
+        }
+    }
+    CATCH_LOG();
+}
+
+// Routine Description:
+// - Returns the version of the given row. The version advances on every
+//   mutation, so a consumer that remembers the last version it saw can skip
+//   the row entirely when it hasn't changed.
+// Arguments:
+// - rowOffset - offset of the row from the first row of the buffer
+// Return Value:
+// - the row's current version
+uint64_t TextBuffer::GetRowVersion(const size_t rowOffset) const
+{
+    const size_t totalRows = TotalRowCount();
+    const size_t offsetIndex = (_firstRow + rowOffset) % totalRows;
+    // read the version straight out of storage; unlike GetRowByOffset this
+    // must not rehydrate a packed row just to look at its counter.
+    return _storage.at(offsetIndex).GetVersion();
+}
+
+// Routine Description:
+// - Returns the plain text of the given row for search purposes, built once
+//   and cached until the row changes. Search hits this once per row instead
+//   of stepping a TextBufferCellIterator across every cell.
+// Arguments:
+// - rowOffset - offset of the row from the first row of the buffer
+// Return Value:
+// - the cached text of the row (valid until the row is next mutated)
+const std::wstring& TextBuffer::GetRowSearchText(const size_t rowOffset) const
+{
+    const size_t totalRows = TotalRowCount();
+    if (_rowSearchTextCache.size() != totalRows)
+    {
+        _rowSearchTextCache.assign(totalRows, std::nullopt);
+    }
+
+    const size_t offsetIndex = (_firstRow + rowOffset) % totalRows;
+    const auto version = _storage.at(offsetIndex).GetVersion();
+    auto& entry = _rowSearchTextCache.at(offsetIndex);
+    if (!entry || entry->first != version)
+    {
+        entry = std::make_pair(version, GetRowByOffset(rowOffset).GetText());
+    }
+    return entry->second;
 }
 
 // Routine Description:
@@ -396,6 +750,35 @@ OutputCellIterator TextBuffer::WriteLine(const OutputCellIterator givenIt,
     return newIt;
 }
 
+// Routine Description:
+// - Fills a rectangular region of the buffer with a single narrow glyph and
+//   attribute, committing each row as one run operation instead of walking
+//   a fill iterator cell by cell.
+// Arguments:
+// - rect - Inclusive rectangle to fill, in buffer coordinates
+// - glyph - Narrow glyph to store in every cell of the region
+// - attr - Attribute to apply to every cell of the region
+// - setWrap - change rows' wrap flags if the fill covers their final column (see WriteLine)
+// Return Value:
+// - <none>
+void TextBuffer::FillRect(const Viewport rect,
+                          const wchar_t glyph,
+                          const TextAttribute attr,
+                          const std::optional<bool> setWrap)
+{
+    const auto size = GetSize();
+    THROW_HR_IF(E_INVALIDARG, !size.IsInBounds(rect.Origin()));
+    THROW_HR_IF(E_INVALIDARG, !size.IsInBounds({ rect.RightInclusive(), rect.BottomInclusive() }));
+
+    for (auto y = rect.Top(); y < rect.BottomExclusive(); y++)
+    {
+        ROW& row = GetRowByOffset(y);
+        row.FillRange(rect.Left(), rect.Width(), glyph, attr, setWrap);
+    }
+
+    TriggerRedraw(rect);
+}
+
 //Routine Description:
 // - Inserts one codepoint into the buffer at the current cursor position and advances the cursor as appropriate.
 //Arguments:
@@ -437,6 +820,12 @@ bool TextBuffer::InsertCharacter(const std::wstring_view chars,
 
         // Store color data
         fSuccess = Row.GetAttrRow().SetAttrToEnd(iCol, attr);
+
+        // This path writes the cell without going through one of ROW's
+        // mutation entry points, so advance the version by hand to keep
+        // version-keyed row caches honest.
+        Row.BumpVersion();
+
         if (fSuccess)
         {
             // Advance the cursor
@@ -588,6 +977,21 @@ bool TextBuffer::IncrementCircularBuffer(const bool inVtMode)
         {
             _firstRow = 0;
         }
+
+        // Every row offset just shifted up by one, so the boundaries of the
+        // already-packed and already-trimmed cold regions move with them.
+        if (_coldRowWatermark > 0)
+        {
+            _coldRowWatermark--;
+        }
+        if (_trimmedRowWatermark > 0)
+        {
+            _trimmedRowWatermark--;
+        }
+
+        // Taking on a new row of content is the natural point to square up
+        // with the process-wide memory budget.
+        _EnforceMemoryBudget();
     }
     return fSuccess;
 }
@@ -696,6 +1100,58 @@ void TextBuffer::ScrollRows(const SHORT firstRow, const SHORT size, const SHORT
         return;
     }
 
+    // Fast path: rotate just the affected rows in place inside the circular
+    // buffer. The classic path below straightens out the whole circular buffer
+    // first (an O(total rows) shuffle) and renumbers every row afterwards,
+    // which dwarfs the cost of the scroll itself once a large scrollback has
+    // cycled. The span of rows disturbed by the rotation is
+    // [firstRow + delta, firstRow + size) going up or
+    // [firstRow, firstRow + size + delta) going down; when that span maps onto
+    // one contiguous run of physical storage we can rotate that run directly
+    // and patch up only the rows that actually moved.
+    {
+        const auto totalRows = static_cast<ptrdiff_t>(TotalRowCount());
+        const auto spanFirst = static_cast<ptrdiff_t>(firstRow) + std::min<ptrdiff_t>(delta, 0);
+        const auto spanSize = static_cast<ptrdiff_t>(size) + (delta < 0 ? -delta : delta);
+        const auto physFirst = (_firstRow + spanFirst) % totalRows;
+        if (physFirst + spanSize <= totalRows)
+        {
+            // Going up, the moving block starts -delta rows into the span and
+            // a left rotation around its old top slides it up into place.
+            // Going down, the moving block starts the span and a left rotation
+            // around its old bottom slides it down into place.
+            const auto base = _storage.begin() + physFirst;
+            const auto middleOffset = delta < 0 ? -delta : static_cast<ptrdiff_t>(size);
+            std::rotate(base, base + middleOffset, base + spanSize);
+
+            // The hyperlink index is keyed by physical slot, so its entries
+            // have to travel with their rows; applying the same rotation keeps
+            // each entry paired with the row whose contribution it records,
+            // which keeps the reference counts consistent without a rebuild.
+            if (_rowHyperlinkCache.size() == static_cast<size_t>(totalRows))
+            {
+                const auto cacheBase = _rowHyperlinkCache.begin() + physFirst;
+                std::rotate(cacheBase, cacheBase + middleOffset, cacheBase + spanSize);
+            }
+
+            // Only the rows inside the span changed position, so only they need
+            // fresh IDs, re-aimed char row parent pointers and search text
+            // cache invalidation.
+            const auto cachePopulated = _rowSearchTextCache.size() == static_cast<size_t>(totalRows);
+            for (auto it = base; it != base + spanSize; ++it)
+            {
+                const auto index = it - _storage.begin();
+                it->SetId(gsl::narrow_cast<SHORT>(index));
+                it->GetCharRow().UpdateParent(&*it);
+                if (cachePopulated)
+                {
+                    _rowSearchTextCache.at(index).reset();
+                }
+            }
+            return;
+        }
+    }
+
     // OK. We're about to play games by moving rows around within the deque to
     // scroll a massive region in a faster way than copying things.
     // To make this easier, first correct the circular buffer to have the first row be 0 again.
@@ -785,10 +1241,40 @@ void TextBuffer::ScrollRows(const SHORT firstRow, const SHORT size, const SHORT
     }
 
     // Renumber the IDs now that we've rearranged where the rows sit within the buffer.
-    // Refreshing should also delegate to the UnicodeStorage to re-key all the stored unicode sequences (where applicable).
     _RefreshRowIDs(std::nullopt);
 }
 
+// Routine Description:
+// - Copies a rectangle of cells to another position in the buffer, moving the
+//   glyph, DBCS and attribute runs of each affected row in bulk instead of
+//   reading and re-writing one cell at a time. Used for region scrolls that
+//   ScrollRows can't express as a whole-row rotation (partial-width moves).
+// Arguments:
+// - source - the rectangle of cells to copy (must lie within the buffer)
+// - targetOrigin - the upper-left corner of the destination rectangle
+// Return Value:
+// - <none>
+void TextBuffer::CopyRect(const Viewport& source, const COORD targetOrigin)
+{
+    const auto height = source.Height();
+    const auto width = gsl::narrow<size_t>(source.Width());
+    if (height <= 0 || width == 0 || source.Origin() == targetOrigin)
+    {
+        return;
+    }
+
+    // When the rectangles overlap vertically, walk the rows in the order that
+    // consumes each source row before the copy overwrites it.
+    const auto movingDown = targetOrigin.Y > source.Top();
+    for (SHORT i = 0; i < height; i++)
+    {
+        const auto offset = movingDown ? height - 1 - i : i;
+        auto& sourceRow = GetRowByOffset(gsl::narrow_cast<size_t>(source.Top() + offset));
+        auto& targetRow = GetRowByOffset(gsl::narrow_cast<size_t>(targetOrigin.Y + offset));
+        targetRow.CopyRangeFrom(sourceRow, gsl::narrow_cast<size_t>(source.Left()), gsl::narrow_cast<size_t>(targetOrigin.X), width);
+    }
+}
+
 Cursor& TextBuffer::GetCursor() noexcept
 {
     return _cursor;
@@ -916,12 +1402,12 @@ void TextBuffer::Reset()
         }
         const SHORT TopRowIndex = (GetFirstRowIndex() + TopRow) % currentSize.Y;
 
-        // rotate rows until the top row is at index 0
-        for (int i = 0; i < TopRowIndex; i++)
-        {
-            _storage.emplace_back(std::move(_storage.front()));
-            _storage.erase(_storage.begin());
-        }
+        // rotate rows until the top row is at index 0, in place. The old
+        // approach of appending the front row and erasing it again moved the
+        // whole storage vector once per rotated row and could reallocate it;
+        // rotating keeps every ROW's existing storage alive and allocates
+        // nothing, the same way ScrollRows rotates rows around.
+        std::rotate(_storage.begin(), _storage.begin() + TopRowIndex, _storage.end());
 
         _SetFirstRowIndex(0);
 
@@ -932,16 +1418,22 @@ void TextBuffer::Reset()
             _storage.pop_back();
         }
         // add rows if we're growing
+        _storage.reserve(static_cast<size_t>(newSize.Y));
         while (_storage.size() < static_cast<size_t>(newSize.Y))
         {
             _storage.emplace_back(static_cast<short>(_storage.size()), newSize.X, attributes, this);
         }
 
         // Now that we've tampered with the row placement, refresh all the row IDs.
-        // Also take advantage of the row ID refresh loop to resize the rows in the X dimension
-        // and cleanup the UnicodeStorage characters that might fall outside the resized buffer.
+        // Also take advantage of the row ID refresh loop to resize the rows in the X dimension.
         _RefreshRowIDs(newSize.X);
 
+        // Resizing rehydrated every row, so the cold and trimmed regions
+        // start over.
+        _coldRowWatermark = 0;
+        _trimmedRowWatermark = 0;
+        _rehydratedColdRowCount = 0;
+
         // Update the cached size value
         _UpdateSize();
     }
@@ -950,14 +1442,16 @@ void TextBuffer::Reset()
     return S_OK;
 }
 
-const UnicodeStorage& TextBuffer::GetUnicodeStorage() const noexcept
-{
-    return _unicodeStorage;
-}
-
-UnicodeStorage& TextBuffer::GetUnicodeStorage() noexcept
+// Routine Description:
+// - Retrieves the memory resource that backs all row storage for this buffer.
+//   Rows route their char/attribute runs through here so that one buffer's
+//   worth of rows shares a few large slabs instead of many small allocations,
+//   and so the buffer's live usage tally sees every byte they hold.
+// Return Value:
+// - the memory resource to allocate row storage from
+std::pmr::memory_resource* TextBuffer::GetRowStorageResource() noexcept
 {
-    return _unicodeStorage;
+    return &_instanceResource;
 }
 
 void TextBuffer::SetAsActiveBuffer(const bool isActiveBuffer) noexcept
@@ -1015,6 +1509,14 @@ void TextBuffer::TriggerScroll(const COORD delta)
     }
 }
 
+void TextBuffer::TriggerScrollRegion(const Viewport& region, const COORD delta)
+{
+    if (_isActiveBuffer)
+    {
+        _renderer.TriggerScrollRegion(region, &delta);
+    }
+}
+
 void TextBuffer::TriggerNewTextNotification(const std::wstring_view newText)
 {
     if (_isActiveBuffer)
@@ -1028,19 +1530,15 @@ void TextBuffer::TriggerNewTextNotification(const std::wstring_view newText)
 //   by shuffling pointers around.
 // - This will also update parent pointers that are stored in depth within the buffer
 //   (e.g. it will update CharRow parents pointing at Rows that might have been moved around)
-// - Optionally takes a new row width if we're resizing to perform a resize operation and cleanup
-//   any high unicode (UnicodeStorage) runs while we're already looping through the rows.
+// - Optionally takes a new row width if we're resizing to perform a resize operation
+//   while we're already looping through the rows.
 // Arguments:
 // - newRowWidth - Optional new value for the row width.
 void TextBuffer::_RefreshRowIDs(std::optional<SHORT> newRowWidth)
 {
-    std::unordered_map<SHORT, SHORT> rowMap;
     SHORT i = 0;
     for (auto& it : _storage)
     {
-        // Build a map so we can update Unicode Storage
-        rowMap.emplace(it.GetId(), i);
-
         // Update the IDs
         it.SetId(i++);
 
@@ -1055,8 +1553,15 @@ void TextBuffer::_RefreshRowIDs(std::optional<SHORT> newRowWidth)
         }
     }
 
-    // Give the new mapping to Unicode Storage
-    _unicodeStorage.Remap(rowMap, newRowWidth);
+    // The rows were shuffled, so the slot-indexed caches are stale. Clearing
+    // the hyperlink index (rather than resetting its entries) matters: row
+    // versions are per-row counters, so an entry left behind could
+    // coincidentally match the version of whichever row rotated into its slot
+    // and its stale contribution would silently survive the next refresh. The
+    // size mismatch makes the refresh rebuild the reference counts from
+    // scratch instead.
+    _rowSearchTextCache.clear();
+    _rowHyperlinkCache.clear();
 }
 
 // Routine Description:
@@ -1088,7 +1593,9 @@ ROW& TextBuffer::_GetPrevRowNoWrap(const ROW& Row)
     }
 
     THROW_HR_IF(E_FAIL, Row.GetId() == _firstRow);
-    return _storage.at(prevRowIndex);
+    auto& prevRow = _storage.at(prevRowIndex);
+    prevRow.Decompress();
+    return prevRow;
 }
 
 // Method Description:
@@ -1172,8 +1679,11 @@ const COORD TextBuffer::_GetWordStartForAccessibility(const COORD target, const
     bool stayAtOrigin = false;
 
     // ignore left boundary. Continue until readable text found
+    // (skip backward over a whole run of same-class cells per iteration,
+    // resolving each row once per run instead of once per cell)
     while (_GetDelimiterClassAt(result, wordDelimiters) != DelimiterClass::RegularChar)
     {
+        result.X = gsl::narrow_cast<SHORT>(GetRowByOffset(result.Y).GetCharRow().DelimiterRunStartAt(result.X, wordDelimiters));
         if (!bufferSize.DecrementInBounds(result))
         {
             // first char in buffer is a DelimiterChar or ControlChar
@@ -1186,6 +1696,7 @@ const COORD TextBuffer::_GetWordStartForAccessibility(const COORD target, const
     // make sure we expand to the left boundary or the beginning of the word
     while (_GetDelimiterClassAt(result, wordDelimiters) == DelimiterClass::RegularChar)
     {
+        result.X = gsl::narrow_cast<SHORT>(GetRowByOffset(result.Y).GetCharRow().DelimiterRunStartAt(result.X, wordDelimiters));
         if (!bufferSize.DecrementInBounds(result))
         {
             // first char in buffer is a RegularChar
@@ -1212,23 +1723,10 @@ const COORD TextBuffer::_GetWordStartForAccessibility(const COORD target, const
 // - The COORD for the first character on the current word or delimiter run (stopped by the left margin)
 const COORD TextBuffer::_GetWordStartForSelection(const COORD target, const std::wstring_view wordDelimiters) const
 {
+    // the run of cells sharing target's delimiter class ends at the left
+    // boundary or where the class changes, which is exactly the "word" here
     COORD result = target;
-    const auto bufferSize = GetSize();
-
-    const auto initialDelimiter = _GetDelimiterClassAt(result, wordDelimiters);
-
-    // expand left until we hit the left boundary or a different delimiter class
-    while (result.X > bufferSize.Left() && (_GetDelimiterClassAt(result, wordDelimiters) == initialDelimiter))
-    {
-        bufferSize.DecrementInBounds(result);
-    }
-
-    if (_GetDelimiterClassAt(result, wordDelimiters) != initialDelimiter)
-    {
-        // move off of delimiter
-        bufferSize.IncrementInBounds(result);
-    }
-
+    result.X = gsl::narrow_cast<SHORT>(GetRowByOffset(target.Y).GetCharRow().DelimiterRunStartAt(target.X, wordDelimiters));
     return result;
 }
 
@@ -1297,25 +1795,46 @@ const COORD TextBuffer::_GetWordEndForAccessibility(const COORD target, const st
     }
     else
     {
-        auto iter{ GetCellDataAt(result, bufferSize) };
-        while (iter && iter.Pos() != limit && _GetDelimiterClassAt(iter.Pos(), wordDelimiters) == DelimiterClass::RegularChar)
+        // Advance result to the first cell after the run of same-class cells
+        // that contains it, stopping early when the limit falls inside the
+        // run and recording when we fall off the end of the buffer.
+        auto exceeded = false;
+        const auto advancePastRun = [&]() {
+            const auto runEnd = GetRowByOffset(result.Y).GetCharRow().DelimiterRunEndAt(result.X, wordDelimiters);
+            if (result.Y == limit.Y && limit.X < gsl::narrow_cast<SHORT>(runEnd))
+            {
+                // the limit lands inside this run; stop exactly there
+                result = limit;
+            }
+            else if (runEnd <= gsl::narrow_cast<size_t>(bufferSize.RightInclusive()))
+            {
+                // the next run starts on this row
+                result.X = gsl::narrow_cast<SHORT>(runEnd);
+            }
+            else
+            {
+                // the run reaches the end of the row; cross to the next one
+                result.X = bufferSize.RightInclusive();
+                exceeded = !bufferSize.IncrementInBounds(result);
+            }
+        };
+
+        while (!exceeded && result != limit && _GetDelimiterClassAt(result, wordDelimiters) == DelimiterClass::RegularChar)
         {
             // Iterate through readable text
-            ++iter;
+            advancePastRun();
         }
 
-        while (iter && iter.Pos() != limit && _GetDelimiterClassAt(iter.Pos(), wordDelimiters) != DelimiterClass::RegularChar)
+        while (!exceeded && result != limit && _GetDelimiterClassAt(result, wordDelimiters) != DelimiterClass::RegularChar)
         {
             // expand to the beginning of the NEXT word
-            ++iter;
+            advancePastRun();
         }
 
-        result = iter.Pos();
-
         // Special case: we tried to move one past the end of the buffer,
-        // but iter prevented that (because that pos doesn't exist).
+        // but the buffer boundary prevented that (because that pos doesn't exist).
         // Manually increment onto the EndExclusive point.
-        if (!iter)
+        if (exceeded)
         {
             bufferSize.IncrementInBounds(result, true);
         }
@@ -1341,67 +1860,107 @@ const COORD TextBuffer::_GetWordEndForSelection(const COORD target, const std::w
         return target;
     }
 
+    // the run of cells sharing target's delimiter class ends at the right
+    // boundary or where the class changes; the returned anchor is inclusive
     COORD result = target;
-    const auto initialDelimiter = _GetDelimiterClassAt(result, wordDelimiters);
+    result.X = gsl::narrow_cast<SHORT>(GetRowByOffset(target.Y).GetCharRow().DelimiterRunEndAt(target.X, wordDelimiters) - 1);
+    return result;
+}
 
-    // expand right until we hit the right boundary or a different delimiter class
-    while (result.X < bufferSize.RightInclusive() && (_GetDelimiterClassAt(result, wordDelimiters) == initialDelimiter))
+// Routine Description:
+// - Retires hyperlinks whose last reference is about to scroll out of the
+//   buffer, so the hyperlink maps don't accumulate dead entries over a
+//   long-lived session. Called before the first row is recycled by
+//   IncrementCircularBuffer, while it still holds its links.
+// - The cost is proportional to the rows that changed since the last
+//   eviction of a linked row, not to the size of the buffer: the reference
+//   counts are reconciled through the version-keyed per-row link index, and
+//   ATTR_ROW is never packed, so nothing here rehydrates cold scrollback.
+void TextBuffer::_PruneHyperlinks()
+{
+    // The evicted row's own attribute runs tell us whether any link could
+    // possibly die with it; the common case of a link-free row costs one
+    // walk of that row's runs and nothing else.
+    const auto evicted = _storage.at(_firstRow).GetAttrRow().GetHyperlinks();
+    if (evicted.empty())
     {
-        bufferSize.IncrementInBounds(result);
+        return;
     }
 
-    if (_GetDelimiterClassAt(result, wordDelimiters) != initialDelimiter)
+    _RefreshHyperlinkRefs();
+
+    // Drop the evicted row's contribution; any id left without a referencing
+    // run is dead and leaves the maps. The id the current write attributes
+    // still carry is spared - it may be mid-write, about to land in a row.
+    for (const auto id : evicted)
     {
-        // move off of delimiter
-        bufferSize.DecrementInBounds(result);
+        const auto it = _hyperlinkRefs.find(id);
+        if (it != _hyperlinkRefs.end() && --it->second == 0)
+        {
+            _hyperlinkRefs.erase(it);
+            if (id != _currentAttributes.GetHyperlinkId())
+            {
+                RemoveHyperlinkFromMap(id);
+            }
+        }
     }
 
-    return result;
+    // The contribution is consumed; empty the row's index entry at its
+    // current version so the next refresh doesn't subtract it again.
+    _rowHyperlinkCache.at(_firstRow) = { _storage.at(_firstRow).GetVersion(), {} };
 }
 
-void TextBuffer::_PruneHyperlinks()
+// Routine Description:
+// - Reconciles the per-row hyperlink index and the per-id reference counts
+//   with the rows' current contents. Rows whose version hasn't moved since
+//   their entry was last computed cost a single compare; only mutated rows
+//   have their attribute runs re-walked, and the counts are adjusted by the
+//   difference between what the row carried then and what it carries now.
+void TextBuffer::_RefreshHyperlinkRefs()
 {
-    // Check the old first row for hyperlink references
-    // If there are any, search the entire buffer for the same reference
-    // If the buffer does not contain the same reference, we can remove that hyperlink from our map
-    // This way, obsolete hyperlink references are cleared from our hyperlink map instead of hanging around
-    // Get all the hyperlink references in the row we're erasing
-    const auto hyperlinks = _storage.at(_firstRow).GetAttrRow().GetHyperlinks();
-
-    if (!hyperlinks.empty())
-    {
-        // Move to unordered set so we can use hashed lookup of IDs instead of linear search.
-        // Only make it an unordered set now because set always heap allocates but vector
-        // doesn't when the set is empty (saving an allocation in the common case of no links.)
-        std::unordered_set<uint16_t> firstRowRefs{ hyperlinks.cbegin(), hyperlinks.cend() };
-
-        const auto total = TotalRowCount();
-        // Loop through all the rows in the buffer except the first row -
-        // we have found all hyperlink references in the first row and put them in refs,
-        // now we need to search the rest of the buffer (i.e. all the rows except the first)
-        // to see if those references are anywhere else
-        for (size_t i = 1; i != total; ++i)
+    const auto totalRows = TotalRowCount();
+    if (_rowHyperlinkCache.size() != totalRows)
+    {
+        // First use, or the row count changed out from under the index
+        // (resize); start over. Fresh entries carry a version no row can
+        // ever report, so the loop below walks every row once.
+        _rowHyperlinkCache.assign(totalRows, { std::numeric_limits<uint64_t>::max(), {} });
+        _hyperlinkRefs.clear();
+    }
+
+    for (size_t slot = 0; slot < totalRows; ++slot)
+    {
+        const auto& row = _storage.at(slot);
+        const auto version = row.GetVersion();
+        auto& entry = _rowHyperlinkCache.at(slot);
+        if (entry.first == version)
+        {
+            continue;
+        }
+
+        auto ids = row.GetAttrRow().GetHyperlinks();
+        // Count the row's new references before releasing its old ones, so
+        // an id the row still carries never dips to zero in between.
+        for (const auto id : ids)
+        {
+            ++_hyperlinkRefs[id];
+        }
+        for (const auto id : entry.second)
         {
-            const auto nextRowRefs = GetRowByOffset(i).GetAttrRow().GetHyperlinks();
-            for (auto id : nextRowRefs)
+            const auto it = _hyperlinkRefs.find(id);
+            if (it != _hyperlinkRefs.end() && --it->second == 0)
             {
-                if (firstRowRefs.find(id) != firstRowRefs.end())
+                // the link was overwritten out of its last row rather than
+                // evicted; it's just as dead, with the same stay of
+                // execution for the id the write attributes still carry
+                _hyperlinkRefs.erase(it);
+                if (id != _currentAttributes.GetHyperlinkId())
                 {
-                    firstRowRefs.erase(id);
+                    RemoveHyperlinkFromMap(id);
                 }
             }
-            if (firstRowRefs.empty())
-            {
-                // No more hyperlink references left to search for, terminate early
-                break;
-            }
-        }
-
-        // Now delete obsolete references from our map
-        for (auto hyperlinkReference : firstRowRefs)
-        {
-            RemoveHyperlinkFromMap(hyperlinkReference);
         }
+        entry = { version, std::move(ids) };
     }
 }
 
@@ -1826,6 +2385,83 @@ const TextBuffer::TextAndColor TextBuffer::GetText(const bool includeCRLF,
     return data;
 }
 
+// Routine Description:
+// - Streams the plain text of the given regions into a caller-provided string.
+//   This is the allocation-light counterpart to GetText for consumers that
+//   don't need color data: it reads straight out of the rows' contiguous
+//   storage and appends into one buffer instead of building a vector of
+//   per-row strings with per-cell iterators.
+// Arguments:
+// - textData - the string to append the extracted text to. Callers should
+//   reserve ahead of time if they know the approximate size.
+// - textRects - the rectangular regions from which the data will be extracted from the buffer (i.e.: selection rects)
+// - includeCRLF - inject CRLF pairs to the end of each line
+// - trimTrailingWhitespace - remove the trailing whitespace at the end of each line
+// - formatWrappedRows - if set we will apply formatting (CRLF inclusion and whitespace trimming) on wrapped rows
+// Return Value:
+// - <none>
+void TextBuffer::ExtractTextInto(std::wstring& textData,
+                                 const std::vector<SMALL_RECT>& textRects,
+                                 const bool includeCRLF,
+                                 const bool trimTrailingWhitespace,
+                                 const bool formatWrappedRows) const
+{
+    const size_t rows = textRects.size();
+    for (size_t i = 0; i < rows; i++)
+    {
+        const auto& textRect = textRects.at(i);
+        const size_t iRow = gsl::narrow<size_t>(textRect.Top);
+
+        const auto& row = GetRowByOffset(iRow);
+        const auto& charRow = row.GetCharRow();
+        const auto chars = charRow.Chars();
+        const auto attrs = charRow.Attrs();
+
+        // remember where this row's text begins so trimming can't eat into
+        // the previous row's contribution
+        const size_t rowTextStart = textData.size();
+
+        const auto right = std::min(gsl::narrow<size_t>(textRect.Right), chars.size() - 1);
+        for (size_t col = gsl::narrow<size_t>(textRect.Left); col <= right; col++)
+        {
+            const auto& attr = til::at(attrs, col);
+            if (attr.IsTrailing())
+            {
+                continue;
+            }
+
+            if (attr.IsGlyphStored())
+            {
+                textData.append(charRow.GetOverflowText(col));
+            }
+            else
+            {
+                textData.push_back(til::at(chars, col));
+            }
+        }
+
+        // We apply formatting to rows if the row was NOT wrapped or formatting of wrapped rows is allowed
+        const bool shouldFormatRow = formatWrappedRows || !row.WasWrapForced();
+
+        if (trimTrailingWhitespace && shouldFormatRow)
+        {
+            // remove the spaces at the end (aka trim the trailing whitespace)
+            while (textData.size() > rowTextStart && textData.back() == UNICODE_SPACE)
+            {
+                textData.pop_back();
+            }
+        }
+
+        // apply CR/LF to the end of the final string, unless we're the last line.
+        // a.k.a if we're earlier than the bottom, then apply CR/LF.
+        if (includeCRLF && shouldFormatRow && i < rows - 1)
+        {
+            textData.push_back(UNICODE_CARRIAGERETURN);
+            textData.push_back(UNICODE_LINEFEED);
+        }
+    }
+}
+
 // Routine Description:
 // - Generates a CF_HTML compliant structure based on the passed in text and color data
 // Arguments:
@@ -2293,75 +2929,124 @@ HRESULT TextBuffer::Reflow(TextBuffer& oldBuffer,
             }
         }
 
-        // Loop through every character in the current row (up to
-        // the "right" boundary, which is one past the final valid
-        // character)
-        short iOldCol = 0;
-        const auto copyRight = iRight;
-        for (; iOldCol < copyRight; iOldCol++)
+        // Fast path: a row that ends in a hard newline and whose content fits
+        // within the new width lands in the new buffer column-for-column; no
+        // rewrapping can occur, so it can be copied wholesale instead of
+        // re-inserted cell by cell. This keeps the reflow cost proportional
+        // to the rows whose wrapping actually changes. The cursor's row and
+        // the final row stay on the per-cell path, which deals with the
+        // cursor placement and trailing newline special cases.
+        const auto newRowWidth = newBuffer.GetLineWidth(newBufferPos.Y);
+        const bool canCopyWholeRow = newBufferPos.X == 0 &&
+                                     !row.WasWrapForced() &&
+                                     iRight < cOldColsTotal &&
+                                     iRight < newRowWidth &&
+                                     iOldRow != cOldCursorPos.Y &&
+                                     iOldRow < cOldRowsTotal - 1;
+        if (canCopyWholeRow)
         {
-            if (iOldCol == cOldCursorPos.X && iOldRow == cOldCursorPos.Y)
-            {
-                cNewCursorPos = newCursor.GetPosition();
-                fFoundCursorPos = true;
-            }
-
             try
             {
-                // TODO: MSFT: 19446208 - this should just use an iterator and the inserter...
-                const auto glyph = row.GetCharRow().GlyphAt(iOldCol);
-                const auto dbcsAttr = row.GetCharRow().DbcsAttrAt(iOldCol);
-                const auto textAttr = row.GetAttrRow().GetAttrByColumn(iOldCol);
-
-                if (!newBuffer.InsertCharacter(glyph, dbcsAttr, textAttr))
+                auto& newRow = newBuffer.GetRowByOffset(newBufferPos.Y);
+                auto& newCharRow = newRow.GetCharRow();
+                const auto oldChars = charRow.Chars();
+                const auto oldAttrs = charRow.Attrs();
+
+                std::copy_n(oldChars.begin(), iRight, newCharRow.Chars().begin());
+                std::copy_n(oldAttrs.begin(), iRight, newCharRow.Attrs().begin());
+                for (short col = 0; col < iRight; col++)
                 {
-                    hr = E_OUTOFMEMORY;
-                    break;
+                    if (til::at(oldAttrs, col).IsGlyphStored())
+                    {
+                        newCharRow.StoreOverflowText(col, charRow.GetOverflowText(col));
+                    }
                 }
+
+                // Take the color attributes as a whole run and trim (or extend)
+                // them to the new width, the same way the loop below the last
+                // printable character handles its rows.
+                newRow.GetAttrRow() = row.GetAttrRow();
+                newRow.GetAttrRow().Resize(newRowWidth);
+
+                // Leave the cursor where the per-cell path would have: just
+                // past the last character written, so the newline handling
+                // below behaves identically.
+                newCursor.SetPosition({ iRight, newBufferPos.Y });
             }
             CATCH_RETURN();
         }
-
-        // GH#32: Copy the attributes from the rest of the row into this new buffer.
-        // From where we are in the old buffer, to the end of the row, copy the
-        // remaining attributes.
-        // - if the old buffer is smaller than the new buffer, then just copy
-        //   what we have, as it was. We already copied all _text_ with colors,
-        //   but it's possible for someone to just put some color into the
-        //   buffer to the right of that without any text (as just spaces). The
-        //   buffer looks weird to the user when we resize and it starts losing
-        //   those colors, so we need to copy them over too... as long as there
-        //   is space. The last attr in the row will be extended to the end of
-        //   the row in the new buffer.
-        // - if the old buffer is WIDER, than we might have wrapped onto a new
-        //   line. Use the cursor's position's Y so that we know where the new
-        //   row is, and start writing at the cursor position. Again, the attr
-        //   in the last column of the old row will be extended to the end of the
-        //   row that the text was flowed onto.
-        //   - if the text in the old buffer didn't actually fill the whole
-        //     line in the new buffer, then we didn't wrap. That's fine. just
-        //     copy attributes from the old row till the end of the new row, and
-        //     move on.
-        const auto newRowY = newCursor.GetPosition().Y;
-        auto& newRow = newBuffer.GetRowByOffset(newRowY);
-        auto newAttrColumn = newCursor.GetPosition().X;
-        const auto newWidth = newBuffer.GetLineWidth(newRowY);
-        // Stop when we get to the end of the buffer width, or the new position
-        // for inserting an attr would be past the right of the new buffer.
-        for (short copyAttrCol = iOldCol;
-             copyAttrCol < cOldColsTotal && newAttrColumn < newWidth;
-             copyAttrCol++, newAttrColumn++)
+        else
         {
-            try
+            // Loop through every character in the current row (up to
+            // the "right" boundary, which is one past the final valid
+            // character)
+            short iOldCol = 0;
+            const auto copyRight = iRight;
+            for (; iOldCol < copyRight; iOldCol++)
             {
-                // TODO: MSFT: 19446208 - this should just use an iterator and the inserter...
-                const auto textAttr = row.GetAttrRow().GetAttrByColumn(copyAttrCol);
-                if (!newRow.GetAttrRow().SetAttrToEnd(newAttrColumn, textAttr))
+                if (iOldCol == cOldCursorPos.X && iOldRow == cOldCursorPos.Y)
                 {
-                    break;
+                    cNewCursorPos = newCursor.GetPosition();
+                    fFoundCursorPos = true;
                 }
+
+                try
+                {
+                    // TODO: MSFT: 19446208 - this should just use an iterator and the inserter...
+                    const auto glyph = row.GetCharRow().GlyphAt(iOldCol);
+                    const auto dbcsAttr = row.GetCharRow().DbcsAttrAt(iOldCol);
+                    const auto textAttr = row.GetAttrRow().GetAttrByColumn(iOldCol);
+
+                    if (!newBuffer.InsertCharacter(glyph, dbcsAttr, textAttr))
+                    {
+                        hr = E_OUTOFMEMORY;
+                        break;
+                    }
+                }
+                CATCH_RETURN();
+            }
+
+            // GH#32: Copy the attributes from the rest of the row into this new buffer.
+            // From where we are in the old buffer, to the end of the row, copy the
+            // remaining attributes.
+            // - if the old buffer is smaller than the new buffer, then just copy
+            //   what we have, as it was. We already copied all _text_ with colors,
+            //   but it's possible for someone to just put some color into the
+            //   buffer to the right of that without any text (as just spaces). The
+            //   buffer looks weird to the user when we resize and it starts losing
+            //   those colors, so we need to copy them over too... as long as there
+            //   is space. The last attr in the row will be extended to the end of
+            //   the row in the new buffer.
+            // - if the old buffer is WIDER, than we might have wrapped onto a new
+            //   line. Use the cursor's position's Y so that we know where the new
+            //   row is, and start writing at the cursor position. Again, the attr
+            //   in the last column of the old row will be extended to the end of the
+            //   row that the text was flowed onto.
+            //   - if the text in the old buffer didn't actually fill the whole
+            //     line in the new buffer, then we didn't wrap. That's fine. just
+            //     copy attributes from the old row till the end of the new row, and
+            //     move on.
+            const auto newRowY = newCursor.GetPosition().Y;
+            auto& newRow = newBuffer.GetRowByOffset(newRowY);
+            auto newAttrColumn = newCursor.GetPosition().X;
+            const auto newWidth = newBuffer.GetLineWidth(newRowY);
+            // Stop when we get to the end of the buffer width, or the new position
+            // for inserting an attr would be past the right of the new buffer.
+            for (short copyAttrCol = iOldCol;
+                 copyAttrCol < cOldColsTotal && newAttrColumn < newWidth;
+                 copyAttrCol++, newAttrColumn++)
+            {
+                try
+                {
+                    // TODO: MSFT: 19446208 - this should just use an iterator and the inserter...
+                    const auto textAttr = row.GetAttrRow().GetAttrByColumn(copyAttrCol);
+                    if (!newRow.GetAttrRow().SetAttrToEnd(newAttrColumn, textAttr))
+                    {
+                        break;
+                    }
+                }
+                CATCH_LOG(); // Not worth dying over.
             }
-            CATCH_LOG(); // Not worth dying over.
         }
 
         // If we found the old row that the caller was interested in, set the
@@ -2593,6 +3278,7 @@ uint16_t TextBuffer::GetHyperlinkId(std::wstring_view uri, std::wstring_view id)
         if (result.second)
         {
             // the custom id did not already exist
+            _hyperlinkCustomIdReverseMap.emplace(_currentHyperlinkId, result.first->first);
             ++_currentHyperlinkId;
         }
         numericId = (*(result.first)).second;
@@ -2613,13 +3299,11 @@ uint16_t TextBuffer::GetHyperlinkId(std::wstring_view uri, std::wstring_view id)
 void TextBuffer::RemoveHyperlinkFromMap(uint16_t id) noexcept
 {
     _hyperlinkMap.erase(id);
-    for (const auto& customIdPair : _hyperlinkCustomIdMap)
+    const auto customIt = _hyperlinkCustomIdReverseMap.find(id);
+    if (customIt != _hyperlinkCustomIdReverseMap.end())
     {
-        if (customIdPair.second == id)
-        {
-            _hyperlinkCustomIdMap.erase(customIdPair.first);
-            break;
-        }
+        _hyperlinkCustomIdMap.erase(customIt->second);
+        _hyperlinkCustomIdReverseMap.erase(customIt);
     }
 }
 
@@ -2632,14 +3316,8 @@ void TextBuffer::RemoveHyperlinkFromMap(uint16_t id) noexcept
 // - The custom ID if there was one, empty string otherwise
 std::wstring TextBuffer::GetCustomIdFromId(uint16_t id) const
 {
-    for (auto customIdPair : _hyperlinkCustomIdMap)
-    {
-        if (customIdPair.second == id)
-        {
-            return customIdPair.first;
-        }
-    }
-    return {};
+    const auto it = _hyperlinkCustomIdReverseMap.find(id);
+    return it != _hyperlinkCustomIdReverseMap.end() ? it->second : std::wstring{};
 }
 
 // Method Description:
@@ -2651,7 +3329,10 @@ void TextBuffer::CopyHyperlinkMaps(const TextBuffer& other)
 {
     _hyperlinkMap = other._hyperlinkMap;
     _hyperlinkCustomIdMap = other._hyperlinkCustomIdMap;
+    _hyperlinkCustomIdReverseMap = other._hyperlinkCustomIdReverseMap;
     _currentHyperlinkId = other._currentHyperlinkId;
+    // The reference counts and the per-row index describe this buffer's own
+    // rows; they rebuild lazily against whatever the reflow copied over.
 }
 
 // Method Description:
@@ -2668,6 +3349,13 @@ const size_t TextBuffer::AddPatternRecognizer(const std::wstring_view regexStrin
     return _currentPatternId;
 }
 
+// Method Description:
+// - Returns the regex patterns we know of, keyed by their pattern ID
+const std::unordered_map<size_t, std::wstring>& TextBuffer::GetPatternRecognizers() const noexcept
+{
+    return _idsAndPatterns;
+}
+
 // Method Description:
 // - Clears the patterns we know of and resets the pattern ID counter
 void TextBuffer::ClearPatternRecognizers() noexcept
@@ -2695,8 +3383,19 @@ void TextBuffer::CopyPatterns(const TextBuffer& OtherBuffer)
 // - An interval tree containing the patterns found
 PointTree TextBuffer::GetPatterns(const size_t firstRow, const size_t lastRow) const
 {
-    PointTree::interval_vector intervals;
+    return SearchPatterns(_idsAndPatterns, GetPatternText(firstRow, lastRow), GetRowByOffset(0).size());
+}
 
+// Method Description:
+// - Gathers the text of the requested region as one string, the way the
+//   pattern search expects it
+// Arguments:
+// - The firstRow to start gathering from
+// - The lastRow to gather
+// Return value:
+// - The concatenated text of the rows in the region
+std::wstring TextBuffer::GetPatternText(const size_t firstRow, const size_t lastRow) const
+{
     std::wstring concatAll;
     const auto rowSize = GetRowByOffset(0).size();
     concatAll.reserve(rowSize * (lastRow - firstRow + 1));
@@ -2708,9 +3407,26 @@ PointTree TextBuffer::GetPatterns(const size_t firstRow, const size_t lastRow) c
         auto& row = GetRowByOffset(i);
         concatAll += row.GetText();
     }
+    return concatAll;
+}
+
+// Method Description:
+// - Runs the regex patterns over previously gathered text. This half of the
+//   search doesn't touch the buffer at all, so it may run on any thread
+//   without holding the buffer's lock - which matters, because the regex
+//   search is by far the most expensive part of pattern detection.
+// Arguments:
+// - The patterns to search for, keyed by their pattern ID
+// - The concatenated text gathered by GetPatternText()
+// - The row width the text was gathered with
+// Return value:
+// - An interval tree containing the patterns found
+PointTree TextBuffer::SearchPatterns(const std::unordered_map<size_t, std::wstring>& idsAndPatterns, const std::wstring& concatAll, const size_t rowSize)
+{
+    PointTree::interval_vector intervals;
 
     // for each pattern we know of, iterate through the string
-    for (const auto& idAndPattern : _idsAndPatterns)
+    for (const auto& idAndPattern : idsAndPatterns)
     {
         std::wregex regexObj{ idAndPattern.second };
 
@@ -54,8 +54,8 @@ filling in the last row, and updating the screen.
 #include "cursor.h"
 #include "Row.hpp"
 #include "TextAttribute.hpp"
-#include "UnicodeStorage.hpp"
 #include "../types/inc/Viewport.hpp"
+#include "../../inc/ConsolePerfCounters.h"
 
 #include "../buffer/out/textBufferCellIterator.hpp"
 #include "../buffer/out/textBufferTextIterator.hpp"
@@ -65,6 +65,105 @@ namespace Microsoft::Console::Render
     class Renderer;
 }
 
+// Process-wide memory budget shared by every TextBuffer in the process. The
+// budget never reaches into a buffer from the outside - rows are only safe
+// to touch under their owner's lock - so enforcement is cooperative: each
+// buffer consults the budget as it takes on new rows and reclaims its own
+// storage (re-packing cold rows first, then surrendering the oldest packed
+// payloads) until the process fits under the ceiling again or the buffer is
+// down to its fair share. Pressure therefore lands first on the buffers that
+// are actively scrolling, which are exactly the ones growing.
+class BufferMemoryBudget final
+{
+public:
+    static BufferMemoryBudget& Instance() noexcept
+    {
+        static BufferMemoryBudget instance;
+        return instance;
+    }
+
+    // The ceiling, in bytes, over the live row storage of all buffers
+    // combined. 0 (the default) disables enforcement entirely.
+    void SetCeiling(const uint64_t bytes) noexcept
+    {
+        _ceilingBytes.store(bytes, std::memory_order_relaxed);
+    }
+
+    uint64_t GetCeiling() const noexcept
+    {
+        return _ceilingBytes.load(std::memory_order_relaxed);
+    }
+
+    void OnBufferCreated() noexcept
+    {
+        _bufferCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void OnBufferDestroyed() noexcept
+    {
+        _bufferCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // How many bytes one buffer is entitled to keep even under pressure. A
+    // buffer at or below this is never asked to reclaim, so one enormous
+    // scrollback can't starve its neighbors down to nothing.
+    uint64_t GetFairShareBytes() const noexcept
+    {
+        const auto count = _bufferCount.load(std::memory_order_relaxed);
+        return count == 0 ? 0 : _ceilingBytes.load(std::memory_order_relaxed) / count;
+    }
+
+    // True when a ceiling is set and the process-wide buffer footprint
+    // exceeds it.
+    bool IsOverCeiling() const noexcept
+    {
+        const auto ceiling = GetCeiling();
+        return ceiling != 0 &&
+               Microsoft::Console::PerfCounters::Instance().bufferAllocations.bytes.load(std::memory_order_relaxed) > ceiling;
+    }
+
+private:
+    BufferMemoryBudget() = default;
+
+    std::atomic<uint64_t> _ceilingBytes{ 0 };
+    std::atomic<size_t> _bufferCount{ 0 };
+};
+
+// Process-wide ledger of the steady-state row storage footprint that buffers
+// of a given geometry historically reached. Keyed by geometry (width and row
+// count, bucketed) rather than by owner: panes of the same size converge on
+// similar footprints no matter which profile opened them, and geometry is the
+// one thing the buffer knows about itself. Each TextBuffer records its
+// high-water mark on teardown and consults the ledger at construction to
+// prime its row pool, so the pool maps its slabs up front instead of growing
+// them one refill at a time under the first output burst. Hosts that keep
+// persisted state can carry the ledger across launches via
+// Serialize/Deserialize; without that it still pays off for every pane after
+// the first in a session.
+class BufferUsageHistory final
+{
+public:
+    static BufferUsageHistory& Instance() noexcept
+    {
+        static BufferUsageHistory instance;
+        return instance;
+    }
+
+    void Record(const COORD size, const uint64_t highWaterBytes) noexcept;
+    uint64_t ExpectedBytes(const COORD size) const noexcept;
+
+    std::wstring Serialize() const;
+    void Deserialize(const std::wstring_view state) noexcept;
+
+private:
+    BufferUsageHistory() = default;
+
+    static uint32_t _KeyFor(const COORD size) noexcept;
+
+    mutable std::mutex _lock;
+    std::unordered_map<uint32_t, uint64_t> _expectedBytes;
+};
+
 class TextBuffer final
 {
 public:
@@ -74,6 +173,7 @@ public:
                const bool isActiveBuffer,
                Microsoft::Console::Render::Renderer& renderer);
     TextBuffer(const TextBuffer& a) = delete;
+    ~TextBuffer();
 
     // Used for duplicating properties to another text buffer
     void CopyProperties(const TextBuffer& OtherBuffer) noexcept;
@@ -101,6 +201,11 @@ public:
                                  const std::optional<bool> setWrap = std::nullopt,
                                  const std::optional<size_t> limitRight = std::nullopt);
 
+    void FillRect(const Microsoft::Console::Types::Viewport rect,
+                  const wchar_t glyph,
+                  const TextAttribute attr,
+                  const std::optional<bool> setWrap = std::nullopt);
+
     bool InsertCharacter(const wchar_t wch, const DbcsAttribute dbcsAttribute, const TextAttribute attr);
     bool InsertCharacter(const std::wstring_view chars, const DbcsAttribute dbcsAttribute, const TextAttribute attr);
     bool IncrementCursor();
@@ -119,6 +224,7 @@ public:
     const Microsoft::Console::Types::Viewport GetSize() const noexcept;
 
     void ScrollRows(const SHORT firstRow, const SHORT size, const SHORT delta);
+    void CopyRect(const Microsoft::Console::Types::Viewport& source, const COORD targetOrigin);
 
     UINT TotalRowCount() const noexcept;
 
@@ -140,8 +246,16 @@ public:
 
     [[nodiscard]] HRESULT ResizeTraditional(const COORD newSize) noexcept;
 
-    const UnicodeStorage& GetUnicodeStorage() const noexcept;
-    UnicodeStorage& GetUnicodeStorage() noexcept;
+    std::pmr::memory_resource* GetRowStorageResource() noexcept;
+
+    void CompressColdRows(const size_t firstActiveRow);
+
+    bool PerformIdleMaintenance(const size_t firstActiveRow, const size_t maxRows);
+
+    uint64_t GetMemoryUsage() const noexcept;
+
+    uint64_t GetRowVersion(const size_t rowOffset) const;
+    const std::wstring& GetRowSearchText(const size_t rowOffset) const;
 
     void SetAsActiveBuffer(const bool isActiveBuffer) noexcept;
     bool IsActiveBuffer() const noexcept;
@@ -153,6 +267,7 @@ public:
     void TriggerRedrawAll();
     void TriggerScroll();
     void TriggerScroll(const COORD delta);
+    void TriggerScrollRegion(const Microsoft::Console::Types::Viewport& region, const COORD delta);
     void TriggerNewTextNotification(const std::wstring_view newText);
 
     const COORD GetWordStart(const COORD target, const std::wstring_view wordDelimiters, bool accessibilityMode = false, std::optional<til::point> limitOptional = std::nullopt) const;
@@ -188,6 +303,12 @@ public:
                                std::function<std::pair<COLORREF, COLORREF>(const TextAttribute&)> GetAttributeColors = nullptr,
                                const bool formatWrappedRows = false) const;
 
+    void ExtractTextInto(std::wstring& textData,
+                         const std::vector<SMALL_RECT>& textRects,
+                         const bool includeCRLF,
+                         const bool trimTrailingWhitespace,
+                         const bool formatWrappedRows = false) const;
+
     static std::string GenHTML(const TextAndColor& rows,
                                const int fontHeightPoints,
                                const std::wstring_view fontFaceName,
@@ -210,22 +331,62 @@ public:
                           std::optional<std::reference_wrapper<PositionInformation>> positionInfo);
 
     const size_t AddPatternRecognizer(const std::wstring_view regexString);
+    const std::unordered_map<size_t, std::wstring>& GetPatternRecognizers() const noexcept;
     void ClearPatternRecognizers() noexcept;
     void CopyPatterns(const TextBuffer& OtherBuffer);
     interval_tree::IntervalTree<til::point, size_t> GetPatterns(const size_t firstRow, const size_t lastRow) const;
+    std::wstring GetPatternText(const size_t firstRow, const size_t lastRow) const;
+    static interval_tree::IntervalTree<til::point, size_t> SearchPatterns(const std::unordered_map<size_t, std::wstring>& idsAndPatterns, const std::wstring& concatAll, const size_t rowSize);
 
 private:
     void _UpdateSize();
+    void _PrimeRowStorage(const uint64_t expectedBytes) noexcept;
     Microsoft::Console::Types::Viewport _size;
-    std::vector<ROW> _storage;
+    // All row storage for this buffer is drawn from this pool, so rows come
+    // out of a handful of large slabs instead of one heap allocation per row.
+    // The slabs are returned to the upstream resource wholesale on teardown.
+    // Declared before _storage so the rows are destroyed before their pool.
+    // The tally underneath the pool keeps the process-wide buffer memory
+    // statistics current, including blocks the pool retains for reuse.
+    Microsoft::Console::TalliedResource _rowAllocatorTally{ Microsoft::Console::PerfCounters::Instance().bufferAllocations, til::pmr::get_default_resource() };
+    std::pmr::unsynchronized_pool_resource _rowAllocator{ &_rowAllocatorTally };
+    // This buffer's live row bytes. The tally sits between the rows and the
+    // pool - not above the pool like the process-wide one - so it counts what
+    // the rows currently hold rather than the slabs the pool has mapped, and
+    // packing or trimming a row shows up here immediately even though the
+    // pool retains the freed blocks for reuse.
+    Microsoft::Console::AllocationTally _instanceAllocations;
+    Microsoft::Console::TalliedResource _instanceResource{ _instanceAllocations, &_rowAllocator };
+    std::pmr::vector<ROW> _storage;
     Cursor _cursor;
 
     SHORT _firstRow; // indexes top row (not necessarily 0)
 
-    TextAttribute _currentAttributes;
+    // row offset below which rows have already been offered cold-scrollback
+    // packing; lets CompressColdRows do incremental work on each scroll
+    size_t _coldRowWatermark = 0;
+
+    // resume point for PerformIdleMaintenance's incremental sweeps
+    size_t _maintenanceCursor = 0;
 
-    // storage location for glyphs that can't fit into the buffer normally
-    UnicodeStorage _unicodeStorage;
+    // row offset below which packed rows have already surrendered their
+    // payloads to the memory budget; keeps enforcement from re-walking rows
+    // it has nothing left to take from
+    size_t _trimmedRowWatermark = 0;
+
+    // how many packed rows a read has rehydrated since enforcement last
+    // re-packed the cold region; lets the re-pack pass be skipped entirely
+    // when nothing below the watermark has been touched
+    size_t _rehydratedColdRowCount = 0;
+
+    // lazily built per-row plain text backing the incremental search index.
+    // indexed by row id (== storage index); each entry remembers the row
+    // version it was built against and is rebuilt when the versions diverge,
+    // so repeated searches over an idle scrollback never re-walk unchanged
+    // rows cell by cell.
+    mutable std::vector<std::optional<std::pair<uint64_t, std::wstring>>> _rowSearchTextCache;
+
+    TextAttribute _currentAttributes;
 
     bool _isActiveBuffer;
     Microsoft::Console::Render::Renderer& _renderer;
@@ -234,6 +395,24 @@ private:
     std::unordered_map<std::wstring, uint16_t> _hyperlinkCustomIdMap;
     uint16_t _currentHyperlinkId;
 
+    // id -> custom id, the reverse of _hyperlinkCustomIdMap, so resolving a
+    // custom id at render time is one hash lookup instead of a walk over
+    // every custom id the session has accumulated
+    std::unordered_map<uint16_t, std::wstring> _hyperlinkCustomIdReverseMap;
+
+    // How many attribute runs across the buffer reference each hyperlink id.
+    // A link lives exactly as long as rows reference it: when the last
+    // referencing run is evicted or overwritten, the id is retired from the
+    // maps. Only consulted right after _RefreshHyperlinkRefs brings it
+    // current.
+    std::unordered_map<uint16_t, size_t> _hyperlinkRefs;
+
+    // per storage-slot record of the hyperlink ids each row carried, keyed
+    // by the row version it was computed against (the same arrangement as
+    // the search text cache); lets the refresh skip unchanged rows with a
+    // single compare instead of re-walking their attribute runs
+    std::vector<std::pair<uint64_t, std::vector<uint16_t>>> _rowHyperlinkCache;
+
     void _RefreshRowIDs(std::optional<SHORT> newRowWidth);
 
     void _SetFirstRowIndex(const SHORT FirstRowIndex) noexcept;
@@ -259,6 +438,9 @@ private:
     const COORD _GetWordEndForSelection(const COORD target, const std::wstring_view wordDelimiters) const;
 
     void _PruneHyperlinks();
+    void _RefreshHyperlinkRefs();
+
+    void _EnforceMemoryBudget();
 
     static void _AppendRTFText(std::ostringstream& contentBuilder, const std::wstring_view& text);
 
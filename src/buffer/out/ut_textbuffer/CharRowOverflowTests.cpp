@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include "WexTestClass.h"
+#include "../../inc/consoletaeftemplates.hpp"
+
+#include "../textBuffer.hpp"
+#include "../../renderer/inc/DummyRenderer.hpp"
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+class CharRowOverflowTests
+{
+    TEST_CLASS(CharRowOverflowTests);
+
+    static DummyRenderer renderer;
+
+    TEST_METHOD(CanOverwriteEmoji)
+    {
+        TextBuffer buffer{ COORD{ 10, 5 }, TextAttribute{ 0x7 }, 0, false, renderer };
+        const COORD coord{ 1, 3 };
+        const std::vector<wchar_t> newMoon{ 0xD83C, 0xDF11 };
+        const std::vector<wchar_t> fullMoon{ 0xD83C, 0xDF15 };
+
+        auto& charRow = buffer.GetRowByOffset(coord.Y).GetCharRow();
+
+        // store initial glyph
+        charRow.GlyphAt(coord.X) = std::wstring_view{ newMoon.data(), newMoon.size() };
+
+        // verify it was stored in the row's overflow side buffer
+        VERIFY_IS_TRUE(charRow.DbcsAttrAt(coord.X).IsGlyphStored());
+        VERIFY_ARE_EQUAL(charRow.GlyphAt(coord.X), newMoon);
+
+        // overwrite it
+        charRow.GlyphAt(coord.X) = std::wstring_view{ fullMoon.data(), fullMoon.size() };
+
+        // verify the glyph was overwritten
+        VERIFY_IS_TRUE(charRow.DbcsAttrAt(coord.X).IsGlyphStored());
+        VERIFY_ARE_EQUAL(charRow.GlyphAt(coord.X), fullMoon);
+    }
+
+    TEST_METHOD(SingleCharClearsStoredGlyph)
+    {
+        TextBuffer buffer{ COORD{ 10, 5 }, TextAttribute{ 0x7 }, 0, false, renderer };
+        const COORD coord{ 2, 1 };
+        const std::vector<wchar_t> newMoon{ 0xD83C, 0xDF11 };
+        const std::vector<wchar_t> letter{ L'a' };
+
+        auto& charRow = buffer.GetRowByOffset(coord.Y).GetCharRow();
+
+        // store an overflow glyph, then replace it with a plain character
+        charRow.GlyphAt(coord.X) = std::wstring_view{ newMoon.data(), newMoon.size() };
+        charRow.GlyphAt(coord.X) = std::wstring_view{ letter.data(), letter.size() };
+
+        // the glyph-stored flag must be cleared and the char read back inline
+        VERIFY_IS_FALSE(charRow.DbcsAttrAt(coord.X).IsGlyphStored());
+        VERIFY_ARE_EQUAL(charRow.GlyphAt(coord.X), letter);
+    }
+};
+
+DummyRenderer CharRowOverflowTests::renderer{};
@@ -746,21 +746,22 @@ class ReflowTests
             row.SetWrapForced(testRow.wrap);
 
             size_t j{};
-            for (auto it{ charRow.begin() }; it != charRow.end(); ++it)
+            const auto chars{ charRow.Chars() };
+            for (size_t col{ 0 }; col < chars.size(); ++col)
             {
                 // Yes, we're about to manually create a buffer. It is unpleasant.
                 const auto ch{ til::at(testRow.text, j) };
-                it->Char() = ch;
+                chars[col] = ch;
                 if (IsGlyphFullWidth(ch))
                 {
-                    it->DbcsAttr().SetLeading();
-                    it++;
-                    it->Char() = ch;
-                    it->DbcsAttr().SetTrailing();
+                    charRow.DbcsAttrAt(col).SetLeading();
+                    col++;
+                    chars[col] = ch;
+                    charRow.DbcsAttrAt(col).SetTrailing();
                 }
                 else
                 {
-                    it->DbcsAttr().SetSingle();
+                    charRow.DbcsAttrAt(col).SetSingle();
                 }
                 j++;
             }
@@ -795,27 +796,28 @@ class ReflowTests
             VERIFY_ARE_EQUAL(testRow.wrap, row.WasWrapForced(), indexString);
 
             size_t j{};
-            for (auto it{ charRow.begin() }; it != charRow.end(); ++it)
+            const auto chars{ charRow.Chars() };
+            for (size_t col{ 0 }; col < chars.size(); ++col)
             {
-                indexString.Format(L"[Cell %d, %d; Text line index %d]", it - charRow.begin(), i, j);
+                indexString.Format(L"[Cell %d, %d; Text line index %d]", col, i, j);
                 // Yes, we're about to manually create a buffer. It is unpleasant.
                 const auto ch{ til::at(testRow.text, j) };
                 if (IsGlyphFullWidth(ch))
                 {
                     // Char is full width in test buffer, so
                     // ensure that real buffer is LEAD, TRAIL (ch)
-                    VERIFY_IS_TRUE(it->DbcsAttr().IsLeading(), indexString);
-                    VERIFY_ARE_EQUAL(ch, it->Char(), indexString);
+                    VERIFY_IS_TRUE(charRow.DbcsAttrAt(col).IsLeading(), indexString);
+                    VERIFY_ARE_EQUAL(ch, chars[col], indexString);
 
-                    it++;
-                    VERIFY_IS_TRUE(it->DbcsAttr().IsTrailing(), indexString);
+                    col++;
+                    VERIFY_IS_TRUE(charRow.DbcsAttrAt(col).IsTrailing(), indexString);
                 }
                 else
                 {
-                    VERIFY_IS_TRUE(it->DbcsAttr().IsSingle(), indexString);
+                    VERIFY_IS_TRUE(charRow.DbcsAttrAt(col).IsSingle(), indexString);
                 }
 
-                VERIFY_ARE_EQUAL(ch, it->Char(), indexString);
+                VERIFY_ARE_EQUAL(ch, chars[col], indexString);
                 j++;
             }
             i++;
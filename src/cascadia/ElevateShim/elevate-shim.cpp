@@ -23,6 +23,11 @@
 // To mitigate this, the Terminal will call into us with the commandline it
 // wants elevated. We'll hang around until ShellExecute is finished, so that the
 // process can successfully elevate.
+//
+// The commandline we're handed targets the window named "elevated". If an
+// elevated instance is already running under that name, the WT we spawn here
+// merely proposes the commandline to it and exits - the existing instance
+// hosts the new tab, and nobody pays for a second elevated Terminal.
 
 #pragma warning(suppress : 26461) // we can't change the signature of wWinMain
 int __stdcall wWinMain(HINSTANCE, HINSTANCE, LPWSTR pCmdLine, int)
@@ -284,6 +284,19 @@ void HwndTerminal::RegisterScrollCallback(std::function<void(int, int, int)> cal
 
 void HwndTerminal::_WriteTextToConnection(const std::wstring_view input) noexcept
 {
+    // The span callback hands the embedder a pointer into our own storage for
+    // the duration of the call, so each keystroke gets marshaled without a
+    // CoTaskMem allocation. The older callback remains as the fallback.
+    if (_pfnWriteSpanCallback)
+    {
+        try
+        {
+            _pfnWriteSpanCallback(input.data(), gsl::narrow_cast<uint32_t>(input.size()));
+        }
+        CATCH_LOG();
+        return;
+    }
+
     if (!_pfnWriteCallback)
     {
         return;
@@ -302,6 +315,11 @@ void HwndTerminal::RegisterWriteCallback(const void _stdcall callback(wchar_t*))
     _pfnWriteCallback = callback;
 }
 
+void HwndTerminal::RegisterWriteSpanCallback(const void _stdcall callback(const wchar_t*, uint32_t))
+{
+    _pfnWriteSpanCallback = callback;
+}
+
 ::Microsoft::Console::Types::IUiaData* HwndTerminal::GetUiaData() const noexcept
 {
     return _terminal.get();
@@ -423,12 +441,27 @@ void _stdcall TerminalRegisterWriteCallback(void* terminal, const void __stdcall
     publicTerminal->RegisterWriteCallback(callback);
 }
 
+void _stdcall TerminalRegisterWriteSpanCallback(void* terminal, const void __stdcall callback(const wchar_t*, uint32_t))
+{
+    const auto publicTerminal = static_cast<HwndTerminal*>(terminal);
+    publicTerminal->RegisterWriteSpanCallback(callback);
+}
+
 void _stdcall TerminalSendOutput(void* terminal, LPCWSTR data)
 {
     const auto publicTerminal = static_cast<HwndTerminal*>(terminal);
     publicTerminal->SendOutput(data);
 }
 
+// Sized variant of TerminalSendOutput: the embedder can hand us a slice of a
+// reusable buffer without null-terminating it, and we don't have to walk the
+// string to find its length.
+void _stdcall TerminalSendOutputSized(void* terminal, _In_reads_(length) const wchar_t* data, uint32_t length)
+{
+    const auto publicTerminal = static_cast<HwndTerminal*>(terminal);
+    publicTerminal->SendOutput({ data, length });
+}
+
 /// <summary>
 /// Triggers a terminal resize using the new width and height in pixel.
 /// </summary>
@@ -769,6 +802,18 @@ void _stdcall TerminalSendKeyEvent(void* terminal, WORD vkey, WORD scanCode, WOR
     publicTerminal->_SendKeyEvent(vkey, scanCode, flags, keyDown);
 }
 
+// Delivers a flat array of key events in one ABI transition. Embedders that
+// pump messages on their own thread can drain the queue into a reusable array
+// and cross the interop boundary once per batch instead of once per key.
+void _stdcall TerminalSendKeyEvents(void* terminal, _In_reads_(count) const TerminalKeyEvent* events, uint32_t count)
+{
+    const auto publicTerminal = static_cast<HwndTerminal*>(terminal);
+    for (const auto& ev : gsl::make_span(events, count))
+    {
+        publicTerminal->_SendKeyEvent(ev.Vkey, ev.ScanCode, ev.Flags, ev.KeyDown != FALSE);
+    }
+}
+
 void _stdcall TerminalSendCharEvent(void* terminal, wchar_t ch, WORD scanCode, WORD flags)
 {
     const auto publicTerminal = static_cast<HwndTerminal*>(terminal);
@@ -208,6 +208,12 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
             std::unique_lock lock{ _peasantsMutex };
             _peasants.erase(peasantId);
         }
+        {
+            // If this was a claimed prewarm window, we don't need to remember
+            // the claim anymore.
+            std::unique_lock lock{ _claimedPrewarmWindowsMutex };
+            _claimedPrewarmWindows.erase(peasantId);
+        }
         _WindowClosedHandlers(nullptr, nullptr);
     }
 
@@ -223,6 +229,35 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
         return _peasants.size();
     }
 
+    bool Monarch::PrewarmEnabled()
+    {
+        return _prewarmEnabled.load(std::memory_order_acquire);
+    }
+
+    // Method Description:
+    // - Enable or disable the prewarmed-window fast path. While enabled, a
+    //   commandline that would otherwise cause a brand new window process to
+    //   be created is instead dispatched to a hidden, fully-initialized spare
+    //   window that registered itself under the reserved name "_prewarm".
+    // - This should only be flipped by the monarch's own host process, based
+    //   on the user's setting.
+    // Arguments:
+    // - enabled: true to start handing out prewarmed windows.
+    // Return Value:
+    // - <none>
+    void Monarch::PrewarmEnabled(bool enabled)
+    {
+        _prewarmEnabled.store(enabled, std::memory_order_release);
+
+        if (enabled)
+        {
+            // Ask the host to make sure a spare actually exists. The host
+            // handles this by spawning a hidden window process, which will
+            // register itself with us under the reserved name.
+            _PrewarmWindowRequestedHandlers(*this, nullptr);
+        }
+    }
+
     // Method Description:
     // - Event handler for the Peasant::WindowActivated event. Used as an
     //   opportunity for us to update our internal stack of the "most recent
@@ -335,6 +370,126 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
         return result;
     }
 
+    // Method Description:
+    // - Find the ID of an unclaimed prewarmed spare window. If we encounter
+    //   any peasants who have died during this process, then we'll remove them
+    //   from the set of _peasants.
+    // Arguments:
+    // - <none>
+    // Return Value:
+    // - 0 if there's no spare available, otherwise a positive number for the
+    //   spare's ID.
+    uint64_t Monarch::_lookupPrewarmPeasantId()
+    {
+        std::unordered_set<uint64_t> claimed;
+        {
+            std::shared_lock lock{ _claimedPrewarmWindowsMutex };
+            claimed = _claimedPrewarmWindows;
+        }
+
+        uint64_t result = 0;
+
+        const auto callback = [&](const auto& id, const auto& p) {
+            if (claimed.count(id) == 0 && p.WindowName() == PrewarmWindowName)
+            {
+                result = id;
+                return false;
+            }
+            return true;
+        };
+
+        const auto onError = [&](const auto& id) {
+            TraceLoggingWrite(g_hRemotingProvider,
+                              "Monarch_lookupPrewarmPeasant_Failed",
+                              TraceLoggingInt64(id, "peasantID", "The ID of the peasant which we could not get the name of"),
+                              TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+                              TraceLoggingKeyword(TIL_KEYWORD_TRACE));
+        };
+
+        _forEachPeasant(callback, onError);
+        return result;
+    }
+
+    // Method Description:
+    // - Try to hand a commandline that needs a brand new window to a
+    //   prewarmed spare instead. The spare is a fully-initialized window
+    //   process that's been sitting hidden, so attaching the commandline and
+    //   showing it skips the whole process/XAML island bring-up.
+    // - If we claim a spare, we'll also raise PrewarmWindowRequested so that
+    //   the host replaces it for the next launch. If there was no spare to
+    //   claim, we raise the same event so the _next_ launch is fast, and tell
+    //   the caller to create the window themselves.
+    // Arguments:
+    // - args: the commandline to dispatch to the spare.
+    // Return Value:
+    // - true if the commandline was successfully dispatched to a prewarmed
+    //   window. false if the caller should create a new window as usual.
+    bool Monarch::_tryDispatchToPrewarmWindow(const Remoting::CommandlineArgs& args)
+    {
+        if (!_prewarmEnabled.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        while (const auto prewarmId = _lookupPrewarmPeasantId())
+        {
+            {
+                // Claim the spare _before_ dispatching to it. If another
+                // proposal raced us here and won, skip this ID and look for
+                // another spare.
+                std::unique_lock lock{ _claimedPrewarmWindowsMutex };
+                if (!_claimedPrewarmWindows.emplace(prewarmId).second)
+                {
+                    continue;
+                }
+            }
+
+            if (const auto prewarmPeasant{ _getPeasant(prewarmId) })
+            {
+                try
+                {
+                    // Hand the spare the commandline first, so that it's
+                    // already doing the work by the time it's visible.
+                    prewarmPeasant.ExecuteCommandline(args);
+
+                    // The spare was created hidden - summon it so it shows up
+                    // where the user actually launched us.
+                    SummonWindowBehavior summonArgs{};
+                    summonArgs.MoveToCurrentDesktop(true);
+                    summonArgs.ToggleVisibility(false);
+                    summonArgs.ToMonitor(MonitorBehavior::ToMouse);
+                    prewarmPeasant.Summon(summonArgs);
+
+                    TraceLoggingWrite(g_hRemotingProvider,
+                                      "Monarch_DispatchedToPrewarmWindow",
+                                      TraceLoggingUInt64(prewarmId, "peasantID", "The ID of the prewarmed window we claimed"),
+                                      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+                                      TraceLoggingKeyword(TIL_KEYWORD_TRACE));
+
+                    // We used up the spare - ask the host to warm up a new one.
+                    _PrewarmWindowRequestedHandlers(*this, nullptr);
+                    return true;
+                }
+                catch (...)
+                {
+                    // The spare died between the lookup and the dispatch. It's
+                    // already marked as claimed, so we won't try it again -
+                    // loop around and look for another one.
+                    TraceLoggingWrite(g_hRemotingProvider,
+                                      "Monarch_DispatchToPrewarmWindow_Failed",
+                                      TraceLoggingUInt64(prewarmId, "peasantID", "The ID of the prewarmed window that died on us"),
+                                      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+                                      TraceLoggingKeyword(TIL_KEYWORD_TRACE));
+                }
+            }
+        }
+
+        // No spare was available. Ask for one anyways, so that the next
+        // window launch can take the fast path.
+        _PrewarmWindowRequestedHandlers(*this, nullptr);
+        return false;
+    }
+
     // Method Description:
     // - Handler for the `Peasant::WindowActivated` event. We'll make a in-proc
     //   copy of the WindowActivatedArgs from the peasant. That way, we won't
@@ -558,6 +713,13 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
                 // Skip it if we see it. Users can still target it with `wt -w
                 // _quake`, which will hit `_lookupPeasantIdForName` instead.
             }
+            else if (peasant.WindowName() == PrewarmWindowName)
+            {
+                // A prewarmed spare is invisible to the user - it should never
+                // be the target of glomming or summoning. (It shouldn't even
+                // be in the MRU list, since it's never been activated, but
+                // let's be careful.)
+            }
             else if (limitToCurrentDesktop && _desktopManager)
             {
                 // Check if this peasant is actually on this desktop. We can't
@@ -765,6 +927,18 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
             }
         }
 
+        // If we get here, we couldn't find an existing window. Before asking
+        // the caller to build a brand new one, see if there's a prewarmed
+        // spare window standing by that can take this commandline instead.
+        // Only do this for the plain new-window case - if the user asked for a
+        // window with a specific name, they want a window _with that name_,
+        // and the spare can't take one on through this path.
+        if (targetWindowName.empty() && _tryDispatchToPrewarmWindow(args))
+        {
+            auto result{ winrt::make_self<Remoting::implementation::ProposeCommandlineResult>(false) };
+            return *result;
+        }
+
         // If we get here, we couldn't find an existing window. Make a new one.
         TraceLoggingWrite(g_hRemotingProvider,
                           "Monarch_ProposeCommandline_NewWindow",
@@ -788,9 +962,16 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
     // - <unused>
     // Return Value:
     // - <none>
-    void Monarch::_identifyWindows(const winrt::Windows::Foundation::IInspectable& /*sender*/,
-                                   const winrt::Windows::Foundation::IInspectable& /*args*/)
+    winrt::fire_and_forget Monarch::_identifyWindows(const winrt::Windows::Foundation::IInspectable& /*sender*/,
+                                                     const winrt::Windows::Foundation::IInspectable& /*args*/)
     {
+        // Hop off to a background thread before fanning out. Each
+        // DisplayWindowId call below is a cross-process round-trip, and the
+        // peasant who asked for the identification is blocked in an RPC to us
+        // until this handler returns - they shouldn't have to wait for us to
+        // visit every other window first.
+        co_await winrt::resume_background();
+
         // Notify all the peasants to display their ID.
         const auto callback = [&](const auto& /*id*/, const auto& p) {
             p.DisplayWindowId();
@@ -954,7 +1135,17 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
         }
 
         const auto func = [&](const auto& id, const auto& p) -> void {
-            names.push_back({ id, p.WindowName(), p.ActiveTabTitle() });
+            // GetInfo fetches the name and title with a single RPC, rather
+            // than one round-trip per property.
+            auto info = p.GetInfo();
+            info.Id = id;
+
+            // Don't report prewarmed spares - as far as the user is
+            // concerned, those windows don't exist yet.
+            if (info.Name != PrewarmWindowName)
+            {
+                names.push_back(std::move(info));
+            }
         };
 
         const auto onError = [&](const auto& id) {
@@ -997,6 +1188,12 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
     void Monarch::SummonAllWindows()
     {
         const auto func = [&](const auto& /*id*/, const auto& p) {
+            // Leave prewarmed spares hidden - they only get revealed when a
+            // commandline claims them.
+            if (p.WindowName() == PrewarmWindowName)
+            {
+                return;
+            }
             SummonWindowBehavior args{};
             args.ToggleVisibility(false);
             p.Summon(args);
@@ -1023,6 +1220,12 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
     {
         std::vector<winrt::hstring> vec;
         auto callback = [&](const auto& /*id*/, const auto& p) {
+            // A prewarmed spare has no tabs - don't persist it as an empty
+            // window in the saved session.
+            if (p.WindowName() == PrewarmWindowName)
+            {
+                return;
+            }
             vec.emplace_back(p.GetWindowLayout());
         };
         auto onError = [](auto&& id) {
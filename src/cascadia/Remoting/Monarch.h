@@ -60,7 +60,11 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
         Windows::Foundation::Collections::IVectorView<winrt::Microsoft::Terminal::Remoting::PeasantInfo> GetPeasantInfos();
         Windows::Foundation::Collections::IVector<winrt::hstring> GetAllWindowLayouts();
 
+        bool PrewarmEnabled();
+        void PrewarmEnabled(bool enabled);
+
         TYPED_EVENT(FindTargetWindowRequested, winrt::Windows::Foundation::IInspectable, winrt::Microsoft::Terminal::Remoting::FindTargetWindowArgs);
+        TYPED_EVENT(PrewarmWindowRequested, winrt::Windows::Foundation::IInspectable, winrt::Windows::Foundation::IInspectable);
         TYPED_EVENT(ShowNotificationIconRequested, winrt::Windows::Foundation::IInspectable, winrt::Windows::Foundation::IInspectable);
         TYPED_EVENT(HideNotificationIconRequested, winrt::Windows::Foundation::IInspectable, winrt::Windows::Foundation::IInspectable);
         TYPED_EVENT(WindowCreated, winrt::Windows::Foundation::IInspectable, winrt::Windows::Foundation::IInspectable);
@@ -85,9 +89,19 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
         std::shared_mutex _peasantsMutex{};
         std::shared_mutex _mruPeasantsMutex{};
 
+        // Prewarmed spares are only handed out once. Once we've dispatched a
+        // commandline to one, its ID lands in this set, so a concurrent (or
+        // later) proposal can't claim the same window twice. This is a leaf
+        // lock: never take the other mutexes while holding it.
+        std::atomic<bool> _prewarmEnabled{ false };
+        std::unordered_set<uint64_t> _claimedPrewarmWindows;
+        std::shared_mutex _claimedPrewarmWindowsMutex{};
+
         winrt::Microsoft::Terminal::Remoting::IPeasant _getPeasant(uint64_t peasantID, bool clearMruPeasantOnFailure = true);
         uint64_t _getMostRecentPeasantID(bool limitToCurrentDesktop, const bool ignoreQuakeWindow);
         uint64_t _lookupPeasantIdForName(std::wstring_view name);
+        uint64_t _lookupPrewarmPeasantId();
+        bool _tryDispatchToPrewarmWindow(const winrt::Microsoft::Terminal::Remoting::CommandlineArgs& args);
 
         void _peasantWindowActivated(const winrt::Windows::Foundation::IInspectable& sender,
                                      const winrt::Microsoft::Terminal::Remoting::WindowActivatedArgs& args);
@@ -97,8 +111,8 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
         void _forAllPeasantsIgnoringTheDead(std::function<void(const winrt::Microsoft::Terminal::Remoting::IPeasant&, const uint64_t)> callback,
                                             std::function<void(const uint64_t)> errorCallback);
 
-        void _identifyWindows(const winrt::Windows::Foundation::IInspectable& sender,
-                              const winrt::Windows::Foundation::IInspectable& args);
+        winrt::fire_and_forget _identifyWindows(const winrt::Windows::Foundation::IInspectable& sender,
+                                                const winrt::Windows::Foundation::IInspectable& args);
 
         void _renameRequested(const winrt::Windows::Foundation::IInspectable& sender,
                               const winrt::Microsoft::Terminal::Remoting::RenameRequestArgs& args);
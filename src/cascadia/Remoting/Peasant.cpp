@@ -45,6 +45,20 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
         return _ourPID;
     }
 
+    // Method Description:
+    // - Returns our ID, name and active tab title bundled into a single
+    //   struct. When the monarch enumerates all the windows for the window
+    //   list, this lets it grab everything it needs about us with one
+    //   cross-process call, instead of one call per property.
+    // Arguments:
+    // - <none>
+    // Return Value:
+    // - a PeasantInfo describing this window.
+    Remoting::PeasantInfo Peasant::GetInfo()
+    {
+        return { _id, _WindowName, _ActiveTabTitle };
+    }
+
     bool Peasant::ExecuteCommandline(const Remoting::CommandlineArgs& args)
     {
         // If this is the first set of args we were ever told about, stash them
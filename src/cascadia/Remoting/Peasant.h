@@ -19,6 +19,7 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
         void AssignID(uint64_t id);
         uint64_t GetID();
         uint64_t GetPID();
+        winrt::Microsoft::Terminal::Remoting::PeasantInfo GetInfo();
 
         bool ExecuteCommandline(const winrt::Microsoft::Terminal::Remoting::CommandlineArgs& args);
         void ActivateWindow(const winrt::Microsoft::Terminal::Remoting::WindowActivatedArgs& args);
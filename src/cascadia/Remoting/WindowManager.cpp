@@ -438,6 +438,7 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
         _monarch.ShowNotificationIconRequested([this](auto&&, auto&&) { _ShowNotificationIconRequestedHandlers(*this, nullptr); });
         _monarch.HideNotificationIconRequested([this](auto&&, auto&&) { _HideNotificationIconRequestedHandlers(*this, nullptr); });
         _monarch.QuitAllRequested({ get_weak(), &WindowManager::_QuitAllRequestedHandlers });
+        _monarch.PrewarmWindowRequested([this](auto&&, auto&&) { _PrewarmWindowRequestedHandlers(*this, nullptr); });
 
         _BecameMonarchHandlers(*this, nullptr);
     }
@@ -771,6 +772,39 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
         return _monarch.DoesQuakeWindowExist();
     }
 
+    bool WindowManager::PrewarmEnabled()
+    {
+        if (_monarch)
+        {
+            try
+            {
+                return _monarch.PrewarmEnabled();
+            }
+            CATCH_LOG()
+        }
+        return false;
+    }
+
+    // Method Description:
+    // - Tell the monarch whether the prewarmed-window fast path should be
+    //   enabled. This should only be called by the monarch's host process,
+    //   which is the one listening for PrewarmWindowRequested.
+    // Arguments:
+    // - enabled: true to keep a hidden spare window standing by.
+    // Return Value:
+    // - <none>
+    void WindowManager::PrewarmEnabled(bool enabled)
+    {
+        if (_monarch)
+        {
+            try
+            {
+                _monarch.PrewarmEnabled(enabled);
+            }
+            CATCH_LOG()
+        }
+    }
+
     void WindowManager::UpdateActiveTabTitle(winrt::hstring title)
     {
         winrt::get_self<implementation::Peasant>(_peasant)->ActiveTabTitle(title);
@@ -191,6 +191,10 @@ void AppCommandlineArgs::_buildParser()
                     _loadPersistedLayoutIdx,
                     RS_A(L"CmdSavedLayoutArgDesc"));
 
+    _app.add_flag("--startup-timings",
+                  _reportStartupTimings,
+                  RS_A(L"CmdStartupTimingsArgDesc"));
+
     // Subcommands
     _buildNewTabParser();
     _buildSplitPaneParser();
@@ -887,6 +891,15 @@ bool AppCommandlineArgs::ShouldExitEarly() const noexcept
     return _shouldExitEarly;
 }
 
+// Method Description:
+// - Returns true if the user passed `--startup-timings`, and wants the
+//   startup milestone summary printed to the console once the terminal has
+//   finished launching.
+bool AppCommandlineArgs::ShouldReportStartupTimings() const noexcept
+{
+    return _reportStartupTimings;
+}
+
 // Method Description:
 // - Ensure that the first command in our list of actions is a NewTab action.
 //   This makes sure that if the user passes a commandline like "wt split-pane
@@ -1060,6 +1073,7 @@ void AppCommandlineArgs::FullResetState()
     _startupActions.clear();
     _exitMessage = "";
     _shouldExitEarly = false;
+    _reportStartupTimings = false;
     _isHandoffListener = false;
 
     _windowTarget = {};
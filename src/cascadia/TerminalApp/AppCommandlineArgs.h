@@ -38,6 +38,7 @@ public:
     bool IsHandoffListener() const noexcept;
     const std::string& GetExitMessage();
     bool ShouldExitEarly() const noexcept;
+    bool ShouldReportStartupTimings() const noexcept;
 
     std::optional<uint32_t> GetPersistedLayoutIdx() const noexcept;
     std::optional<winrt::Microsoft::Terminal::Settings::Model::LaunchMode> GetLaunchMode() const noexcept;
@@ -123,6 +124,7 @@ private:
     std::vector<winrt::Microsoft::Terminal::Settings::Model::ActionAndArgs> _startupActions;
     std::string _exitMessage;
     bool _shouldExitEarly{ false };
+    bool _reportStartupTimings{ false };
 
     int _loadPersistedLayoutIdx{};
     std::string _windowTarget{};
@@ -3,6 +3,7 @@
 
 #include "pch.h"
 #include "AppLogic.h"
+#include "StartupTimings.h"
 #include "../inc/WindowingBehavior.h"
 #include "AppLogic.g.cpp"
 #include "FindTargetWindowResult.g.cpp"
@@ -313,6 +314,8 @@ namespace winrt::TerminalApp::implementation
             TraceLoggingBool(_settings.GlobalSettings().ShowTabsInTitlebar(), "TabsInTitlebar"),
             TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
             TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance));
+
+        StartupTimings::Instance().Note(StartupTimings::Milestone::XamlReady);
     }
 
     void AppLogic::Quit()
@@ -886,6 +889,8 @@ namespace winrt::TerminalApp::implementation
             TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
             TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance));
 
+        StartupTimings::Instance().Note(StartupTimings::Milestone::SettingsLoaded);
+
         _loadedInitialSettings = true;
 
         // Register for directory change notification.
@@ -904,6 +909,7 @@ namespace winrt::TerminalApp::implementation
     void AppLogic::_RegisterSettingsChange()
     {
         const std::filesystem::path settingsPath{ std::wstring_view{ CascadiaSettings::SettingsPath() } };
+        const std::filesystem::path generatedProfilesCachePath{ std::wstring_view{ CascadiaSettings::GeneratedProfilesCachePath() } };
         _reader.create(
             settingsPath.parent_path().c_str(),
             false,
@@ -912,7 +918,7 @@ namespace winrt::TerminalApp::implementation
             // editors, who will write a temp file, then rename it to be the
             // actual file you wrote. So listen for that too.
             wil::FolderChangeEvents::FileName | wil::FolderChangeEvents::LastWriteTime,
-            [this, settingsBasename = settingsPath.filename()](wil::FolderChangeEvent, PCWSTR fileModified) {
+            [this, settingsBasename = settingsPath.filename(), cacheBasename = generatedProfilesCachePath.filename()](wil::FolderChangeEvent, PCWSTR fileModified) {
                 // DO NOT create a static reference to ApplicationState::SharedInstance here.
                 //
                 // ApplicationState::SharedInstance already caches its own
@@ -938,6 +944,14 @@ namespace winrt::TerminalApp::implementation
                 {
                     _reloadState();
                 }
+                else if (modifiedBasename == cacheBasename)
+                {
+                    // The background revalidation of the generated-profiles
+                    // cache found a change (say, a newly installed WSL
+                    // distro). Reload so it shows up now rather than on the
+                    // next launch.
+                    _reloadSettings->Run();
+                }
             });
     }
 
@@ -1236,6 +1250,10 @@ namespace winrt::TerminalApp::implementation
             // then it contains only the executable name and no other arguments.
             _hasCommandLineArguments = args.size() > 1;
             _appArgs.ValidateStartupCommands();
+            if (_appArgs.ShouldReportStartupTimings())
+            {
+                StartupTimings::Instance().EnableConsoleDump();
+            }
             if (const auto idx = _appArgs.GetPersistedLayoutIdx())
             {
                 _root->SetPersistedLayoutIdx(idx.value());
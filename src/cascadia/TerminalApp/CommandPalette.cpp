@@ -928,6 +928,10 @@ namespace winrt::TerminalApp::implementation
     // Although the source observable we still don't register on it,
     // so the palette user will need to reset the binding manually every time
     // the source collection changes
+    // - The palette items themselves are cached per tab and reused across
+    //   calls. A TabPaletteItem tracks its tab's title, icon and status
+    //   through the tab's own PropertyChanged events, so a cached item is
+    //   always current - all we have to rebuild here is the ordering.
     // Arguments:
     // - source: the tabs to use for creation filtered commands
     // - target: the collection to store newly created filtered commands
@@ -937,17 +941,37 @@ namespace winrt::TerminalApp::implementation
         Windows::Foundation::Collections::IObservableVector<winrt::TerminalApp::TabBase> const& source,
         Windows::Foundation::Collections::IVector<winrt::TerminalApp::FilteredCommand> const& target)
     {
-        target.Clear();
+        std::vector<winrt::TerminalApp::FilteredCommand> commands;
+        commands.reserve(source.Size());
         for (const auto& tab : source)
         {
-            auto tabPaletteItem{ winrt::make<winrt::TerminalApp::implementation::TabPaletteItem>(tab) };
-            auto filteredCommand{ winrt::make<FilteredCommand>(tabPaletteItem) };
-            target.Append(filteredCommand);
+            const auto [it, created] = _tabActionCache.try_emplace(winrt::get_abi(tab), nullptr);
+            if (created)
+            {
+                auto tabPaletteItem{ winrt::make<winrt::TerminalApp::implementation::TabPaletteItem>(tab) };
+                it->second = winrt::make<FilteredCommand>(tabPaletteItem);
+            }
+            commands.push_back(it->second);
         }
+        target.ReplaceAll(commands);
     }
 
     void CommandPalette::SetTabs(Collections::IObservableVector<TabBase> const& tabs, Collections::IObservableVector<TabBase> const& mruTabs)
     {
+        // Sweep cache entries for tabs that have been closed, so the cached
+        // palette items don't keep those tabs alive. (The MRU list is a
+        // permutation of `tabs`, so sweeping against `tabs` covers both.)
+        std::unordered_map<void*, winrt::TerminalApp::FilteredCommand> liveCache;
+        liveCache.reserve(tabs.Size());
+        for (const auto& tab : tabs)
+        {
+            if (const auto it = _tabActionCache.find(winrt::get_abi(tab)); it != _tabActionCache.end())
+            {
+                liveCache.emplace(it->first, std::move(it->second));
+            }
+        }
+        _tabActionCache = std::move(liveCache);
+
         _bindTabs(tabs, _tabActions);
         _bindTabs(mruTabs, _mruTabActions);
     }
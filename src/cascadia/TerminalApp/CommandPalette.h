@@ -111,6 +111,9 @@ namespace winrt::TerminalApp::implementation
         // Tab Switcher
         Windows::Foundation::Collections::IVector<winrt::TerminalApp::FilteredCommand> _tabActions{ nullptr };
         Windows::Foundation::Collections::IVector<winrt::TerminalApp::FilteredCommand> _mruTabActions{ nullptr };
+        // Cache of palette items per tab (keyed by the tab's ABI pointer), so
+        // reopening the switcher doesn't recreate an item for every open tab.
+        std::unordered_map<void*, winrt::TerminalApp::FilteredCommand> _tabActionCache;
         Microsoft::Terminal::Settings::Model::TabSwitcherMode _tabSwitcherMode;
         uint32_t _switcherStartIdx;
 
@@ -26,6 +26,7 @@ namespace winrt::TerminalApp::implementation
         _Filter(L""),
         _Weight(0)
     {
+        _foldedName = _foldText(_Item.Name());
         _HighlightedName = _computeHighlightedName();
 
         // Recompute the highlighted name if the item name changes
@@ -33,6 +34,7 @@ namespace winrt::TerminalApp::implementation
             auto filteredCommand{ weakThis.get() };
             if (filteredCommand && e.PropertyName() == L"Name")
             {
+                filteredCommand->_foldedName = _foldText(filteredCommand->_Item.Name());
                 filteredCommand->HighlightedName(filteredCommand->_computeHighlightedName());
                 filteredCommand->Weight(filteredCommand->_computeWeight());
             }
@@ -46,9 +48,74 @@ namespace winrt::TerminalApp::implementation
         if (filter != _Filter)
         {
             Filter(filter);
-            HighlightedName(_computeHighlightedName());
-            Weight(_computeWeight());
+            _foldedFilter = _foldText(filter);
+
+            // Cheap subsequence probe over the folded copies first: most of
+            // the commands won't match the filter at all, and there's no
+            // reason to rebuild their highlight segments (and fire the
+            // attendant change notifications) just to find that out.
+            if (_foldedFilter.empty() || _filterMatchesName())
+            {
+                HighlightedName(_computeHighlightedName());
+                Weight(_computeWeight());
+            }
+            else
+            {
+                // The name doesn't match, so the command won't be shown -
+                // don't bother re-segmenting it. Zeroing the weight is what
+                // filters it out; the highlight is recomputed the next time
+                // the filter matches.
+                Weight(0);
+            }
+        }
+    }
+
+    // Method Description:
+    // - Produces a locale-aware lowercased copy of the given text, used for
+    //   caseless matching. Folding the whole string once keeps the
+    //   per-keystroke matching loops to plain character comparisons.
+    std::wstring FilteredCommand::_foldText(std::wstring_view text)
+    {
+        std::wstring folded{ text };
+        if (!folded.empty())
+        {
+            LCMapStringEx(LOCALE_NAME_USER_DEFAULT,
+                          LCMAP_LOWERCASE,
+                          text.data(),
+                          gsl::narrow_cast<int>(text.size()),
+                          folded.data(),
+                          gsl::narrow_cast<int>(folded.size()),
+                          nullptr,
+                          nullptr,
+                          0);
+        }
+        return folded;
+    }
+
+    // Method Description:
+    // - Determines whether the folded filter appears in the folded item name
+    //   as a subsequence (the same criterion _computeHighlightedName uses to
+    //   decide whether anything is highlighted), without allocating anything.
+    bool FilteredCommand::_filterMatchesName() const noexcept
+    {
+        size_t nameIndex = 0;
+        for (const auto searchChar : _foldedFilter)
+        {
+            while (true)
+            {
+                if (nameIndex == _foldedName.size())
+                {
+                    return false;
+                }
+                const auto matched = _foldedName[nameIndex] == searchChar;
+                nameIndex++;
+                if (matched)
+                {
+                    break;
+                }
+            }
         }
+        return true;
     }
 
     // Method Description:
@@ -78,9 +145,14 @@ namespace winrt::TerminalApp::implementation
         uint32_t nextOffsetToReport = 0;
         uint32_t currentOffset = 0;
 
-        for (const auto searchChar : _Filter)
+        // GH#9941: search should be locale-aware, so the comparisons run over
+        // locale-lowercased copies of the name and the filter. _foldedName is
+        // kept in sync with the item name; the filter is folded here because
+        // the unit tests assign _Filter directly.
+        const auto foldedFilter = _foldText(_Filter);
+
+        for (const auto searchChar : foldedFilter)
         {
-            const WCHAR searchCharAsString[] = { searchChar, L'\0' };
             while (true)
             {
                 if (currentOffset == commandName.size())
@@ -93,10 +165,7 @@ namespace winrt::TerminalApp::implementation
                     return winrt::make<HighlightedText>(segments);
                 }
 
-                // GH#9941: search should be locale-aware as well
-                // We use the same comparison method as upon sorting to guarantee consistent behavior
-                const WCHAR currentCharAsString[] = { commandName[currentOffset], L'\0' };
-                auto isCurrentCharMatched = lstrcmpi(searchCharAsString, currentCharAsString) == 0;
+                auto isCurrentCharMatched = til::at(_foldedName, currentOffset) == searchChar;
                 if (isProcessingMatchedSegment != isCurrentCharMatched)
                 {
                     // We reached the end of the region (matched character came after a series of unmatched or vice versa).
@@ -32,8 +32,17 @@ namespace winrt::TerminalApp::implementation
     private:
         winrt::TerminalApp::HighlightedText _computeHighlightedName();
         int _computeWeight();
+        static std::wstring _foldText(std::wstring_view text);
+        bool _filterMatchesName() const noexcept;
         Windows::UI::Xaml::Data::INotifyPropertyChanged::PropertyChanged_revoker _itemChangedRevoker;
 
+        // Locale-lowercased copies of the item name and the active filter.
+        // The palette re-filters a couple thousand commands per keystroke,
+        // so matching has to run over pre-folded text rather than case-folding
+        // one character at a time.
+        std::wstring _foldedName;
+        std::wstring _foldedFilter;
+
         friend class TerminalAppLocalTests::FilteredCommandTests;
     };
 }
@@ -164,6 +164,11 @@ NewTerminalArgs Pane::GetTerminalArgsForPane() const
     // object. That would work for schemes set by the Terminal, but not ones set
     // by VT, but that seems good enough.
 
+    // Record the control's session GUID, so that if these args end up
+    // persisted in a window layout, the restored pane can find the buffer
+    // snapshot that was saved for this session.
+    args.SessionId(_control.SessionId());
+
     return args;
 }
 
@@ -2739,27 +2744,33 @@ Pane::SnapChildrenSizeResult Pane::_CalcSnappedChildrenSizes(const bool widthOrH
     // size, but it doesn't seem to be beneficial.
 
     auto sizeTree = _CreateMinSizeTree(widthOrHeight);
-    LayoutSizeNode lastSizeTree{ sizeTree };
 
-    while (sizeTree.size < fullSize)
+    // Each advance changes the size of a single leaf, so the only state worth
+    // remembering from the previous iteration is the pair of child sizes we'd
+    // return. Deep-copying the whole tree on every advance made this loop
+    // quadratic in the number of panes.
+    auto lastChildSizes = std::make_pair(sizeTree->firstChild->size, sizeTree->secondChild->size);
+
+    while (sizeTree->size < fullSize)
     {
-        lastSizeTree = sizeTree;
-        _AdvanceSnappedDimension(widthOrHeight, sizeTree);
+        lastChildSizes = { sizeTree->firstChild->size, sizeTree->secondChild->size };
+        _AdvanceSnappedDimension(widthOrHeight, *sizeTree);
 
-        if (sizeTree.size == fullSize)
+        if (sizeTree->size == fullSize)
         {
             // If we just hit exactly the requested value, then just return the
             // current state of children.
-            return { { sizeTree.firstChild->size, sizeTree.secondChild->size },
-                     { sizeTree.firstChild->size, sizeTree.secondChild->size } };
+            return { { sizeTree->firstChild->size, sizeTree->secondChild->size },
+                     { sizeTree->firstChild->size, sizeTree->secondChild->size } };
         }
     }
 
-    // We exceeded the requested size in the loop above, so lastSizeTree will have
-    // the last good sizes (so that children fit in) and sizeTree has the next possible
-    // snapped sizes. Return them as lower and higher snap possibilities.
-    return { { lastSizeTree.firstChild->size, lastSizeTree.secondChild->size },
-             { sizeTree.firstChild->size, sizeTree.secondChild->size } };
+    // We exceeded the requested size in the loop above, so lastChildSizes will
+    // have the last good sizes (so that children fit in) and sizeTree has the
+    // next possible snapped sizes. Return them as lower and higher snap
+    // possibilities.
+    return { { lastChildSizes.first, lastChildSizes.second },
+             { sizeTree->firstChild->size, sizeTree->secondChild->size } };
 }
 
 // Method Description:
@@ -3022,16 +3033,30 @@ Size Pane::_GetMinSize() const
 // - widthOrHeight: if true operates on width, otherwise on height
 // Return Value:
 // - Root node of built tree that matches this pane.
-Pane::LayoutSizeNode Pane::_CreateMinSizeTree(const bool widthOrHeight) const
+std::unique_ptr<Pane::LayoutSizeNode> Pane::_CreateMinSizeTree(const bool widthOrHeight) const
 {
-    const auto size = _GetMinSize();
-    LayoutSizeNode node(widthOrHeight ? size.Width : size.Height);
-    if (!_IsLeaf())
+    if (_IsLeaf())
     {
-        node.firstChild = std::make_unique<LayoutSizeNode>(_firstChild->_CreateMinSizeTree(widthOrHeight));
-        node.secondChild = std::make_unique<LayoutSizeNode>(_secondChild->_CreateMinSizeTree(widthOrHeight));
+        const auto size = _GetMinSize();
+        return std::make_unique<LayoutSizeNode>(widthOrHeight ? size.Width : size.Height);
     }
 
+    // Build the children first and derive our own minimum from theirs, the
+    // same way _GetMinSize() combines its children. This keeps the build a
+    // single O(n) walk over the pane tree; calling _GetMinSize() at every
+    // node would traverse (and query the control of) each leaf once per
+    // ancestor, which hurts on every advance of a drag-resize with deep
+    // splits.
+    auto firstChild = _firstChild->_CreateMinSizeTree(widthOrHeight);
+    auto secondChild = _secondChild->_CreateMinSizeTree(widthOrHeight);
+
+    const auto minSize = _splitState == (widthOrHeight ? SplitState::Horizontal : SplitState::Vertical) ?
+                             std::max(firstChild->size, secondChild->size) :
+                             firstChild->size + secondChild->size;
+
+    auto node = std::make_unique<LayoutSizeNode>(minSize);
+    node->firstChild = std::move(firstChild);
+    node->secondChild = std::move(secondChild);
     return node;
 }
 
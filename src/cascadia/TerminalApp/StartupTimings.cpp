@@ -0,0 +1,136 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "pch.h"
+#include "StartupTimings.h"
+
+using namespace TerminalApp;
+
+StartupTimings& StartupTimings::Instance() noexcept
+{
+    static StartupTimings instance;
+    return instance;
+}
+
+uint64_t StartupTimings::_MicrosecondsSinceProcessCreation() noexcept
+{
+    FILETIME creation{}, exit{}, kernel{}, user{};
+    if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+    {
+        return 0;
+    }
+
+    FILETIME now{};
+    GetSystemTimePreciseAsFileTime(&now);
+
+    const auto toUint64 = [](const FILETIME& ft) {
+        return (static_cast<uint64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+    };
+
+    // FILETIMEs are in 100ns units. Anchoring on the kernel's creation
+    // time rather than a static initializer means the loader, static init
+    // and everything else before wWinMain is charged to the first phase,
+    // where it belongs.
+    return (toUint64(now) - toUint64(creation)) / 10;
+}
+
+void StartupTimings::Note(const Milestone milestone) noexcept
+{
+    // Clamp to 1 so a recorded slot can never collide with the 0 that
+    // means "not recorded yet".
+    const auto stamp = std::max(_MicrosecondsSinceProcessCreation(), uint64_t{ 1 });
+
+    auto expected = uint64_t{ 0 };
+    if (!_timestamps[static_cast<size_t>(milestone)].compare_exchange_strong(expected, stamp, std::memory_order_relaxed))
+    {
+        // Someone beat us to this milestone; the launch keeps its first
+        // recording.
+        return;
+    }
+
+    for (const auto& slot : _timestamps)
+    {
+        if (slot.load(std::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+    }
+
+    _Report();
+}
+
+bool StartupTimings::Recorded(const Milestone milestone) const noexcept
+{
+    return _timestamps[static_cast<size_t>(milestone)].load(std::memory_order_relaxed) != 0;
+}
+
+void StartupTimings::EnableConsoleDump() noexcept
+{
+    _dumpToConsole.store(true, std::memory_order_relaxed);
+}
+
+double StartupTimings::_Milliseconds(const Milestone milestone) const noexcept
+{
+    return static_cast<double>(_timestamps[static_cast<size_t>(milestone)].load(std::memory_order_relaxed)) / 1000.0;
+}
+
+void StartupTimings::_Report() noexcept
+{
+    if (_reported.exchange(true, std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    TraceLoggingWrite(
+        g_hTerminalAppProvider,
+        "StartupTimings",
+        TraceLoggingDescription("All startup milestones for this launch, in milliseconds since process creation"),
+        TraceLoggingFloat64(_Milliseconds(Milestone::SettingsLoaded), "SettingsLoadedMs"),
+        TraceLoggingFloat64(_Milliseconds(Milestone::XamlReady), "XamlReadyMs"),
+        TraceLoggingFloat64(_Milliseconds(Milestone::ConnectionStarted), "ConnectionStartedMs"),
+        TraceLoggingFloat64(_Milliseconds(Milestone::FirstFramePresented), "FirstFramePresentedMs"),
+        TraceLoggingFloat64(_Milliseconds(Milestone::FirstPromptByte), "FirstPromptByteMs"),
+        TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
+        TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance));
+
+    if (_dumpToConsole.load(std::memory_order_relaxed))
+    {
+        _DumpToConsole();
+    }
+}
+
+void StartupTimings::_DumpToConsole() const noexcept
+try
+{
+    // We're a GUI-subsystem binary, so there's no stdout of our own to
+    // write to; borrow the console of whoever launched us (for `wt
+    // --startup-timings` typed into a shell, that's the shell's). If we
+    // weren't launched from a console there's nowhere to print, and the
+    // summary ETW event above fired either way.
+    if (!AttachConsole(ATTACH_PARENT_PROCESS))
+    {
+        return;
+    }
+    const auto detach = wil::scope_exit([]() { FreeConsole(); });
+
+    wil::unique_hfile conout{ CreateFileW(L"CONOUT$", GENERIC_WRITE, FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, 0, nullptr) };
+    if (!conout)
+    {
+        return;
+    }
+
+    const auto text = fmt::format("\nStartup timings (ms since process creation):\n"
+                                  "  settings loaded        {:8.1f}\n"
+                                  "  xaml ready             {:8.1f}\n"
+                                  "  connection started     {:8.1f}\n"
+                                  "  first frame presented  {:8.1f}\n"
+                                  "  first prompt byte      {:8.1f}\n",
+                                  _Milliseconds(Milestone::SettingsLoaded),
+                                  _Milliseconds(Milestone::XamlReady),
+                                  _Milliseconds(Milestone::ConnectionStarted),
+                                  _Milliseconds(Milestone::FirstFramePresented),
+                                  _Milliseconds(Milestone::FirstPromptByte));
+
+    WriteFile(conout.get(), text.data(), ::base::saturated_cast<DWORD>(text.size()), nullptr, nullptr);
+}
+CATCH_LOG()
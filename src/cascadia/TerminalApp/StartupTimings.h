@@ -0,0 +1,64 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- StartupTimings.h
+
+Module Description:
+- Records the milestones of a single launch - settings loaded, XAML ready,
+  first connection created, first frame presented, first byte from the
+  client - as timestamps relative to process creation, and reports them all
+  at once when the last one lands. The ad-hoc events we already emit
+  (SettingsLoadComplete, AppCreated, ConnectionCreated) each say when one
+  thing happened in isolation; this stitches the same launch into a single
+  record, so a release-to-release startup regression points at the phase
+  that grew instead of requiring someone to correlate events by hand.
+- Milestones record first-writer-wins, so callers don't need their own
+  "only the first time" latch, and settings reloads or second tabs can't
+  overwrite the launch being measured.
+--*/
+
+#pragma once
+
+namespace TerminalApp
+{
+    class StartupTimings
+    {
+    public:
+        enum class Milestone : size_t
+        {
+            SettingsLoaded = 0,
+            XamlReady,
+            ConnectionStarted,
+            FirstFramePresented,
+            FirstPromptByte,
+
+            Count
+        };
+
+        // Records the given milestone at "now", unless it was already
+        // recorded. When the last outstanding milestone lands, this emits
+        // the summary event (and the console dump, if one was requested).
+        void Note(const Milestone milestone) noexcept;
+
+        bool Recorded(const Milestone milestone) const noexcept;
+
+        // Makes the summary additionally print to the console we were
+        // launched from; this is what `wt --startup-timings` toggles.
+        void EnableConsoleDump() noexcept;
+
+        static StartupTimings& Instance() noexcept;
+
+    private:
+        [[nodiscard]] static uint64_t _MicrosecondsSinceProcessCreation() noexcept;
+        [[nodiscard]] double _Milliseconds(const Milestone milestone) const noexcept;
+        void _Report() noexcept;
+        void _DumpToConsole() const noexcept;
+
+        // Microseconds since process creation; 0 means "not recorded yet".
+        std::array<std::atomic<uint64_t>, static_cast<size_t>(Milestone::Count)> _timestamps{};
+        std::atomic<bool> _reported{ false };
+        std::atomic<bool> _dumpToConsole{ false };
+    };
+}
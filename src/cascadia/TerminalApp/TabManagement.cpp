@@ -485,6 +485,23 @@ namespace winrt::TerminalApp::implementation
 
         const auto focusedTabIndex{ _GetFocusedTabIndex() };
 
+        // If the user closed this tab, remove the buffer snapshots persisted
+        // for its panes, so they don't accumulate on disk. When the whole
+        // window is going down for a session save, _maintainStateOnTabClose is
+        // set and the snapshots are left in place for the restore.
+        if (!_maintainStateOnTabClose)
+        {
+            if (const auto terminalTab{ _GetTerminalTabImpl(tab) })
+            {
+                terminalTab->GetRootPane()->WalkTree([](auto&& pane) {
+                    if (const auto& control{ pane->GetTerminalControl() })
+                    {
+                        ApplicationState::SharedInstance().DeleteBufferSnapshot(control.SessionId());
+                    }
+                });
+            }
+        }
+
         // Removing the tab from the collection should destroy its control and disconnect its connection,
         // but it doesn't always do so. The UI tree may still be holding the control and preventing its destruction.
         tab.Shutdown();
@@ -877,6 +894,20 @@ namespace winrt::TerminalApp::implementation
             tab.Focus(FocusState::Unfocused);
         }
 
+        // During startup, every restored tab passes through here once, as
+        // _InitializeTab selects each tab as it's created. Attaching each of
+        // those tabs to the XAML tree just so the next one can replace it is
+        // wasted work - laying out a TermControl is what spins up its swap
+        // chain and renderer - so while we're still starting up, only do the
+        // focus bookkeeping here. _CompleteInitialization will attach the tab
+        // that's actually selected once all the startup actions are processed.
+        if (_startupState != StartupState::Initialized)
+        {
+            tab.Focus(FocusState::Programmatic);
+            _UpdateMRUTab(tab);
+            return;
+        }
+
         try
         {
             _tabContent.Children().Clear();
@@ -17,6 +17,7 @@
 #include "ColorHelper.h"
 #include "DebugTapConnection.h"
 #include "SettingsTab.h"
+#include "StartupTimings.h"
 #include "TabRowControl.h"
 
 using namespace winrt;
@@ -157,6 +158,13 @@ namespace winrt::TerminalApp::implementation
         _tabView = _tabRow.TabView();
         _rearranging = false;
 
+        // Seed the buffer usage ledger from the last session, so even the
+        // first pane of this one preallocates for its historical footprint.
+        if (const auto bufferStats = ApplicationState::SharedInstance().BufferUsageStats(); !bufferStats.empty())
+        {
+            ControlCore::ImportBufferUsageStats(bufferStats);
+        }
+
         const auto isElevated = IsElevated();
 
         if (_settings.GlobalSettings().UseAcrylicInTabRow())
@@ -662,6 +670,17 @@ namespace winrt::TerminalApp::implementation
     {
         _startupState = StartupState::Initialized;
 
+        // Tabs created during startup skipped attaching their content to the
+        // XAML tree (see _UpdatedSelectedTab), so that restoring a large
+        // layout doesn't build a swap chain for every transiently-selected
+        // tab. Now that the selection has settled, attach the winner. The
+        // background tabs will hydrate through the same path the first time
+        // they're actually selected.
+        if (const auto tab{ _GetFocusedTab() })
+        {
+            _UpdatedSelectedTab(tab);
+        }
+
         // GH#632 - It's possible that the user tried to create the terminal
         // with only one tab, with only an elevated profile. If that happens,
         // we'll create _another_ process to host the elevated version of that
@@ -942,6 +961,11 @@ namespace winrt::TerminalApp::implementation
         // and then closing the fly-out will move the focus to wrong location.
         newTabFlyout.Opening([this](auto&&, auto&&) {
             _FocusCurrentTab(true);
+
+            // The dropdown opening is a strong signal that a new tab is
+            // coming; overlap the likely client's launch with the user's
+            // decision-making.
+            _PrewarmSpeculativeConnection();
         });
         _newTabButton.Flyout(newTabFlyout);
     }
@@ -1138,9 +1162,95 @@ namespace winrt::TerminalApp::implementation
             TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
             TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance));
 
+        auto& timings = StartupTimings::Instance();
+        timings.Note(StartupTimings::Milestone::ConnectionStarted);
+        if (!timings.Recorded(StartupTimings::Milestone::FirstPromptByte))
+        {
+            // The first chunk the client writes - for a shell, its prompt -
+            // ends the launch measurement. Note() ignores repeats, so the
+            // handler can stay attached rather than revoke itself.
+            connection.TerminalOutput([](const hstring&) {
+                StartupTimings::Instance().Note(StartupTimings::Milestone::FirstPromptByte);
+            });
+        }
+
         return connection;
     }
 
+    // Method Description:
+    // - Speculatively spawns the backend for the profile the user is most
+    //   likely to pick next (the default profile), so that expensive client
+    //   startup - a WSL distro's VM boot, the Azure bridge's handshake -
+    //   overlaps with their think-time in the new tab dropdown. If the next
+    //   pane matches, _MakePane adopts the live connection; otherwise a timer
+    //   disposes of it.
+    // - Gated behind "experimental.connection.prewarm", because it runs a
+    //   real client process on nothing more than an intent signal.
+    void TerminalPage::_PrewarmSpeculativeConnection()
+    {
+        if (!_settings || !_settings.GlobalSettings().SpeculativeConnectionPrewarm() || _speculativeConnection)
+        {
+            return;
+        }
+
+        const auto profile = _settings.GetProfileForArgs(nullptr);
+        if (!profile)
+        {
+            return;
+        }
+
+        const auto settingsCreateResult{ TerminalSettings::CreateWithProfile(_settings, profile, *_bindings) };
+        const auto settings = settingsCreateResult.DefaultSettings();
+
+        // Anything that needs elevation can't be spawned on speculation.
+        if (settings.Elevate())
+        {
+            return;
+        }
+
+        const auto connection = _CreateConnectionFromSettings(profile, settings);
+        const auto conpty = connection.try_as<TerminalConnection::ConptyConnection>();
+        if (!conpty)
+        {
+            return;
+        }
+        conpty.Prelaunch();
+
+        _speculativeConnection = connection;
+        _speculativeProfileGuid = profile.Guid();
+        _speculativeCommandline = settings.Commandline();
+        _speculativeStartingDirectory = settings.StartingDirectory();
+
+        if (!_speculativeConnectionTimer)
+        {
+            _speculativeConnectionTimer = winrt::Windows::UI::Xaml::DispatcherTimer{};
+            _speculativeConnectionTimer.Interval(std::chrono::seconds(30));
+            _speculativeConnectionTimer.Tick([weakThis{ get_weak() }](auto&&, auto&&) {
+                if (auto page{ weakThis.get() })
+                {
+                    page->_DiscardSpeculativeConnection();
+                }
+            });
+        }
+        _speculativeConnectionTimer.Start();
+    }
+
+    // Method Description:
+    // - Disposes of a speculative connection nobody adopted. Close() tears
+    //   down the pseudoconsole, which takes the prelaunched client with it.
+    void TerminalPage::_DiscardSpeculativeConnection()
+    {
+        if (_speculativeConnectionTimer)
+        {
+            _speculativeConnectionTimer.Stop();
+        }
+        if (_speculativeConnection)
+        {
+            _speculativeConnection.Close();
+            _speculativeConnection = nullptr;
+        }
+    }
+
     // Method Description:
     // - Called when the settings button is clicked. Launches a background
     //   thread to open the settings file in the default JSON editor.
@@ -1428,6 +1538,16 @@ namespace winrt::TerminalApp::implementation
         term.SetTaskbarProgress({ get_weak(), &TerminalPage::_SetTaskbarProgressHandler });
 
         term.ConnectionStateChanged({ get_weak(), &TerminalPage::_ConnectionStateChangedHandler });
+
+        if (!StartupTimings::Instance().Recorded(StartupTimings::Milestone::FirstFramePresented))
+        {
+            // Initialized fires once the control has attached its swap chain
+            // and enabled painting - the closest thing the app layer sees to
+            // "first frame presented".
+            term.Initialized([](const auto& /*sender*/, const auto& /*args*/) {
+                StartupTimings::Instance().Note(StartupTimings::Milestone::FirstFramePresented);
+            });
+        }
     }
 
     // Method Description:
@@ -1614,8 +1734,26 @@ namespace winrt::TerminalApp::implementation
             auto t = winrt::get_self<implementation::TabBase>(tab);
             auto tabActions = t->BuildStartupActions();
             actions.insert(actions.end(), std::make_move_iterator(tabActions.begin()), std::make_move_iterator(tabActions.end()));
+
+            // Also persist each pane's buffer contents, so that on restore the
+            // pane can show its prior content immediately, while the new
+            // connection starts up underneath. The startup actions carry each
+            // control's session GUID, which ties the pane back to its snapshot.
+            if (const auto terminalTab{ _GetTerminalTabImpl(tab) })
+            {
+                terminalTab->GetRootPane()->WalkTree([](auto&& pane) {
+                    if (const auto& control{ pane->GetTerminalControl() })
+                    {
+                        ApplicationState::SharedInstance().WriteBufferSnapshot(control.SessionId(), control.ReadEntireBuffer());
+                    }
+                });
+            }
         }
 
+        // Also persist the buffer usage ledger, so the next launch can
+        // preallocate buffers for the footprints this session reached.
+        ApplicationState::SharedInstance().BufferUsageStats(ControlCore::ExportBufferUsageStats());
+
         // if the focused tab was not the last tab, restore that
         auto idx = _GetFocusedTabIndex();
         if (idx && idx != _tabs.Size() - 1)
@@ -1691,7 +1829,15 @@ namespace winrt::TerminalApp::implementation
             _maintainStateOnTabClose = true;
         }
 
+        // Don't let a pending speculative connection outlive the window.
+        _DiscardSpeculativeConnection();
+
         _RemoveAllTabs();
+
+        // Save the buffer usage ledger even when layout persistence is off -
+        // it's how the next launch knows what to preallocate. After the tabs,
+        // so the ledger includes what their buffers just recorded.
+        ApplicationState::SharedInstance().BufferUsageStats(ControlCore::ExportBufferUsageStats());
     }
 
     // Method Description:
@@ -2478,6 +2624,25 @@ namespace winrt::TerminalApp::implementation
             return nullptr;
         }
 
+        // If a speculative connection is waiting and this pane matches what it
+        // was spawned for, adopt it: the client got a head start on launching
+        // while the user was still deciding.
+        if (!existingConnection && !duplicate && _speculativeConnection)
+        {
+            const auto defaults = controlSettings.DefaultSettings();
+            if (profile.Guid() == _speculativeProfileGuid &&
+                defaults.Commandline() == _speculativeCommandline &&
+                defaults.StartingDirectory() == _speculativeStartingDirectory)
+            {
+                existingConnection = _speculativeConnection;
+                _speculativeConnection = nullptr;
+                if (_speculativeConnectionTimer)
+                {
+                    _speculativeConnectionTimer.Stop();
+                }
+            }
+        }
+
         auto connection = existingConnection ? existingConnection : _CreateConnectionFromSettings(profile, controlSettings.DefaultSettings());
         if (existingConnection)
         {
@@ -2501,6 +2666,24 @@ namespace winrt::TerminalApp::implementation
         const auto control = _InitControl(controlSettings, connection);
         _RegisterTerminalEvents(control);
 
+        // If these args came from a persisted window layout, they'll name a
+        // buffer snapshot that a previous session saved for this pane. Hand it
+        // to the control now, so it can replay it when it initializes. Only do
+        // this during startup - GetTerminalArgsForPane also stamps the session
+        // GUID into args used for duplicating panes, and a duplicate shouldn't
+        // resurrect the original's old contents.
+        if (_startupState != StartupState::Initialized && newTerminalArgs)
+        {
+            if (const auto sessionId = newTerminalArgs.SessionId(); sessionId != winrt::guid{})
+            {
+                const auto snapshot = ApplicationState::SharedInstance().ReadBufferSnapshot(sessionId);
+                if (!snapshot.empty())
+                {
+                    control.RestorePersistedBuffer(sessionId, snapshot);
+                }
+            }
+        }
+
         auto resultPane = std::make_shared<Pane>(profile, control);
 
         if (debugConnection) // this will only be set if global debugging is on and tap is active
@@ -2536,6 +2719,10 @@ namespace winrt::TerminalApp::implementation
         // new AppKeyBindings object.
         _HookupKeyBindings(_settings.ActionMap());
 
+        // A speculative connection was spawned from the old settings; the
+        // profile it was built for may have changed or vanished.
+        _DiscardSpeculativeConnection();
+
         // Refresh UI elements
 
         // Mapping by GUID isn't _excellent_ because the defaults profile doesn't have a stable GUID; however,
@@ -3712,8 +3899,16 @@ namespace winrt::TerminalApp::implementation
         exePath.replace_filename(L"elevate-shim.exe");
 
         // Build the commandline to pass to wt for this set of NewTerminalArgs
+        //
+        // We direct the request at a single named window, "elevated". The
+        // first request stands up an elevated instance that registers under
+        // that name; every subsequent request just gloms a new tab into it
+        // through the (elevated) Monarch and exits before ever building a
+        // window. That keeps one UAC-approved instance alive as the host for
+        // all our elevated tabs, instead of paying full instance startup for
+        // each one.
         std::wstring cmdline{
-            fmt::format(L"new-tab {}", newTerminalArgs.ToCommandline().c_str())
+            fmt::format(L"-w elevated new-tab {}", newTerminalArgs.ToCommandline().c_str())
         };
 
         wil::unique_process_information pi;
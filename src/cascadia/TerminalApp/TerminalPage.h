@@ -215,6 +215,14 @@ namespace winrt::TerminalApp::implementation
         std::shared_ptr<Toast> _windowIdToast{ nullptr };
         std::shared_ptr<Toast> _windowRenameFailedToast{ nullptr };
 
+        // A connection whose client was launched speculatively when the new
+        // tab dropdown opened, waiting to be adopted by a matching pane.
+        winrt::Microsoft::Terminal::TerminalConnection::ITerminalConnection _speculativeConnection{ nullptr };
+        winrt::guid _speculativeProfileGuid{};
+        winrt::hstring _speculativeCommandline;
+        winrt::hstring _speculativeStartingDirectory;
+        winrt::Windows::UI::Xaml::DispatcherTimer _speculativeConnectionTimer{ nullptr };
+
         winrt::Windows::UI::Xaml::Controls::TextBox::LayoutUpdated_revoker _renamerLayoutUpdatedRevoker;
         int _renamerLayoutCount{ 0 };
         bool _renamerPressedEnter{ false };
@@ -233,6 +241,8 @@ namespace winrt::TerminalApp::implementation
         HRESULT _OpenNewTab(const Microsoft::Terminal::Settings::Model::NewTerminalArgs& newTerminalArgs, winrt::Microsoft::Terminal::TerminalConnection::ITerminalConnection existingConnection = nullptr);
         void _CreateNewTabFromPane(std::shared_ptr<Pane> pane);
         winrt::Microsoft::Terminal::TerminalConnection::ITerminalConnection _CreateConnectionFromSettings(Microsoft::Terminal::Settings::Model::Profile profile, Microsoft::Terminal::Settings::Model::TerminalSettings settings);
+        void _PrewarmSpeculativeConnection();
+        void _DiscardSpeculativeConnection();
 
         winrt::fire_and_forget _OpenNewWindow(const Microsoft::Terminal::Settings::Model::NewTerminalArgs newTerminalArgs);
 
@@ -183,12 +183,23 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
 
         if (_state == AzureState::TermConnected)
         {
-            // If we're connected, we don't need to do any fun input shenanigans.
-            websocket_outgoing_message msg;
-            const auto str = winrt::to_string(data);
-            msg.set_utf8_message(str);
-
-            _cloudShellSocket.send(msg).get();
+            // If we're connected, we don't need to do any fun input
+            // shenanigans - but we don't send each keystroke as its own
+            // message either. Everything that arrives while a send is on the
+            // wire is coalesced into the next message, and the send happens
+            // asynchronously so we never block the caller on a round-trip to
+            // the cloud shell.
+            {
+                std::lock_guard<std::mutex> lock{ _sendMutex };
+                _pendingSendBuffer.append(winrt::to_string(data));
+                if (_sendInFlight)
+                {
+                    // The in-flight send's continuation will pick this up.
+                    return;
+                }
+                _sendInFlight = true;
+            }
+            _SendPendingInput();
             return;
         }
 
@@ -223,6 +234,46 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         }
     }
 
+    // Method description:
+    // - Sends everything queued in _pendingSendBuffer as one websocket
+    //   message, then chains itself until the buffer drains. Only ever
+    //   entered with _sendInFlight set (by WriteInput, or by our own
+    //   continuation).
+    void AzureConnection::_SendPendingInput()
+    {
+        std::string chunk;
+        {
+            std::lock_guard<std::mutex> lock{ _sendMutex };
+            if (_pendingSendBuffer.empty() || _isStateAtOrBeyond(ConnectionState::Closing))
+            {
+                _sendInFlight = false;
+                return;
+            }
+            chunk.swap(_pendingSendBuffer);
+        }
+
+        websocket_outgoing_message msg;
+        msg.set_utf8_message(std::move(chunk));
+
+        _cloudShellSocket.send(msg).then([strongThis = get_strong()](pplx::task<void> sendTask) {
+            try
+            {
+                sendTask.get();
+            }
+            catch (...)
+            {
+                // The socket's probably been closed out from under us;
+                // anything still queued is going nowhere.
+                LOG_CAUGHT_EXCEPTION();
+                std::lock_guard<std::mutex> lock{ strongThis->_sendMutex };
+                strongThis->_pendingSendBuffer.clear();
+                strongThis->_sendInFlight = false;
+                return;
+            }
+            strongThis->_SendPendingInput();
+        });
+    }
+
     // Method description:
     // - ascribes to the ITerminalConnection interface
     // - resizes the terminal
@@ -382,14 +433,41 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
                 case AzureState::TermConnected:
                 {
                     _transitionToState(ConnectionState::Connected);
+
+                    // Bursty cloud shell output arrives as a storm of tiny
+                    // websocket messages. We fold everything that's already
+                    // arrived into one batch, convert it once, and fire one
+                    // event, instead of paying an allocation, a conversion and
+                    // an event per message. The cap keeps a fire hose from
+                    // starving the terminal of the batches we've collected.
+                    constexpr size_t ReceiveBatchLimit = 128 * 1024;
+
+                    auto receiveTask = _cloudShellSocket.receive();
                     while (true)
                     {
-                        // Read from websocket
-                        pplx::task<websocket_incoming_message> msgT;
+                        // Per-thread scratch buffers: cleared, but their
+                        // capacity survives between batches.
+                        auto& utf8Buffer{ til::scratch_buffer<std::string>::get() };
+                        auto& wideBuffer{ til::scratch_buffer<std::wstring>::get() };
                         try
                         {
-                            msgT = _cloudShellSocket.receive();
-                            msgT.wait();
+                            // Block for the first message of the batch...
+                            receiveTask.wait();
+                            utf8Buffer.append(receiveTask.get().extract_string().get());
+
+                            // ...then opportunistically drain whatever else
+                            // has already landed.
+                            while (true)
+                            {
+                                receiveTask = _cloudShellSocket.receive();
+                                if (!receiveTask.is_done() || utf8Buffer.size() >= ReceiveBatchLimit)
+                                {
+                                    // Deliver what we have; receiveTask stays
+                                    // primed for the next batch.
+                                    break;
+                                }
+                                utf8Buffer.append(receiveTask.get().extract_string().get());
+                            }
                         }
                         catch (...)
                         {
@@ -400,17 +478,16 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
                                 // End the output thread.
                                 return S_FALSE;
                             }
+                            // We didn't accept the transition - let the outer
+                            // handler deal with it (as it always has).
+                            throw;
                         }
 
-                        auto msg = msgT.get();
-                        auto msgStringTask = msg.extract_string();
-                        auto msgString = msgStringTask.get();
-
-                        // Convert to hstring
-                        const auto hstr = winrt::to_hstring(msgString);
+                        // One conversion per batch, into a reused buffer.
+                        THROW_IF_FAILED(til::u8u16(utf8Buffer, wideBuffer));
 
                         // Pass the output to our registered event handlers
-                        _TerminalOutputHandlers(hstr);
+                        _TerminalOutputHandlers(wideBuffer);
                     }
                     return S_OK;
                 }
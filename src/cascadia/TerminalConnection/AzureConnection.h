@@ -95,6 +95,15 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
 
         std::optional<std::wstring> _ReadUserInput(InputMode mode);
 
+        // Outbound keystrokes are coalesced here while a websocket send is in
+        // flight, so a fast typist (or a paste) costs one message per
+        // round-trip instead of one message per character.
+        std::mutex _sendMutex;
+        std::string _pendingSendBuffer;
+        bool _sendInFlight{ false };
+
+        void _SendPendingInput();
+
         web::websockets::client::websocket_client _cloudShellSocket;
 
         static std::optional<utility::string_t> _ParsePreferredShellType(const web::json::value& settingsResponse);
@@ -93,11 +93,14 @@ static HRESULT _duplicateHandle(const HANDLE in, HANDLE& out) noexcept
 // - ref - Client reference handle for console session so it stays alive until we let go
 // - server - PTY process handle to track for lifetime/cleanup
 // - client - Process handle to client so we can track its lifetime and exit appropriately
+// - outputRing - Optional section backing a shared memory ring for the output stream
+// - ringDataReady - Optional event the console pulses when it puts bytes in the ring
+// - ringSpaceFree - Optional event we pulse when we drain bytes from the ring
 // Return Value:
 // - E_NOT_VALID_STATE if a event handler is not registered before calling. `::DuplicateHandle`
 //   error codes if we cannot manage to make our own copy of handles to retain. Or S_OK/error
 //   from the registered handler event function.
-HRESULT CTerminalHandoff::EstablishPtyHandoff(HANDLE in, HANDLE out, HANDLE signal, HANDLE ref, HANDLE server, HANDLE client)
+static HRESULT _establishPtyHandoff(HANDLE in, HANDLE out, HANDLE signal, HANDLE ref, HANDLE server, HANDLE client, HANDLE outputRing, HANDLE ringDataReady, HANDLE ringSpaceFree)
 {
     try
     {
@@ -124,8 +127,17 @@ HRESULT CTerminalHandoff::EstablishPtyHandoff(HANDLE in, HANDLE out, HANDLE sign
         THROW_IF_FAILED(_duplicateHandle(server, server));
         THROW_IF_FAILED(_duplicateHandle(client, client));
 
+        // The ring handles only exist when the console offered the shared
+        // memory output transport.
+        if (outputRing)
+        {
+            THROW_IF_FAILED(_duplicateHandle(outputRing, outputRing));
+            THROW_IF_FAILED(_duplicateHandle(ringDataReady, ringDataReady));
+            THROW_IF_FAILED(_duplicateHandle(ringSpaceFree, ringSpaceFree));
+        }
+
         // Call registered handler from when we started listening.
-        THROW_IF_FAILED(localPfnHandoff(in, out, signal, ref, server, client));
+        THROW_IF_FAILED(localPfnHandoff(in, out, signal, ref, server, client, outputRing, ringDataReady, ringSpaceFree));
 
 #pragma warning(suppress : 26477)
         TraceLoggingWrite(
@@ -153,3 +165,17 @@ HRESULT CTerminalHandoff::EstablishPtyHandoff(HANDLE in, HANDLE out, HANDLE sign
         return hr;
     }
 }
+
+HRESULT CTerminalHandoff::EstablishPtyHandoff(HANDLE in, HANDLE out, HANDLE signal, HANDLE ref, HANDLE server, HANDLE client)
+{
+    return _establishPtyHandoff(in, out, signal, ref, server, client, nullptr, nullptr, nullptr);
+}
+
+HRESULT CTerminalHandoff::EstablishPtyHandoff2(HANDLE in, HANDLE out, HANDLE signal, HANDLE ref, HANDLE server, HANDLE client, HANDLE outputRing, HANDLE ringDataReady, HANDLE ringSpaceFree, HANDLE* terminalProcess)
+{
+    // The marshaller duplicates the pseudo handle into a real one on the
+    // console's side; it watches us so a terminal crash breaks the output
+    // ring the way it would have broken the output pipe.
+    *terminalProcess = GetCurrentProcess();
+    return _establishPtyHandoff(in, out, signal, ref, server, client, outputRing, ringDataReady, ringSpaceFree);
+}
@@ -26,10 +26,12 @@ Author(s):
 #define __CLSID_CTerminalHandoff "051F34EE-C1FD-4B19-AF75-9BA54648434C"
 #endif
 
-using NewHandoffFunction = HRESULT (*)(HANDLE, HANDLE, HANDLE, HANDLE, HANDLE, HANDLE);
+// The ring handles trail the original six and are nullptr when the console
+// didn't offer a shared memory output ring (or we couldn't attach to it).
+using NewHandoffFunction = HRESULT (*)(HANDLE, HANDLE, HANDLE, HANDLE, HANDLE, HANDLE, HANDLE, HANDLE, HANDLE);
 
 struct __declspec(uuid(__CLSID_CTerminalHandoff))
-    CTerminalHandoff : public Microsoft::WRL::RuntimeClass<Microsoft::WRL::RuntimeClassFlags<Microsoft::WRL::RuntimeClassType::ClassicCom>, ITerminalHandoff>
+    CTerminalHandoff : public Microsoft::WRL::RuntimeClass<Microsoft::WRL::RuntimeClassFlags<Microsoft::WRL::RuntimeClassType::ClassicCom>, ITerminalHandoff, ITerminalHandoff2>
 {
 #pragma region ITerminalHandoff
     STDMETHODIMP EstablishPtyHandoff(HANDLE in,
@@ -39,6 +41,20 @@ struct __declspec(uuid(__CLSID_CTerminalHandoff))
                                      HANDLE server,
                                      HANDLE client) override;
 
+#pragma endregion
+
+#pragma region ITerminalHandoff2
+    STDMETHODIMP EstablishPtyHandoff2(HANDLE in,
+                                      HANDLE out,
+                                      HANDLE signal,
+                                      HANDLE ref,
+                                      HANDLE server,
+                                      HANDLE client,
+                                      HANDLE outputRing,
+                                      HANDLE ringDataReady,
+                                      HANDLE ringSpaceFree,
+                                      HANDLE* terminalProcess) override;
+
 #pragma endregion
 
     static HRESULT s_StartListening(NewHandoffFunction pfnHandoff);
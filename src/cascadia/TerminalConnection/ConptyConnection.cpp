@@ -52,14 +52,64 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         wil::unique_hfile outPipeOurSide, outPipePseudoConsoleSide;
         wil::unique_hfile inPipeOurSide, inPipePseudoConsoleSide;
 
+        // The initial pipe buffer size is just a suggestion to the system and
+        // the default (4KiB) is fairly small. A client that writes output
+        // faster than we drain it fills the pipe and blocks on every write
+        // until we've made room, so give the output pipe a generous buffer to
+        // keep fast producers streaming instead of ping-ponging with us.
+        constexpr DWORD PipeBufferSize = 128 * 1024;
         RETURN_IF_WIN32_BOOL_FALSE(CreatePipe(&inPipePseudoConsoleSide, &inPipeOurSide, nullptr, 0));
-        RETURN_IF_WIN32_BOOL_FALSE(CreatePipe(&outPipeOurSide, &outPipePseudoConsoleSide, nullptr, 0));
+        RETURN_IF_WIN32_BOOL_FALSE(CreatePipe(&outPipeOurSide, &outPipePseudoConsoleSide, nullptr, PipeBufferSize));
         RETURN_IF_FAILED(ConptyCreatePseudoConsole(size, inPipePseudoConsoleSide.get(), outPipePseudoConsoleSide.get(), dwFlags, phPC));
         *phInput = inPipeOurSide.release();
         *phOutput = outPipeOurSide.release();
         return S_OK;
     }
 
+    // Function Description:
+    // - Copies the inherited (process) environment into the given map. Parsing
+    //   the environment block into a case-insensitively sorted map costs an
+    //   allocation and a comparison per entry, and every pane launch used to
+    //   pay it again for an environment that essentially never changes - so we
+    //   parse once and hand out copies. The per-connection variables
+    //   (WT_SESSION and friends) are layered onto the copy by the caller, so
+    //   they never pollute the cache.
+    // - The cache holds no secrets the process environment itself doesn't: it
+    //   mirrors our own environment block verbatim, and is invalidated by a
+    //   hash of that block whenever something changes it under us.
+    static HRESULT _copyInheritedEnvironment(Utils::EnvironmentVariableMapW& environment) noexcept
+    try
+    {
+        static std::mutex cacheMutex;
+        static Utils::EnvironmentVariableMapW cachedEnvironment;
+        static size_t cachedHash{ 0 };
+
+        const wil::unique_environstrings_ptr block{ ::GetEnvironmentStringsW() };
+        RETURN_HR_IF_NULL(E_OUTOFMEMORY, block.get());
+
+        // Measure the block (up to, but not including, the final terminator of
+        // the last entry) and hash it in one go.
+        const auto* p = block.get();
+        size_t cch{ 0 };
+        while (p[cch] != L'\0' || p[cch + 1] != L'\0')
+        {
+            ++cch;
+        }
+        const auto hash = std::hash<std::wstring_view>{}(std::wstring_view{ p, cch });
+
+        std::lock_guard guard{ cacheMutex };
+        if (cachedEnvironment.empty() || hash != cachedHash)
+        {
+            cachedEnvironment.clear();
+            RETURN_IF_FAILED(Utils::UpdateEnvironmentMapW(cachedEnvironment));
+            cachedHash = hash;
+        }
+
+        environment = cachedEnvironment;
+        return S_OK;
+    }
+    CATCH_RETURN();
+
     // Function Description:
     // - launches the client application attached to the new pseudoconsole
     HRESULT ConptyConnection::_LaunchAttachedClient() noexcept
@@ -98,8 +148,9 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
             environment.clear();
         });
 
-        // Populate the environment map with the current environment.
-        RETURN_IF_FAILED(Utils::UpdateEnvironmentMapW(environment));
+        // Populate the environment map with the current environment, via the
+        // shared cache of the parsed block.
+        RETURN_IF_FAILED(_copyInheritedEnvironment(environment));
 
         {
             // Convert connection Guid to string and ignore the enclosing '{}'.
@@ -203,13 +254,27 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
                                        const HANDLE hOut,
                                        const HANDLE hRef,
                                        const HANDLE hServerProcess,
-                                       const HANDLE hClientProcess) :
+                                       const HANDLE hClientProcess,
+                                       const HANDLE hOutputRing,
+                                       const HANDLE hRingDataReady,
+                                       const HANDLE hRingSpaceFree) :
         _initialRows{ 25 },
         _initialCols{ 80 },
         _guid{ Utils::CreateGuid() },
         _inPipe{ hIn },
         _outPipe{ hOut }
     {
+        if (hOutputRing)
+        {
+            // Attach takes ownership of the handles either way. Once the
+            // handoff call returns successfully the console commits its
+            // output to the ring, so if we can't map it the whole handoff
+            // has to fail rather than leave us reading a pipe nobody
+            // writes to.
+            THROW_IF_FAILED(::Microsoft::Console::ConptyRing::s_Attach(hOutputRing, hRingDataReady, hRingSpaceFree, _outputRing));
+            _outputRing->SetPeerProcess(hServerProcess);
+        }
+
         THROW_IF_FAILED(ConptyPackPseudoConsole(hServerProcess, hRef, hSig, &_hPC));
         _piClient.hProcess = hClientProcess;
 
@@ -288,6 +353,53 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         return _commandline;
     }
 
+    // Method Description:
+    // - Speculatively creates the pseudoconsole and spawns the client, without
+    //   attaching anything to the output side or transitioning our state.
+    //   Start() recognizes the already-populated pipes - the same way it
+    //   recognizes a received defterm handoff - and completes the wiring;
+    //   until then the client's first output waits in the output pipe's
+    //   buffer, so nothing is lost.
+    // - This lets expensive client startup (a WSL distro's VM boot, the Azure
+    //   bridge's OAuth handshake) overlap with the user deciding whether they
+    //   actually want the tab. A prelaunched connection that's never adopted
+    //   is disposed of with a regular Close().
+    void ConptyConnection::Prelaunch()
+    try
+    {
+        if (_inPipe || _isStateAtOrBeyond(ConnectionState::Connecting))
+        {
+            return;
+        }
+
+        const COORD dimensions{ gsl::narrow_cast<SHORT>(_initialCols), gsl::narrow_cast<SHORT>(_initialRows) };
+
+        DWORD flags = PSEUDOCONSOLE_RESIZE_QUIRK | PSEUDOCONSOLE_WIN32_INPUT_MODE | PSEUDOCONSOLE_GLYPH_WIDTH_HINTS;
+        if constexpr (Feature_VtPassthroughMode::IsEnabled())
+        {
+            if (_passthroughMode)
+            {
+                WI_SetFlag(flags, PSEUDOCONSOLE_PASSTHROUGH_MODE);
+            }
+        }
+
+        THROW_IF_FAILED(_CreatePseudoConsoleAndPipes(dimensions, flags, &_inPipe, &_outPipe, &_hPC));
+        THROW_IF_FAILED(_LaunchAttachedClient());
+
+        _prelaunchTime = std::chrono::high_resolution_clock::now();
+        _prelaunched = true;
+    }
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION();
+
+        // Roll back, so that a later Start() takes the fresh-connection path
+        // and surfaces any persistent failure through its own error reporting.
+        _hPC.reset();
+        _inPipe.reset();
+        _outPipe.reset();
+    }
+
     void ConptyConnection::Start()
     try
     {
@@ -299,7 +411,7 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         // handoff from an already-started PTY process.
         if (!_inPipe)
         {
-            DWORD flags = PSEUDOCONSOLE_RESIZE_QUIRK | PSEUDOCONSOLE_WIN32_INPUT_MODE;
+            DWORD flags = PSEUDOCONSOLE_RESIZE_QUIRK | PSEUDOCONSOLE_WIN32_INPUT_MODE | PSEUDOCONSOLE_GLYPH_WIDTH_HINTS;
 
             if constexpr (Feature_VtPassthroughMode::IsEnabled())
             {
@@ -318,19 +430,36 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
 
             THROW_IF_FAILED(_LaunchAttachedClient());
         }
-        // But if it was an inbound handoff... attempt to synchronize the size of it with what our connection
+        // But if it was an inbound handoff or a speculative prelaunch...
+        // attempt to synchronize the size of it with what our connection
         // window is expecting it to be on the first layout.
         else
         {
+            if (_prelaunched)
+            {
+                const auto headStart = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - _prelaunchTime).count();
+#pragma warning(suppress : 26477 26485 26494 26482 26446) // We don't control TraceLoggingWrite
+                TraceLoggingWrite(
+                    g_hTerminalConnectionProvider,
+                    "ConPtyPrelaunchAdopted",
+                    TraceLoggingDescription("Event emitted when a speculatively prelaunched client is adopted by a pane"),
+                    TraceLoggingGuid(_guid, "SessionGuid", "The WT_SESSION's GUID"),
+                    TraceLoggingInt64(headStart, "HeadStartInMs", "How long the client had already been running when the pane adopted it"),
+                    TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
+                    TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance));
+            }
+            else
+            {
 #pragma warning(suppress : 26477 26485 26494 26482 26446) // We don't control TraceLoggingWrite
-            TraceLoggingWrite(
-                g_hTerminalConnectionProvider,
-                "ConPtyConnectedToDefterm",
-                TraceLoggingDescription("Event emitted when ConPTY connection is started, for a defterm session"),
-                TraceLoggingGuid(_guid, "SessionGuid", "The WT_SESSION's GUID"),
-                TraceLoggingWideString(_clientName.c_str(), "Client", "The attached client process"),
-                TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
-                TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance));
+                TraceLoggingWrite(
+                    g_hTerminalConnectionProvider,
+                    "ConPtyConnectedToDefterm",
+                    TraceLoggingDescription("Event emitted when ConPTY connection is started, for a defterm session"),
+                    TraceLoggingGuid(_guid, "SessionGuid", "The WT_SESSION's GUID"),
+                    TraceLoggingWideString(_clientName.c_str(), "Client", "The attached client process"),
+                    TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
+                    TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance));
+            }
 
             THROW_IF_FAILED(ConptyResizePseudoConsole(_hPC.get(), dimensions));
             THROW_IF_FAILED(ConptyReparentPseudoConsole(_hPC.get(), reinterpret_cast<HWND>(_initialParentHwnd)));
@@ -338,6 +467,10 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
 
         _startTime = std::chrono::high_resolution_clock::now();
 
+        // If capture was requested, open this connection's file before the
+        // output thread starts so no early bytes are missed.
+        _capture = ::Microsoft::Console::ConptyCapture::TryCreateFromEnvironment();
+
         // Create our own output handling thread
         // This must be done after the pipes are populated.
         // Each connection needs to make sure to drain the output from its backing host.
@@ -458,9 +591,18 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         }
 
         // convert from UTF-16LE to UTF-8 as ConPty expects UTF-8
-        // TODO GH#3378 reconcile and unify UTF-8 converters
-        std::string str = winrt::to_string(data);
-        LOG_IF_WIN32_BOOL_FALSE(WriteFile(_inPipe.get(), str.c_str(), (DWORD)str.length(), nullptr, nullptr));
+        // The conversion target is the per-thread scratch buffer, so steady
+        // keyboard input stops allocating a fresh string per keystroke.
+        auto& u8Str{ til::scratch_buffer<std::string>::get() };
+        if (FAILED_LOG(til::u16u8(data, u8Str)))
+        {
+            return;
+        }
+        if (_capture)
+        {
+            _capture->Record(::Microsoft::Console::ConptyCapture::Direction::Input, u8Str.data(), u8Str.size());
+        }
+        LOG_IF_WIN32_BOOL_FALSE(WriteFile(_inPipe.get(), u8Str.data(), gsl::narrow_cast<DWORD>(u8Str.size()), nullptr, nullptr));
     }
 
     void ConptyConnection::Resize(uint32_t rows, uint32_t columns)
@@ -518,6 +660,14 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
             _inPipe.reset(); // break the pipes
             _outPipe.reset();
 
+            if (_outputRing)
+            {
+                // Hang up our side of the ring; this wakes the output thread
+                // if it's blocked waiting for data, and fails the console's
+                // next ring write like a broken pipe.
+                _outputRing->Close();
+            }
+
             if (_hOutputThread)
             {
                 // Tear down our output thread -- now that the output pipe was closed on the
@@ -579,9 +729,24 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         // process the data of the output pipe in a loop
         while (true)
         {
+            // The conversion target comes from the shared per-thread scratch
+            // pool: cleared, but holding onto its capacity between chunks.
+            auto& u16Str{ til::scratch_buffer<std::wstring>::get() };
+
             DWORD read{};
 
-            const auto readFail{ !ReadFile(_outPipe.get(), _buffer.data(), gsl::narrow_cast<DWORD>(_buffer.size()), &read, nullptr) };
+            auto readFail{ false };
+            if (_outputRing)
+            {
+                // Ring reads don't fail; the console hanging up surfaces as
+                // a successful zero-byte read, which lands on the same EOF
+                // path a broken pipe would below.
+                LOG_IF_FAILED(_outputRing->Read(_buffer.data(), gsl::narrow_cast<DWORD>(_buffer.size()), &read));
+            }
+            else
+            {
+                readFail = !ReadFile(_outPipe.get(), _buffer.data(), gsl::narrow_cast<DWORD>(_buffer.size()), &read, nullptr);
+            }
             if (readFail) // reading failed (we must check this first, because read will also be 0.)
             {
                 const auto lastError = GetLastError();
@@ -595,7 +760,13 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
                 // else we call convertUTF8ChunkToUTF16 with an empty string_view to convert possible remaining partials to U+FFFD
             }
 
-            const HRESULT result{ til::u8u16(std::string_view{ _buffer.data(), read }, _u16Str, _u8State) };
+            if (_capture && read > 0)
+            {
+                // Record the raw UTF-8 bytes off the wire, before conversion.
+                _capture->Record(::Microsoft::Console::ConptyCapture::Direction::Output, _buffer.data(), read);
+            }
+
+            const HRESULT result{ til::u8u16(std::string_view{ _buffer.data(), read }, u16Str, _u8State) };
             if (FAILED(result))
             {
                 if (_isStateAtOrBeyond(ConnectionState::Closing))
@@ -610,7 +781,7 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
                 return gsl::narrow_cast<DWORD>(result);
             }
 
-            if (_u16Str.empty())
+            if (u16Str.empty())
             {
                 return 0;
             }
@@ -631,8 +802,14 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
                 _receivedFirstByte = true;
             }
 
-            // Pass the output to our registered event handlers
-            _TerminalOutputHandlers(_u16Str);
+            // Pass the output to our registered event handlers.
+            // Hand over the std::wstring itself, not an hstring made from it:
+            // the delegate's consume signature takes winrt::param::hstring, so
+            // this binds a stack-based fast-pass string reference over our
+            // reused conversion buffer. Bulk output reaches the handlers
+            // without allocating or copying, as long as nobody duplicates the
+            // string on the receiving side.
+            _TerminalOutputHandlers(u16Str);
         }
 
         return 0;
@@ -643,10 +820,10 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
     winrt::event_token ConptyConnection::NewConnection(NewConnectionHandler const& handler) { return _newConnectionHandlers.add(handler); };
     void ConptyConnection::NewConnection(winrt::event_token const& token) { _newConnectionHandlers.remove(token); };
 
-    HRESULT ConptyConnection::NewHandoff(HANDLE in, HANDLE out, HANDLE signal, HANDLE ref, HANDLE server, HANDLE client) noexcept
+    HRESULT ConptyConnection::NewHandoff(HANDLE in, HANDLE out, HANDLE signal, HANDLE ref, HANDLE server, HANDLE client, HANDLE outputRing, HANDLE ringDataReady, HANDLE ringSpaceFree) noexcept
     try
     {
-        _newConnectionHandlers(winrt::make<ConptyConnection>(signal, in, out, ref, server, client));
+        _newConnectionHandlers(winrt::make<ConptyConnection>(signal, in, out, ref, server, client, outputRing, ringDataReady, ringSpaceFree));
 
         return S_OK;
     }
@@ -8,6 +8,9 @@
 
 #include <conpty-static.h>
 
+#include "../../inc/ConptyCapture.h"
+#include "../../inc/ConptyRing.h"
+
 namespace wil
 {
     // These belong in WIL upstream, so when we reingest the change that has them we'll get rid of ours.
@@ -23,13 +26,17 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
                          const HANDLE hOut,
                          const HANDLE hRef,
                          const HANDLE hServerProcess,
-                         const HANDLE hClientProcess);
+                         const HANDLE hClientProcess,
+                         const HANDLE hOutputRing,
+                         const HANDLE hRingDataReady,
+                         const HANDLE hRingSpaceFree);
 
         ConptyConnection() noexcept = default;
         void Initialize(const Windows::Foundation::Collections::ValueSet& settings);
 
         static winrt::fire_and_forget final_release(std::unique_ptr<ConptyConnection> connection);
 
+        void Prelaunch();
         void Start();
         void WriteInput(hstring const& data);
         void Resize(uint32_t rows, uint32_t columns);
@@ -57,7 +64,7 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         WINRT_CALLBACK(TerminalOutput, TerminalOutputHandler);
 
     private:
-        static HRESULT NewHandoff(HANDLE in, HANDLE out, HANDLE signal, HANDLE ref, HANDLE server, HANDLE client) noexcept;
+        static HRESULT NewHandoff(HANDLE in, HANDLE out, HANDLE signal, HANDLE ref, HANDLE server, HANDLE client, HANDLE outputRing, HANDLE ringDataReady, HANDLE ringSpaceFree) noexcept;
         static winrt::hstring _commandlineFromProcess(HANDLE process);
 
         HRESULT _LaunchAttachedClient() noexcept;
@@ -77,16 +84,30 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         bool _receivedFirstByte{ false };
         std::chrono::high_resolution_clock::time_point _startTime{};
 
+        // Set when Prelaunch() spawned the client speculatively, before
+        // Start(); _prelaunchTime records when, for adoption telemetry.
+        bool _prelaunched{ false };
+        std::chrono::high_resolution_clock::time_point _prelaunchTime{};
+
         wil::unique_hfile _inPipe; // The pipe for writing input to
         wil::unique_hfile _outPipe; // The pipe for reading output from
+        // When the console offered the shared memory output transport at
+        // handoff and we attached to it, output is read from here and the
+        // output pipe stays idle (but open, in case the console falls back).
+        std::unique_ptr<::Microsoft::Console::ConptyRing> _outputRing;
+        // Set when CONPTY_CAPTURE_DIR is in the environment: records this
+        // connection's raw byte stream (both directions) for later replay.
+        std::unique_ptr<::Microsoft::Console::ConptyCapture> _capture;
         wil::unique_handle _hOutputThread;
         wil::unique_process_information _piClient;
         wil::unique_static_pseudoconsole_handle _hPC;
         wil::unique_threadpool_wait _clientExitWait;
 
         til::u8state _u8State{};
-        std::wstring _u16Str{};
-        std::array<char, 4096> _buffer{};
+        // Sized to match the buffer we request for the conpty output pipe, so
+        // a single read can drain everything conhost managed to write while we
+        // were busy handing the previous chunk to the terminal.
+        std::array<char, 128 * 1024> _buffer{};
         bool _passthroughMode{};
 
         DWORD _OutputThread();
@@ -3,7 +3,6 @@
 
 #include "pch.h"
 #include "EchoConnection.h"
-#include <sstream>
 
 #include "EchoConnection.g.cpp"
 
@@ -13,36 +12,208 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
     {
     }
 
-    void EchoConnection::Start() noexcept
+    // Method Description:
+    // - Reads the benchmark configuration, if any, out of the settings set.
+    //   Without a "benchmark" entry we stay a plain input echo, which is what
+    //   every existing caller gets.
+    // Arguments:
+    // - settings: A ValueSet with optional keys:
+    //   - "benchmark": one of "plain", "sgr", "scroll", "tui" selecting the
+    //     synthetic output pattern to generate.
+    //   - "benchmarkKibPerSecond": the target output rate, in KiB of UTF-16
+    //     text per second. Defaults to 1024.
+    void EchoConnection::Initialize(const Windows::Foundation::Collections::ValueSet& settings)
     {
+        if (settings)
+        {
+            const auto pattern = winrt::unbox_value_or<winrt::hstring>(settings.TryLookup(L"benchmark").try_as<Windows::Foundation::IPropertyValue>(), L"");
+            if (pattern == L"plain")
+            {
+                _pattern = BenchmarkPattern::Plain;
+            }
+            else if (pattern == L"sgr")
+            {
+                _pattern = BenchmarkPattern::Sgr;
+            }
+            else if (pattern == L"scroll")
+            {
+                _pattern = BenchmarkPattern::Scroll;
+            }
+            else if (pattern == L"tui")
+            {
+                _pattern = BenchmarkPattern::Tui;
+            }
+            _kibPerSecond = winrt::unbox_value_or<uint32_t>(settings.TryLookup(L"benchmarkKibPerSecond").try_as<Windows::Foundation::IPropertyValue>(), _kibPerSecond);
+        }
+    }
+
+    void EchoConnection::Start()
+    {
+        if (_pattern != BenchmarkPattern::None)
+        {
+            _hBenchmarkThread.reset(CreateThread(
+                nullptr,
+                0,
+                [](LPVOID lpParameter) noexcept {
+                    const auto pInstance = static_cast<EchoConnection*>(lpParameter);
+                    return pInstance->_BenchmarkThread();
+                },
+                this,
+                0,
+                nullptr));
+            THROW_LAST_ERROR_IF_NULL(_hBenchmarkThread);
+            LOG_IF_FAILED(SetThreadDescription(_hBenchmarkThread.get(), L"EchoConnection Benchmark Thread"));
+        }
     }
 
     void EchoConnection::WriteInput(hstring const& data)
     {
-        std::wstringstream prettyPrint;
+        // Build the echo into the per-thread scratch buffer instead of a
+        // stringstream, so repeated keystrokes reuse one allocation.
+        auto& prettyPrint{ til::scratch_buffer<std::wstring>::get() };
         for (const auto& wch : data)
         {
             if (wch < 0x20)
             {
-                prettyPrint << L"^" << gsl::narrow_cast<wchar_t>(wch + 0x40);
+                prettyPrint.push_back(L'^');
+                prettyPrint.push_back(gsl::narrow_cast<wchar_t>(wch + 0x40));
             }
             else if (wch == 0x7f)
             {
-                prettyPrint << L"0x7f";
+                prettyPrint.append(L"0x7f");
             }
             else
             {
-                prettyPrint << wch;
+                prettyPrint.push_back(wch);
             }
         }
-        _TerminalOutputHandlers(prettyPrint.str());
+        _TerminalOutputHandlers(prettyPrint);
     }
 
-    void EchoConnection::Resize(uint32_t /*rows*/, uint32_t /*columns*/) noexcept
+    void EchoConnection::Resize(uint32_t rows, uint32_t columns) noexcept
     {
+        _rows.store(rows, std::memory_order_relaxed);
+        _cols.store(columns, std::memory_order_relaxed);
     }
 
     void EchoConnection::Close() noexcept
     {
+        _closing.store(true, std::memory_order_relaxed);
+        if (_hBenchmarkThread)
+        {
+            WaitForSingleObject(_hBenchmarkThread.get(), INFINITE);
+            _hBenchmarkThread.reset();
+        }
+    }
+
+    // Method Description:
+    // - Emits synthetic output at the configured rate, one chunk roughly every
+    //   16ms. Each chunk is prefixed with an OSC sequence carrying the QPC
+    //   timestamp at which it was generated:
+    //       ESC ] 7777 ; <qpc> ESC \
+    //   Unrecognized OSC sequences are swallowed by the state machine, so the
+    //   marker never reaches the screen; a consumer that knows about it (see
+    //   ControlCore) can subtract it from "now" after the chunk is ingested to
+    //   get an end-to-end latency sample.
+    DWORD EchoConnection::_BenchmarkThread()
+    try
+    {
+        constexpr DWORD intervalMs = 16;
+        const size_t charsPerChunk = (static_cast<size_t>(_kibPerSecond) * 1024 * intervalMs) / 1000;
+
+        std::wstring chunk;
+        while (!_closing.load(std::memory_order_relaxed))
+        {
+            chunk.clear();
+
+            LARGE_INTEGER qpc;
+            QueryPerformanceCounter(&qpc);
+            fmt::format_to(std::back_inserter(chunk), L"\x1b]7777;{}\x1b\\", qpc.QuadPart);
+
+            _generateChunk(chunk, charsPerChunk);
+            _TerminalOutputHandlers(chunk);
+
+            Sleep(intervalMs);
+        }
+        return 0;
+    }
+    CATCH_RETURN();
+
+    // Method Description:
+    // - Appends one chunk of synthetic output in the configured pattern.
+    // Arguments:
+    // - chunk: the buffer to append into.
+    // - targetSize: how many characters the chunk should roughly contain.
+    void EchoConnection::_generateChunk(std::wstring& chunk, size_t targetSize)
+    {
+        const auto rows = _rows.load(std::memory_order_relaxed);
+        const auto cols = _cols.load(std::memory_order_relaxed);
+        const size_t endSize = chunk.size() + targetSize;
+
+        switch (_pattern)
+        {
+        case BenchmarkPattern::Plain:
+        {
+            // Full lines of rotating printable ASCII, the way `cat big.txt`
+            // looks to us.
+            while (chunk.size() < endSize)
+            {
+                const auto base = gsl::narrow_cast<wchar_t>(L'!' + (_frame++ % 94));
+                for (uint32_t x = 0; x < cols; ++x)
+                {
+                    chunk.push_back(gsl::narrow_cast<wchar_t>(L'!' + ((base + x) % 94)));
+                }
+                chunk.append(L"\r\n");
+            }
+            break;
+        }
+        case BenchmarkPattern::Sgr:
+        {
+            // A 256-color foreground change before every 7-character "word",
+            // to exercise the attribute-handling half of the ingest path.
+            while (chunk.size() < endSize)
+            {
+                for (uint32_t x = 0; x + 8 <= cols; x += 8)
+                {
+                    fmt::format_to(std::back_inserter(chunk), L"\x1b[38;5;{}m", _frame++ % 256);
+                    chunk.append(7, gsl::narrow_cast<wchar_t>(L'!' + (_frame % 94)));
+                    chunk.push_back(L' ');
+                }
+                chunk.append(L"\x1b[m\r\n");
+            }
+            break;
+        }
+        case BenchmarkPattern::Scroll:
+        {
+            // Lines revealed one at a time at the bottom of a margin region,
+            // vim-style, which forces the renderer down its scroll path.
+            fmt::format_to(std::back_inserter(chunk), L"\x1b[1;{}r\x1b[{};1H", rows > 1 ? rows - 1 : rows, rows > 1 ? rows - 1 : rows);
+            while (chunk.size() < endSize)
+            {
+                fmt::format_to(std::back_inserter(chunk), L"\nline {} ", _frame++);
+                chunk.append(cols > 16 ? cols - 16 : 1, gsl::narrow_cast<wchar_t>(L'!' + (_frame % 94)));
+            }
+            chunk.append(L"\x1b[r");
+            break;
+        }
+        case BenchmarkPattern::Tui:
+        {
+            // Repeated full-screen repaints: home the cursor, then rewrite
+            // every row with cursor positioning, the way a TUI redraw does.
+            while (chunk.size() < endSize)
+            {
+                chunk.append(L"\x1b[H");
+                const auto fill = gsl::narrow_cast<wchar_t>(L'!' + (_frame++ % 94));
+                for (uint32_t y = 1; y <= rows; ++y)
+                {
+                    fmt::format_to(std::back_inserter(chunk), L"\x1b[{};1H", y);
+                    chunk.append(cols, fill);
+                }
+            }
+            break;
+        }
+        default:
+            break;
+        }
     }
 }
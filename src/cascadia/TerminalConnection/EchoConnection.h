@@ -11,17 +11,43 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
     {
         EchoConnection() noexcept;
 
-        void Start() noexcept;
+        void Start();
         void WriteInput(hstring const& data);
         void Resize(uint32_t rows, uint32_t columns) noexcept;
         void Close() noexcept;
 
-        void Initialize(const Windows::Foundation::Collections::ValueSet& /*settings*/) const noexcept {};
+        void Initialize(const Windows::Foundation::Collections::ValueSet& settings);
+
+        bool BenchmarkMode() const noexcept { return _pattern != BenchmarkPattern::None; }
 
         ConnectionState State() const noexcept { return ConnectionState::Connected; }
 
         WINRT_CALLBACK(TerminalOutput, TerminalOutputHandler);
         TYPED_EVENT(StateChanged, ITerminalConnection, IInspectable);
+
+    private:
+        // When a "benchmark" pattern is configured through Initialize, we grow
+        // from an input echo into a synthetic output generator, so the entire
+        // terminal-side pipeline can be measured without a shell in the loop.
+        enum class BenchmarkPattern
+        {
+            None, // plain echo behavior; no generator thread
+            Plain, // unformatted ASCII text, CRLF line endings
+            Sgr, // a 256-color SGR change on every word
+            Scroll, // lines revealed inside a DECSTBM scroll region
+            Tui, // full-screen redraws, the shape a TUI repaint produces
+        };
+
+        DWORD _BenchmarkThread();
+        void _generateChunk(std::wstring& chunk, size_t targetSize);
+
+        BenchmarkPattern _pattern{ BenchmarkPattern::None };
+        uint32_t _kibPerSecond{ 1024 };
+        std::atomic<uint32_t> _rows{ 30 };
+        std::atomic<uint32_t> _cols{ 80 };
+        uint64_t _frame{ 0 };
+        std::atomic<bool> _closing{ false };
+        wil::unique_handle _hBenchmarkThread;
     };
 }
 
@@ -11,6 +11,8 @@
 #include <LibraryResources.h>
 
 #include "EventArgs.h"
+#include "OutputDrainScheduler.h"
+#include "../../inc/ConsolePerfCounters.h"
 #include "../../types/inc/GlyphWidth.hpp"
 #include "../../buffer/out/search.h"
 #include "../../renderer/atlas/AtlasEngine.h"
@@ -35,6 +37,16 @@ constexpr const auto TsfRedrawInterval = std::chrono::milliseconds(100);
 // The minimum delay between updating the locations of regex patterns
 constexpr const auto UpdatePatternLocationsInterval = std::chrono::milliseconds(500);
 
+// The minimum delay between propagating title changes to the app layer.
+// Build tools like to put progress information in the title at very high
+// rates; the tab text doesn't need to keep up with every single update.
+constexpr const auto TitleUpdateInterval = std::chrono::milliseconds(100);
+
+// The cadence of background buffer housekeeping while a pane is idle, and
+// how long the connection must have been quiet before a tick does any work.
+constexpr const auto IdleMaintenanceInterval = std::chrono::seconds(30);
+constexpr const auto IdleMaintenanceQuietPeriod = std::chrono::seconds(60);
+
 namespace winrt::Microsoft::Terminal::Control::implementation
 {
     // Helper static function to ensure that all ambiguous-width glyphs are reported as narrow.
@@ -65,8 +77,16 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     {
         _EnsureStaticInitialization();
 
+        // Mint a fresh identity for this session. When the window layout is
+        // persisted, this GUID names our buffer snapshot on disk.
+        THROW_IF_FAILED(CoCreateGuid(reinterpret_cast<GUID*>(&_sessionId)));
+
         _settings = winrt::make_self<implementation::ControlSettings>(settings, unfocusedAppearance);
 
+        // Process-wide, so the last pane to apply its settings wins; the
+        // setting is global, so they all agree anyway.
+        ::Microsoft::Terminal::Control::OutputDrainScheduler::Instance().SetEnabled(_settings->FairOutputScheduling());
+
         _terminal = std::make_unique<::Microsoft::Terminal::Core::Terminal>();
 
         // Subscribe to the connection's disconnected event and call our connection closed handlers.
@@ -77,6 +97,11 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         // This event is explicitly revoked in the destructor: does not need weak_ref
         _connectionOutputEventToken = _connection.TerminalOutput({ this, &ControlCore::_connectionOutputHandler });
 
+        if (const auto echoConnection{ _connection.try_as<TerminalConnection::EchoConnection>() })
+        {
+            _benchmarkConnection = echoConnection.BenchmarkMode();
+        }
+
         _terminal->SetWriteInputCallback([this](std::wstring_view wstr) {
             _sendInputToConnection(wstr);
         });
@@ -160,6 +185,10 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         //   need to hop across the process boundary every time text is output.
         //   We can throttle this to once every 8ms, which will get us out of
         //   the way of the main output & rendering threads.
+        // * _updateTitle: Every title change crosses the WinRT boundary and
+        //   ends in a XAML tab text re-measure. Trailing-throttle it so a
+        //   storm of title updates from the connection becomes one
+        //   propagation carrying the latest value.
         _tsfTryRedrawCanvas = std::make_shared<ThrottledFuncTrailing<>>(
             _dispatcher,
             TsfRedrawInterval,
@@ -190,6 +219,16 @@ namespace winrt::Microsoft::Terminal::Control::implementation
                 }
             });
 
+        _updateTitle = std::make_shared<ThrottledFuncTrailing<winrt::hstring>>(
+            _dispatcher,
+            TitleUpdateInterval,
+            [weakThis = get_weak()](const auto& title) {
+                if (auto core{ weakThis.get() }; !core->_IsClosing())
+                {
+                    core->_TitleChangedHandlers(*core, winrt::make<TitleChangedEventArgs>(title));
+                }
+            });
+
         UpdateSettings(settings, unfocusedAppearance);
     }
 
@@ -302,6 +341,17 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             _initializedTerminal = true;
         } // scope for TerminalLock
 
+        // If we were handed a buffer snapshot from a previous session, replay
+        // it now, so the restored content is readable immediately while the
+        // new connection spins up underneath it. Terminal::Write takes the
+        // terminal lock itself, so this has to happen outside the scope above.
+        if (!_restorePersistedBuffer.empty())
+        {
+            _terminal->Write(_restorePersistedBuffer);
+            _restorePersistedBuffer.clear();
+            _restorePersistedBuffer.shrink_to_fit();
+        }
+
         // Start the connection outside of lock, because it could
         // start writing output immediately.
         _connection.Start();
@@ -415,6 +465,15 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             }
         }
 
+        // Stamp real keystrokes for the input-to-present latency histogram;
+        // the sample completes when the frame carrying the echo presents.
+        if (keyDown && vkey && !KeyEvent::IsModifierKey(vkey))
+        {
+            LARGE_INTEGER now;
+            QueryPerformanceCounter(&now);
+            ::Microsoft::Console::PerfCounters::Instance().NoteInput(now.QuadPart);
+        }
+
         // If the terminal translated the key, mark the event as handled.
         // This will prevent the system from trying to get the character out
         // of it and sending us a CharacterReceived event.
@@ -438,6 +497,9 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     {
         // Clear the regex pattern tree so the renderer does not try to render them while scrolling
         _terminal->ClearPatternTree();
+        // The pattern intervals are viewport-relative, so scrolling also
+        // invalidates the interval we cached for hover hit-testing.
+        _lastHoveredIntervalValid = false;
 
         // This is a scroll event that wasn't initiated by the terminal
         //      itself - it was initiated by the mouse wheel, or the scrollbar.
@@ -519,14 +581,144 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         _renderer->TriggerRedrawAll();
     }
 
+    // Method Description:
+    // - Demote this pane to background activity levels, or promote it back.
+    //   While demoted, the render thread paces paints down to a glanceable
+    //   cadence and we stop re-scanning the viewport for hyperlink patterns -
+    //   nobody can hover a link in a pane they're not interacting with. The
+    //   control already stops the cursor and attribute blink timers on focus
+    //   loss, and title updates are always throttled, so those need nothing
+    //   extra here. Promotion takes effect immediately and runs a catch-up
+    //   pattern scan for whatever was skipped.
+    void ControlCore::SetBackgrounded(const bool backgrounded)
+    {
+        if (_backgrounded.exchange(backgrounded, std::memory_order_relaxed) == backgrounded)
+        {
+            return;
+        }
+
+        if (_renderer)
+        {
+            _renderer->SetBackgroundCadence(backgrounded);
+        }
+
+        if (!backgrounded)
+        {
+            _updatePatternLocations->Run();
+        }
+
+        // While demoted, run incremental buffer housekeeping on a slow
+        // cadence. The timer is created lazily on the first demotion;
+        // SetBackgrounded only runs on the UI thread, which is also where
+        // the timer ticks, so there's no affinity to juggle.
+        if (backgrounded)
+        {
+            if (!_idleMaintenanceTimer && _dispatcher)
+            {
+                _idleMaintenanceTimer = _dispatcher.CreateTimer();
+                _idleMaintenanceTimer.Interval(IdleMaintenanceInterval);
+                _idleMaintenanceTimer.Tick([weakThis = get_weak()](auto&&, auto&&) {
+                    if (auto core{ weakThis.get() }; core && !core->_IsClosing())
+                    {
+                        core->_idleMaintenanceTick();
+                    }
+                });
+            }
+            if (_idleMaintenanceTimer)
+            {
+                _idleMaintenanceTimer.Start();
+            }
+        }
+        else if (_idleMaintenanceTimer)
+        {
+            _idleMaintenanceTimer.Stop();
+        }
+    }
+
+    // Method Description:
+    // - One tick of the idle maintenance cadence. Verifies the pane is
+    //   genuinely idle - still demoted, its connection quiet for a good
+    //   while, and the machine not running on battery - and then runs one
+    //   bounded housekeeping slice under the terminal lock. The slice is
+    //   small, so even a pane waking up mid-tick waits on the lock for
+    //   well under a millisecond; ticks while there's nothing left to do
+    //   degrade to a cheap no-op sweep.
+    void ControlCore::_idleMaintenanceTick()
+    {
+        if (!_backgrounded.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        const auto sinceOutput = GetTickCount64() - _lastOutputTick.load(std::memory_order_relaxed);
+        if (sinceOutput < static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(IdleMaintenanceQuietPeriod).count()))
+        {
+            return;
+        }
+
+        // Housekeeping saves memory, not power; don't spend charge on it.
+        SYSTEM_POWER_STATUS powerStatus{};
+        if (GetSystemPowerStatus(&powerStatus) && powerStatus.ACLineStatus == 0)
+        {
+            return;
+        }
+
+        auto lock = _terminal->LockForWriting();
+        _terminal->PerformIdleMaintenance();
+    }
+
+    // Method Description:
+    // - How much wall time this core has spent ingesting its connection's
+    //   output, in microseconds, since it was created. The heaviest pane in a
+    //   window is the one whose delta grows fastest.
+    uint64_t ControlCore::OutputIngestMicroseconds() const noexcept
+    {
+        return _outputIngestMicroseconds.load(std::memory_order_relaxed);
+    }
+
+    // Method Description:
+    // - How many bytes of row storage this pane's buffers hold live right
+    //   now, scrollback included. Reads relaxed counters the buffers keep
+    //   up to date, so no lock is needed.
+    uint64_t ControlCore::BufferMemoryBytes() const noexcept
+    {
+        return _terminal->GetBufferMemoryUsage();
+    }
+
     // Method Description:
     // - Tell TerminalCore to update its knowledge about the locations of visible regex patterns
     // - We should call this (through the throttled function) when something causes the visible
     //   region to change, such as when new text enters the buffer or the viewport is scrolled
-    void ControlCore::UpdatePatternLocations()
+    winrt::fire_and_forget ControlCore::UpdatePatternLocations()
     {
-        auto lock = _terminal->LockForWriting();
-        _terminal->UpdatePatternsUnderLock();
+        // Snapshot the visible text under the lock, run the regex over the
+        // snapshot on a background thread, and only come back for the lock to
+        // publish the result. That keeps std::wregex time out of the frame
+        // budget when URL-dense output is scrolling by.
+        std::optional<::Microsoft::Terminal::Core::Terminal::PatternScan> scan;
+        {
+            auto lock = _terminal->LockForReading();
+            scan = _terminal->BeginPatternScanUnderLock();
+        }
+        if (!scan)
+        {
+            // Nothing in the visible region changed since the last scan.
+            co_return;
+        }
+
+        auto weakThis{ get_weak() };
+        co_await winrt::resume_background();
+
+        scan->tree = TextBuffer::SearchPatterns(scan->patterns, scan->text, scan->rowSize);
+
+        if (auto core{ weakThis.get() })
+        {
+            auto lock = core->_terminal->LockForWriting();
+            core->_terminal->CommitPatternScanUnderLock(std::move(*scan));
+            // The rebuilt tree may disagree with the interval we cached from
+            // the old one; make the next hover update search the tree again.
+            core->_lastHoveredIntervalValid = false;
+        }
     }
 
     // Method description:
@@ -560,7 +752,24 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         {
             auto lock = _terminal->LockForReading(); // Lock for the duration of our reads.
             newId = _terminal->GetHyperlinkIdAtPosition(terminalPosition->to_win32_coord());
-            newInterval = _terminal->GetHyperlinkIntervalFromPosition(terminalPosition->to_win32_coord());
+
+            // The pattern tree only changes when it's rebuilt, so in between
+            // rebuilds the interval we found last time is authoritative for
+            // every position it covers - skip the tree search while the
+            // pointer stays inside it. The comparison mirrors the overlap
+            // test findOverlapping() would apply to this position.
+            if (_lastHoveredIntervalValid &&
+                _lastHoveredInterval.has_value() &&
+                _lastHoveredInterval->stop >= til::point{ terminalPosition->x + 1, terminalPosition->y } &&
+                _lastHoveredInterval->start <= *terminalPosition)
+            {
+                newInterval = _lastHoveredInterval;
+            }
+            else
+            {
+                newInterval = _terminal->GetHyperlinkIntervalFromPosition(terminalPosition->to_win32_coord());
+                _lastHoveredIntervalValid = newInterval.has_value();
+            }
         }
 
         // If the hyperlink ID changed or the interval changed, trigger a redraw all
@@ -608,13 +817,49 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         return _lastHoveredCell.has_value() ? Windows::Foundation::IReference<Core::Point>{ _lastHoveredCell.value().to_core_point() } : nullptr;
     }
 
+    // Two font feature/axes maps are equal if they contain the same keys with
+    // the same values. Settings reloads hand every pane a freshly built
+    // settings object, so identity comparisons can't detect "nothing changed".
+    template<typename TMap>
+    static bool _fontMapsEqual(const TMap& lhs, const TMap& rhs)
+    {
+        if (!lhs || !rhs)
+        {
+            return !lhs == !rhs;
+        }
+        if (lhs.Size() != rhs.Size())
+        {
+            return false;
+        }
+        for (const auto& kv : lhs)
+        {
+            if (!rhs.HasKey(kv.Key()) || rhs.Lookup(kv.Key()) != kv.Value())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool _fontSettingsUnchanged(implementation::ControlSettings& lhs, implementation::ControlSettings& rhs)
+    {
+        return lhs.FontSize() == rhs.FontSize() &&
+               lhs.FontFace() == rhs.FontFace() &&
+               lhs.FontWeight().Weight == rhs.FontWeight().Weight &&
+               _fontMapsEqual(lhs.FontFeatures(), rhs.FontFeatures()) &&
+               _fontMapsEqual(lhs.FontAxes(), rhs.FontAxes());
+    }
+
     // Method Description:
     // - Updates the settings of the current terminal.
     // - INVARIANT: This method can only be called if the caller DOES NOT HAVE writing lock on the terminal.
     void ControlCore::UpdateSettings(const IControlSettings& settings, const IControlAppearance& newAppearance)
     {
+        const auto previousSettings = _settings;
         _settings = winrt::make_self<implementation::ControlSettings>(settings, newAppearance);
 
+        ::Microsoft::Terminal::Control::OutputDrainScheduler::Instance().SetEnabled(_settings->FairOutputScheduling());
+
         auto lock = _terminal->LockForWriting();
 
         _runtimeOpacity = std::nullopt;
@@ -628,7 +873,15 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             _runtimeUseAcrylic = true;
         }
 
-        const auto sizeChanged = _setFontSizeUnderLock(_settings->FontSize());
+        // Pushing a font change through the render engine tears down its
+        // glyph atlas and re-measures the font - by far the most expensive
+        // part of a settings reload, multiplied by every open pane. A reload
+        // that didn't touch the font (say, a new keybinding) skips all of it.
+        auto sizeChanged = false;
+        if (!previousSettings || !_fontSettingsUnchanged(*previousSettings, *_settings))
+        {
+            sizeChanged = _setFontSizeUnderLock(_settings->FontSize());
+        }
 
         // Update the terminal core with its new Core settings
         _terminal->UpdateSettings(*_settings);
@@ -947,7 +1200,44 @@ namespace winrt::Microsoft::Terminal::Control::implementation
 
         // extract text from buffer
         // RetrieveSelectedTextFromBuffer will lock while it's reading
-        const auto bufferData = _terminal->RetrieveSelectedTextFromBuffer(singleLine);
+        auto bufferData = _terminal->RetrieveSelectedTextFromBuffer(singleLine);
+
+        const auto bgColor = _terminal->GetAttributeColors({}).second;
+
+        if (!_settings->CopyOnSelect())
+        {
+            _terminal->ClearSelection();
+            _renderer->TriggerSelection();
+        }
+
+        // Formatting the extracted cells is linear in the size of the selection
+        // and needs neither the terminal lock nor the UI thread, so hand the
+        // cells off to a background thread. Copying a large scrollback used to
+        // block the window here for the whole HTML/RTF generation.
+        _copySelectionToClipboardAsync(std::move(bufferData), bgColor, formats);
+        return true;
+    }
+
+    // Method Description:
+    // - Builds the plain text, HTML and RTF clipboard representations from cells
+    //   already extracted from the buffer, then raises the CopyToClipboard event.
+    // - All three formats are derived from the one extraction walk that produced
+    //   `bufferData`; the buffer itself is not touched again.
+    // Arguments:
+    // - bufferData: the selected cells, as returned by RetrieveSelectedTextFromBuffer
+    // - bgColor: the background color to use for the HTML/RTF representations
+    // - formats: which formats to copy (see CopySelectionToClipboard)
+    winrt::fire_and_forget ControlCore::_copySelectionToClipboardAsync(::TextBuffer::TextAndColor bufferData,
+                                                                       const COLORREF bgColor,
+                                                                       Windows::Foundation::IReference<CopyFormat> formats)
+    {
+        // Read the font information before leaving the calling thread; it can
+        // change underneath us if the settings are reloaded while we generate.
+        const auto fontHeightPoints = _actualFont.GetUnscaledSize().Y;
+        const std::wstring fontFaceName{ _actualFont.GetFaceName() };
+
+        auto weakThis{ get_weak() };
+        co_await winrt::resume_background();
 
         // convert text: vector<string> --> string
         std::wstring textData;
@@ -956,40 +1246,36 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             textData += text;
         }
 
-        const auto bgColor = _terminal->GetAttributeColors({}).second;
-
         // convert text to HTML format
         // GH#5347 - Don't provide a title for the generated HTML, as many
         // web applications will paste the title first, followed by the HTML
         // content, which is unexpected.
         const auto htmlData = formats == nullptr || WI_IsFlagSet(formats.Value(), CopyFormat::HTML) ?
                                   TextBuffer::GenHTML(bufferData,
-                                                      _actualFont.GetUnscaledSize().Y,
-                                                      _actualFont.GetFaceName(),
+                                                      fontHeightPoints,
+                                                      fontFaceName,
                                                       bgColor) :
                                   "";
 
         // convert to RTF format
         const auto rtfData = formats == nullptr || WI_IsFlagSet(formats.Value(), CopyFormat::RTF) ?
                                  TextBuffer::GenRTF(bufferData,
-                                                    _actualFont.GetUnscaledSize().Y,
-                                                    _actualFont.GetFaceName(),
+                                                    fontHeightPoints,
+                                                    fontFaceName,
                                                     bgColor) :
                                  "";
 
-        if (!_settings->CopyOnSelect())
+        // send data up for clipboard. The handlers already cope with being
+        // raised off the UI thread - the OSC 52 path comes in on the
+        // connection thread today.
+        if (auto core{ weakThis.get() })
         {
-            _terminal->ClearSelection();
-            _renderer->TriggerSelection();
+            core->_CopyToClipboardHandlers(*core,
+                                           winrt::make<CopyToClipboardEventArgs>(winrt::hstring{ textData },
+                                                                                 winrt::to_hstring(htmlData),
+                                                                                 winrt::to_hstring(rtfData),
+                                                                                 formats));
         }
-
-        // send data up for clipboard
-        _CopyToClipboardHandlers(*this,
-                                 winrt::make<CopyToClipboardEventArgs>(winrt::hstring{ textData },
-                                                                       winrt::to_hstring(htmlData),
-                                                                       winrt::to_hstring(rtfData),
-                                                                       formats));
-        return true;
     }
 
     // Method Description:
@@ -1112,6 +1398,11 @@ namespace winrt::Microsoft::Terminal::Control::implementation
 
     void ControlCore::_terminalWarningBell()
     {
+        // A bell is this pane asking for attention: restore full activity
+        // immediately, ahead of whatever focus change may follow. If focus
+        // doesn't come, the next focus change will demote us again.
+        SetBackgrounded(false);
+
         // Since this can only ever be triggered by output from the connection,
         // then the Terminal already has the write lock when calling this
         // callback.
@@ -1120,7 +1411,8 @@ namespace winrt::Microsoft::Terminal::Control::implementation
 
     // Method Description:
     // - Called for the Terminal's TitleChanged callback. This will re-raise
-    //   a new winrt TypedEvent that can be listened to.
+    //   a new winrt TypedEvent that can be listened to, through the throttled
+    //   function, so a burst of changes becomes one event with the last title.
     // - The listeners to this event will re-query the control for the current
     //   value of Title().
     // Arguments:
@@ -1131,8 +1423,9 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     {
         // Since this can only ever be triggered by output from the connection,
         // then the Terminal already has the write lock when calling this
-        // callback.
-        _TitleChangedHandlers(*this, winrt::make<TitleChangedEventArgs>(winrt::hstring{ wstr }));
+        // callback. The throttled function just records the value here; the
+        // event is raised later from the dispatcher without the lock.
+        _updateTitle->Run(winrt::hstring{ wstr });
     }
 
     // Method Description:
@@ -1269,8 +1562,26 @@ namespace winrt::Microsoft::Terminal::Control::implementation
                                                     Search::Sensitivity::CaseSensitive :
                                                     Search::Sensitivity::CaseInsensitive;
 
+        // Scan for candidate rows against an immutable text snapshot, so the
+        // expensive pass across the entire scrollback runs without holding
+        // the terminal lock and output can continue in the meantime.
+        ::Microsoft::Terminal::Core::Terminal::TextSnapshot snapshot;
+        {
+            auto lock = _terminal->LockForReading();
+            snapshot = _terminal->SnapshotTextUnderLock();
+        }
+        auto rowFilter = ::Search::s_RowsThatMayContainNeedle(snapshot.rows, text.c_str(), sensitivity);
+
         ::Search search(*GetUiaData(), text.c_str(), direction, sensitivity);
         auto lock = _terminal->LockForWriting();
+        // The filter indexes rows by where they sat when the snapshot was
+        // taken. If the buffer has changed since (rows recycled, output
+        // scrolled), it no longer lines up - fall back to the unfiltered
+        // search rather than skip rows that might now hold a match.
+        if (_terminal->TextContentVersionUnderLock() == snapshot.contentVersion)
+        {
+            search.ConstrainToRows(std::move(rowFilter));
+        }
         const bool foundMatch{ search.FindNext() };
         if (foundMatch)
         {
@@ -1317,6 +1628,11 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         {
             _closing = true;
 
+            if (_idleMaintenanceTimer)
+            {
+                _idleMaintenanceTimer.Stop();
+            }
+
             // Stop accepting new output and state changes before we disconnect everything.
             _connection.TerminalOutput(_connectionOutputEventToken);
             _connectionStateChangedRevoker.revoke();
@@ -1494,10 +1810,99 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     }
     void ControlCore::_connectionOutputHandler(const hstring& hstr)
     {
-        _terminal->Write(hstr);
+        // Note when output last arrived; the idle maintenance tick uses it
+        // to tell a quiet pane from one that's merely unfocused.
+        _lastOutputTick.store(GetTickCount64(), std::memory_order_relaxed);
 
-        // Start the throttled update of where our hyperlinks are.
-        _updatePatternLocations->Run();
+        LARGE_INTEGER ingestStart, ingestEnd;
+        {
+            // When fair output scheduling is on, wait behind sibling panes
+            // before applying this chunk, so one fire-hose pane can't starve
+            // the others' Terminal::Write turns. The wait is deliberately
+            // outside the ingest timing below - it's queueing, not work.
+            const ::Microsoft::Terminal::Control::OutputDrainScheduler::Turn turn{
+                ::Microsoft::Terminal::Control::OutputDrainScheduler::Instance()
+            };
+
+            QueryPerformanceCounter(&ingestStart);
+
+            // hstr is typically a fast-pass string reference over the connection's
+            // conversion buffer (see ConptyConnection), valid only for the duration
+            // of this call. View it, don't stash it - copying it here would
+            // reintroduce a per-chunk allocation on the bulk output path.
+            _terminal->Write(hstr);
+
+            QueryPerformanceCounter(&ingestEnd);
+        }
+
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+        _outputIngestMicroseconds.fetch_add(
+            static_cast<uint64_t>((ingestEnd.QuadPart - ingestStart.QuadPart) * 1'000'000 / frequency.QuadPart),
+            std::memory_order_relaxed);
+
+        if (_benchmarkConnection)
+        {
+            _traceBenchmarkIngest(hstr);
+        }
+
+        if (_synchronousOutput)
+        {
+            // Deterministic single-thread mode: paint right here, on this
+            // thread, and skip the throttled pattern update - it would hop
+            // to the dispatcher and reintroduce the nondeterminism this mode
+            // exists to remove. The render thread never paints in this mode
+            // as long as EnablePainting is never called.
+            LOG_IF_FAILED(_renderer->PaintFrame());
+            return;
+        }
+
+        // Start the throttled update of where our hyperlinks are. Skipped
+        // while backgrounded; SetBackgrounded(false) runs a catch-up scan.
+        if (!_backgrounded.load(std::memory_order_relaxed))
+        {
+            _updatePatternLocations->Run();
+        }
+    }
+
+    // Method Description:
+    // - Computes how long a benchmark chunk took to travel from the connection
+    //   to "ingested by the terminal", and traces it. A benchmarking
+    //   EchoConnection prefixes every chunk with OSC 7777 carrying the QPC
+    //   value at which it was generated; the state machine swallows the
+    //   sequence, so we peek at the raw text here instead. Paint latency is
+    //   correlated offline by pairing these events with the renderer's own
+    //   trace events in the same ETW session.
+    // Arguments:
+    // - chunk: the raw output chunk, as handed to _terminal->Write.
+    void ControlCore::_traceBenchmarkIngest(const std::wstring_view chunk)
+    {
+        static constexpr std::wstring_view markerPrefix{ L"\x1b]7777;" };
+        if (!til::starts_with(chunk, markerPrefix))
+        {
+            return;
+        }
+
+        uint64_t generatedQpc{ 0 };
+        auto it = chunk.begin() + markerPrefix.size();
+        for (; it != chunk.end() && *it >= L'0' && *it <= L'9'; ++it)
+        {
+            generatedQpc = generatedQpc * 10 + (*it - L'0');
+        }
+
+        LARGE_INTEGER now, frequency;
+        QueryPerformanceCounter(&now);
+        QueryPerformanceFrequency(&frequency);
+        const auto latencyUs = ((now.QuadPart - gsl::narrow_cast<int64_t>(generatedQpc)) * 1'000'000) / frequency.QuadPart;
+
+        TraceLoggingWrite(
+            g_hTerminalControlProvider,
+            "ControlCore_BenchmarkIngestLatency",
+            TraceLoggingInt64(latencyUs, "LatencyMicroseconds", "Generation-to-ingest latency of this chunk"),
+            TraceLoggingUInt64(generatedQpc, "GeneratedQPC", "QPC timestamp the connection stamped on the chunk"),
+            TraceLoggingUInt64(chunk.size(), "ChunkSize", "Size of the chunk, in characters"),
+            TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+            TraceLoggingKeyword(TIL_KEYWORD_TRACE));
     }
 
     // Method Description:
@@ -1559,6 +1964,24 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         return hstring(ss.str());
     }
 
+    winrt::guid ControlCore::SessionId() const noexcept
+    {
+        return _sessionId;
+    }
+
+    // Method Description:
+    // - Stash the contents of a buffer snapshot from a previous session. The
+    //   text isn't written to the terminal here - the control might not be
+    //   initialized yet (background tabs initialize lazily, when they're first
+    //   selected). Initialize() replays it just before starting the connection.
+    // - We also adopt the previous session's GUID, so future snapshots
+    //   overwrite the same file on disk instead of abandoning it.
+    void ControlCore::RestorePersistedBuffer(const winrt::guid& sessionId, const hstring& content)
+    {
+        _sessionId = sessionId;
+        _restorePersistedBuffer = content;
+    }
+
     // Helper to check if we're on Windows 11 or not. This is used to check if
     // we need to use acrylic to achieve transparency, because vintage opacity
     // doesn't work in islands on win10.
@@ -1575,6 +1998,20 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         return VerifyVersionInfoW(&osver, VER_BUILDNUMBER, dwlConditionMask) != FALSE;
     }
 
+    // - These shuttle the buffer usage ledger between the buffer library and
+    //   whoever owns persisted state (the app saves it into state.json), so a
+    //   fresh launch can preallocate buffers for the steady-state footprints
+    //   previous sessions actually reached.
+    hstring ControlCore::ExportBufferUsageStats()
+    {
+        return hstring{ BufferUsageHistory::Instance().Serialize() };
+    }
+
+    void ControlCore::ImportBufferUsageStats(const hstring& stats)
+    {
+        BufferUsageHistory::Instance().Deserialize(stats);
+    }
+
     Core::Scheme ControlCore::ColorScheme() const noexcept
     {
         Core::Scheme s;
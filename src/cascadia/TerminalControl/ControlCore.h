@@ -85,7 +85,11 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         void AdjustOpacity(const double adjustment);
         void ResumeRendering();
 
-        void UpdatePatternLocations();
+        void SetBackgrounded(const bool backgrounded);
+        uint64_t OutputIngestMicroseconds() const noexcept;
+        uint64_t BufferMemoryBytes() const noexcept;
+
+        winrt::fire_and_forget UpdatePatternLocations();
         void SetHoveredCell(Core::Point terminalPosition);
         void ClearHoveredCell();
         winrt::hstring GetHyperlink(const Core::Point position) const;
@@ -165,8 +169,14 @@ namespace winrt::Microsoft::Terminal::Control::implementation
 
         hstring ReadEntireBuffer() const;
 
+        winrt::guid SessionId() const noexcept;
+        void RestorePersistedBuffer(const winrt::guid& sessionId, const hstring& content);
+
         static bool IsVintageOpacityAvailable() noexcept;
 
+        static hstring ExportBufferUsageStats();
+        static void ImportBufferUsageStats(const hstring& stats);
+
         void AdjustOpacity(const double opacity, const bool relative);
 
         // TODO:GH#1256 - When a tab can be torn out or otherwise reparented to
@@ -233,7 +243,51 @@ namespace winrt::Microsoft::Terminal::Control::implementation
 
         bool _isReadOnly{ false };
 
+        // Identifies this terminal session across launches, so that a persisted
+        // buffer snapshot can find its way back to the same pane on restore.
+        winrt::guid _sessionId{};
+        // Snapshot contents stashed here until Initialize() replays them into
+        // the terminal, right before the connection starts.
+        std::wstring _restorePersistedBuffer;
+
+        // True when our connection is an EchoConnection generating synthetic
+        // benchmark output; makes _connectionOutputHandler look for the
+        // timestamp marker each chunk carries and trace the ingest latency.
+        bool _benchmarkConnection{ false };
+
+        // Test-only: run the whole output pipeline on the thread delivering
+        // the connection's output. _connectionOutputHandler paints the frame
+        // inline instead of waking the render thread, and skips the
+        // throttled dispatcher hops, so a profiler sees the connection
+        // write, the terminal commit and the render pass as one coherent
+        // stack instead of attributing the handoffs to the scheduler. Only
+        // the unit test harness sets this (it's a friend).
+        bool _synchronousOutput{ false };
+
+        // True while this pane is demoted to background activity levels
+        // (reduced paint cadence, paused pattern scanning). Flipped from the
+        // UI thread on focus changes, read from the connection's output
+        // thread.
+        std::atomic<bool> _backgrounded{ false };
+
+        // Idle maintenance: while demoted, a slow timer runs incremental
+        // buffer housekeeping, but only once the connection has been quiet
+        // for a while. _lastOutputTick is written by the connection's output
+        // thread and read by the timer's tick on the UI thread.
+        std::atomic<uint64_t> _lastOutputTick{ 0 };
+        winrt::Windows::System::DispatcherQueueTimer _idleMaintenanceTimer{ nullptr };
+
+        // Wall time _connectionOutputHandler has spent ingesting this
+        // connection's output, ever. Comparing deltas across panes points at
+        // the one burning the CPU.
+        std::atomic<uint64_t> _outputIngestMicroseconds{ 0 };
+
         std::optional<interval_tree::IntervalTree<til::point, size_t>::interval> _lastHoveredInterval{ std::nullopt };
+        // _lastHoveredInterval doubles as a hit-test cache: until the pattern
+        // tree is rebuilt or the viewport scrolls, the pointer staying inside
+        // that interval can't produce a different answer. This tracks whether
+        // the cached interval is still current.
+        bool _lastHoveredIntervalValid{ false };
 
         // These members represent the size of the surface that we should be
         // rendering to.
@@ -245,9 +299,14 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         std::shared_ptr<ThrottledFuncTrailing<>> _tsfTryRedrawCanvas;
         std::shared_ptr<ThrottledFuncTrailing<>> _updatePatternLocations;
         std::shared_ptr<ThrottledFuncTrailing<Control::ScrollPositionChangedArgs>> _updateScrollBar;
+        std::shared_ptr<ThrottledFuncTrailing<winrt::hstring>> _updateTitle;
 
         winrt::fire_and_forget _asyncCloseConnection();
 
+        winrt::fire_and_forget _copySelectionToClipboardAsync(::TextBuffer::TextAndColor bufferData,
+                                                              const COLORREF bgColor,
+                                                              Windows::Foundation::IReference<CopyFormat> formats);
+
         bool _setFontSizeUnderLock(int fontSize);
         void _updateFont(const bool initialUpdate = false);
         void _refreshSizeUnderLock();
@@ -275,6 +334,8 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         void _raiseReadOnlyWarning();
         void _updateAntiAliasingMode();
         void _connectionOutputHandler(const hstring& hstr);
+        void _idleMaintenanceTick();
+        void _traceBenchmarkIngest(const std::wstring_view chunk);
         void _updateHoveredCell(const std::optional<til::point> terminalPosition);
         void _setOpacity(const double opacity);
 
@@ -196,6 +196,10 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     {
         const til::point terminalPosition = _getTerminalPosition(til::point{ pixelPosition });
 
+        // A new press starts a new drag; don't let the coalescing state from
+        // the previous drag suppress the first update of this one.
+        _lastDragSelectionUpdate.reset();
+
         const auto altEnabled = modifiers.IsAltPressed();
         const auto shiftEnabled = modifiers.IsShiftPressed();
         const auto ctrlEnabled = modifiers.IsCtrlPressed();
@@ -318,7 +322,14 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             SetEndSelectionPoint(pixelPosition);
         }
 
-        _core->SetHoveredCell(terminalPosition.to_core_point());
+        // During a left-button drag the hover state can't usefully change (and
+        // updating it means hyperlink hit-testing per cell crossed, plus a full
+        // redraw whenever the answer changes); leave it alone until the drag is
+        // over. The next move after release refreshes it.
+        if (!(pointerPressedInBounds && WI_IsFlagSet(buttonState, MouseButtonState::IsLeftButtonDown)))
+        {
+            _core->SetHoveredCell(terminalPosition.to_core_point());
+        }
     }
 
     void ControlInteractivity::TouchMoved(const Core::Point newTouchPoint,
@@ -594,7 +605,20 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     // - cursorPosition: in pixels, relative to the origin of the control
     void ControlInteractivity::SetEndSelectionPoint(const Core::Point pixelPosition)
     {
-        _core->SetEndSelectionPoint(_getTerminalPosition(til::point{ pixelPosition }));
+        // The selection endpoint only has cell granularity, so if this sample
+        // lands in the same cell as the one we last pushed to the core - and
+        // the viewport hasn't scrolled underneath it in the meantime - nothing
+        // can change and we can skip the terminal lock and invalidation the
+        // core update would take.
+        const auto terminalPosition = _getTerminalPosition(til::point{ pixelPosition });
+        const auto update = std::make_pair(terminalPosition, _core->ScrollOffset());
+        if (update == _lastDragSelectionUpdate)
+        {
+            return;
+        }
+        _lastDragSelectionUpdate = update;
+
+        _core->SetEndSelectionPoint(terminalPosition);
         _selectionNeedsToBeCopied = true;
     }
 
@@ -123,6 +123,13 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         // terminal.
         bool _selectionNeedsToBeCopied;
 
+        // The last cell (and scroll offset) a drag pushed the selection
+        // endpoint to. Pointer samples arrive far more often than the pointer
+        // crosses cells (a gaming mouse polls at 1 kHz), and a sample that
+        // lands in the same cell as the previous one can't change the
+        // selection, so SetEndSelectionPoint() skips it entirely.
+        std::optional<std::pair<til::point, int>> _lastDragSelectionUpdate;
+
         std::optional<COORD> _lastHoveredCell{ std::nullopt };
         // Track the last hyperlink ID we hovered over
         uint16_t _lastHoveredId{ 0 };
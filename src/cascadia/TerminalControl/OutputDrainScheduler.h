@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+namespace Microsoft::Terminal::Control
+{
+    // Serializes the application of connection output across all the panes
+    // in this process. Every ControlCore applies output on its own
+    // connection thread, so when one producer feeds several panes (or one
+    // pane fire-hoses while its siblings trickle), the panes drain in
+    // whatever order the OS schedules those threads and a busy pane can
+    // starve the others' Terminal::Write turns.
+    //
+    // When enabled, each pane takes a FIFO ticket before applying a chunk
+    // and hands the turn to the next waiter when the chunk lands. A chunk
+    // is bounded by the connection's read buffer, so a turn carries a
+    // natural byte budget: a fire-hose pane re-queues behind its siblings
+    // after every chunk and the panes advance in round-robin order. When
+    // only one pane is producing, a turn is an uncontended mutex
+    // acquisition. Disabled (the default), the whole gate is a relaxed
+    // atomic load per chunk.
+    class OutputDrainScheduler
+    {
+    public:
+        static OutputDrainScheduler& Instance() noexcept
+        {
+            static OutputDrainScheduler scheduler;
+            return scheduler;
+        }
+
+        void SetEnabled(const bool enabled) noexcept
+        {
+            _enabled.store(enabled, std::memory_order_relaxed);
+        }
+
+        // One pass through the scheduler: construction waits for this
+        // thread's turn while sibling panes are draining, destruction hands
+        // the turn on. Turns taken while the scheduler is disabled are
+        // free, and pair up correctly if the setting flips mid-drain.
+        class Turn
+        {
+        public:
+            explicit Turn(OutputDrainScheduler& scheduler)
+            {
+                if (scheduler._enabled.load(std::memory_order_relaxed))
+                {
+                    _scheduler = &scheduler;
+                    scheduler._waitForTurn();
+                }
+            }
+
+            ~Turn()
+            {
+                if (_scheduler)
+                {
+                    _scheduler->_advanceTurn();
+                }
+            }
+
+            Turn(const Turn&) = delete;
+            Turn(Turn&&) = delete;
+            Turn& operator=(const Turn&) = delete;
+            Turn& operator=(Turn&&) = delete;
+
+        private:
+            OutputDrainScheduler* _scheduler = nullptr;
+        };
+
+    private:
+        OutputDrainScheduler() = default;
+
+        void _waitForTurn()
+        {
+            std::unique_lock lock{ _mutex };
+            const auto ticket = _nextTicket++;
+            _turnChanged.wait(lock, [&]() { return _nowServing == ticket; });
+        }
+
+        void _advanceTurn()
+        {
+            {
+                const std::scoped_lock lock{ _mutex };
+                _nowServing++;
+            }
+            _turnChanged.notify_all();
+        }
+
+        std::atomic<bool> _enabled{ false };
+        std::mutex _mutex;
+        std::condition_variable _turnChanged;
+        uint64_t _nextTicket = 0;
+        uint64_t _nowServing = 0;
+    };
+}
@@ -70,6 +70,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         _layoutRequestedRevoker.revoke();
         _compositionCompletedRevoker.revoke();
         _textUpdatingRevoker.revoke();
+        _compositionRenderingRevoker.revoke();
     }
 
     // Method Description:
@@ -123,6 +124,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             _editContext.NotifyFocusEnter();
             _activeTextStart = 0;
             _inComposition = false;
+            _compositionRenderingRevoker.revoke();
         }
     }
 
@@ -268,7 +270,15 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     {
         auto request = args.Request();
 
-        TryRedrawCanvas();
+        // During an active composition the anchor geometry is refreshed once
+        // per rendered frame instead (see _compositionStartedHandler), so the
+        // flurry of layout requests the IME raises while converting doesn't
+        // each force a layout pass on the XAML tree. Outside of a composition
+        // these requests are rare enough to recompute synchronously.
+        if (!_inComposition)
+        {
+            TryRedrawCanvas();
+        }
 
         // Set the text block bounds
         request.LayoutBounds().TextBounds(_currentTextBounds);
@@ -288,6 +298,19 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     void TSFInputControl::_compositionStartedHandler(CoreTextEditContext sender, CoreTextCompositionStartedEventArgs const& /*args*/)
     {
         _inComposition = true;
+
+        // Compute the anchor geometry now, then keep it fresh once per
+        // rendered frame for as long as the composition lasts. TSF callbacks
+        // answer from the cached bounds, so however many of them arrive per
+        // keystroke, the XAML tree only gets measured once a frame.
+        TryRedrawCanvas();
+        _compositionRenderingRevoker = Media::CompositionTarget::Rendering(winrt::auto_revoke,
+                                                                           [weakThis = get_weak()](auto&&, auto&&) {
+                                                                               if (auto control{ weakThis.get() })
+                                                                               {
+                                                                                   control->TryRedrawCanvas();
+                                                                               }
+                                                                           });
     }
 
     // Method Description:
@@ -301,6 +324,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     void TSFInputControl::_compositionCompletedHandler(CoreTextEditContext sender, CoreTextCompositionCompletedEventArgs const& /*args*/)
     {
         _inComposition = false;
+        _compositionRenderingRevoker.revoke();
 
         // only need to do work if the current buffer has text
         if (!_inputBuffer.empty())
@@ -67,6 +67,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         winrt::Windows::UI::Text::Core::CoreTextEditContext::LayoutRequested_revoker _layoutRequestedRevoker;
         winrt::Windows::UI::Text::Core::CoreTextEditContext::CompositionStarted_revoker _compositionStartedRevoker;
         winrt::Windows::UI::Text::Core::CoreTextEditContext::CompositionCompleted_revoker _compositionCompletedRevoker;
+        winrt::Windows::UI::Xaml::Media::CompositionTarget::Rendering_revoker _compositionRenderingRevoker;
 
         Windows::UI::Text::Core::CoreTextEditContext _editContext;
 
@@ -10,6 +10,7 @@
 
 #include "TermControlAutomationPeer.h"
 #include "../../types/inc/GlyphWidth.hpp"
+#include "../../inc/ConsolePerfCounters.h"
 #include "../../renderer/atlas/AtlasEngine.h"
 
 #include "TermControl.g.cpp"
@@ -63,6 +64,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
 
         _interactivity = winrt::make<implementation::ControlInteractivity>(settings, unfocusedAppearance, connection);
         _core = _interactivity.Core();
+        _keyBindings = settings.KeyBindings();
 
         // These events might all be triggered by the connection, but that
         // should be drained and closed before we complete destruction. So these
@@ -141,10 +143,27 @@ namespace winrt::Microsoft::Terminal::Control::implementation
                 }
             });
 
+        _updateScrollPosition = std::make_shared<ThrottledFuncTrailing<double>>(
+            dispatcher,
+            ScrollBarUpdateInterval,
+            [weakThis = get_weak()](const auto newValue) {
+                if (auto control{ weakThis.get() }; !control->_IsClosing())
+                {
+                    control->_interactivity.UpdateScrollbar(newValue);
+                }
+            });
+
         static constexpr auto AutoScrollUpdateInterval = std::chrono::microseconds(static_cast<int>(1.0 / 30.0 * 1000000));
         _autoScrollTimer.Interval(AutoScrollUpdateInterval);
         _autoScrollTimer.Tick({ this, &TermControl::_UpdateAutoScroll });
 
+        // Run the fling animation at the display-ish cadence; the resulting
+        // scrollbar changes are sampled by _updateScrollPosition anyway, so a
+        // faster timer would only burn cycles.
+        static constexpr auto FlingScrollUpdateInterval = std::chrono::microseconds(static_cast<int>(1.0 / 60.0 * 1000000));
+        _flingScrollTimer.Interval(FlingScrollUpdateInterval);
+        _flingScrollTimer.Tick({ this, &TermControl::_UpdateFlingScroll });
+
         _ApplyUISettings();
     }
 
@@ -247,6 +266,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         co_await wil::resume_foreground(Dispatcher());
 
         _core.UpdateSettings(settings, unfocusedAppearance);
+        _keyBindings = settings.KeyBindings();
 
         _UpdateSettingsFromUIThread();
 
@@ -334,6 +354,87 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         _core.ToggleShaderEffects();
     }
 
+    // Method Description:
+    // - Show or hide the performance HUD, a small overlay in the top-right
+    //   corner displaying frame rate, parser throughput and the
+    //   input-to-present latency summary from the module-wide perf counters.
+    //   The overlay element is x:Load deferred, so controls that never show
+    //   it pay nothing, and the refresh timer only runs while it's visible.
+    void TermControl::TogglePerformanceHud()
+    {
+        if (_perfHudTimer)
+        {
+            _perfHudTimer->Stop();
+            _perfHudTimer.reset();
+            PerfHudBorder().Visibility(Visibility::Collapsed);
+            return;
+        }
+
+        if (auto loadedUiElement{ FindName(L"PerfHudBorder") })
+        {
+            if (auto uiElement{ loadedUiElement.try_as<::winrt::Windows::UI::Xaml::UIElement>() })
+            {
+                uiElement.Visibility(Visibility::Visible);
+            }
+        }
+
+        // Prime the snapshots, so the first tick reports the rates over its
+        // own interval rather than over the counters' lifetime totals.
+        const auto& counters = ::Microsoft::Console::PerfCounters::Instance();
+        _perfHudLastBytesIngested = counters.bytesIngested.load(std::memory_order_relaxed);
+        _perfHudLastFramesPainted = counters.framesPainted.load(std::memory_order_relaxed);
+        _perfHudLastSequencesDispatched = counters.sequencesDispatched.load(std::memory_order_relaxed);
+        _perfHudLastTick = std::chrono::high_resolution_clock::now();
+
+        DispatcherTimer perfHudTimer;
+        perfHudTimer.Interval(std::chrono::milliseconds(1000));
+        perfHudTimer.Tick({ get_weak(), &TermControl::_PerfHudTimerTick });
+        perfHudTimer.Start();
+        _perfHudTimer.emplace(std::move(perfHudTimer));
+
+        // Fill the overlay right away instead of leaving it blank until the
+        // first interval elapses; the rates will read as zero, truthfully.
+        _PerfHudTimerTick(nullptr, nullptr);
+    }
+
+    void TermControl::_PerfHudTimerTick(Windows::Foundation::IInspectable const& /* sender */,
+                                        Windows::Foundation::IInspectable const& /* e */)
+    {
+        const auto& counters = ::Microsoft::Console::PerfCounters::Instance();
+
+        const auto now = std::chrono::high_resolution_clock::now();
+        const auto seconds = std::max(std::chrono::duration<double>(now - _perfHudLastTick).count(), 0.001);
+
+        const auto bytes = counters.bytesIngested.load(std::memory_order_relaxed);
+        const auto frames = counters.framesPainted.load(std::memory_order_relaxed);
+        const auto sequences = counters.sequencesDispatched.load(std::memory_order_relaxed);
+
+        const auto fps = static_cast<double>(frames - _perfHudLastFramesPainted) / seconds;
+        const auto mbps = static_cast<double>(bytes - _perfHudLastBytesIngested) / seconds / (1024.0 * 1024.0);
+        const auto seqps = static_cast<double>(sequences - _perfHudLastSequencesDispatched) / seconds;
+
+        _perfHudLastBytesIngested = bytes;
+        _perfHudLastFramesPainted = frames;
+        _perfHudLastSequencesDispatched = sequences;
+        _perfHudLastTick = now;
+
+        // The percentiles are lifetime values - the histogram has no
+        // windowed reset - which is what you want when chasing an
+        // intermittent stall: the p99 remembers it.
+        const auto& latency = counters.inputToPresentLatency;
+        const auto bufferMiB = static_cast<double>(_core.BufferMemoryBytes()) / (1024.0 * 1024.0);
+        const auto text = fmt::format(L"{:5.1f} fps  {:6.2f} MB/s  {:6.0f} seq/s  {:6.1f} MiB buf\nlatency p50 {} us  p90 {} us  p99 {} us  max {} us",
+                                      fps,
+                                      mbps,
+                                      seqps,
+                                      bufferMiB,
+                                      latency.EstimatePercentile(50.0),
+                                      latency.EstimatePercentile(90.0),
+                                      latency.EstimatePercentile(99.0),
+                                      latency.maxMicroseconds.load(std::memory_order_relaxed));
+        PerfHudText().Text(winrt::hstring{ text });
+    }
+
     // Method Description:
     // - Style our UI elements based on the values in our settings, and set up
     //   other control-specific settings. This method will be called whenever
@@ -865,7 +966,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             //   This is required as part of GH#638.
             // Or do so for alt+space; only send to terminal when explicitly unbound
             //  That is part of #GH7125
-            auto bindings{ _core.Settings().KeyBindings() };
+            const auto& bindings{ _keyBindings };
             bool isUnbound = false;
             const KeyChord kc = {
                 modifiers.IsCtrlPressed(),
@@ -1010,19 +1111,15 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     // - modifiers: The ControlKeyStates representing the modifier key states.
     bool TermControl::_TryHandleKeyBinding(const WORD vkey, const WORD scanCode, ::Microsoft::Terminal::Core::ControlKeyStates modifiers) const
     {
-        // TODO: GH#5000
-        // The Core owning the keybindings is weird. That's for sure. In the
-        // future, we may want to pass the keybindings into the control
-        // separately, so the control can have a pointer to an in-proc
-        // Keybindings object, rather than routing through the ControlCore.
-        // (see GH#5000)
-        auto bindings = _core.Settings().KeyBindings();
-        if (!bindings)
+        // GH#5000: the bindings are cached on the control itself, so the
+        // per-keystroke dispatch doesn't route through the ControlCore's
+        // settings object.
+        if (!_keyBindings)
         {
             return false;
         }
 
-        auto success = bindings.TryKeyChord({
+        auto success = _keyBindings.TryKeyChord({
             modifiers.IsCtrlPressed(),
             modifiers.IsAltPressed(),
             modifiers.IsShiftPressed(),
@@ -1162,9 +1259,15 @@ namespace winrt::Microsoft::Terminal::Control::implementation
 
         if (type == Windows::Devices::Input::PointerDeviceType::Touch)
         {
+            // Catching the viewport stops any fling that's still coasting.
+            _StopFlingScroll();
+
             const auto contactRect = point.Properties().ContactRect();
             auto anchor = til::point{ til::math::rounding, contactRect.X, contactRect.Y };
             _interactivity.TouchPressed(anchor.to_core_point());
+
+            _touchPanVelocity = 0.0;
+            _lastTouchSample = { { contactRect.Y, point.Timestamp() } };
         }
         else
         {
@@ -1255,6 +1358,22 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             til::point newTouchPoint{ til::math::rounding, contactRect.X, contactRect.Y };
 
             _interactivity.TouchMoved(newTouchPoint.to_core_point(), _focused);
+
+            // Keep a running estimate of how fast the finger is moving, so
+            // releasing it mid-motion can coast at the same velocity.
+            if (_lastTouchSample)
+            {
+                const auto [lastY, lastTimestamp] = *_lastTouchSample;
+                const auto deltaTime = (point.Timestamp() - lastTimestamp) / 1000000.0;
+                if (deltaTime > 0)
+                {
+                    // Exponentially smooth the estimate; individual touch
+                    // deltas are far too noisy to use directly.
+                    const auto velocity = (contactRect.Y - lastY) / deltaTime;
+                    _touchPanVelocity = 0.6 * velocity + 0.4 * _touchPanVelocity;
+                }
+            }
+            _lastTouchSample = { { contactRect.Y, point.Timestamp() } };
         }
 
         args.Handled(true);
@@ -1295,6 +1414,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         else if (type == Windows::Devices::Input::PointerDeviceType::Touch)
         {
             _interactivity.TouchReleased();
+            _TryStartFlingScroll();
         }
 
         _TryStopAutoScroll(ptr.PointerId());
@@ -1320,6 +1440,9 @@ namespace winrt::Microsoft::Terminal::Control::implementation
 
         _RestorePointerCursorHandlers(*this, nullptr);
 
+        // Wheel input takes over from a coasting touch fling.
+        _StopFlingScroll();
+
         const auto point = args.GetCurrentPoint(*this);
         // GH#10329 - we don't need to handle horizontal scrolls. Only vertical ones.
         // So filter out the horizontal ones.
@@ -1413,8 +1536,14 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             return;
         }
 
+        // A fast scrollbar drag fires ValueChanged for every intermediate
+        // position - far more often than we can render. Sample the stream at
+        // the scrollbar update cadence instead: the throttled func coalesces
+        // the ticks and always delivers the most recent value, so skipped
+        // positions are never rendered and the final position is applied
+        // exactly.
         const auto newValue = args.NewValue();
-        _interactivity.UpdateScrollbar(newValue);
+        _updateScrollPosition->Run(newValue);
 
         // User input takes priority over terminal events so cancel
         // any pending scroll bar update if the user scrolls.
@@ -1539,6 +1668,86 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         }
     }
 
+    // Method Description:
+    // - Starts coasting the viewport if a touch pan was released while the
+    //   finger was still moving fast enough to count as a fling. The scroll
+    //   continues at the release velocity and decelerates from there.
+    // Arguments:
+    // - none
+    void TermControl::_TryStartFlingScroll()
+    {
+        const auto fontHeightDips = CharacterDimensions().Height / SwapChainPanel().CompositionScaleY();
+        // Panning the finger down moves the viewport up, so flip the sign
+        // when converting the pan velocity into scrollbar rows.
+        const auto rowsPerSec = fontHeightDips > 0 ? -_touchPanVelocity / fontHeightDips : 0.0;
+        _touchPanVelocity = 0.0;
+        _lastTouchSample = std::nullopt;
+
+        // Slower releases are the end of a drag, not a fling; let those stop
+        // exactly where the finger left them.
+        constexpr double MinFlingVelocity = 10.0; // rows per second
+        if (std::abs(rowsPerSec) >= MinFlingVelocity)
+        {
+            _flingVelocity = rowsPerSec;
+            _lastFlingUpdateTime = std::chrono::high_resolution_clock::now();
+            if (!_flingScrollTimer.IsEnabled())
+            {
+                _flingScrollTimer.Start();
+            }
+        }
+    }
+
+    // Method Description:
+    // - Stops a coasting fling scroll, if one is active.
+    // Arguments:
+    // - none
+    void TermControl::_StopFlingScroll()
+    {
+        _flingVelocity = 0.0;
+        _lastFlingUpdateTime = std::nullopt;
+        if (_flingScrollTimer.IsEnabled())
+        {
+            _flingScrollTimer.Stop();
+        }
+    }
+
+    // Method Description:
+    // - Called continuously while a fling is coasting. Moves the scrollbar by
+    //   the current velocity and decays the velocity, stopping once it's too
+    //   slow to move a row per second or the scrollbar hits either end.
+    // Arguments:
+    // - none
+    void TermControl::_UpdateFlingScroll(Windows::Foundation::IInspectable const& /* sender */,
+                                         Windows::Foundation::IInspectable const& /* e */)
+    {
+        const auto timeNow = std::chrono::high_resolution_clock::now();
+
+        if (_lastFlingUpdateTime)
+        {
+            static constexpr double microSecPerSec = 1000000.0;
+            const double deltaTime = std::chrono::duration_cast<std::chrono::microseconds>(timeNow - *_lastFlingUpdateTime).count() / microSecPerSec;
+
+            const auto scrollBar = ScrollBar();
+            const auto newValue = scrollBar.Value() + _flingVelocity * deltaTime;
+            scrollBar.Value(newValue);
+
+            // Exponential deceleration: the fling loses about half its speed
+            // every third of a second, which is close to the system's flick
+            // feel.
+            _flingVelocity *= std::exp(-2.0 * deltaTime);
+
+            if (std::abs(_flingVelocity) < 1.0 ||
+                newValue <= scrollBar.Minimum() ||
+                newValue >= scrollBar.Maximum())
+            {
+                _StopFlingScroll();
+                return;
+            }
+        }
+
+        _lastFlingUpdateTime = timeNow;
+    }
+
     // Method Description:
     // - Event handler for the GotFocus event. This is used to...
     //   - enable accessibility notifications for this TermControl
@@ -1561,6 +1770,10 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         // The _uiaEngine lives in _interactivity, so call into there to enable it.
         _interactivity.GotFocus();
 
+        // Restore full activity levels - paint cadence, pattern scanning -
+        // now that someone's looking at us again.
+        _core.SetBackgrounded(false);
+
         // If the searchbox is focused, we don't want TSFInputControl to think
         // it has focus so it doesn't intercept IME input. We also don't want the
         // terminal's cursor to start blinking. So, we'll just return quickly here.
@@ -1616,6 +1829,11 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         // UiaEngine lives in ControlInteractivity
         _interactivity.LostFocus();
 
+        // An unfocused pane doesn't need full activity levels; this joins
+        // the cursor and attribute blink timers we already stop below. A
+        // bell or refocus promotes it back instantly.
+        _core.SetBackgrounded(true);
+
         if (TSFInputControl() != nullptr)
         {
             TSFInputControl().NotifyFocusLeave();
@@ -1834,6 +2052,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             // Disconnect the TSF input control so it doesn't receive EditContext events.
             TSFInputControl().Close();
             _autoScrollTimer.Stop();
+            _flingScrollTimer.Stop();
 
             _core.Close();
         }
@@ -2619,6 +2838,20 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         _ReadOnlyChangedHandlers(*this, winrt::box_value(_core.IsInReadOnlyMode()));
     }
 
+    // Method Description:
+    // - How much wall time this control's core has spent ingesting its
+    //   connection's output. Lets the app layer compare panes and surface
+    //   the one burning the CPU.
+    uint64_t TermControl::OutputIngestMicroseconds() const
+    {
+        return _core.OutputIngestMicroseconds();
+    }
+
+    uint64_t TermControl::BufferMemoryBytes() const
+    {
+        return _core.BufferMemoryBytes();
+    }
+
     // Method Description:
     // - Handle a mouse exited event, specifically clearing last hovered cell
     // and removing selection from hyper link if exists
@@ -2747,6 +2980,16 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         return _core.ReadEntireBuffer();
     }
 
+    winrt::guid TermControl::SessionId() const noexcept
+    {
+        return _core.SessionId();
+    }
+
+    void TermControl::RestorePersistedBuffer(const winrt::guid& sessionId, const hstring& content) const
+    {
+        _core.RestorePersistedBuffer(sessionId, content);
+    }
+
     Core::Scheme TermControl::ColorScheme() const noexcept
     {
         return _core.ColorScheme();
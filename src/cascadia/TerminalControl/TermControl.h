@@ -74,6 +74,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         void ClearBuffer(Control::ClearBufferType clearType);
 
         void ToggleShaderEffects();
+        void TogglePerformanceHud();
 
         winrt::fire_and_forget RenderEngineSwapChainChanged(IInspectable sender, IInspectable args);
         void _AttachDxgiSwapChainToXaml(HANDLE swapChainHandle);
@@ -104,12 +105,18 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         bool ReadOnly() const noexcept;
         void ToggleReadOnly();
 
+        uint64_t OutputIngestMicroseconds() const;
+        uint64_t BufferMemoryBytes() const;
+
         static Control::MouseButtonState GetPressedMouseButtons(const winrt::Windows::UI::Input::PointerPoint point);
         static unsigned int GetPointerUpdateKind(const winrt::Windows::UI::Input::PointerPoint point);
         static Windows::UI::Xaml::Thickness ParseThicknessFromPadding(const hstring padding);
 
         hstring ReadEntireBuffer() const;
 
+        winrt::guid SessionId() const noexcept;
+        void RestorePersistedBuffer(const winrt::guid& sessionId, const hstring& content) const;
+
         winrt::Microsoft::Terminal::Core::Scheme ColorScheme() const noexcept;
         void ColorScheme(const winrt::Microsoft::Terminal::Core::Scheme& scheme) const noexcept;
 
@@ -152,6 +159,11 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         Control::ControlInteractivity _interactivity{ nullptr };
         Control::ControlCore _core{ nullptr };
 
+        // GH#5000: Cached from the settings at construction and on
+        // UpdateControlSettings, so per-keystroke dispatch doesn't have to
+        // fetch the bindings back out of the core's settings object.
+        Control::IKeyBindings _keyBindings{ nullptr };
+
         winrt::com_ptr<SearchBoxControl> _searchBox;
 
         bool _closing{ false };
@@ -170,6 +182,11 @@ namespace winrt::Microsoft::Terminal::Control::implementation
 
         std::shared_ptr<ThrottledFuncTrailing<ScrollBarUpdate>> _updateScrollBar;
 
+        // Throttles scrollbar-driven viewport updates in the other direction
+        // (UI -> core), so a fast drag through a deep scrollback samples the
+        // positions it renders instead of rendering every intermediate one.
+        std::shared_ptr<ThrottledFuncTrailing<double>> _updateScrollPosition;
+
         bool _isInternalScrollBarUpdate;
 
         // Auto scroll occurs when user, while selecting, drags cursor outside
@@ -180,12 +197,30 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         std::optional<std::chrono::high_resolution_clock::time_point> _lastAutoScrollUpdateTime;
         bool _pointerPressedInBounds{ false };
 
+        // Kinetic scrolling: when a touch pan is released while the finger is
+        // still moving, the viewport coasts at the release velocity and
+        // decelerates instead of stopping dead.
+        double _touchPanVelocity{ 0.0 }; // DIPs per second, while the finger is down
+        std::optional<std::pair<float, uint64_t>> _lastTouchSample; // contact Y in DIPs, timestamp in microseconds
+        double _flingVelocity{ 0.0 }; // rows per second, while coasting
+        Windows::UI::Xaml::DispatcherTimer _flingScrollTimer;
+        std::optional<std::chrono::high_resolution_clock::time_point> _lastFlingUpdateTime;
+
         winrt::Windows::UI::Composition::ScalarKeyFrameAnimation _bellLightAnimation{ nullptr };
         Windows::UI::Xaml::DispatcherTimer _bellLightTimer{ nullptr };
 
         std::optional<Windows::UI::Xaml::DispatcherTimer> _cursorTimer;
         std::optional<Windows::UI::Xaml::DispatcherTimer> _blinkTimer;
 
+        // Performance HUD: the timer only runs while the overlay is shown,
+        // and the snapshots below turn the monotonic process-wide counters
+        // into per-second rates between ticks.
+        std::optional<Windows::UI::Xaml::DispatcherTimer> _perfHudTimer;
+        uint64_t _perfHudLastBytesIngested{ 0 };
+        uint64_t _perfHudLastFramesPainted{ 0 };
+        uint64_t _perfHudLastSequencesDispatched{ 0 };
+        std::chrono::high_resolution_clock::time_point _perfHudLastTick{};
+
         winrt::Windows::UI::Xaml::Controls::SwapChainPanel::LayoutUpdated_revoker _layoutUpdatedRevoker;
 
         inline bool _IsClosing() const noexcept
@@ -235,6 +270,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         void _CursorTimerTick(Windows::Foundation::IInspectable const& sender, Windows::Foundation::IInspectable const& e);
         void _BlinkTimerTick(Windows::Foundation::IInspectable const& sender, Windows::Foundation::IInspectable const& e);
         void _BellLightOff(Windows::Foundation::IInspectable const& sender, Windows::Foundation::IInspectable const& e);
+        void _PerfHudTimerTick(Windows::Foundation::IInspectable const& sender, Windows::Foundation::IInspectable const& e);
 
         void _SetEndSelectionPointAtCursor(Windows::Foundation::Point const& cursorPosition);
 
@@ -253,6 +289,10 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         void _TryStopAutoScroll(const uint32_t pointerId);
         void _UpdateAutoScroll(Windows::Foundation::IInspectable const& sender, Windows::Foundation::IInspectable const& e);
 
+        void _TryStartFlingScroll();
+        void _StopFlingScroll();
+        void _UpdateFlingScroll(Windows::Foundation::IInspectable const& sender, Windows::Foundation::IInspectable const& e);
+
         void _KeyHandler(Windows::UI::Xaml::Input::KeyRoutedEventArgs const& e, const bool keyDown);
         static ::Microsoft::Terminal::Core::ControlKeyStates _GetPressedModifierKeys() noexcept;
         bool _TryHandleKeyBinding(const WORD vkey, const WORD scanCode, ::Microsoft::Terminal::Core::ControlKeyStates modifiers) const;
@@ -131,9 +131,19 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         {
             return;
         }
+
+        // If a selection changed event we queued earlier hasn't been raised
+        // yet, it already covers this change too. Don't queue another one.
+        if (_selectionChangedPending.exchange(true))
+        {
+            return;
+        }
+
         dispatcher.RunAsync(Windows::UI::Core::CoreDispatcherPriority::Normal, [weakThis{ get_weak() }]() {
             if (auto strongThis{ weakThis.get() })
             {
+                strongThis->_selectionChangedPending.store(false);
+
                 // The event that is raised when the text selection is modified.
                 strongThis->RaiseAutomationEvent(AutomationEvents::TextPatternOnTextSelectionChanged);
             }
@@ -154,9 +164,26 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         {
             return;
         }
+
+        // The automation event has no payload - when it's raised, the client
+        // re-reads whatever portion of the buffer it cares about. During
+        // sustained output we can easily produce these signals faster than
+        // the UI thread (busy serving those very reads) can raise the events,
+        // and every queued stale event would goad the client into yet another
+        // full re-read. A single pending event covers all the changes that
+        // happen before it's raised, so collapse the signals down to one.
+        if (_textChangedPending.exchange(true))
+        {
+            return;
+        }
+
         dispatcher.RunAsync(Windows::UI::Core::CoreDispatcherPriority::Normal, [weakThis{ get_weak() }]() {
             if (auto strongThis{ weakThis.get() })
             {
+                // Clear the flag before raising the event: changes that land
+                // during the raise need a fresh event of their own.
+                strongThis->_textChangedPending.store(false);
+
                 // The event that is raised when textual content is modified.
                 strongThis->RaiseAutomationEvent(AutomationEvents::TextPatternOnTextChanged);
             }
@@ -177,9 +204,18 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         {
             return;
         }
+
+        // As above, collapse signals that are still waiting on the UI thread.
+        if (_cursorChangedPending.exchange(true))
+        {
+            return;
+        }
+
         dispatcher.RunAsync(Windows::UI::Core::CoreDispatcherPriority::Normal, [weakThis{ get_weak() }]() {
             if (auto strongThis{ weakThis.get() })
             {
+                strongThis->_cursorChangedPending.store(false);
+
                 // The event that is raised when the text was changed in an edit control.
                 // Do NOT fire a TextEditTextChanged. Generally, an app on the other side
                 //    will expect more information. Though you can dispatch that event
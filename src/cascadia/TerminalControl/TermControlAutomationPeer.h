@@ -81,5 +81,13 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         winrt::Microsoft::Terminal::Control::implementation::TermControl* _termControl;
         Control::InteractivityAutomationPeer _contentAutomationPeer;
         std::deque<wchar_t> _keyEvents;
+
+        // These track whether a signal we dispatched to the UI thread hasn't
+        // been raised yet. The automation events carry no payload, so a
+        // pending event already covers any changes that happen before it is
+        // raised - there's no point in queueing another one behind it.
+        std::atomic<bool> _selectionChangedPending{ false };
+        std::atomic<bool> _textChangedPending{ false };
+        std::atomic<bool> _cursorChangedPending{ false };
     };
 }
@@ -39,6 +39,10 @@ namespace Microsoft::Terminal::Core
         virtual bool EraseInLine(const ::Microsoft::Console::VirtualTerminal::DispatchTypes::EraseType eraseType) = 0;
         virtual bool EraseInDisplay(const ::Microsoft::Console::VirtualTerminal::DispatchTypes::EraseType eraseType) = 0;
 
+        virtual void SetScrollingRegion(const size_t topMargin, const size_t bottomMargin) = 0;
+        virtual void ScrollUp(const size_t distance) = 0;
+        virtual void ScrollDown(const size_t distance) = 0;
+
         virtual void WarningBell() = 0;
         virtual void SetWindowTitle(std::wstring_view title) = 0;
 
@@ -69,6 +73,8 @@ namespace Microsoft::Terminal::Core
         virtual void PushGraphicsRendition(const ::Microsoft::Console::VirtualTerminal::VTParameters options) = 0;
         virtual void PopGraphicsRendition() = 0;
 
+        virtual void SetGlyphWidthHint(const size_t count, const bool isFullWidth) = 0;
+
         virtual void UseAlternateScreenBuffer() = 0;
         virtual void UseMainScreenBuffer() = 0;
 
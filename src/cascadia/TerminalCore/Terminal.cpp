@@ -6,6 +6,7 @@
 #include "../../terminal/parser/OutputStateMachineEngine.hpp"
 #include "TerminalDispatch.hpp"
 #include "../../inc/unicode.hpp"
+#include "../../types/inc/Utf16Parser.hpp"
 #include "../../types/inc/utils.hpp"
 #include "../../types/inc/colorTable.hpp"
 
@@ -124,6 +125,12 @@ void Terminal::UpdateSettings(ICoreSettings settings)
 
     _terminalInput->ForceDisableWin32InputMode(settings.ForceVTInput());
 
+    // The scrollback memory ceiling spans every terminal instance in the
+    // process, so whichever pane applies settings last wins - they all carry
+    // the same global value. The setting is in megabytes; the budget works
+    // in bytes.
+    BufferMemoryBudget::Instance().SetCeiling(static_cast<uint64_t>(settings.ScrollbackMemoryCeiling()) * 1024 * 1024);
+
     if (settings.TabColor() == nullptr)
     {
         _tabColor = std::nullopt;
@@ -234,6 +241,18 @@ void Terminal::UpdateAppearance(const ICoreAppearance& appearance)
         return S_FALSE;
     }
 
+    // Reflowing moves cells around; whatever we predicted would land in the
+    // wrong place afterwards, so undo it while the coordinates still mean
+    // something.
+    if constexpr (Feature_PredictiveEcho::IsEnabled())
+    {
+        try
+        {
+            _RollbackPredictions();
+        }
+        CATCH_LOG();
+    }
+
     const auto dx = ::base::ClampSub(viewportSize.X, oldDimensions.X);
     const short newBufferHeight = ::base::ClampAdd(viewportSize.Y, _scrollbackLines);
 
@@ -470,23 +489,82 @@ void Terminal::UpdateAppearance(const ICoreAppearance& appearance)
 
 void Terminal::Write(std::wstring_view stringView)
 {
-    auto lock = LockForWriting();
+    // Process the output in bounded slices and drop the lock between them.
+    // _readWriteLock is a FIFO ticket lock, so a UI thread that parks on it
+    // mid-write (scrolling, selection) is handed the lock after at most one
+    // slice, instead of waiting behind however many megabytes the connection
+    // delivered in one chunk. The state machine carries partial sequences
+    // across ProcessString calls, so slicing is safe anywhere except through
+    // the middle of a surrogate pair.
+    constexpr size_t maxWriteSliceLength = 8192;
+
+    std::optional<til::point> cursorPosBefore;
+
+    while (!stringView.empty())
+    {
+        auto slice = stringView.substr(0, maxWriteSliceLength);
+        if (slice.size() < stringView.size() && Utf16Parser::IsLeadingSurrogate(slice.back()))
+        {
+            slice = slice.substr(0, slice.size() - 1);
+        }
+        stringView = stringView.substr(slice.size());
 
-    auto& cursor = _activeBuffer().GetCursor();
-    const til::point cursorPosBefore{ cursor.GetPosition() };
+        auto lock = LockForWriting();
 
-    _stateMachine->ProcessString(stringView);
+        if (!cursorPosBefore)
+        {
+            // Undo any provisional local echo before the real output paints
+            // over it; see _PreviewEcho().
+            if constexpr (Feature_PredictiveEcho::IsEnabled())
+            {
+                _RollbackPredictions();
+            }
+            cursorPosBefore = til::point{ _activeBuffer().GetCursor().GetPosition() };
+        }
 
-    const til::point cursorPosAfter{ cursor.GetPosition() };
+        _stateMachine->ProcessString(slice);
 
-    // Firing the CursorPositionChanged event is very expensive so we try not to
-    // do that when the cursor does not need to be redrawn. We don't do this
-    // inside _AdjustCursorPosition, only once we're done writing the whole run
-    // of output.
-    if (cursorPosBefore != cursorPosAfter)
+        // Firing the CursorPositionChanged event is very expensive so we try not to
+        // do that when the cursor does not need to be redrawn. We don't do this
+        // inside _AdjustCursorPosition, only once we're done writing the whole run
+        // of output.
+        if (stringView.empty())
+        {
+            const til::point cursorPosAfter{ _activeBuffer().GetCursor().GetPosition() };
+            if (cursorPosBefore != cursorPosAfter)
+            {
+                _NotifyTerminalCursorPositionChanged();
+            }
+        }
+    }
+}
+
+// Method Description:
+// - One bounded slice of background housekeeping, for the control to run
+//   while this terminal is verifiably idle. Re-packs scrollback rows that
+//   reads rehydrated and trims attribute run capacity left from past peaks;
+//   the buffer remembers where the previous slice stopped, so repeated calls
+//   sweep the whole scrollback a little at a time. Skipped in the alt buffer,
+//   whose screen-sized contents aren't worth sweeping and whose apps
+//   (editors, pagers) repaint on their own schedule.
+// - The caller must hold the terminal lock.
+// Return Value:
+// - true when a full pass over the cold scrollback has completed
+bool Terminal::PerformIdleMaintenance()
+{
+    if (_inAltBuffer())
     {
-        _NotifyTerminalCursorPositionChanged();
+        return true;
     }
+
+    // Mirror the cold-row boundary used as content scrolls: everything more
+    // than a viewport height above the viewport is cold.
+    const auto firstActiveRow = std::max(0, _mutableViewport.Top() - _mutableViewport.Height());
+
+    // Small enough that a slice finishes in well under a millisecond and the
+    // lock is never held long against a pane waking back up.
+    constexpr size_t maintenanceRowsPerSlice = 512;
+    return _activeBuffer().PerformIdleMaintenance(gsl::narrow_cast<size_t>(firstActiveRow), maintenanceRowsPerSlice);
 }
 
 void Terminal::WritePastedText(std::wstring_view stringView)
@@ -698,7 +776,20 @@ bool Terminal::SendKeyEvent(const WORD vkey,
     }
 
     KeyEvent keyEv{ keyDown, 1, vkey, sc, ch, states.Value() };
-    return _terminalInput->HandleKey(&keyEv);
+    const auto handled = _terminalInput->HandleKey(&keyEv);
+
+    // Cursor keys and friends move us off the cells we predicted on; stop
+    // guessing until the application has answered.
+    if constexpr (Feature_PredictiveEcho::IsEnabled())
+    {
+        if (handled && keyDown)
+        {
+            auto lock = LockForWriting();
+            _RollbackPredictions();
+        }
+    }
+
+    return handled;
 }
 
 // Method Description:
@@ -759,9 +850,110 @@ bool Terminal::SendCharEvent(const wchar_t ch, const WORD scanCode, const Contro
     KeyEvent keyUp{ false, 1, vkey, scanCode, ch, states.Value() };
     const auto handledDown = _terminalInput->HandleKey(&keyDown);
     const auto handledUp = _terminalInput->HandleKey(&keyUp);
+
+    if constexpr (Feature_PredictiveEcho::IsEnabled())
+    {
+        if (handledDown)
+        {
+            auto lock = LockForWriting();
+            if (ch >= L' ' && ch < L'\x7f' && !states.IsCtrlPressed() && !states.IsAltPressed())
+            {
+                _PreviewEcho(ch);
+            }
+            else
+            {
+                // What Enter, Backspace, ^C and the like do is entirely up to
+                // the application; drop any outstanding guesses rather than
+                // guessing on.
+                _RollbackPredictions();
+            }
+        }
+    }
+
     return handledDown || handledUp;
 }
 
+// Method Description:
+// - Paints a single typed character into the buffer ahead of the connection
+//   echoing it back, so that typing feels local even on a high-latency session
+//   (Feature_PredictiveEcho). The glyph is underlined so it's recognizable as
+//   provisional, and every prediction is undone again in _RollbackPredictions()
+//   before any real output is processed. That makes this strictly conservative:
+//   a correct guess is simply repainted by the echo, a wrong one never survives
+//   it. Expects the caller to hold the terminal lock.
+// Arguments:
+// - ch: the printable character that was just sent to the connection.
+void Terminal::_PreviewEcho(const wchar_t ch)
+{
+    // Full-screen applications own the alternate buffer and rarely echo
+    // keystrokes verbatim; don't second-guess them.
+    if (_inAltBuffer())
+    {
+        return;
+    }
+
+    auto& buffer = _activeBuffer();
+    auto& cursor = buffer.GetCursor();
+    const auto pos = cursor.GetPosition();
+
+    // Predicting through a line wrap would mean predicting scrolling too.
+    // The last column isn't worth that kind of trouble.
+    if (pos.X + 1 >= buffer.GetSize().Width())
+    {
+        return;
+    }
+
+    const auto original = *buffer.GetCellDataAt(pos);
+    // Overwriting one half of a wide glyph would tear it; leave it alone.
+    if (!original.DbcsAttr().IsSingle())
+    {
+        return;
+    }
+
+    if (_predictions.empty())
+    {
+        _predictionCursorOrigin = pos;
+    }
+    _predictions.push_back({ pos, std::wstring{ original.Chars() }, original.TextAttr() });
+
+    auto provisional = buffer.GetCurrentAttributes();
+    provisional.SetUnderlined(true);
+
+    const OutputCellIterator it{ { &ch, 1 }, provisional };
+    buffer.Write(it, pos);
+    cursor.SetPosition({ gsl::narrow_cast<short>(pos.X + 1), pos.Y });
+    buffer.TriggerRedrawCursor(cursor.GetPosition());
+}
+
+// Method Description:
+// - Restores every cell that _PreviewEcho() overwrote and puts the cursor back
+//   where the connection last left it. Called before real output is processed
+//   and whenever a key we can't predict is sent. Expects the caller to hold the
+//   terminal lock.
+void Terminal::_RollbackPredictions()
+{
+    if (_predictions.empty())
+    {
+        return;
+    }
+
+    auto& buffer = _activeBuffer();
+    const auto bufferSize = buffer.GetSize();
+    for (auto it = _predictions.rbegin(); it != _predictions.rend(); ++it)
+    {
+        if (bufferSize.IsInBounds(it->position))
+        {
+            const OutputCellIterator cell{ it->originalText, it->originalAttribute };
+            buffer.Write(cell, it->position);
+        }
+    }
+    _predictions.clear();
+
+    auto& cursor = buffer.GetCursor();
+    cursor.SetPosition(_predictionCursorOrigin);
+    buffer.TriggerRedrawCursor(cursor.GetPosition());
+}
+
 // Method Description:
 // - Invalidates the regions described in the given pattern tree for the rendering purposes
 // Arguments:
@@ -1020,7 +1212,12 @@ void Terminal::_WriteBuffer(const std::wstring_view& stringView)
         // from the stringView to form a single code point.
         const auto isSurrogate = wch >= 0xD800 && wch <= 0xDFFF;
         const auto view = stringView.substr(i, isSurrogate ? 2 : 1);
-        const OutputCellIterator it{ view, _activeBuffer().GetCurrentAttributes() };
+        // If conpty sent a glyph width hint covering this codepoint, hand the
+        // known width straight to the cell writer instead of deriving it from
+        // the codepoint all over again.
+        const auto it = _widthHintRemaining > 0 ?
+                            OutputCellIterator{ view, DbcsAttribute{ _widthHintFullWidth ? DbcsAttribute::Attribute::Leading : DbcsAttribute::Attribute::Single }, _activeBuffer().GetCurrentAttributes() } :
+                            OutputCellIterator{ view, _activeBuffer().GetCurrentAttributes() };
         const auto end = _activeBuffer().Write(it);
         const auto cellDistance = end.GetCellDistance(it);
         const auto inputDistance = end.GetInputDistance(it);
@@ -1031,6 +1228,10 @@ void Terminal::_WriteBuffer(const std::wstring_view& stringView)
             // -> Increment "i" by 1 in that case and thus by 2 in total in this iteration.
             proposedCursorPosition.X += gsl::narrow<SHORT>(cellDistance);
             i += inputDistance - 1;
+            if (_widthHintRemaining > 0)
+            {
+                _widthHintRemaining--;
+            }
         }
         else
         {
@@ -1132,6 +1333,13 @@ void Terminal::_AdjustCursorPosition(const COORD proposedPosition)
             _mutableViewport = Viewport::FromDimensions({ 0, gsl::narrow<short>(newViewTop) },
                                                         _mutableViewport.Dimensions());
             updatedViewport = true;
+
+            // Rows that are now a full viewport height above the top of the
+            // viewport have gone cold; pack them into the compact scrollback
+            // representation. They rehydrate transparently if the user
+            // scrolls back up to them.
+            const auto firstActiveRow = std::max(0, newViewTop - _mutableViewport.Height());
+            _activeBuffer().CompressColdRows(gsl::narrow_cast<size_t>(firstActiveRow));
         }
     }
 
@@ -1308,6 +1516,7 @@ bool Terminal::IsCursorBlinkingAllowed() const noexcept
 // - INVARIANT: this function can only be called if the caller has the writing lock on the terminal
 void Terminal::UpdatePatternsUnderLock() noexcept
 {
+    _lastPatternContentVersion = _VisiblePatternContentVersion();
     auto oldTree = _patternIntervalTree;
     _patternIntervalTree = _activeBuffer().GetPatterns(_VisibleStartIndex(), _VisibleEndIndex());
     _InvalidatePatternTree(oldTree);
@@ -1320,11 +1529,151 @@ void Terminal::UpdatePatternsUnderLock() noexcept
 //   visible region is changing
 void Terminal::ClearPatternTree() noexcept
 {
+    // The tree no longer matches the content fingerprint we recorded; reset it
+    // so the next scan isn't skipped as "nothing changed".
+    _lastPatternContentVersion = 0;
     auto oldTree = _patternIntervalTree;
     _patternIntervalTree = {};
     _InvalidatePatternTree(oldTree);
 }
 
+// Method Description:
+// - Computes a fingerprint of the visible region: which rows are visible, and
+//   the mutation version of each one. While this stays the same, rescanning
+//   for patterns can't produce a different tree.
+uint64_t Terminal::_VisiblePatternContentVersion() const
+{
+    uint64_t version = 5381;
+    const auto mix = [&](const uint64_t value) noexcept {
+        version = version * 31 + value;
+    };
+    const auto first = _VisibleStartIndex();
+    const auto last = _VisibleEndIndex();
+    mix(gsl::narrow_cast<uint64_t>(first));
+    mix(gsl::narrow_cast<uint64_t>(last));
+    for (auto i = first; i <= last; ++i)
+    {
+        mix(_activeBuffer().GetRowByOffset(i).GetVersion());
+    }
+    return version;
+}
+
+// Method Description:
+// - First half of an asynchronous pattern update: snapshot everything the
+//   regex needs from the buffer, so the expensive search itself can run
+//   without the terminal lock.
+// - INVARIANT: the caller must hold at least the read lock.
+// Return value:
+// - The snapshot to scan, or nullopt when the visible content hasn't changed
+//   since the last committed scan and a rescan couldn't discover anything.
+std::optional<Terminal::PatternScan> Terminal::BeginPatternScanUnderLock()
+{
+    const auto version = _VisiblePatternContentVersion();
+    if (version == _lastPatternContentVersion)
+    {
+        return std::nullopt;
+    }
+
+    auto& buffer = _activeBuffer();
+    PatternScan scan;
+    scan.text = buffer.GetPatternText(_VisibleStartIndex(), _VisibleEndIndex());
+    scan.rowSize = buffer.GetRowByOffset(0).size();
+    scan.contentVersion = version;
+    // Copied rather than referenced: a resize can replace the buffer (and with
+    // it the recognizer list) while the scan is in flight.
+    scan.patterns = buffer.GetPatternRecognizers();
+    return scan;
+}
+
+// Method Description:
+// - Second half: publish the tree a background scan produced. If the visible
+//   content changed while the regex ran, the result describes a viewport that
+//   no longer exists - drop it. Whatever changed the content has already
+//   scheduled the next scan.
+// - INVARIANT: the caller must hold the write lock.
+void Terminal::CommitPatternScanUnderLock(PatternScan&& scan)
+{
+    if (_VisiblePatternContentVersion() != scan.contentVersion)
+    {
+        return;
+    }
+
+    _lastPatternContentVersion = scan.contentVersion;
+    auto oldTree = _patternIntervalTree;
+    _patternIntervalTree = std::move(scan.tree);
+    _InvalidatePatternTree(oldTree);
+    _InvalidatePatternTree(_patternIntervalTree);
+}
+
+// Method Description:
+// - Captures the text of every buffer row into an immutable snapshot that can
+//   be read without the terminal lock. Rows come out of the buffer's per-row
+//   text cache, so an unchanged row costs one string copy rather than a walk
+//   across its cells.
+// - INVARIANT: the caller must hold at least the read lock.
+Terminal::TextSnapshot Terminal::SnapshotTextUnderLock() const
+{
+    const auto& buffer = _activeBuffer();
+    const auto totalRows = buffer.TotalRowCount();
+
+    TextSnapshot snapshot;
+    snapshot.rows.reserve(totalRows);
+    snapshot.width = buffer.GetSize().Width();
+
+    uint64_t version = 5381;
+    const auto mix = [&](const uint64_t value) noexcept {
+        version = version * 31 + value;
+    };
+    mix(totalRows);
+    for (size_t i = 0; i < totalRows; ++i)
+    {
+        mix(buffer.GetRowVersion(i));
+        snapshot.rows.emplace_back(buffer.GetRowSearchText(i));
+    }
+    snapshot.contentVersion = version;
+    return snapshot;
+}
+
+// Method Description:
+// - Recomputes the content fingerprint a snapshot was taken with, without
+//   copying any text. Equal fingerprints mean conclusions drawn from the
+//   snapshot (match positions, row indices) still apply to the live buffer.
+// - INVARIANT: the caller must hold at least the read lock.
+uint64_t Terminal::TextContentVersionUnderLock() const
+{
+    const auto& buffer = _activeBuffer();
+    const auto totalRows = buffer.TotalRowCount();
+
+    uint64_t version = 5381;
+    const auto mix = [&](const uint64_t value) noexcept {
+        version = version * 31 + value;
+    };
+    mix(totalRows);
+    for (size_t i = 0; i < totalRows; ++i)
+    {
+        mix(buffer.GetRowVersion(i));
+    }
+    return version;
+}
+
+// Method Description:
+// - Returns the bytes of row storage this terminal's buffers currently hold
+//   live, for per-pane reporting. Reads a pair of relaxed counters, so it's
+//   safe to call without taking the terminal lock.
+uint64_t Terminal::GetBufferMemoryUsage() const noexcept
+{
+    uint64_t usage = 0;
+    if (_mainBuffer)
+    {
+        usage += _mainBuffer->GetMemoryUsage();
+    }
+    if (_altBuffer)
+    {
+        usage += _altBuffer->GetMemoryUsage();
+    }
+    return usage;
+}
+
 // Method Description:
 // - Returns the tab color
 // If the starting color exits, it's value is preferred
@@ -83,6 +83,8 @@ public:
     // WritePastedText comes from our input and goes back to the PTY's input channel
     void WritePastedText(std::wstring_view stringView);
 
+    bool PerformIdleMaintenance();
+
     [[nodiscard]] std::unique_lock<til::ticket_lock> LockForReading();
     [[nodiscard]] std::unique_lock<til::ticket_lock> LockForWriting();
 
@@ -111,6 +113,9 @@ public:
     void EraseCharacters(const size_t numChars) override;
     bool EraseInLine(const ::Microsoft::Console::VirtualTerminal::DispatchTypes::EraseType eraseType) override;
     bool EraseInDisplay(const ::Microsoft::Console::VirtualTerminal::DispatchTypes::EraseType eraseType) override;
+    void SetScrollingRegion(const size_t topMargin, const size_t bottomMargin) override;
+    void ScrollUp(const size_t distance) override;
+    void ScrollDown(const size_t distance) override;
     void WarningBell() override;
     void SetWindowTitle(std::wstring_view title) override;
     COLORREF GetColorTableEntry(const size_t tableIndex) const override;
@@ -138,6 +143,8 @@ public:
     void PushGraphicsRendition(const ::Microsoft::Console::VirtualTerminal::VTParameters options) override;
     void PopGraphicsRendition() override;
 
+    void SetGlyphWidthHint(const size_t count, const bool isFullWidth) override;
+
     void UseAlternateScreenBuffer() override;
     void UseMainScreenBuffer() override;
 #pragma endregion
@@ -184,7 +191,8 @@ public:
     const bool IsGridLineDrawingAllowed() noexcept override;
     const std::wstring GetHyperlinkUri(uint16_t id) const noexcept override;
     const std::wstring GetHyperlinkCustomId(uint16_t id) const noexcept override;
-    const std::vector<size_t> GetPatternId(const COORD location) const noexcept override;
+    uint64_t GetColorGeneration() const noexcept override;
+    void GetPatternId(const COORD location, std::vector<size_t>& patternIds) const noexcept override;
 #pragma endregion
 
 #pragma region IUiaData
@@ -217,6 +225,36 @@ public:
     void UpdatePatternsUnderLock() noexcept;
     void ClearPatternTree() noexcept;
 
+    // A pattern scan snapshots the visible text under lock so that the regex
+    // search can run on a background thread without holding the terminal up;
+    // see ControlCore::UpdatePatternLocations().
+    struct PatternScan
+    {
+        std::wstring text;
+        size_t rowSize = 0;
+        uint64_t contentVersion = 0;
+        std::unordered_map<size_t, std::wstring> patterns;
+        interval_tree::IntervalTree<til::point, size_t> tree;
+    };
+    std::optional<PatternScan> BeginPatternScanUnderLock();
+    void CommitPatternScanUnderLock(PatternScan&& scan);
+
+    // An immutable capture of the text of every buffer row (viewport and
+    // scrollback alike), built under the terminal lock and safe to read from
+    // any thread afterwards. The content version is a fingerprint over the
+    // row versions: compare it against TextContentVersionUnderLock() later to
+    // tell whether the snapshot still describes the live buffer.
+    struct TextSnapshot
+    {
+        std::vector<std::wstring> rows;
+        SHORT width = 0;
+        uint64_t contentVersion = 0;
+    };
+    TextSnapshot SnapshotTextUnderLock() const;
+    uint64_t TextContentVersionUnderLock() const;
+
+    uint64_t GetBufferMemoryUsage() const noexcept;
+
     const std::optional<til::color> GetTabColor() const noexcept;
 
     winrt::Microsoft::Terminal::Core::Scheme GetColorScheme() const noexcept;
@@ -299,9 +337,24 @@ private:
     size_t _taskbarProgress;
 
     size_t _hyperlinkPatternId;
+    // The visible-region fingerprint the pattern tree was last built from;
+    // see _VisiblePatternContentVersion().
+    uint64_t _lastPatternContentVersion{ 0 };
 
     std::wstring _workingDirectory;
 
+    // Predictive local echo (Feature_PredictiveEcho): the provisional cells
+    // we've painted ahead of the connection echoing our input back, plus
+    // everything needed to undo them again. Guarded by _readWriteLock.
+    struct PredictedCell
+    {
+        COORD position;
+        std::wstring originalText;
+        TextAttribute originalAttribute;
+    };
+    std::vector<PredictedCell> _predictions;
+    COORD _predictionCursorOrigin{};
+
     // This default fake font value is only used to check if the font is a raster font.
     // Otherwise, the font is changed to a real value with the renderer via TriggerFontChange.
     FontInfo _fontInfo{ DEFAULT_FONT_FACE, TMPF_TRUETYPE, 10, { 0, DEFAULT_FONT_SIZE }, CP_UTF8, false };
@@ -328,6 +381,18 @@ private:
     SHORT _scrollbackLines;
     bool _detectURLs{ false };
 
+    // The DECSTBM margins, stored as viewport-relative 0-indexed inclusive
+    // rows. Empty when the margins are at the page limits. We only use these
+    // to confine SU/SD - conpty brackets every scroll it emits with a
+    // set-margins/reset-margins pair, so nothing else needs to honor them.
+    std::optional<std::pair<SHORT, SHORT>> _scrollMargins;
+
+    // An outstanding conpty glyph width hint: how many upcoming printed
+    // codepoints were pre-classified by the other end of the pipe, and
+    // whether they're full-width. See SetGlyphWidthHint.
+    size_t _widthHintRemaining{ 0 };
+    bool _widthHintFullWidth{ false };
+
     // _scrollOffset is the number of lines above the viewport that are currently visible
     // If _scrollOffset is 0, then the visible region of the buffer is the viewport.
     int _scrollOffset;
@@ -345,6 +410,7 @@ private:
     //      Either way, we should make this behavior controlled by a setting.
 
     interval_tree::IntervalTree<til::point, size_t> _patternIntervalTree;
+    uint64_t _VisiblePatternContentVersion() const;
     void _InvalidatePatternTree(interval_tree::IntervalTree<til::point, size_t>& tree);
     void _InvalidateFromCoords(const COORD start, const COORD end);
 
@@ -372,8 +438,13 @@ private:
 
     void _WriteBuffer(const std::wstring_view& stringView);
 
+    void _PreviewEcho(const wchar_t ch);
+    void _RollbackPredictions();
+
     void _AdjustCursorPosition(const COORD proposedPosition);
 
+    void _ScrollMarginLines(const SHORT delta);
+
     void _NotifyScrollEvent() noexcept;
 
     void _NotifyTerminalCursorPositionChanged() noexcept;
@@ -321,6 +321,132 @@ bool Terminal::EraseInDisplay(const DispatchTypes::EraseType eraseType)
     return true;
 }
 
+// Method Description:
+// - Sets the DECSTBM top and bottom scrolling margins, which confine where
+//   ScrollUp and ScrollDown operate. We don't implement the full DECSTBM
+//   behavior here - conpty only ever sets the margins, scrolls, and
+//   immediately resets them, so nothing else needs to pay attention to them.
+// Arguments:
+// - topMargin: the 1-indexed row of the top margin; 0 means the page top.
+// - bottomMargin: the 1-indexed row of the bottom margin; 0 means the page bottom.
+// Return Value:
+// - <none>
+void Terminal::SetScrollingRegion(const size_t topMargin, const size_t bottomMargin)
+{
+    SHORT actualTop = 0;
+    SHORT actualBottom = 0;
+    THROW_IF_FAILED(SizeTToShort(topMargin, &actualTop));
+    THROW_IF_FAILED(SizeTToShort(bottomMargin, &actualBottom));
+
+    const SHORT viewHeight = _GetMutableViewport().Height();
+    // The default top margin is line 1, and the default bottom margin is the
+    // bottom of the viewport.
+    if (actualTop == 0)
+    {
+        actualTop = 1;
+    }
+    if (actualBottom == 0)
+    {
+        actualBottom = viewHeight;
+    }
+
+    // The top margin must be above the bottom margin, and the bottom margin
+    // must fit in the viewport; an illegal combination is ignored.
+    if (actualTop < actualBottom && actualBottom <= viewHeight)
+    {
+        if (actualTop == 1 && actualBottom == viewHeight)
+        {
+            // Margins covering the whole page are the same as no margins.
+            _scrollMargins.reset();
+        }
+        else
+        {
+            _scrollMargins = std::pair<SHORT, SHORT>{ gsl::narrow_cast<SHORT>(actualTop - 1), gsl::narrow_cast<SHORT>(actualBottom - 1) };
+        }
+    }
+}
+
+// Method Description:
+// - Moves the contents of the scrolling region up, revealing blank lines at
+//   the bottom of the region. The cursor doesn't move.
+// Arguments:
+// - distance: the number of lines to scroll by.
+// Return Value:
+// - <none>
+void Terminal::ScrollUp(const size_t distance)
+{
+    SHORT dist;
+    THROW_IF_FAILED(SizeTToShort(distance, &dist));
+    _ScrollMarginLines(-dist);
+}
+
+// Method Description:
+// - Moves the contents of the scrolling region down, revealing blank lines at
+//   the top of the region. The cursor doesn't move.
+// Arguments:
+// - distance: the number of lines to scroll by.
+// Return Value:
+// - <none>
+void Terminal::ScrollDown(const size_t distance)
+{
+    SHORT dist;
+    THROW_IF_FAILED(SizeTToShort(distance, &dist));
+    _ScrollMarginLines(dist);
+}
+
+// Method Description:
+// - Shifts the rows between the scrolling margins (or the whole viewport, if
+//   no margins are set) vertically, blanking the rows the shift reveals with
+//   the current attributes. Everything outside the region stays put.
+// Arguments:
+// - delta: the distance to move the region's contents; negative is up.
+// Return Value:
+// - <none>
+void Terminal::_ScrollMarginLines(const SHORT delta)
+{
+    const auto viewport = _GetMutableViewport();
+    SHORT top = 0;
+    SHORT bottom = viewport.Height() - 1;
+    if (_scrollMargins)
+    {
+        top = _scrollMargins->first;
+        bottom = _scrollMargins->second;
+    }
+
+    const SHORT regionHeight = bottom - top + 1;
+    const SHORT absDelta = std::min(static_cast<SHORT>(abs(delta)), regionHeight);
+    if (absDelta == 0)
+    {
+        return;
+    }
+
+    // GetRowByOffset and ScrollRows both work in the same row space that
+    // viewport coordinates live in, so just offset by the viewport's top.
+    const SHORT bufferTop = viewport.Top() + top;
+    if (absDelta < regionHeight)
+    {
+        if (delta < 0)
+        {
+            _activeBuffer().ScrollRows(bufferTop + absDelta, regionHeight - absDelta, -absDelta);
+        }
+        else
+        {
+            _activeBuffer().ScrollRows(bufferTop, regionHeight - absDelta, absDelta);
+        }
+    }
+
+    // Blank out the revealed rows.
+    const SHORT revealedTop = delta < 0 ? bufferTop + regionHeight - absDelta : bufferTop;
+    for (SHORT i = 0; i < absDelta; i++)
+    {
+        _activeBuffer().GetRowByOffset(revealedTop + i).Reset(_activeBuffer().GetCurrentAttributes());
+    }
+
+    // ScrollRows doesn't notify the renderer, so repaint the whole region.
+    _activeBuffer().TriggerRedraw(Viewport::FromDimensions({ viewport.Left(), bufferTop },
+                                                           { viewport.Width(), regionHeight }));
+}
+
 void Terminal::WarningBell()
 {
     _pfnWarningBell();
@@ -330,6 +456,13 @@ void Terminal::SetWindowTitle(std::wstring_view title)
 {
     if (!_suppressApplicationTitle)
     {
+        // Repeated identical updates are common (build tools repost the same
+        // progress title constantly); don't wake the UI layers for those.
+        if (_title.has_value() && _title.value() == title)
+        {
+            return;
+        }
+
         _title.emplace(title);
         _pfnTitleChanged(_title.value());
     }
@@ -595,6 +728,19 @@ void Terminal::PopGraphicsRendition()
     _activeBuffer().SetCurrentAttributes(_sgrStack.Pop(current));
 }
 
+// Method Description:
+// - Stores a conpty glyph width hint: the next `count` printed codepoints
+//   were already classified by the conhost end of the pipe, so _WriteBuffer
+//   can skip measuring each of them again.
+// Arguments:
+// - count - how many upcoming codepoints the hint covers
+// - isFullWidth - true if they each occupy two columns, false for one
+void Terminal::SetGlyphWidthHint(const size_t count, const bool isFullWidth)
+{
+    _widthHintRemaining = count;
+    _widthHintFullWidth = isFullWidth;
+}
+
 void Terminal::UseAlternateScreenBuffer()
 {
     // the new alt buffer is exactly the size of the viewport.
@@ -517,6 +517,25 @@ bool TerminalDispatch::EndHyperlink()
     return true;
 }
 
+// Method Description:
+// - Handles a conpty glyph width hint, which pre-classifies the width of the
+//   next run of printed codepoints so the terminal doesn't have to re-derive
+//   it for each one.
+// Arguments:
+// - count: how many upcoming codepoints the hint covers
+// - width: the column width (1 or 2) shared by all of them
+// Return Value:
+// - true iff the hint was well-formed
+bool TerminalDispatch::GlyphWidthHint(const size_t count, const size_t width) noexcept
+{
+    if (width != 1 && width != 2)
+    {
+        return false;
+    }
+    _terminalApi.SetGlyphWidthHint(count, width == 2);
+    return true;
+}
+
 // Method Description:
 // - Performs a ConEmu action
 // - Currently, the only action we support is setting the taskbar state/progress
@@ -709,6 +728,49 @@ void TerminalDispatch::_InitTabStopsForWidth(const size_t width)
     }
 }
 
+// Routine Description:
+// - DECSTBM - Sets the top and bottom scrolling margins, which confine where
+//   ScrollUp and ScrollDown operate. Setting the margins (or resetting them,
+//   with no parameters) also homes the cursor.
+// Arguments:
+// - topMargin - the 1-indexed row of the top margin; 0 for the page top.
+// - bottomMargin - the 1-indexed row of the bottom margin; 0 for the page bottom.
+// Return Value:
+// - True.
+bool TerminalDispatch::SetTopBottomScrollingMargins(const size_t topMargin,
+                                                    const size_t bottomMargin)
+{
+    _terminalApi.SetScrollingRegion(topMargin, bottomMargin);
+    _terminalApi.SetCursorPosition(0, 0);
+    return true;
+}
+
+// Routine Description:
+// - SU - Scrolls the contents of the scrolling region up, revealing blank
+//   lines at the bottom of the region.
+// Arguments:
+// - distance - the number of lines to scroll by.
+// Return Value:
+// - True.
+bool TerminalDispatch::ScrollUp(const size_t distance)
+{
+    _terminalApi.ScrollUp(distance);
+    return true;
+}
+
+// Routine Description:
+// - SD - Scrolls the contents of the scrolling region down, revealing blank
+//   lines at the top of the region.
+// Arguments:
+// - distance - the number of lines to scroll by.
+// Return Value:
+// - True.
+bool TerminalDispatch::ScrollDown(const size_t distance)
+{
+    _terminalApi.ScrollDown(distance);
+    return true;
+}
+
 bool TerminalDispatch::SoftReset()
 {
     // TODO:GH#1883 much of this method is not yet implemented in the Terminal,
@@ -727,8 +789,9 @@ bool TerminalDispatch::SoftReset()
     SetCursorKeysMode(false); // Normal characters.
     SetKeypadMode(false); // Numeric characters.
 
-    // // Top margin = 1; bottom margin = page length.
-    // _DoSetTopBottomScrollingMargins(0, 0);
+    // Top margin = 1; bottom margin = page length.
+    // (Reset through the api directly, since DECSTR doesn't home the cursor.)
+    _terminalApi.SetScrollingRegion(0, 0);
 
     // _termOutput = {}; // Reset all character set designations.
     // if (_initialCodePage.has_value())
@@ -60,6 +60,10 @@ public:
     bool InsertCharacter(const size_t count) override;
     bool EraseInDisplay(const ::Microsoft::Console::VirtualTerminal::DispatchTypes::EraseType eraseType) override;
 
+    bool SetTopBottomScrollingMargins(const size_t topMargin, const size_t bottomMargin) override; // DECSTBM
+    bool ScrollUp(const size_t distance) override; // SU
+    bool ScrollDown(const size_t distance) override; // SD
+
     bool SetCursorKeysMode(const bool applicationMode) override; // DECCKM
     bool SetKeypadMode(const bool applicationMode) override; // DECKPAM, DECKPNM
     bool SetScreenMode(const bool reverseMode) override; // DECSCNM
@@ -85,6 +89,8 @@ public:
 
     bool DoConEmuAction(const std::wstring_view string) override;
 
+    bool GlyphWidthHint(const size_t count, const size_t width) noexcept override;
+
     bool CursorSaveState() override;
     bool CursorRestoreState() override;
 
@@ -98,30 +98,27 @@ const std::wstring Microsoft::Terminal::Core::Terminal::GetHyperlinkCustomId(uin
     return _activeBuffer().GetCustomIdFromId(id);
 }
 
+uint64_t Microsoft::Terminal::Core::Terminal::GetColorGeneration() const noexcept
+{
+    return _renderSettings.GetColorGeneration();
+}
+
 // Method Description:
 // - Gets the regex pattern ids of a location
 // Arguments:
-// - The location
-// Return value:
-// - The pattern IDs of the location
-const std::vector<size_t> Terminal::GetPatternId(const COORD location) const noexcept
-{
-    // Look through our interval tree for this location
-    const auto intervals = _patternIntervalTree.findOverlapping(til::point{ location.X + 1, location.Y }, til::point{ location });
-    if (intervals.size() == 0)
-    {
-        return {};
-    }
-    else
-    {
-        std::vector<size_t> result{};
-        for (const auto& interval : intervals)
-        {
-            result.emplace_back(interval.value);
-        }
-        return result;
-    }
-    return {};
+// - location: the location to look up
+// - patternIds: the vector to fill with the pattern IDs of the location.
+//   Any previous content is discarded, but the storage is reused.
+void Terminal::GetPatternId(const COORD location, std::vector<size_t>& patternIds) const noexcept
+{
+    patternIds.clear();
+
+    // Look through our interval tree for this location. Visiting the
+    // overlapping intervals directly spares us the intermediate interval
+    // vector that findOverlapping would allocate on every call.
+    _patternIntervalTree.visit_overlapping(til::point{ location.X + 1, location.Y }, til::point{ location }, [&](const auto& interval) {
+        patternIds.emplace_back(interval.value);
+    });
 }
 
 std::pair<COLORREF, COLORREF> Terminal::GetAttributeColors(const TextAttribute& attr) const noexcept
@@ -325,6 +325,24 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
         _GlobalHotkeysCache = single_threaded_map(std::move(globalHotkeys));
     }
 
+    // Method Description:
+    // - Rebuilds the flattened key chord dispatch table used by
+    //   GetActionByKeyChord and IsKeyChordExplicitlyUnbound.
+    // - The population walk resolves layering, masking, and unbinding up
+    //   front, so that the per-keystroke queries above become a single
+    //   hash probe.
+    void ActionMap::_RefreshKeyChordLookupCache() const
+    {
+        std::unordered_map<KeyChord, Model::Command, KeyChordHash, KeyChordEquality> keyChords;
+        std::unordered_set<KeyChord, KeyChordHash, KeyChordEquality> unboundKeys;
+
+        _PopulateKeyBindingMapWithStandardCommands(keyChords, unboundKeys);
+
+        _ResolvedKeyChordCache = std::move(keyChords);
+        _ResolvedUnboundKeysCache = std::move(unboundKeys);
+        _ResolvedKeyChordCacheValid = true;
+    }
+
     // Method Description:
     // - Populates the provided keyBindingsMap with all of our actions and our parents actions
     //    while omitting the key bindings that were already added before.
@@ -434,6 +452,7 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
         _NameMapCache = nullptr;
         _GlobalHotkeysCache = nullptr;
         _KeyBindingMapCache = nullptr;
+        _ResolvedKeyChordCacheValid = false;
 
         // Handle nested commands
         const auto cmdImpl{ get_self<Command>(cmd) };
@@ -631,7 +650,11 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
             const auto conflictingCmdImpl{ get_self<implementation::Command>(conflictingCmd) };
             conflictingCmdImpl->EraseKey(keys);
         }
-        else if (const auto& conflictingCmd{ GetActionByKeyChord(keys) })
+        // Use the layer walk directly here: AddAction invalidated the
+        // flattened dispatch cache on entry, and going through
+        // GetActionByKeyChord would rebuild it before we're done mutating
+        // the map - leaving it marked valid but stale.
+        else if (const auto& conflictingCmd{ _GetActionByKeyChordInternal(keys).value_or(nullptr) })
         {
             // Collision with ancestor: The key chord was already in use, but by an action in another layer
             //
@@ -698,14 +721,22 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
     // - false if either the keychord is bound, or not bound at all
     bool ActionMap::IsKeyChordExplicitlyUnbound(Control::KeyChord const& keys) const
     {
-        // We use the fact that the ..Internal call returns nullptr for explicitly unbound
-        // key chords, and nullopt for keychord that are not bound - it allows us to distinguish
-        // between unbound and lack of binding.
-        return _GetActionByKeyChordInternal(keys) == nullptr;
+        if (!_ResolvedKeyChordCacheValid)
+        {
+            _RefreshKeyChordLookupCache();
+        }
+
+        // A chord recorded as unbound in some layer may have been rebound by a
+        // descendant; it only counts as "explicitly unbound" if nothing ended
+        // up bound to it.
+        return _ResolvedKeyChordCache.find(keys) == _ResolvedKeyChordCache.end() &&
+               _ResolvedUnboundKeysCache.find(keys) != _ResolvedUnboundKeysCache.end();
     }
 
     // Method Description:
     // - Retrieves the assigned command that can be invoked with the given key chord
+    // - This is the hot path: it runs once per keystroke, so it dispatches off
+    //   a flattened lookup table rather than walking the inheritance chain.
     // Arguments:
     // - keys: the key chord of the command to search for
     // Return Value:
@@ -713,7 +744,13 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
     // - nullptr if the key chord doesn't exist
     Model::Command ActionMap::GetActionByKeyChord(Control::KeyChord const& keys) const
     {
-        return _GetActionByKeyChordInternal(keys).value_or(nullptr);
+        if (!_ResolvedKeyChordCacheValid)
+        {
+            _RefreshKeyChordLookupCache();
+        }
+
+        const auto cmdPair{ _ResolvedKeyChordCache.find(keys) };
+        return cmdPair != _ResolvedKeyChordCache.end() ? cmdPair->second : nullptr;
     }
 
     // Method Description:
@@ -80,6 +80,7 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
         std::optional<Model::Command> _GetActionByKeyChordInternal(const Control::KeyChord& keys) const;
 
         void _RefreshKeyBindingCaches();
+        void _RefreshKeyChordLookupCache() const;
         void _PopulateAvailableActionsWithStandardCommands(std::unordered_map<hstring, Model::ActionAndArgs>& availableActions, std::unordered_set<InternalActionID>& visitedActionIDs) const;
         void _PopulateNameMapWithSpecialCommands(std::unordered_map<hstring, Model::Command>& nameMap) const;
         void _PopulateNameMapWithStandardCommands(std::unordered_map<hstring, Model::Command>& nameMap) const;
@@ -95,6 +96,16 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
         Windows::Foundation::Collections::IMap<Control::KeyChord, Model::Command> _GlobalHotkeysCache{ nullptr };
         Windows::Foundation::Collections::IMap<Control::KeyChord, Model::Command> _KeyBindingMapCache{ nullptr };
 
+        // A flattened (key chord) --> (command) dispatch table, with the
+        //   layering (masking and unbinding included) already resolved.
+        // GetActionByKeyChord is queried once per keystroke; this table turns
+        //   each of those queries into a single hash probe instead of a walk
+        //   up the inheritance chain.
+        // Lazily built; mutable so the const query paths can fill it in.
+        mutable std::unordered_map<Control::KeyChord, Model::Command, KeyChordHash, KeyChordEquality> _ResolvedKeyChordCache;
+        mutable std::unordered_set<Control::KeyChord, KeyChordHash, KeyChordEquality> _ResolvedUnboundKeysCache;
+        mutable bool _ResolvedKeyChordCacheValid{ false };
+
         std::unordered_map<winrt::hstring, Model::Command> _NestedCommands;
         std::vector<Model::Command> _IterableCommands;
         std::unordered_map<Control::KeyChord, InternalActionID, KeyChordHash, KeyChordEquality> _KeyMap;
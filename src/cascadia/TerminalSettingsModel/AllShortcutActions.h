@@ -53,6 +53,7 @@
     ON_ALL_ACTIONS(SwapPane)               \
     ON_ALL_ACTIONS(Find)                   \
     ON_ALL_ACTIONS(ToggleShaderEffects)    \
+    ON_ALL_ACTIONS(TogglePerformanceHud)   \
     ON_ALL_ACTIONS(ToggleFocusMode)        \
     ON_ALL_ACTIONS(ToggleFullscreen)       \
     ON_ALL_ACTIONS(ToggleAlwaysOnTop)      \
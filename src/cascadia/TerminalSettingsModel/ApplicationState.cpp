@@ -92,9 +92,13 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
     }
 
     ApplicationState::ApplicationState(const std::filesystem::path& stateRoot) noexcept :
+        _stateRoot{ stateRoot },
         _sharedPath{ stateRoot / stateFileName },
         _elevatedPath{ stateRoot / elevatedStateFileName },
-        _throttler{ std::chrono::seconds(1), [this]() { _write(); } }
+        // A lone change is flushed to disk quickly, while bursts of changes
+        // (like a window closing all of its tabs) coalesce into one write
+        // that's delayed by up to a second.
+        _throttler{ std::chrono::milliseconds(100), std::chrono::seconds(1), [this]() { _write(); } }
     {
         _read();
     }
@@ -393,4 +397,44 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
         }
     }
 
+    std::filesystem::path ApplicationState::_bufferSnapshotPath(const winrt::guid& sessionId) const
+    {
+        return _stateRoot / fmt::format(L"buffer_{}.txt", ::Microsoft::Console::Utils::GuidToString(sessionId));
+    }
+
+    // Method Description:
+    // - Read the buffer snapshot that was persisted for the given session, if
+    //   one exists. Returns an empty string otherwise.
+    winrt::hstring ApplicationState::ReadBufferSnapshot(const winrt::guid& sessionId) const
+    try
+    {
+        const auto content = ReadUTF8FileIfExists(_bufferSnapshotPath(sessionId)).value_or(std::string{});
+        return hstring{ til::u8u16(content) };
+    }
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION();
+        return {};
+    }
+
+    // Method Description:
+    // - Persist the given buffer contents for the given session. These are
+    //   written atomically, so a crash mid-write leaves the previous snapshot
+    //   intact rather than a truncated one.
+    void ApplicationState::WriteBufferSnapshot(const winrt::guid& sessionId, const winrt::hstring& content) const
+    try
+    {
+        WriteUTF8FileAtomic(_bufferSnapshotPath(sessionId), til::u16u8(content));
+    }
+    CATCH_LOG()
+
+    // Method Description:
+    // - Remove the snapshot for the given session, if one exists. Called when a
+    //   tab is closed by the user, so snapshots don't accumulate on disk.
+    void ApplicationState::DeleteBufferSnapshot(const winrt::guid& sessionId) const
+    try
+    {
+        LOG_LAST_ERROR_IF(!DeleteFile(_bufferSnapshotPath(sessionId).c_str()));
+    }
+    CATCH_LOG()
 }
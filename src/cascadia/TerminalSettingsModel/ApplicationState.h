@@ -39,7 +39,8 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
     X(FileSource::Local, Windows::Foundation::Collections::IVector<Model::WindowLayout>, PersistedWindowLayouts, "persistedWindowLayouts")                                \
     X(FileSource::Shared, Windows::Foundation::Collections::IVector<hstring>, RecentCommands, "recentCommands")                                                           \
     X(FileSource::Shared, Windows::Foundation::Collections::IVector<winrt::Microsoft::Terminal::Settings::Model::InfoBarMessage>, DismissedMessages, "dismissedMessages") \
-    X(FileSource::Local, Windows::Foundation::Collections::IVector<hstring>, AllowedCommandlines, "allowedCommandlines")
+    X(FileSource::Local, Windows::Foundation::Collections::IVector<hstring>, AllowedCommandlines, "allowedCommandlines")            \
+    X(FileSource::Shared, hstring, BufferUsageStats, "bufferUsageStats")
 
     struct WindowLayout : WindowLayoutT<WindowLayout>
     {
@@ -71,6 +72,13 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
         // General getters/setters
         bool IsStatePath(const winrt::hstring& filename);
 
+        // Buffer snapshots for session restore. These live in their own files
+        // next to state.json (one per terminal session), rather than inside
+        // the json, because buffer contents can be megabytes.
+        winrt::hstring ReadBufferSnapshot(const winrt::guid& sessionId) const;
+        void WriteBufferSnapshot(const winrt::guid& sessionId, const winrt::hstring& content) const;
+        void DeleteBufferSnapshot(const winrt::guid& sessionId) const;
+
         // State getters/setters
 #define MTSM_APPLICATION_STATE_GEN(source, type, name, key, ...) \
     type name() const noexcept;                                  \
@@ -86,6 +94,7 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
 #undef MTSM_APPLICATION_STATE_GEN
         };
         til::shared_mutex<state_t> _state;
+        std::filesystem::path _stateRoot;
         std::filesystem::path _sharedPath;
         std::filesystem::path _elevatedPath;
         til::throttled_func_trailing<> _throttler;
@@ -99,6 +108,8 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
         void _writeSharedContents(const std::string_view content) const;
         std::optional<std::string> _readLocalContents() const;
         void _writeLocalContents(const std::string_view content) const;
+
+        std::filesystem::path _bufferSnapshotPath(const winrt::guid& sessionId) const;
     };
 }
 
@@ -54,6 +54,9 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
         SettingsLoader(const std::string_view& userJSON, const std::string_view& inboxJSON);
 
         void GenerateProfiles();
+        bool FillGeneratedProfilesFromCache();
+        std::string SerializeGeneratedProfiles() const;
+        bool HasDynamicUserProfiles() const;
         void ApplyRuntimeInitialSettings();
         void MergeInboxIntoUserSettings();
         void FindFragmentsAndMergeIntoUserSettings();
@@ -80,6 +83,7 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
         static const Json::Value& _getJSONValue(const Json::Value& json, const std::string_view& key) noexcept;
         gsl::span<const winrt::com_ptr<implementation::Profile>> _getNonUserOriginProfiles() const;
         void _parse(const OriginTag origin, const winrt::hstring& source, const std::string_view& content, ParsedSettings& settings);
+        void _parseInboxSettings(const std::string_view& content);
         void _parseFragment(const winrt::hstring& source, const std::string_view& content, ParsedSettings& settings);
         static JsonSettings _parseJson(const std::string_view& content);
         static winrt::com_ptr<implementation::Profile> _parseProfile(const OriginTag origin, const winrt::hstring& source, const Json::Value& profileJson);
@@ -101,6 +105,7 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
 
         static winrt::hstring SettingsPath();
         static winrt::hstring DefaultSettingsPath();
+        static winrt::hstring GeneratedProfilesCachePath();
         static winrt::hstring ApplicationDisplayName();
         static winrt::hstring ApplicationVersion();
         static void ExportFile(winrt::hstring path, winrt::hstring content);
@@ -143,6 +148,7 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
 
     private:
         static const std::filesystem::path& _settingsPath();
+        static winrt::fire_and_forget _refreshGeneratedProfilesCache(std::string userJSON);
 
         winrt::com_ptr<implementation::Profile> _createNewProfile(const std::wstring_view& name) const;
         Model::Profile _getProfileForCommandLine(const winrt::hstring& commandLine) const;
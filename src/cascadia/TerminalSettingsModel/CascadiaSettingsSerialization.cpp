@@ -34,12 +34,20 @@ using namespace winrt::Microsoft::Terminal::Settings::Model::implementation;
 
 static constexpr std::wstring_view SettingsFilename{ L"settings.json" };
 static constexpr std::wstring_view DefaultsFilename{ L"defaults.json" };
+static constexpr std::wstring_view GeneratedProfilesCacheFilename{ L"generated-profiles.json" };
 
 static constexpr std::string_view ProfilesKey{ "profiles" };
 static constexpr std::string_view DefaultSettingsKey{ "defaults" };
 static constexpr std::string_view ProfilesListKey{ "list" };
 static constexpr std::string_view SchemesKey{ "schemes" };
 
+static constexpr std::string_view CacheVersionKey{ "version" };
+static constexpr std::string_view CacheDisabledSourcesKey{ "disabledProfileSources" };
+static constexpr std::string_view CacheProfilesKey{ "profiles" };
+// Bump this whenever the generators or the Profile serialization change in a
+// way that makes previously cached output wrong.
+static constexpr int GeneratedProfilesCacheVersion = 1;
+
 static constexpr std::wstring_view jsonExtension{ L".json" };
 static constexpr std::wstring_view FragmentsSubDirectory{ L"\\Fragments" };
 static constexpr std::wstring_view FragmentsPath{ L"\\Microsoft\\Windows Terminal\\Fragments" };
@@ -81,6 +89,14 @@ static std::filesystem::path buildPath(const std::wstring_view& lhs, const std::
     return { std::move(buffer) };
 }
 
+// Returns the path of the generated-profiles cache, which lives next to
+// settings.json so that AppLogic's settings directory watcher sees it change.
+static const std::filesystem::path& generatedProfilesCachePath()
+{
+    static const auto path = GetBaseSettingsPath() / GeneratedProfilesCacheFilename;
+    return path;
+}
+
 void ParsedSettings::clear()
 {
     globals = {};
@@ -108,7 +124,7 @@ SettingsLoader SettingsLoader::Default(const std::string_view& userJSON, const s
 // At a minimum you should do at least everything that SettingsLoader::Default does.
 SettingsLoader::SettingsLoader(const std::string_view& userJSON, const std::string_view& inboxJSON)
 {
-    _parse(OriginTag::InBox, {}, inboxJSON, inboxSettings);
+    _parseInboxSettings(inboxJSON);
 
     try
     {
@@ -142,6 +158,113 @@ void SettingsLoader::GenerateProfiles()
     _executeGenerator(VisualStudioGenerator{});
 }
 
+// Tries to satisfy GenerateProfiles() from the cache a previous launch wrote,
+// skipping the generators' registry/filesystem/COM probing entirely. Returns
+// true if the cached profiles were loaded; the caller is then expected to
+// schedule a background revalidation so the cache can't go permanently stale
+// (see CascadiaSettings::_refreshGeneratedProfilesCache).
+bool SettingsLoader::FillGeneratedProfilesFromCache()
+{
+    try
+    {
+        const auto cacheString = ReadUTF8FileIfExists(generatedProfilesCachePath());
+        if (!cacheString)
+        {
+            return false;
+        }
+
+        const auto root = _parseJSON(*cacheString);
+        if (root[JsonKey(CacheVersionKey)].asInt() != GeneratedProfilesCacheVersion)
+        {
+            return false;
+        }
+
+        // The cache was written under a specific set of disabled profile
+        // sources. If the user changed theirs since, the generators that are
+        // supposed to run changed too - regenerate from scratch.
+        const auto& disabledSources = root[JsonKey(CacheDisabledSourcesKey)];
+        if (disabledSources.size() != _ignoredNamespaces.size())
+        {
+            return false;
+        }
+        for (const auto& source : disabledSources)
+        {
+            if (!_ignoredNamespaces.count(til::u8u16(source.asString())))
+            {
+                return false;
+            }
+        }
+
+        const auto& profilesBySource = root[JsonKey(CacheProfilesKey)];
+        if (!profilesBySource.isObject())
+        {
+            return false;
+        }
+
+        for (auto it = profilesBySource.begin(); it != profilesBySource.end(); ++it)
+        {
+            const winrt::hstring source{ til::u8u16(it.name()) };
+            for (const auto& profileJson : *it)
+            {
+                auto profile = _parseProfile(OriginTag::Generated, source, profileJson);
+                const auto guid = profile->Guid();
+                _appendProfile(std::move(profile), guid, inboxSettings);
+            }
+        }
+
+        return true;
+    }
+    CATCH_LOG();
+    return false;
+}
+
+// Returns true if the user settings contain any profile owned by a dynamic
+// source. Those stubs only stay functional if a matching generated parent
+// exists, so whenever any are present the generators must run before the
+// settings are handed to the UI.
+// NOTE: Must be called before FindFragmentsAndMergeIntoUserSettings, which
+// also stamps sources onto user profiles.
+bool SettingsLoader::HasDynamicUserProfiles() const
+{
+    for (const auto& profile : userSettings.profiles)
+    {
+        if (!profile->Source().empty())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Serializes the profiles the generators produced this launch into the format
+// consumed by FillGeneratedProfilesFromCache(), grouped by their namespace.
+std::string SettingsLoader::SerializeGeneratedProfiles() const
+{
+    Json::Value profilesBySource{ Json::objectValue };
+    for (const auto& profile : inboxSettings.profiles)
+    {
+        if (profile->Origin() == OriginTag::Generated)
+        {
+            profilesBySource[til::u16u8(profile->Source())].append(profile->ToJson());
+        }
+    }
+
+    Json::Value disabledSources{ Json::arrayValue };
+    for (const auto& ns : _ignoredNamespaces)
+    {
+        disabledSources.append(til::u16u8(ns));
+    }
+
+    Json::Value root{ Json::objectValue };
+    root[JsonKey(CacheVersionKey)] = GeneratedProfilesCacheVersion;
+    root[JsonKey(CacheDisabledSourcesKey)] = disabledSources;
+    root[JsonKey(CacheProfilesKey)] = profilesBySource;
+
+    Json::StreamWriterBuilder wbuilder;
+    wbuilder.settings_["indentation"] = "";
+    return Json::writeString(wbuilder, root);
+}
+
 // A new settings.json gets a special treatment:
 // 1. The default profile is a PowerShell 7+ one, if one was generated,
 //    and falls back to the standard PowerShell 5 profile otherwise.
@@ -501,6 +624,36 @@ void SettingsLoader::_parse(const OriginTag origin, const winrt::hstring& source
     }
 }
 
+// Parses the inbox settings ("content") into .inboxSettings.
+// The defaults.json stamped into the binary at build time cannot change for
+// the lifetime of the process, yet we used to re-parse it and re-derive its
+// object model on every single load. Every step after parsing treats the
+// inbox objects as static/constant (see _addUserProfileParent), so the parsed
+// baseline can be shared instead: the first load pays for the parse and every
+// later one starts from a copy of the cached ParsedSettings. The copy
+// duplicates the profile vector/map, which generators and the generated
+// profiles cache append to, while the parsed objects themselves are shared.
+void SettingsLoader::_parseInboxSettings(const std::string_view& content)
+{
+    // Custom inbox JSON (unit tests, LoadUniversal) bypasses the cache;
+    // only the embedded defaults.json is known to be immutable.
+    if (content.data() != DefaultJson.data() || content.size() != DefaultJson.size())
+    {
+        _parse(OriginTag::InBox, {}, content, inboxSettings);
+        return;
+    }
+
+    static std::mutex cacheLock;
+    static ParsedSettings cache;
+
+    std::lock_guard guard{ cacheLock };
+    if (!cache.globals)
+    {
+        _parse(OriginTag::InBox, {}, content, cache);
+    }
+    inboxSettings = cache;
+}
+
 // Just like _parse, but is to be used for fragment files, which don't support anything but color
 // schemes and profiles. Additionally this function supports profiles which specify an "updates" key.
 void SettingsLoader::_parseFragment(const winrt::hstring& source, const std::string_view& content, ParsedSettings& settings)
@@ -734,7 +887,40 @@ try
 
     // Generate dynamic profiles and add them as parents of user profiles.
     // That way the user profiles will get appropriate defaults from the generators (like icons and such).
-    loader.GenerateProfiles();
+    //
+    // With the generated-profiles cache enabled, warm starts load last
+    // launch's generator output from disk instead of probing the registry,
+    // filesystem and COM again; the generators then rerun on a background
+    // thread and refresh the cache if anything changed (see below).
+    auto generatedProfilesFromCache = false;
+    auto generationDeferred = false;
+    std::string serializedGeneratedProfiles;
+    if constexpr (Feature_GeneratedProfilesCache::IsEnabled())
+    {
+        if (!firstTimeSetup)
+        {
+            generatedProfilesFromCache = loader.FillGeneratedProfilesFromCache();
+
+            // Cold start without a cache: if the user settings contain no
+            // dynamic profile stubs that would stop working (or vanish from
+            // the UI) without their generated parents, we don't have to block
+            // the launch on the generators at all. The background pass below
+            // discovers the profiles, writes the cache, and the resulting
+            // settings reload merges them in when they're ready.
+            if (!generatedProfilesFromCache && !loader.HasDynamicUserProfiles())
+            {
+                generationDeferred = true;
+            }
+        }
+    }
+    if (!generatedProfilesFromCache && !generationDeferred)
+    {
+        loader.GenerateProfiles();
+        if constexpr (Feature_GeneratedProfilesCache::IsEnabled())
+        {
+            serializedGeneratedProfiles = loader.SerializeGeneratedProfiles();
+        }
+    }
 
     // ApplyRuntimeInitialSettings depends on generated profiles.
     // --> ApplyRuntimeInitialSettings must be called after GenerateProfiles.
@@ -757,6 +943,29 @@ try
     // If this throws, the app will catch it and use the default settings.
     const auto settings = winrt::make_self<CascadiaSettings>(std::move(loader));
 
+    if constexpr (Feature_GeneratedProfilesCache::IsEnabled())
+    {
+        if (generatedProfilesFromCache || generationDeferred)
+        {
+            _refreshGeneratedProfilesCache(std::string{ settingsStringView });
+        }
+        else
+        {
+            try
+            {
+                // Skip the write when the cache is already up to date, so the
+                // settings directory watcher doesn't see a phantom change and
+                // schedule a pointless reload.
+                const auto cached = ReadUTF8FileIfExists(generatedProfilesCachePath());
+                if (!cached || *cached != serializedGeneratedProfiles)
+                {
+                    WriteUTF8FileAtomic(generatedProfilesCachePath(), serializedGeneratedProfiles);
+                }
+            }
+            CATCH_LOG();
+        }
+    }
+
     // If we created the file, or found new dynamic profiles, write the user
     // settings string back to the file.
     if (mustWriteToDisk)
@@ -915,6 +1124,39 @@ winrt::hstring CascadiaSettings::SettingsPath()
     return winrt::hstring{ _settingsPath().native() };
 }
 
+// function Description:
+// - Returns the full path of the generated-profiles cache. It lives in the
+//   same directory as settings.json, so the settings directory watcher in
+//   AppLogic gets notified when the background revalidation rewrites it.
+winrt::hstring CascadiaSettings::GeneratedProfilesCachePath()
+{
+    return winrt::hstring{ generatedProfilesCachePath().native() };
+}
+
+// Method Description:
+// - Reruns the dynamic profile generators on a background thread and rewrites
+//   the cache file if their output no longer matches it. AppLogic treats a
+//   cache change like a settings.json change, so e.g. a freshly installed WSL
+//   distro shows up shortly after launch rather than on the launch after that.
+winrt::fire_and_forget CascadiaSettings::_refreshGeneratedProfilesCache(std::string userJSON)
+{
+    co_await winrt::resume_background();
+
+    try
+    {
+        SettingsLoader loader{ userJSON, DefaultJson };
+        loader.GenerateProfiles();
+        const auto fresh = loader.SerializeGeneratedProfiles();
+
+        const auto cached = ReadUTF8FileIfExists(generatedProfilesCachePath());
+        if (!cached || *cached != fresh)
+        {
+            WriteUTF8FileAtomic(generatedProfilesCachePath(), fresh);
+        }
+    }
+    CATCH_LOG();
+}
+
 winrt::hstring CascadiaSettings::DefaultSettingsPath()
 {
     // Both of these posts suggest getting the path to the exe, then removing
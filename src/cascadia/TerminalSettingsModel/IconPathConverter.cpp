@@ -99,6 +99,19 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
     template<typename TIconSource>
     TIconSource _getIconSource(const winrt::hstring& iconPath)
     {
+        // Each unique icon path gets its IconSource built exactly once, and
+        // every consumer - the new-tab flyout, tab headers, the command
+        // palette - shares that instance. Rebuilding the dropdown used to
+        // re-resolve every profile's icon on each open, which is wasted work
+        // at best and a multi-second stall when the path points at a network
+        // share. IconSources are XAML objects and converters only run on the
+        // UI thread, so the cache needs no lock.
+        static std::unordered_map<winrt::hstring, TIconSource> iconCache;
+        if (const auto cached = iconCache.find(iconPath); cached != iconCache.end())
+        {
+            return cached->second;
+        }
+
         TIconSource iconSource{ nullptr };
 
         if (iconPath.size() != 0)
@@ -151,6 +164,7 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
             iconSource = icon;
         }
 
+        iconCache.emplace(iconPath, iconSource);
         return iconSource;
     }
 
@@ -29,6 +29,9 @@ Author(s):
     X(bool, ForceVTInput, "experimental.input.forceVT", false)                                                                                             \
     X(bool, TrimBlockSelection, "trimBlockSelection", true)                                                                                                \
     X(bool, DetectURLs, "experimental.detectURLs", true)                                                                                                   \
+    X(uint32_t, ScrollbackMemoryCeiling, "experimental.scrollbackMemoryCeiling", 0u)                                                                       \
+    X(bool, FairOutputScheduling, "experimental.fairOutputScheduling", false)                                                                              \
+    X(bool, SpeculativeConnectionPrewarm, "experimental.connection.prewarm", false)                                                                        \
     X(bool, AlwaysShowTabs, "alwaysShowTabs", true)                                                                                                        \
     X(bool, ShowTitleInTitlebar, "showTerminalTitleInTitlebar", true)                                                                                      \
     X(bool, ConfirmCloseAllTabs, "confirmCloseAllTabs", true)                                                                                              \
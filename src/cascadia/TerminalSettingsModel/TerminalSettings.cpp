@@ -13,6 +13,19 @@ using namespace Microsoft::Console::Utils;
 
 namespace winrt::Microsoft::Terminal::Settings::Model::implementation
 {
+    // Cache of fully flattened per-profile settings objects, keyed by profile
+    // identity. A settings reload builds a brand new CascadiaSettings with new
+    // Profile objects, so each entry remembers (weakly) which settings tree it
+    // came from - a stale entry simply stops matching instead of needing an
+    // explicit generation counter.
+    struct FlattenedProfileCacheEntry
+    {
+        winrt::weak_ref<Model::CascadiaSettings> origin;
+        winrt::com_ptr<TerminalSettings> settings;
+    };
+    static std::unordered_map<const void*, FlattenedProfileCacheEntry> flattenedProfileCache;
+    static std::mutex flattenedProfileCacheLock;
+
     static std::tuple<Windows::UI::Xaml::HorizontalAlignment, Windows::UI::Xaml::VerticalAlignment> ConvertConvergedAlignment(ConvergedAlignment alignment)
     {
         // extract horizontal alignment
@@ -64,25 +77,71 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
     //   one for when the terminal is focused and the other for when the terminal is unfocused
     Model::TerminalSettingsCreateResult TerminalSettings::CreateWithProfile(const Model::CascadiaSettings& appSettings, const Model::Profile& profile, const IKeyBindings& keybindings)
     {
-        auto settings{ winrt::make_self<TerminalSettings>() };
-        settings->_KeyBindings = keybindings;
+        const auto flattened = _FlattenProfile(appSettings, profile);
 
-        const auto globals = appSettings.GlobalSettings();
-        settings->_ApplyProfileSettings(profile);
-        settings->_ApplyGlobalSettings(globals);
-        settings->_ApplyAppearanceSettings(profile.DefaultAppearance(), globals.ColorSchemes());
+        // Hand out a child of the cached object rather than the cached object
+        // itself: callers mutate the result (newTerminalArgs overrides, font
+        // zoom, ...), and those writes need to shadow the shared copy, not
+        // edit it out from under every other pane of this profile.
+        auto settings = flattened->CreateChild();
+        settings->_KeyBindings = keybindings;
 
         Model::TerminalSettings child{ nullptr };
         if (const auto& unfocusedAppearance{ profile.UnfocusedAppearance() })
         {
             auto childImpl = settings->CreateChild();
-            childImpl->_ApplyAppearanceSettings(unfocusedAppearance, globals.ColorSchemes());
+            childImpl->_ApplyAppearanceSettings(unfocusedAppearance, appSettings.GlobalSettings().ColorSchemes());
             child = *childImpl;
         }
 
         return winrt::make<TerminalSettingsCreateResult>(*settings, child);
     }
 
+    // Method Description:
+    // - Produce the fully flattened settings object for the given profile,
+    //   reusing a cached copy when the same profile from the same settings
+    //   tree has been flattened before. Layering the profile, global and
+    //   appearance properties (including color scheme resolution) is the
+    //   expensive part of opening a pane, and for every pane of a profile
+    //   after the first it recomputes an identical object.
+    // Arguments:
+    // - appSettings: the settings tree the profile belongs to
+    // - profile: the profile to flatten
+    // Return Value:
+    // - the flattened settings object, shared with every other pane of this
+    //   profile. Callers must not mutate it directly; wrap it in CreateChild.
+    winrt::com_ptr<TerminalSettings> TerminalSettings::_FlattenProfile(const Model::CascadiaSettings& appSettings, const Model::Profile& profile)
+    {
+        std::lock_guard<std::mutex> guard{ flattenedProfileCacheLock };
+
+        const void* const key = winrt::get_abi(profile);
+        const auto cached = flattenedProfileCache.find(key);
+        if (cached != flattenedProfileCache.end())
+        {
+            if (cached->second.origin.get() == appSettings)
+            {
+                return cached->second.settings;
+            }
+            flattenedProfileCache.erase(cached);
+        }
+
+        // Drop entries whose settings tree has been reloaded away; a future
+        // allocation could otherwise reuse their profile's address.
+        for (auto entry = flattenedProfileCache.begin(); entry != flattenedProfileCache.end();)
+        {
+            entry = entry->second.origin.get() ? std::next(entry) : flattenedProfileCache.erase(entry);
+        }
+
+        auto settings{ winrt::make_self<TerminalSettings>() };
+        const auto globals = appSettings.GlobalSettings();
+        settings->_ApplyProfileSettings(profile);
+        settings->_ApplyGlobalSettings(globals);
+        settings->_ApplyAppearanceSettings(profile.DefaultAppearance(), globals.ColorSchemes());
+
+        flattenedProfileCache.emplace(key, FlattenedProfileCacheEntry{ appSettings, settings });
+        return settings;
+    }
+
     // Method Description:
     // - Create a TerminalSettings object for the provided newTerminalArgs. We'll
     //   use the newTerminalArgs to look up the profile that should be used to
@@ -287,6 +346,8 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
         _ForceVTInput = globalSettings.ForceVTInput();
         _TrimBlockSelection = globalSettings.TrimBlockSelection();
         _DetectURLs = globalSettings.DetectURLs();
+        _ScrollbackMemoryCeiling = globalSettings.ScrollbackMemoryCeiling();
+        _FairOutputScheduling = globalSettings.FairOutputScheduling();
     }
 
     // Method Description:
@@ -37,6 +37,8 @@ namespace ControlUnitTests
         TEST_METHOD(TestClearScreen);
         TEST_METHOD(TestClearAll);
 
+        TEST_METHOD(TestSynchronousOutput);
+
         TEST_CLASS_SETUP(ModuleSetup)
         {
             winrt::init_apartment(winrt::apartment_type::single_threaded);
@@ -341,4 +343,29 @@ namespace ControlUnitTests
         // The ConptyRoundtripTests test the actual clearing of the contents.
     }
 
+    void ControlCoreTests::TestSynchronousOutput()
+    {
+        auto [settings, conn] = _createSettingsAndConnection();
+        // The profiling runs this mode exists for use the software rasterizer,
+        // so the inline render pass doesn't depend on the GPU.
+        settings->SoftwareRendering(true);
+        auto core = createCore(*settings, *conn);
+        VERIFY_IS_NOT_NULL(core);
+        _standardInit(core);
+
+        core->_synchronousOutput = true;
+
+        Log::Comment(L"Write some text through the connection");
+        conn->WriteInput(L"Inline");
+        conn->WriteInput(L" pipeline");
+
+        // With the pipeline inlined, the text has to be committed to the
+        // buffer by the time WriteInput returns - there's no other thread to
+        // wait on. (The paint itself already ran too; we can't observe its
+        // output here, but a failure would have been logged.)
+        Log::Comment(L"The output must already be in the buffer");
+        const auto& tb = core->_terminal->GetTextBuffer();
+        TestUtils::VerifyExpectedString(tb, L"Inline pipeline", { 0, 0 });
+    }
+
 }
@@ -68,6 +68,7 @@ namespace RemotingUnitTests
         DeadPeasant() = default;
         void AssignID(uint64_t /*id*/) DIE;
         uint64_t GetID() DIE;
+        Remoting::PeasantInfo GetInfo() DIE;
         winrt::hstring WindowName() DIE;
         winrt::hstring ActiveTabTitle() DIE;
         void ActiveTabTitle(const winrt::hstring& /*value*/) DIE;
@@ -114,8 +115,11 @@ namespace RemotingUnitTests
         bool DoesQuakeWindowExist() DIE;
         winrt::Windows::Foundation::Collections::IVectorView<Remoting::PeasantInfo> GetPeasantInfos() DIE;
         winrt::Windows::Foundation::Collections::IVector<winrt::hstring> GetAllWindowLayouts() DIE;
+        bool PrewarmEnabled() DIE;
+        void PrewarmEnabled(bool /*enabled*/) DIE;
 
         TYPED_EVENT(FindTargetWindowRequested, winrt::Windows::Foundation::IInspectable, Remoting::FindTargetWindowArgs);
+        TYPED_EVENT(PrewarmWindowRequested, winrt::Windows::Foundation::IInspectable, winrt::Windows::Foundation::IInspectable);
         TYPED_EVENT(ShowNotificationIconRequested, winrt::Windows::Foundation::IInspectable, winrt::Windows::Foundation::IInspectable);
         TYPED_EVENT(HideNotificationIconRequested, winrt::Windows::Foundation::IInspectable, winrt::Windows::Foundation::IInspectable);
         TYPED_EVENT(WindowCreated, winrt::Windows::Foundation::IInspectable, winrt::Windows::Foundation::IInspectable);
@@ -178,6 +182,11 @@ namespace RemotingUnitTests
 
         TEST_METHOD(TestProposeCommandlineWithDeadMonarch);
 
+        TEST_METHOD(ProposeCommandlineUsesPrewarmWindow);
+        TEST_METHOD(ProposeCommandlinePrewarmDisabled);
+        TEST_METHOD(ProposeCommandlineDeadPrewarmWindow);
+        TEST_METHOD(PrewarmWindowNotUsedForNamedWindow);
+
         TEST_CLASS_SETUP(ClassSetup)
         {
             return true;
@@ -2599,4 +2608,137 @@ namespace RemotingUnitTests
         }
     }
 
+    void RemotingTests::ProposeCommandlineUsesPrewarmWindow()
+    {
+        Log::Comment(L"Once prewarm is enabled, proposing a commandline for a "
+                     L"new window should claim the prewarmed spare instead of "
+                     L"creating a new window");
+
+        const auto monarch0PID = 12345u;
+        auto m0 = make_private<Remoting::implementation::Monarch>(monarch0PID);
+        m0->FindTargetWindowRequested(&RemotingTests::_findTargetWindowHelper);
+
+        auto prewarmRequests = 0;
+        m0->PrewarmWindowRequested([&](auto&&, auto&&) {
+            prewarmRequests++;
+        });
+
+        Log::Comment(L"Enabling prewarm should immediately ask the host for a spare");
+        m0->PrewarmEnabled(true);
+        VERIFY_ARE_EQUAL(1, prewarmRequests);
+
+        Log::Comment(L"Add a peasant registered under the reserved prewarm name");
+        const auto peasant1PID = 23456u;
+        auto p1 = make_private<Remoting::implementation::Peasant>(peasant1PID);
+        p1->WindowName(winrt::hstring{ PrewarmWindowName });
+        m0->AddPeasant(*p1);
+
+        auto p1GotCommandline = false;
+        auto p1GotSummoned = false;
+        p1->ExecuteCommandlineRequested([&](auto&&, const Remoting::CommandlineArgs& cmdlineArgs) {
+            p1GotCommandline = true;
+            VERIFY_ARE_EQUAL(2u, cmdlineArgs.Commandline().size());
+            VERIFY_ARE_EQUAL(L"arg[1]", cmdlineArgs.Commandline().at(1));
+        });
+        p1->SummonRequested([&](auto&&, auto&&) {
+            p1GotSummoned = true;
+        });
+
+        std::vector<winrt::hstring> args{ L"-1", L"arg[1]" };
+        Remoting::CommandlineArgs eventArgs{ { args }, { L"" } };
+
+        auto result = m0->ProposeCommandline(eventArgs);
+        VERIFY_ARE_EQUAL(false, result.ShouldCreateWindow());
+        VERIFY_IS_TRUE(p1GotCommandline);
+        VERIFY_IS_TRUE(p1GotSummoned);
+
+        Log::Comment(L"Claiming the spare should ask the host for a replacement");
+        VERIFY_ARE_EQUAL(2, prewarmRequests);
+
+        Log::Comment(L"The spare was claimed - a second proposal should create "
+                     L"a new window (and ask for another spare)");
+        result = m0->ProposeCommandline(eventArgs);
+        VERIFY_ARE_EQUAL(true, result.ShouldCreateWindow());
+        VERIFY_ARE_EQUAL(3, prewarmRequests);
+    }
+
+    void RemotingTests::ProposeCommandlinePrewarmDisabled()
+    {
+        Log::Comment(L"Without prewarm enabled, a window that happens to have "
+                     L"the reserved prewarm name should never be handed a "
+                     L"new-window commandline");
+
+        const auto monarch0PID = 12345u;
+        auto m0 = make_private<Remoting::implementation::Monarch>(monarch0PID);
+        m0->FindTargetWindowRequested(&RemotingTests::_findTargetWindowHelper);
+
+        const auto peasant1PID = 23456u;
+        auto p1 = make_private<Remoting::implementation::Peasant>(peasant1PID);
+        p1->WindowName(winrt::hstring{ PrewarmWindowName });
+        m0->AddPeasant(*p1);
+
+        p1->ExecuteCommandlineRequested([&](auto&&, auto&&) {
+            VERIFY_IS_TRUE(false, L"The prewarm window shouldn't be used while prewarm is disabled");
+        });
+
+        std::vector<winrt::hstring> args{ L"-1" };
+        Remoting::CommandlineArgs eventArgs{ { args }, { L"" } };
+
+        auto result = m0->ProposeCommandline(eventArgs);
+        VERIFY_ARE_EQUAL(true, result.ShouldCreateWindow());
+    }
+
+    void RemotingTests::ProposeCommandlineDeadPrewarmWindow()
+    {
+        Log::Comment(L"If the prewarmed spare died, proposing a commandline "
+                     L"should fall back to creating a new window");
+
+        const auto monarch0PID = 12345u;
+        auto m0 = make_private<Remoting::implementation::Monarch>(monarch0PID);
+        m0->FindTargetWindowRequested(&RemotingTests::_findTargetWindowHelper);
+        m0->PrewarmEnabled(true);
+
+        const auto peasant1PID = 23456u;
+        auto p1 = make_private<Remoting::implementation::Peasant>(peasant1PID);
+        p1->WindowName(winrt::hstring{ PrewarmWindowName });
+        m0->AddPeasant(*p1);
+
+        Log::Comment(L"Kill the prewarm window");
+        _killPeasant(m0, p1->GetID());
+
+        std::vector<winrt::hstring> args{ L"-1" };
+        Remoting::CommandlineArgs eventArgs{ { args }, { L"" } };
+
+        auto result = m0->ProposeCommandline(eventArgs);
+        VERIFY_ARE_EQUAL(true, result.ShouldCreateWindow());
+    }
+
+    void RemotingTests::PrewarmWindowNotUsedForNamedWindow()
+    {
+        Log::Comment(L"A commandline that names a new window should bypass the "
+                     L"prewarmed spare - the spare can't take on a name "
+                     L"through this path");
+
+        const auto monarch0PID = 12345u;
+        auto m0 = make_private<Remoting::implementation::Monarch>(monarch0PID);
+        m0->FindTargetWindowRequested(&RemotingTests::_findTargetWindowByNameHelper);
+        m0->PrewarmEnabled(true);
+
+        const auto peasant1PID = 23456u;
+        auto p1 = make_private<Remoting::implementation::Peasant>(peasant1PID);
+        p1->WindowName(winrt::hstring{ PrewarmWindowName });
+        m0->AddPeasant(*p1);
+
+        p1->ExecuteCommandlineRequested([&](auto&&, auto&&) {
+            VERIFY_IS_TRUE(false, L"The prewarm window shouldn't be used for a named window");
+        });
+
+        std::vector<winrt::hstring> args{ L"theBestWindow" };
+        Remoting::CommandlineArgs eventArgs{ { args }, { L"" } };
+
+        auto result = m0->ProposeCommandline(eventArgs);
+        VERIFY_ARE_EQUAL(true, result.ShouldCreateWindow());
+        VERIFY_ARE_EQUAL(L"theBestWindow", result.WindowName());
+    }
+
 }
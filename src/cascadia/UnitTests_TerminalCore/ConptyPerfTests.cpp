@@ -0,0 +1,291 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+//
+// This test class reuses the in-proc conpty plumbing from
+// ConptyRoundtripTests - a real conhost buffer, the VT renderer, and a
+// Terminal, all wired together in one process - but guards performance
+// instead of correctness. Each test runs a scripted workload through the
+// pipeline and asserts on operation counts: frames painted, bytes put on the
+// "wire", and allocations made. Counts are machine-independent, so these
+// catch algorithmic regressions (a repaint that went quadratic, a diff that
+// stopped diffing) without the flakiness of wall-clock assertions. The
+// budgets are deliberately loose; they're tripwires, not benchmarks.
+
+#include "pch.h"
+#include "../../types/inc/Viewport.hpp"
+#include "../../types/inc/convert.hpp"
+
+#include "../renderer/inc/DummyRenderer.hpp"
+#include "../../renderer/base/Renderer.hpp"
+#include "../../renderer/vt/Xterm256Engine.hpp"
+#include "../../renderer/vt/XtermEngine.hpp"
+
+#include "../host/inputBuffer.hpp"
+#include "../host/output.h"
+#include "test/CommonState.hpp"
+
+#include "../cascadia/TerminalCore/Terminal.hpp"
+
+#include "../../inc/ConsolePerfCounters.h"
+#include "../../inc/TestUtils.h"
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+using namespace Microsoft::Console::Types;
+using namespace Microsoft::Console::Interactivity;
+using namespace Microsoft::Console::VirtualTerminal;
+
+using namespace Microsoft::Console;
+using namespace Microsoft::Console::Render;
+
+using namespace Microsoft::Terminal::Core;
+
+namespace TerminalCoreUnitTests
+{
+    class ConptyPerfTests;
+};
+using namespace TerminalCoreUnitTests;
+
+class TerminalCoreUnitTests::ConptyPerfTests final
+{
+    static const SHORT TerminalViewWidth = 80;
+    static const SHORT TerminalViewHeight = 32;
+
+    TEST_CLASS(ConptyPerfTests);
+
+    TEST_CLASS_SETUP(ClassSetup)
+    {
+        m_state = std::make_unique<CommonState>();
+
+        m_state->InitEvents();
+        m_state->PrepareGlobalFont();
+        m_state->PrepareGlobalScreenBuffer(TerminalViewWidth, TerminalViewHeight, TerminalViewWidth, TerminalViewHeight);
+        m_state->PrepareGlobalInputBuffer();
+
+        return true;
+    }
+
+    TEST_CLASS_CLEANUP(ClassCleanup)
+    {
+        m_state->CleanupGlobalScreenBuffer();
+        m_state->CleanupGlobalFont();
+        m_state->CleanupGlobalInputBuffer();
+
+        m_state.release();
+
+        return true;
+    }
+
+    TEST_METHOD_SETUP(MethodSetup)
+    {
+        // Terminal on one end...
+        term = std::make_unique<Terminal>();
+        emptyRenderer = std::make_unique<DummyRenderer>(term.get());
+        term->Create({ TerminalViewWidth, TerminalViewHeight }, 100, *emptyRenderer);
+
+        // ...conpty on the other. Same setup as ConptyRoundtripTests.
+        auto& g = ServiceLocator::LocateGlobals();
+        auto& gci = g.getConsoleInformation();
+
+        gci.SetColorTableEntry(TextColor::DEFAULT_FOREGROUND, INVALID_COLOR);
+        gci.SetColorTableEntry(TextColor::DEFAULT_BACKGROUND, INVALID_COLOR);
+        gci.SetFillAttribute(0x07); // DARK_WHITE on DARK_BLACK
+        gci.CalculateDefaultColorIndices();
+
+        g.pRender = new Renderer(gci.GetRenderSettings(), &gci.renderData, nullptr, 0, nullptr);
+
+        m_state->PrepareNewTextBufferInfo(true, TerminalViewWidth, TerminalViewHeight);
+        auto& currentBuffer = gci.GetActiveOutputBuffer();
+        VERIFY_IS_FALSE(currentBuffer._IsAltBuffer());
+        VERIFY_SUCCEEDED(currentBuffer.SetViewportOrigin(true, { 0, 0 }, true));
+
+        wil::unique_hfile hFile = wil::unique_hfile(INVALID_HANDLE_VALUE);
+        Viewport initialViewport = currentBuffer.GetViewport();
+
+        auto vtRenderEngine = std::make_unique<Xterm256Engine>(std::move(hFile),
+                                                               initialViewport);
+        auto pfn = std::bind(&ConptyPerfTests::_writeCallback, this, std::placeholders::_1, std::placeholders::_2);
+        vtRenderEngine->SetTestCallback(pfn);
+        vtRenderEngine->SetResizeQuirk(true);
+
+        g.pRender->AddRenderEngine(vtRenderEngine.get());
+        gci.GetActiveOutputBuffer().SetTerminalConnection(vtRenderEngine.get());
+
+        g.EnableConptyModeForTests(std::move(vtRenderEngine));
+
+        _bytesEmitted = 0;
+        _chunksEmitted = 0;
+
+        return true;
+    }
+
+    TEST_METHOD_CLEANUP(MethodCleanup)
+    {
+        m_state->CleanupNewTextBufferInfo();
+
+        auto& g = ServiceLocator::LocateGlobals();
+        delete g.pRender;
+
+        emptyRenderer = nullptr;
+        term = nullptr;
+
+        return true;
+    }
+
+    TEST_METHOD(BulkScrollOperationCounts);
+    TEST_METHOD(TuiRedrawOperationCounts);
+    TEST_METHOD(SgrStormOperationCounts);
+
+private:
+    bool _writeCallback(const char* const pch, size_t const cch);
+    void _flushFirstFrame();
+
+    // Everything the VT engine put on the wire since the last reset.
+    size_t _bytesEmitted{ 0 };
+    size_t _chunksEmitted{ 0 };
+
+    std::unique_ptr<CommonState> m_state;
+
+    std::unique_ptr<DummyRenderer> emptyRenderer;
+    std::unique_ptr<Terminal> term;
+};
+
+bool ConptyPerfTests::_writeCallback(const char* const pch, size_t const cch)
+{
+    _bytesEmitted += cch;
+    ++_chunksEmitted;
+
+    // Forward the output to the Terminal, so the full pipeline stays in the
+    // loop - the cost of ingesting what we emit is part of what we measure.
+    const auto actualString = std::string(pch, cch);
+    const auto converted = ConvertToW(CP_UTF8, actualString);
+    term->Write(converted);
+
+    return true;
+}
+
+void ConptyPerfTests::_flushFirstFrame()
+{
+    auto& g = ServiceLocator::LocateGlobals();
+    auto& renderer = *g.pRender;
+
+    // The first frame carries the initial clear and cursor setup; get it out
+    // of the way so the workloads below measure only themselves.
+    VERIFY_SUCCEEDED(renderer.PaintFrame());
+    _bytesEmitted = 0;
+    _chunksEmitted = 0;
+}
+
+// A client scrolling output through the viewport as fast as it can. Each
+// line should go over the wire roughly once; if a change to the renderer's
+// scrolling or invalidation logic starts repainting the whole viewport per
+// frame, the per-line byte count explodes and this trips.
+void ConptyPerfTests::BulkScrollOperationCounts()
+{
+    auto& g = ServiceLocator::LocateGlobals();
+    auto& renderer = *g.pRender;
+    auto& hostSm = g.getConsoleInformation().GetActiveOutputBuffer().GetStateMachine();
+
+    _flushFirstFrame();
+
+    const auto& counters = PerfCounters::Instance();
+    const auto framesBefore = counters.framesPainted.load(std::memory_order_relaxed);
+    const auto allocsBefore = counters.bufferAllocations.allocations.load(std::memory_order_relaxed);
+
+    constexpr auto totalLines = 200;
+    constexpr auto linesPerFrame = 10;
+    for (auto i = 0; i < totalLines; ++i)
+    {
+        hostSm.ProcessString(L"0123456789\r\n");
+        if ((i + 1) % linesPerFrame == 0)
+        {
+            VERIFY_SUCCEEDED(renderer.PaintFrame());
+        }
+    }
+
+    // Every frame had ten new lines to show, so every call must have painted
+    // exactly one frame - no more (forced extra paints), no fewer.
+    const auto framesPainted = counters.framesPainted.load(std::memory_order_relaxed) - framesBefore;
+    VERIFY_ARE_EQUAL(uint64_t{ totalLines / linesPerFrame }, framesPainted);
+
+    // Ten visible characters and a newline per line, plus slack for cursor
+    // movement and the scroll sequences themselves.
+    Log::Comment(NoThrowString().Format(L"Emitted %zu bytes for %d lines", _bytesEmitted, totalLines));
+    VERIFY_IS_LESS_THAN(_bytesEmitted, size_t{ totalLines } * 64);
+
+    // Row storage is pooled and recycled as the buffers circle; scrolling
+    // must stay O(lines) in allocations, with room for both buffers' history
+    // fills. A quadratic blowup here is orders of magnitude larger.
+    const auto allocDelta = counters.bufferAllocations.allocations.load(std::memory_order_relaxed) - allocsBefore;
+    Log::Comment(NoThrowString().Format(L"Made %llu row allocations", allocDelta));
+    VERIFY_IS_LESS_THAN(allocDelta, uint64_t{ totalLines } * 8 + 256);
+}
+
+// A TUI redrawing its whole screen without changing it - the classic
+// full-redraw-on-timer pattern. The first draw pays full price; the repaint
+// must be almost free, because the engine diffs runs against what it already
+// transmitted for each cell.
+void ConptyPerfTests::TuiRedrawOperationCounts()
+{
+    auto& g = ServiceLocator::LocateGlobals();
+    auto& renderer = *g.pRender;
+    auto& hostSm = g.getConsoleInformation().GetActiveOutputBuffer().GetStateMachine();
+
+    _flushFirstFrame();
+
+    // Compose a full screen of distinct rows, addressed with CUP so nothing
+    // scrolls. Stay off the bottom row to keep wrapping out of the picture.
+    std::wstring screen;
+    for (auto row = 0; row < TerminalViewHeight - 1; ++row)
+    {
+        screen += L"\x1b[";
+        screen += std::to_wstring(row + 1);
+        screen += L";1H";
+        screen += L"Item ";
+        screen += std::to_wstring(row);
+        screen.append(40, L'.');
+    }
+
+    hostSm.ProcessString(screen);
+    VERIFY_SUCCEEDED(renderer.PaintFrame());
+    const auto firstDrawBytes = _bytesEmitted;
+    Log::Comment(NoThrowString().Format(L"First draw emitted %zu bytes", firstDrawBytes));
+
+    _bytesEmitted = 0;
+    hostSm.ProcessString(screen);
+    VERIFY_SUCCEEDED(renderer.PaintFrame());
+    Log::Comment(NoThrowString().Format(L"Identical redraw emitted %zu bytes", _bytesEmitted));
+
+    // The redraw invalidates every row on the host side, but nothing changed,
+    // so nearly all of it must be suppressed on the wire.
+    VERIFY_IS_LESS_THAN(_bytesEmitted, firstDrawBytes / 4);
+}
+
+// A client stamping a redundant SGR in front of every single glyph. The
+// renderer paints attribute runs, so the storm must collapse to one SGR for
+// the whole run - the wire cost is bounded by the text, not by the number of
+// SGRs the client sent.
+void ConptyPerfTests::SgrStormOperationCounts()
+{
+    auto& g = ServiceLocator::LocateGlobals();
+    auto& renderer = *g.pRender;
+    auto& hostSm = g.getConsoleInformation().GetActiveOutputBuffer().GetStateMachine();
+
+    _flushFirstFrame();
+
+    std::wstring storm = L"\x1b[5;1H";
+    for (auto i = 0; i < TerminalViewWidth; ++i)
+    {
+        storm += L"\x1b[31mA";
+    }
+
+    hostSm.ProcessString(storm);
+    VERIFY_SUCCEEDED(renderer.PaintFrame());
+
+    // 80 red 'A's in, roughly 80 characters plus one SGR and a cursor move
+    // out. The input carried 480 characters of SGR noise; none of it may
+    // survive per-glyph.
+    Log::Comment(NoThrowString().Format(L"Emitted %zu bytes for the SGR storm", _bytesEmitted));
+    VERIFY_IS_LESS_THAN(_bytesEmitted, size_t{ TerminalViewWidth } * 2 + 64);
+}
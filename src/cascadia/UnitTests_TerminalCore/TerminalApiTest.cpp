@@ -34,6 +34,7 @@ namespace TerminalCoreUnitTests
         // PrintString() is called with more code units than the buffer width.
         TEST_METHOD(PrintStringOfSurrogatePairs);
         TEST_METHOD(CheckDoubleWidthCursor);
+        TEST_METHOD(GlyphWidthHintOverridesClassification);
 
         TEST_METHOD(AddHyperlink);
         TEST_METHOD(AddHyperlinkCustomId);
@@ -258,6 +259,36 @@ void TerminalApiTest::CheckDoubleWidthCursor()
     VERIFY_IS_TRUE(term.IsCursorDoubleWidth());
 }
 
+void TerminalApiTest::GlyphWidthHintOverridesClassification()
+{
+    Terminal term;
+    DummyRenderer renderer{ &term };
+    term.Create({ 100, 100 }, 0, renderer);
+
+    auto& tbi = *(term._mainBuffer);
+    auto& stateMachine = *(term._stateMachine);
+    auto& cursor = tbi.GetCursor();
+
+    // A glyph width hint covering the next two codepoints claims they're
+    // full-width. 'A' and 'B' would classify as narrow on their own; if the
+    // hint wins, the terminal really did skip re-deriving the widths.
+    stateMachine.ProcessString(L"\x1b[2;2*wAB");
+    VERIFY_IS_TRUE(cursor.GetPosition().X == 4);
+
+    term.SetCursorPosition(0, 0);
+    VERIFY_IS_TRUE(term.IsCursorDoubleWidth());
+    term.SetCursorPosition(1, 0);
+    VERIFY_IS_TRUE(term.IsCursorDoubleWidth());
+    term.SetCursorPosition(2, 0);
+    VERIFY_IS_TRUE(term.IsCursorDoubleWidth());
+
+    // The hint is spent - subsequent text classifies normally again.
+    stateMachine.ProcessString(L"C");
+    VERIFY_IS_TRUE(cursor.GetPosition().X == 5);
+    term.SetCursorPosition(4, 0);
+    VERIFY_IS_FALSE(term.IsCursorDoubleWidth());
+}
+
 void TerminalCoreUnitTests::TerminalApiTest::AddHyperlink()
 {
     // This is a nearly literal copy-paste of ScreenBufferTests::TestAddHyperlink, adapted for the Terminal
@@ -95,6 +95,17 @@ AppHost::AppHost() noexcept :
     // * IslandWindow isn't a WinRT type (so it doesn't have neat revokers like this)
     // * This particular bug scenario applies when we've already freed the window.
     //
+    // Coalesce bursts of window activations. Every focus change becomes a
+    // cross-process call to the monarch, to maintain the MRU window order, and
+    // a focus-follows-mouse user sweeping the cursor across a stack of windows
+    // can flap focus hundreds of times a minute. Publishing on a short
+    // trailing timer turns each burst into a single RPC, at the cost of
+    // `wt -w last` resolving to the previous window for up to 100ms after a
+    // focus change.
+    _windowActivationThrottler.emplace(std::chrono::milliseconds(100), [this]() {
+        _publishWindowActivated();
+    });
+
     // (Most of these events are actually set up in AppHost::Initialize)
     _window->MouseScrolled({ this, &AppHost::_WindowMouseWheeled });
     _window->WindowActivated({ this, &AppHost::_WindowActivated });
@@ -129,6 +140,10 @@ AppHost::~AppHost()
     // out the window, then close the app.
     _revokers = {};
 
+    // Tear down the activation throttler before the window: its trailing
+    // callback reads _window to build the activation args.
+    _windowActivationThrottler.reset();
+
     _window = nullptr;
     _app.Close();
     _app = nullptr;
@@ -290,27 +305,11 @@ void AppHost::_HandleCommandlineArgs()
                 }
 
                 // Create new windows for each of the other saved layouts.
-                for (const auto size = layouts.Size(); startIdx < size; startIdx += 1)
-                {
-                    auto newWindowArgs = fmt::format(L"{0} -w new -s {1}", args[0], startIdx);
-
-                    STARTUPINFO si;
-                    memset(&si, 0, sizeof(si));
-                    si.cb = sizeof(si);
-                    wil::unique_process_information pi;
-
-                    LOG_IF_WIN32_BOOL_FALSE(CreateProcessW(nullptr,
-                                                           newWindowArgs.data(),
-                                                           nullptr, // lpProcessAttributes
-                                                           nullptr, // lpThreadAttributes
-                                                           false, // bInheritHandles
-                                                           DETACHED_PROCESS | CREATE_UNICODE_ENVIRONMENT, // doCreationFlags
-                                                           nullptr, // lpEnvironment
-                                                           nullptr, // lpStartingDirectory
-                                                           &si, // lpStartupInfo
-                                                           &pi // lpProcessInformation
-                                                           ));
-                }
+                // None of those windows are ours, so there's no reason to make
+                // our own first frame wait on the (serial, blocking) process
+                // launches - kick them off on a background thread and get on
+                // with creating our window.
+                _spawnPersistedLayoutWindows(args[0], startIdx, layouts.Size());
             }
             _logic.SetNumberOfOpenWindows(numPeasants);
         }
@@ -319,6 +318,49 @@ void AppHost::_HandleCommandlineArgs()
     }
 }
 
+// Method Description:
+// - Spawns a new `wt` process for each persisted window layout that we aren't
+//   loading into this window ourselves. This is deliberately a coroutine:
+//   each CreateProcessW call costs a few milliseconds, and we're called before
+//   our own window even exists. Running the launches serially on the main
+//   thread would push our first frame out by the whole loop. The new processes
+//   will each propose their commandline to the Monarch in their own time - the
+//   ordering doesn't matter, they each get a fresh window regardless.
+// Arguments:
+// - exe: our own exe path, to use as argv[0] of the new commandlines.
+// - startIdx: the index of the first persisted layout that needs a new window.
+// - count: the total number of persisted layouts.
+// Return Value:
+// - <none>
+winrt::fire_and_forget AppHost::_spawnPersistedLayoutWindows(winrt::hstring exe,
+                                                             uint32_t startIdx,
+                                                             uint32_t count)
+{
+    co_await winrt::resume_background();
+
+    for (; startIdx < count; startIdx += 1)
+    {
+        auto newWindowArgs = fmt::format(L"{0} -w new -s {1}", exe, startIdx);
+
+        STARTUPINFO si;
+        memset(&si, 0, sizeof(si));
+        si.cb = sizeof(si);
+        wil::unique_process_information pi;
+
+        LOG_IF_WIN32_BOOL_FALSE(CreateProcessW(nullptr,
+                                               newWindowArgs.data(),
+                                               nullptr, // lpProcessAttributes
+                                               nullptr, // lpThreadAttributes
+                                               false, // bInheritHandles
+                                               DETACHED_PROCESS | CREATE_UNICODE_ENVIRONMENT, // doCreationFlags
+                                               nullptr, // lpEnvironment
+                                               nullptr, // lpStartingDirectory
+                                               &si, // lpStartupInfo
+                                               &pi // lpProcessInformation
+                                               ));
+    }
+}
+
 // Method Description:
 // - Initializes the XAML island, creates the terminal app, and sets the
 //   island's content to that of the terminal app's content. Also registers some
@@ -884,7 +926,12 @@ void AppHost::_FindTargetWindow(const winrt::Windows::Foundation::IInspectable&
     args.ResultTargetWindowName(targetWindow.WindowName());
 }
 
-winrt::fire_and_forget AppHost::_WindowActivated()
+void AppHost::_WindowActivated()
+{
+    _windowActivationThrottler.value()();
+}
+
+winrt::fire_and_forget AppHost::_publishWindowActivated()
 {
     co_await winrt::resume_background();
 
@@ -33,10 +33,14 @@ private:
     bool _useNonClientArea{ false };
 
     std::optional<til::throttled_func_trailing<>> _getWindowLayoutThrottler;
+    std::optional<til::throttled_func_trailing<>> _windowActivationThrottler;
     winrt::Windows::Foundation::IAsyncAction _SaveWindowLayouts();
     winrt::fire_and_forget _SaveWindowLayoutsRepeat();
 
     void _HandleCommandlineArgs();
+    winrt::fire_and_forget _spawnPersistedLayoutWindows(winrt::hstring exe,
+                                                        uint32_t startIdx,
+                                                        uint32_t count);
     winrt::Microsoft::Terminal::Settings::Model::LaunchPosition _GetWindowLaunchPosition();
 
     void _HandleCreateWindow(const HWND hwnd, RECT proposedRect, winrt::Microsoft::Terminal::Settings::Model::LaunchMode& launchMode);
@@ -55,7 +59,8 @@ private:
     void _RaiseVisualBell(const winrt::Windows::Foundation::IInspectable& sender,
                           const winrt::Windows::Foundation::IInspectable& arg);
     void _WindowMouseWheeled(const til::point coord, const int32_t delta);
-    winrt::fire_and_forget _WindowActivated();
+    void _WindowActivated();
+    winrt::fire_and_forget _publishWindowActivated();
     void _WindowMoved();
 
     void _DispatchCommandline(winrt::Windows::Foundation::IInspectable sender,
@@ -46,6 +46,8 @@
     X(bool, ForceVTInput, false)                                                                                  \
     X(winrt::hstring, StartingTitle)                                                                              \
     X(bool, DetectURLs, true)                                                                                     \
+    X(uint32_t, ScrollbackMemoryCeiling, 0u)                                                                      \
+    X(bool, FairOutputScheduling, false)                                                                          \
     X(bool, VtPassthrough, false)
 
 // --------------------------- Control Settings ---------------------------
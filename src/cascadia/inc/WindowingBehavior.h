@@ -11,3 +11,8 @@ constexpr int32_t WindowingBehaviorUseAnyExisting{ -3 };
 constexpr int32_t WindowingBehaviorUseName{ -4 };
 
 static constexpr std::wstring_view QuakeWindowName{ L"_quake" };
+
+// The reserved name that a hidden, prewarmed spare window registers itself
+// under. The Monarch hands these windows out in place of creating brand new
+// window processes - see Monarch::_tryDispatchToPrewarmWindow.
+static constexpr std::wstring_view PrewarmWindowName{ L"_prewarm" };
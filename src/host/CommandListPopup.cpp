@@ -12,10 +12,6 @@
 #include "dbcs.h"
 #include "../types/inc/GlyphWidth.hpp"
 
-#include "../interactivity/inc/ServiceLocator.hpp"
-
-static constexpr size_t COMMAND_NUMBER_SIZE = 8; // size of command number buffer
-
 // Routine Description:
 // - Calculates what the proposed size of the popup should be, based on the commands in the history
 // Arguments:
@@ -329,115 +325,60 @@ void CommandListPopup::_DrawContent()
 // - Draws a list of commands for the user to choose from
 void CommandListPopup::_drawList()
 {
-    // draw empty popup
+    const size_t width = gsl::narrow<size_t>(Width());
+
     COORD WriteCoord;
     WriteCoord.X = _region.Left + 1i16;
     WriteCoord.Y = _region.Top + 1i16;
-    size_t lStringLength = Width();
-    for (SHORT i = 0; i < Height(); ++i)
-    {
-        const OutputCellIterator spaces(UNICODE_SPACE, _attributes, lStringLength);
-        const auto result = _screenInfo.Write(spaces, WriteCoord);
-        lStringLength = result.GetCellDistance(spaces);
-        WriteCoord.Y += 1i16;
-    }
-
-    auto api = Microsoft::Console::Interactivity::ServiceLocator::LocateGlobals().api;
 
-    WriteCoord.Y = _region.Top + 1i16;
     SHORT i = std::max(gsl::narrow<SHORT>(_bottomIndex - Height() + 1), 0i16);
     for (; i <= _bottomIndex; i++)
     {
-        CHAR CommandNumber[COMMAND_NUMBER_SIZE];
-        // Write command number to screen.
-        if (0 != _itoa_s(i, CommandNumber, ARRAYSIZE(CommandNumber), 10))
-        {
-            return;
-        }
-
-        PCHAR CommandNumberPtr = CommandNumber;
-
-        size_t CommandNumberLength;
-        if (FAILED(StringCchLengthA(CommandNumberPtr, ARRAYSIZE(CommandNumber), &CommandNumberLength)))
-        {
-            return;
-        }
-        __assume_bound(CommandNumberLength);
-
-        if (CommandNumberLength + 1 >= ARRAYSIZE(CommandNumber))
-        {
-            return;
-        }
-
-        CommandNumber[CommandNumberLength] = ':';
-        CommandNumber[CommandNumberLength + 1] = ' ';
-        CommandNumberLength += 2;
-        if (CommandNumberLength > static_cast<ULONG>(Width()))
+        // Compose the whole line in memory - the command number, the command
+        // clipped to the popup and blank padding out to the border - so each
+        // visible row costs a single run write instead of separate
+        // number/text/attribute passes over the same cells.
+        std::wstring line = std::to_wstring(i);
+        line.append(L": ");
+        if (line.size() > width)
         {
-            CommandNumberLength = static_cast<ULONG>(Width());
+            line.resize(width);
         }
 
-        WriteCoord.X = _region.Left + 1i16;
-
-        LOG_IF_FAILED(api->WriteConsoleOutputCharacterAImpl(_screenInfo,
-                                                            { CommandNumberPtr, CommandNumberLength },
-                                                            WriteCoord,
-                                                            CommandNumberLength));
-
-        // write command to screen
-        auto command = _history.GetNth(i);
-        lStringLength = command.size();
+        // Clip the command so it fits in the remaining columns, counting
+        // fullwidth glyphs as two.
+        const auto command = _history.GetNth(i);
+        const size_t available = width - line.size();
+        size_t colsUsed = 0;
+        size_t charsKept = 0;
+        for (const auto wch : command)
         {
-            size_t lTmpStringLength = lStringLength;
-            LONG lPopupLength = static_cast<LONG>(Width() - CommandNumberLength);
-            PCWCHAR lpStr = command.data();
-            while (lTmpStringLength--)
+            const size_t glyphWidth = IsGlyphFullWidth(wch) ? 2 : 1;
+            if (colsUsed + glyphWidth > available)
             {
-                if (IsGlyphFullWidth(*lpStr++))
-                {
-                    lPopupLength -= 2;
-                }
-                else
-                {
-                    lPopupLength--;
-                }
-
-                if (lPopupLength <= 0)
-                {
-                    lStringLength -= lTmpStringLength;
-                    if (lPopupLength < 0)
-                    {
-                        lStringLength--;
-                    }
-
-                    break;
-                }
+                break;
             }
+            colsUsed += glyphWidth;
+            ++charsKept;
         }
+        line.append(command.data(), charsKept);
+        line.append(available - colsUsed, UNICODE_SPACE);
 
-        WriteCoord.X = gsl::narrow<SHORT>(WriteCoord.X + CommandNumberLength);
-        size_t used;
-        LOG_IF_FAILED(api->WriteConsoleOutputCharacterWImpl(_screenInfo,
-                                                            { command.data(), lStringLength },
-                                                            WriteCoord,
-                                                            used));
-
-        // write attributes to screen
+        TextAttribute attr = _attributes;
         if (i == _currentCommand)
         {
-            WriteCoord.X = _region.Left + 1i16;
-            // inverted attributes
-            lStringLength = Width();
-            TextAttribute inverted = _attributes;
-            inverted.Invert();
-
-            const OutputCellIterator it(inverted, lStringLength);
-            const auto done = _screenInfo.Write(it, WriteCoord);
-
-            lStringLength = done.GetCellDistance(it);
+            attr.Invert();
         }
 
-        WriteCoord.Y += 1;
+        _screenInfo.Write(OutputCellIterator(line, attr), WriteCoord);
+        WriteCoord.Y += 1i16;
+    }
+
+    // blank out any leftover rows when the history is shorter than the popup
+    while (WriteCoord.Y <= _region.Bottom - 1i16)
+    {
+        _screenInfo.Write(OutputCellIterator(UNICODE_SPACE, _attributes, width), WriteCoord);
+        WriteCoord.Y += 1i16;
     }
 }
 
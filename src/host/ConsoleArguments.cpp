@@ -25,6 +25,7 @@ const std::wstring_view ConsoleArguments::FEATURE_ARG = L"--feature";
 const std::wstring_view ConsoleArguments::FEATURE_PTY_ARG = L"pty";
 const std::wstring_view ConsoleArguments::COM_SERVER_ARG = L"-Embedding";
 const std::wstring_view ConsoleArguments::PASSTHROUGH_ARG = L"--passthrough";
+const std::wstring_view ConsoleArguments::GLYPH_WIDTH_HINTS_ARG = L"--glyphWidthHints";
 
 std::wstring EscapeArgument(std::wstring_view ac)
 {
@@ -515,6 +516,12 @@ void ConsoleArguments::s_ConsumeArg(_Inout_ std::vector<std::wstring>& args, _In
             s_ConsumeArg(args, i);
             hr = S_OK;
         }
+        else if (arg == GLYPH_WIDTH_HINTS_ARG)
+        {
+            _glyphWidthHints = true;
+            s_ConsumeArg(args, i);
+            hr = S_OK;
+        }
         else if (arg == CLIENT_COMMANDLINE_ARG)
         {
             // Everything after this is the explicit commandline
@@ -675,6 +682,10 @@ bool ConsoleArguments::IsWin32InputModeEnabled() const
 {
     return _win32InputMode;
 }
+bool ConsoleArguments::IsGlyphWidthHintsEnabled() const noexcept
+{
+    return _glyphWidthHints;
+}
 
 #ifdef UNIT_TESTING
 // Method Description:
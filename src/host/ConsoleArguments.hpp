@@ -56,6 +56,7 @@ public:
     bool GetInheritCursor() const;
     bool IsResizeQuirkEnabled() const;
     bool IsWin32InputModeEnabled() const;
+    bool IsGlyphWidthHintsEnabled() const noexcept;
 
 #ifdef UNIT_TESTING
     void EnableConptyModeForTests();
@@ -79,6 +80,7 @@ public:
     static const std::wstring_view FEATURE_PTY_ARG;
     static const std::wstring_view COM_SERVER_ARG;
     static const std::wstring_view PASSTHROUGH_ARG;
+    static const std::wstring_view GLYPH_WIDTH_HINTS_ARG;
 
 private:
 #ifdef UNIT_TESTING
@@ -145,6 +147,7 @@ private:
     bool _inheritCursor;
     bool _resizeQuirk{ false };
     bool _win32InputMode{ false };
+    bool _glyphWidthHints{ false };
 
     [[nodiscard]] HRESULT _GetClientCommandline(_Inout_ std::vector<std::wstring>& args,
                                                 const size_t index,
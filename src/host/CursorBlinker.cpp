@@ -88,6 +88,14 @@ void CursorBlinker::TimerRoutine(SCREEN_INFORMATION& ScreenInfo) const noexcept
         goto DoScroll;
     }
 
+    // A minimized window has nothing to paint. Skip the caret updates and the
+    // blink rendition toggle so the timer doesn't keep waking the renderer to
+    // redraw an invisible cursor; the next tick after restore catches up.
+    if (WI_IsFlagSet(gci.Flags, CONSOLE_IS_ICONIC))
+    {
+        goto DoScroll;
+    }
+
     // Update the cursor pos in USER so accessibility will work.
     // Don't do all this work or send events if we don't have a notifier target.
     if (pAccessibilityNotifier && cursor.HasMoved())
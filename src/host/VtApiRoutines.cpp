@@ -106,45 +106,45 @@ void VtApiRoutines::_SynchronizeCursor(std::unique_ptr<IWaitRoutine>& waiter) no
 }
 
 [[nodiscard]] HRESULT VtApiRoutines::PeekConsoleInputAImpl(IConsoleInputObject& context,
-                                                           std::deque<std::unique_ptr<IInputEvent>>& outEvents,
+                                                           std::deque<INPUT_RECORD>& outRecords,
                                                            const size_t eventsToRead,
                                                            INPUT_READ_HANDLE_DATA& readHandleState,
                                                            std::unique_ptr<IWaitRoutine>& waiter) noexcept
 {
-    const auto hr = m_pUsualRoutines->PeekConsoleInputAImpl(context, outEvents, eventsToRead, readHandleState, waiter);
+    const auto hr = m_pUsualRoutines->PeekConsoleInputAImpl(context, outRecords, eventsToRead, readHandleState, waiter);
     _SynchronizeCursor(waiter);
     return hr;
 }
 
 [[nodiscard]] HRESULT VtApiRoutines::PeekConsoleInputWImpl(IConsoleInputObject& context,
-                                                           std::deque<std::unique_ptr<IInputEvent>>& outEvents,
+                                                           std::deque<INPUT_RECORD>& outRecords,
                                                            const size_t eventsToRead,
                                                            INPUT_READ_HANDLE_DATA& readHandleState,
                                                            std::unique_ptr<IWaitRoutine>& waiter) noexcept
 {
-    const auto hr = m_pUsualRoutines->PeekConsoleInputWImpl(context, outEvents, eventsToRead, readHandleState, waiter);
+    const auto hr = m_pUsualRoutines->PeekConsoleInputWImpl(context, outRecords, eventsToRead, readHandleState, waiter);
     _SynchronizeCursor(waiter);
     return hr;
 }
 
 [[nodiscard]] HRESULT VtApiRoutines::ReadConsoleInputAImpl(IConsoleInputObject& context,
-                                                           std::deque<std::unique_ptr<IInputEvent>>& outEvents,
+                                                           std::deque<INPUT_RECORD>& outRecords,
                                                            const size_t eventsToRead,
                                                            INPUT_READ_HANDLE_DATA& readHandleState,
                                                            std::unique_ptr<IWaitRoutine>& waiter) noexcept
 {
-    const auto hr = m_pUsualRoutines->ReadConsoleInputAImpl(context, outEvents, eventsToRead, readHandleState, waiter);
+    const auto hr = m_pUsualRoutines->ReadConsoleInputAImpl(context, outRecords, eventsToRead, readHandleState, waiter);
     _SynchronizeCursor(waiter);
     return hr;
 }
 
 [[nodiscard]] HRESULT VtApiRoutines::ReadConsoleInputWImpl(IConsoleInputObject& context,
-                                                           std::deque<std::unique_ptr<IInputEvent>>& outEvents,
+                                                           std::deque<INPUT_RECORD>& outRecords,
                                                            const size_t eventsToRead,
                                                            INPUT_READ_HANDLE_DATA& readHandleState,
                                                            std::unique_ptr<IWaitRoutine>& waiter) noexcept
 {
-    const auto hr = m_pUsualRoutines->ReadConsoleInputWImpl(context, outEvents, eventsToRead, readHandleState, waiter);
+    const auto hr = m_pUsualRoutines->ReadConsoleInputWImpl(context, outRecords, eventsToRead, readHandleState, waiter);
     _SynchronizeCursor(waiter);
     return hr;
 }
@@ -209,7 +209,9 @@ void VtApiRoutines::_SynchronizeCursor(std::unique_ptr<IWaitRoutine>& waiter) no
     }
     else
     {
-        (void)m_pVtEngine->WriteTerminalW(ConvertToW(m_outputCodepage, buffer));
+        // Stream straight into the engine's outgoing buffer rather than going
+        // through WriteTerminalW, which would flush on its own before we do.
+        (void)m_pVtEngine->_WriteTerminalUtf8Stream(ConvertToW(m_outputCodepage, buffer));
     }
 
     (void)m_pVtEngine->_Flush();
@@ -223,7 +225,11 @@ void VtApiRoutines::_SynchronizeCursor(std::unique_ptr<IWaitRoutine>& waiter) no
                                                        bool requiresVtQuirk,
                                                        std::unique_ptr<IWaitRoutine>& waiter) noexcept
 {
-    (void)m_pVtEngine->WriteTerminalW(buffer);
+    // Convert statefully straight into the engine's outgoing buffer: the
+    // stream state carries a surrogate pair split across two WriteConsoleW
+    // calls, and skipping WriteTerminalW's internal flush means each payload
+    // only crosses the pipe once.
+    (void)m_pVtEngine->_WriteTerminalUtf8Stream(buffer);
     (void)m_pVtEngine->_Flush();
     read = buffer.size();
     return S_OK;
@@ -280,13 +286,19 @@ void VtApiRoutines::_SynchronizeCursor(std::unique_ptr<IWaitRoutine>& waiter) no
                                                                      const bool enablePowershellShim) noexcept
 {
     (void)m_pVtEngine->_CursorPosition(startingCoordinate);
-    const std::wstring_view sv{ &character, 1 };
 
-    // TODO GH10001: horrible. it'll WC2MB over and over...we should do that once then emit... and then rep...
-    // TODO GH10001: there's probably an optimization for if ((character & 0x7F) == character) --> call the UTF8 one.
-    for (size_t i = 0; i < lengthToWrite; ++i)
+    if ((character & 0x7F) == character)
     {
-        (void)m_pVtEngine->WriteTerminalW(sv);
+        // ASCII encodes identically in UTF-8, so we can skip conversion
+        // entirely and fill straight into the output buffer.
+        (void)m_pVtEngine->_WriteFill(lengthToWrite, static_cast<char>(character));
+    }
+    else
+    {
+        // Repeat the character into one string so the conversion to the
+        // output encoding happens once for the whole fill, not once per cell.
+        const std::wstring fill(lengthToWrite, character);
+        (void)m_pVtEngine->WriteTerminalW(fill);
     }
 
     (void)m_pVtEngine->_Flush();
@@ -5,6 +5,7 @@
 
 #include "VtInputThread.hpp"
 
+#include "../inc/ConptyCapture.h"
 #include "../interactivity/inc/ServiceLocator.hpp"
 #include "input.h"
 #include "../terminal/parser/InputStateMachineEngine.hpp"
@@ -32,7 +33,10 @@ VtInputThread::VtInputThread(_In_ wil::unique_hfile hPipe,
     _dwThreadId{ 0 },
     _exitRequested{ false },
     _exitResult{ S_OK },
-    _pfnSetLookingForDSR{}
+    _pfnSetLookingForDSR{},
+    _buffer(BufferSizeRest),
+    _bufferHighWater{ BufferSizeRest },
+    _lastRead{ std::chrono::steady_clock::now() }
 {
     THROW_HR_IF(E_HANDLE, _hFile.get() == INVALID_HANDLE_VALUE);
 
@@ -105,6 +109,12 @@ DWORD WINAPI VtInputThread::StaticVtInputThreadProc(_In_ LPVOID lpParameter)
 // Method Description:
 // - Do a single ReadFile from our pipe, and try and handle it. If handling
 //      failed, throw or log, depending on what the caller wants.
+// - The read buffer adapts to the traffic: a read that comes back full means
+//      the pipe had more waiting, so the buffer doubles (up to the ceiling)
+//      for the next read; the first read after a long quiet gap returns it to
+//      its resting size, so an idle session doesn't pin a burst's worst case.
+//      The UTF-8 carry state in _HandleRunInput already tolerates sequences
+//      split at arbitrary byte offsets, so resizes never lose characters.
 // Arguments:
 // - throwOnFail: If true, throw an exception if there was an error processing
 //      the input received. Otherwise, log the error.
@@ -112,9 +122,8 @@ DWORD WINAPI VtInputThread::StaticVtInputThreadProc(_In_ LPVOID lpParameter)
 // - <none>
 void VtInputThread::DoReadInput(const bool throwOnFail)
 {
-    char buffer[256];
     DWORD dwRead = 0;
-    bool fSuccess = !!ReadFile(_hFile.get(), buffer, ARRAYSIZE(buffer), &dwRead, nullptr);
+    bool fSuccess = !!ReadFile(_hFile.get(), _buffer.data(), gsl::narrow_cast<DWORD>(_buffer.size()), &dwRead, nullptr);
 
     // If we failed to read because the terminal broke our pipe (usually due
     //      to dying itself), close gracefully with ERROR_BROKEN_PIPE.
@@ -127,7 +136,21 @@ void VtInputThread::DoReadInput(const bool throwOnFail)
         return;
     }
 
-    HRESULT hr = _HandleRunInput({ buffer, gsl::narrow_cast<size_t>(dwRead) });
+    // The idle time is spent blocked inside ReadFile above, so the gap to
+    // measure is between the previous read completing and this one.
+    const auto now = std::chrono::steady_clock::now();
+    const bool wasIdle = now - _lastRead > BufferShrinkAfter;
+    _lastRead = now;
+
+    // If a capture was requested (CONPTY_CAPTURE_DIR), record the terminal's
+    // side of the conversation too, so a replay can drive input at the
+    // recorded cadence.
+    if (const auto capture = ConptyCapture::ProcessCapture())
+    {
+        capture->Record(ConptyCapture::Direction::Input, _buffer.data(), dwRead);
+    }
+
+    HRESULT hr = _HandleRunInput({ _buffer.data(), gsl::narrow_cast<size_t>(dwRead) });
     if (FAILED(hr))
     {
         if (throwOnFail)
@@ -140,6 +163,26 @@ void VtInputThread::DoReadInput(const bool throwOnFail)
             LOG_IF_FAILED(hr);
         }
     }
+
+    if (dwRead == _buffer.size() && _buffer.size() < BufferSizeCeiling)
+    {
+        _buffer.resize(std::min(_buffer.size() * 2, BufferSizeCeiling));
+        if (_buffer.size() > _bufferHighWater)
+        {
+            _bufferHighWater = _buffer.size();
+            TraceLoggingWrite(
+                g_hConhostV2EventTraceProvider,
+                "VtInputBufferHighWater",
+                TraceLoggingUInt64(gsl::narrow_cast<uint64_t>(_bufferHighWater), "BufferSizeInBytes"),
+                TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+                TraceLoggingKeyword(TIL_KEYWORD_TRACE));
+        }
+    }
+    else if (wasIdle && dwRead <= BufferSizeRest && _buffer.size() > BufferSizeRest)
+    {
+        _buffer.resize(BufferSizeRest);
+        _buffer.shrink_to_fit();
+    }
 }
 
 void VtInputThread::SetLookingForDSR(const bool looking) noexcept
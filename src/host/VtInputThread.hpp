@@ -43,5 +43,19 @@ namespace Microsoft::Console
 
         std::unique_ptr<Microsoft::Console::VirtualTerminal::StateMachine> _pInputStateMachine;
         til::u8state _u8State;
+
+        // The resting size covers interactive typing; the ceiling covers a
+        // terminal blasting win32-input-mode keystrokes or a bracketed paste.
+        static constexpr size_t BufferSizeRest = 4 * 1024;
+        static constexpr size_t BufferSizeCeiling = 1024 * 1024;
+        // How long the channel has to stay quiet before the buffer returns to
+        // its resting size.
+        static constexpr auto BufferShrinkAfter = std::chrono::seconds{ 10 };
+
+        // Reused across reads so a burst of input isn't chopped into tiny
+        // ReadFile round trips; sized adaptively by DoReadInput.
+        std::vector<char> _buffer;
+        size_t _bufferHighWater;
+        std::chrono::steady_clock::time_point _lastRead;
     };
 }
@@ -74,6 +74,7 @@ VtIo::VtIo() :
     _resizeQuirk = pArgs->IsResizeQuirkEnabled();
     _win32InputMode = pArgs->IsWin32InputModeEnabled();
     _passthroughMode = pArgs->IsPassthroughMode();
+    _glyphWidthHints = pArgs->IsGlyphWidthHintsEnabled();
 
     // If we were already given VT handles, set up the VT IO engine to use those.
     if (pArgs->InConptyMode())
@@ -217,6 +218,14 @@ VtIo::VtIo() :
             {
                 _pVtRenderEngine->SetTerminalOwner(this);
                 _pVtRenderEngine->SetResizeQuirk(_resizeQuirk);
+                _pVtRenderEngine->SetGlyphWidthHints(_glyphWidthHints);
+
+                // If the handoff negotiated a shared memory ring for the
+                // output stream, frames go there instead of the pipe.
+                if (globals.handoffOutputRing)
+                {
+                    _pVtRenderEngine->SetOutputRing(std::move(globals.handoffOutputRing));
+                }
             }
         }
     }
@@ -52,7 +52,9 @@ void WriteToScreen(SCREEN_INFORMATION& screenInfo, const Viewport& region)
     {
         if (ServiceLocator::LocateGlobals().pRender != nullptr)
         {
-            ServiceLocator::LocateGlobals().pRender->TriggerRedraw(region);
+            // Only the part of the region that's actually in view needs to
+            // reach the renderer; we already computed it above.
+            ServiceLocator::LocateGlobals().pRender->TriggerRedraw(clippedRegion);
         }
     }
 
@@ -390,6 +390,39 @@ using Microsoft::Console::VirtualTerminal::StateMachine;
         wchar_t* LocalBufPtr = LocalBuffer;
         while (*pcb < BufferSize && i < LOCAL_BUFFER_SIZE && XPosition < coordScreenBufferSize.X)
         {
+            // Fast path: a maximal run of plain ASCII glyphs can be committed
+            // in one go. Each one is exactly one column wide and one code unit
+            // long, so the per-character classification below (glyph checks,
+            // width measurement, five pointer increments) collapses into a
+            // single memcpy and a bulk advance of all the counters. This is
+            // the overwhelming majority of legacy console output, and this
+            // function is the top conhost frame when tracing such apps. DEL
+            // (0x7F) and everything above ASCII take the classified path.
+            {
+                const auto cchRemaining = (BufferSize - *pcb) / sizeof(WCHAR);
+                const auto cchFit = std::min<size_t>({ cchRemaining,
+                                                       LOCAL_BUFFER_SIZE - i,
+                                                       gsl::narrow_cast<size_t>(coordScreenBufferSize.X - XPosition) });
+                size_t cchSpan = 0;
+                while (cchSpan < cchFit && lpString[cchSpan] >= UNICODE_SPACE && lpString[cchSpan] < L'\x7f')
+                {
+                    cchSpan++;
+                }
+
+                if (cchSpan != 0)
+                {
+                    memcpy(LocalBufPtr, lpString, cchSpan * sizeof(wchar_t));
+                    LocalBufPtr += cchSpan;
+                    XPosition += gsl::narrow_cast<SHORT>(cchSpan);
+                    i += cchSpan;
+                    pwchBuffer += cchSpan;
+                    lpString += cchSpan;
+                    pwchRealUnicode += cchSpan;
+                    *pcb += cchSpan * sizeof(WCHAR);
+                    continue;
+                }
+            }
+
 #pragma prefast(suppress : 26019, "Buffer is taken in multiples of 2. Validation is ok.")
             const wchar_t Char = *lpString;
             // WCL-NOTE: We believe RealUnicodeChar to be identical to Char, because we believe pwchRealUnicode
@@ -981,6 +1014,14 @@ using Microsoft::Console::VirtualTerminal::StateMachine;
                 StateMachine& machine = screenInfo.GetStateMachine();
                 size_t const cch = BufferSize / sizeof(WCHAR);
 
+                // Defer the cursor drawing across the entire string. The state
+                // machine dispatches it as many separate print runs and cursor
+                // operations, and each one redrawing the cursor on completion
+                // adds up fast on output-heavy workloads.
+                Cursor& cursor = screenInfo.GetTextBuffer().GetCursor();
+                cursor.StartDeferDrawing();
+                auto endDefer = wil::scope_exit([&]() noexcept { cursor.EndDeferDrawing(); });
+
                 machine.ProcessString({ pwchRealUnicode, cch });
                 *pcb += BufferSize;
             }
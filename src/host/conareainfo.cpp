@@ -221,3 +221,39 @@ void ConversionAreaInfo::Paint() const noexcept
         WriteToScreen(ScreenInfo, Viewport::FromInclusive(WriteRegion));
     }
 }
+
+// Routine Description:
+// - Paints only a subrange of the columns of this conversion area, for callers that
+//   know which cells have actually changed since the last paint.
+// Arguments:
+// - firstColumn - First changed column, in conversion area buffer coordinates
+// - lastColumn - Last changed column (inclusive), in conversion area buffer coordinates
+void ConversionAreaInfo::PaintRange(const SHORT firstColumn, const SHORT lastColumn) const noexcept
+{
+    CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+    SCREEN_INFORMATION& ScreenInfo = gci.GetActiveOutputBuffer();
+    const auto viewport = ScreenInfo.GetViewport();
+
+    // Restrict the requested columns to the portion of the buffer that is displayed.
+    const SHORT left = std::max(firstColumn, _caInfo.rcViewCaWindow.Left);
+    const SHORT right = std::min(lastColumn, _caInfo.rcViewCaWindow.Right);
+    if (right < left)
+    {
+        return;
+    }
+
+    SMALL_RECT WriteRegion;
+    WriteRegion.Left = viewport.Left() + _caInfo.coordConView.X + left;
+    WriteRegion.Right = viewport.Left() + _caInfo.coordConView.X + right;
+    WriteRegion.Top = viewport.Top() + _caInfo.coordConView.Y + _caInfo.rcViewCaWindow.Top;
+    WriteRegion.Bottom = WriteRegion.Top + (_caInfo.rcViewCaWindow.Bottom - _caInfo.rcViewCaWindow.Top);
+
+    if (!IsHidden())
+    {
+        WriteConvRegionToScreen(ScreenInfo, Viewport::FromInclusive(WriteRegion));
+    }
+    else
+    {
+        WriteToScreen(ScreenInfo, Viewport::FromInclusive(WriteRegion));
+    }
+}
@@ -60,6 +60,7 @@ public:
     void SetViewPos(const COORD pos) noexcept;
     void SetWindowInfo(const SMALL_RECT view) noexcept;
     void Paint() const noexcept;
+    void PaintRange(const SHORT firstColumn, const SHORT lastColumn) const noexcept;
 
     void WriteText(const std::vector<OutputCell>& text, const SHORT column);
     void SetAttributes(const TextAttribute& attr);
@@ -43,7 +43,6 @@ void ConsoleImeInfo::RedrawCompMessage()
 {
     if (!_text.empty())
     {
-        ClearAllAreas();
         _WriteUndeterminedChars(_text, _attributes, _colorArray);
     }
 }
@@ -60,8 +59,6 @@ void ConsoleImeInfo::WriteCompMessage(const std::wstring_view text,
                                       const gsl::span<const BYTE> attributes,
                                       const gsl::span<const WORD> colorArray)
 {
-    ClearAllAreas();
-
     // MSFT:29219348 only hide the cursor after the IME produces a string.
     // See notes in convarea.cpp ImeStartComposition().
     SaveCursorVisibility();
@@ -223,14 +220,15 @@ std::vector<OutputCell> ConsoleImeInfo::s_ConvertToCells(const std::wstring_view
 {
     std::vector<OutputCell> cells;
 
-    // - Convert incoming wchar_t stream into UTF-16 units.
-    const auto glyphs = Utf16Parser::Parse(text);
+    // - Convert incoming wchar_t stream into UTF-16 units. The views alias
+    //   `text`, so no per-glyph allocations are made.
+    std::vector<std::wstring_view> glyphs;
+    Utf16Parser::ParseInto(text, glyphs);
 
     // - Walk through all of the grouped up text, match up the correct attribute to it, and make a new cell.
     size_t attributesUsed = 0;
-    for (const auto& parsedGlyph : glyphs)
+    for (const auto& glyph : glyphs)
     {
-        const std::wstring_view glyph{ parsedGlyph.data(), parsedGlyph.size() };
         // Collect up attributes that apply to this glyph range.
         auto drawingAttr = s_RetrieveAttributeAt(attributesUsed, attributes, colorArray);
         attributesUsed++;
@@ -303,6 +301,7 @@ std::vector<OutputCell> ConsoleImeInfo::s_ConvertToCells(const std::wstring_view
 //       - Updated to set up the next conversion area down a line (and to the left viewport edge)
 // - view - The rectangle representing the viewable area of the screen right now to let us know how many cells can fit.
 // - screenInfo - A reference to the screen information we will use for accessibility notifications
+// - areaIndex - Which conversion area (line) this call should fill. An existing area is reused if one is available.
 // Return Value:
 // - Updated begin position for the next call. It will normally be >begin and <= end.
 //   However, if text couldn't fit in our line (full-width character starting at the very last cell)
@@ -312,7 +311,8 @@ std::vector<OutputCell>::const_iterator ConsoleImeInfo::_WriteConversionArea(con
                                                                              const std::vector<OutputCell>::const_iterator end,
                                                                              COORD& pos,
                                                                              const Microsoft::Console::Types::Viewport view,
-                                                                             SCREEN_INFORMATION& screenInfo)
+                                                                             SCREEN_INFORMATION& screenInfo,
+                                                                             const size_t areaIndex)
 {
     // The position in the viewport where we will start inserting cells for this conversion area
     // NOTE: We might exit early if there's not enough space to fit here, so we take a copy of
@@ -356,24 +356,88 @@ std::vector<OutputCell>::const_iterator ConsoleImeInfo::_WriteConversionArea(con
     // Copy out the substring into a vector.
     const std::vector<OutputCell> lineVec(lineBegin, lineEnd);
 
-    // Add a conversion area to the internal state to hold this line.
-    THROW_IF_FAILED(_AddConversionArea());
-
-    // Get the added conversion area.
-    auto& area = ConvAreaCompStr.back();
+    // Add a conversion area to the internal state to hold this line, unless a
+    // previous composition left one behind that we can reuse.
+    if (areaIndex >= ConvAreaCompStr.size())
+    {
+        THROW_IF_FAILED(_AddConversionArea());
+    }
 
-    // Write our text into the conversion area.
-    area.WriteText(lineVec, insertionPos.X);
+    // Get the conversion area for this line.
+    auto& area = ConvAreaCompStr.at(areaIndex);
 
-    // Set the viewport and positioning parameters for the conversion area to describe to the renderer
+    // The viewport and positioning parameters for the conversion area describing to the renderer
     // the appropriate location to overlay this conversion area on top of the main screen buffer inside the viewport.
     const SMALL_RECT region{ insertionPos.X, 0, gsl::narrow<SHORT>(insertionPos.X + lineVec.size() - 1), 0 };
-    area.SetWindowInfo(region);
-    area.SetViewPos({ 0 - view.Left(), insertionPos.Y - view.Top() });
+    const COORD viewPos{ gsl::narrow<SHORT>(0 - view.Left()), gsl::narrow<SHORT>(insertionPos.Y - view.Top()) };
+
+    // Determine whether the area is already visible in exactly the right place, which is the
+    // common case while a composition grows or changes one keystroke at a time.
+    const auto& caInfo = area.GetAreaBufferInfo();
+    const bool sameGeometry = !area.IsHidden() &&
+                              caInfo.rcViewCaWindow.Left == region.Left &&
+                              caInfo.rcViewCaWindow.Top == region.Top &&
+                              caInfo.rcViewCaWindow.Right == region.Right &&
+                              caInfo.rcViewCaWindow.Bottom == region.Bottom &&
+                              caInfo.coordConView.X == viewPos.X &&
+                              caInfo.coordConView.Y == viewPos.Y;
+
+    if (sameGeometry)
+    {
+        // Diff the new line against what the area is already showing so we only repaint
+        // the columns that actually changed (typically just the latest glyph and the
+        // cells where the cursor marking moved).
+        std::optional<SHORT> firstDirty;
+        SHORT lastDirty = 0;
+        auto oldCell = area.GetTextBuffer().GetCellDataAt({ insertionPos.X, 0 });
+        for (size_t i = 0; i < lineVec.size(); i++, ++oldCell)
+        {
+            const auto& newCell = lineVec.at(i);
+            if (!oldCell ||
+                (*oldCell).Chars() != newCell.Chars() ||
+                (*oldCell).DbcsAttr() != newCell.DbcsAttr() ||
+                (*oldCell).TextAttr() != newCell.TextAttr())
+            {
+                const auto column = gsl::narrow<SHORT>(insertionPos.X + i);
+                if (!firstDirty)
+                {
+                    firstDirty = column;
+                }
+                lastDirty = column;
+            }
+        }
+
+        // Write our text into the conversion area and repaint just the changed span.
+        // If nothing changed, there's nothing to write or paint at all.
+        if (firstDirty)
+        {
+            area.WriteText(lineVec, insertionPos.X);
+            area.PaintRange(firstDirty.value(), lastDirty);
+        }
+    }
+    else
+    {
+        // Hide the area while we reposition it. Painting while hidden restores the
+        // underlying buffer at the old location; the final paint below draws the
+        // area at the new one.
+        if (!area.IsHidden())
+        {
+            area.SetHidden(true);
+            area.Paint();
+        }
+
+        // Write our text into the conversion area.
+        area.WriteText(lineVec, insertionPos.X);
 
-    // Make it visible and paint it.
-    area.SetHidden(false);
-    area.Paint();
+        // Set the viewport and positioning parameters for the conversion area to describe to the renderer
+        // the appropriate location to overlay this conversion area on top of the main screen buffer inside the viewport.
+        area.SetWindowInfo(region);
+        area.SetViewPos(viewPos);
+
+        // Make it visible and paint it.
+        area.SetHidden(false);
+        area.Paint();
+    }
 
     // Notify accessibility that we have updated the text in this display region within the viewport.
     if (screenInfo.HasAccessibilityEventing())
@@ -405,16 +469,21 @@ void ConsoleImeInfo::_WriteUndeterminedChars(const std::wstring_view text,
     // Ensure cursor is visible for prompt line
     screenInfo.MakeCurrentCursorVisible();
 
-    // Clear out existing conversion areas.
-    ConvAreaCompStr.clear();
-
     // If the text length and attribute length don't match,
     // it's a programming error on our part. We control the sizes here.
     FAIL_FAST_IF(text.size() != attributes.size());
 
-    // If we have no text, return. We've already cleared above.
+    // If we have no text, hide whatever the areas were showing and return. The areas
+    // themselves (and their buffers) are kept so the next composition can reuse them.
     if (text.empty())
     {
+        for (auto& area : ConvAreaCompStr)
+        {
+            if (!area.IsHidden())
+            {
+                area.ClearArea();
+            }
+        }
         return;
     }
 
@@ -438,11 +507,25 @@ void ConsoleImeInfo::_WriteUndeterminedChars(const std::wstring_view text,
     auto begin = cells.cbegin();
     const auto end = cells.cend();
 
+    // The number of conversion areas (display lines) this update occupies.
+    size_t areasUsed = 0;
+
     // Write over and over updating the beginning iterator until we reach the end.
     do
     {
-        begin = _WriteConversionArea(begin, end, pos, view, screenInfo);
+        begin = _WriteConversionArea(begin, end, pos, view, screenInfo, areasUsed);
+        areasUsed++;
     } while (begin < end);
+
+    // If the previous composition occupied more lines than this one, hide the leftovers.
+    for (size_t i = areasUsed; i < ConvAreaCompStr.size(); i++)
+    {
+        auto& area = ConvAreaCompStr.at(i);
+        if (!area.IsHidden())
+        {
+            area.ClearArea();
+        }
+    }
 }
 
 // Routine Description:
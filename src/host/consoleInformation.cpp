@@ -13,7 +13,10 @@
 
 #include <til/ticket_lock.h>
 
+#include "../inc/ConsolePerfCounters.h"
+
 using Microsoft::Console::Interactivity::ServiceLocator;
+using Microsoft::Console::PerfCounters;
 using Microsoft::Console::VirtualTerminal::VtIo;
 
 CONSOLE_INFORMATION::CONSOLE_INFORMATION() :
@@ -59,6 +62,18 @@ CONSOLE_INFORMATION::CONSOLE_INFORMATION() :
 static thread_local ULONG recursionCount = 0;
 static til::ticket_lock lock;
 
+// The QPC tick at which the current owner acquired the lock. Only ever read
+// and written by the thread holding the lock, so it needs no synchronization
+// of its own.
+static int64_t lockAcquiredTick = 0;
+
+static int64_t queryPerformanceTick() noexcept
+{
+    LARGE_INTEGER li;
+    QueryPerformanceCounter(&li);
+    return li.QuadPart;
+}
+
 bool CONSOLE_INFORMATION::IsConsoleLocked()
 {
     return recursionCount != 0;
@@ -72,7 +87,14 @@ void CONSOLE_INFORMATION::LockConsole()
     FAIL_FAST_IF(rc == 0);
     if (rc == 1)
     {
+        const auto waitStart = queryPerformanceTick();
         lock.lock();
+        const auto acquired = queryPerformanceTick();
+        lockAcquiredTick = acquired;
+
+        auto& counters = PerfCounters::Instance();
+        counters.lockAcquisitions.fetch_add(1, std::memory_order_relaxed);
+        counters.lockWaitTicks.fetch_add(acquired - waitStart, std::memory_order_relaxed);
     }
 }
 
@@ -84,6 +106,16 @@ void CONSOLE_INFORMATION::UnlockConsole()
     FAIL_FAST_IF(rc == ULONG_MAX);
     if (rc == 0)
     {
+        // Every mutation of the hot screen buffer state happens under this
+        // lock, so republishing the lock-free API snapshot on the way out
+        // guarantees it is fresh whenever the lock is not held.
+        CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+        if (gci.HasActiveOutputBuffer())
+        {
+            gci.GetActiveOutputBuffer().GetActiveBuffer().PublishApiSnapshot();
+        }
+
+        PerfCounters::Instance().lockHoldTicks.fetch_add(queryPerformanceTick() - lockAcquiredTick, std::memory_order_relaxed);
         lock.unlock();
     }
 }
@@ -87,9 +87,10 @@ void ApiRoutines::GetConsoleOutputModeImpl(SCREEN_INFORMATION& context, ULONG& m
 {
     try
     {
-        LockConsole();
-        auto Unlock = wil::scope_exit([&] { UnlockConsole(); });
-
+        // This count is maintained atomically by the input buffer, so this
+        // hot polling API doesn't need to contend on the console lock with
+        // the renderer and IO threads. The number is stale the instant it's
+        // returned either way.
         const auto readyEventCount = context.GetNumberOfReadyEvents();
         RETURN_IF_FAILED(SizeTToULong(readyEventCount, &events));
 
@@ -108,9 +109,6 @@ void ApiRoutines::GetConsoleScreenBufferInfoExImpl(const SCREEN_INFORMATION& con
 {
     try
     {
-        LockConsole();
-        auto Unlock = wil::scope_exit([&] { UnlockConsole(); });
-
         data.bFullscreenSupported = FALSE; // traditional full screen with the driver support is no longer supported.
         // see MSFT: 19918103
         // Make sure to use the active buffer here. There are clients that will
@@ -120,13 +118,36 @@ void ApiRoutines::GetConsoleScreenBufferInfoExImpl(const SCREEN_INFORMATION& con
         // If they're in the alt buffer, then when they query in that way, the
         //      value they'll get is the main buffer's size, which isn't updated
         //      until we switch back to it.
-        context.GetActiveBuffer().GetScreenBufferInformation(&data.dwSize,
-                                                             &data.dwCursorPosition,
-                                                             &data.srWindow,
-                                                             &data.wAttributes,
-                                                             &data.dwMaximumWindowSize,
-                                                             &data.wPopupAttributes,
-                                                             data.ColorTable);
+        // Some clients poll this API at very high rates, so answer from the
+        // seqlock-published snapshot when one is available instead of
+        // contending on the console lock with the output path. The snapshot
+        // is republished on every console unlock, so it is exactly as fresh
+        // as a locked read would be by the time the caller sees it.
+        SCREEN_INFORMATION::ApiSnapshot snapshot;
+        if (context.GetActiveBuffer().TryGetApiSnapshot(snapshot))
+        {
+            data.dwSize = snapshot.size;
+            data.dwCursorPosition = snapshot.cursorPosition;
+            data.srWindow = snapshot.window;
+            data.wAttributes = snapshot.attributes;
+            data.dwMaximumWindowSize = snapshot.maximumWindowSize;
+            data.wPopupAttributes = snapshot.popupAttributes;
+            std::copy_n(snapshot.colorTable, COLOR_TABLE_SIZE, data.ColorTable);
+        }
+        else
+        {
+            // Nothing has been published yet (early startup); take the lock.
+            LockConsole();
+            auto Unlock = wil::scope_exit([&] { UnlockConsole(); });
+
+            context.GetActiveBuffer().GetScreenBufferInformation(&data.dwSize,
+                                                                 &data.dwCursorPosition,
+                                                                 &data.srWindow,
+                                                                 &data.wAttributes,
+                                                                 &data.dwMaximumWindowSize,
+                                                                 &data.wPopupAttributes,
+                                                                 data.ColorTable);
+        }
 
         // Callers of this function expect to receive an exclusive rect, not an
         // inclusive one. The driver will mangle this value for us
@@ -152,6 +173,17 @@ void ApiRoutines::GetConsoleCursorInfoImpl(const SCREEN_INFORMATION& context,
 {
     try
     {
+        // Answered from the lock-free snapshot for the same reason as
+        // GetConsoleScreenBufferInfoEx above: this is a pure read that
+        // interactive clients poll aggressively.
+        SCREEN_INFORMATION::ApiSnapshot snapshot;
+        if (context.GetActiveBuffer().TryGetApiSnapshot(snapshot))
+        {
+            size = snapshot.cursorSize;
+            isVisible = snapshot.cursorVisible;
+            return;
+        }
+
         LockConsole();
         auto Unlock = wil::scope_exit([&] { UnlockConsole(); });
 
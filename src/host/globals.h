@@ -27,6 +27,8 @@ Revision History:
 #include "../server/DeviceComm.h"
 #include "../server/ConDrvDeviceComm.h"
 
+#include "../inc/ConptyRing.h"
+
 #include <TraceLoggingProvider.h>
 #include <winmeta.h>
 TRACELOGGING_DECLARE_PROVIDER(g_hConhostV2EventTraceProvider);
@@ -75,6 +77,9 @@ public:
     std::optional<CLSID> handoffTerminalClsid;
     wil::unique_hfile handoffInboxConsoleHandle;
     wil::unique_threadpool_wait handoffInboxConsoleExitWait;
+    // The producer side of the shared memory output ring negotiated during
+    // the handoff, parked here until VtIo hands it to the render engine.
+    std::unique_ptr<Microsoft::Console::ConptyRing> handoffOutputRing;
 
 #ifdef UNIT_TESTING
     void EnableConptyModeForTests(std::unique_ptr<Microsoft::Console::Render::VtEngine> vtRenderEngine);
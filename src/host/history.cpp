@@ -134,6 +134,7 @@ void CommandHistory::_Reset()
             {
                 _commands.emplace_back(newCommand);
             }
+            _InvalidateIndex();
 
             if (LastDisplayed == -1 ||
                 _commands.at(LastDisplayed).size() != newCommand.size() ||
@@ -244,6 +245,7 @@ std::wstring_view CommandHistory::GetLastCommand() const
 void CommandHistory::Empty()
 {
     _commands.clear();
+    _InvalidateIndex();
     LastDisplayed = -1;
     WI_SetFlag(Flags, CLE_RESET);
 }
@@ -286,6 +288,7 @@ void CommandHistory::Realloc(const size_t commands)
         _commands.emplace_back(oldCommands[i]);
     }
 
+    _InvalidateIndex();
     WI_SetFlag(Flags, CLE_RESET);
     LastDisplayed = gsl::narrow<SHORT>(_commands.size()) - 1;
     _maxCommands = (SHORT)commands;
@@ -387,6 +390,7 @@ CommandHistory* CommandHistory::s_Allocate(const std::wstring_view appName, cons
         if (!SameApp)
         {
             BestCandidate->_commands.clear();
+            BestCandidate->_InvalidateIndex();
             BestCandidate->LastDisplayed = -1;
             BestCandidate->_appName = appName;
         }
@@ -470,6 +474,7 @@ std::wstring CommandHistory::Remove(const SHORT iDel)
         if (iDel < iLast)
         {
             _commands.erase(_commands.cbegin() + iDel);
+            _InvalidateIndex();
             if ((iDisp > iDel) && (iDisp <= iLast))
             {
                 _Dec(iDisp);
@@ -479,6 +484,7 @@ std::wstring CommandHistory::Remove(const SHORT iDel)
         else if (iFirst <= iDel)
         {
             _commands.erase(_commands.cbegin() + iDel);
+            _InvalidateIndex();
             if ((iDisp >= iFirst) && (iDisp < iDel))
             {
                 _Inc(iDisp);
@@ -524,18 +530,32 @@ std::wstring CommandHistory::Remove(const SHORT iDel)
 
     try
     {
-        for (size_t i = 0; i < _commands.size(); i++)
+        // Instead of walking every stored command backwards from indexFound,
+        // pull the candidates out of the sorted index and pick the one that
+        // backwards walk would have reached first.
+        const SHORT count = gsl::narrow<SHORT>(_commands.size());
+        SHORT bestDistance = count;
+        SHORT bestIndex = 0;
+        for (const auto index : PrefixMatches(givenCommand))
         {
-            const auto& storedCommand = _commands.at(indexFound);
-            if ((WI_IsFlagClear(options, MatchOptions::ExactMatch) && (givenCommand.size() <= storedCommand.size())) || (givenCommand.size() == storedCommand.size()))
+            if (WI_IsFlagSet(options, MatchOptions::ExactMatch) && _commands.at(index).size() != givenCommand.size())
             {
-                if (til::starts_with(storedCommand, givenCommand))
-                {
-                    return true;
-                }
+                continue;
+            }
+
+            // cyclic distance walking backwards from indexFound to index
+            const SHORT distance = indexFound >= index ? indexFound - index : indexFound - index + count;
+            if (distance < bestDistance)
+            {
+                bestDistance = distance;
+                bestIndex = index;
             }
+        }
 
-            _Prev(indexFound);
+        if (bestDistance < count)
+        {
+            indexFound = bestIndex;
+            return true;
         }
     }
     CATCH_LOG();
@@ -543,6 +563,65 @@ std::wstring CommandHistory::Remove(const SHORT iDel)
     return false;
 }
 
+// Routine Description:
+// - Returns the indices of all stored commands that start with the given
+//   prefix, ordered from most recently added to least. The returned indices
+//   can be handed to GetNth/RetrieveNth, so callers (like the popup UIs) can
+//   complete against the history without copying it.
+// Arguments:
+// - prefix - the prefix to complete. An empty prefix matches every command.
+// Return Value:
+// - the matching indices, newest first.
+std::vector<SHORT> CommandHistory::PrefixMatches(const std::wstring_view prefix) const
+{
+    _EnsureIndex();
+
+    // commands sharing a prefix are contiguous in the sorted index, so find
+    // the start of the run with a binary search and walk it.
+    std::vector<SHORT> matches;
+    auto it = std::lower_bound(_sortedIndex.cbegin(), _sortedIndex.cend(), prefix, [this](const SHORT index, const std::wstring_view needle) {
+        return std::wstring_view{ _commands.at(index) }.substr(0, needle.size()) < needle;
+    });
+    while (it != _sortedIndex.cend() && til::starts_with(_commands.at(*it), prefix))
+    {
+        matches.push_back(*it);
+        ++it;
+    }
+    std::sort(matches.begin(), matches.end(), std::greater<SHORT>{});
+    return matches;
+}
+
+// Routine Description:
+// - Marks the sorted index as stale. Called by everything that changes
+//   _commands; the next lookup rebuilds it.
+void CommandHistory::_InvalidateIndex() noexcept
+{
+    _indexDirty = true;
+}
+
+// Routine Description:
+// - Rebuilds the sorted index if a mutation invalidated it. Lookups between
+//   mutations (repeated F8 presses, popup keystrokes) then cost a binary
+//   search instead of comparing against every stored command.
+void CommandHistory::_EnsureIndex() const
+{
+    if (!_indexDirty)
+    {
+        return;
+    }
+
+    _sortedIndex.resize(_commands.size());
+    for (size_t i = 0; i < _sortedIndex.size(); i++)
+    {
+        _sortedIndex[i] = gsl::narrow<SHORT>(i);
+    }
+    std::sort(_sortedIndex.begin(), _sortedIndex.end(), [this](const SHORT a, const SHORT b) {
+        const int cmp = _commands[a].compare(_commands[b]);
+        return cmp != 0 ? cmp < 0 : a < b;
+    });
+    _indexDirty = false;
+}
+
 #ifdef UNIT_TESTING
 void CommandHistory::s_ClearHistoryListStorage()
 {
@@ -558,6 +637,7 @@ void CommandHistory::s_ClearHistoryListStorage()
 void CommandHistory::Swap(const short indexA, const short indexB)
 {
     std::swap(_commands.at(indexA), _commands.at(indexB));
+    _InvalidateIndex();
 }
 
 // Routine Description:
@@ -44,6 +44,8 @@ public:
                              const SHORT startingIndex,
                              SHORT& indexFound,
                              const MatchOptions options);
+
+    std::vector<SHORT> PrefixMatches(const std::wstring_view prefix) const;
     bool IsAppNameMatch(const std::wstring_view other) const;
 
     [[nodiscard]] HRESULT Add(const std::wstring_view command,
@@ -83,7 +85,17 @@ private:
     void _Dec(SHORT& ind) const;
     void _Inc(SHORT& ind) const;
 
+    void _InvalidateIndex() noexcept;
+    void _EnsureIndex() const;
+
     std::vector<std::wstring> _commands;
+    // Indices into _commands ordered by the commands they refer to, so prefix
+    // and exact lookups are a binary search instead of a scan over the whole
+    // history. Rebuilt lazily by _EnsureIndex after any mutation; holding
+    // indices rather than pointers keeps it valid across copies of this
+    // object (which s_Allocate and friends make freely).
+    mutable std::vector<SHORT> _sortedIndex;
+    mutable bool _indexDirty = true;
     SHORT _maxCommands;
 
     std::wstring _appName;
@@ -4,7 +4,9 @@
 #include "precomp.h"
 #include "inputBuffer.hpp"
 #include "dbcs.h"
+#include "handle.h"
 #include "stream.h"
+#include "../inc/ConsolePerfCounters.h"
 #include "../types/inc/GlyphWidth.hpp"
 
 #include <functional>
@@ -17,6 +19,28 @@ using Microsoft::Console::Interactivity::ServiceLocator;
 using Microsoft::Console::VirtualTerminal::TerminalInput;
 using namespace Microsoft::Console;
 
+// Routine Description:
+// - Stamps the arrival of a key-down with the process-wide performance
+//   counters, so the input-to-present latency histogram can time it against
+//   the frame that eventually carries its echo. One stamp per batch is
+//   enough - the tracker only follows the most recent keystroke anyway.
+// Arguments:
+// - records - the incoming records, in either a deque or a span.
+template<typename TCollection>
+static void NoteKeyDownsForLatency(const TCollection& records) noexcept
+{
+    for (const auto& record : records)
+    {
+        if (record.EventType == KEY_EVENT && record.Event.KeyEvent.bKeyDown)
+        {
+            LARGE_INTEGER now;
+            QueryPerformanceCounter(&now);
+            PerfCounters::Instance().NoteInput(now.QuadPart);
+            return;
+        }
+    }
+}
+
 // Routine Description:
 // - This method creates an input buffer.
 // Arguments:
@@ -150,9 +174,11 @@ void InputBuffer::StoreWritePartialByteSequence(std::unique_ptr<IInputEvent> eve
 // - The console lock must be held when calling this routine.
 void InputBuffer::ReinitializeInputBuffer()
 {
+    _DrainStagedRecords();
     ServiceLocator::LocateGlobals().hInputEvent.ResetEvent();
     InputMode = INPUT_BUFFER_DEFAULT_INPUT_MODE;
     _storage.clear();
+    _RefreshReadyEventCount();
 }
 
 // Routine Description:
@@ -184,10 +210,14 @@ void InputBuffer::TerminateRead(_In_ WaitTerminationReason Flag)
 // Return Value:
 // - The number of events currently in the input buffer.
 // Note:
-// - The console lock must be held when calling this routine.
+// - Safe to call without the console lock; the count is a snapshot and may
+//   be stale by the time the caller looks at it, exactly as a locked read
+//   would be the moment the lock was released.
+// - Staged records are counted as one event each; coalescing on drain may
+//   shrink that number, which is within the same snapshot tolerance.
 size_t InputBuffer::GetNumberOfReadyEvents() const noexcept
 {
-    return _storage.size();
+    return _readyEventCount.load(std::memory_order_acquire) + _stagedCount.load(std::memory_order_acquire);
 }
 
 // Routine Description:
@@ -200,7 +230,9 @@ size_t InputBuffer::GetNumberOfReadyEvents() const noexcept
 // - The console lock must be held when calling this routine.
 void InputBuffer::Flush()
 {
+    _DrainStagedRecords();
     _storage.clear();
+    _RefreshReadyEventCount();
     ServiceLocator::LocateGlobals().hInputEvent.ResetEvent();
 }
 
@@ -214,10 +246,12 @@ void InputBuffer::Flush()
 // - The console lock must be held when calling this routine.
 void InputBuffer::FlushAllButKeys()
 {
-    auto newEnd = std::remove_if(_storage.begin(), _storage.end(), [](const std::unique_ptr<IInputEvent>& event) {
-        return event->EventType() != InputEventType::KeyEvent;
+    _DrainStagedRecords();
+    auto newEnd = std::remove_if(_storage.begin(), _storage.end(), [](const INPUT_RECORD& record) {
+        return record.EventType != KEY_EVENT;
     });
     _storage.erase(newEnd, _storage.end());
+    _RefreshReadyEventCount();
 }
 
 void InputBuffer::SetTerminalConnection(_In_ Render::VtEngine* const pTtyConnection)
@@ -247,7 +281,7 @@ void InputBuffer::PassThroughWin32MouseRequest(bool enable)
 // Note:
 // - The console lock must be held when calling this routine.
 // Arguments:
-// - OutEvents - deque to store the read events
+// - OutRecords - deque to store the read records
 // - AmountToRead - the amount of events to try to read
 // - Peek - If true, copy events to pInputRecord but don't remove them from the input buffer.
 // - WaitForData - if true, wait until an event is input (if there aren't enough to fill client buffer). if false, return immediately
@@ -257,7 +291,7 @@ void InputBuffer::PassThroughWin32MouseRequest(bool enable)
 // - STATUS_SUCCESS if records were read into the client buffer and everything is OK.
 // - CONSOLE_STATUS_WAIT if there weren't enough records to satisfy the request (and waits are allowed)
 // - otherwise a suitable memory/math/string error in NTSTATUS form.
-[[nodiscard]] NTSTATUS InputBuffer::Read(_Out_ std::deque<std::unique_ptr<IInputEvent>>& OutEvents,
+[[nodiscard]] NTSTATUS InputBuffer::Read(_Out_ std::deque<INPUT_RECORD>& OutRecords,
                                          const size_t AmountToRead,
                                          const bool Peek,
                                          const bool WaitForData,
@@ -266,20 +300,25 @@ void InputBuffer::PassThroughWin32MouseRequest(bool enable)
 {
     try
     {
+        _DrainStagedRecords();
+
         if (_storage.empty())
         {
             if (!WaitForData)
             {
                 return STATUS_SUCCESS;
             }
+            // Remember that a reader is about to park so that the lock-free
+            // write path knows it has to drain (and thereby dispatch the
+            // wait) instead of leaving records staged.
+            _readerWaiting.store(true, std::memory_order_release);
             return CONSOLE_STATUS_WAIT;
         }
 
         // read from buffer
-        std::deque<std::unique_ptr<IInputEvent>> events;
         size_t eventsRead;
         bool resetWaitEvent;
-        _ReadBuffer(events,
+        _ReadBuffer(OutRecords,
                     AmountToRead,
                     eventsRead,
                     Peek,
@@ -287,13 +326,6 @@ void InputBuffer::PassThroughWin32MouseRequest(bool enable)
                     Unicode,
                     Stream);
 
-        // copy events to outEvents
-        while (!events.empty())
-        {
-            OutEvents.push_back(std::move(events.front()));
-            events.pop_front();
-        }
-
         if (resetWaitEvent)
         {
             ServiceLocator::LocateGlobals().hInputEvent.ResetEvent();
@@ -306,6 +338,49 @@ void InputBuffer::PassThroughWin32MouseRequest(bool enable)
     }
 }
 
+// Routine Description:
+// - The IInputEvent flavor of the batch read above, for callers that still
+//   traffic in heap-allocated events. New code should prefer the flat
+//   INPUT_RECORD overload; this one wraps every record on the way out.
+// Arguments:
+// - OutEvents - deque to store the read events
+// - AmountToRead - the amount of events to try to read
+// - Peek - If true, copy events to pInputRecord but don't remove them from the input buffer.
+// - WaitForData - if true, wait until an event is input (if there aren't enough to fill client buffer). if false, return immediately
+// - Unicode - true if the data in key events should be treated as unicode. false if they should be converted by the current input CP.
+// - Stream - true if read should unpack KeyEvents that have a >1 repeat count. AmountToRead must be 1 if Stream is true.
+// Return Value:
+// - STATUS_SUCCESS if records were read into the client buffer and everything is OK.
+// - CONSOLE_STATUS_WAIT if there weren't enough records to satisfy the request (and waits are allowed)
+// - otherwise a suitable memory/math/string error in NTSTATUS form.
+[[nodiscard]] NTSTATUS InputBuffer::Read(_Out_ std::deque<std::unique_ptr<IInputEvent>>& OutEvents,
+                                         const size_t AmountToRead,
+                                         const bool Peek,
+                                         const bool WaitForData,
+                                         const bool Unicode,
+                                         const bool Stream)
+{
+    try
+    {
+        std::deque<INPUT_RECORD> records;
+        const NTSTATUS Status = Read(records,
+                                     AmountToRead,
+                                     Peek,
+                                     WaitForData,
+                                     Unicode,
+                                     Stream);
+        for (const auto& record : records)
+        {
+            OutEvents.push_back(IInputEvent::Create(record));
+        }
+        return Status;
+    }
+    catch (...)
+    {
+        return NTSTATUS_FROM_HRESULT(wil::ResultFromCaughtException());
+    }
+}
+
 // Routine Description:
 // - This routine reads a single event from the input buffer.
 // - It can convert returned data to through the currently set Input CP, it can optionally return a wait condition
@@ -354,7 +429,7 @@ void InputBuffer::PassThroughWin32MouseRequest(bool enable)
 // Routine Description:
 // - This routine reads from a buffer. It does the buffer manipulation.
 // Arguments:
-// - outEvents - where read events are placed
+// - outRecords - where read records are placed
 // - readCount - amount of events to read
 // - eventsRead - where to store number of events read
 // - peek - if true , don't remove data from buffer, just copy it.
@@ -365,7 +440,7 @@ void InputBuffer::PassThroughWin32MouseRequest(bool enable)
 // - <none>
 // Note:
 // - The console lock must be held when calling this routine.
-void InputBuffer::_ReadBuffer(_Out_ std::deque<std::unique_ptr<IInputEvent>>& outEvents,
+void InputBuffer::_ReadBuffer(_Out_ std::deque<INPUT_RECORD>& outRecords,
                               const size_t readCount,
                               _Out_ size_t& eventsRead,
                               const bool peek,
@@ -379,7 +454,7 @@ void InputBuffer::_ReadBuffer(_Out_ std::deque<std::unique_ptr<IInputEvent>>& ou
 
     resetWaitEvent = false;
 
-    std::deque<std::unique_ptr<IInputEvent>> readEvents;
+    std::deque<INPUT_RECORD> readRecords;
     // we need another var to keep track of how many we've read
     // because dbcs records count for two when we aren't doing a
     // unicode read but the eventsRead count should return the number
@@ -388,84 +463,72 @@ void InputBuffer::_ReadBuffer(_Out_ std::deque<std::unique_ptr<IInputEvent>>& ou
 
     while (!_storage.empty() && virtualReadCount < readCount)
     {
+        INPUT_RECORD record = _storage.front();
         bool performNormalRead = true;
         // for stream reads we need to split any key events that have been coalesced
-        if (streamRead)
+        if (streamRead &&
+            record.EventType == KEY_EVENT &&
+            record.Event.KeyEvent.wRepeatCount > 1)
         {
-            if (_storage.front()->EventType() == InputEventType::KeyEvent)
-            {
-                KeyEvent* const pKeyEvent = static_cast<KeyEvent* const>(_storage.front().get());
-                if (pKeyEvent->GetRepeatCount() > 1)
-                {
-                    // split the key event
-                    std::unique_ptr<KeyEvent> streamKeyEvent = std::make_unique<KeyEvent>(*pKeyEvent);
-                    streamKeyEvent->SetRepeatCount(1);
-                    readEvents.push_back(std::move(streamKeyEvent));
-                    pKeyEvent->SetRepeatCount(pKeyEvent->GetRepeatCount() - 1);
-                    performNormalRead = false;
-                }
-            }
+            // split the key event: hand out a single repeat and leave the
+            // rest in the buffer
+            record.Event.KeyEvent.wRepeatCount = 1;
+            readRecords.push_back(record);
+            _storage.front().Event.KeyEvent.wRepeatCount--;
+            performNormalRead = false;
         }
 
         if (performNormalRead)
         {
-            readEvents.push_back(std::move(_storage.front()));
+            readRecords.push_back(record);
             _storage.pop_front();
         }
 
         ++virtualReadCount;
-        if (!unicode)
+        if (!unicode &&
+            record.EventType == KEY_EVENT &&
+            IsGlyphFullWidth(record.Event.KeyEvent.uChar.UnicodeChar))
         {
-            if (readEvents.back()->EventType() == InputEventType::KeyEvent)
-            {
-                const KeyEvent* const pKeyEvent = static_cast<const KeyEvent* const>(readEvents.back().get());
-                if (IsGlyphFullWidth(pKeyEvent->GetCharData()))
-                {
-                    ++virtualReadCount;
-                }
-            }
+            ++virtualReadCount;
         }
     }
 
     // the amount of events that were actually read
-    eventsRead = readEvents.size();
+    eventsRead = readRecords.size();
 
-    // copy the events back if we were supposed to peek
+    // copy the records back if we were supposed to peek
     if (peek)
     {
         if (streamRead)
         {
-            // we need to check and see if the event was split from a coalesced key event
-            // or if it was unrelated to the current front event in storage
-            if (!readEvents.empty() &&
+            // we need to check and see if the record was split from a coalesced key event
+            // or if it was unrelated to the current front record in storage
+            if (!readRecords.empty() &&
                 !_storage.empty() &&
-                readEvents.back()->EventType() == InputEventType::KeyEvent &&
-                _storage.front()->EventType() == InputEventType::KeyEvent &&
-                _CanCoalesce(static_cast<const KeyEvent&>(*readEvents.back()),
-                             static_cast<const KeyEvent&>(*_storage.front())))
+                readRecords.back().EventType == KEY_EVENT &&
+                _storage.front().EventType == KEY_EVENT &&
+                _CanCoalesce(readRecords.back().Event.KeyEvent, _storage.front().Event.KeyEvent))
             {
-                KeyEvent& keyEvent = static_cast<KeyEvent&>(*_storage.front());
-                keyEvent.SetRepeatCount(keyEvent.GetRepeatCount() + 1);
+                _storage.front().Event.KeyEvent.wRepeatCount++;
             }
             else
             {
-                _storage.push_front(IInputEvent::Create(readEvents.back()->ToInputRecord()));
+                _storage.push_front(readRecords.back());
             }
         }
         else
         {
-            for (auto it = readEvents.crbegin(); it != readEvents.crend(); ++it)
+            for (auto it = readRecords.crbegin(); it != readRecords.crend(); ++it)
             {
-                _storage.push_front(IInputEvent::Create((*it)->ToInputRecord()));
+                _storage.push_front(*it);
             }
         }
     }
 
-    // move events read to proper deque
-    while (!readEvents.empty())
+    // hand the records read to the caller
+    for (const auto& record : readRecords)
     {
-        outEvents.push_back(std::move(readEvents.front()));
-        readEvents.pop_front();
+        outRecords.push_back(record);
     }
 
     // signal if we emptied the buffer
@@ -473,6 +536,8 @@ void InputBuffer::_ReadBuffer(_Out_ std::deque<std::unique_ptr<IInputEvent>>& ou
     {
         resetWaitEvent = true;
     }
+
+    _RefreshReadyEventCount();
 }
 
 // Routine Description:
@@ -488,10 +553,20 @@ size_t InputBuffer::Prepend(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& in
 {
     try
     {
+        _DrainStagedRecords();
         _vtInputShouldSuppress = true;
         auto resetVtInputSuppress = wil::scope_exit([&]() { _vtInputShouldSuppress = false; });
-        _HandleConsoleSuspensionEvents(inEvents);
-        if (inEvents.empty())
+
+        // flatten at the boundary; everything below works on plain records
+        std::pmr::deque<INPUT_RECORD> inRecords;
+        for (const auto& event : inEvents)
+        {
+            inRecords.push_back(event->ToInputRecord());
+        }
+        inEvents.clear();
+
+        _HandleConsoleSuspensionEvents(inRecords);
+        if (inRecords.empty())
         {
             return STATUS_SUCCESS;
         }
@@ -500,7 +575,7 @@ size_t InputBuffer::Prepend(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& in
         // this way to handle any coalescing that might occur.
 
         // get all of the existing records, "emptying" the buffer
-        std::deque<std::unique_ptr<IInputEvent>> existingStorage;
+        std::pmr::deque<INPUT_RECORD> existingStorage{ _storage.get_allocator() };
         existingStorage.swap(_storage);
 
         // We will need this variable to pass to _WriteBuffer so it can attempt to determine wait status.
@@ -511,7 +586,7 @@ size_t InputBuffer::Prepend(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& in
 
         // write the prepend records
         size_t prependEventsWritten;
-        _WriteBuffer(inEvents, prependEventsWritten, unusedWaitStatus);
+        _WriteBuffer(inRecords, prependEventsWritten, unusedWaitStatus);
         FAIL_FAST_IF(!(unusedWaitStatus));
 
         // write all previously existing records
@@ -580,18 +655,30 @@ size_t InputBuffer::Write(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEv
 {
     try
     {
+        _DrainStagedRecords();
         _vtInputShouldSuppress = true;
         auto resetVtInputSuppress = wil::scope_exit([&]() { _vtInputShouldSuppress = false; });
-        _HandleConsoleSuspensionEvents(inEvents);
-        if (inEvents.empty())
+
+        // flatten at the boundary; everything below works on plain records
+        std::pmr::deque<INPUT_RECORD> inRecords;
+        for (const auto& event : inEvents)
+        {
+            inRecords.push_back(event->ToInputRecord());
+        }
+        inEvents.clear();
+
+        _HandleConsoleSuspensionEvents(inRecords);
+        if (inRecords.empty())
         {
             return 0;
         }
 
+        NoteKeyDownsForLatency(inRecords);
+
         // Write to buffer.
         size_t EventsWritten;
         bool SetWaitEvent;
-        _WriteBuffer(inEvents, EventsWritten, SetWaitEvent);
+        _WriteBuffer(inRecords, EventsWritten, SetWaitEvent);
 
         if (SetWaitEvent)
         {
@@ -609,6 +696,74 @@ size_t InputBuffer::Write(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEv
     }
 }
 
+// Routine Description:
+// - Writes flat records into the lock-free staging lane. Unlike Write, this
+//   does not require the console lock: records are parked in a bounded SPSC
+//   channel and folded into the storage queue (with the usual suspension,
+//   VT input and coalescing handling) the next time any locked routine runs.
+// Arguments:
+// - records - the records to stage.
+// Return Value:
+// - The number of records accepted.
+// Note:
+// - Only one thread may stage records at a time; the VT input path is the
+//   intended producer. Callers holding the console lock are fine too, since
+//   the fallback paths below only ever take it recursively.
+size_t InputBuffer::WriteStaged(const gsl::span<const INPUT_RECORD> records)
+{
+    try
+    {
+        if (records.empty())
+        {
+            return 0;
+        }
+
+        NoteKeyDownsForLatency(records);
+
+        auto it = records.begin();
+        size_t remaining = records.size();
+        while (remaining > 0)
+        {
+            // _stagedCount never understates the lane's occupancy (we are the
+            // only thread that increments it), so this can't overcommit.
+            const size_t available = StagedRecordCapacity - _stagedCount.load(std::memory_order_acquire);
+            const size_t toPush = std::min(available, remaining);
+            if (toPush == 0)
+            {
+                // The lane is full. Drain it ourselves under the lock rather
+                // than blocking on whoever might read next; this is the same
+                // backpressure a locked Write would have applied.
+                LockConsole();
+                auto unlock = wil::scope_exit([&] { UnlockConsole(); });
+                _DrainStagedRecords();
+                continue;
+            }
+            _staged.first.push_n(til::spsc::block_initially, it, toPush);
+            _stagedCount.fetch_add(toPush, std::memory_order_release);
+            it += toPush;
+            remaining -= toPush;
+        }
+
+        ServiceLocator::LocateGlobals().hInputEvent.SetEvent();
+
+        // If a reader already parked on CONSOLE_STATUS_WAIT, nobody will come
+        // by to drain for us: take the lock and dispatch the wait now.
+        if (_readerWaiting.exchange(false, std::memory_order_acq_rel))
+        {
+            LockConsole();
+            auto unlock = wil::scope_exit([&] { UnlockConsole(); });
+            _DrainStagedRecords();
+        }
+
+        return records.size();
+    }
+    catch (...)
+    {
+        LOG_HR(wil::ResultFromCaughtException());
+        return 0;
+    }
+}
+
 // Routine Description:
 // - Coalesces input events and transfers them to storage queue.
 // Arguments:
@@ -621,28 +776,31 @@ size_t InputBuffer::Write(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEv
 // Note:
 // - The console lock must be held when calling this routine.
 // - will throw on failure
-void InputBuffer::_WriteBuffer(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents,
+void InputBuffer::_WriteBuffer(_Inout_ std::pmr::deque<INPUT_RECORD>& inRecords,
                                _Out_ size_t& eventsWritten,
                                _Out_ bool& setWaitEvent)
 {
     eventsWritten = 0;
     setWaitEvent = false;
     const bool initiallyEmptyQueue = _storage.empty();
-    const size_t initialInEventsSize = inEvents.size();
+    const size_t initialInEventsSize = inRecords.size();
     const bool vtInputMode = IsInVirtualTerminalInputMode();
 
-    while (!inEvents.empty())
+    while (!inRecords.empty())
     {
-        // Pop the next event.
+        // Pop the next record.
         // If we're in vt mode, try and handle it with the vt input module.
         // If it was handled, do nothing else for it.
-        // If there was one event passed in, try coalescing it with the previous event currently in the buffer.
+        // If there was one record passed in, try coalescing it with the previous record currently in the buffer.
         // If it's not coalesced, append it to the buffer.
-        std::unique_ptr<IInputEvent> inEvent = std::move(inEvents.front());
-        inEvents.pop_front();
-        if (vtInputMode)
+        INPUT_RECORD inRecord = inRecords.front();
+        inRecords.pop_front();
+        if (vtInputMode && inRecord.EventType == KEY_EVENT)
         {
-            const bool handled = _termInput.HandleKey(inEvent.get());
+            // the vt input module wants a typed event; build one on the
+            // stack (it only ever acts on key events)
+            const KeyEvent keyEvent{ inRecord.Event.KeyEvent };
+            const bool handled = _termInput.HandleKey(&keyEvent);
             if (handled)
             {
                 eventsWritten++;
@@ -656,22 +814,22 @@ void InputBuffer::_WriteBuffer(_Inout_ std::deque<std::unique_ptr<IInputEvent>>&
         // that was depending on it.
         if (initialInEventsSize == 1 && !_storage.empty())
         {
-            // coalescing requires a deque of events, so push it back onto the front.
-            inEvents.push_front(std::move(inEvent));
+            // coalescing requires a deque of records, so push it back onto the front.
+            inRecords.push_front(inRecord);
 
             bool coalesced = false;
             // this looks kinda weird but we don't want to coalesce a
             // mouse event and then try to coalesce a key event right after.
             //
             // we also pass the whole deque to the coalescing methods
-            // even though they only want one event because it should
+            // even though they only want one record because it should
             // be their responsibility to maintain the correct state
             // of the deque if they process any records in it.
-            if (_CoalesceMouseMovedEvents(inEvents))
+            if (_CoalesceMouseMovedEvents(inRecords))
             {
                 coalesced = true;
             }
-            else if (_CoalesceRepeatedKeyPressEvents(inEvents))
+            else if (_CoalesceRepeatedKeyPressEvents(inRecords))
             {
                 coalesced = true;
             }
@@ -682,20 +840,22 @@ void InputBuffer::_WriteBuffer(_Inout_ std::deque<std::unique_ptr<IInputEvent>>&
             }
             else
             {
-                // We didn't coalesce the event. pull it from the queue again,
+                // We didn't coalesce the record. pull it from the queue again,
                 //  to keep the state consistent with the start of this block.
-                inEvent = std::move(inEvents.front());
-                inEvents.pop_front();
+                inRecord = inRecords.front();
+                inRecords.pop_front();
             }
         }
-        // At this point, the event was neither coalesced, nor processed by VT.
-        _storage.push_back(std::move(inEvent));
+        // At this point, the record was neither coalesced, nor processed by VT.
+        _storage.push_back(inRecord);
         ++eventsWritten;
     }
     if (initiallyEmptyQueue && !_storage.empty())
     {
         setWaitEvent = true;
     }
+
+    _RefreshReadyEventCount();
 }
 
 // Routine Description:
@@ -713,53 +873,45 @@ void InputBuffer::_WriteBuffer(_Inout_ std::deque<std::unique_ptr<IInputEvent>>&
 // the buffer with updated values from an incoming event, instead of
 // storing the incoming event (which would make the original one
 // redundant/out of date with the most current state).
-bool InputBuffer::_CoalesceMouseMovedEvents(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents)
+bool InputBuffer::_CoalesceMouseMovedEvents(_Inout_ std::pmr::deque<INPUT_RECORD>& inRecords)
 {
-    FAIL_FAST_IF(!(inEvents.size() == 1));
+    FAIL_FAST_IF(!(inRecords.size() == 1));
     FAIL_FAST_IF(_storage.empty());
-    const IInputEvent* const pFirstInEvent = inEvents.front().get();
-    const IInputEvent* const pLastStoredEvent = _storage.back().get();
-    if (pFirstInEvent->EventType() == InputEventType::MouseEvent &&
-        pLastStoredEvent->EventType() == InputEventType::MouseEvent)
+    const INPUT_RECORD& firstInRecord = inRecords.front();
+    INPUT_RECORD& lastStoredRecord = _storage.back();
+    if (firstInRecord.EventType == MOUSE_EVENT &&
+        lastStoredRecord.EventType == MOUSE_EVENT &&
+        firstInRecord.Event.MouseEvent.dwEventFlags == MOUSE_MOVED &&
+        lastStoredRecord.Event.MouseEvent.dwEventFlags == MOUSE_MOVED)
     {
-        const MouseEvent* const pInMouseEvent = static_cast<const MouseEvent* const>(pFirstInEvent);
-        const MouseEvent* const pLastMouseEvent = static_cast<const MouseEvent* const>(pLastStoredEvent);
+        // update mouse moved position
+        lastStoredRecord.Event.MouseEvent.dwMousePosition = firstInRecord.Event.MouseEvent.dwMousePosition;
 
-        if (pInMouseEvent->IsMouseMoveEvent() &&
-            pLastMouseEvent->IsMouseMoveEvent())
-        {
-            // update mouse moved position
-            MouseEvent* const pMouseEvent = static_cast<MouseEvent* const>(_storage.back().release());
-            pMouseEvent->SetPosition(pInMouseEvent->GetPosition());
-            std::unique_ptr<IInputEvent> tempPtr(pMouseEvent);
-            tempPtr.swap(_storage.back());
-
-            inEvents.pop_front();
-            return true;
-        }
+        inRecords.pop_front();
+        return true;
     }
     return false;
 }
 
 // Routine Description:
-// - checks two KeyEvents to see if they're similar enough to be coalesced
+// - checks two key event records to see if they're similar enough to be coalesced
 // Arguments:
-// - a - the first KeyEvent
-// - b - the other KeyEvent
+// - a - the first key event record
+// - b - the other key event record
 // Return Value:
 // - true if the events could be coalesced, false otherwise
-bool InputBuffer::_CanCoalesce(const KeyEvent& a, const KeyEvent& b) const noexcept
+bool InputBuffer::_CanCoalesce(const KEY_EVENT_RECORD& a, const KEY_EVENT_RECORD& b) const noexcept
 {
-    if (WI_IsFlagSet(a.GetActiveModifierKeys(), NLS_IME_CONVERSION) &&
-        a.GetCharData() == b.GetCharData() &&
-        a.GetActiveModifierKeys() == b.GetActiveModifierKeys())
+    if (WI_IsFlagSet(a.dwControlKeyState, NLS_IME_CONVERSION) &&
+        a.uChar.UnicodeChar == b.uChar.UnicodeChar &&
+        a.dwControlKeyState == b.dwControlKeyState)
     {
         return true;
     }
     // other key events check
-    else if (a.GetVirtualScanCode() == b.GetVirtualScanCode() &&
-             a.GetCharData() == b.GetCharData() &&
-             a.GetActiveModifierKeys() == b.GetActiveModifierKeys())
+    else if (a.wVirtualScanCode == b.wVirtualScanCode &&
+             a.uChar.UnicodeChar == b.uChar.UnicodeChar &&
+             a.dwControlKeyState == b.dwControlKeyState)
     {
         return true;
     }
@@ -780,31 +932,27 @@ bool InputBuffer::_CanCoalesce(const KeyEvent& a, const KeyEvent& b) const noexc
 // the buffer with updated values from an incoming event, instead of
 // storing the incoming event (which would make the original one
 // redundant/out of date with the most current state).
-bool InputBuffer::_CoalesceRepeatedKeyPressEvents(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents)
+bool InputBuffer::_CoalesceRepeatedKeyPressEvents(_Inout_ std::pmr::deque<INPUT_RECORD>& inRecords)
 {
-    FAIL_FAST_IF(!(inEvents.size() == 1));
+    FAIL_FAST_IF(!(inRecords.size() == 1));
     FAIL_FAST_IF(_storage.empty());
-    const IInputEvent* const pFirstInEvent = inEvents.front().get();
-    const IInputEvent* const pLastStoredEvent = _storage.back().get();
-    if (pFirstInEvent->EventType() == InputEventType::KeyEvent &&
-        pLastStoredEvent->EventType() == InputEventType::KeyEvent)
-    {
-        const KeyEvent* const pInKeyEvent = static_cast<const KeyEvent* const>(pFirstInEvent);
-        const KeyEvent* const pLastKeyEvent = static_cast<const KeyEvent* const>(pLastStoredEvent);
-
-        if (pInKeyEvent->IsKeyDown() &&
-            pLastKeyEvent->IsKeyDown() &&
-            !IsGlyphFullWidth(pInKeyEvent->GetCharData()) &&
-            _CanCoalesce(*pInKeyEvent, *pLastKeyEvent))
+    const INPUT_RECORD& firstInRecord = inRecords.front();
+    INPUT_RECORD& lastStoredRecord = _storage.back();
+    if (firstInRecord.EventType == KEY_EVENT &&
+        lastStoredRecord.EventType == KEY_EVENT)
+    {
+        const KEY_EVENT_RECORD& inKeyRecord = firstInRecord.Event.KeyEvent;
+        KEY_EVENT_RECORD& lastKeyRecord = lastStoredRecord.Event.KeyEvent;
+
+        if (inKeyRecord.bKeyDown &&
+            lastKeyRecord.bKeyDown &&
+            !IsGlyphFullWidth(inKeyRecord.uChar.UnicodeChar) &&
+            _CanCoalesce(inKeyRecord, lastKeyRecord))
         {
             // increment repeat count
-            KeyEvent* const pKeyEvent = static_cast<KeyEvent* const>(_storage.back().release());
-            WORD repeatCount = pKeyEvent->GetRepeatCount() + pInKeyEvent->GetRepeatCount();
-            pKeyEvent->SetRepeatCount(repeatCount);
-            std::unique_ptr<IInputEvent> tempPtr(pKeyEvent);
-            tempPtr.swap(_storage.back());
+            lastKeyRecord.wRepeatCount += inKeyRecord.wRepeatCount;
 
-            inEvents.pop_front();
+            inRecords.pop_front();
             return true;
         }
     }
@@ -820,36 +968,34 @@ bool InputBuffer::_CoalesceRepeatedKeyPressEvents(_Inout_ std::deque<std::unique
 // Note:
 // - The console lock must be held when calling this routine.
 // - will throw exception on error
-void InputBuffer::_HandleConsoleSuspensionEvents(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents)
+void InputBuffer::_HandleConsoleSuspensionEvents(_Inout_ std::pmr::deque<INPUT_RECORD>& inRecords)
 {
     CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
 
-    std::deque<std::unique_ptr<IInputEvent>> outEvents;
-    while (!inEvents.empty())
+    // use the caller's allocator so the swap below stays valid
+    std::pmr::deque<INPUT_RECORD> outRecords{ inRecords.get_allocator() };
+    while (!inRecords.empty())
     {
-        std::unique_ptr<IInputEvent> currEvent = std::move(inEvents.front());
-        inEvents.pop_front();
-        if (currEvent->EventType() == InputEventType::KeyEvent)
+        const INPUT_RECORD currRecord = inRecords.front();
+        inRecords.pop_front();
+        if (currRecord.EventType == KEY_EVENT && currRecord.Event.KeyEvent.bKeyDown)
         {
-            const KeyEvent* const pKeyEvent = static_cast<const KeyEvent* const>(currEvent.get());
-            if (pKeyEvent->IsKeyDown())
+            if (WI_IsFlagSet(gci.Flags, CONSOLE_SUSPENDED) &&
+                !IsSystemKey(currRecord.Event.KeyEvent.wVirtualKeyCode))
             {
-                if (WI_IsFlagSet(gci.Flags, CONSOLE_SUSPENDED) &&
-                    !IsSystemKey(pKeyEvent->GetVirtualKeyCode()))
-                {
-                    UnblockWriteConsole(CONSOLE_OUTPUT_SUSPENDED);
-                    continue;
-                }
-                else if (WI_IsFlagSet(InputMode, ENABLE_LINE_INPUT) && pKeyEvent->IsPauseKey())
-                {
-                    WI_SetFlag(gci.Flags, CONSOLE_SUSPENDED);
-                    continue;
-                }
+                UnblockWriteConsole(CONSOLE_OUTPUT_SUSPENDED);
+                continue;
+            }
+            else if (WI_IsFlagSet(InputMode, ENABLE_LINE_INPUT) &&
+                     currRecord.Event.KeyEvent.wVirtualKeyCode == VK_PAUSE)
+            {
+                WI_SetFlag(gci.Flags, CONSOLE_SUSPENDED);
+                continue;
             }
         }
-        outEvents.push_back(std::move(currEvent));
+        outRecords.push_back(currRecord);
     }
-    inEvents.swap(outEvents);
+    inRecords.swap(outRecords);
 }
 
 // Routine Description:
@@ -877,11 +1023,12 @@ void InputBuffer::_HandleTerminalInputCallback(std::deque<std::unique_ptr<IInput
         // add all input events to the storage queue
         while (!inEvents.empty())
         {
-            std::unique_ptr<IInputEvent> inEvent = std::move(inEvents.front());
+            _storage.push_back(inEvents.front()->ToInputRecord());
             inEvents.pop_front();
-            _storage.push_back(std::move(inEvent));
         }
 
+        _RefreshReadyEventCount();
+
         if (!_vtInputShouldSuppress)
         {
             ServiceLocator::LocateGlobals().hInputEvent.SetEvent();
@@ -894,6 +1041,83 @@ void InputBuffer::_HandleTerminalInputCallback(std::deque<std::unique_ptr<IInput
     }
 }
 
+// Routine Description:
+// - Publishes the current size of the storage queue to the atomic mirror
+//   that GetNumberOfReadyEvents reads. Every routine that changes the size
+//   of _storage must call this before the console lock is released;
+//   std::deque::size itself is not safe to read concurrently with writers.
+// Arguments:
+// - None
+// Return Value:
+// - None
+// Note:
+// - The console lock must be held when calling this routine.
+void InputBuffer::_RefreshReadyEventCount() noexcept
+{
+    _readyEventCount.store(_storage.size(), std::memory_order_release);
+}
+
+// Routine Description:
+// - Empties the lock-free staging lane into the storage queue, running the
+//   staged records through the same suspension, VT input and coalescing
+//   handling a locked Write would have applied. Every locked routine that
+//   inspects _storage calls this first so staged records are never skipped.
+// Arguments:
+// - None
+// Return Value:
+// - None
+// Note:
+// - The console lock must be held when calling this routine; it is what
+//   serializes the consumer side of the lane.
+void InputBuffer::_DrainStagedRecords()
+{
+    const size_t staged = _stagedCount.load(std::memory_order_acquire);
+    if (staged == 0)
+    {
+        return;
+    }
+
+    _vtInputShouldSuppress = true;
+    auto resetVtInputSuppress = wil::scope_exit([&]() { _vtInputShouldSuppress = false; });
+
+    // _stagedCount is only incremented after the corresponding records were
+    // pushed, so popping exactly `staged` records can't block. The records
+    // are written one at a time because coalescing only happens for
+    // single-event writes, and floods of staged mouse moves and repeated
+    // keys should collapse just like they did on the locked path.
+    bool setWaitEvent = false;
+    INPUT_RECORD chunk[32];
+    size_t remaining = staged;
+    std::pmr::deque<INPUT_RECORD> inRecords;
+    while (remaining > 0)
+    {
+        const size_t toPop = std::min(remaining, std::size(chunk));
+        const auto popped = _staged.second.pop_n(til::spsc::block_initially, &chunk[0], toPop).first;
+        for (size_t i = 0; i < popped; ++i)
+        {
+            inRecords.push_back(chunk[i]);
+            _HandleConsoleSuspensionEvents(inRecords);
+            if (inRecords.empty())
+            {
+                continue;
+            }
+            size_t eventsWritten;
+            bool thisSetWaitEvent;
+            _WriteBuffer(inRecords, eventsWritten, thisSetWaitEvent);
+            setWaitEvent |= thisSetWaitEvent;
+            inRecords.clear();
+        }
+        remaining -= popped;
+    }
+    _stagedCount.fetch_sub(staged, std::memory_order_release);
+
+    if (setWaitEvent)
+    {
+        ServiceLocator::LocateGlobals().hInputEvent.SetEvent();
+    }
+    WakeUpReadersWaitingForData();
+}
+
 TerminalInput& InputBuffer::GetTerminalInput()
 {
     return _termInput;
@@ -25,8 +25,14 @@ Revision History:
 #include "../server/ObjectHeader.h"
 #include "../terminal/input/terminalInput.hpp"
 
+#include <atomic>
 #include <deque>
 
+#include <til/pmr.h>
+#include <til/spsc.h>
+
+#include "../inc/ConsolePerfCounters.h"
+
 namespace Microsoft::Console::Render
 {
     class Renderer;
@@ -60,6 +66,13 @@ public:
     void Flush();
     void FlushAllButKeys();
 
+    [[nodiscard]] NTSTATUS Read(_Out_ std::deque<INPUT_RECORD>& OutRecords,
+                                const size_t AmountToRead,
+                                const bool Peek,
+                                const bool WaitForData,
+                                const bool Unicode,
+                                const bool Stream);
+
     [[nodiscard]] NTSTATUS Read(_Out_ std::deque<std::unique_ptr<IInputEvent>>& OutEvents,
                                 const size_t AmountToRead,
                                 const bool Peek,
@@ -78,13 +91,37 @@ public:
     size_t Write(_Inout_ std::unique_ptr<IInputEvent> inEvent);
     size_t Write(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents);
 
+    size_t WriteStaged(const gsl::span<const INPUT_RECORD> records);
+
     bool IsInVirtualTerminalInputMode() const;
     Microsoft::Console::VirtualTerminal::TerminalInput& GetTerminalInput();
     void SetTerminalConnection(_In_ Microsoft::Console::Render::VtEngine* const pTtyConnection);
     void PassThroughWin32MouseRequest(bool enable);
 
 private:
-    std::deque<std::unique_ptr<IInputEvent>> _storage;
+    // Flat record storage: events live in the buffer as plain INPUT_RECORDs
+    // and are only wrapped into IInputEvents at the read boundary, so
+    // writing, coalescing, prepending and draining staged records never
+    // touch the heap per event. The tally underneath the queue attributes
+    // input-pipeline memory in the process-wide allocation statistics.
+    Microsoft::Console::TalliedResource _storageAllocator{ Microsoft::Console::PerfCounters::Instance().inputAllocations, til::pmr::get_default_resource() };
+    std::pmr::deque<INPUT_RECORD> _storage{ &_storageAllocator };
+    // Mirrors _storage.size() so GetNumberOfReadyEvents can answer without
+    // the console lock. Only refreshed while the lock is held; see
+    // _RefreshReadyEventCount.
+    std::atomic<size_t> _readyEventCount{ 0 };
+    // Capacity of the lock-free staging lane, in INPUT_RECORDs. Flat records
+    // are ~20 bytes, so this is a fixed cost of roughly 40KiB per buffer.
+    static constexpr uint32_t StagedRecordCapacity = 2048;
+    // Lock-free SPSC lane for flat records written without the console lock.
+    // Pushes are serialized by the writing thread (the VT input path), pops by
+    // the console lock; see WriteStaged and _DrainStagedRecords.
+    std::pair<til::spsc::producer<INPUT_RECORD>, til::spsc::consumer<INPUT_RECORD>> _staged{ til::spsc::channel<INPUT_RECORD>(StagedRecordCapacity) };
+    // Number of records currently staged but not yet drained into _storage.
+    std::atomic<size_t> _stagedCount{ 0 };
+    // True if a reader recently parked on CONSOLE_STATUS_WAIT; tells
+    // WriteStaged to take the lock and drain so the wait gets dispatched.
+    std::atomic<bool> _readerWaiting{ false };
     std::unique_ptr<IInputEvent> _readPartialByteSequence;
     std::unique_ptr<IInputEvent> _writePartialByteSequence;
     Microsoft::Console::VirtualTerminal::TerminalInput _termInput;
@@ -96,7 +133,7 @@ private:
     // Otherwise, we should be calling them.
     bool _vtInputShouldSuppress{ false };
 
-    void _ReadBuffer(_Out_ std::deque<std::unique_ptr<IInputEvent>>& outEvents,
+    void _ReadBuffer(_Out_ std::deque<INPUT_RECORD>& outRecords,
                      const size_t readCount,
                      _Out_ size_t& eventsRead,
                      const bool peek,
@@ -104,17 +141,21 @@ private:
                      const bool unicode,
                      const bool streamRead);
 
-    void _WriteBuffer(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inRecords,
+    void _WriteBuffer(_Inout_ std::pmr::deque<INPUT_RECORD>& inRecords,
                       _Out_ size_t& eventsWritten,
                       _Out_ bool& setWaitEvent);
 
-    bool _CanCoalesce(const KeyEvent& a, const KeyEvent& b) const noexcept;
-    bool _CoalesceMouseMovedEvents(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents);
-    bool _CoalesceRepeatedKeyPressEvents(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents);
-    void _HandleConsoleSuspensionEvents(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents);
+    bool _CanCoalesce(const KEY_EVENT_RECORD& a, const KEY_EVENT_RECORD& b) const noexcept;
+    bool _CoalesceMouseMovedEvents(_Inout_ std::pmr::deque<INPUT_RECORD>& inRecords);
+    bool _CoalesceRepeatedKeyPressEvents(_Inout_ std::pmr::deque<INPUT_RECORD>& inRecords);
+    void _HandleConsoleSuspensionEvents(_Inout_ std::pmr::deque<INPUT_RECORD>& inRecords);
 
     void _HandleTerminalInputCallback(_In_ std::deque<std::unique_ptr<IInputEvent>>& inEvents);
 
+    void _RefreshReadyEventCount() noexcept;
+
+    void _DrainStagedRecords();
+
 #ifdef UNIT_TESTING
     friend class InputBufferTests;
 #endif
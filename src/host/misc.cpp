@@ -182,6 +182,42 @@ BOOL CheckBisectProcessW(const SCREEN_INFORMATION& ScreenInfo,
     }
 }
 
+// Routine Description:
+// - Converts all key events in the deque to the oem char data and adds
+// them back to records.
+// Arguments:
+// - records - on input the INPUT_RECORDs to convert. on output, the
+// converted records
+// Note: may throw on error
+void SplitToOem(std::deque<INPUT_RECORD>& records)
+{
+    const UINT codepage = ServiceLocator::LocateGlobals().getConsoleInformation().CP;
+
+    // convert events to oem codepage
+    std::deque<INPUT_RECORD> convertedRecords;
+    for (const auto& record : records)
+    {
+        if (record.EventType == KEY_EVENT)
+        {
+            // convert from wchar to char
+            const std::wstring wstr{ record.Event.KeyEvent.uChar.UnicodeChar };
+            const auto str = ConvertToA(codepage, wstr);
+
+            for (const auto& ch : str)
+            {
+                INPUT_RECORD tempRecord = record;
+                tempRecord.Event.KeyEvent.uChar.UnicodeChar = static_cast<wchar_t>(ch);
+                convertedRecords.push_back(tempRecord);
+            }
+        }
+        else
+        {
+            convertedRecords.push_back(record);
+        }
+    }
+    records.swap(convertedRecords);
+}
+
 // Routine Description:
 // - Converts all key events in the deque to the oem char data and adds
 // them back to events.
@@ -44,6 +44,7 @@ int ConvertToOem(const UINT uiCodePage,
                  _Out_writes_(cchTarget) CHAR* const pchTarget,
                  const UINT cchTarget) noexcept;
 
+void SplitToOem(std::deque<INPUT_RECORD>& records);
 void SplitToOem(std::deque<std::unique_ptr<IInputEvent>>& events);
 
 int ConvertInputToUnicode(const UINT uiCodePage,
@@ -92,24 +92,10 @@ static void _CopyRectangle(SCREEN_INFORMATION& screenInfo,
         }
     }
 
-    // 2. We can move any other scenario in-place without copying. We just have to carefully
-    //    choose which direction we walk through filling up the target so it doesn't accidentally
-    //    erase the source material before it can be copied/moved to the new location.
-    {
-        const auto target = Viewport::FromDimensions(targetOrigin, source.Dimensions());
-        const auto walkDirection = Viewport::DetermineWalkDirection(source, target);
-
-        auto sourcePos = source.GetWalkOrigin(walkDirection);
-        auto targetPos = target.GetWalkOrigin(walkDirection);
-
-        do
-        {
-            const auto data = OutputCell(*screenInfo.GetCellDataAt(sourcePos));
-            screenInfo.Write(OutputCellIterator({ &data, 1 }), targetPos);
-
-            source.WalkInBounds(sourcePos, walkDirection);
-        } while (target.WalkInBounds(targetPos, walkDirection));
-    }
+    // 2. Any other scenario is a partial-width rectangle (think DECSTBM with
+    //    left/right margins). The buffer can still move those as whole runs per
+    //    row instead of us reading and re-writing every cell through here.
+    screenInfo.GetTextBuffer().CopyRect(source, targetOrigin);
 }
 
 // Routine Description:
@@ -283,6 +269,40 @@ static void _ScrollScreen(SCREEN_INFORMATION& screenInfo, const Viewport& source
     // Get the text buffer and send it commands.
     // It will figure out whether or not we're active and where the messages need to go.
     auto& textBuffer = screenInfo.GetTextBuffer();
+
+    // If this was a pure vertical shift whose source and fill regions both
+    // cover the entire visible viewport (a full-screen application scrolling
+    // itself a line, for instance), then report it to the renderer as a
+    // scroll instead of invalidating everything that moved. Engines can
+    // carry the previous frame's contents over by the delta and repaint only
+    // the newly revealed lines.
+    COORD delta;
+    delta.X = target.Left() - source.Left();
+    delta.Y = target.Top() - source.Top();
+
+    const auto viewport = screenInfo.GetViewport();
+    if (delta.X == 0 && delta.Y != 0 && source.IsInBounds(viewport) && fill.IsInBounds(viewport))
+    {
+        textBuffer.TriggerScroll(delta);
+        return;
+    }
+
+    // Failing that, a vertical shift of a full-width band that stays inside
+    // the viewport (vim or tmux scrolling a region of the screen) can still
+    // be reported as a region scroll, so the VT renderer can replay it with
+    // margin sequences instead of repainting every row of the band.
+    if (delta.X == 0 && delta.Y != 0)
+    {
+        const auto region = Viewport::Union(Viewport::Union(source, target), fill);
+        if (viewport.IsInBounds(region) &&
+            region.Left() == viewport.Left() &&
+            region.RightInclusive() == viewport.RightInclusive())
+        {
+            textBuffer.TriggerScrollRegion(region, delta);
+            return;
+        }
+    }
+
     // Redraw anything in the target area
     textBuffer.TriggerRedraw(target);
     // Also redraw anything that was filled.
@@ -34,7 +34,8 @@ void ConhostInternalGetSet::PrintString(const std::wstring_view string)
 {
     size_t dwNumBytes = string.size() * sizeof(wchar_t);
 
-    Cursor& cursor = _io.GetActiveOutputBuffer().GetTextBuffer().GetCursor();
+    auto& screenInfo = _io.GetActiveOutputBuffer();
+    Cursor& cursor = screenInfo.GetTextBuffer().GetCursor();
     if (!cursor.IsOn())
     {
         cursor.SetIsOn(true);
@@ -42,17 +43,27 @@ void ConhostInternalGetSet::PrintString(const std::wstring_view string)
 
     // Defer the cursor drawing while we are iterating the string, for a better performance.
     // We can not waste time displaying a cursor event when we know more text is coming right behind it.
-    cursor.StartDeferDrawing();
-    const auto ntstatus = WriteCharsLegacy(_io.GetActiveOutputBuffer(),
+    // WriteChars already defers across the whole write, in which case each
+    // print run here must leave the outer deferral in place rather than
+    // ending it (and redrawing the cursor) after every run.
+    const bool alreadyDeferred = cursor.IsDeferDrawing();
+    if (!alreadyDeferred)
+    {
+        cursor.StartDeferDrawing();
+    }
+    const auto ntstatus = WriteCharsLegacy(screenInfo,
                                            string.data(),
                                            string.data(),
                                            string.data(),
                                            &dwNumBytes,
                                            nullptr,
-                                           _io.GetActiveOutputBuffer().GetTextBuffer().GetCursor().GetPosition().X,
+                                           cursor.GetPosition().X,
                                            WC_LIMIT_BACKSPACE | WC_DELAY_EOL_WRAP,
                                            nullptr);
-    cursor.EndDeferDrawing();
+    if (!alreadyDeferred)
+    {
+        cursor.EndDeferDrawing();
+    }
 
     THROW_IF_NTSTATUS_FAILED(ntstatus);
 }
@@ -165,7 +176,44 @@ SHORT ConhostInternalGetSet::GetLineWidth(const size_t row) const
 // - <none>
 void ConhostInternalGetSet::WriteInput(std::deque<std::unique_ptr<IInputEvent>>& events, size_t& eventsWritten)
 {
-    eventsWritten = _io.GetActiveInputBuffer()->Write(events);
+    // Flatten the events into records and hand them to the input buffer's
+    // lock-free staging lane. This path runs for every keystroke forwarded
+    // over the ConPTY input pipe (and for query responses), so it should not
+    // queue-jump output processing for the console lock. A keystroke turns
+    // into a handful of records at most, so flatten onto the stack and only
+    // fall back to the heap for unusually large batches.
+    INPUT_RECORD stackBuffer[16];
+    std::vector<INPUT_RECORD> heapBuffer;
+    auto records = &stackBuffer[0];
+    if (events.size() > std::size(stackBuffer))
+    {
+        heapBuffer.resize(events.size());
+        records = heapBuffer.data();
+    }
+
+    size_t count = 0;
+    for (const auto& event : events)
+    {
+        records[count++] = event->ToInputRecord();
+    }
+
+    WriteInput({ records, count }, eventsWritten);
+    events.clear();
+}
+
+// Routine Description:
+// - Writes flat input records to the input buffer. This is the preferred
+//   variant: the records go straight into the staging lane without ever
+//   being wrapped in heap-allocated IInputEvents.
+// Arguments:
+// - records - the input records to be copied into the head of the input
+//             buffer for the underlying attached process
+// - eventsWritten - on output, the number of events written
+// Return Value:
+// - <none>
+void ConhostInternalGetSet::WriteInput(const gsl::span<const INPUT_RECORD> records, size_t& eventsWritten)
+{
+    eventsWritten = _io.GetActiveInputBuffer()->WriteStaged(records);
 }
 
 // Routine Description:
@@ -791,14 +839,33 @@ void ConhostInternalGetSet::FillRegion(const COORD startPosition,
         fillAttrs.SetStandardErase();
     }
 
-    const auto fillData = OutputCellIterator{ fillChar, fillAttrs, fillLength };
-    screenInfo.Write(fillData, startPosition, false);
+    const auto bufferSize = screenInfo.GetBufferSize();
+    if (fillChar >= UNICODE_SPACE && fillChar < L'\x7f')
+    {
+        // A simple narrow fill glyph can be committed as one run operation
+        // per row, rather than walking a fill iterator cell by cell.
+        auto remaining = fillLength;
+        auto position = startPosition;
+        while (remaining > 0 && bufferSize.IsInBounds(position))
+        {
+            const auto columnsInRow = std::min<size_t>(remaining, bufferSize.RightExclusive() - position.X);
+            const auto fillRect = Viewport::FromDimensions(position, { gsl::narrow<SHORT>(columnsInRow), 1 });
+            screenInfo.FillRect(fillRect, fillChar, fillAttrs);
+            remaining -= columnsInRow;
+            position.X = bufferSize.Left();
+            position.Y++;
+        }
+    }
+    else
+    {
+        const auto fillData = OutputCellIterator{ fillChar, fillAttrs, fillLength };
+        screenInfo.Write(fillData, startPosition, false);
+    }
 
     // Notify accessibility
     if (screenInfo.HasAccessibilityEventing())
     {
         auto endPosition = startPosition;
-        const auto bufferSize = screenInfo.GetBufferSize();
         bufferSize.MoveInBounds(fillLength - 1, endPosition);
         screenInfo.NotifyAccessibilityEventing(startPosition.X, startPosition.Y, endPosition.X, endPosition.Y);
     }
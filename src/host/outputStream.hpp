@@ -44,6 +44,7 @@ public:
     SHORT GetLineWidth(const size_t row) const override;
 
     void WriteInput(std::deque<std::unique_ptr<IInputEvent>>& events, size_t& eventsWritten) override;
+    void WriteInput(const gsl::span<const INPUT_RECORD> records, size_t& eventsWritten) override;
 
     void SetWindowInfo(bool const absolute, const SMALL_RECT& window) override;
 
@@ -84,56 +84,52 @@ void Popup::Draw()
 
 // Routine Description:
 // - Draws the outlines of the popup area in the screen buffer
+// - The frame is composed in memory and written with a single rectangle write
+//   rather than cell-by-cell, so the screen (and any attached terminal) sees
+//   one update covering the whole border instead of one per edge cell.
+//   The interior is filled with blanks; _DrawContent always follows and
+//   paints over it.
 void Popup::_DrawBorder()
 {
-    // fill attributes of top line
-    COORD WriteCoord;
-    WriteCoord.X = _region.Left;
-    WriteCoord.Y = _region.Top;
-    _screenInfo.Write(OutputCellIterator(_attributes, Width() + 2), WriteCoord);
-
-    // draw upper left corner
-    _screenInfo.Write(OutputCellIterator(UNICODE_BOX_DRAW_LIGHT_DOWN_AND_RIGHT, 1), WriteCoord);
-
-    // draw upper bar
-    WriteCoord.X += 1;
-    _screenInfo.Write(OutputCellIterator(UNICODE_BOX_DRAW_LIGHT_HORIZONTAL, Width()), WriteCoord);
+    const size_t width = gsl::narrow<size_t>(Width()) + 2;
+    const size_t height = gsl::narrow<size_t>(Height()) + 2;
 
-    // draw upper right corner
-    WriteCoord.X = _region.Right;
-    _screenInfo.Write(OutputCellIterator(UNICODE_BOX_DRAW_LIGHT_DOWN_AND_LEFT, 1), WriteCoord);
+    OutputCellRect frame(height, width);
+    const auto cell = [&](const wchar_t wch) {
+        return OutputCell({ &wch, 1 }, DbcsAttribute{}, _attributes);
+    };
 
-    for (SHORT i = 0; i < Height(); i++)
+    for (size_t row = 0; row < height; row++)
     {
-        WriteCoord.Y += 1;
-        WriteCoord.X = _region.Left;
-
-        // fill attributes
-        _screenInfo.Write(OutputCellIterator(_attributes, Width() + 2), WriteCoord);
-
-        _screenInfo.Write(OutputCellIterator(UNICODE_BOX_DRAW_LIGHT_VERTICAL, 1), WriteCoord);
-
-        WriteCoord.X = _region.Right;
-        _screenInfo.Write(OutputCellIterator(UNICODE_BOX_DRAW_LIGHT_VERTICAL, 1), WriteCoord);
+        wchar_t left;
+        wchar_t middle;
+        wchar_t right;
+        if (row == 0)
+        {
+            left = UNICODE_BOX_DRAW_LIGHT_DOWN_AND_RIGHT;
+            middle = UNICODE_BOX_DRAW_LIGHT_HORIZONTAL;
+            right = UNICODE_BOX_DRAW_LIGHT_DOWN_AND_LEFT;
+        }
+        else if (row == height - 1)
+        {
+            left = UNICODE_BOX_DRAW_LIGHT_UP_AND_RIGHT;
+            middle = UNICODE_BOX_DRAW_LIGHT_HORIZONTAL;
+            right = UNICODE_BOX_DRAW_LIGHT_UP_AND_LEFT;
+        }
+        else
+        {
+            left = UNICODE_BOX_DRAW_LIGHT_VERTICAL;
+            middle = UNICODE_SPACE;
+            right = UNICODE_BOX_DRAW_LIGHT_VERTICAL;
+        }
+
+        const auto span = frame.GetRow(row);
+        std::fill(span.begin(), span.end(), cell(middle));
+        *span.begin() = cell(left);
+        *span.rbegin() = cell(right);
     }
 
-    // Draw bottom line.
-    // Fill attributes of top line.
-    WriteCoord.X = _region.Left;
-    WriteCoord.Y = _region.Bottom;
-    _screenInfo.Write(OutputCellIterator(_attributes, Width() + 2), WriteCoord);
-
-    // Draw bottom left corner.
-    WriteCoord.X = _region.Left;
-    _screenInfo.Write(OutputCellIterator(UNICODE_BOX_DRAW_LIGHT_UP_AND_RIGHT, 1), WriteCoord);
-
-    // Draw lower bar.
-    WriteCoord.X += 1;
-    _screenInfo.Write(OutputCellIterator(UNICODE_BOX_DRAW_LIGHT_HORIZONTAL, Width()), WriteCoord);
-
-    // draw lower right corner
-    WriteCoord.X = _region.Right;
-    _screenInfo.Write(OutputCellIterator(UNICODE_BOX_DRAW_LIGHT_UP_AND_LEFT, 1), WriteCoord);
+    _screenInfo.WriteRect(frame, { _region.Left, _region.Top });
 }
 
 // Routine Description:
@@ -144,35 +140,27 @@ void Popup::_DrawPrompt(const UINT id)
 {
     std::wstring text = _LoadString(id);
 
-    // Draw empty popup.
-    COORD WriteCoord;
-    WriteCoord.X = _region.Left + 1i16;
-    WriteCoord.Y = _region.Top + 1i16;
-    size_t lStringLength = Width();
-    for (SHORT i = 0; i < Height(); i++)
+    const size_t width = gsl::narrow<size_t>(Width());
+    if (text.size() > width)
     {
-        const OutputCellIterator it(UNICODE_SPACE, _attributes, lStringLength);
-        const auto done = _screenInfo.Write(it, WriteCoord);
-        lStringLength = done.GetCellDistance(it);
-
-        WriteCoord.Y += 1;
+        text = text.substr(0, width);
     }
 
+    // Pad the prompt out to the popup width so a single run write both
+    // clears the row and draws the text.
+    text.append(width - text.size(), UNICODE_SPACE);
+
+    COORD WriteCoord;
     WriteCoord.X = _region.Left + 1i16;
     WriteCoord.Y = _region.Top + 1i16;
+    _screenInfo.Write(OutputCellIterator(text, _attributes), WriteCoord);
 
-    // write prompt to screen
-    lStringLength = text.size();
-    if (lStringLength > (ULONG)Width())
+    // blank out the remaining rows of the popup interior
+    for (SHORT i = 1; i < Height(); i++)
     {
-        text = text.substr(0, Width());
+        WriteCoord.Y += 1;
+        _screenInfo.Write(OutputCellIterator(UNICODE_SPACE, _attributes, width), WriteCoord);
     }
-
-    size_t used;
-    LOG_IF_FAILED(ServiceLocator::LocateGlobals().api->WriteConsoleOutputCharacterWImpl(_screenInfo,
-                                                                                        text,
-                                                                                        WriteCoord,
-                                                                                        used));
 }
 
 // Routine Description:
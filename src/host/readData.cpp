@@ -4,6 +4,9 @@
 #include "precomp.h"
 #include "readData.hpp"
 
+#include "inputBuffer.hpp"
+#include "inputReadHandleData.h"
+
 // Routine Description:
 // - Constructs read data base class to hold input buffer and cross-call handle information
 // - Increments count of readers waiting on the given handle.
@@ -48,6 +51,19 @@ ReadData::ReadData(ReadData&& other) :
     other._pInputReadHandleData = nullptr;
 }
 
+// Routine Description:
+// - Answers whether this blocked read could make any progress if its routine ran now.
+// - New input events (ready or staged) and input left pending on the handle by a
+//   previous read are the only things a reader can consume, so with neither present
+//   there is no point replaying the read routine just to have it wait again.
+// Return Value:
+// - False if the read definitely cannot be satisfied right now. True to dispatch.
+bool ReadData::CanNotify() const noexcept
+{
+    return _pInputBuffer->GetNumberOfReadyEvents() > 0 ||
+           _pInputReadHandleData->IsInputPending();
+}
+
 // Routine Description:
 // - Retrieves the input buffer pointer associated with this read data context
 // Arguments:
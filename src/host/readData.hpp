@@ -40,6 +40,7 @@ public:
     ReadData& operator=(ReadData&&) & = delete;
 
     virtual void MigrateUserBuffersOnTransitionToBackgroundWait(const void* oldBuffer, void* newBuffer) = 0;
+    bool CanNotify() const noexcept override;
     virtual bool Notify(const WaitTerminationReason TerminationReason,
                         const bool fIsUnicode,
                         _Out_ NTSTATUS* const pReplyStatus,
@@ -578,15 +578,16 @@ bool COOKED_READ_DATA::ProcessInput(const wchar_t wchOrig,
     else
     {
         bool CallWrite = true;
+        bool fullRedraw = false;
         const SHORT sScreenBufferSizeX = _screenInfo.GetBufferSize().Width();
 
         // processing in the middle of the line is more complex:
 
-        // calculate new cursor position
-        // store new char
-        // clear the current command line from the screen
-        // write the new command line to the screen
-        // update the cursor position
+        // store new char (shifting the tail of the line when inserting)
+        // echo it so the cursor lands just past the edit point
+        // rewrite only the tail of the line that shifted
+        // blank out any cells the line no longer covers
+        // put the cursor back at the edit point
 
         if (wch == UNICODE_BACKSPACE && _processedInput)
         {
@@ -659,24 +660,14 @@ bool COOKED_READ_DATA::ProcessInput(const wchar_t wchOrig,
                 _bufPtr += 1;
                 _bytesRead += sizeof(WCHAR);
                 _currentPosition += 1;
+
+                // the carriage return teleports the edit point to the end of
+                // the line, so the incremental path below has no anchor to
+                // repaint from; redraw the whole line like we used to.
+                fullRedraw = true;
             }
             else
             {
-                bool fBisect = false;
-
-                if (_echoInput)
-                {
-                    if (CheckBisectProcessW(_screenInfo,
-                                            _backupLimit,
-                                            _currentPosition + 1,
-                                            sScreenBufferSizeX - _originalCursorPosition.X,
-                                            _originalCursorPosition.X,
-                                            TRUE))
-                    {
-                        fBisect = true;
-                    }
-                }
-
                 if (_insertMode)
                 {
                     memmove(_bufPtr + 1,
@@ -688,26 +679,36 @@ bool COOKED_READ_DATA::ProcessInput(const wchar_t wchOrig,
                 _bufPtr += 1;
                 _currentPosition += 1;
 
-                // calculate new cursor position
                 if (_echoInput)
                 {
-                    NumSpaces = RetrieveNumberOfSpaces(_originalCursorPosition.X,
-                                                       _backupLimit,
-                                                       _currentPosition - 1);
-                    if (NumSpaces > 0 && fBisect)
-                        NumSpaces--;
+                    // echo just the new character. WriteCharsLegacy leaves
+                    // the cursor right behind it, handling control chars and
+                    // bisecting fullwidth glyphs the same way the
+                    // end-of-line path does.
+                    NumToWrite = sizeof(WCHAR);
+                    status = WriteCharsLegacy(_screenInfo,
+                                              _backupLimit,
+                                              _bufPtr - 1,
+                                              _bufPtr - 1,
+                                              &NumToWrite,
+                                              nullptr,
+                                              _originalCursorPosition.X,
+                                              WC_DESTRUCTIVE_BACKSPACE | WC_KEEP_CURSOR_VISIBLE | WC_PRINTABLE_CONTROL_CHARS,
+                                              &ScrollY);
+                    if (NT_SUCCESS(status))
+                    {
+                        _originalCursorPosition.Y += ScrollY;
+                    }
+                    else
+                    {
+                        RIPMSG1(RIP_WARNING, "WriteCharsLegacy failed %x", status);
+                    }
                 }
             }
         }
 
-        if (_echoInput && CallWrite)
+        if (_echoInput && CallWrite && fullRedraw)
         {
-            COORD CursorPosition;
-
-            // save cursor position
-            CursorPosition = _screenInfo.GetTextBuffer().GetCursor().GetPosition();
-            CursorPosition.X = (SHORT)(CursorPosition.X + NumSpaces);
-
             // clear the current command line from the screen
             // clang-format off
 #pragma prefast(suppress: __WARNING_BUFFER_OVERFLOW, "Not sure why prefast doesn't like this call.")
@@ -717,11 +718,6 @@ bool COOKED_READ_DATA::ProcessInput(const wchar_t wchOrig,
             // write the new command line to the screen
             NumToWrite = _bytesRead;
 
-            DWORD dwFlags = WC_DESTRUCTIVE_BACKSPACE | WC_PRINTABLE_CONTROL_CHARS;
-            if (wch == UNICODE_CARRIAGERETURN)
-            {
-                dwFlags |= WC_KEEP_CURSOR_VISIBLE;
-            }
             status = WriteCharsLegacy(_screenInfo,
                                       _backupLimit,
                                       _backupLimit,
@@ -729,7 +725,7 @@ bool COOKED_READ_DATA::ProcessInput(const wchar_t wchOrig,
                                       &NumToWrite,
                                       &_visibleCharCount,
                                       _originalCursorPosition.X,
-                                      dwFlags,
+                                      WC_DESTRUCTIVE_BACKSPACE | WC_KEEP_CURSOR_VISIBLE | WC_PRINTABLE_CONTROL_CHARS,
                                       &ScrollY);
             if (!NT_SUCCESS(status))
             {
@@ -737,32 +733,66 @@ bool COOKED_READ_DATA::ProcessInput(const wchar_t wchOrig,
                 _bytesRead = 0;
                 return true;
             }
+        }
+        else if (_echoInput && CallWrite)
+        {
+            // the cursor now sits just past the edit point; remember it and
+            // repaint only the tail of the line that shifted.
+            COORD CursorPosition = _screenInfo.GetTextBuffer().GetCursor().GetPosition();
 
-            // update cursor position
-            if (wch != UNICODE_CARRIAGERETURN)
+            NumToWrite = _bytesRead - (_currentPosition * sizeof(WCHAR));
+            if (NumToWrite > 0)
             {
-                if (CheckBisectProcessW(_screenInfo,
-                                        _backupLimit,
-                                        _currentPosition + 1,
-                                        sScreenBufferSizeX - _originalCursorPosition.X,
-                                        _originalCursorPosition.X,
-                                        TRUE))
+                ScrollY = 0;
+                status = WriteCharsLegacy(_screenInfo,
+                                          _backupLimit,
+                                          _bufPtr,
+                                          _bufPtr,
+                                          &NumToWrite,
+                                          nullptr,
+                                          _originalCursorPosition.X,
+                                          WC_DESTRUCTIVE_BACKSPACE | WC_PRINTABLE_CONTROL_CHARS,
+                                          &ScrollY);
+                if (!NT_SUCCESS(status))
                 {
-                    if (CursorPosition.X == (sScreenBufferSizeX - 1))
-                    {
-                        CursorPosition.X++;
-                    }
+                    RIPMSG1(RIP_WARNING, "WriteCharsLegacy failed 0x%x", status);
+                    _bytesRead = 0;
+                    return true;
                 }
 
                 // adjust cursor position for WriteChars
                 _originalCursorPosition.Y += ScrollY;
                 CursorPosition.Y += ScrollY;
-                status = AdjustCursorPosition(_screenInfo, CursorPosition, TRUE, nullptr);
-                if (!NT_SUCCESS(status))
+            }
+
+            // the cursor is now just past the end of the text, so the new
+            // on-screen extent of the line can be read straight off of it
+            // instead of re-measuring every glyph in the buffer.
+            const COORD coordEnd = _screenInfo.GetTextBuffer().GetCursor().GetPosition();
+            const ptrdiff_t newVisibleCharCount = (coordEnd.Y - _originalCursorPosition.Y) * sScreenBufferSizeX +
+                                                  coordEnd.X - _originalCursorPosition.X;
+
+            // blank out the cells the line shrank off of (backspace, or
+            // overwriting a fullwidth glyph with a narrow one).
+            if (newVisibleCharCount >= 0 && static_cast<size_t>(newVisibleCharCount) < _visibleCharCount)
+            {
+                try
                 {
-                    _bytesRead = 0;
-                    return true;
+                    _screenInfo.Write(OutputCellIterator(UNICODE_SPACE, _visibleCharCount - static_cast<size_t>(newVisibleCharCount)), coordEnd);
                 }
+                CATCH_LOG();
+            }
+            if (newVisibleCharCount >= 0)
+            {
+                _visibleCharCount = newVisibleCharCount;
+            }
+
+            // put the cursor back at the edit point
+            status = AdjustCursorPosition(_screenInfo, CursorPosition, TRUE, nullptr);
+            if (!NT_SUCCESS(status))
+            {
+                _bytesRead = 0;
+                return true;
             }
         }
     }
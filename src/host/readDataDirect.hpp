@@ -34,7 +34,7 @@ public:
     DirectReadData(_In_ InputBuffer* const pInputBuffer,
                    _In_ INPUT_READ_HANDLE_DATA* const pInputReadHandleData,
                    const size_t eventReadCount,
-                   _In_ std::deque<std::unique_ptr<IInputEvent>> partialEvents);
+                   _In_ std::deque<INPUT_RECORD> partialRecords);
 
     DirectReadData(DirectReadData&&) = default;
 
@@ -50,6 +50,6 @@ public:
 
 private:
     const size_t _eventReadCount;
-    std::deque<std::unique_ptr<IInputEvent>> _partialEvents;
-    std::deque<std::unique_ptr<IInputEvent>> _outEvents;
+    std::deque<INPUT_RECORD> _partialRecords;
+    std::deque<INPUT_RECORD> _outRecords;
 };
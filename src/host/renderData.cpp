@@ -323,10 +323,21 @@ const std::wstring RenderData::GetHyperlinkCustomId(uint16_t id) const noexcept
     return gci.GetActiveOutputBuffer().GetTextBuffer().GetCustomIdFromId(id);
 }
 
+// Method Description:
+// - Get the current color generation of the render settings; see
+//   RenderSettings::GetColorGeneration
+// Return Value:
+// - A number that changes whenever resolved colors may have changed
+uint64_t RenderData::GetColorGeneration() const noexcept
+{
+    const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+    return gci.GetRenderSettings().GetColorGeneration();
+}
+
 // For now, we ignore regex patterns in conhost
-const std::vector<size_t> RenderData::GetPatternId(const COORD /*location*/) const noexcept
+void RenderData::GetPatternId(const COORD /*location*/, std::vector<size_t>& patternIds) const noexcept
 {
-    return {};
+    patternIds.clear();
 }
 #pragma endregion
 
@@ -52,8 +52,9 @@ public:
 
     const std::wstring GetHyperlinkUri(uint16_t id) const noexcept override;
     const std::wstring GetHyperlinkCustomId(uint16_t id) const noexcept override;
+    uint64_t GetColorGeneration() const noexcept override;
 
-    const std::vector<size_t> GetPatternId(const COORD location) const noexcept override;
+    void GetPatternId(const COORD location, std::vector<size_t>& patternIds) const noexcept override;
 #pragma endregion
 
 #pragma region IUiaData
@@ -368,6 +368,98 @@ void SCREEN_INFORMATION::GetScreenBufferInformation(_Out_ PCOORD pcoordSize,
     *pcoordMaximumWindowSize = GetMaxWindowSizeInCharacters();
 }
 
+// Routine Description:
+// - Publishes a fresh copy of the hot screen buffer metadata for lock-free
+//   consumption by read-only API calls. Some clients poll
+//   GetConsoleScreenBufferInfoEx and the cursor queries at very high rates;
+//   answering those from a snapshot keeps them from contending on the console
+//   lock with the output path.
+// - Must be called while holding the console lock; the lock serializes all
+//   writers, so the sequence counter only has to protect readers from seeing
+//   a half-written copy.
+// Return Value:
+// - None
+void SCREEN_INFORMATION::PublishApiSnapshot() noexcept
+{
+    const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+
+    ApiSnapshot data{};
+    data.size = GetBufferSize().Dimensions();
+    data.cursorPosition = _textBuffer->GetCursor().GetPosition();
+    data.window = _viewport.ToInclusive();
+    data.attributes = GetAttributes().GetLegacyAttributes();
+    data.popupAttributes = _PopupAttributes.GetLegacyAttributes();
+    data.cursorSize = _textBuffer->GetCursor().GetSize();
+    data.cursorVisible = _textBuffer->GetCursor().IsVisible();
+
+    // the copy length must be constant for now to keep OACR happy with buffer overruns.
+    for (size_t i = 0; i < COLOR_TABLE_SIZE; i++)
+    {
+        data.colorTable[i] = gci.GetLegacyColorTableEntry(i);
+    }
+
+    // The maximum window size is the one expensive input here: it asks the
+    // window metrics about the current monitor. Only recompute it when one of
+    // its inputs (buffer size or font size) changed since the last publish
+    // and reuse the previous answer otherwise. A monitor layout change with
+    // no accompanying font or size change can leave it stale for a moment,
+    // which is no worse than the value going stale right after a locked read.
+    const auto fontSize = GetScreenFontSize();
+    if (_apiSnapshotSequence.load(std::memory_order_relaxed) == 0 ||
+        !(data.size == _apiSnapshot.size) ||
+        !(fontSize == _apiSnapshotFontSize))
+    {
+        data.maximumWindowSize = GetMaxWindowSizeInCharacters();
+        _apiSnapshotFontSize = fontSize;
+    }
+    else
+    {
+        data.maximumWindowSize = _apiSnapshot.maximumWindowSize;
+    }
+
+    // Standard seqlock publish: flip to odd, write the payload, flip back to
+    // even. Readers that overlap with us will observe the odd value or a
+    // mismatched pair and retry.
+    const auto sequence = _apiSnapshotSequence.load(std::memory_order_relaxed);
+    _apiSnapshotSequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    _apiSnapshot = data;
+    _apiSnapshotSequence.store(sequence + 2, std::memory_order_release);
+}
+
+// Routine Description:
+// - Retrieves the latest published metadata snapshot without taking the
+//   console lock. May be called from any thread.
+// Arguments:
+// - snapshot - receives the copied snapshot on success
+// Return Value:
+// - true if a consistent snapshot was read. false if nothing has been
+//   published yet (early startup); callers should fall back to a locked read.
+bool SCREEN_INFORMATION::TryGetApiSnapshot(ApiSnapshot& snapshot) const noexcept
+{
+    for (;;)
+    {
+        const auto start = _apiSnapshotSequence.load(std::memory_order_acquire);
+        if (start == 0)
+        {
+            return false;
+        }
+
+        if ((start & 1) == 0)
+        {
+            snapshot = _apiSnapshot;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (_apiSnapshotSequence.load(std::memory_order_relaxed) == start)
+            {
+                return true;
+            }
+        }
+
+        // A publish was in flight; it'll be done momentarily.
+        YieldProcessor();
+    }
+}
+
 // Routine Description:
 // - Gets the smallest possible client area in characters. Takes the window client area and divides by the active font dimensions.
 // Arguments:
@@ -867,13 +959,24 @@ void SCREEN_INFORMATION::ProcessResizeWindow(const RECT* const prcClientNew,
         _psiMainBuffer->_rcAltSavedClientOld = *prcClientOld;
     }
 
+    // If the user is mid-drag on a window edge, don't rebuild the buffer for
+    // every intermediate size; capture the rectangles so the final size can
+    // be applied in one shot when the drag completes and do only the cheap
+    // viewport and scroll bar work below in the meantime.
+    if (_fDeferWindowResize)
+    {
+        _fDeferredResizePending = true;
+        _rcDeferredClientNew = *prcClientNew;
+        _rcDeferredClientOld = *prcClientOld;
+    }
+
     // 1.a In some modes, the screen buffer size needs to change on window size,
     //      so do that first.
     //      _AdjustScreenBuffer might hide the commandline. If it does so, it'll
     //      return S_OK instead of S_FALSE. In that case, we'll need to re-show
     //      the commandline ourselves once the viewport size is updated.
     //      (See 1.b below)
-    const HRESULT adjustBufferSizeResult = _AdjustScreenBuffer(prcClientNew);
+    const HRESULT adjustBufferSizeResult = _fDeferWindowResize ? S_FALSE : _AdjustScreenBuffer(prcClientNew);
     LOG_IF_FAILED(adjustBufferSizeResult);
 
     // 2. Now calculate how large the new viewport should be
@@ -902,6 +1005,58 @@ void SCREEN_INFORMATION::ProcessResizeWindow(const RECT* const prcClientNew,
     //FAIL_FAST_IF(!(_viewport.IsValid()));
 }
 
+// Routine Description:
+// - Marks the start of an interactive size/move operation on the window.
+//   While one is in progress, ProcessResizeWindow captures the requested
+//   dimensions but defers the buffer resize; rebuilding (and possibly
+//   reflowing) the buffer for every intermediate size of a drag stalls both
+//   the window and any client writes waiting on the console lock.
+// Return Value:
+// - <none>
+void SCREEN_INFORMATION::BeginDeferredWindowResize() noexcept
+{
+    // The drag belongs to the window, not to one particular buffer; keep the
+    // main and alternate buffers in agreement in case the client switches
+    // between them mid-drag.
+    _fDeferWindowResize = true;
+    if (_psiMainBuffer)
+    {
+        _psiMainBuffer->_fDeferWindowResize = true;
+    }
+    if (_psiAlternateBuffer)
+    {
+        _psiAlternateBuffer->_fDeferWindowResize = true;
+    }
+}
+
+// Routine Description:
+// - Marks the end of an interactive size/move operation. If any window
+//   resizes arrived while it was in progress, the last captured dimensions
+//   are applied now, paying for a single buffer resize instead of one per
+//   intermediate size.
+// Return Value:
+// - <none>
+void SCREEN_INFORMATION::EndDeferredWindowResize()
+{
+    _fDeferWindowResize = false;
+    if (_psiMainBuffer)
+    {
+        _psiMainBuffer->_fDeferWindowResize = false;
+        _psiMainBuffer->_fDeferredResizePending = false;
+    }
+    if (_psiAlternateBuffer)
+    {
+        _psiAlternateBuffer->_fDeferWindowResize = false;
+        _psiAlternateBuffer->_fDeferredResizePending = false;
+    }
+
+    if (_fDeferredResizePending)
+    {
+        _fDeferredResizePending = false;
+        ProcessResizeWindow(&_rcDeferredClientNew, &_rcDeferredClientOld);
+    }
+}
+
 #pragma endregion
 
 #pragma region Support_Calculation
@@ -2427,6 +2582,25 @@ OutputCellIterator SCREEN_INFORMATION::Write(const OutputCellIterator it,
     return _textBuffer->Write(it, target, wrap);
 }
 
+// Routine Description:
+// - Fills a rectangular region of the buffer with a single glyph and attribute.
+// Arguments:
+// - viewport - rectangular region to fill
+// - glyph - narrow glyph to store in every cell of the region
+// - attr - attribute to apply to every cell of the region
+// Return Value:
+// - <none>
+// Note:
+// - will throw exception on error.
+void SCREEN_INFORMATION::FillRect(const Viewport viewport,
+                                  const wchar_t glyph,
+                                  const TextAttribute attr)
+{
+    // This is a block fill; if a row is filled through its final column, any
+    // forced wrap it was carrying no longer describes its contents.
+    _textBuffer->FillRect(viewport, glyph, attr, false);
+}
+
 // Routine Description:
 // - This routine writes a rectangular region into the screen buffer.
 // Arguments:
@@ -2475,6 +2649,90 @@ void SCREEN_INFORMATION::WriteRect(const OutputCellRect& data,
     }
 }
 
+// Routine Description:
+// - Retrieves (creating it on first use) the staged write tail belonging to a
+//   client handle. See ApiDispatchers::ServerWriteConsole for the line-atomic
+//   write arbitration scheme that uses these.
+// Arguments:
+// - handleKey - opaque identity of the client handle the tail belongs to
+// Return Value:
+// - the staging entry for that handle
+SCREEN_INFORMATION::StagedWriteTail& SCREEN_INFORMATION::GetStagedWriteTail(const void* const handleKey)
+{
+    return _stagedWriteTails[handleKey];
+}
+
+// Routine Description:
+// - Writes a handle's staged partial line through to the buffer and forgets
+//   the staging entry. Called when the handle closes.
+// Arguments:
+// - handleKey - opaque identity of the client handle the tail belongs to
+// Note:
+// - The console lock must be held when calling this routine.
+void SCREEN_INFORMATION::CommitStagedWrite(const void* const handleKey)
+{
+    const auto it = _stagedWriteTails.find(handleKey);
+    if (it != _stagedWriteTails.end())
+    {
+        _CommitStagedTail(it->second);
+        _stagedWriteTails.erase(it);
+    }
+}
+
+// Routine Description:
+// - Writes every staged partial line through to the buffer. Called before a
+//   client starts reading input, so a prompt that ends mid-line is visible
+//   while its writer waits for the answer.
+// Note:
+// - The console lock must be held when calling this routine.
+void SCREEN_INFORMATION::CommitAllStagedWrites()
+{
+    for (auto& [handleKey, tail] : _stagedWriteTails)
+    {
+        _CommitStagedTail(tail);
+    }
+    _stagedWriteTails.clear();
+}
+
+// Routine Description:
+// - Hands a staged tail's bytes to the regular WriteConsole implementation.
+// Arguments:
+// - tail - the staging entry to commit; its bytes are consumed
+// Note:
+// - The console lock must be held when calling this routine.
+void SCREEN_INFORMATION::_CommitStagedTail(StagedWriteTail& tail)
+{
+    if (tail.bytes.empty())
+    {
+        return;
+    }
+
+    // If the console is frozen, the write implementations would hand back a
+    // wait routine and there's no client message left to attach it to. The
+    // tail is at most one unfinished line; drop it rather than fault.
+    const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+    if (WI_AreAllFlagsClear(gci.Flags, CONSOLE_SUSPENDED | CONSOLE_SELECTING | CONSOLE_SCROLLBAR_TRACKING))
+    {
+        const auto api = ServiceLocator::LocateGlobals().api;
+        std::unique_ptr<IWaitRoutine> waiter;
+        size_t read;
+        if (tail.unicode)
+        {
+            const std::wstring_view text{ reinterpret_cast<const wchar_t*>(tail.bytes.data()), tail.bytes.size() / sizeof(wchar_t) };
+            LOG_IF_FAILED(api->WriteConsoleWImpl(*this, text, read, tail.requiresVtQuirk, waiter));
+        }
+        else
+        {
+            LOG_IF_FAILED(api->WriteConsoleAImpl(*this, tail.bytes, read, tail.requiresVtQuirk, waiter));
+        }
+
+        // The freeze flags were clear under the lock we hold, so no wait can have engaged.
+        FAIL_FAST_IF(waiter != nullptr);
+    }
+
+    tail.bytes.clear();
+}
+
 // Routine Description:
 // - Clears out the entire text buffer with the default character and
 //   the current default attribute applied to this screen.
@@ -2646,6 +2904,9 @@ void SCREEN_INFORMATION::InitializeCursorRowAttributes()
         auto fillAttributes = GetAttributes();
         fillAttributes.SetStandardErase();
         row.GetAttrRow().SetAttrToEnd(0, fillAttributes);
+        // Mutating the attribute row directly bypasses ROW's versioned
+        // mutation entry points, so advance the version by hand.
+        row.BumpVersion();
         // The row should also be single width to start with.
         row.SetLineRendition(LineRendition::SingleWidth);
     }
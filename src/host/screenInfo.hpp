@@ -76,6 +76,25 @@ public:
                                     _Out_ PWORD pwPopupAttributes,
                                     _Out_writes_(COLOR_TABLE_SIZE) LPCOLORREF lpColorTable) const;
 
+    // A copy of the metadata above that read-only API calls can consume
+    // without taking the console lock. Guarded by a sequence counter
+    // (seqlock); see PublishApiSnapshot/TryGetApiSnapshot.
+    struct ApiSnapshot
+    {
+        COORD size;
+        COORD cursorPosition;
+        SMALL_RECT window;
+        WORD attributes;
+        WORD popupAttributes;
+        COORD maximumWindowSize;
+        ULONG cursorSize;
+        bool cursorVisible;
+        COLORREF colorTable[COLOR_TABLE_SIZE];
+    };
+
+    void PublishApiSnapshot() noexcept;
+    bool TryGetApiSnapshot(ApiSnapshot& snapshot) const noexcept;
+
     void GetRequiredConsoleSizeInPixels(_Out_ PSIZE const pRequiredSize) const;
 
     void MakeCurrentCursorVisible();
@@ -111,6 +130,8 @@ public:
     Microsoft::Console::Types::Viewport GetVirtualViewport() const noexcept;
 
     void ProcessResizeWindow(const RECT* const prcClientNew, const RECT* const prcClientOld);
+    void BeginDeferredWindowResize() noexcept;
+    void EndDeferredWindowResize();
     void SetViewportSize(const COORD* const pcoordSize);
 
     // Forwarders to Window if we're the active buffer.
@@ -138,6 +159,10 @@ public:
                              const COORD target,
                              const std::optional<bool> wrap = true);
 
+    void FillRect(const Microsoft::Console::Types::Viewport viewport,
+                  const wchar_t glyph,
+                  const TextAttribute attr);
+
     OutputCellIterator WriteRect(const OutputCellIterator it,
                                  const Microsoft::Console::Types::Viewport viewport);
 
@@ -159,6 +184,21 @@ public:
 
     bool CursorIsDoubleWidth() const;
 
+    // Staged tail of a client handle's WriteConsole stream for line-atomic
+    // multi-client write arbitration (see ApiDispatchers::ServerWriteConsole).
+    // The unfinished final line of a write waits here until the same client
+    // completes it, the handle closes, or a client starts reading input.
+    struct StagedWriteTail
+    {
+        std::string bytes; // raw payload bytes, exactly as the client sent them
+        bool unicode = false;
+        bool requiresVtQuirk = false;
+    };
+
+    StagedWriteTail& GetStagedWriteTail(const void* const handleKey);
+    void CommitStagedWrite(const void* const handleKey);
+    void CommitAllStagedWrites();
+
     DWORD OutputMode;
     WORD ResizingWindow; // > 0 if we should ignore WM_SIZE messages
 
@@ -167,6 +207,9 @@ public:
 
 private:
     std::unique_ptr<TextBuffer> _textBuffer;
+    std::unordered_map<const void*, StagedWriteTail> _stagedWriteTails;
+
+    void _CommitStagedTail(StagedWriteTail& tail);
 
 public:
     SCREEN_INFORMATION* Next;
@@ -285,6 +328,15 @@ private:
     RECT _rcAltSavedClientOld;
     bool _fAltWindowChanged;
 
+    // While the user is interactively dragging a window edge, buffer
+    // resizes are captured here instead of being applied, so only the final
+    // size pays for a buffer rebuild/reflow. See ProcessResizeWindow and
+    // Begin/EndDeferredWindowResize.
+    bool _fDeferWindowResize{ false };
+    bool _fDeferredResizePending{ false };
+    RECT _rcDeferredClientNew{};
+    RECT _rcDeferredClientOld{};
+
     TextAttribute _PopupAttributes;
 
     FontInfo _currentFont;
@@ -297,6 +349,15 @@ private:
 
     bool _ignoreLegacyEquivalentVTAttributes;
 
+    // Seqlock protecting _apiSnapshot: odd while a publish is in flight, zero
+    // until the first publish. The console lock serializes all writers; the
+    // sequence counter only exists so lock-free readers can detect a torn copy.
+    std::atomic<uint64_t> _apiSnapshotSequence{ 0 };
+    ApiSnapshot _apiSnapshot{};
+    // Font size used for the maximumWindowSize in the last published snapshot,
+    // so publishes can skip the window metrics query when nothing relevant moved.
+    COORD _apiSnapshotFontSize{ 0, 0 };
+
 #ifdef UNIT_TESTING
     friend class TextBufferIteratorTests;
     friend class ScreenBufferTests;
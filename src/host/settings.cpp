@@ -56,7 +56,8 @@ Settings::Settings() :
     // window size pixels initialized below
     _fInterceptCopyPaste(0),
     _fUseDx(UseDx::Disabled),
-    _fCopyColor(false)
+    _fCopyColor(false),
+    _fLineAtomicWrites(false)
 {
     _dwScreenBufferSize.X = 80;
     _dwScreenBufferSize.Y = 25;
@@ -805,3 +806,10 @@ bool Settings::GetCopyColor() const noexcept
 {
     return _fCopyColor;
 }
+
+// Whether WriteConsole calls from different clients sharing this console are
+// arbitrated line-atomically instead of interleaving at call boundaries.
+bool Settings::GetLineAtomicWrites() const noexcept
+{
+    return _fLineAtomicWrites;
+}
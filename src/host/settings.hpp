@@ -184,6 +184,7 @@ public:
 
     UseDx GetUseDx() const noexcept;
     bool GetCopyColor() const noexcept;
+    bool GetLineAtomicWrites() const noexcept;
 
 private:
     RenderSettings _renderSettings;
@@ -229,6 +230,7 @@ private:
     bool _fRenderGridWorldwide;
     UseDx _fUseDx;
     bool _fCopyColor;
+    bool _fLineAtomicWrites;
 
     // this is used for the special STARTF_USESIZE mode.
     bool _fUseWindowSizePixels;
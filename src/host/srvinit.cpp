@@ -16,6 +16,7 @@
 
 #include "../server/DeviceHandle.h"
 #include "../server/Entrypoints.h"
+#include "../server/IoReadQueue.h"
 #include "../server/IoSorter.h"
 
 #include "../interactivity/inc/ServiceLocator.hpp"
@@ -135,6 +136,89 @@ static bool s_IsOnDesktop()
     return fIsDesktop;
 }
 
+// Routine Description:
+// - Applies the settings layers that do not depend on the connecting client:
+//   the Desktop-specific defaults and the default registry values.
+// - Split out of SetUpConsole so the settings preload thread can run the same
+//   work ahead of the first client connection.
+// Arguments:
+// - settings - The global console settings to load into.
+static void s_LoadClientIndependentSettings(CONSOLE_INFORMATION& settings)
+{
+    // 4b. On Desktop editions, we need to apply a series of Desktop-specific defaults that are better than the
+    // ones from the constructor (which are great for OneCore systems.)
+    if (s_IsOnDesktop())
+    {
+        settings.ApplyDesktopSpecificDefaults();
+    }
+
+    // If we're going to be started in pseudoconsole mode, we don't want to
+    //      load any user settings, because that could result in some strange
+    //      rendering results in the end terminal.
+    // Use the launch args because the VtIo hasn't been initialized yet.
+    if (!ServiceLocator::LocateGlobals().launchArgs.InConptyMode())
+    {
+        // 3. Read the default registry values.
+        Registry reg(&settings);
+        reg.LoadGlobalsFromRegistry();
+        reg.LoadDefaultFromRegistry();
+    }
+}
+
+static bool s_fSettingsPreloadStarted = false;
+static wil::unique_event s_settingsPreloadDone;
+
+static DWORD WINAPI SettingsPreloadThreadProc(LPVOID /*lpParameter*/)
+{
+    s_LoadClientIndependentSettings(ServiceLocator::LocateGlobals().getConsoleInformation());
+    s_settingsPreloadDone.SetEvent();
+    return 0;
+}
+
+// Routine Description:
+// - Kicks off loading the client-independent settings on a background thread,
+//   so the registry reads overlap the rest of the server bring-up instead of
+//   gating the first client's connect. SetUpConsole joins the work.
+// - Nobody else touches the settings until the first connection is serviced,
+//   and servicing it waits for this to finish, so the thread owns them for
+//   its entire lifetime.
+// - If anything here fails we simply don't mark the preload as started and
+//   SetUpConsole loads the settings inline like it always has.
+static void s_SettingsPreloadBegin()
+{
+    try
+    {
+        s_settingsPreloadDone.create(wil::EventOptions::ManualReset);
+    }
+    catch (...)
+    {
+        return;
+    }
+
+    wil::unique_handle thread{ CreateThread(nullptr, 0, SettingsPreloadThreadProc, nullptr, 0, nullptr) };
+    if (thread)
+    {
+        LOG_IF_FAILED(SetThreadDescription(thread.get(), L"Console Settings Preload Thread"));
+        s_fSettingsPreloadStarted = true;
+    }
+}
+
+// Routine Description:
+// - Waits for the settings preload started by SettingsPreloadBegin, if any.
+// Return Value:
+// - True if a preload ran to completion (the layers it covers are already
+//   applied). False if no preload was started and the caller must load them.
+static bool s_SettingsPreloadJoin()
+{
+    if (!s_fSettingsPreloadStarted)
+    {
+        return false;
+    }
+
+    s_settingsPreloadDone.wait();
+    return true;
+}
+
 [[nodiscard]] NTSTATUS SetUpConsole(_Inout_ Settings* pStartupSettings,
                                     _In_ DWORD TitleLength,
                                     _In_reads_bytes_(TitleLength) LPWSTR Title,
@@ -155,11 +239,14 @@ static bool s_IsOnDesktop()
     // Set to reference of global console information since that's the only place we need to hold the settings.
     CONSOLE_INFORMATION& settings = ServiceLocator::LocateGlobals().getConsoleInformation();
     const auto& launchArgs = ServiceLocator::LocateGlobals().launchArgs;
-    // 4b. On Desktop editions, we need to apply a series of Desktop-specific defaults that are better than the
-    // ones from the constructor (which are great for OneCore systems.)
-    if (s_IsOnDesktop())
+
+    // 4b and 3. The Desktop-specific defaults and the default registry values
+    // don't depend on the connecting client, so the preload thread started
+    // during server initialization may already have applied them while we
+    // waited for this connection. Join it if it ran; load them here otherwise.
+    if (!s_SettingsPreloadJoin())
     {
-        settings.ApplyDesktopSpecificDefaults();
+        s_LoadClientIndependentSettings(settings);
     }
 
     // Use the launch arguments to check if we're going to be started in pseudoconsole mode.
@@ -168,10 +255,7 @@ static bool s_IsOnDesktop()
     // Use the launch args because the VtIo hasn't been initialized yet.
     if (!launchArgs.InConptyMode())
     {
-        // 3. Read the default registry values.
         Registry reg(&settings);
-        reg.LoadGlobalsFromRegistry();
-        reg.LoadDefaultFromRegistry();
 
         // 2. Read specific settings
 
@@ -333,6 +417,11 @@ HRESULT ConsoleCreateIoThread(_In_ HANDLE Server,
     RETURN_IF_FAILED(ConsoleServerInitialization(Server, args));
     RETURN_IF_FAILED(g.hConsoleInputInitEvent.create(wil::EventOptions::None));
 
+    // Start reading the client-independent settings now, so the registry
+    // churn runs while we finish wiring up the driver connection and wait
+    // for the first client instead of on the connect path itself.
+    s_SettingsPreloadBegin();
+
     if (driverInputEvent != INVALID_HANDLE_VALUE)
     {
         // Store the driver input event. It's already been told that it exists by whomever started us.
@@ -520,12 +609,55 @@ try
                       TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
                       TraceLoggingKeyword(TIL_KEYWORD_TRACE));
 
-    RETURN_IF_FAILED(handoff->EstablishPtyHandoff(inPipeTheirSide.get(),
-                                                  outPipeTheirSide.get(),
-                                                  signalPipeTheirSide.get(),
-                                                  refHandle.get(),
-                                                  serverProcess,
-                                                  clientProcess.get()));
+    // Offer the shared memory output ring to terminals that understand it.
+    // Delegation is always same-box, and the ring spares the output path a
+    // kernel transition per chunk. Terminals that only implement
+    // ITerminalHandoff - or a ring we fail to set up locally - keep using
+    // the pipes for everything; the pipes are created and handed off either
+    // way, and stay the only transport for input and signals.
+    ::Microsoft::WRL::ComPtr<ITerminalHandoff2> handoff2;
+    std::unique_ptr<Microsoft::Console::ConptyRing> outputRing;
+    if (SUCCEEDED(handoff.As(&handoff2)))
+    {
+        LOG_IF_FAILED(Microsoft::Console::ConptyRing::s_Create(Microsoft::Console::ConptyRing::DefaultCapacity, outputRing));
+    }
+
+    if (outputRing)
+    {
+        // Once this call succeeds the terminal reads output from the ring
+        // and nothing else, so there's no renegotiating down to the pipes
+        // afterwards; a failure here fails the handoff outright, like a
+        // failure of the v1 call would.
+        wil::unique_handle terminalProcess;
+        RETURN_IF_FAILED(handoff2->EstablishPtyHandoff2(inPipeTheirSide.get(),
+                                                        outPipeTheirSide.get(),
+                                                        signalPipeTheirSide.get(),
+                                                        refHandle.get(),
+                                                        serverProcess,
+                                                        clientProcess.get(),
+                                                        outputRing->SectionHandle(),
+                                                        outputRing->DataReadyHandle(),
+                                                        outputRing->SpaceFreeHandle(),
+                                                        terminalProcess.addressof()));
+
+        // Watching the terminal process keeps a writer that's blocked on a
+        // full ring from hanging forever if the terminal dies without
+        // closing its side - the pipe transport got ERROR_BROKEN_PIPE from
+        // the kernel in that case, and the ring has to synthesize it.
+        outputRing->SetPeerProcess(terminalProcess.get());
+
+        // Park the producer side for VtIo to hand to the render engine.
+        g.handoffOutputRing = std::move(outputRing);
+    }
+    else
+    {
+        RETURN_IF_FAILED(handoff->EstablishPtyHandoff(inPipeTheirSide.get(),
+                                                      outPipeTheirSide.get(),
+                                                      signalPipeTheirSide.get(),
+                                                      refHandle.get(),
+                                                      serverProcess,
+                                                      clientProcess.get()));
+    }
 
     TraceLoggingWrite(g_hConhostV2EventTraceProvider,
                       "SrvInit_DelegateToTerminalSucceeded",
@@ -943,10 +1075,11 @@ DWORD WINAPI ConsoleIoThread(LPVOID lpParameter)
 {
     auto& globals = ServiceLocator::LocateGlobals();
 
-    CONSOLE_API_MSG ReceiveMsg;
-    ReceiveMsg._pApiRoutines = globals.api;
-    ReceiveMsg._pDeviceComm = globals.pDeviceComm;
-    PCONSOLE_API_MSG ReplyMsg = nullptr;
+    // The queue's reader thread keeps a driver read in flight while this thread
+    // services messages, so independent clients no longer serialize behind a
+    // strictly sequential read/service/reply cycle. Replies therefore go out
+    // through CompleteIo instead of piggybacking on the next read.
+    IoReadQueue readQueue{ globals.pDeviceComm };
 
     // If we were given a message on startup, process that in our context and then continue with the IO loop normally.
     if (lpParameter)
@@ -955,38 +1088,51 @@ DWORD WINAPI ConsoleIoThread(LPVOID lpParameter)
         // free the heap memory when we're done getting the important bits out of it below.
         std::unique_ptr<CONSOLE_API_MSG> capturedMessage{ static_cast<PCONSOLE_API_MSG>(lpParameter) };
 
-        ReceiveMsg = *capturedMessage.get();
-        ReceiveMsg._pApiRoutines = globals.api;
-        ReceiveMsg._pDeviceComm = globals.pDeviceComm;
-        IoSorter::ServiceIoOperation(&ReceiveMsg, &ReplyMsg);
+        CONSOLE_API_MSG connectMsg = *capturedMessage.get();
+        connectMsg._pApiRoutines = globals.api;
+        connectMsg._pDeviceComm = globals.pDeviceComm;
+        PCONSOLE_API_MSG connectReply = nullptr;
+        IoSorter::ServiceIoOperation(&connectMsg, &connectReply);
+        if (connectReply != nullptr)
+        {
+            LOG_IF_FAILED(connectReply->ReleaseMessageBuffers());
+            LOG_IF_FAILED(globals.pDeviceComm->CompleteIo(&connectReply->Complete));
+        }
     }
 
-    bool fShouldExit = false;
-    while (!fShouldExit)
+    for (;;)
     {
-        if (ReplyMsg != nullptr)
-        {
-            LOG_IF_FAILED(ReplyMsg->ReleaseMessageBuffers());
-        }
+        CONSOLE_API_MSG* ReceiveMsg;
 
         // TODO: 9115192 correct mixed NTSTATUS/HRESULT
-        HRESULT hr = ServiceLocator::LocateGlobals().pDeviceComm->ReadIo(ReplyMsg, &ReceiveMsg);
+        HRESULT hr = readQueue.Dequeue(&ReceiveMsg);
         if (FAILED(hr))
         {
             if (hr == HRESULT_FROM_WIN32(ERROR_PIPE_NOT_CONNECTED))
             {
-                fShouldExit = true;
-
                 // This will not return. Terminate immediately when disconnected.
                 ServiceLocator::RundownAndExit(STATUS_SUCCESS);
             }
             RIPMSG1(RIP_WARNING, "DeviceIoControl failed with Result 0x%x", hr);
-            ReplyMsg = nullptr;
             continue;
         }
-        ReceiveMsg._pApiRoutines = globals.api;
-        IoSorter::ServiceIoOperation(&ReceiveMsg, &ReplyMsg);
-    }
 
-    return 0;
+        ReceiveMsg->_pApiRoutines = globals.api;
+        ReceiveMsg->_pDeviceComm = globals.pDeviceComm;
+        PCONSOLE_API_MSG ReplyMsg = nullptr;
+        IoSorter::ServiceIoOperation(ReceiveMsg, &ReplyMsg);
+
+        if (ReplyMsg != nullptr)
+        {
+            // Any buffered output has to reach the driver before the completion
+            // unblocks the client - the same order the old loop got by releasing
+            // buffers ahead of the read that carried the completion.
+            LOG_IF_FAILED(ReplyMsg->ReleaseMessageBuffers());
+            LOG_IF_FAILED(globals.pDeviceComm->CompleteIo(&ReplyMsg->Complete));
+        }
+
+        // Pended messages were copied by their wait block, so the buffer can go
+        // back to the reader either way.
+        readQueue.Recycle(ReceiveMsg);
+    }
 }
@@ -4,12 +4,14 @@
 #include "precomp.h"
 
 #include <Intsafe.h>
+#include <evntrace.h> // for EVENT_CONTROL_CODE_*
 #include "Shlwapi.h"
 #include "telemetry.hpp"
 #include <ctime>
 
 #include "history.h"
 
+#include "../inc/ConsolePerfCounters.h"
 #include "../interactivity/inc/ServiceLocator.hpp"
 
 TRACELOGGING_DEFINE_PROVIDER(g_hConhostV2EventTraceProvider,
@@ -55,7 +57,9 @@ Telemetry::Telemetry() :
     _uiQuickEditPasteRawUsed(0)
 {
     time(&_tStartedAt);
-    TraceLoggingRegister(g_hConhostV2EventTraceProvider);
+    // Register with an enable callback so a trace session that attaches to a
+    // long-running console can still pull a performance counter rundown.
+    TraceLoggingRegisterEx(g_hConhostV2EventTraceProvider, s_EtwEnableCallback, nullptr);
     TraceLoggingWriteStart(_activity, "ActivityStart");
     // initialize wil tracelogging
     wil::SetResultLoggingCallback(&Tracing::TraceFailure);
@@ -64,10 +68,74 @@ Telemetry::Telemetry() :
 
 Telemetry::~Telemetry()
 {
+    // Emit a final counter snapshot so a session that ran for the process's
+    // whole life ends with the totals, then stop the activity.
+    WritePerfCounterRundown();
     TraceLoggingWriteStop(_activity, "ActivityStop");
     TraceLoggingUnregister(g_hConhostV2EventTraceProvider);
 }
 
+void Telemetry::WritePerfCounterRundown() noexcept
+{
+    const auto& counters = Microsoft::Console::PerfCounters::Instance();
+
+    LARGE_INTEGER qpcFrequency;
+    QueryPerformanceFrequency(&qpcFrequency);
+
+    const auto& latency = counters.inputToPresentLatency;
+    const auto latencySamples = latency.totalSamples.load(std::memory_order_relaxed);
+    const auto latencyTotalUs = latency.totalMicroseconds.load(std::memory_order_relaxed);
+    std::array<uint64_t, Microsoft::Console::LatencyHistogram::BucketCount> latencyBuckets;
+    for (size_t i = 0; i < latencyBuckets.size(); ++i)
+    {
+        latencyBuckets[i] = latency.buckets[i].load(std::memory_order_relaxed);
+    }
+
+    TraceLoggingWrite(g_hConhostV2EventTraceProvider,
+                      "PerfCounterRundown",
+                      TraceLoggingUInt64(counters.bytesIngested.load(std::memory_order_relaxed), "BytesIngested"),
+                      TraceLoggingUInt64(counters.sequencesDispatched.load(std::memory_order_relaxed), "SequencesDispatched"),
+                      TraceLoggingUInt64(counters.framesPainted.load(std::memory_order_relaxed), "FramesPainted"),
+                      TraceLoggingUInt64(counters.lockAcquisitions.load(std::memory_order_relaxed), "LockAcquisitions"),
+                      TraceLoggingUInt64(counters.lockWaitTicks.load(std::memory_order_relaxed), "LockWaitTicks"),
+                      TraceLoggingUInt64(counters.lockHoldTicks.load(std::memory_order_relaxed), "LockHoldTicks"),
+                      TraceLoggingUInt64(counters.bufferAllocations.bytes.load(std::memory_order_relaxed), "BufferMemoryBytes"),
+                      TraceLoggingUInt64(counters.bufferAllocations.allocations.load(std::memory_order_relaxed), "BufferAllocCount"),
+                      TraceLoggingUInt64(counters.bufferAllocations.highWaterBytes.load(std::memory_order_relaxed), "BufferHighWaterBytes"),
+                      TraceLoggingUInt64(counters.rendererAllocations.bytes.load(std::memory_order_relaxed), "RendererMemoryBytes"),
+                      TraceLoggingUInt64(counters.rendererAllocations.allocations.load(std::memory_order_relaxed), "RendererAllocCount"),
+                      TraceLoggingUInt64(counters.rendererAllocations.highWaterBytes.load(std::memory_order_relaxed), "RendererHighWaterBytes"),
+                      TraceLoggingUInt64(counters.inputAllocations.bytes.load(std::memory_order_relaxed), "InputMemoryBytes"),
+                      TraceLoggingUInt64(counters.inputAllocations.allocations.load(std::memory_order_relaxed), "InputAllocCount"),
+                      TraceLoggingUInt64(counters.inputAllocations.highWaterBytes.load(std::memory_order_relaxed), "InputHighWaterBytes"),
+                      TraceLoggingUInt64(latencySamples, "InputLatencySamples"),
+                      TraceLoggingUInt64(latencySamples > 0 ? latencyTotalUs / latencySamples : 0, "InputLatencyMeanUs"),
+                      TraceLoggingUInt64(latency.EstimatePercentile(50.0), "InputLatencyP50Us"),
+                      TraceLoggingUInt64(latency.EstimatePercentile(90.0), "InputLatencyP90Us"),
+                      TraceLoggingUInt64(latency.EstimatePercentile(99.0), "InputLatencyP99Us"),
+                      TraceLoggingUInt64(latency.maxMicroseconds.load(std::memory_order_relaxed), "InputLatencyMaxUs"),
+                      TraceLoggingUInt64Array(latencyBuckets.data(), gsl::narrow_cast<UINT16>(latencyBuckets.size()), "InputLatencyLog2Buckets"),
+                      TraceLoggingInt64(qpcFrequency.QuadPart, "QpcFrequency"),
+                      TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
+                      TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance));
+}
+
+void NTAPI Telemetry::s_EtwEnableCallback(_In_ LPCGUID /*sourceId*/,
+                                          _In_ ULONG isEnabled,
+                                          _In_ UCHAR /*level*/,
+                                          _In_ ULONGLONG /*matchAnyKeyword*/,
+                                          _In_ ULONGLONG /*matchAllKeywords*/,
+                                          _In_opt_ PEVENT_FILTER_DESCRIPTOR /*filterData*/,
+                                          _In_opt_ PVOID /*callbackContext*/) noexcept
+{
+    // A rundown is due both when a session first enables the provider and
+    // when an already-attached session explicitly asks for one.
+    if (isEnabled == EVENT_CONTROL_CODE_ENABLE_PROVIDER || isEnabled == EVENT_CONTROL_CODE_CAPTURE_STATE)
+    {
+        WritePerfCounterRundown();
+    }
+}
+
 void Telemetry::SetUserInteractive()
 {
     _fUserInteractiveForTelemetry = true;
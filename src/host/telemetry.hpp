@@ -28,6 +28,13 @@ public:
         return s_Instance;
     }
 
+    // Writes a snapshot of the process-wide hot-path performance counters
+    // (see ConsolePerfCounters.h) to the provider. Fired automatically when
+    // a trace session enables the provider or requests a capture-state
+    // rundown, so `tracelog -capturestate` can read the live values at any
+    // point in the process's life without instrumenting anything.
+    static void WritePerfCounterRundown() noexcept;
+
     void SetUserInteractive();
     void SetWindowSizeChanged();
     void SetContextMenuUsed();
@@ -135,6 +142,14 @@ private:
     bool FindProcessName(const WCHAR* pszProcessName, _Out_ size_t* iPosition) const;
     void TotalCodesForPreviousProcess();
 
+    static void NTAPI s_EtwEnableCallback(_In_ LPCGUID sourceId,
+                                          _In_ ULONG isEnabled,
+                                          _In_ UCHAR level,
+                                          _In_ ULONGLONG matchAnyKeyword,
+                                          _In_ ULONGLONG matchAllKeywords,
+                                          _In_opt_ PEVENT_FILTER_DESCRIPTOR filterData,
+                                          _In_opt_ PVOID callbackContext) noexcept;
+
     static const int c_iMaxProcessesConnected = 100;
 
     TraceLoggingActivity<g_hConhostV2EventTraceProvider> _activity;
@@ -62,6 +62,52 @@ class CodepointWidthDetectorTests
         }
     }
 
+    TEST_METHOD(CanGetWidthsAtRangeBoundaries)
+    {
+        // The generated two-level table must agree with the range data right
+        // at the edges of the ranges, where a generation bug would bite.
+        CodepointWidthDetector widthDetector;
+        VERIFY_ARE_EQUAL(CodepointWidth::Narrow, widthDetector.GetWidth(L"\xa0")); // just before the first table entry
+        VERIFY_ARE_EQUAL(CodepointWidth::Ambiguous, widthDetector.GetWidth(L"\xa1")); // first table entry
+        VERIFY_ARE_EQUAL(CodepointWidth::Wide, widthDetector.GetWidth(L"\x1100")); // first hangul codepoint
+        VERIFY_ARE_EQUAL(CodepointWidth::Wide, widthDetector.GetWidth(L"\x115f")); // last hangul codepoint
+        VERIFY_ARE_EQUAL(CodepointWidth::Narrow, widthDetector.GetWidth(L"\x1160")); // just past the hangul range
+        VERIFY_ARE_EQUAL(CodepointWidth::Narrow, widthDetector.GetWidth(L"\x2500")); // box drawing, overridden narrow
+        VERIFY_ARE_EQUAL(CodepointWidth::Wide, widthDetector.GetWidth(L"\x4e00")); // CJK unified ideographs
+        VERIFY_ARE_EQUAL(CodepointWidth::Ambiguous, widthDetector.GetWidth(L"\xDBFF\xDFFD")); // U+10FFFD, last table entry
+    }
+
+    TEST_METHOD(CanMeasureColumns)
+    {
+        CodepointWidthDetector widthDetector;
+
+        VERIFY_ARE_EQUAL(0u, widthDetector.MeasureColumns({}));
+        VERIFY_ARE_EQUAL(5u, widthDetector.MeasureColumns(L"hello"));
+
+        // Narrow ASCII + one wide CJK + one wide surrogate pair emoji.
+        std::wstring text = L"ab";
+        text += L"\x306A"; // U+306A hiragana na, wide
+        text += emoji; // U+1F922, wide
+        VERIFY_ARE_EQUAL(2u + 2u + 2u, widthDetector.MeasureColumns(text));
+
+        // Without a fallback, ambiguous codepoints count as narrow,
+        // matching what IsWide would conclude per glyph.
+        VERIFY_ARE_EQUAL(1u, widthDetector.MeasureColumns(ambiguous));
+    }
+
+    TEST_METHOD(MeasureColumnsMatchesGetWidth)
+    {
+        // The bulk path must agree with the per-glyph path for every BMP codepoint.
+        const WEX::TestExecution::SetVerifyOutput verifySettings(WEX::TestExecution::VerifyOutputSettings::LogOnlyFailures);
+        CodepointWidthDetector widthDetector;
+        for (wchar_t wch = 0x20; wch < 0xd800; ++wch)
+        {
+            const std::wstring_view glyph{ &wch, 1 };
+            const size_t expected = widthDetector.GetWidth(glyph) == CodepointWidth::Wide ? 2 : 1;
+            VERIFY_ARE_EQUAL(expected, widthDetector.MeasureColumns(glyph));
+        }
+    }
+
     static bool FallbackMethod(const std::wstring_view glyph)
     {
         if (glyph.size() < 1)
@@ -89,13 +135,36 @@ class CodepointWidthDetectorTests
         // Cache should hold it.
         VERIFY_ARE_EQUAL(1u, widthDetector._fallbackCache.size());
 
-        // Cached item should match what we expect
+        // Cached item should match what we expect: the codepoint and the
+        // width the fallback reported for it.
         const auto it = widthDetector._fallbackCache.begin();
-        VERIFY_ARE_EQUAL(ambiguous, it->first);
+        VERIFY_ARE_EQUAL(0x414u, it->first);
         VERIFY_ARE_EQUAL(FallbackMethod(ambiguous), it->second);
 
         // Cache should empty when font changes.
         widthDetector.NotifyFontChanged();
         VERIFY_ARE_EQUAL(0u, widthDetector._fallbackCache.size());
     }
+
+    TEST_METHOD(FallbackMeasuresEachGlyphOncePerFont)
+    {
+        CodepointWidthDetector widthDetector;
+        size_t calls = 0;
+        widthDetector.SetFallbackMethod([&](const std::wstring_view) {
+            ++calls;
+            return true;
+        });
+
+        // Repeat appearances of the same glyph must hit the cache.
+        for (auto i = 0; i < 5; ++i)
+        {
+            VERIFY_IS_TRUE(widthDetector.IsWide(ambiguous));
+        }
+        VERIFY_ARE_EQUAL(1u, calls);
+
+        // A font change invalidates the measurements.
+        widthDetector.NotifyFontChanged();
+        VERIFY_IS_TRUE(widthDetector.IsWide(ambiguous));
+        VERIFY_ARE_EQUAL(2u, calls);
+    }
 };
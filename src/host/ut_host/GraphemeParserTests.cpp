@@ -0,0 +1,137 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include "WexTestClass.h"
+#include "../../inc/consoletaeftemplates.hpp"
+
+#include "../../types/inc/GraphemeParser.hpp"
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+static const std::wstring CombiningE = L"e\x0301"; // e + combining acute accent
+static const std::wstring WavingHand = L"\xD83D\xDC4B"; // waving hand sign
+static const std::wstring SkinTone = L"\xD83C\xDFFB"; // emoji modifier fitzpatrick type-1-2
+static const std::wstring Zwj = L"\x200D"; // zero width joiner
+static const std::wstring Man = L"\xD83D\xDC68"; // man emoji
+static const std::wstring Woman = L"\xD83D\xDC69"; // woman emoji
+static const std::wstring Girl = L"\xD83D\xDC67"; // girl emoji
+static const std::wstring RegionalU = L"\xD83C\xDDFA"; // regional indicator symbol letter u
+static const std::wstring RegionalS = L"\xD83C\xDDF8"; // regional indicator symbol letter s
+
+class GraphemeParserTests
+{
+    TEST_CLASS(GraphemeParserTests);
+
+    // Helper that parses the text and verifies the expected cluster views come back.
+    static void _verifyClusters(const std::wstring_view text, const std::vector<std::wstring>& expected)
+    {
+        std::vector<std::wstring_view> clusters;
+        GraphemeParser::ParseInto(text, clusters);
+
+        VERIFY_ARE_EQUAL(expected.size(), clusters.size());
+        for (size_t i = 0; i < clusters.size(); ++i)
+        {
+            VERIFY_ARE_EQUAL(std::wstring_view{ expected.at(i) }, clusters.at(i));
+        }
+    }
+
+    TEST_METHOD(PlainTextBreaksEverywhere)
+    {
+        _verifyClusters(L"abc", { L"a", L"b", L"c" });
+        _verifyClusters(L"", {});
+    }
+
+    TEST_METHOD(CombiningMarksAttachToBase)
+    {
+        _verifyClusters(CombiningE + L"x", { CombiningE, L"x" });
+
+        // Multiple marks all stay with the base.
+        _verifyClusters(L"a\x0301\x0308", { L"a\x0301\x0308" });
+    }
+
+    TEST_METHOD(CrLfStaysTogether)
+    {
+        _verifyClusters(L"a\r\nb", { L"a", L"\r\n", L"b" });
+
+        // ...but LF followed by CR is two clusters.
+        _verifyClusters(L"\n\r", { L"\n", L"\r" });
+    }
+
+    TEST_METHOD(ControlsBreakCombiningSequences)
+    {
+        // A combining mark after a control character cannot attach to it.
+        _verifyClusters(L"e\x0301\a\x0301", { CombiningE, L"\a", L"\x0301" });
+    }
+
+    TEST_METHOD(HangulComposes)
+    {
+        // L V T jamo form one cluster.
+        _verifyClusters(L"\x1100\x1161\x11A8", { L"\x1100\x1161\x11A8" });
+
+        // A trailing jamo attaches to a precomposed LV syllable...
+        _verifyClusters(L"\xAC00\x11A8", { L"\xAC00\x11A8" });
+
+        // ...but a vowel jamo can't attach to a precomposed LVT syllable.
+        _verifyClusters(L"\xAC01\x1161", { L"\xAC01", L"\x1161" });
+    }
+
+    TEST_METHOD(EmojiModifiersAttach)
+    {
+        _verifyClusters(WavingHand + SkinTone + L"x", { WavingHand + SkinTone, L"x" });
+    }
+
+    TEST_METHOD(ZwjSequencesStayTogether)
+    {
+        // The family emoji (man, woman, girl joined by ZWJ) is a single cluster.
+        const auto family = Man + Zwj + Woman + Zwj + Girl;
+        _verifyClusters(family + L"x", { family, L"x" });
+
+        // A ZWJ after a non-pictograph extends it, but doesn't glue on the
+        // pictograph that follows.
+        _verifyClusters(L"a" + Zwj + Man, { L"a" + Zwj, Man });
+    }
+
+    TEST_METHOD(RegionalIndicatorsPairUp)
+    {
+        // Two regional indicators form a flag; a third starts the next one.
+        _verifyClusters(RegionalU + RegionalS + RegionalU, { RegionalU + RegionalS, RegionalU });
+        _verifyClusters(RegionalU + RegionalS + RegionalU + RegionalS, { RegionalU + RegionalS, RegionalU + RegionalS });
+    }
+
+    TEST_METHOD(UnpairedSurrogatesBreak)
+    {
+        // A stray lead surrogate is its own (garbage) cluster.
+        std::wstring wstr = L"a";
+        wstr += Man.at(0);
+        wstr += L"b";
+        _verifyClusters(wstr, { L"a", std::wstring{ Man.at(0) }, L"b" });
+    }
+
+    TEST_METHOD(NextBoundaryWalksClusters)
+    {
+        const auto text = Man + Zwj + Woman + L"x";
+        VERIFY_ARE_EQUAL(5u, GraphemeParser::NextBoundary(text, 0));
+        VERIFY_ARE_EQUAL(6u, GraphemeParser::NextBoundary(text, 5));
+
+        // Out of range offsets clamp to the end so callers can loop on it.
+        VERIFY_ARE_EQUAL(text.size(), GraphemeParser::NextBoundary(text, 100));
+
+        VERIFY_ARE_EQUAL(std::wstring_view{ text }.substr(0, 5), GraphemeParser::ParseNext(text));
+    }
+
+    TEST_METHOD(ParseIntoReusesBuffer)
+    {
+        std::vector<std::wstring_view> clusters;
+        GraphemeParser::ParseInto(L"hello", clusters);
+        VERIFY_ARE_EQUAL(5u, clusters.size());
+
+        GraphemeParser::ParseInto(L"hi", clusters);
+        VERIFY_ARE_EQUAL(2u, clusters.size());
+
+        GraphemeParser::ParseInto({}, clusters);
+        VERIFY_ARE_EQUAL(0u, clusters.size());
+    }
+};
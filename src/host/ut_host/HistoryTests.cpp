@@ -242,6 +242,69 @@ class HistoryTests
         VERIFY_ARE_EQUAL(2ul, history->GetNumberOfCommands());
     }
 
+    TEST_METHOD(PrefixMatchesReturnsNewestFirst)
+    {
+        auto history = CommandHistory::s_Allocate(_manyApps[0], _MakeHandle(0));
+        VERIFY_IS_NOT_NULL(history);
+
+        VERIFY_SUCCEEDED(history->Add(L"dir /w", false));
+        VERIFY_SUCCEEDED(history->Add(L"cd ..", false));
+        VERIFY_SUCCEEDED(history->Add(L"dir", false));
+        VERIFY_SUCCEEDED(history->Add(L"cls", false));
+
+        const auto matches = history->PrefixMatches(L"dir");
+        VERIFY_ARE_EQUAL(2ul, matches.size());
+        VERIFY_ARE_EQUAL(String(L"dir"), String(history->GetNth(matches[0]).data()));
+        VERIFY_ARE_EQUAL(String(L"dir /w"), String(history->GetNth(matches[1]).data()));
+
+        // an empty prefix matches everything
+        VERIFY_ARE_EQUAL(4ul, history->PrefixMatches(L"").size());
+        // and a miss matches nothing
+        VERIFY_ARE_EQUAL(0ul, history->PrefixMatches(L"mkdir").size());
+    }
+
+    TEST_METHOD(PrefixMatchesTracksMutations)
+    {
+        auto history = CommandHistory::s_Allocate(_manyApps[0], _MakeHandle(0));
+        VERIFY_IS_NOT_NULL(history);
+
+        VERIFY_SUCCEEDED(history->Add(L"dir /w", false));
+        VERIFY_SUCCEEDED(history->Add(L"dir", false));
+        VERIFY_ARE_EQUAL(2ul, history->PrefixMatches(L"dir").size());
+
+        // removing a command must fall out of the matches
+        history->Remove(1);
+        const auto matches = history->PrefixMatches(L"dir");
+        VERIFY_ARE_EQUAL(1ul, matches.size());
+        VERIFY_ARE_EQUAL(String(L"dir /w"), String(history->GetNth(matches[0]).data()));
+
+        history->Empty();
+        VERIFY_ARE_EQUAL(0ul, history->PrefixMatches(L"dir").size());
+    }
+
+    TEST_METHOD(FindMatchingCommandFindsNearestPrevious)
+    {
+        auto history = CommandHistory::s_Allocate(_manyApps[0], _MakeHandle(0));
+        VERIFY_IS_NOT_NULL(history);
+
+        VERIFY_SUCCEEDED(history->Add(L"dir /w", false));
+        VERIFY_SUCCEEDED(history->Add(L"cd ..", false));
+        VERIFY_SUCCEEDED(history->Add(L"dir", false));
+
+        // searching backwards from the end should hit "dir" (index 2) first,
+        // then wrap around to "dir /w" (index 0).
+        SHORT index;
+        VERIFY_IS_TRUE(history->FindMatchingCommand(L"dir", 2, index, CommandHistory::MatchOptions::JustLooking));
+        VERIFY_ARE_EQUAL(gsl::narrow<SHORT>(0), index);
+        VERIFY_IS_TRUE(history->FindMatchingCommand(L"dir", 0, index, CommandHistory::MatchOptions::JustLooking));
+        VERIFY_ARE_EQUAL(gsl::narrow<SHORT>(2), index);
+
+        // exact matching must not treat a prefix as a hit
+        VERIFY_IS_TRUE(history->FindMatchingCommand(L"dir /w", 2, index, CommandHistory::MatchOptions::ExactMatch | CommandHistory::MatchOptions::JustLooking));
+        VERIFY_ARE_EQUAL(gsl::narrow<SHORT>(0), index);
+        VERIFY_IS_FALSE(history->FindMatchingCommand(L"dir /", 2, index, CommandHistory::MatchOptions::ExactMatch | CommandHistory::MatchOptions::JustLooking));
+    }
+
 private:
     const std::array<std::wstring, 5> _manyApps = {
         L"foo.exe",
@@ -135,6 +135,7 @@ class ScreenBufferTests
     TEST_METHOD(ResizeCursorUnchanged);
 
     TEST_METHOD(ResizeAltBuffer);
+    TEST_METHOD(DeferredWindowResizeAppliesFinalSizeOnce);
 
     TEST_METHOD(ResizeAltBufferGetScreenBufferInfo);
 
@@ -231,6 +232,8 @@ class ScreenBufferTests
     TEST_METHOD(TestReflowEndOfLineColor);
     TEST_METHOD(TestReflowSmallerLongLineWithColor);
     TEST_METHOD(TestReflowBiggerLongLineWithColor);
+
+    TEST_METHOD(ApiSnapshotPublishesHotState);
 };
 
 void ScreenBufferTests::SingleAlternateBufferCreationTest()
@@ -6517,3 +6520,65 @@ void ScreenBufferTests::TestReflowBiggerLongLineWithColor()
     Log::Comment(L"========== Checking the buffer state (after) ==========");
     verifyBuffer(si.GetTextBuffer(), til::rect{ si.GetViewport().ToInclusive() }, false);
 }
+
+void ScreenBufferTests::ApiSnapshotPublishesHotState()
+{
+    auto& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+    auto& si = gci.GetActiveOutputBuffer().GetActiveBuffer();
+    auto& cursor = si.GetTextBuffer().GetCursor();
+
+    Log::Comment(L"Move the cursor somewhere recognizable and publish.");
+    cursor.SetPosition({ 12, 3 });
+    si.PublishApiSnapshot();
+
+    SCREEN_INFORMATION::ApiSnapshot snapshot{};
+    VERIFY_IS_TRUE(si.TryGetApiSnapshot(snapshot));
+    VERIFY_ARE_EQUAL(si.GetBufferSize().Dimensions(), snapshot.size);
+    VERIFY_ARE_EQUAL(COORD({ 12, 3 }), snapshot.cursorPosition);
+    VERIFY_ARE_EQUAL(si.GetViewport().ToInclusive(), snapshot.window);
+    VERIFY_ARE_EQUAL(si.GetAttributes().GetLegacyAttributes(), snapshot.attributes);
+    VERIFY_ARE_EQUAL(cursor.GetSize(), snapshot.cursorSize);
+    VERIFY_ARE_EQUAL(cursor.IsVisible(), snapshot.cursorVisible);
+
+    Log::Comment(L"Mutate the state and republish; readers must see the update.");
+    cursor.SetPosition({ 1, 1 });
+    si.PublishApiSnapshot();
+
+    VERIFY_IS_TRUE(si.TryGetApiSnapshot(snapshot));
+    VERIFY_ARE_EQUAL(COORD({ 1, 1 }), snapshot.cursorPosition);
+}
+
+void ScreenBufferTests::DeferredWindowResizeAppliesFinalSizeOnce()
+{
+    CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+    gci.LockConsole(); // Lock must be taken to manipulate buffer.
+    auto unlock = wil::scope_exit([&] { gci.UnlockConsole(); });
+
+    auto& si = gci.GetActiveOutputBuffer();
+    const COORD coordFontSize = si.GetScreenFontSize();
+    const COORD originalBufferSize = si.GetBufferSize().Dimensions();
+    const COORD originalViewSize = si.GetViewport().Dimensions();
+
+    // ProcessResizeWindow works on rects in screen _pixel_ dimensions, not
+    // character sizes.
+    RECT originalClientRect{ 0 }, grownClientRect{ 0 };
+    originalClientRect.right = originalViewSize.X * coordFontSize.X;
+    originalClientRect.bottom = originalViewSize.Y * coordFontSize.Y;
+    grownClientRect.right = (originalViewSize.X + 10) * coordFontSize.X;
+    grownClientRect.bottom = (originalViewSize.Y + 5) * coordFontSize.Y;
+
+    Log::Comment(L"While a drag is in progress, resizes must not touch the buffer.");
+    si.BeginDeferredWindowResize();
+    si.ProcessResizeWindow(&grownClientRect, &originalClientRect);
+    VERIFY_ARE_EQUAL(originalBufferSize, si.GetBufferSize().Dimensions());
+
+    Log::Comment(L"Ending the drag applies the captured size in one shot.");
+    si.EndDeferredWindowResize();
+    const COORD settledBufferSize = si.GetBufferSize().Dimensions();
+    const COORD settledViewSize = si.GetViewport().Dimensions();
+
+    Log::Comment(L"The deferred result must match what a live resize would have produced.");
+    si.ProcessResizeWindow(&grownClientRect, &originalClientRect);
+    VERIFY_ARE_EQUAL(settledBufferSize, si.GetBufferSize().Dimensions());
+    VERIFY_ARE_EQUAL(settledViewSize, si.GetViewport().Dimensions());
+}
@@ -141,6 +141,13 @@ class TextBufferTests
     TEST_METHOD(ResizeTraditionalRotationPreservesHighUnicode);
     TEST_METHOD(ScrollBufferRotationPreservesHighUnicode);
 
+    TEST_METHOD(CopyRectMovesCellsAndAttributes);
+    TEST_METHOD(CopyRectOverlappingSameRow);
+
+    TEST_METHOD(ScrollRowsInCircledBuffer);
+
+    TEST_METHOD(CompressedRowRoundTrip);
+
     TEST_METHOD(ResizeTraditionalHighUnicodeRowRemoval);
     TEST_METHOD(ResizeTraditionalHighUnicodeColumnRemoval);
 
@@ -1923,8 +1930,203 @@ void TextBufferTests::ScrollBufferRotationPreservesHighUnicode()
     VERIFY_ARE_EQUAL(String(fire), String(shouldBeFireText.data(), gsl::narrow<int>(shouldBeFireText.size())));
 }
 
+// This tests that the bulk rectangle copy moves text, color attributes and
+// overflow-stored glyphs to the target rectangle while leaving the source intact.
+void TextBufferTests::CopyRectMovesCellsAndAttributes()
+{
+    // Set up a text buffer for us
+    const COORD bufferSize{ 80, 10 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, false, _renderer);
+
+    // Write a recognizable run in a color distinct from the buffer default.
+    const COORD sourcePos{ 10, 2 };
+    const TextAttribute red{ FOREGROUND_RED };
+    _buffer->Write(OutputCellIterator(std::wstring_view{ L"ABCDE" }, red), sourcePos);
+
+    // Follow it with a glyph long enough to hit the overflow side storage.
+    // This is the fire emoji: 🔥
+    const auto fire = L"\xD83D\xDD25";
+    _buffer->_storage[sourcePos.Y].GetCharRow().GlyphAt(15) = fire;
+
+    // Copy the whole run (5 narrow cells + the emoji cell) somewhere else.
+    const COORD targetPos{ 40, 5 };
+    _buffer->CopyRect(Viewport::FromDimensions(sourcePos, { 7, 1 }), targetPos);
+
+    // The text and colors should have arrived at the target...
+    const auto copiedText = *_buffer->GetTextDataAt({ 40, 5 });
+    VERIFY_ARE_EQUAL(String(L"A"), String(copiedText.data(), gsl::narrow<int>(copiedText.size())));
+    const auto copiedEmoji = *_buffer->GetTextDataAt({ 45, 5 });
+    VERIFY_ARE_EQUAL(String(fire), String(copiedEmoji.data(), gsl::narrow<int>(copiedEmoji.size())));
+    VERIFY_ARE_EQUAL(red, _buffer->_storage[targetPos.Y].GetAttrRow().GetAttrByColumn(44));
+
+    // ...and the source should be untouched.
+    const auto sourceText = *_buffer->GetTextDataAt({ 14, 2 });
+    VERIFY_ARE_EQUAL(String(L"E"), String(sourceText.data(), gsl::narrow<int>(sourceText.size())));
+    const auto sourceEmoji = *_buffer->GetTextDataAt({ 15, 2 });
+    VERIFY_ARE_EQUAL(String(fire), String(sourceEmoji.data(), gsl::narrow<int>(sourceEmoji.size())));
+    VERIFY_ARE_EQUAL(red, _buffer->_storage[sourcePos.Y].GetAttrRow().GetAttrByColumn(12));
+}
+
+// This tests that an overlapping copy within a single row behaves like memmove:
+// every target cell receives the original source contents.
+void TextBufferTests::CopyRectOverlappingSameRow()
+{
+    // Set up a text buffer for us
+    const COORD bufferSize{ 80, 10 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, false, _renderer);
+
+    const COORD sourcePos{ 10, 3 };
+    _buffer->Write(OutputCellIterator(std::wstring_view{ L"123456" }, attr), sourcePos);
+
+    // Shift the run two cells to the right; the ranges overlap by four cells.
+    _buffer->CopyRect(Viewport::FromDimensions(sourcePos, { 6, 1 }), { 12, 3 });
+
+    const std::wstring expected = L"12123456";
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        const auto cellText = *_buffer->GetTextDataAt({ gsl::narrow<SHORT>(10 + i), 3 });
+        VERIFY_ARE_EQUAL(String(&expected.at(i), 1), String(cellText.data(), gsl::narrow<int>(cellText.size())));
+    }
+}
+
+// This tests that scrolling a region of a circled buffer rotates only the
+// affected rows in place instead of straightening out the whole buffer first,
+// and that row IDs and the search text cache follow the rows to their new slots.
+void TextBufferTests::ScrollRowsInCircledBuffer()
+{
+    // Set up a text buffer for us
+    const COORD bufferSize{ 80, 10 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, false, _renderer);
+
+    // Pretend the buffer has circled so the first logical row sits mid-storage.
+    _buffer->_firstRow = 4;
+
+    // Tag every logical row with a distinct letter.
+    for (SHORT y = 0; y < bufferSize.Y; ++y)
+    {
+        const wchar_t letter = gsl::narrow<wchar_t>(L'A' + y);
+        _buffer->Write(OutputCellIterator(std::wstring_view{ &letter, 1 }, attr), { 0, y });
+    }
+
+    // Prime the search text cache so we can check the scroll invalidates it.
+    VERIFY_ARE_EQUAL(L'C', _buffer->GetRowSearchText(2).at(0));
+
+    // Move rows 2..4 up two slots; rows 0 and 1 land below them. The affected
+    // span occupies contiguous storage, so this takes the in-place fast path.
+    _buffer->ScrollRows(2, 3, -2);
+
+    const std::wstring expected = L"CDEABFGHIJ";
+    for (SHORT y = 0; y < bufferSize.Y; ++y)
+    {
+        const auto cellText = *_buffer->GetTextDataAt({ 0, y });
+        VERIFY_ARE_EQUAL(String(&expected.at(y), 1), String(cellText.data(), gsl::narrow<int>(cellText.size())));
+        VERIFY_ARE_EQUAL(expected.at(y), _buffer->GetRowSearchText(y).at(0));
+    }
+
+    // The circular buffer should not have been straightened out...
+    VERIFY_ARE_EQUAL(4, _buffer->GetFirstRowIndex());
+
+    // ...and every row's ID should match its physical slot again.
+    for (SHORT y = 0; y < bufferSize.Y; ++y)
+    {
+        VERIFY_ARE_EQUAL(gsl::narrow<SHORT>((4 + y) % bufferSize.Y), _buffer->GetRowByOffset(y).GetId());
+    }
+
+    // Now scroll a span that wraps around the physical seam; this has to fall
+    // back to straightening out the buffer before rotating.
+    _buffer->ScrollRows(5, 4, 1);
+
+    const std::wstring expectedWrapped = L"CDEABJFGHI";
+    for (SHORT y = 0; y < bufferSize.Y; ++y)
+    {
+        const auto cellText = *_buffer->GetTextDataAt({ 0, y });
+        VERIFY_ARE_EQUAL(String(&expectedWrapped.at(y), 1), String(cellText.data(), gsl::narrow<int>(cellText.size())));
+        VERIFY_ARE_EQUAL(expectedWrapped.at(y), _buffer->GetRowSearchText(y).at(0));
+    }
+
+    VERIFY_ARE_EQUAL(0, _buffer->GetFirstRowIndex());
+}
+
+// This tests that packing a row into the cold-scrollback representation and
+// rehydrating it preserves the contents cell for cell: plain ASCII, wide
+// glyphs with their leading/trailing DBCS flags, and glyphs held in the
+// overflow side storage. A row holding an unpaired surrogate can't survive
+// the packed form's UTF-8 round trip, so it has to refuse to pack at all.
+void TextBufferTests::CompressedRowRoundTrip()
+{
+    // Set up a text buffer for us
+    const COORD bufferSize{ 80, 10 };
+    const UINT cursorSize = 12;
+    const TextAttribute attr{ 0x7f };
+    auto _buffer = std::make_unique<TextBuffer>(bufferSize, attr, cursorSize, false, _renderer);
+
+    // Row 0: plain ASCII in a color distinct from the buffer default.
+    const TextAttribute red{ FOREGROUND_RED };
+    _buffer->Write(OutputCellIterator(std::wstring_view{ L"Hello" }, red), { 0, 0 });
+
+    // Row 1: a wide glyph, flagging a leading and a trailing cell.
+    // This is hiragana letter no: の
+    const auto hiraganaNo = L"\x306E";
+    _buffer->Write(OutputCellIterator(std::wstring_view{ hiraganaNo }, red), { 4, 1 });
+
+    // Row 2: a glyph long enough to hit the overflow side storage.
+    // This is the fire emoji: 🔥
+    const auto fire = L"\xD83D\xDD25";
+    _buffer->_storage[2].GetCharRow().GlyphAt(7) = fire;
+
+    for (SHORT y = 0; y < 3; ++y)
+    {
+        auto& row = _buffer->_storage[y];
+        const auto& charRow = row.GetCharRow();
+
+        // Capture the expanded contents before packing.
+        const auto expectedText = charRow.GetText();
+        const std::vector<DbcsAttribute> expectedAttrs{ charRow.Attrs().begin(), charRow.Attrs().end() };
+
+        row.Compress();
+        VERIFY_IS_TRUE(row.IsCompressed(), L"The row should accept packing.");
+        row.Decompress();
+        VERIFY_IS_FALSE(row.IsCompressed(), L"The row should be expanded again.");
+
+        // Every cell should read back exactly as it was written.
+        const auto actualText = charRow.GetText();
+        VERIFY_ARE_EQUAL(String(expectedText.c_str()), String(actualText.c_str()));
+        for (size_t col = 0; col < charRow.size(); ++col)
+        {
+            VERIFY_IS_TRUE(expectedAttrs.at(col) == charRow.DbcsAttrAt(col), L"The DBCS flags should survive the round trip.");
+        }
+    }
+
+    // The wide glyph's halves and the overflow flag are worth calling out by name.
+    VERIFY_IS_TRUE(_buffer->_storage[1].GetCharRow().DbcsAttrAt(4).IsLeading());
+    VERIFY_IS_TRUE(_buffer->_storage[1].GetCharRow().DbcsAttrAt(5).IsTrailing());
+    VERIFY_IS_TRUE(_buffer->_storage[2].GetCharRow().DbcsAttrAt(7).IsGlyphStored());
+    const auto rehydratedEmoji = *_buffer->GetTextDataAt({ 7, 2 });
+    VERIFY_ARE_EQUAL(String(fire), String(rehydratedEmoji.data(), gsl::narrow<int>(rehydratedEmoji.size())));
+
+    // The color attributes aren't part of the packed payload; spot check that
+    // they're still intact anyway.
+    VERIFY_ARE_EQUAL(red, _buffer->_storage[0].GetAttrRow().GetAttrByColumn(2));
+
+    // Row 3: a lone high surrogate, which the columnar storage can hold but
+    // the packed UTF-8 form cannot. Packing must refuse and leave the row
+    // readable in place.
+    auto& surrogateRow = _buffer->_storage[3];
+    surrogateRow.GetCharRow().GlyphAt(5) = std::wstring_view{ L"\xD83D", 1 };
+    surrogateRow.Compress();
+    VERIFY_IS_FALSE(surrogateRow.IsCompressed(), L"A row with an unpaired surrogate should refuse to pack.");
+    const auto surrogateText = *_buffer->GetTextDataAt({ 5, 3 });
+    VERIFY_ARE_EQUAL(String(L"\xD83D"), String(surrogateText.data(), gsl::narrow<int>(surrogateText.size())));
+}
+
 // This tests that rows removed from the buffer while resizing traditionally will also drop the high unicode
-// characters from the Unicode Storage buffer
+// characters held in the rows' overflow storage
 void TextBufferTests::ResizeTraditionalHighUnicodeRowRemoval()
 {
     // Set up a text buffer for us
@@ -1948,18 +2150,25 @@ void TextBufferTests::ResizeTraditionalHighUnicodeRowRemoval()
     const auto readBackText = *readBack;
     VERIFY_ARE_EQUAL(String(emoji), String(readBackText.data(), gsl::narrow<int>(readBackText.size())));
 
-    VERIFY_ARE_EQUAL(1u, _buffer->GetUnicodeStorage()._map.size(), L"There should be one item in the map.");
+    VERIFY_IS_TRUE(_buffer->_storage[pos.Y].GetCharRow().DbcsAttrAt(pos.X).IsGlyphStored(), L"The cell should be marked as holding an overflow glyph.");
 
     // Perform resize to trim off the row of the buffer that included the emoji
     COORD trimmedBufferSize{ bufferSize.X, bufferSize.Y - 1 };
 
     VERIFY_NT_SUCCESS(_buffer->ResizeTraditional(trimmedBufferSize));
 
-    VERIFY_IS_TRUE(_buffer->GetUnicodeStorage()._map.empty(), L"The map should now be empty.");
+    for (const auto& row : _buffer->_storage)
+    {
+        const auto& charRow = row.GetCharRow();
+        for (size_t col = 0; col < charRow.size(); ++col)
+        {
+            VERIFY_IS_FALSE(charRow.DbcsAttrAt(col).IsGlyphStored(), L"No overflow glyphs should remain after the resize.");
+        }
+    }
 }
 
 // This tests that columns removed from the buffer while resizing traditionally will also drop the high unicode
-// characters from the Unicode Storage buffer
+// characters held in the rows' overflow storage
 void TextBufferTests::ResizeTraditionalHighUnicodeColumnRemoval()
 {
     // Set up a text buffer for us
@@ -1983,14 +2192,21 @@ void TextBufferTests::ResizeTraditionalHighUnicodeColumnRemoval()
     const auto readBackText = *readBack;
     VERIFY_ARE_EQUAL(String(emoji), String(readBackText.data(), gsl::narrow<int>(readBackText.size())));
 
-    VERIFY_ARE_EQUAL(1u, _buffer->GetUnicodeStorage()._map.size(), L"There should be one item in the map.");
+    VERIFY_IS_TRUE(_buffer->_storage[pos.Y].GetCharRow().DbcsAttrAt(pos.X).IsGlyphStored(), L"The cell should be marked as holding an overflow glyph.");
 
     // Perform resize to trim off the column of the buffer that included the emoji
     COORD trimmedBufferSize{ bufferSize.X - 1, bufferSize.Y };
 
     VERIFY_NT_SUCCESS(_buffer->ResizeTraditional(trimmedBufferSize));
 
-    VERIFY_IS_TRUE(_buffer->GetUnicodeStorage()._map.empty(), L"The map should now be empty.");
+    for (const auto& row : _buffer->_storage)
+    {
+        const auto& charRow = row.GetCharRow();
+        for (size_t col = 0; col < charRow.size(); ++col)
+        {
+            VERIFY_IS_FALSE(charRow.DbcsAttrAt(col).IsGlyphStored(), L"No overflow glyphs should remain after the resize.");
+        }
+    }
 }
 
 void TextBufferTests::TestBurrito()
@@ -208,4 +208,77 @@ class Utf16ParserTests
 
         VERIFY_ARE_EQUAL(expected, actual);
     }
+
+    TEST_METHOD(FindNextSurrogate)
+    {
+        // No surrogate at all.
+        std::wstring wstr(100, L'x');
+        VERIFY_ARE_EQUAL(wstr.size(), Utf16Parser::FindNextSurrogate(wstr, 0));
+
+        // One at every position, including past the vectorized stride, so the
+        // scalar tail and the vector body both get exercised.
+        for (size_t pos = 0; pos < wstr.size(); ++pos)
+        {
+            auto copy = wstr;
+            copy.at(pos) = SunglassesEmoji.at(0);
+            VERIFY_ARE_EQUAL(pos, Utf16Parser::FindNextSurrogate(copy, 0));
+
+            copy.at(pos) = SunglassesEmoji.at(1);
+            VERIFY_ARE_EQUAL(pos, Utf16Parser::FindNextSurrogate(copy, 0));
+        }
+
+        // Starting past the surrogate skips it.
+        auto copy = wstr;
+        copy.at(10) = SunglassesEmoji.at(0);
+        VERIFY_ARE_EQUAL(copy.size(), Utf16Parser::FindNextSurrogate(copy, 11));
+    }
+
+    TEST_METHOD(ParseIntoGroupsCodepoints)
+    {
+        std::wstring wstr{ LatinChar.at(0) };
+        wstr += HiraganaChar.at(0);
+        wstr += SunglassesEmoji.at(0);
+        wstr += SunglassesEmoji.at(1);
+        wstr += CyrillicChar.at(0);
+
+        std::vector<std::wstring_view> glyphs;
+        Utf16Parser::ParseInto(wstr, glyphs);
+
+        VERIFY_ARE_EQUAL(4u, glyphs.size());
+        VERIFY_ARE_EQUAL(std::wstring_view{ wstr }.substr(0, 1), glyphs.at(0));
+        VERIFY_ARE_EQUAL(std::wstring_view{ wstr }.substr(1, 1), glyphs.at(1));
+        VERIFY_ARE_EQUAL(std::wstring_view{ wstr }.substr(2, 2), glyphs.at(2));
+        VERIFY_ARE_EQUAL(std::wstring_view{ wstr }.substr(4, 1), glyphs.at(3));
+    }
+
+    TEST_METHOD(ParseIntoDropsBrokenSequences)
+    {
+        // Like ParseNext, ParseInto requires lead and trail to be adjacent.
+        std::wstring wstr{ SunglassesEmoji.at(1) }; // stray trail
+        wstr += SunglassesEmoji.at(0); // stray lead (followed by a normal char)
+        wstr += LatinChar.at(0);
+        wstr += SunglassesEmoji.at(0); // valid pair
+        wstr += SunglassesEmoji.at(1);
+
+        std::vector<std::wstring_view> glyphs;
+        Utf16Parser::ParseInto(wstr, glyphs);
+
+        VERIFY_ARE_EQUAL(2u, glyphs.size());
+        VERIFY_ARE_EQUAL(std::wstring_view{ wstr }.substr(2, 1), glyphs.at(0));
+        VERIFY_ARE_EQUAL(std::wstring_view{ wstr }.substr(3, 2), glyphs.at(1));
+    }
+
+    TEST_METHOD(ParseIntoReusesBuffer)
+    {
+        std::vector<std::wstring_view> glyphs;
+        Utf16Parser::ParseInto(L"hello", glyphs);
+        VERIFY_ARE_EQUAL(5u, glyphs.size());
+
+        // A second parse replaces the old contents.
+        Utf16Parser::ParseInto(L"hi", glyphs);
+        VERIFY_ARE_EQUAL(2u, glyphs.size());
+
+        Utf16Parser::ParseInto({}, glyphs);
+        VERIFY_ARE_EQUAL(0u, glyphs.size());
+    }
 };
@@ -392,9 +392,14 @@ public:
         return {};
     }
 
-    const std::vector<size_t> GetPatternId(const COORD /*location*/) const noexcept
+    uint64_t GetColorGeneration() const noexcept
     {
-        return {};
+        return 0;
+    }
+
+    void GetPatternId(const COORD /*location*/, std::vector<size_t>& patternIds) const noexcept
+    {
+        patternIds.clear();
     }
 };
 
@@ -0,0 +1,184 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- ConptyCapture.h
+
+Abstract:
+- Records a raw conpty byte stream, with timestamps, into a compact framed
+  file so customer workloads can be replayed through the benchmark and
+  parser harnesses. The writer is opt-in: it only engages when the
+  CONPTY_CAPTURE_DIR environment variable names a directory, and each
+  capture gets a unique file name there (process id plus an ordinal, so a
+  terminal with several panes produces one file per connection).
+- The file is a fixed 8-byte magic followed by length-prefixed frames. Each
+  frame carries a nanosecond timestamp relative to the start of the capture
+  and a direction - output (conhost to terminal) or input (terminal to
+  conhost) - so a replay can drive either side at the recorded pace.
+- Both conhost (VtIo's input thread and the VT renderer) and the terminal
+  (ConptyConnection) compile this header; keep it free of host- or
+  terminal-side dependencies. The tools that consume captures only use the
+  format structs and read the files directly.
+--*/
+
+#pragma once
+
+#include <windows.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace Microsoft::Console
+{
+    class ConptyCapture
+    {
+    public:
+        static constexpr wchar_t EnvironmentVariable[] = L"CONPTY_CAPTURE_DIR";
+        static constexpr char FileMagic[8] = { 'C', 'O', 'N', 'P', 'C', 'A', 'P', '1' };
+
+        enum class Direction : uint8_t
+        {
+            Output = 0, // conhost -> terminal: the rendered VT stream
+            Input = 1 // terminal -> conhost: keystrokes and other VT input
+        };
+
+#pragma pack(push, 1)
+        struct FrameHeader
+        {
+            uint64_t timestampNs; // nanoseconds since the capture started
+            uint32_t size; // payload bytes following this header
+            uint8_t direction; // one of Direction
+            uint8_t reserved[3];
+        };
+#pragma pack(pop)
+
+        ~ConptyCapture()
+        {
+            if (_file != INVALID_HANDLE_VALUE)
+            {
+                CloseHandle(_file);
+            }
+        }
+
+        ConptyCapture(const ConptyCapture&) = delete;
+        ConptyCapture& operator=(const ConptyCapture&) = delete;
+
+        // Routine Description:
+        // - Opens a capture file in the directory named by CONPTY_CAPTURE_DIR,
+        //      if that variable is set. Returns nullptr - quietly - when
+        //      capturing is not enabled or the file can't be created, so call
+        //      sites can hold the result without further checks beyond null.
+        [[nodiscard]] static std::unique_ptr<ConptyCapture> TryCreateFromEnvironment() noexcept
+        try
+        {
+            wchar_t directory[MAX_PATH];
+            const auto length = GetEnvironmentVariableW(EnvironmentVariable, directory, MAX_PATH);
+            if (length == 0 || length >= MAX_PATH)
+            {
+                return nullptr;
+            }
+
+            // One file per capture, even when several connections live in
+            // the same process.
+            static LONG ordinal = 0;
+            std::wstring path{ directory };
+            path += L"\\conpty-";
+            path += std::to_wstring(GetCurrentProcessId());
+            path += L'-';
+            path += std::to_wstring(InterlockedIncrement(&ordinal));
+            path += L".concap";
+
+            const auto file = CreateFileW(path.c_str(),
+                                          GENERIC_WRITE,
+                                          FILE_SHARE_READ,
+                                          nullptr,
+                                          CREATE_ALWAYS,
+                                          FILE_ATTRIBUTE_NORMAL,
+                                          nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+            {
+                return nullptr;
+            }
+
+            DWORD written = 0;
+            if (!WriteFile(file, FileMagic, sizeof(FileMagic), &written, nullptr))
+            {
+                CloseHandle(file);
+                return nullptr;
+            }
+
+            return std::unique_ptr<ConptyCapture>{ new ConptyCapture{ file } };
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+
+        // Routine Description:
+        // - Returns the process-wide capture, if any. Conhost serves exactly
+        //      one session per process, so its VT input and output paths
+        //      share a single capture through this accessor instead of
+        //      plumbing a writer through VtIo into the renderer. Processes
+        //      hosting several connections (the terminal) should create one
+        //      capture per connection with TryCreateFromEnvironment instead.
+        [[nodiscard]] static ConptyCapture* ProcessCapture() noexcept
+        {
+            static auto capture = TryCreateFromEnvironment();
+            return capture.get();
+        }
+
+        // Routine Description:
+        // - Appends one frame. Safe to call from the output and input paths
+        //      concurrently; frames land in the file in lock order.
+        void Record(const Direction direction, const void* const data, const size_t size) noexcept
+        {
+            if (size == 0 || _broken)
+            {
+                return;
+            }
+
+            LARGE_INTEGER now;
+            QueryPerformanceCounter(&now);
+            const auto delta = now.QuadPart - _qpcStart;
+            // Split the conversion so the intermediate products can't
+            // overflow however long the capture runs.
+            const uint64_t timestampNs = static_cast<uint64_t>(delta / _qpcFrequency) * 1'000'000'000ull +
+                                         static_cast<uint64_t>(delta % _qpcFrequency) * 1'000'000'000ull / static_cast<uint64_t>(_qpcFrequency);
+
+            FrameHeader header{};
+            header.timestampNs = timestampNs;
+            header.size = static_cast<uint32_t>(size);
+            header.direction = static_cast<uint8_t>(direction);
+
+            std::lock_guard<std::mutex> lock{ _mutex };
+            DWORD written = 0;
+            if (!WriteFile(_file, &header, sizeof(header), &written, nullptr) ||
+                !WriteFile(_file, data, static_cast<DWORD>(size), &written, nullptr))
+            {
+                // A full disk shouldn't take the console down with it; stop
+                // capturing and leave the stream truncated at a frame edge.
+                _broken = true;
+            }
+        }
+
+    private:
+        explicit ConptyCapture(const HANDLE file) noexcept :
+            _file{ file }
+        {
+            LARGE_INTEGER qpc;
+            QueryPerformanceCounter(&qpc);
+            _qpcStart = qpc.QuadPart;
+            QueryPerformanceFrequency(&qpc);
+            _qpcFrequency = qpc.QuadPart;
+        }
+
+        HANDLE _file = INVALID_HANDLE_VALUE;
+        std::mutex _mutex;
+        int64_t _qpcStart = 0;
+        int64_t _qpcFrequency = 1;
+        bool _broken = false;
+    };
+}
@@ -0,0 +1,339 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- ConptyRing.h
+
+Abstract:
+- A single-producer/single-consumer byte ring hosted in a shared memory
+  section, used to carry conpty output from conhost to a delegated terminal
+  on the same machine without a kernel transition per chunk.
+- The producer (conhost's VT renderer) and the consumer (the terminal's
+  ConptyConnection) each map the same section and coordinate through a pair
+  of auto-reset events: one pulsed when data arrives, one pulsed when space
+  frees up. The ring deliberately mirrors the blocking semantics of the
+  anonymous pipe it replaces - a full ring blocks the producer the same way
+  a full pipe blocks WriteFile - so the backpressure behavior the renderer
+  depends on is unchanged.
+- Both sides compile this header; keep it free of host- or terminal-side
+  dependencies.
+--*/
+
+#pragma once
+
+#include <windows.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+#include <wil/resource.h>
+
+namespace Microsoft::Console
+{
+    class ConptyRing
+    {
+    public:
+        static constexpr DWORD DefaultCapacity = 1024 * 1024;
+
+        // Routine Description:
+        // - Creates the backing section and signaling events and maps the ring
+        //      as the producer. The returned ring owns all three handles; pass
+        //      copies of them (SectionHandle & co.) to the consumer, which
+        //      duplicates them across the process boundary.
+        // Arguments:
+        // - capacity - Size of the data area in bytes.
+        // - ring - Receives the producer-side ring on success.
+        // Return Value:
+        // - S_OK or an appropriate HRESULT for the failed Win32 call.
+        [[nodiscard]] static HRESULT s_Create(const DWORD capacity, std::unique_ptr<ConptyRing>& ring) noexcept
+        try
+        {
+            wil::unique_handle section{ CreateFileMappingW(INVALID_HANDLE_VALUE,
+                                                           nullptr,
+                                                           PAGE_READWRITE,
+                                                           0,
+                                                           sizeof(Header) + capacity,
+                                                           nullptr) };
+            RETURN_LAST_ERROR_IF_NULL(section.get());
+
+            wil::unique_handle dataReady{ CreateEventW(nullptr, FALSE, FALSE, nullptr) };
+            RETURN_LAST_ERROR_IF_NULL(dataReady.get());
+
+            wil::unique_handle spaceFree{ CreateEventW(nullptr, FALSE, FALSE, nullptr) };
+            RETURN_LAST_ERROR_IF_NULL(spaceFree.get());
+
+            auto created = std::unique_ptr<ConptyRing>(new ConptyRing(std::move(section), std::move(dataReady), std::move(spaceFree), true));
+            RETURN_IF_FAILED(created->_map());
+
+            created->_header->version = CurrentVersion;
+            created->_header->capacity = capacity;
+            created->_capacity = capacity;
+
+            ring = std::move(created);
+            return S_OK;
+        }
+        CATCH_RETURN()
+
+        // Routine Description:
+        // - Maps an existing ring as the consumer. Takes ownership of the
+        //      given handles (which the caller should already have duplicated
+        //      into this process) whether or not the attach succeeds.
+        // Arguments:
+        // - section - The section backing the ring.
+        // - dataReady - Event the producer pulses when bytes arrive.
+        // - spaceFree - Event the consumer pulses when bytes drain.
+        // - ring - Receives the consumer-side ring on success.
+        // Return Value:
+        // - S_OK, E_INVALIDARG for a ring we don't understand, or an
+        //      appropriate HRESULT for the failed Win32 call.
+        [[nodiscard]] static HRESULT s_Attach(HANDLE section, HANDLE dataReady, HANDLE spaceFree, std::unique_ptr<ConptyRing>& ring) noexcept
+        try
+        {
+            auto attached = std::unique_ptr<ConptyRing>(new ConptyRing(wil::unique_handle{ section },
+                                                                       wil::unique_handle{ dataReady },
+                                                                       wil::unique_handle{ spaceFree },
+                                                                       false));
+            RETURN_IF_FAILED(attached->_map());
+            RETURN_HR_IF(E_INVALIDARG, attached->_header->version != CurrentVersion);
+            RETURN_HR_IF(E_INVALIDARG, attached->_header->capacity == 0);
+            attached->_capacity = attached->_header->capacity;
+
+            ring = std::move(attached);
+            return S_OK;
+        }
+        CATCH_RETURN()
+
+        ~ConptyRing()
+        {
+            Close();
+            if (_header)
+            {
+                UnmapViewOfFile(_header);
+            }
+        }
+
+        ConptyRing(const ConptyRing&) = delete;
+        ConptyRing& operator=(const ConptyRing&) = delete;
+
+        HANDLE SectionHandle() const noexcept { return _section.get(); }
+        HANDLE DataReadyHandle() const noexcept { return _dataReady.get(); }
+        HANDLE SpaceFreeHandle() const noexcept { return _spaceFree.get(); }
+
+        // Routine Description:
+        // - Gives this side a process to watch while it waits on the other,
+        //      so the peer dying abruptly reads as a broken pipe or
+        //      end-of-stream instead of a wait that never returns.
+        //      Duplicates the handle.
+        void SetPeerProcess(const HANDLE process) noexcept
+        {
+            HANDLE dup = nullptr;
+            if (process &&
+                DuplicateHandle(GetCurrentProcess(), process, GetCurrentProcess(), &dup, SYNCHRONIZE, FALSE, 0))
+            {
+                _peerProcess.reset(dup);
+            }
+        }
+
+        // Routine Description:
+        // - Producer side. Copies the entire buffer into the ring, blocking
+        //      whenever it's full until the consumer drains some of it, the
+        //      same way WriteFile on a full pipe would.
+        // Arguments:
+        // - data - The bytes to deliver.
+        // Return Value:
+        // - S_OK, or HRESULT_FROM_WIN32(ERROR_BROKEN_PIPE) if the consumer
+        //      has hung up - matching what the pipe write would have said.
+        [[nodiscard]] HRESULT Write(const std::string_view data) noexcept
+        {
+            auto remaining = data;
+            while (!remaining.empty())
+            {
+                if (ReadAcquire(&_header->consumerClosed))
+                {
+                    return HRESULT_FROM_WIN32(ERROR_BROKEN_PIPE);
+                }
+
+                const auto capacity = static_cast<LONG>(_capacity);
+                const auto head = ReadAcquire(&_header->head);
+                const auto tail = _header->tail;
+
+                // One byte is kept in reserve so head == tail always means empty.
+                auto free = head - tail - 1;
+                if (free < 0)
+                {
+                    free += capacity;
+                }
+                if (free == 0)
+                {
+                    // Waiting on the peer process alongside the event covers
+                    // the consumer dying without running its destructors -
+                    // otherwise a writer blocked on a full ring would hang
+                    // forever where the pipe write got ERROR_BROKEN_PIPE.
+                    HANDLE waits[2] = { _spaceFree.get(), _peerProcess.get() };
+                    const DWORD count = _peerProcess ? 2 : 1;
+                    const auto which = WaitForMultipleObjects(count, waits, FALSE, INFINITE);
+                    if (which == WAIT_OBJECT_0 + 1)
+                    {
+                        WriteRelease(&_header->consumerClosed, 1);
+                    }
+                    continue;
+                }
+
+                // Bounded by the free space and by the wraparound point; a
+                // write that straddles the end comes around the loop again.
+                const auto chunk = std::min<size_t>({ remaining.size(),
+                                                      static_cast<size_t>(free),
+                                                      static_cast<size_t>(capacity - tail) });
+                memcpy(_data + tail, remaining.data(), chunk);
+
+                auto newTail = tail + static_cast<LONG>(chunk);
+                if (newTail == capacity)
+                {
+                    newTail = 0;
+                }
+                WriteRelease(&_header->tail, newTail);
+                SetEvent(_dataReady.get());
+
+                remaining = remaining.substr(chunk);
+            }
+            return S_OK;
+        }
+
+        // Routine Description:
+        // - Consumer side. Copies whatever bytes are available into the given
+        //      buffer, blocking while the ring is empty. A successful return
+        //      with zero bytes read means the producer has hung up and the
+        //      ring is drained - treat it like EOF on a pipe.
+        // Arguments:
+        // - buffer - Destination for the bytes.
+        // - bufferSize - Capacity of the destination.
+        // - bytesRead - Receives how many bytes were copied.
+        // Return Value:
+        // - S_OK.
+        [[nodiscard]] HRESULT Read(_Out_writes_to_(bufferSize, *bytesRead) char* buffer, const DWORD bufferSize, _Out_ DWORD* bytesRead) noexcept
+        {
+            *bytesRead = 0;
+            for (;;)
+            {
+                const auto capacity = static_cast<LONG>(_capacity);
+                const auto head = _header->head;
+                const auto tail = ReadAcquire(&_header->tail);
+
+                auto available = tail - head;
+                if (available < 0)
+                {
+                    available += capacity;
+                }
+                if (available == 0)
+                {
+                    if (ReadAcquire(&_header->producerClosed) || ReadAcquire(&_header->consumerClosed))
+                    {
+                        // The closed flag may have been raised after our
+                        // emptiness sample above - the producer's final write
+                        // publishes the tail first and the close follows - so
+                        // re-sample before declaring end-of-stream. A pipe
+                        // always delivers buffered bytes before breaking;
+                        // going around again drains them the same way.
+                        if (ReadAcquire(&_header->tail) == head)
+                        {
+                            return S_OK;
+                        }
+                        continue;
+                    }
+
+                    // Waiting on the peer process alongside the event covers
+                    // the producer dying without running its destructors -
+                    // the moral equivalent of the kernel breaking a pipe.
+                    HANDLE waits[2] = { _dataReady.get(), _peerProcess.get() };
+                    const DWORD count = _peerProcess ? 2 : 1;
+                    const auto which = WaitForMultipleObjects(count, waits, FALSE, INFINITE);
+                    if (which == WAIT_OBJECT_0 + 1)
+                    {
+                        WriteRelease(&_header->producerClosed, 1);
+                    }
+                    continue;
+                }
+
+                const auto chunk = std::min<size_t>({ static_cast<size_t>(bufferSize),
+                                                      static_cast<size_t>(available),
+                                                      static_cast<size_t>(capacity - head) });
+                memcpy(buffer, _data + head, chunk);
+
+                auto newHead = head + static_cast<LONG>(chunk);
+                if (newHead == capacity)
+                {
+                    newHead = 0;
+                }
+                WriteRelease(&_header->head, newHead);
+                SetEvent(_spaceFree.get());
+
+                *bytesRead = static_cast<DWORD>(chunk);
+                return S_OK;
+            }
+        }
+
+        // Routine Description:
+        // - Marks our side of the ring as closed and wakes the other side so
+        //      it can notice. After the producer closes, the consumer drains
+        //      what's left and then reads 0 bytes; after the consumer closes,
+        //      the producer's next write fails like a broken pipe.
+        void Close() noexcept
+        {
+            if (_header)
+            {
+                WriteRelease(_isProducer ? &_header->producerClosed : &_header->consumerClosed, 1);
+                SetEvent(_dataReady.get());
+                SetEvent(_spaceFree.get());
+            }
+        }
+
+    private:
+        struct Header
+        {
+            ULONG version;
+            ULONG capacity; // size of the data area, in bytes; each side
+                            // trusts its local _capacity copy instead of
+                            // re-reading this peer-writable field
+            LONG head; // next byte the consumer will read
+            LONG tail; // next byte the producer will write
+            LONG producerClosed;
+            LONG consumerClosed;
+        };
+
+        static constexpr ULONG CurrentVersion = 1;
+
+        ConptyRing(wil::unique_handle section, wil::unique_handle dataReady, wil::unique_handle spaceFree, const bool isProducer) noexcept :
+            _section(std::move(section)),
+            _dataReady(std::move(dataReady)),
+            _spaceFree(std::move(spaceFree)),
+            _isProducer(isProducer)
+        {
+        }
+
+        [[nodiscard]] HRESULT _map() noexcept
+        {
+            RETURN_HR_IF_NULL(E_HANDLE, _section.get());
+            RETURN_HR_IF_NULL(E_HANDLE, _dataReady.get());
+            RETURN_HR_IF_NULL(E_HANDLE, _spaceFree.get());
+
+            const auto view = MapViewOfFile(_section.get(), FILE_MAP_ALL_ACCESS, 0, 0, 0);
+            RETURN_LAST_ERROR_IF_NULL(view);
+
+            _header = static_cast<Header*>(view);
+            _data = reinterpret_cast<char*>(_header + 1);
+            return S_OK;
+        }
+
+        wil::unique_handle _section;
+        wil::unique_handle _dataReady;
+        wil::unique_handle _spaceFree;
+        wil::unique_handle _peerProcess;
+        Header* _header = nullptr;
+        char* _data = nullptr;
+        DWORD _capacity = 0;
+        const bool _isProducer;
+    };
+}
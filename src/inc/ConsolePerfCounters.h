@@ -0,0 +1,256 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+/*
+Module Name:
+- ConsolePerfCounters.h
+
+Abstract:
+- Process-wide, always-on performance counters for the console's hot paths.
+- Writers update these with relaxed atomic increments, which cost roughly as
+  much as a plain add on the architectures we ship on, so they stay enabled in
+  retail builds. Readers (the ETW rundown in telemetry.cpp, a debugger) take a
+  torn-free snapshot of each counter individually; the set is not sampled
+  atomically as a whole, which is fine for the triage questions these answer.
+- This header depends only on the standard library on purpose: it is included
+  from the VT parser, the renderer, and the host, which otherwise share
+  nothing below til.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace Microsoft::Console
+{
+    // A fixed histogram of microsecond durations in power-of-two buckets:
+    // bucket 0 holds 0us samples and bucket n (n >= 1) holds samples in
+    // [2^(n-1), 2^n) us. Log2 buckets trade the fine resolution of a full
+    // HdrHistogram for a footprint small enough to leave always-on; at
+    // human-perceptible latencies the relative error stays under 2x, which
+    // is plenty to tell 4ms from 40ms.
+    struct LatencyHistogram
+    {
+        static constexpr size_t BucketCount = 24; // caps out at ~8.4 seconds
+
+        std::array<std::atomic<uint64_t>, BucketCount> buckets{};
+        std::atomic<uint64_t> totalSamples{ 0 };
+        std::atomic<uint64_t> totalMicroseconds{ 0 };
+        std::atomic<uint64_t> maxMicroseconds{ 0 };
+
+        void Record(const uint64_t microseconds) noexcept
+        {
+            size_t bucket = 0;
+            for (auto v = microseconds; v != 0 && bucket < BucketCount - 1; v >>= 1)
+            {
+                ++bucket;
+            }
+
+            buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+            totalSamples.fetch_add(1, std::memory_order_relaxed);
+            totalMicroseconds.fetch_add(microseconds, std::memory_order_relaxed);
+
+            auto prev = maxMicroseconds.load(std::memory_order_relaxed);
+            while (prev < microseconds && !maxMicroseconds.compare_exchange_weak(prev, microseconds, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        // Returns the upper bound, in microseconds, of the bucket containing
+        // the given percentile (0-100), or 0 when no samples were recorded.
+        // The true value lies within a factor of two below the result.
+        [[nodiscard]] uint64_t EstimatePercentile(const double percentile) const noexcept
+        {
+            const auto samples = totalSamples.load(std::memory_order_relaxed);
+            if (samples == 0)
+            {
+                return 0;
+            }
+
+            auto target = static_cast<uint64_t>(static_cast<double>(samples) * percentile / 100.0);
+            if (target == 0)
+            {
+                target = 1;
+            }
+
+            uint64_t seen = 0;
+            for (size_t i = 0; i < BucketCount; ++i)
+            {
+                seen += buckets[i].load(std::memory_order_relaxed);
+                if (seen >= target)
+                {
+                    return i == 0 ? 0 : uint64_t{ 1 } << i;
+                }
+            }
+
+            return uint64_t{ 1 } << (BucketCount - 1);
+        }
+    };
+
+    // Allocation statistics for one subsystem: live bytes, total allocation
+    // count, and the high-water mark of live bytes. Attributing memory to
+    // subsystems here is what lets a customer dump answer "which structure
+    // owns this 2 GB tab" without a heap profiler attached.
+    struct AllocationTally
+    {
+        std::atomic<uint64_t> bytes{ 0 };
+        std::atomic<uint64_t> allocations{ 0 };
+        std::atomic<uint64_t> highWaterBytes{ 0 };
+
+        void OnAllocate(const uint64_t size) noexcept
+        {
+            const auto current = bytes.fetch_add(size, std::memory_order_relaxed) + size;
+            allocations.fetch_add(1, std::memory_order_relaxed);
+
+            auto prev = highWaterBytes.load(std::memory_order_relaxed);
+            while (prev < current && !highWaterBytes.compare_exchange_weak(prev, current, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        void OnFree(const uint64_t size) noexcept
+        {
+            bytes.fetch_sub(size, std::memory_order_relaxed);
+        }
+
+        // For call sites that can only observe a container's footprint
+        // changing (capacity before and after), not individual allocations.
+        void OnResize(const uint64_t oldSize, const uint64_t newSize) noexcept
+        {
+            if (newSize > oldSize)
+            {
+                OnAllocate(newSize - oldSize);
+            }
+            else if (oldSize > newSize)
+            {
+                OnFree(oldSize - newSize);
+            }
+        }
+    };
+
+    // A std::pmr adapter over an AllocationTally: forwards every request to
+    // the upstream resource and reports it to the tally. Slot one of these
+    // under a subsystem's pools and containers and the tally tracks exactly
+    // what that subsystem holds from the OS.
+    class TalliedResource final : public std::pmr::memory_resource
+    {
+    public:
+        explicit TalliedResource(AllocationTally& tally, std::pmr::memory_resource* const upstream = std::pmr::get_default_resource()) noexcept :
+            _tally{ tally },
+            _upstream{ upstream }
+        {
+        }
+
+        TalliedResource(const TalliedResource&) = delete;
+        TalliedResource& operator=(const TalliedResource&) = delete;
+
+    protected:
+        void* do_allocate(const size_t bytes, const size_t align) override
+        {
+            void* const ptr = _upstream->allocate(bytes, align);
+            _tally.OnAllocate(bytes);
+            return ptr;
+        }
+
+        void do_deallocate(void* const ptr, const size_t bytes, const size_t align) override
+        {
+            _tally.OnFree(bytes);
+            _upstream->deallocate(ptr, bytes, align);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+    private:
+        AllocationTally& _tally;
+        std::pmr::memory_resource* _upstream;
+    };
+
+    struct PerfCounters
+    {
+        // Bytes handed to StateMachine::ProcessString, i.e. UTF-16 code units
+        // entering the VT parser, times sizeof(wchar_t).
+        std::atomic<uint64_t> bytesIngested{ 0 };
+
+        // Control sequences (ESC/VT52/CSI/OSC/SS3/DCS) dispatched to a state
+        // machine engine, whether or not the engine handled them.
+        std::atomic<uint64_t> sequencesDispatched{ 0 };
+
+        // Frames a render engine painted to completion. Frames skipped
+        // because nothing was invalidated are not counted.
+        std::atomic<uint64_t> framesPainted{ 0 };
+
+        // Console lock statistics. Ticks are QueryPerformanceCounter units;
+        // divide by QueryPerformanceFrequency for seconds. Reentrant
+        // acquisitions on the owning thread are not counted - only the
+        // outermost lock/unlock pair per thread is.
+        std::atomic<uint64_t> lockAcquisitions{ 0 };
+        std::atomic<uint64_t> lockWaitTicks{ 0 };
+        std::atomic<uint64_t> lockHoldTicks{ 0 };
+
+        // Per-subsystem allocation tallies. bufferAllocations tracks text
+        // buffer row storage (including blocks the row pool retains for
+        // reuse), rendererAllocations the VT engine's composition buffers
+        // and invalidation pool, and inputAllocations the input buffer's
+        // record queue.
+        AllocationTally bufferAllocations;
+        AllocationTally rendererAllocations;
+        AllocationTally inputAllocations;
+
+        // Input-to-present latency. A keystroke arriving at the input path
+        // stamps NoteInput; the output parser arms the pending stamp via
+        // NoteOutput once any output is generated while it is outstanding
+        // (the echo, for an interactive shell); the renderer completes the
+        // sample via NotePresent after the next frame reaches the screen.
+        // This deliberately tracks only the most recent keystroke - under
+        // sustained typing each sample still spans one full input-to-glyph
+        // round trip, which is the distribution we care about. Input that
+        // never produces output (an ignored key) simply ages out when the
+        // next keystroke overwrites it.
+        LatencyHistogram inputToPresentLatency;
+
+        void NoteInput(const int64_t qpcTick) noexcept
+        {
+            _pendingInputTick.store(qpcTick, std::memory_order_relaxed);
+            _pendingEchoSeen.store(false, std::memory_order_relaxed);
+        }
+
+        void NoteOutput() noexcept
+        {
+            if (_pendingInputTick.load(std::memory_order_relaxed) != 0)
+            {
+                _pendingEchoSeen.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        void NotePresent(const int64_t qpcTick, const int64_t qpcFrequency) noexcept
+        {
+            if (_pendingEchoSeen.exchange(false, std::memory_order_relaxed))
+            {
+                const auto stamp = _pendingInputTick.exchange(0, std::memory_order_relaxed);
+                if (stamp != 0 && qpcTick > stamp && qpcFrequency > 0)
+                {
+                    inputToPresentLatency.Record(static_cast<uint64_t>(qpcTick - stamp) * 1'000'000 / static_cast<uint64_t>(qpcFrequency));
+                }
+            }
+        }
+
+        static PerfCounters& Instance() noexcept
+        {
+            static PerfCounters instance;
+            return instance;
+        }
+
+    private:
+        // QPC tick of the most recent keystroke, 0 once a sample completes.
+        std::atomic<int64_t> _pendingInputTick{ 0 };
+        // Whether output was generated while that keystroke was pending.
+        std::atomic<bool> _pendingEchoSeen{ false };
+    };
+}
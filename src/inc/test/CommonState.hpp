@@ -299,7 +299,7 @@ private:
         attrs[6].SetTrailing();
 
         CharRow& charRow = pRow->GetCharRow();
-        OverwriteColumns(pwszText, pwszText + length, attrs.cbegin(), charRow.begin());
+        OverwriteColumns(pwszText, pwszText + length, attrs.cbegin(), charRow);
 
         // set some colors
         TextAttribute Attr = TextAttribute(0);
@@ -364,7 +364,7 @@ private:
         attrs[79].SetLeading();
 
         CharRow& charRow = pRow->GetCharRow();
-        OverwriteColumns(pwszText, pwszText + length, attrs.cbegin(), charRow.begin());
+        OverwriteColumns(pwszText, pwszText + length, attrs.cbegin(), charRow);
 
         // everything gets default attributes
         pRow->GetAttrRow().Reset(gci.GetActiveOutputBuffer().GetAttributes());
@@ -13,6 +13,7 @@
 #include "til/pmr.h"
 #include "til/replace.h"
 #include "til/rle.h"
+#include "til/scratch_buffer.h"
 #include "til/string.h"
 #include "til/u8u16convert.h"
 
@@ -26,4 +26,87 @@ namespace til
 #pragma warning(suppress : 26492) // Don't use const_cast to cast away const or volatile
         WakeByAddressAll(const_cast<std::atomic<T>*>(&atomic));
     }
+
+    // The functions above wait on exactly one address. Threads like the
+    // renderer or the server IO thread however want to sleep until *any* of
+    // a set of conditions changes, and producers want a single wake to
+    // release every waiter - without each call site inventing its own event
+    // plumbing.
+    //
+    // wait_group multiplexes any number of conditions onto one wait address
+    // using an eventcount: every notify() bumps an epoch and wakes all
+    // waiters, and waiters snapshot the epoch *before* re-checking their
+    // conditions, so a notify that lands between the check and the wait is
+    // never lost. Because one bump covers any number of prior state changes,
+    // a producer can batch several updates and pay for a single wake.
+    //
+    // The intended pattern is:
+    //
+    //   producer:  publish state (stores to any atomics), then group.notify()
+    //   consumer:  group.wait_until([&] { return any condition I care about; },
+    //                               timeoutMilliseconds);
+    struct wait_group
+    {
+        // Call after publishing one or more state changes that a waiter's
+        // predicate might observe.
+        void notify() noexcept
+        {
+            _epoch.fetch_add(1, std::memory_order_release);
+            WakeByAddressAll(&_epoch);
+        }
+
+        // Snapshots the epoch for a later wait(). The conditions must be
+        // checked after this call and before wait(), or wakeups can be lost.
+        [[nodiscard]] uint32_t prepare() const noexcept
+        {
+            return _epoch.load(std::memory_order_acquire);
+        }
+
+        // Blocks until notify() is called after the corresponding prepare(),
+        // or the timeout elapses. Returns false on timeout. Just like
+        // WaitOnAddress this may wake spuriously; callers are expected to
+        // re-check their conditions in a loop (or use wait_until below).
+        bool wait(const uint32_t epoch, const DWORD waitMilliseconds = INFINITE) const noexcept
+        {
+            auto undesired = epoch;
+#pragma warning(suppress : 26492) // Don't use const_cast to cast away const or volatile
+            const auto ok = WaitOnAddress(const_cast<std::atomic<uint32_t>*>(&_epoch), &undesired, sizeof(undesired), waitMilliseconds);
+            return ok != FALSE || _epoch.load(std::memory_order_acquire) != epoch;
+        }
+
+        // Blocks until the predicate returns true, or the timeout elapses.
+        // Returns the predicate's final result. The predicate may inspect
+        // any number of atomics, as long as their writers call notify().
+        template<typename Predicate>
+        bool wait_until(Predicate&& predicate, const DWORD waitMilliseconds = INFINITE) const noexcept
+        {
+            const auto deadline = waitMilliseconds == INFINITE ? UINT64_MAX : GetTickCount64() + waitMilliseconds;
+
+            for (;;)
+            {
+                const auto epoch = prepare();
+
+                if (predicate())
+                {
+                    return true;
+                }
+
+                DWORD remaining = INFINITE;
+                if (deadline != UINT64_MAX)
+                {
+                    const auto now = GetTickCount64();
+                    if (now >= deadline)
+                    {
+                        return false;
+                    }
+                    remaining = static_cast<DWORD>(deadline - now);
+                }
+
+                wait(epoch, remaining);
+            }
+        }
+
+    private:
+        std::atomic<uint32_t> _epoch{ 0 };
+    };
 }
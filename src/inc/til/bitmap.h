@@ -269,7 +269,22 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
                 // If we don't have cached runs, rebuild.
                 if (!_runs.has_value())
                 {
-                    _runs.emplace(begin(), end());
+                    // A fully dirty map - what every full repaint asks us about - is
+                    // exactly one run per row. all() answers that a whole 64-bit word
+                    // at a time, so prefer it over walking the map bit by bit.
+                    if (_bits.all())
+                    {
+                        auto& runs = _runs.emplace();
+                        runs.reserve(static_cast<size_t>(_sz.height));
+                        for (CoordType row = 0; row < _sz.height; ++row)
+                        {
+                            runs.emplace_back(til::point{ 0, row }, til::size{ _sz.width, 1 });
+                        }
+                    }
+                    else
+                    {
+                        _runs.emplace(begin(), end());
+                    }
                 }
 
                 // Return the runs.
@@ -286,67 +301,98 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
                     return;
                 }
 
-                // FUTURE: PERF: GH #4015: This could use in-place walk semantics instead of a temporary.
-                bitmap<allocator_type> other{ _sz, _alloc };
+                const ptrdiff_t width = _sz.width;
+                const ptrdiff_t height = _sz.height;
 
-                for (auto run : *this)
+                // If the horizontal part of the move is at least the full width,
+                // every cell slides out of bounds and the result is trivial.
+                if (delta.x >= width || -delta.x >= width)
                 {
-                    // Offset by the delta
-                    run += delta;
+                    if (fill)
+                    {
+                        set_all();
+                    }
+                    else
+                    {
+                        reset_all();
+                    }
+                    return;
+                }
 
-                    // Intersect with the bounds of our bitmap area
-                    // as part of it could have slid out of bounds.
-                    run &= _rc;
+                // GH #4015: Diagonal moves used to rebuild the map into a temporary
+                // bitmap one run at a time, which was linear in the area of the
+                // buffer. Instead, shift the entire bitset by delta.y * width + delta.x
+                // bits in one go, the same way translate_y does for purely vertical
+                // moves. That puts every cell in its translated position with
+                // whole-word operations; the only bits that land in the wrong place
+                // are the ones that wrapped around a row boundary. For a move to the
+                // right, the leftmost delta.x columns of each row receive the tail of
+                // the row above them, and those columns are exactly the region left
+                // uncovered by the horizontal part of the move - so we simply
+                // overwrite them with the fill value afterwards. (And symmetrically
+                // on the right edge for a move to the left.)
+                const ptrdiff_t bitShift = delta.y * width + delta.x;
+
+#pragma warning(push)
+                // we can't depend on GSL here, so we use static_cast for explicit narrowing
+#pragma warning(disable : 26472)
+                const auto newBits = static_cast<size_t>(std::abs(bitShift));
+                const auto uncoveredWidth = static_cast<size_t>(std::abs(static_cast<ptrdiff_t>(delta.x)));
+#pragma warning(pop)
+                const bool isLeftShift = bitShift > 0;
 
-                    // Set it into the new bitmap.
-                    other.set(run);
+                if (newBits >= _bits.size())
+                {
+                    if (fill)
+                    {
+                        set_all();
+                    }
+                    else
+                    {
+                        reset_all();
+                    }
+                    return;
                 }
 
-                // If we were asked to fill... find the uncovered region.
-                if (fill)
+                if (isLeftShift)
+                {
+                    // This operator doesn't modify the size of `_bits`: the
+                    // new bits are set to 0.
+                    _bits <<= newBits;
+                }
+                else
                 {
-                    // Original Rect of As.
-                    //
-                    // X <-- origin
-                    // A A A A
-                    // A A A A
-                    // A A A A
-                    // A A A A
-                    const auto originalRect = _rc;
-
-                    // If Delta = (2, 2)
-                    // Translated Rect of Bs.
-                    //
-                    // X <-- origin
-                    //
-                    //
-                    //     B B B B
-                    //     B B B B
-                    //     B B B B
-                    //     B B B B
-                    const auto translatedRect = _rc + delta;
-
-                    // Subtract the B from the A one to see what wasn't filled by the move.
-                    // C is the overlap of A and B:
-                    //
-                    // X <-- origin
-                    // A A A A                     1 1 1 1
-                    // A A A A                     1 1 1 1
-                    // A A C C B B     subtract    2 2
-                    // A A C C B B    --------->   2 2
-                    //     B B B B      A - B
-                    //     B B B B
-                    //
-                    // 1 and 2 are the spaces to fill that are "uncovered".
-                    const auto fillRects = originalRect - translatedRect;
-                    for (const auto& f : fillRects)
+                    _bits >>= newBits;
+                }
+
+                // Overwrite the wrapped columns on every row with the fill value.
+                const ptrdiff_t uncoveredLeft = delta.x > 0 ? 0 : width + delta.x;
+                for (ptrdiff_t row = 0; row < height; ++row)
+                {
+#pragma warning(suppress : 26472) // we can't depend on GSL here, so we use static_cast for explicit narrowing
+                    _bits.set(static_cast<size_t>(row * width + uncoveredLeft), uncoveredWidth, fill);
+                }
+
+                // Fill the rows left uncovered by the vertical part of the move.
+                // (If fill was not requested, the shift already left them zero.)
+                if (fill && delta.y != 0)
+                {
+#pragma warning(push)
+                    // we can't depend on GSL here, so we use static_cast for explicit narrowing
+#pragma warning(disable : 26472)
+                    const auto uncoveredRowBits = static_cast<size_t>(std::abs(delta.y * width));
+#pragma warning(pop)
+                    if (delta.y > 0)
                     {
-                        other.set(f);
+                        _bits.set(0, uncoveredRowBits, true);
+                    }
+                    else
+                    {
+                        _bits.set(_bits.size() - uncoveredRowBits, uncoveredRowBits, true);
                     }
                 }
 
-                // Swap us with the temporary one.
-                std::swap(other, *this);
+                _runs.reset(); // reset cached runs on any non-const method
             }
 
             void set(const til::point pt)
@@ -0,0 +1,597 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+// til::mpsc::details::atomic_epoch requires std::atomic<size_type>::wait() and ::notify_all() and at the time of
+// writing no STL supports these. Since both Windows and Linux offer a Futex implementation we can easily implement
+// this though. On other platforms we fall back to using a std::condition_variable.
+#if __cpp_lib_atomic_wait >= 201907
+#define _TIL_MPSC_DETAIL_EPOCH_IMPL_NATIVE 1
+#elif defined(_WIN32_WINNT) && _WIN32_WINNT >= _WIN32_WINNT_WIN8
+#define _TIL_MPSC_DETAIL_EPOCH_IMPL_WIN 1
+#elif __linux__
+#define _TIL_MPSC_DETAIL_EPOCH_IMPL_LINUX 1
+#else
+#define _TIL_MPSC_DETAIL_EPOCH_IMPL_FALLBACK 1
+#endif
+
+// til: Terminal Implementation Library. Also: "Today I Learned".
+// mpsc: Multi Producer Single Consumer. A MPSC queue/channel sends data from any number of senders to one receiver.
+//
+// til::spsc's ring design only admits a single producer, because each side owns exactly one position.
+// This sibling uses the other classic design - Dmitry Vyukov's bounded queue - where each slot of the
+// ring buffer carries its own sequence number. Producers race with a compare-exchange to claim the slot
+// at the shared tail position; the sequence number tells them whether the slot is free for their lap and
+// tells the consumer whether the slot has been published yet. Since a slot is only ever claimed when it's
+// free, a claimed slot is always published and items always come out in ticket order.
+namespace til::mpsc
+{
+    using size_type = uint32_t;
+
+    namespace details
+    {
+        struct block_initially_policy
+        {
+            using _mpsc_policy = int;
+            static constexpr bool _block_forever = false;
+        };
+
+        struct block_forever_policy
+        {
+            using _mpsc_policy = int;
+            static constexpr bool _block_forever = true;
+        };
+
+        template<typename WaitPolicy>
+        using enable_if_wait_policy_t = typename std::remove_reference_t<WaitPolicy>::_mpsc_policy;
+
+        // atomic_epoch is an "eventcount": a counter that is bumped after every state change of the
+        // channel. Anyone about to block reads the counter, re-checks their condition and then waits
+        // for the counter to change. Since the bump happens after the state change, a waiter can
+        // never miss the wakeup for a condition that became true between its check and its wait.
+        struct atomic_epoch
+        {
+            size_type load(std::memory_order order) const noexcept
+            {
+                return _value.load(order);
+            }
+
+            void bump() noexcept
+            {
+#if _TIL_MPSC_DETAIL_EPOCH_IMPL_FALLBACK
+                // We must use a lock here to prevent us from modifying the value
+                // in between wait() reading the value and the thread being suspended.
+                std::lock_guard<std::mutex> lock{ _m };
+#endif
+                _value.fetch_add(1, std::memory_order_release);
+
+#if _TIL_MPSC_DETAIL_EPOCH_IMPL_NATIVE
+                _value.notify_all();
+#elif _TIL_MPSC_DETAIL_EPOCH_IMPL_WIN
+                WakeByAddressAll(&_value);
+#elif _TIL_MPSC_DETAIL_EPOCH_IMPL_LINUX
+                futex(FUTEX_WAKE_PRIVATE, std::numeric_limits<int>::max());
+#elif _TIL_MPSC_DETAIL_EPOCH_IMPL_FALLBACK
+                _cv.notify_all();
+#endif
+            }
+
+            void wait(size_type old) const noexcept
+            {
+#if _TIL_MPSC_DETAIL_EPOCH_IMPL_NATIVE
+                _value.wait(old, std::memory_order_relaxed);
+#elif _TIL_MPSC_DETAIL_EPOCH_IMPL_WIN
+#pragma warning(suppress : 26492) // Don't use const_cast to cast away const or volatile
+                WaitOnAddress(const_cast<std::atomic<size_type>*>(&_value), &old, sizeof(_value), INFINITE);
+#elif _TIL_MPSC_DETAIL_EPOCH_IMPL_LINUX
+                futex(FUTEX_WAIT_PRIVATE, old);
+#elif _TIL_MPSC_DETAIL_EPOCH_IMPL_FALLBACK
+                std::unique_lock<std::mutex> lock{ _m };
+                _cv.wait(lock, [&]() { return _value.load(std::memory_order_relaxed) != old; });
+#endif
+            }
+
+        private:
+#if _TIL_MPSC_DETAIL_EPOCH_IMPL_LINUX
+            inline void futex(int futex_op, size_type val) const noexcept
+            {
+                // See: https://man7.org/linux/man-pages/man2/futex.2.html
+                static_assert(sizeof(std::atomic<size_type>) == 4);
+                syscall(SYS_futex, &_value, futex_op, val, nullptr, nullptr, 0);
+            }
+#endif
+
+            std::atomic<size_type> _value{ 0 };
+
+#if _TIL_MPSC_DETAIL_EPOCH_IMPL_FALLBACK
+        private:
+            mutable std::mutex _m;
+            mutable std::condition_variable _cv;
+#endif
+        };
+
+        template<typename T>
+        inline T* alloc_raw_memory(size_t size)
+        {
+            constexpr auto alignment = alignof(T);
+            if constexpr (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                return static_cast<T*>(::operator new(size));
+            }
+            else
+            {
+                return static_cast<T*>(::operator new(size, std::align_val_t(alignment)));
+            }
+        }
+
+        template<typename T>
+        inline void free_raw_memory(T* ptr) noexcept
+        {
+            constexpr auto alignment = alignof(T);
+            if constexpr (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                ::operator delete(ptr);
+            }
+            else
+            {
+                ::operator delete(ptr, std::align_val_t(alignment));
+            }
+        }
+
+        // The outcome of a single non-blocking produce/consume attempt.
+        enum class attempt : int
+        {
+            dead, // the other side of the channel is gone (for the consumer: gone and drained)
+            blocked, // the channel is currently full / empty
+            done, // the item was written / read
+        };
+
+        // arc manages the slot array and the lifetime of the channel. Unlike til::spsc::details::arc
+        // it's reference counted across an arbitrary number of producer handles plus the consumer,
+        // since producers are copyable.
+        //
+        // Every slot carries a sequence number, initialized to the slot's own index. For the ticket
+        // "pos" (a free running counter; slot index = pos % capacity) the slot's lifecycle is:
+        //   sequence == pos     -> free; a producer may claim it by advancing _tail from pos to pos + 1
+        //   sequence == pos + 1 -> published; the consumer at position pos may read it
+        //   sequence == pos + capacity -> consumed; which is exactly "free" for the next lap's ticket
+        // The capacity is rounded up to a power of two so this arithmetic survives the
+        // (entirely acceptable) wraparound of the 32 bit counters.
+        template<typename T>
+        struct arc
+        {
+            explicit arc(size_type capacity) :
+                _data(alloc_raw_memory<T>(size_t(capacity) * sizeof(T))),
+                _sequences(new std::atomic<size_type>[capacity]),
+                _mask(capacity - 1)
+            {
+                for (size_type i = 0; i < capacity; ++i)
+                {
+                    _sequences[i].store(i, std::memory_order_relaxed);
+                }
+            }
+
+            ~arc()
+            {
+                // Both sides are gone at this point, so no synchronization is needed. A slot is only
+                // ever claimed when it's free, which means every ticket below _tail was published.
+                // Whatever the consumer didn't get to is the contiguous range [_head, _tail).
+                const auto end = _tail.load(std::memory_order_relaxed);
+                for (auto pos = _head; pos != end; ++pos)
+                {
+                    std::destroy_at(_data + (pos & _mask));
+                }
+
+                delete[] _sequences;
+                free_raw_memory(_data);
+            }
+
+            void add_producer() noexcept
+            {
+                _producers.fetch_add(1, std::memory_order_relaxed);
+                _handles.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void drop_producer() noexcept
+            {
+                if (_producers.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    // The last producer is gone - the consumer may be asleep waiting for an item
+                    // that will never come and needs to wake up to notice.
+                    _epoch.bump();
+                }
+                unref();
+            }
+
+            void drop_consumer() noexcept
+            {
+                _consumerDropped.store(true, std::memory_order_release);
+                // Producers may be asleep waiting for space that will never be freed.
+                _epoch.bump();
+                unref();
+            }
+
+            template<typename... Args>
+            attempt try_produce(Args&&... args)
+            {
+                if (_consumerDropped.load(std::memory_order_acquire))
+                {
+                    return attempt::dead;
+                }
+
+                auto pos = _tail.load(std::memory_order_relaxed);
+                while (true)
+                {
+                    auto& sequence = _sequences[pos & _mask];
+                    const auto seq = sequence.load(std::memory_order_acquire);
+                    // diff is computed on the wrapping 32 bit counters; interpreting it as signed
+                    // yields the correct ordering on either side of a wraparound.
+                    const auto diff = static_cast<int32_t>(seq - pos);
+
+                    if (diff == 0)
+                    {
+                        // The slot at _tail is free. Race the other producers for it.
+                        if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        {
+                            new (_data + (pos & _mask)) T(std::forward<Args>(args)...);
+                            sequence.store(pos + 1, std::memory_order_release);
+                            _epoch.bump();
+                            return attempt::done;
+                        }
+                        // Lost the race; pos was reloaded by compare_exchange_weak. Go around.
+                    }
+                    else if (diff < 0)
+                    {
+                        // The slot hasn't been consumed for the previous lap yet: the queue is full.
+                        return attempt::blocked;
+                    }
+                    else
+                    {
+                        // Another producer claimed this slot in the meantime. Chase the new tail.
+                        pos = _tail.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            template<typename... Args>
+            attempt produce(Args&&... args)
+            {
+                while (true)
+                {
+                    const auto epoch = _epoch.load(std::memory_order_acquire);
+                    const auto result = try_produce(std::forward<Args>(args)...);
+                    if (result != attempt::blocked)
+                    {
+                        return result;
+                    }
+                    _epoch.wait(epoch);
+                }
+            }
+
+            // The consumer-side counterpart of try_produce. On attempt::done the item at
+            // consume_data() is alive and must be moved out before calling consume_release().
+            attempt try_consume_acquire() noexcept
+            {
+                auto& sequence = _sequences[_head & _mask];
+                if (sequence.load(std::memory_order_acquire) == _head + 1)
+                {
+                    return attempt::done;
+                }
+                // Nothing published at our position. If no producer handle remains, nothing is
+                // in flight either, so _tail == _head means drained for good.
+                if (_producers.load(std::memory_order_acquire) == 0 &&
+                    _tail.load(std::memory_order_acquire) == _head)
+                {
+                    return attempt::dead;
+                }
+                return attempt::blocked;
+            }
+
+            T* consume_data() const noexcept
+            {
+                return _data + (_head & _mask);
+            }
+
+            void consume_release() noexcept
+            {
+                std::destroy_at(consume_data());
+                // Mark the slot free for this slot's ticket on the next lap.
+                _sequences[_head & _mask].store(_head + (_mask + 1), std::memory_order_release);
+                ++_head;
+                _epoch.bump();
+            }
+
+            attempt consume_acquire() noexcept
+            {
+                while (true)
+                {
+                    const auto epoch = _epoch.load(std::memory_order_acquire);
+                    const auto result = try_consume_acquire();
+                    if (result != attempt::blocked)
+                    {
+                        return result;
+                    }
+                    _epoch.wait(epoch);
+                }
+            }
+
+        private:
+            void unref() noexcept
+            {
+                // The contents are only deleted when all producers and the consumer are gone.
+                if (_handles.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    delete this;
+                }
+            }
+
+            T* const _data;
+            std::atomic<size_type>* const _sequences;
+            const size_type _mask;
+
+            std::atomic<size_type> _tail{ 0 };
+            size_type _head = 0; // only ever touched by the single consumer (and the destructor)
+
+            atomic_epoch _epoch;
+            std::atomic<size_type> _producers{ 1 };
+            std::atomic<size_type> _handles{ 2 };
+            std::atomic<bool> _consumerDropped{ false };
+        };
+
+        inline size_type validate_capacity(uint32_t capacity)
+        {
+            if (capacity == 0)
+            {
+                throw std::invalid_argument{ "invalid capacity" };
+            }
+            if (capacity > (1u << 30))
+            {
+                throw std::overflow_error{ "size too large for mpsc" };
+            }
+
+            // Round up to the next power of two for the slot arithmetic (see arc).
+            size_type rounded = 1;
+            while (rounded < capacity)
+            {
+                rounded <<= 1u;
+            }
+            return rounded;
+        }
+    }
+
+    // Block until at least one item has been written into the sender / read from the receiver.
+    inline constexpr details::block_initially_policy block_initially{};
+
+    // Block until all items have been written into the sender / read from the receiver.
+    inline constexpr details::block_forever_policy block_forever{};
+
+    template<typename T>
+    struct producer
+    {
+        explicit producer(details::arc<T>* arc) noexcept :
+            _arc(arc) {}
+
+        // Producers are copyable - that's the entire point of a MPSC channel.
+        // Hand a copy to every thread that wants to send.
+        producer(const producer<T>& other) noexcept :
+            _arc(other._arc)
+        {
+            if (_arc)
+            {
+                _arc->add_producer();
+            }
+        }
+
+        producer<T>& operator=(const producer<T>& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (other._arc)
+                {
+                    other._arc->add_producer();
+                }
+                drop();
+                _arc = other._arc;
+            }
+            return *this;
+        }
+
+        producer(producer<T>&& other) noexcept :
+            _arc(std::exchange(other._arc, nullptr))
+        {
+        }
+
+        producer<T>& operator=(producer<T>&& other) noexcept
+        {
+            drop();
+            _arc = std::exchange(other._arc, nullptr);
+            return *this;
+        }
+
+        ~producer()
+        {
+            drop();
+        }
+
+        // emplace constructs an item in-place at the end of the queue.
+        // It returns true, if the item was successfully placed within the queue.
+        // The return value will be false, if the consumer is gone.
+        template<typename... Args>
+        bool emplace(Args&&... args) const
+        {
+            return _arc->produce(std::forward<Args>(args)...) == details::attempt::done;
+        }
+
+        template<typename InputIt>
+        std::pair<size_t, bool> push(InputIt first, InputIt last) const
+        {
+            return push_n(block_forever, first, std::distance(first, last));
+        }
+
+        // push writes the items between first and last into the queue.
+        // The amount of successfully written items is returned as the first pair field.
+        // The second pair field will be false if the consumer is gone.
+        template<typename WaitPolicy, typename InputIt, details::enable_if_wait_policy_t<WaitPolicy> = 0>
+        std::pair<size_t, bool> push(WaitPolicy&& policy, InputIt first, InputIt last) const
+        {
+            return push_n(std::forward<WaitPolicy>(policy), first, std::distance(first, last));
+        }
+
+        template<typename InputIt>
+        std::pair<size_t, bool> push_n(InputIt first, size_t count) const
+        {
+            return push_n(block_forever, first, count);
+        }
+
+        // push_n writes count items from first into the queue.
+        // The amount of successfully written items is returned as the first pair field.
+        // The second pair field will be false if the consumer is gone.
+        //
+        // NOTE: Since producers interleave freely, a batch is not stored contiguously in the
+        // queue - but it does come out in order relative to this producer's other items.
+        template<typename WaitPolicy, typename InputIt, details::enable_if_wait_policy_t<WaitPolicy> = 0>
+        std::pair<size_t, bool> push_n(WaitPolicy&&, InputIt first, size_t count) const
+        {
+            size_t written = 0;
+            auto ok = true;
+
+            for (; written < count; ++written, ++first)
+            {
+                details::attempt result;
+                if constexpr (std::remove_reference_t<WaitPolicy>::_block_forever)
+                {
+                    result = _arc->produce(*first);
+                }
+                else
+                {
+                    // Block only until the first item went in; afterwards take what fits.
+                    result = written == 0 ? _arc->produce(*first) : _arc->try_produce(*first);
+                }
+
+                if (result != details::attempt::done)
+                {
+                    ok = result != details::attempt::dead;
+                    break;
+                }
+            }
+
+            return { written, ok };
+        }
+
+    private:
+        void drop() noexcept
+        {
+            if (_arc)
+            {
+                _arc->drop_producer();
+            }
+        }
+
+        details::arc<T>* _arc = nullptr;
+    };
+
+    template<typename T>
+    struct consumer
+    {
+        explicit consumer(details::arc<T>* arc) noexcept :
+            _arc(arc) {}
+
+        consumer<T>(const consumer<T>&) = delete;
+        consumer<T>& operator=(const consumer<T>&) = delete;
+
+        consumer(consumer<T>&& other) noexcept :
+            _arc(std::exchange(other._arc, nullptr))
+        {
+        }
+
+        consumer<T>& operator=(consumer<T>&& other) noexcept
+        {
+            drop();
+            _arc = std::exchange(other._arc, nullptr);
+            return *this;
+        }
+
+        ~consumer()
+        {
+            drop();
+        }
+
+        // pop returns the next item in the queue, or std::nullopt
+        // if all producers are gone and the queue has been drained.
+        std::optional<T> pop() const
+        {
+            if (_arc->consume_acquire() != details::attempt::done)
+            {
+                return std::nullopt;
+            }
+
+            auto item = std::move(*_arc->consume_data());
+            _arc->consume_release();
+            return item;
+        }
+
+        template<typename OutputIt>
+        std::pair<size_t, bool> pop_n(OutputIt first, size_t count) const
+        {
+            return pop_n(block_forever, first, count);
+        }
+
+        // pop_n reads up to count items into first.
+        // The amount of successfully read items is returned as the first pair field.
+        // The second pair field will be false if all producers are gone and the queue is drained.
+        template<typename WaitPolicy, typename OutputIt, details::enable_if_wait_policy_t<WaitPolicy> = 0>
+        std::pair<size_t, bool> pop_n(WaitPolicy&&, OutputIt first, size_t count) const
+        {
+            size_t read = 0;
+            auto ok = true;
+
+            for (; read < count; ++read, ++first)
+            {
+                details::attempt result;
+                if constexpr (std::remove_reference_t<WaitPolicy>::_block_forever)
+                {
+                    result = _arc->consume_acquire();
+                }
+                else
+                {
+                    // Block only until the first item arrived; afterwards take what's there.
+                    result = read == 0 ? _arc->consume_acquire() : _arc->try_consume_acquire();
+                }
+
+                if (result != details::attempt::done)
+                {
+                    ok = result != details::attempt::dead;
+                    break;
+                }
+
+                *first = std::move(*_arc->consume_data());
+                _arc->consume_release();
+            }
+
+            return { read, ok };
+        }
+
+    private:
+        void drop() noexcept
+        {
+            if (_arc)
+            {
+                _arc->drop_consumer();
+            }
+        }
+
+        details::arc<T>* _arc = nullptr;
+    };
+
+    // channel returns a bounded, lock-free, multi-producer, single-consumer
+    // FIFO queue ("channel") with the given maximum capacity, which is
+    // rounded up to the next power of two.
+    // Copy the producer for every sending thread; the consumer is unique.
+    template<typename T>
+    std::pair<producer<T>, consumer<T>> channel(uint32_t capacity)
+    {
+        const auto arc = new details::arc<T>(details::validate_capacity(capacity));
+        return { std::piecewise_construct, std::forward_as_tuple(arc), std::forward_as_tuple(arc) };
+    }
+}
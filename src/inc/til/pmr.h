@@ -70,4 +70,375 @@ namespace til::pmr
         return std::pmr::get_default_resource();
     }
 #endif
+
+    // The resources below supplement the standard ones with the allocation
+    // patterns the terminal hits constantly: short-lived, bursty allocations
+    // whose lifetimes all end together (a composed frame, a parsed chunk of
+    // input) and node-based containers that churn through equally sized
+    // blocks.
+
+    // arena_resource is a chunked monotonic (bump) allocator.
+    // * An allocation advances a pointer through the current chunk. When a
+    //   chunk is exhausted, a progressively larger one is requested from the
+    //   upstream resource.
+    // * Deallocation is deliberately a no-op: everything in the arena is
+    //   given back wholesale by reset() or release(). Objects in the arena
+    //   "wink out" at that point - they must either be trivially
+    //   destructible, or the owner has to run their destructors first.
+    // * reset() rewinds the arena to empty but retains its chunks, so a
+    //   scope that is entered repeatedly (once per frame, say) stops
+    //   touching the upstream resource once it has warmed up.
+    // * release() additionally returns every chunk upstream.
+    class arena_resource final : public std::pmr::memory_resource
+    {
+    public:
+        explicit arena_resource(const size_t initialChunkSize = 4096, std::pmr::memory_resource* const upstream = get_default_resource()) noexcept :
+            _upstream{ upstream },
+            _initialChunkSize{ std::max<size_t>(initialChunkSize, 64) },
+            _nextChunkSize{ _initialChunkSize }
+        {
+        }
+
+        arena_resource(const arena_resource&) = delete;
+        arena_resource& operator=(const arena_resource&) = delete;
+
+        ~arena_resource() override
+        {
+            release();
+        }
+
+        // Rewinds the arena to empty, retaining every chunk for reuse.
+        // Anything previously allocated from the arena winks out.
+        void reset() noexcept
+        {
+            _current = _head;
+            _bump = _current ? _payload(_current) : nullptr;
+            _space = _current ? _current->capacity : 0;
+            _bytesAllocated = 0;
+        }
+
+        // Rewinds the arena to empty and returns all chunks upstream.
+        void release() noexcept
+        {
+            auto chunk = _head;
+            while (chunk)
+            {
+                const auto next = chunk->next;
+                _upstream->deallocate(chunk, sizeof(chunk_header) + chunk->capacity);
+                chunk = next;
+            }
+
+            _head = nullptr;
+            _current = nullptr;
+            _bump = nullptr;
+            _space = 0;
+            _nextChunkSize = _initialChunkSize;
+            _bytesAllocated = 0;
+            _bytesReserved = 0;
+            _chunkCount = 0;
+        }
+
+        // Occupancy statistics, also surfaced through ConsoleTypes.natvis.
+        [[nodiscard]] size_t bytes_allocated() const noexcept
+        {
+            return _bytesAllocated;
+        }
+
+        [[nodiscard]] size_t bytes_reserved() const noexcept
+        {
+            return _bytesReserved;
+        }
+
+        [[nodiscard]] size_t chunk_count() const noexcept
+        {
+            return _chunkCount;
+        }
+
+        [[nodiscard]] std::pmr::memory_resource* upstream_resource() const noexcept
+        {
+            return _upstream;
+        }
+
+    protected:
+        void* do_allocate(const size_t bytes, const size_t align) override
+        {
+            for (;;)
+            {
+                void* ptr = _bump;
+                auto space = _space;
+                if (ptr && std::align(align, bytes, ptr, space))
+                {
+                    _bump = static_cast<std::byte*>(ptr) + bytes;
+                    _space = space - bytes;
+                    _bytesAllocated += bytes;
+                    return ptr;
+                }
+
+                // Chunks always carry `align` slack beyond the request, so the
+                // second time around the std::align above cannot fail.
+                _nextChunk(bytes + align);
+            }
+        }
+
+        void do_deallocate(void* /*ptr*/, size_t /*bytes*/, size_t /*align*/) noexcept override
+        {
+            // Intentionally empty - see reset() and release().
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+    private:
+        struct chunk_header
+        {
+            chunk_header* next;
+            size_t capacity;
+        };
+
+        [[nodiscard]] static std::byte* _payload(chunk_header* const chunk) noexcept
+        {
+            return reinterpret_cast<std::byte*>(chunk + 1);
+        }
+
+        void _nextChunk(const size_t needed)
+        {
+            // A chunk retained across a reset() may already be large enough.
+            if (_current && _current->next && _current->next->capacity >= needed)
+            {
+                _current = _current->next;
+            }
+            else
+            {
+                const auto capacity = std::max(_nextChunkSize, needed);
+                const auto chunk = static_cast<chunk_header*>(_upstream->allocate(sizeof(chunk_header) + capacity));
+                chunk->capacity = capacity;
+
+                if (_current)
+                {
+                    chunk->next = _current->next;
+                    _current->next = chunk;
+                }
+                else
+                {
+                    chunk->next = _head;
+                    _head = chunk;
+                }
+
+                _current = chunk;
+                _nextChunkSize = std::min<size_t>(_nextChunkSize * 2, 1024 * 1024);
+                _bytesReserved += capacity;
+                ++_chunkCount;
+            }
+
+            _bump = _payload(_current);
+            _space = _current->capacity;
+        }
+
+        std::pmr::memory_resource* _upstream;
+        size_t _initialChunkSize;
+        size_t _nextChunkSize;
+        chunk_header* _head = nullptr;
+        chunk_header* _current = nullptr;
+        std::byte* _bump = nullptr;
+        size_t _space = 0;
+        size_t _bytesAllocated = 0;
+        size_t _bytesReserved = 0;
+        size_t _chunkCount = 0;
+    };
+
+    // pool_resource hands out fixed-size blocks for node-based containers
+    // (the nodes of a std::pmr::list, ::map, ::unordered_map, ...). Freed
+    // blocks go onto a free list and are reused before new ones are carved
+    // from an internal arena, so a container that churns through nodes soon
+    // stops allocating altogether. Requests that don't fit the block size
+    // pass through to the upstream resource unchanged.
+    class pool_resource final : public std::pmr::memory_resource
+    {
+    public:
+        explicit pool_resource(const size_t blockSize, std::pmr::memory_resource* const upstream = get_default_resource()) noexcept :
+            _upstream{ upstream },
+            _blockSize{ std::max(blockSize, sizeof(free_block)) },
+            _arena{ _blockSize * 32, upstream }
+        {
+        }
+
+        pool_resource(const pool_resource&) = delete;
+        pool_resource& operator=(const pool_resource&) = delete;
+
+        [[nodiscard]] size_t block_size() const noexcept
+        {
+            return _blockSize;
+        }
+
+        [[nodiscard]] size_t blocks_live() const noexcept
+        {
+            return _blocksLive;
+        }
+
+        [[nodiscard]] size_t blocks_free() const noexcept
+        {
+            return _blocksFree;
+        }
+
+    protected:
+        void* do_allocate(const size_t bytes, const size_t align) override
+        {
+            if (bytes > _blockSize || align > alignof(std::max_align_t))
+            {
+                return _upstream->allocate(bytes, align);
+            }
+
+            ++_blocksLive;
+
+            if (_freeList)
+            {
+                const auto block = _freeList;
+                _freeList = block->next;
+                --_blocksFree;
+                return block;
+            }
+
+            return _arena.allocate(_blockSize, alignof(std::max_align_t));
+        }
+
+        void do_deallocate(void* const ptr, const size_t bytes, const size_t align) override
+        {
+            if (bytes > _blockSize || align > alignof(std::max_align_t))
+            {
+                return _upstream->deallocate(ptr, bytes, align);
+            }
+
+            const auto block = static_cast<free_block*>(ptr);
+            block->next = _freeList;
+            _freeList = block;
+            --_blocksLive;
+            ++_blocksFree;
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+    private:
+        struct free_block
+        {
+            free_block* next;
+        };
+
+        std::pmr::memory_resource* _upstream;
+        size_t _blockSize;
+        arena_resource _arena;
+        free_block* _freeList = nullptr;
+        size_t _blocksLive = 0;
+        size_t _blocksFree = 0;
+    };
+
+    // gauge_resource forwards every request to the upstream resource
+    // unchanged while maintaining a caller-provided atomic byte gauge:
+    // allocations add to it, deallocations subtract. Placed underneath a
+    // pooling resource it therefore measures the memory the pool holds from
+    // the OS, including blocks retained for reuse. The gauge is updated with
+    // relaxed atomics so a monitoring thread can read it at any time without
+    // synchronizing with the allocating thread.
+    class gauge_resource final : public std::pmr::memory_resource
+    {
+    public:
+        explicit gauge_resource(std::atomic<uint64_t>& gauge, std::pmr::memory_resource* const upstream = get_default_resource()) noexcept :
+            _gauge{ gauge },
+            _upstream{ upstream }
+        {
+        }
+
+        gauge_resource(const gauge_resource&) = delete;
+        gauge_resource& operator=(const gauge_resource&) = delete;
+
+        [[nodiscard]] std::pmr::memory_resource* upstream_resource() const noexcept
+        {
+            return _upstream;
+        }
+
+    protected:
+        void* do_allocate(const size_t bytes, const size_t align) override
+        {
+            void* const ptr = _upstream->allocate(bytes, align);
+            _gauge.fetch_add(bytes, std::memory_order_relaxed);
+            return ptr;
+        }
+
+        void do_deallocate(void* const ptr, const size_t bytes, const size_t align) override
+        {
+            _gauge.fetch_sub(bytes, std::memory_order_relaxed);
+            _upstream->deallocate(ptr, bytes, align);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+    private:
+        std::atomic<uint64_t>& _gauge;
+        std::pmr::memory_resource* _upstream;
+    };
+
+    // scratch_arena grants scoped access to a per-thread arena_resource for
+    // transient work, like composing a frame or dispatching a chunk of
+    // input. The destructor resets the arena so the next scope on the same
+    // thread reuses the warmed-up memory; consequently nothing allocated
+    // from it may outlive the scratch_arena. A nested scope on the same
+    // thread falls back to a private arena, so an outer scope's allocations
+    // are never winked out from under it.
+    class scratch_arena
+    {
+    public:
+        scratch_arena()
+        {
+            auto& state = _threadState();
+            if (!state.inUse)
+            {
+                state.inUse = true;
+                _shared = &state;
+            }
+            else
+            {
+                _private.emplace();
+            }
+        }
+
+        scratch_arena(const scratch_arena&) = delete;
+        scratch_arena& operator=(const scratch_arena&) = delete;
+
+        ~scratch_arena()
+        {
+            if (_shared)
+            {
+                _shared->arena.reset();
+                _shared->inUse = false;
+            }
+        }
+
+        [[nodiscard]] arena_resource* resource() noexcept
+        {
+            return _shared ? &_shared->arena : &*_private;
+        }
+
+    private:
+        struct thread_state
+        {
+            arena_resource arena{ 16 * 1024 };
+            bool inUse = false;
+        };
+
+        [[nodiscard]] static thread_state& _threadState() noexcept
+        {
+            static thread_local thread_state state;
+            return state;
+        }
+
+        thread_state* _shared = nullptr;
+        std::optional<arena_resource> _private;
+    };
 }
@@ -520,6 +520,13 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
             _total_length = new_size;
         }
 
+        // Give back run capacity left over from past peaks. The contents are
+        // untouched; only the underlying container's slack is released.
+        void shrink_to_fit()
+        {
+            _runs.shrink_to_fit();
+        }
+
         constexpr bool operator==(const basic_rle& other) const noexcept
         {
             return _total_length == other._total_length && _runs == other._runs;
@@ -854,6 +861,23 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
 
             rle_scanner scanner{ _runs.begin(), _runs.end() };
             auto [begin, begin_pos] = scanner.scan(start_index);
+
+            // Hot path: If the to-be-replaced range is non-empty, lies entirely within a
+            // single existing run and that run already carries the replacement's value,
+            // then the replacement cannot possibly change anything. ATTR_ROW hits this
+            // continuously when text is written with unchanged attributes.
+            if (replacements.size() == 1)
+            {
+                const auto& single = replacements.front();
+                const auto length = static_cast<size_type>(end_index - start_index);
+                if (length != 0 && single.length == length &&
+                    begin->value == single.value &&
+                    static_cast<size_type>(begin->length - begin_pos) >= length)
+                {
+                    return;
+                }
+            }
+
             auto [end, end_pos] = scanner.scan(end_index);
 
             // This condition handles pure removals, where replacements.size() == 0.
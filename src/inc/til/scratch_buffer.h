@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+namespace til
+{
+    // scratch_buffer<C> hands out a per-thread, reusable instance of the
+    // growable container C (std::string, std::wstring, std::vector<T>, ...).
+    // get() returns the buffer cleared, but with its capacity intact, so a
+    // hot loop that acquires one per chunk settles into zero steady-state
+    // allocations. All users of the same container type on the same thread
+    // share one buffer - don't hold the reference across a call that might
+    // acquire it too.
+    //
+    // To keep a single outsized chunk from pinning its worst-case capacity
+    // forever, the buffer periodically trims itself: every trim_period
+    // acquisitions, if the capacity exceeds twice the high-water mark of the
+    // sizes actually used in that window, it reallocates down to that mark.
+    template<typename C>
+    struct scratch_buffer
+    {
+        static C& get()
+        {
+            thread_local state s;
+
+            // The buffer still holds whatever its previous user left in it,
+            // which tells us how big recent uses actually were.
+            s.highWater = std::max(s.highWater, s.buffer.size());
+            s.buffer.clear();
+
+            if (++s.uses >= trim_period)
+            {
+                if (s.buffer.capacity() > s.highWater * 2)
+                {
+                    // shrink_to_fit is non-binding; swapping with a
+                    // right-sized container guarantees the release.
+                    C trimmed;
+                    trimmed.reserve(s.highWater);
+                    s.buffer.swap(trimmed);
+                }
+                s.uses = 0;
+                s.highWater = 0;
+            }
+
+            return s.buffer;
+        }
+
+    private:
+        static constexpr uint32_t trim_period = 256;
+
+        struct state
+        {
+            C buffer;
+            size_t highWater{ 0 };
+            uint32_t uses{ 0 };
+        };
+    };
+}
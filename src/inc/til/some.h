@@ -143,26 +143,56 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
             return _array[pos];
         }
 
+        constexpr reference at(size_type pos)
+        {
+            if (_used <= pos)
+            {
+                _outOfRange();
+            }
+
+            return _array[pos];
+        }
+
         constexpr const_reference operator[](size_type pos) const noexcept
         {
             return _array[pos];
         }
 
+        constexpr reference operator[](size_type pos) noexcept
+        {
+            return _array[pos];
+        }
+
         constexpr const_reference front() const noexcept
         {
             return _array[0];
         }
 
+        constexpr reference front() noexcept
+        {
+            return _array[0];
+        }
+
         constexpr const_reference back() const noexcept
         {
             return _array[_used - 1];
         }
 
+        constexpr reference back() noexcept
+        {
+            return _array[_used - 1];
+        }
+
         constexpr const T* data() const noexcept
         {
             return _array.data();
         }
 
+        constexpr T* data() noexcept
+        {
+            return _array.data();
+        }
+
         constexpr void push_back(const T& val)
         {
             if (_used >= N)
@@ -18,6 +18,14 @@
 // A failure to sort your keys will result in unusual
 // runtime behavior, but no error messages will be
 // generated.
+//
+// til::perfect_map is a drop-in alternative for integral
+// keys. Instead of a binary search it generates a perfect
+// hash function over its keys during construction (at
+// compile time for constexpr instances), so a lookup costs
+// one multiply, one shift and at most one key comparison.
+// Entries may be listed in any order. Prefer it for small,
+// hot tables such as keystroke or sequence dispatch.
 
 namespace til // Terminal Implementation Library. Also: "Today I Learned"
 {
@@ -100,6 +108,121 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
             static_map<K, V, Compare, N, details::presorted_input_t>{ args... } {};
     };
 
+    template<typename K, typename V, size_t N = 0>
+    class perfect_map
+    {
+    public:
+        static_assert(std::is_integral_v<K>, "perfect_map requires an integral key type");
+        static_assert(N > 0 && N < 256, "perfect_map stores slot indices in a byte");
+
+        using const_iterator = typename std::array<std::pair<K, V>, N>::const_iterator;
+
+        template<typename... Args>
+        constexpr explicit perfect_map(const Args&... args) noexcept :
+            _array{ { args... } },
+            _slots{},
+            _seed{}
+        {
+            static_assert(sizeof...(Args) == N);
+
+            // Keeping the slot table at least 8x larger than the key set makes
+            // a randomly chosen multiplier likely to hash all keys without a
+            // collision, so this search terminates after a couple of attempts.
+            uint64_t state = 0;
+            for (;;)
+            {
+                // splitmix64, to generate well-mixed candidate multipliers.
+                state += UINT64_C(0x9e3779b97f4a7c15);
+                auto seed = state;
+                seed = (seed ^ (seed >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+                seed = (seed ^ (seed >> 27)) * UINT64_C(0x94d049bb133111eb);
+                // Multiply-shift hashing requires an odd multiplier.
+                seed = (seed ^ (seed >> 31)) | 1;
+
+                bool collision = false;
+                for (auto& slot : _slots)
+                {
+                    slot = 0;
+                }
+                for (size_t i = 0; i < N; ++i)
+                {
+                    auto& slot = _slots[_hash(_array[i].first, seed)];
+                    if (slot != 0)
+                    {
+                        collision = true;
+                        break;
+                    }
+                    slot = static_cast<uint8_t>(i + 1);
+                }
+
+                if (!collision)
+                {
+                    _seed = seed;
+                    return;
+                }
+            }
+        }
+
+        [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+        {
+            const auto slot = _slots[_hash(key, _seed)];
+
+            if (slot == 0 || _array[slot - 1].first != key)
+            {
+                return _array.end();
+            }
+
+            return _array.begin() + (slot - 1);
+        }
+
+        [[nodiscard]] constexpr const_iterator end() const noexcept
+        {
+            return _array.end();
+        }
+
+        [[nodiscard]] constexpr const V& at(const K& key) const
+        {
+            const auto iter{ find(key) };
+
+            if (iter == end())
+            {
+                throw std::runtime_error("key not found");
+            }
+
+            return iter->second;
+        }
+
+        [[nodiscard]] constexpr const V& operator[](const K& key) const
+        {
+            return at(key);
+        }
+
+    private:
+        static constexpr size_t _tableBits() noexcept
+        {
+            size_t bits = 3;
+            while ((size_t{ 1 } << bits) < N * 8)
+            {
+                ++bits;
+            }
+            return bits;
+        }
+
+        [[nodiscard]] static constexpr size_t _hash(const K& key, const uint64_t seed) noexcept
+        {
+            // The topmost bits of the product are the best mixed ones,
+            // so the slot index is taken from there.
+            const auto k = static_cast<uint64_t>(static_cast<std::make_unsigned_t<K>>(key));
+            return static_cast<size_t>((k * seed) >> (64 - _tableBits()));
+        }
+
+        // Each slot holds the index of the pair it maps to, offset by
+        // one so that 0 can mean "no key hashes here".
+        std::array<std::pair<K, V>, N> _array;
+        std::array<uint8_t, size_t{ 1 } << _tableBits()> _slots;
+        uint64_t _seed;
+    };
+
     // this is a deduction guide that ensures two things:
     // 1. static_map's member types are all the same
     // 2. static_map's fourth template argument (otherwise undeduced) is how many pairs it contains
@@ -108,4 +231,7 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
 
     template<typename First, typename... Rest>
     presorted_static_map(First, Rest...) -> presorted_static_map<std::conditional_t<std::conjunction_v<std::is_same<First, Rest>...>, typename First::first_type, void>, typename First::second_type, std::less<typename First::first_type>, 1 + sizeof...(Rest)>;
+
+    template<typename First, typename... Rest>
+    perfect_map(First, Rest...) -> perfect_map<std::conditional_t<std::conjunction_v<std::is_same<First, Rest>...>, typename First::first_type, void>, typename First::second_type, 1 + sizeof...(Rest)>;
 }
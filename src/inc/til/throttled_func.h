@@ -30,6 +30,22 @@ namespace til
                 }
             }
 
+            template<typename M, typename... MakeArgs>
+            bool merge(M m, MakeArgs&&... args)
+            {
+                std::unique_lock guard{ _lock };
+                const bool hadValue = _pendingRunArgs.has_value();
+                if (hadValue)
+                {
+                    std::apply([&](auto&... pending) { m(pending..., std::forward<MakeArgs>(args)...); }, *_pendingRunArgs);
+                }
+                else
+                {
+                    _pendingRunArgs.emplace(std::forward<MakeArgs>(args)...);
+                }
+                return hadValue;
+            }
+
             std::tuple<Args...> take()
             {
                 std::unique_lock guard{ _lock };
@@ -98,16 +114,34 @@ namespace til
         //
         // After `func` was invoked the state is reset and this cycle is repeated again.
         throttled_func(filetime_duration delay, function func) :
+            throttled_func{ delay, delay, std::move(func) }
+        {
+        }
+
+        // The adaptive variant: invocations during quiet periods are serviced
+        // after `delay`, but every busy cycle - one where further invocations
+        // arrived while the timer ran and had to be coalesced - doubles the
+        // next wait, up to `maxLatency`. A quiet cycle snaps the wait back to
+        // `delay`. This keeps the func responsive when events trickle in,
+        // while bursts get coalesced ever more aggressively, and no pending
+        // invocation ever waits longer than `maxLatency`.
+        throttled_func(filetime_duration delay, filetime_duration maxLatency, function func) :
             _func{ std::move(func) },
             _timer{ _createTimer() }
         {
-            const auto d = -delay.count();
-            if (d >= 0)
+            const auto d = delay.count();
+            if (d <= 0)
             {
                 throw std::invalid_argument("non-positive delay specified");
             }
+            if (maxLatency.count() < d)
+            {
+                throw std::invalid_argument("maxLatency shorter than delay");
+            }
 
-            memcpy(&_delay, &d, sizeof(d));
+            _minDelay = d;
+            _maxDelay = maxLatency.count();
+            _currentDelay.store(d, std::memory_order_relaxed);
         }
 
         // throttled_func uses its `this` pointer when creating _timer.
@@ -124,12 +158,28 @@ namespace til
         template<typename... MakeArgs>
         void operator()(MakeArgs&&... args)
         {
+            _callsThisCycle.fetch_add(1, std::memory_order_relaxed);
             if (!_storage.emplace(std::forward<MakeArgs>(args)...))
             {
                 _leading_edge();
             }
         }
 
+        // Like operator(), but when an invocation is already pending, `merge`
+        // is invoked as merge(pending..., args...) to fold the new arguments
+        // into the pending ones instead of replacing them. Make sure `merge`
+        // takes the pending arguments by reference. Use this when the function
+        // consumes accumulated deltas rather than last-writer-wins state.
+        template<typename M, typename... MakeArgs>
+        void accumulate(M merge, MakeArgs&&... args)
+        {
+            _callsThisCycle.fetch_add(1, std::memory_order_relaxed);
+            if (!_storage.merge(merge, std::forward<MakeArgs>(args)...))
+            {
+                _leading_edge();
+            }
+        }
+
         // Modifies the pending arguments for the next function
         // invocation, if there is one pending currently.
         //
@@ -172,11 +222,24 @@ namespace til
                 _func();
             }
 
-            SetThreadpoolTimerEx(_timer.get(), &_delay, 0, 0);
+            // Negative times in SetThreadpoolTimerEx are relative.
+            const auto d = -_currentDelay.load(std::memory_order_relaxed);
+            FILETIME delay;
+            memcpy(&delay, &d, sizeof(d));
+            SetThreadpoolTimerEx(_timer.get(), &delay, 0, 0);
         }
 
         void _trailing_edge()
         {
+            // A single invocation opened this cycle. If more arrived while the
+            // timer ran, the producer is bursting: widen the next window (up
+            // to the latency bound) so that each run coalesces more work. A
+            // quiet cycle snaps the window back to the configured delay.
+            const auto calls = _callsThisCycle.exchange(0, std::memory_order_relaxed);
+            const auto current = _currentDelay.load(std::memory_order_relaxed);
+            const auto next = calls > 1 ? std::min(current * 2, _maxDelay) : _minDelay;
+            _currentDelay.store(next, std::memory_order_relaxed);
+
             if constexpr (leading)
             {
                 _storage.reset();
@@ -194,7 +257,10 @@ namespace til
             return timer;
         }
 
-        FILETIME _delay;
+        int64_t _minDelay;
+        int64_t _maxDelay;
+        std::atomic<int64_t> _currentDelay;
+        std::atomic<uint32_t> _callsThisCycle{ 0 };
         function _func;
         wil::unique_threadpool_timer _timer;
         details::throttled_func_storage<Args...> _storage;
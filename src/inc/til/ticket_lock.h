@@ -7,6 +7,23 @@
 
 namespace til
 {
+#ifdef TIL_TICKET_LOCK_STATISTICS
+    // Contention telemetry for the ticket locks below. It's only compiled in
+    // when TIL_TICKET_LOCK_STATISTICS is defined, because even relaxed
+    // counter increments add cache traffic to locks that are hot by
+    // definition. The numbers answer the questions we otherwise infer
+    // indirectly from ETW stacks: how often is the lock contended, how long
+    // do we spin/sleep for it, and how long is it held.
+    struct ticket_lock_statistics
+    {
+        uint64_t acquisitions = 0; // total lock() calls
+        uint64_t contended = 0; // lock() calls that found the lock taken
+        uint64_t spins = 0; // pause iterations across all lock() calls
+        uint64_t sleeps = 0; // WaitOnAddress round trips
+        uint64_t hold_time_qpc = 0; // QPC ticks spent between lock() and unlock()
+    };
+#endif
+
     // ticket_lock implements a classic fair lock.
     //
     // Compared to a SRWLOCK this implementation is significantly more unsafe to use:
@@ -23,6 +40,11 @@ namespace til
         {
             const auto ticket = _next_ticket.fetch_add(1, std::memory_order_relaxed);
 
+#ifdef TIL_TICKET_LOCK_STATISTICS
+            _stat_acquisitions.fetch_add(1, std::memory_order_relaxed);
+            auto contended = false;
+#endif
+
             for (;;)
             {
                 const auto current = _now_serving.load(std::memory_order_acquire);
@@ -31,17 +53,56 @@ namespace til
                     break;
                 }
 
+#ifdef TIL_TICKET_LOCK_STATISTICS
+                if (!contended)
+                {
+                    contended = true;
+                    _stat_contended.fetch_add(1, std::memory_order_relaxed);
+                }
+                _stat_sleeps.fetch_add(1, std::memory_order_relaxed);
+#endif
                 til::atomic_wait(_now_serving, current);
             }
+
+#ifdef TIL_TICKET_LOCK_STATISTICS
+            LARGE_INTEGER now;
+            QueryPerformanceCounter(&now);
+            _hold_start = now.QuadPart;
+#endif
         }
 
         void unlock() noexcept
         {
+#ifdef TIL_TICKET_LOCK_STATISTICS
+            LARGE_INTEGER now;
+            QueryPerformanceCounter(&now);
+            _stat_hold.fetch_add(static_cast<uint64_t>(now.QuadPart - _hold_start), std::memory_order_relaxed);
+#endif
             _now_serving.fetch_add(1, std::memory_order_release);
             til::atomic_notify_all(_now_serving);
         }
 
+#ifdef TIL_TICKET_LOCK_STATISTICS
+        // A (racy, approximate) snapshot of the telemetry counters.
+        [[nodiscard]] ticket_lock_statistics statistics() const noexcept
+        {
+            ticket_lock_statistics stats;
+            stats.acquisitions = _stat_acquisitions.load(std::memory_order_relaxed);
+            stats.contended = _stat_contended.load(std::memory_order_relaxed);
+            stats.sleeps = _stat_sleeps.load(std::memory_order_relaxed);
+            stats.hold_time_qpc = _stat_hold.load(std::memory_order_relaxed);
+            return stats;
+        }
+#endif
+
     private:
+#ifdef TIL_TICKET_LOCK_STATISTICS
+        std::atomic<uint64_t> _stat_acquisitions{ 0 };
+        std::atomic<uint64_t> _stat_contended{ 0 };
+        std::atomic<uint64_t> _stat_sleeps{ 0 };
+        std::atomic<uint64_t> _stat_hold{ 0 };
+        int64_t _hold_start = 0; // only ever touched by the lock owner
+#endif
         // You may be inclined to add alignas(std::hardware_destructive_interference_size)
         // here to force the two atomics on separate cache lines, but I suggest to carefully
         // benchmark such a change. Since this ticket_lock is primarily used to synchronize
@@ -53,4 +114,111 @@ namespace til
         std::atomic<uint32_t> _next_ticket{ 0 };
         std::atomic<uint32_t> _now_serving{ 0 };
     };
+
+    // spaced_ticket_lock is ticket_lock for the cases the comment above warns
+    // about: more than 2 threads contending. The two counters live on separate
+    // cache lines, so the arriving threads hammering _next_ticket don't steal
+    // the line the waiting threads are polling. Additionally lock() backs off
+    // proportionally to the queue position: the next-in-line waiter burns a
+    // short pause loop (it'll get the lock in nanoseconds, a kernel sleep
+    // would only add latency), while everyone further back goes straight to
+    // WaitOnAddress instead of wasting a core.
+    //
+    // The same usage caveats as for ticket_lock apply: unbalanced lock/unlock
+    // calls deadlock the lock permanently, so pair it with std::unique_lock
+    // or std::scoped_lock.
+    struct spaced_ticket_lock
+    {
+        void lock() noexcept
+        {
+            const auto ticket = _next_ticket.fetch_add(1, std::memory_order_relaxed);
+
+#ifdef TIL_TICKET_LOCK_STATISTICS
+            _stat_acquisitions.fetch_add(1, std::memory_order_relaxed);
+            auto contended = false;
+#endif
+
+            for (;;)
+            {
+                auto current = _now_serving.load(std::memory_order_acquire);
+                if (current == ticket)
+                {
+                    break;
+                }
+
+#ifdef TIL_TICKET_LOCK_STATISTICS
+                if (!contended)
+                {
+                    contended = true;
+                    _stat_contended.fetch_add(1, std::memory_order_relaxed);
+                }
+#endif
+
+                if (ticket - current == 1)
+                {
+                    // We're next in line: spin for a bit before sleeping.
+                    for (auto i = 0; i < 64 && current != ticket; ++i)
+                    {
+                        YieldProcessor();
+#ifdef TIL_TICKET_LOCK_STATISTICS
+                        _stat_spins.fetch_add(1, std::memory_order_relaxed);
+#endif
+                        current = _now_serving.load(std::memory_order_acquire);
+                    }
+                    if (current == ticket)
+                    {
+                        break;
+                    }
+                }
+
+#ifdef TIL_TICKET_LOCK_STATISTICS
+                _stat_sleeps.fetch_add(1, std::memory_order_relaxed);
+#endif
+                til::atomic_wait(_now_serving, current);
+            }
+
+#ifdef TIL_TICKET_LOCK_STATISTICS
+            LARGE_INTEGER now;
+            QueryPerformanceCounter(&now);
+            _hold_start = now.QuadPart;
+#endif
+        }
+
+        void unlock() noexcept
+        {
+#ifdef TIL_TICKET_LOCK_STATISTICS
+            LARGE_INTEGER now;
+            QueryPerformanceCounter(&now);
+            _stat_hold.fetch_add(static_cast<uint64_t>(now.QuadPart - _hold_start), std::memory_order_relaxed);
+#endif
+            _now_serving.fetch_add(1, std::memory_order_release);
+            til::atomic_notify_all(_now_serving);
+        }
+
+#ifdef TIL_TICKET_LOCK_STATISTICS
+        // A (racy, approximate) snapshot of the telemetry counters.
+        [[nodiscard]] ticket_lock_statistics statistics() const noexcept
+        {
+            ticket_lock_statistics stats;
+            stats.acquisitions = _stat_acquisitions.load(std::memory_order_relaxed);
+            stats.contended = _stat_contended.load(std::memory_order_relaxed);
+            stats.spins = _stat_spins.load(std::memory_order_relaxed);
+            stats.sleeps = _stat_sleeps.load(std::memory_order_relaxed);
+            stats.hold_time_qpc = _stat_hold.load(std::memory_order_relaxed);
+            return stats;
+        }
+#endif
+
+    private:
+#ifdef TIL_TICKET_LOCK_STATISTICS
+        std::atomic<uint64_t> _stat_acquisitions{ 0 };
+        std::atomic<uint64_t> _stat_contended{ 0 };
+        std::atomic<uint64_t> _stat_spins{ 0 };
+        std::atomic<uint64_t> _stat_sleeps{ 0 };
+        std::atomic<uint64_t> _stat_hold{ 0 };
+        int64_t _hold_start = 0; // only ever touched by the lock owner
+#endif
+        alignas(std::hardware_destructive_interference_size) std::atomic<uint32_t> _next_ticket{ 0 };
+        alignas(std::hardware_destructive_interference_size) std::atomic<uint32_t> _now_serving{ 0 };
+    };
 }
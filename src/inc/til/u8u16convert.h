@@ -14,6 +14,10 @@ could overcome disadvantages of syscalls. Test results can be read up
 in PR #4093 and the test algorithms are available in src\tools\U8U16Test.
 Based on the results the decision was made to keep using the platform
 functions MultiByteToWideChar and WideCharToMultiByte.
+As an amendment to that, profiling the ConPTY output path showed that the
+bulk of the transferred data is plain ASCII, which maps 1:1 to UTF-16.
+Leading ASCII runs are now widened directly and only the remainder is
+handed to the platform functions.
 
 Author(s):
 - Steffen Illhardt (german-one), Leonard Hecker (lhecker) 2020-2021
@@ -36,6 +40,56 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
         }
     };
 
+    namespace details
+    {
+#pragma warning(push)
+#pragma warning(disable : 26429 26481) // use not_null, pointer arithmetic
+        // Routine Description:
+        // - Converts the leading run of ASCII-only bytes, returning how many bytes
+        //   were handled. ASCII maps 1:1 to UTF-16 and makes up nearly all of the
+        //   data moved through the ConPTY pipe, so this shortcut avoids the call
+        //   into MultiByteToWideChar for the common case entirely. The bytes are
+        //   tested eight at a time against their high bits, and the widening loop
+        //   is trivial enough for the compiler to vectorize.
+        // Arguments:
+        // - in8 - pointer to the UTF-8 data
+        // - len8 - number of bytes available
+        // - out16 - pointer to the UTF-16 output (room for at least len8 code units)
+        // Return Value:
+        // - the number of leading ASCII bytes that have been converted
+        inline int u8u16ConvertAscii(const char* in8, const int len8, wchar_t* out16) noexcept
+        {
+            int converted{ 0 };
+
+            // Eight bytes at a time: any set high bit means a non-ASCII byte.
+            while (len8 - converted >= 8)
+            {
+                uint64_t eightBytes;
+                memcpy(&eightBytes, in8 + converted, sizeof(eightBytes));
+                if (eightBytes & 0x8080808080808080u)
+                {
+                    break;
+                }
+
+                for (int i = 0; i < 8; ++i)
+                {
+                    out16[converted + i] = gsl::narrow_cast<wchar_t>(in8[converted + i]);
+                }
+                converted += 8;
+            }
+
+            // ...and the stragglers one by one.
+            while (converted < len8 && !(in8[converted] & 0x80))
+            {
+                out16[converted] = gsl::narrow_cast<wchar_t>(in8[converted]);
+                ++converted;
+            }
+
+            return converted;
+        }
+#pragma warning(pop)
+    }
+
     // state structure for maintenance of UTF-16 partials
     struct u16state
     {
@@ -47,6 +101,8 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
         }
     };
 
+#pragma warning(push)
+#pragma warning(disable : 26481) // pointer arithmetic
     // Routine Description:
     // - Takes a UTF-8 string and performs the conversion to UTF-16. NOTE: The function relies on getting complete UTF-8 characters at the string boundaries.
     // Arguments:
@@ -70,13 +126,23 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
             // The worst ratio of UTF-8 code units to UTF-16 code units is 1 to 1 if UTF-8 consists of ASCII only.
             RETURN_HR_IF(E_ABORT, !base::MakeCheckedNum(in.length()).AssignIfValid(&lengthRequired));
             out.resize(in.length()); // avoid to call MultiByteToWideChar twice only to get the required size
-            const int lengthOut = MultiByteToWideChar(CP_UTF8, 0ul, in.data(), lengthRequired, out.data(), lengthRequired);
-            out.resize(gsl::narrow_cast<size_t>(lengthOut));
 
-            return lengthOut == 0 ? E_UNEXPECTED : S_OK;
+            // widen any leading ASCII directly, and let the platform function deal with the rest
+            int lengthOut = details::u8u16ConvertAscii(in.data(), lengthRequired, out.data());
+            if (lengthOut < lengthRequired)
+            {
+                const int convLen = MultiByteToWideChar(CP_UTF8, 0ul, in.data() + lengthOut, lengthRequired - lengthOut, out.data() + lengthOut, lengthRequired - lengthOut);
+                RETURN_HR_IF(E_UNEXPECTED, !convLen);
+
+                lengthOut += convLen;
+            }
+
+            out.resize(gsl::narrow_cast<size_t>(lengthOut));
+            return S_OK;
         }
         CATCH_RETURN();
     }
+#pragma warning(pop)
 
 #pragma warning(push)
 #pragma warning(disable : 26429 26446 26459 26481 26482) // use not_null, subscript operator, use span, pointer arithmetic, dynamic array indexing
@@ -158,10 +224,16 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
 
             if (len8)
             {
-                const auto convLen{ MultiByteToWideChar(CP_UTF8, 0UL, cursor8, len8, out.data() + len16, capa16) };
-                RETURN_HR_IF(E_UNEXPECTED, !convLen);
+                // widen any leading ASCII directly, and let the platform function deal with the rest
+                const auto asciiLen{ details::u8u16ConvertAscii(cursor8, len8, out.data() + len16) };
+                len16 += asciiLen;
+                if (asciiLen < len8)
+                {
+                    const auto convLen{ MultiByteToWideChar(CP_UTF8, 0UL, cursor8 + asciiLen, len8 - asciiLen, out.data() + len16, capa16 - asciiLen) };
+                    RETURN_HR_IF(E_UNEXPECTED, !convLen);
 
-                len16 += convLen;
+                    len16 += convLen;
+                }
             }
 
             out.resize(gsl::narrow_cast<size_t>(len16));
@@ -40,8 +40,9 @@ static CodepointWidth GetQuickCharWidthLegacyForNumpadEventSynthesis(const wchar
     return CodepointWidth::Invalid;
 }
 
-std::deque<std::unique_ptr<KeyEvent>> Microsoft::Console::Interactivity::CharToKeyEvents(const wchar_t wch,
-                                                                                         const unsigned int codepage)
+void Microsoft::Console::Interactivity::CharToKeyEvents(const wchar_t wch,
+                                                        const unsigned int codepage,
+                                                        std::deque<std::unique_ptr<IInputEvent>>& keyEvents)
 {
     const short invalidKey = -1;
     short keyState = VkKeyScanW(wch);
@@ -61,13 +62,14 @@ std::deque<std::unique_ptr<KeyEvent>> Microsoft::Console::Interactivity::CharToK
                 // It wasn't alphanumeric or determined to be wide by the old algorithm
                 // if VkKeyScanW fails (char is not in kbd layout), we must
                 // emulate the key being input through the numpad
-                return SynthesizeNumpadEvents(wch, codepage);
+                SynthesizeNumpadEvents(wch, codepage, keyEvents);
+                return;
             }
         }
         keyState = 0; // SynthesizeKeyboardEvents would rather get 0 than -1
     }
 
-    return SynthesizeKeyboardEvents(wch, keyState);
+    SynthesizeKeyboardEvents(wch, keyState, keyEvents);
 }
 
 // Routine Description:
@@ -75,17 +77,20 @@ std::deque<std::unique_ptr<KeyEvent>> Microsoft::Console::Interactivity::CharToK
 // using the keyboard
 // Arguments:
 // - wch - the wchar_t to convert
+// - keyState - the keyboard state of the key, as returned by VkKeyScanW
+// - keyEvents - the deque to append the synthesized KeyEvents to
 // Return Value:
-// - deque of KeyEvents that represent the wchar_t being typed
+// - <none>
 // Note:
 // - will throw exception on error
-std::deque<std::unique_ptr<KeyEvent>> Microsoft::Console::Interactivity::SynthesizeKeyboardEvents(const wchar_t wch, const short keyState)
+void Microsoft::Console::Interactivity::SynthesizeKeyboardEvents(const wchar_t wch,
+                                                                 const short keyState,
+                                                                 std::deque<std::unique_ptr<IInputEvent>>& keyEvents)
 {
     const byte modifierState = HIBYTE(keyState);
 
     bool altGrSet = false;
     bool shiftSet = false;
-    std::deque<std::unique_ptr<KeyEvent>> keyEvents;
 
     // add modifier key event if necessary
     if (WI_AreAllFlagsSet(modifierState, VkKeyScanModState::CtrlAndAltPressed))
@@ -151,8 +156,6 @@ std::deque<std::unique_ptr<KeyEvent>> Microsoft::Console::Interactivity::Synthes
                                                        UNICODE_NULL,
                                                        0));
     }
-
-    return keyEvents;
 }
 
 // Routine Description:
@@ -160,15 +163,16 @@ std::deque<std::unique_ptr<KeyEvent>> Microsoft::Console::Interactivity::Synthes
 // using Alt + numpad
 // Arguments:
 // - wch - the wchar_t to convert
+// - codepage - the codepage to use to convert the wchar_t
+// - keyEvents - the deque to append the synthesized KeyEvents to
 // Return Value:
-// - deque of KeyEvents that represent the wchar_t being typed using
-// alt + numpad
+// - <none>
 // Note:
 // - will throw exception on error
-std::deque<std::unique_ptr<KeyEvent>> Microsoft::Console::Interactivity::SynthesizeNumpadEvents(const wchar_t wch, const unsigned int codepage)
+void Microsoft::Console::Interactivity::SynthesizeNumpadEvents(const wchar_t wch,
+                                                               const unsigned int codepage,
+                                                               std::deque<std::unique_ptr<IInputEvent>>& keyEvents)
 {
-    std::deque<std::unique_ptr<KeyEvent>> keyEvents;
-
     //alt keydown
     keyEvents.push_back(std::make_unique<KeyEvent>(true,
                                                    1ui16,
@@ -224,5 +228,4 @@ std::deque<std::unique_ptr<KeyEvent>> Microsoft::Console::Interactivity::Synthes
                                                    altScanCode,
                                                    wch,
                                                    0));
-    return keyEvents;
 }
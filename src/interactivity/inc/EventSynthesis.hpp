@@ -20,10 +20,19 @@ Author:
 
 namespace Microsoft::Console::Interactivity
 {
-    std::deque<std::unique_ptr<KeyEvent>> CharToKeyEvents(const wchar_t wch, const unsigned int codepage);
-
-    std::deque<std::unique_ptr<KeyEvent>> SynthesizeKeyboardEvents(const wchar_t wch,
-                                                                   const short keyState);
-
-    std::deque<std::unique_ptr<KeyEvent>> SynthesizeNumpadEvents(const wchar_t wch, const unsigned int codepage);
+    // These append the synthesized events to the given deque, so that long
+    // strings (pasted text in particular) can be batched into a single
+    // collection of events without a round trip through an intermediate
+    // container for every character.
+    void CharToKeyEvents(const wchar_t wch,
+                         const unsigned int codepage,
+                         std::deque<std::unique_ptr<IInputEvent>>& keyEvents);
+
+    void SynthesizeKeyboardEvents(const wchar_t wch,
+                                  const short keyState,
+                                  std::deque<std::unique_ptr<IInputEvent>>& keyEvents);
+
+    void SynthesizeNumpadEvents(const wchar_t wch,
+                                const unsigned int codepage,
+                                std::deque<std::unique_ptr<IInputEvent>>& keyEvents);
 }
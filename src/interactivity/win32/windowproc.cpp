@@ -173,6 +173,22 @@ using namespace Microsoft::Console::Types;
         break;
     }
 
+    case WM_ENTERSIZEMOVE:
+    {
+        // The user started interactively sizing or moving the window. Defer
+        // buffer resizes until the drag completes so each intermediate size
+        // doesn't rebuild the buffer while we hold the console lock.
+        ScreenInfo.BeginDeferredWindowResize();
+        goto CallDefWin;
+    }
+
+    case WM_EXITSIZEMOVE:
+    {
+        // Drag finished; apply the last captured size in one shot.
+        ScreenInfo.EndDeferredWindowResize();
+        goto CallDefWin;
+    }
+
     case WM_GETDPISCALEDSIZE:
     {
         // This message will send us the DPI we're about to be changed to.
@@ -87,8 +87,12 @@ constexpr HRESULT vec2_narrow(U x, U y, AtlasEngine::vec2<T>& out) noexcept
         // BeginPaint() protects against invalid out of bounds numbers.
         // TODO: rect can contain invalid out of bounds coordinates when the selection is being
         // dragged outside of the viewport (and the window begins scrolling automatically).
-        _api.invalidatedRows.x = gsl::narrow_cast<u16>(std::min<int>(_api.invalidatedRows.x, std::max<int>(0, rect.Top)));
-        _api.invalidatedRows.y = gsl::narrow_cast<u16>(std::max<int>(_api.invalidatedRows.y, std::max<int>(0, rect.Bottom)));
+        //
+        // The selection is drawn by the pixel shader from the Selected cell flags and doesn't
+        // depend on the glyph data of the affected rows. Tracking its damage separately from
+        // invalidatedRows means dragging a selection never re-shapes the text underneath.
+        _api.invalidatedSelectionRows.x = gsl::narrow_cast<u16>(std::min<int>(_api.invalidatedSelectionRows.x, std::max<int>(0, rect.Top)));
+        _api.invalidatedSelectionRows.y = gsl::narrow_cast<u16>(std::max<int>(_api.invalidatedSelectionRows.y, std::max<int>(0, rect.Bottom)));
     }
     return S_OK;
 }
@@ -110,6 +114,9 @@ constexpr HRESULT vec2_narrow(U x, U y, AtlasEngine::vec2<T>& out) noexcept
     _api.invalidatedCursorArea.top = gsl::narrow_cast<u16>(clamp<int>(_api.invalidatedCursorArea.top + delta, u16min, u16max));
     _api.invalidatedCursorArea.bottom = gsl::narrow_cast<u16>(clamp<int>(_api.invalidatedCursorArea.bottom + delta, u16min, u16max));
 
+    _api.invalidatedSelectionRows.x = gsl::narrow_cast<u16>(clamp<int>(_api.invalidatedSelectionRows.x + delta, u16min, u16max));
+    _api.invalidatedSelectionRows.y = gsl::narrow_cast<u16>(clamp<int>(_api.invalidatedSelectionRows.y + delta, u16min, u16max));
+
     if (delta < 0)
     {
         _api.invalidatedRows.x = gsl::narrow_cast<u16>(clamp<int>(_api.invalidatedRows.x + delta, u16min, u16max));
@@ -245,6 +252,12 @@ CATCH_RETURN()
     return S_OK;
 }
 
+[[nodiscard]] HRESULT AtlasEngine::GetSelectionDirtyArea(gsl::span<const til::rect>& area) noexcept
+{
+    area = gsl::span{ &_api.selectionDirtyRect, 1 };
+    return S_OK;
+}
+
 [[nodiscard]] HRESULT AtlasEngine::GetFontSize(_Out_ COORD* const pFontSize) noexcept
 {
     RETURN_HR_IF_NULL(E_INVALIDARG, pFontSize);
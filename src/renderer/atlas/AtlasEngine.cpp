@@ -307,6 +307,7 @@ try
         // Skip all the partial updates, since we redraw everything anyways.
         _api.invalidatedCursorArea = invalidatedAreaNone;
         _api.invalidatedRows = { 0, _api.cellCount.y };
+        _api.invalidatedSelectionRows = { 0, _api.cellCount.y };
         _api.scrollOffset = 0;
     }
     else
@@ -322,6 +323,10 @@ try
             _api.invalidatedRows.x = std::min(_api.invalidatedRows.x, _api.cellCount.y);
             _api.invalidatedRows.y = clamp(_api.invalidatedRows.y, _api.invalidatedRows.x, _api.cellCount.y);
         }
+        {
+            _api.invalidatedSelectionRows.x = std::min(_api.invalidatedSelectionRows.x, _api.cellCount.y);
+            _api.invalidatedSelectionRows.y = clamp(_api.invalidatedSelectionRows.y, _api.invalidatedSelectionRows.x, _api.cellCount.y);
+        }
         {
             const auto limit = gsl::narrow_cast<i16>(_api.cellCount.y & 0x7fff);
             _api.scrollOffset = gsl::narrow_cast<i16>(clamp<int>(_api.scrollOffset, -limit, limit));
@@ -363,6 +368,20 @@ try
 
             memmove(dst, src, count * sizeof(Cell));
         }
+
+        // Rows that left the selection, but aren't getting their text repainted this
+        // frame, would keep their stale Selected flags forever. Wipe the flags across
+        // the selection-invalidated rows; PaintSelection() re-applies the current ones.
+        if (_api.invalidatedSelectionRows.x < _api.invalidatedSelectionRows.y)
+        {
+            const SMALL_RECT rect{
+                0,
+                gsl::narrow_cast<SHORT>(_api.invalidatedSelectionRows.x),
+                gsl::narrow_cast<SHORT>(_api.cellCount.x),
+                gsl::narrow_cast<SHORT>(_api.invalidatedSelectionRows.y),
+            };
+            _setCellFlags(rect, CellFlags::Selected, CellFlags::None);
+        }
     }
 
     _api.dirtyRect = til::rect{
@@ -371,6 +390,15 @@ try
         _api.cellCount.x,
         _api.invalidatedRows.y,
     };
+    // The selection overlay is drawn from the Selected cell flags and doesn't require
+    // re-shaping a row's text, but it does need its flags rewritten wherever the text
+    // was (PaintBufferLine() resets them). GetSelectionDirtyArea() reports the union.
+    _api.selectionDirtyRect = til::rect{
+        0,
+        std::min(_api.invalidatedRows.x, _api.invalidatedSelectionRows.x),
+        _api.cellCount.x,
+        std::max(_api.invalidatedRows.y, _api.invalidatedSelectionRows.y),
+    };
 
     return S_OK;
 }
@@ -387,6 +415,7 @@ try
 
     _api.invalidatedCursorArea = invalidatedAreaNone;
     _api.invalidatedRows = invalidatedRowsNone;
+    _api.invalidatedSelectionRows = invalidatedRowsNone;
     _api.scrollOffset = 0;
     return S_OK;
 }
@@ -967,9 +996,47 @@ void AtlasEngine::_recreateFontDependentResources()
         _r.atlasPosition.x = _api.fontMetrics.cellSize.x;
         _r.atlasPosition.y = 0;
 
+        // The glyph table we're about to drop is a ready-made census of every
+        // codepoint currently observed on screen. Rather than starting the new
+        // font cold and rasterizing reactively - a miss storm across the first
+        // repaint - we remember those glyphs and re-queue them against the new
+        // font below, together with the printable ASCII set. The first
+        // Present() then realizes all of them in one batched parallel pass
+        // (see _buildGlyphLayouts). The color-glyph flag is carried over from
+        // the old font, as determining it anew would require running font
+        // fallback here; a font change altering whether a codepoint maps to a
+        // color font is exceedingly rare.
+        struct PrewarmGlyph
+        {
+            AtlasKeyAttributes attributes;
+            CellFlags flags;
+            std::wstring chars;
+        };
+        std::vector<PrewarmGlyph> prewarm;
+        prewarm.reserve(_r.glyphs.size());
+        for (const auto& [key, value] : _r.glyphs)
+        {
+            const auto keyData = key.data();
+            const auto valueData = value.data();
+            prewarm.push_back(PrewarmGlyph{ keyData->attributes, valueData->flags & CellFlags::ColoredGlyph, { &keyData->chars[0], keyData->charCount } });
+        }
+
         _r.glyphs = {};
         _r.glyphQueue = {};
         _r.glyphQueue.reserve(64);
+
+        {
+            AtlasKeyAttributes attributes{};
+            attributes.cellCount = 1;
+            for (auto ch = L' '; ch <= L'~'; ++ch)
+            {
+                _prewarmGlyph(attributes, 1, &ch, CellFlags::None);
+            }
+        }
+        for (const auto& glyph : prewarm)
+        {
+            _prewarmGlyph(glyph.attributes, gsl::narrow_cast<u16>(glyph.chars.size()), glyph.chars.data(), glyph.flags);
+        }
     }
     // D3D specifically for UpdateDpi()
     // This compensates for the built in scaling factor in a XAML SwapChainPanel (CompositionScaleX/Y).
@@ -1498,3 +1565,28 @@ void AtlasEngine::_emplaceGlyph(IDWriteFontFace* fontFace, size_t bufferPos1, si
         data[i].color = _api.bufferLineMetadata[static_cast<size_t>(x1) + i].colors;
     }
 }
+
+// Inserts a glyph into the atlas map and rasterization queue without
+// touching any cells, used to warm the atlas ahead of the first frame that
+// needs it. When the same key later arrives through _emplaceGlyph, the
+// glyph is already realized and the lookup is a plain hit.
+void AtlasEngine::_prewarmGlyph(AtlasKeyAttributes attributes, u16 charCount, const wchar_t* chars, CellFlags flags)
+{
+    const auto [it, inserted] = _r.glyphs.emplace(std::piecewise_construct, std::forward_as_tuple(attributes, charCount, chars), std::forward_as_tuple());
+    if (!inserted)
+    {
+        return;
+    }
+
+    const auto& key = it->first;
+    auto& value = it->second;
+
+    const auto coords = value.initialize(flags, attributes.cellCount);
+    for (u16 i = 0; i < attributes.cellCount; ++i)
+    {
+        coords[i] = _allocateAtlasTile();
+    }
+
+    _r.glyphQueue.push_back(AtlasQueueItem{ &key, &value });
+    _r.maxEncounteredCellCount = std::max(_r.maxEncounteredCellCount, attributes.cellCount);
+}
@@ -51,6 +51,7 @@ namespace Microsoft::Console::Render
         [[nodiscard]] HRESULT UpdateViewport(SMALL_RECT srNewViewport) noexcept override;
         [[nodiscard]] HRESULT GetProposedFont(const FontInfoDesired& FontInfoDesired, _Out_ FontInfo& FontInfo, int iDpi) noexcept override;
         [[nodiscard]] HRESULT GetDirtyArea(gsl::span<const til::rect>& area) noexcept override;
+        [[nodiscard]] HRESULT GetSelectionDirtyArea(gsl::span<const til::rect>& area) noexcept override;
         [[nodiscard]] HRESULT GetFontSize(_Out_ COORD* pFontSize) noexcept override;
         [[nodiscard]] HRESULT IsGlyphWideByFont(std::wstring_view glyph, _Out_ bool* pResult) noexcept override;
         [[nodiscard]] HRESULT UpdateTitle(std::wstring_view newTitle) noexcept override;
@@ -529,6 +530,9 @@ namespace Microsoft::Console::Render
         {
             const AtlasKey* key;
             const AtlasValue* value;
+            // Filled in by _buildGlyphLayouts() (possibly on a worker thread)
+            // before _drawGlyph() consumes it on the render thread.
+            wil::com_ptr<IDWriteTextLayout> textLayout;
         };
 
         struct CachedCursorOptions
@@ -616,6 +620,7 @@ namespace Microsoft::Console::Render
         u16x2 _allocateAtlasTile() noexcept;
         void _flushBufferLine();
         void _emplaceGlyph(IDWriteFontFace* fontFace, size_t bufferPos1, size_t bufferPos2);
+        void _prewarmGlyph(AtlasKeyAttributes attributes, u16 charCount, const wchar_t* chars, CellFlags flags);
 
         // AtlasEngine.api.cpp
         void _resolveAntialiasingMode() noexcept;
@@ -628,7 +633,9 @@ namespace Microsoft::Console::Render
         void _adjustAtlasSize();
         void _reserveScratchpadSize(u16 minWidth);
         void _processGlyphQueue();
-        void _drawGlyph(const AtlasQueueItem& item) const;
+        void _buildGlyphLayouts();
+        void _createTextLayout(AtlasQueueItem& item) const;
+        void _drawGlyph(const AtlasQueueItem& item, u16 scratchpadPosition) const;
         void _drawCursor();
         void _copyScratchpadTile(uint32_t scratchpadIndex, u16x2 target, uint32_t copyFlags = 0) const noexcept;
 
@@ -752,9 +759,12 @@ namespace Microsoft::Console::Render
 
             // dirtyRect is a computed value based on invalidatedRows.
             til::rect dirtyRect;
+            // selectionDirtyRect is the same, but additionally covers invalidatedSelectionRows.
+            til::rect selectionDirtyRect;
             // These "invalidation" fields are reset in EndPaint()
             u16r invalidatedCursorArea = invalidatedAreaNone;
             u16x2 invalidatedRows = invalidatedRowsNone; // x is treated as "top" and y as "bottom"
+            u16x2 invalidatedSelectionRows = invalidatedRowsNone; // same as invalidatedRows, but only for Selected flags
             i16 scrollOffset = 0;
 
             std::function<void(HRESULT)> warningCallback;
@@ -286,7 +286,9 @@ void AtlasEngine::_reserveScratchpadSize(u16 minWidth)
         _r.brush = brush.query<ID2D1Brush>();
     }
 
-    _r.scratchpadCellWidth = _r.maxEncounteredCellCount;
+    // Remember the actual width we allocated (and not just minWidth), so that
+    // _processGlyphQueue knows how many glyphs it can batch into the scratchpad.
+    _r.scratchpadCellWidth = gsl::narrow_cast<u16>(newWidth);
     WI_SetAllFlags(_r.invalidations, RenderInvalidations::ConstBuffer);
 }
 
@@ -297,31 +299,173 @@ void AtlasEngine::_processGlyphQueue()
         return;
     }
 
-    for (const auto& pair : _r.glyphQueue)
+    // Rasterizing glyphs one at a time forces D2D to flush its entire command
+    // batch on every EndDraw. During startup and after font changes - when every
+    // glyph on the screen is new - those flushes dominate the time to first paint.
+    // We thus grow the scratchpad so that several glyphs fit side by side and
+    // rasterize the queue in batches, paying for one BeginDraw/EndDraw pair per
+    // batch instead of per glyph.
+    u32 queuedCells = 0;
+    for (const auto& item : _r.glyphQueue)
     {
-        _drawGlyph(pair);
+        queuedCells += item.key->data()->attributes.cellCount;
+    }
+    // _reserveScratchpadSize never shrinks the scratchpad, so this can't undercut
+    // the maxEncounteredCellCount reservation that Present() already made.
+    _reserveScratchpadSize(gsl::narrow_cast<u16>(std::min<u32>(queuedCells, 64)));
+
+    _buildGlyphLayouts();
+
+    const auto end = _r.glyphQueue.end();
+    for (auto it = _r.glyphQueue.begin(); it != end;)
+    {
+        const auto batchBegin = it;
+        u32 pos = 0;
+
+        _r.d2dRenderTarget->BeginDraw();
+
+        // Draw glyphs until the next one doesn't fit into the scratchpad anymore.
+        // The first glyph of a batch always fits, as Present() reserves a
+        // scratchpad at least maxEncounteredCellCount cells wide.
+        for (; it != end; ++it)
+        {
+            const u32 cells = it->key->data()->attributes.cellCount;
+            if (pos + cells > _r.scratchpadCellWidth)
+            {
+                break;
+            }
+            _drawGlyph(*it, gsl::narrow_cast<u16>(pos));
+            pos += cells;
+        }
+
+        THROW_IF_FAILED(_r.d2dRenderTarget->EndDraw());
+
+        // Only now that EndDraw flushed the contents into the scratchpad
+        // texture can we copy the finished tiles out into the atlas.
+        pos = 0;
+        for (auto copyIt = batchBegin; copyIt != it; ++copyIt)
+        {
+            const auto value = copyIt->value->data();
+            const u32 cells = copyIt->key->data()->attributes.cellCount;
+            for (u32 i = 0; i < cells; ++i)
+            {
+                // Specifying NO_OVERWRITE means that the system can assume that existing references to the surface that
+                // may be in flight on the GPU will not be affected by the update, so the copy can proceed immediately
+                // (avoiding either a batch flush or the system maintaining multiple copies of the resource behind the scenes).
+                //
+                // Since our shader only draws whatever is in the atlas, and since we don't replace glyph tiles that are in use,
+                // we can safely (?) tell the GPU that we don't overwrite parts of our atlas that are in use.
+                _copyScratchpadTile(pos + i, value->coords[i], D3D11_COPY_NO_OVERWRITE);
+            }
+            pos += cells;
+        }
     }
 
     _r.glyphQueue.clear();
 }
 
-void AtlasEngine::_drawGlyph(const AtlasQueueItem& item) const
+// Builds the IDWriteTextLayout for every queued glyph, spreading the work
+// across the CPU when the queue is deep. Creating the layout is the
+// CPU-expensive half of a glyph miss - it runs DirectWrite's segmentation,
+// font fallback and shaping for the glyph's text - and it parallelizes
+// cleanly: the DirectWrite factory is free-threaded and every queue item
+// gets its own layout object. The D2D draws and atlas copies that consume
+// the layouts can't follow suit, because the D2D render target and the D3D
+// device context are single-threaded objects; they stay on the render
+// thread, where DrawTextLayout merely replays the cached analysis.
+void AtlasEngine::_buildGlyphLayouts()
+{
+    const auto count = _r.glyphQueue.size();
+
+    // Below this many misses per thread, spinning up the thread costs more
+    // than the layouts it would build. Steady-state frames rarely queue more
+    // than a couple of glyphs and take the serial path.
+    static constexpr size_t minimumItemsPerThread = 8;
+    const auto hardwareThreads = static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency()));
+    const auto threadCount = std::min(hardwareThreads, count / minimumItemsPerThread);
+
+    if (threadCount <= 1)
+    {
+        for (auto& item : _r.glyphQueue)
+        {
+            _createTextLayout(item);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next{ 0 };
+    std::atomic<HRESULT> failure{ S_OK };
+
+    const auto worker = [&]() noexcept {
+        for (;;)
+        {
+            const auto i = next.fetch_add(1, std::memory_order_relaxed);
+            if (i >= count || failure.load(std::memory_order_relaxed) != S_OK)
+            {
+                break;
+            }
+
+            try
+            {
+                _createTextLayout(_r.glyphQueue[i]);
+            }
+            catch (...)
+            {
+                HRESULT expected = S_OK;
+                failure.compare_exchange_strong(expected, wil::ResultFromCaughtException());
+                break;
+            }
+        }
+    };
+
+    // This thread is one of the workers; spin up the rest.
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (size_t i = 1; i < threadCount; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // If a build failed the frame fails as a whole; the queue stays intact
+    // and the next Present() picks up whatever layouts were already built.
+    THROW_IF_FAILED(failure.load());
+}
+
+void AtlasEngine::_createTextLayout(AtlasQueueItem& item) const
 {
+    // A failed frame retries the whole queue; don't rebuild survivors.
+    if (item.textLayout)
+    {
+        return;
+    }
+
     const auto key = item.key->data();
-    const auto value = item.value->data();
-    const auto coords = &value->coords[0];
     const auto charsLength = key->charCount;
     const auto cells = static_cast<u32>(key->attributes.cellCount);
     const auto textFormat = _getTextFormat(key->attributes.bold, key->attributes.italic);
-    const auto coloredGlyph = WI_IsFlagSet(value->flags, CellFlags::ColoredGlyph);
 
     // See D2DFactory::DrawText
-    wil::com_ptr<IDWriteTextLayout> textLayout;
-    THROW_IF_FAILED(_sr.dwriteFactory->CreateTextLayout(&key->chars[0], charsLength, textFormat, cells * _r.cellSizeDIP.x, _r.cellSizeDIP.y, textLayout.addressof()));
+    THROW_IF_FAILED(_sr.dwriteFactory->CreateTextLayout(&key->chars[0], charsLength, textFormat, cells * _r.cellSizeDIP.x, _r.cellSizeDIP.y, item.textLayout.put()));
     if (_r.typography)
     {
-        textLayout->SetTypography(_r.typography.get(), { 0, charsLength });
+        item.textLayout->SetTypography(_r.typography.get(), { 0, charsLength });
     }
+}
+
+// Rasterizes a single glyph into the scratchpad at the given cell offset.
+// The caller is expected to wrap any number of these calls into a single
+// BeginDraw/EndDraw pair and copy the tiles out afterwards (see _processGlyphQueue).
+void AtlasEngine::_drawGlyph(const AtlasQueueItem& item, u16 scratchpadPosition) const
+{
+    const auto key = item.key->data();
+    const auto value = item.value->data();
+    const auto cells = static_cast<u32>(key->attributes.cellCount);
+    const auto coloredGlyph = WI_IsFlagSet(value->flags, CellFlags::ColoredGlyph);
 
     auto options = D2D1_DRAW_TEXT_OPTIONS_NONE;
     // D2D1_DRAW_TEXT_OPTIONS_ENABLE_COLOR_FONT enables a bunch of internal machinery
@@ -337,25 +481,23 @@ void AtlasEngine::_drawGlyph(const AtlasQueueItem& item) const
         _r.d2dRenderTarget->SetTextAntialiasMode(coloredGlyph ? D2D1_TEXT_ANTIALIAS_MODE_GRAYSCALE : D2D1_TEXT_ANTIALIAS_MODE_CLEARTYPE);
     }
 
-    _r.d2dRenderTarget->BeginDraw();
-    // We could call
-    //   _r.d2dRenderTarget->PushAxisAlignedClip(&rect, D2D1_ANTIALIAS_MODE_ALIASED);
-    // now to reduce the surface that needs to be cleared, but this decreases
-    // performance by 10% (tested using debugGlyphGenerationPerformance).
-    _r.d2dRenderTarget->Clear();
-    _r.d2dRenderTarget->DrawTextLayout({}, textLayout.get(), _r.brush.get(), options);
-    THROW_IF_FAILED(_r.d2dRenderTarget->EndDraw());
+    // Since we're sharing the scratchpad with the other glyphs of the batch we
+    // have to clip this draw call to our own slice of it: glyphs may overhang
+    // their layout box (italics commonly do) and would otherwise contaminate
+    // the tiles of their neighbors. The clip also conveniently limits Clear()
+    // to just this slice. A clip costs us about 10% per glyph (tested using
+    // debugGlyphGenerationPerformance), but that's far outweighed by sharing
+    // one BeginDraw/EndDraw pair - and thus one D2D flush - across the batch.
+    D2D1_RECT_F rect;
+    rect.left = scratchpadPosition * _r.cellSizeDIP.x;
+    rect.top = 0.0f;
+    rect.right = rect.left + cells * _r.cellSizeDIP.x;
+    rect.bottom = _r.cellSizeDIP.y;
 
-    for (uint32_t i = 0; i < cells; ++i)
-    {
-        // Specifying NO_OVERWRITE means that the system can assume that existing references to the surface that
-        // may be in flight on the GPU will not be affected by the update, so the copy can proceed immediately
-        // (avoiding either a batch flush or the system maintaining multiple copies of the resource behind the scenes).
-        //
-        // Since our shader only draws whatever is in the atlas, and since we don't replace glyph tiles that are in use,
-        // we can safely (?) tell the GPU that we don't overwrite parts of our atlas that are in use.
-        _copyScratchpadTile(i, coords[i], D3D11_COPY_NO_OVERWRITE);
-    }
+    _r.d2dRenderTarget->PushAxisAlignedClip(&rect, D2D1_ANTIALIAS_MODE_ALIASED);
+    _r.d2dRenderTarget->Clear();
+    _r.d2dRenderTarget->DrawTextLayout({ rect.left, 0.0f }, item.textLayout.get(), _r.brush.get(), options);
+    _r.d2dRenderTarget->PopAxisAlignedClip();
 }
 
 void AtlasEngine::_drawCursor()
@@ -7,6 +7,7 @@
 #define WIN32_LEAN_AND_MEAN
 
 #include <array>
+#include <atomic>
 #include <filesystem>
 #include <optional>
 #include <sstream>
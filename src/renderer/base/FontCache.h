@@ -82,15 +82,38 @@ namespace Microsoft::Console::Render::FontCache
                 return systemFontCollection;
             }
         }
+
+        inline wil::com_ptr<IDWriteFontCollection> getCachedFontCollection(bool forceUpdate)
+        {
+            static std::mutex mutex;
+            static wil::com_ptr<IDWriteFontCollection> collection;
+
+            std::lock_guard guard{ mutex };
+            if (forceUpdate || !collection)
+            {
+                collection = getFontCollection(forceUpdate);
+            }
+            return collection;
+        }
     }
 
+    // Returns the process-wide font collection. The collection is the same for
+    // every renderer in the process (the system fonts, plus any .ttf files next
+    // to our binary), but merging the two font sets isn't free, so it's built
+    // once and shared between all DxEngine/AtlasEngine instances. IDWriteFontCollection
+    // is agile and immutable, so handing the same instance to every render
+    // thread is safe.
     inline wil::com_ptr<IDWriteFontCollection> GetCached()
     {
-        return details::getFontCollection(false);
+        return details::getCachedFontCollection(false);
     }
 
+    // Rebuilds the collection with a freshly enumerated set of system fonts and
+    // replaces the cached instance, so that fonts installed since the last call
+    // show up. Existing renderers pick the new collection up the next time
+    // their font settings change.
     inline wil::com_ptr<IDWriteFontCollection> GetFresh()
     {
-        return details::getFontCollection(true);
+        return details::getCachedFontCollection(true);
     }
 }
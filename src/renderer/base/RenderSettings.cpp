@@ -39,6 +39,7 @@ void RenderSettings::SetRenderMode(const Mode mode, const bool enabled) noexcept
     {
         _blinkShouldBeFaint = false;
     }
+    _InvalidateColorCache();
 }
 
 // Routine Description:
@@ -64,6 +65,7 @@ const std::array<COLORREF, TextColor::TABLE_SIZE>& RenderSettings::GetColorTable
 void RenderSettings::ResetColorTable() noexcept
 {
     InitializeColorTable({ _colorTable.data(), 16 });
+    _InvalidateColorCache();
 }
 
 // Routine Description:
@@ -80,22 +82,29 @@ void RenderSettings::MakeAdjustedColorArray() noexcept
     colorTableWithDefaults[AdjustedFgIndex] = GetColorAlias(ColorAlias::DefaultForeground);
     colorTableWithDefaults[AdjustedBgIndex] = GetColorAlias(ColorAlias::DefaultBackground);
 
+    // Convert the palette to Lab once up front; every entry takes part in 34
+    // of the pairings below, and GetPerceivableColor would otherwise redo
+    // both conversions for each pair.
+    std::array<ColorFix, 18> labTableWithDefaults;
+    std::transform(colorTableWithDefaults.begin(), colorTableWithDefaults.end(), labTableWithDefaults.begin(), [](const auto color) noexcept { return ColorFix{ color }; });
+
     for (auto fgIndex = 0; fgIndex < 18; ++fgIndex)
     {
-        const auto fg = til::at(colorTableWithDefaults, fgIndex);
+        const auto& fg = til::at(labTableWithDefaults, fgIndex);
         for (auto bgIndex = 0; bgIndex < 18; ++bgIndex)
         {
             if (fgIndex == bgIndex)
             {
-                _adjustedForegroundColors[bgIndex][fgIndex] = fg;
+                _adjustedForegroundColors[bgIndex][fgIndex] = fg.rgb;
             }
             else
             {
-                const auto bg = til::at(colorTableWithDefaults, bgIndex);
+                const auto& bg = til::at(labTableWithDefaults, bgIndex);
                 _adjustedForegroundColors[bgIndex][fgIndex] = ColorFix::GetPerceivableColor(fg, bg);
             }
         }
     }
+    _InvalidateColorCache();
 }
 
 // Routine Description:
@@ -106,6 +115,7 @@ void RenderSettings::MakeAdjustedColorArray() noexcept
 void RenderSettings::SetColorTableEntry(const size_t tableIndex, const COLORREF color)
 {
     _colorTable.at(tableIndex) = color;
+    _InvalidateColorCache();
 }
 
 // Routine Description:
@@ -150,6 +160,7 @@ COLORREF RenderSettings::GetColorAlias(const ColorAlias alias) const
 void RenderSettings::SetColorAliasIndex(const ColorAlias alias, const size_t tableIndex) noexcept
 {
     gsl::at(_colorAliasIndices, static_cast<size_t>(alias)) = tableIndex;
+    _InvalidateColorCache();
 }
 
 // Routine Description:
@@ -164,16 +175,52 @@ size_t RenderSettings::GetColorAliasIndex(const ColorAlias alias) const noexcept
 }
 
 // Routine Description:
-// - Calculates the RGB colors of a given text attribute, using the current
-//   color table configuration and active render settings.
+// - Retrieves the RGB colors of a given text attribute, using the current
+//   color table configuration and active render settings. The resolution is
+//   memoized: a frame resolves one attribute per run painted, but usually
+//   contains only a handful of distinct attributes, so most calls are
+//   answered out of a small cache of recent results.
 // Arguments:
 // - attr - The TextAttribute to retrieve the colors for.
 // Return Value:
 // - The color values of the attribute's foreground and background.
 std::pair<COLORREF, COLORREF> RenderSettings::GetAttributeColors(const TextAttribute& attr) const noexcept
 {
+    // The blink usage flag has to track every attribute that passes through
+    // here, whether or not its colors were already resolved.
     _blinkIsInUse = _blinkIsInUse || attr.IsBlinking();
 
+    for (size_t i = 0; i < _resolvedColorsUsed; i++)
+    {
+        const auto& entry = til::at(_resolvedColors, i);
+        if (entry.attr == attr)
+        {
+            return entry.colors;
+        }
+    }
+
+    const auto colors = _CalculateAttributeColors(attr);
+
+    // Cache the result in round-robin fashion; with as few distinct
+    // attributes as frames typically hold, evictions are rare.
+    auto& entry = til::at(_resolvedColors, _resolvedColorsNext);
+    entry.attr = attr;
+    entry.colors = colors;
+    _resolvedColorsNext = (_resolvedColorsNext + 1) % _resolvedColors.size();
+    _resolvedColorsUsed = std::min(_resolvedColorsUsed + 1, _resolvedColors.size());
+
+    return colors;
+}
+
+// Routine Description:
+// - Calculates the RGB colors of a given text attribute from scratch. Callers
+//   go through GetAttributeColors, which memoizes these results.
+// Arguments:
+// - attr - The TextAttribute to retrieve the colors for.
+// Return Value:
+// - The color values of the attribute's foreground and background.
+std::pair<COLORREF, COLORREF> RenderSettings::_CalculateAttributeColors(const TextAttribute& attr) const noexcept
+{
     const auto fgTextColor = attr.GetForeground();
     const auto bgTextColor = attr.GetBackground();
 
@@ -276,6 +323,12 @@ try
         _blinkCycle = (_blinkCycle + 1) % 4;
         // ... and two of those four render the blink attributes as faint.
         _blinkShouldBeFaint = _blinkCycle >= 2;
+        // The faint phase takes part in color resolution, so cached results
+        // don't survive a change of phase.
+        if (_blinkCycle % 2 == 0)
+        {
+            _InvalidateColorCache();
+        }
         // Every two cycles (when the state changes), we need to trigger a
         // redraw, but only if there are actually blink attributes in use.
         if (_blinkIsInUse && _blinkCycle % 2 == 0)
@@ -288,3 +341,29 @@ try
     }
 }
 CATCH_LOG()
+
+// Routine Description:
+// - Returns the current color generation. The generation advances whenever
+//   any input to color resolution changes - the color table, the color
+//   aliases, the adjusted foreground array, a render mode, or the blink
+//   faint phase - so anything downstream that caches resolved colors can
+//   remember the generation it resolved against and compare instead of
+//   diffing the palette.
+// Return Value:
+// - A number that changes whenever resolved colors may have changed.
+uint64_t RenderSettings::GetColorGeneration() const noexcept
+{
+    return _colorGeneration;
+}
+
+// Routine Description:
+// - Discards the memoized attribute color resolutions and advances the color
+//   generation. Called whenever any input to the resolution changes: the
+//   color table, the color aliases, the adjusted foreground array, a render
+//   mode, or the blink faint phase.
+void RenderSettings::_InvalidateColorCache() noexcept
+{
+    _resolvedColorsUsed = 0;
+    _resolvedColorsNext = 0;
+    _colorGeneration++;
+}
@@ -4,6 +4,8 @@
 #include "precomp.h"
 #include "renderer.hpp"
 
+#include "../../inc/ConsolePerfCounters.h"
+
 #pragma hdrstop
 
 using namespace Microsoft::Console::Render;
@@ -141,6 +143,26 @@ try
         }
     });
 
+    // If someone is tracing frames, take a timestamp as each phase below
+    // finishes so the whole frame can be reported as one event at the end.
+    // When nobody is listening this all costs a single boolean check.
+    const auto tracingFrame = _tracing.IsFrameTracingEnabled();
+    auto timestamp = tracingFrame ? RenderTracing::Now() : 0;
+    int64_t prepareTicks = 0;
+    int64_t backgroundTicks = 0;
+    int64_t textTicks = 0;
+    int64_t decorationsTicks = 0;
+    int64_t endPaintTicks = 0;
+    int64_t presentTicks = 0;
+    const auto markPhase = [&](int64_t& ticks) {
+        if (tracingFrame)
+        {
+            const auto now = RenderTracing::Now();
+            ticks = now - timestamp;
+            timestamp = now;
+        }
+    };
+
     // A. Prep Colors
     RETURN_IF_FAILED(_UpdateDrawingBrushes(pEngine, {}, false, true));
 
@@ -150,11 +172,29 @@ try
     // C. Prepare the engine with additional information before we start drawing.
     RETURN_IF_FAILED(_PrepareRenderInfo(pEngine));
 
+    // The dirty area is settled now: record how much of the frame the engine
+    // actually considers damaged before the paint phases consume it.
+    size_t dirtyRects = 0;
+    size_t dirtyCells = 0;
+    if (tracingFrame)
+    {
+        gsl::span<const til::rect> dirtyAreas;
+        LOG_IF_FAILED(pEngine->GetDirtyArea(dirtyAreas));
+        dirtyRects = dirtyAreas.size();
+        for (const auto& dirtyRect : dirtyAreas)
+        {
+            dirtyCells += dirtyRect.size().area<size_t>();
+        }
+    }
+    markPhase(prepareTicks);
+
     // 1. Paint Background
     RETURN_IF_FAILED(_PaintBackground(pEngine));
+    markPhase(backgroundTicks);
 
     // 2. Paint Rows of Text
     _PaintBufferOutput(pEngine);
+    markPhase(textTicks);
 
     // 3. Paint overlays that reside above the text buffer
     _PaintOverlays(pEngine);
@@ -167,15 +207,37 @@ try
 
     // 6. Paint window title
     RETURN_IF_FAILED(_PaintTitle(pEngine));
+    markPhase(decorationsTicks);
 
     // Force scope exit end paint to finish up collecting information and possibly painting
     endPaint.reset();
+    markPhase(endPaintTicks);
 
     // Force scope exit unlock to let go of global lock so other threads can run
     unlock.reset();
 
     // Trigger out-of-lock presentation for renderers that can support it
-    RETURN_IF_FAILED(pEngine->Present());
+    const auto hrPresent = pEngine->Present();
+    markPhase(presentTicks);
+
+    if (tracingFrame)
+    {
+        _tracing.TraceFrame(pEngine, dirtyRects, dirtyCells, prepareTicks, backgroundTicks, textTicks, decorationsTicks, endPaintTicks, presentTicks);
+    }
+
+    RETURN_IF_FAILED(hrPresent);
+
+    {
+        auto& counters = PerfCounters::Instance();
+        counters.framesPainted.fetch_add(1, std::memory_order_relaxed);
+
+        // If a keystroke's echo was waiting on this frame, its round trip
+        // ends now that the frame has reached the screen.
+        LARGE_INTEGER now, frequency;
+        QueryPerformanceCounter(&now);
+        QueryPerformanceFrequency(&frequency);
+        counters.NotePresent(now.QuadPart, frequency.QuadPart);
+    }
 
     // As we leave the scope, EndPaint will be called (declared above)
     return S_OK;
@@ -219,10 +281,26 @@ void Renderer::TriggerRedraw(const Viewport& region)
     Viewport view = _viewport;
     SMALL_RECT srUpdateRegion = region.ToExclusive();
 
+    // Writes above or below the viewport are commonplace - pagers and
+    // full-screen apps redraw content that's scrolled out of sight - and
+    // none of that damage is visible. Bail before the double-width scan
+    // below touches any of the affected rows; with compressed scrollback
+    // in play, reading them wouldn't just be wasted work, it would
+    // rehydrate rows nobody is looking at. If the region scrolls into
+    // view later, the scroll path invalidates the revealed area itself.
+    if (srUpdateRegion.Bottom <= view.Top() || srUpdateRegion.Top > view.BottomInclusive())
+    {
+        return;
+    }
+
     // If the dirty region has double width lines, we need to double the size of
     // the right margin to make sure all the affected cells are invalidated.
+    // Only the rows that are actually in view matter: the rest get trimmed
+    // away below, and examining them would touch scrolled-out rows.
     const auto& buffer = _pData->GetTextBuffer();
-    for (auto row = srUpdateRegion.Top; row < srUpdateRegion.Bottom; row++)
+    const auto firstVisibleRow = std::max(srUpdateRegion.Top, view.Top());
+    const auto lastVisibleRowExclusive = std::min(srUpdateRegion.Bottom, view.BottomExclusive());
+    for (auto row = firstVisibleRow; row < lastVisibleRowExclusive; row++)
     {
         if (buffer.IsDoubleWidthLine(row))
         {
@@ -368,15 +446,58 @@ void Renderer::TriggerSelection()
             sr = Viewport::FromInclusive(rc.to_small_rect()).ToExclusive();
         }
 
-        FOREACH_ENGINE(pEngine)
+        // Only invalidate the rows whose selected span actually changed.
+        // Extending a selection re-triggers this on every mouse move, and
+        // re-invalidating the full old and new regions repaints every
+        // selected row each time; the difference is usually a single row.
+        // Both lists hold one rect per row ordered by Top, so this is a
+        // simple merge walk.
+        std::vector<SMALL_RECT> invalidPrevious;
+        std::vector<SMALL_RECT> invalidCurrent;
+        invalidPrevious.reserve(_previousSelection.size());
+        invalidCurrent.reserve(rects.size());
+
+        auto prevIt = _previousSelection.cbegin();
+        auto currIt = rects.cbegin();
+        while (prevIt != _previousSelection.cend() || currIt != rects.cend())
+        {
+            if (currIt == rects.cend() || (prevIt != _previousSelection.cend() && prevIt->Top < currIt->Top))
+            {
+                // Row is no longer selected.
+                invalidPrevious.push_back(*prevIt++);
+            }
+            else if (prevIt == _previousSelection.cend() || currIt->Top < prevIt->Top)
+            {
+                // Row is newly selected.
+                invalidCurrent.push_back(*currIt++);
+            }
+            else
+            {
+                // Same row in both; repaint it only if its span moved.
+                if (prevIt->Left != currIt->Left ||
+                    prevIt->Right != currIt->Right ||
+                    prevIt->Bottom != currIt->Bottom)
+                {
+                    invalidPrevious.push_back(*prevIt);
+                    invalidCurrent.push_back(*currIt);
+                }
+                ++prevIt;
+                ++currIt;
+            }
+        }
+
+        if (!invalidPrevious.empty() || !invalidCurrent.empty())
         {
-            LOG_IF_FAILED(pEngine->InvalidateSelection(_previousSelection));
-            LOG_IF_FAILED(pEngine->InvalidateSelection(rects));
+            FOREACH_ENGINE(pEngine)
+            {
+                LOG_IF_FAILED(pEngine->InvalidateSelection(invalidPrevious));
+                LOG_IF_FAILED(pEngine->InvalidateSelection(invalidCurrent));
+            }
+
+            NotifyPaintFrame();
         }
 
         _previousSelection = std::move(rects);
-
-        NotifyPaintFrame();
     }
     CATCH_LOG();
 }
@@ -439,6 +560,28 @@ void Renderer::TriggerScroll()
 // - <none>
 void Renderer::TriggerScroll(const COORD* const pcoordDelta)
 {
+    // When the user has scrolled back to read while output keeps circling the
+    // buffer, the viewport is pinned to the content it's showing: it moves up
+    // in exact lockstep with the rotation and nothing on screen changes. Sync
+    // our viewport so the paint-time check doesn't rediscover the movement,
+    // and swallow the notification - there's nothing to scroll or repaint.
+    const SMALL_RECT srOldViewport = _viewport.ToInclusive();
+    const SMALL_RECT srNewViewport = _pData->GetViewport().ToInclusive();
+    if (srNewViewport.Left - srOldViewport.Left == pcoordDelta->X &&
+        srNewViewport.Top - srOldViewport.Top == pcoordDelta->Y &&
+        srNewViewport.Right - srOldViewport.Right == pcoordDelta->X &&
+        srNewViewport.Bottom - srOldViewport.Bottom == pcoordDelta->Y)
+    {
+        _viewport = Viewport::FromInclusive(srNewViewport);
+
+        FOREACH_ENGINE(pEngine)
+        {
+            LOG_IF_FAILED(pEngine->UpdateViewport(srNewViewport));
+        }
+
+        return;
+    }
+
     FOREACH_ENGINE(pEngine)
     {
         LOG_IF_FAILED(pEngine->InvalidateScroll(pcoordDelta));
@@ -449,6 +592,46 @@ void Renderer::TriggerScroll(const COORD* const pcoordDelta)
     NotifyPaintFrame();
 }
 
+// Routine Description:
+// - Called when a full-width band of the buffer has scrolled vertically while
+//      the rest of the viewport stayed put - a client scrolling inside
+//      DECSTBM margins, for instance. Engines that can replay the scroll on
+//      their backing surface only need to repaint the rows it revealed;
+//      engines that can't will treat the band as ordinary damage.
+// Arguments:
+// - region - The buffer-space region whose contents shifted.
+// - pcoordDelta - The distance the region's contents moved.
+// Return Value:
+// - <none>
+void Renderer::TriggerScrollRegion(const Viewport& region, const COORD* const pcoordDelta)
+{
+    Viewport view = _viewport;
+    SMALL_RECT srScrollRegion = region.ToExclusive();
+
+    // A region scroll can't describe what happens to rows with double-width
+    // line renditions, so fall back to invalidating the band outright.
+    const auto& buffer = _pData->GetTextBuffer();
+    for (auto row = srScrollRegion.Top; row < srScrollRegion.Bottom; row++)
+    {
+        if (buffer.IsDoubleWidthLine(row))
+        {
+            TriggerRedraw(region);
+            return;
+        }
+    }
+
+    if (view.TrimToViewport(&srScrollRegion))
+    {
+        view.ConvertToOrigin(&srScrollRegion);
+        FOREACH_ENGINE(pEngine)
+        {
+            LOG_IF_FAILED(pEngine->InvalidateScrollRegion(&srScrollRegion, pcoordDelta));
+        }
+
+        NotifyPaintFrame();
+    }
+}
+
 // Routine Description:
 // - Called when the text buffer is about to circle its backing buffer.
 //      A renderer might want to get painted before that happens.
@@ -641,6 +824,23 @@ void Renderer::EnablePainting()
     }
 }
 
+// Routine Description:
+// - Switches the render thread between full cadence and the reduced cadence
+//   used for backgrounded targets (an unfocused pane). Promotion takes
+//   effect immediately; demotion from the next frame on.
+// Arguments:
+// - backgrounded - true to pace paints down, false to restore full cadence.
+// Return Value:
+// - <none>
+void Renderer::SetBackgroundCadence(const bool backgrounded) noexcept
+{
+    // When running the unit tests, we may be using a render without a render thread.
+    if (_pThread)
+    {
+        _pThread->SetBackgroundCadence(backgrounded);
+    }
+}
+
 // Routine Description:
 // - Waits for the current paint operation to complete, if any, up to the specified timeout.
 // - Resets an event in the render thread that precludes it from advancing, thus disabling rendering.
@@ -773,8 +973,10 @@ void Renderer::_PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine,
 
         // Retrieve the first color.
         auto color = it->TextAttr();
-        // Retrieve the first pattern id
-        auto patternIds = _pData->GetPatternId(target);
+        // Retrieve the first pattern id. The pattern id vectors are members so
+        // their storage is reused from frame to frame rather than reallocated
+        // for every cell we inspect below.
+        _pData->GetPatternId(target, _runPatternIds);
         // Determine whether we're using a soft font.
         auto usingSoftFont = s_IsSoftFontChar(it->Chars(), _firstSoftFontChar, _lastSoftFontChar);
 
@@ -790,9 +992,6 @@ void Renderer::_PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine,
             // when we go to draw gridlines for the length of the run.
             const auto currentRunColor = color;
 
-            // Hold onto the current pattern id as well
-            const auto currentPatternId = patternIds;
-
             // Update the drawing brushes with our color and font usage.
             THROW_IF_FAILED(_UpdateDrawingBrushes(pEngine, currentRunColor, usingSoftFont, false));
 
@@ -822,9 +1021,9 @@ void Renderer::_PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine,
             do
             {
                 COORD thisPoint{ gsl::narrow<SHORT>(screenPoint.X + cols), screenPoint.Y };
-                const auto thisPointPatterns = _pData->GetPatternId(thisPoint);
+                _pData->GetPatternId(thisPoint, _cellPatternIds);
                 const auto thisUsingSoftFont = s_IsSoftFontChar(it->Chars(), _firstSoftFontChar, _lastSoftFontChar);
-                const auto changedPatternOrFont = patternIds != thisPointPatterns || usingSoftFont != thisUsingSoftFont;
+                const auto changedPatternOrFont = _runPatternIds != _cellPatternIds || usingSoftFont != thisUsingSoftFont;
                 if (color != it->TextAttr() || changedPatternOrFont)
                 {
                     auto newAttr{ it->TextAttr() };
@@ -833,7 +1032,7 @@ void Renderer::_PaintBufferOutputHelper(_In_ IRenderEngine* const pEngine,
                     if (!_IsAllSpaces(it->Chars()) || !newAttr.HasIdenticalVisualRepresentationForBlankSpace(color, globalInvert) || changedPatternOrFont)
                     {
                         color = newAttr;
-                        patternIds = thisPointPatterns;
+                        std::swap(_runPatternIds, _cellPatternIds);
                         usingSoftFont = thisUsingSoftFont;
                         break; // vend this run
                     }
@@ -988,7 +1187,10 @@ void Renderer::_PaintBufferOutputGridLineHelper(_In_ IRenderEngine* const pEngin
         if (_hoveredInterval->start <= coordTargetTil &&
             coordTargetTil <= _hoveredInterval->stop)
         {
-            if (_pData->GetPatternId(coordTarget).size() > 0)
+            // _cellPatternIds is free for reuse here: it's refilled before
+            // every use in the paint loop above.
+            _pData->GetPatternId(coordTarget, _cellPatternIds);
+            if (!_cellPatternIds.empty())
             {
                 lines.set(IRenderEngine::GridLines::Underline);
             }
@@ -1190,8 +1392,11 @@ void Renderer::_PaintSelection(_In_ IRenderEngine* const pEngine)
 {
     try
     {
+        // Engines that draw the selection as an overlay report its damage
+        // separately from the text damage; for everyone else this is simply
+        // GetDirtyArea() again.
         gsl::span<const til::rect> dirtyAreas;
-        LOG_IF_FAILED(pEngine->GetDirtyArea(dirtyAreas));
+        LOG_IF_FAILED(pEngine->GetSelectionDirtyArea(dirtyAreas));
 
         // Get selection rectangles
         const auto rectangles = _GetSelectionRects();
@@ -1367,3 +1572,19 @@ void Renderer::WaitUntilCanRender()
         pEngine->WaitUntilCanRender();
     }
 }
+
+// Method Description:
+// - True if any of the attached engines demand continuous repaints (e.g. an
+//   animated custom pixel shader is running). The render thread consults this
+//   so it doesn't pace down painting while an animation is playing.
+bool Renderer::RequiresContinuousRedraw() noexcept
+{
+    FOREACH_ENGINE(pEngine)
+    {
+        if (pEngine->RequiresContinuousRedraw())
+        {
+            return true;
+        }
+    }
+    return false;
+}
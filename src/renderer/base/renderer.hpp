@@ -20,6 +20,7 @@ Author(s):
 #include "../inc/RenderSettings.hpp"
 
 #include "thread.hpp"
+#include "tracing.hpp"
 
 #include "../../buffer/out/textBuffer.hpp"
 #include "../../buffer/out/CharRow.hpp"
@@ -50,6 +51,7 @@ namespace Microsoft::Console::Render
         void TriggerSelection();
         void TriggerScroll();
         void TriggerScroll(const COORD* const pcoordDelta);
+        void TriggerScrollRegion(const Microsoft::Console::Types::Viewport& region, const COORD* const pcoordDelta);
 
         void TriggerFlush(const bool circling);
         void TriggerTitleChange();
@@ -71,8 +73,10 @@ namespace Microsoft::Console::Render
         bool IsGlyphWideByFont(const std::wstring_view glyph);
 
         void EnablePainting();
+        void SetBackgroundCadence(const bool backgrounded) noexcept;
         void WaitForPaintCompletionAndDisable(const DWORD dwTimeoutMs);
         void WaitUntilCanRender();
+        bool RequiresContinuousRedraw() noexcept;
 
         void AddRenderEngine(_In_ IRenderEngine* const pEngine);
 
@@ -111,10 +115,15 @@ namespace Microsoft::Console::Render
         size_t _lastSoftFontChar = 0;
         std::optional<interval_tree::IntervalTree<til::point, size_t>::interval> _hoveredInterval;
         Microsoft::Console::Types::Viewport _viewport;
-        std::vector<Cluster> _clusterBuffer;
+        // Inline storage covers a full default-width row, so gathering the
+        // clusters for a line of text doesn't allocate per paint pass.
+        boost::container::small_vector<Cluster, 120> _clusterBuffer;
+        std::vector<size_t> _runPatternIds;
+        std::vector<size_t> _cellPatternIds;
         std::vector<SMALL_RECT> _previousSelection;
         std::function<void()> _pfnRendererEnteredErrorState;
         bool _destructing = false;
+        RenderTracing _tracing;
 
 #ifdef UNIT_TESTING
         friend class ConptyOutputTests;
@@ -15,10 +15,12 @@ RenderThread::RenderThread() :
     _hThread(nullptr),
     _hEvent(nullptr),
     _hPaintCompletedEvent(nullptr),
+    _hForegroundEvent(nullptr),
     _fKeepRunning(true),
     _hPaintEnabledEvent(nullptr),
     _fNextFrameRequested(false),
-    _fWaiting(false)
+    _fWaiting(false),
+    _fBackgroundCadence(false)
 {
 }
 
@@ -51,6 +53,12 @@ RenderThread::~RenderThread()
         CloseHandle(_hPaintCompletedEvent);
         _hPaintCompletedEvent = nullptr;
     }
+
+    if (_hForegroundEvent)
+    {
+        CloseHandle(_hForegroundEvent);
+        _hForegroundEvent = nullptr;
+    }
 }
 
 // Method Description:
@@ -120,6 +128,26 @@ RenderThread::~RenderThread()
         }
     }
 
+    if (SUCCEEDED(hr))
+    {
+        // Signaled while the target is in the foreground; reset while it's
+        // backgrounded, so the paint loop's cadence wait below times out
+        // instead of returning immediately.
+        HANDLE hForegroundEvent = CreateEventW(nullptr,
+                                               TRUE, // manual reset event
+                                               TRUE, // initially signaled
+                                               nullptr);
+
+        if (hForegroundEvent == nullptr)
+        {
+            hr = HRESULT_FROM_WIN32(GetLastError());
+        }
+        else
+        {
+            _hForegroundEvent = hForegroundEvent;
+        }
+    }
+
     if (SUCCEEDED(hr))
     {
         HANDLE hThread = CreateThread(nullptr, // non-inheritable security attributes
@@ -165,8 +193,29 @@ DWORD WINAPI RenderThread::s_ThreadProc(_In_ LPVOID lpParameter)
     }
 }
 
+// The number of consecutive paints that must each have had the next frame
+// requested before they finished for the churn to count as "sustained".
+// Short bursts - a keystroke echo and the cursor movement behind it, say -
+// never reach this and always paint at full cadence.
+static constexpr DWORD s_sustainedChurnThreshold = 8;
+
+// The additional delay inserted before each paint under sustained churn.
+// Stacked on top of the engines' own refresh pacing in WaitUntilCanRender,
+// this comes out at roughly 30 Hz.
+static constexpr DWORD s_sustainedChurnDelayMs = 16;
+
+// The delay inserted before each paint while the target is backgrounded
+// (an unfocused pane, say). Roughly 10 Hz - slow enough that thirty idle
+// dashboard panes cost next to nothing, fast enough that output visibly
+// still moves.
+static constexpr DWORD s_backgroundPaintDelayMs = 100;
+
 DWORD WINAPI RenderThread::_ThreadProc()
 {
+    // Counts how many consecutive paints already had the next frame queued up
+    // behind them. Only ever touched by this thread.
+    DWORD backToBackFrames = 0;
+
     while (_fKeepRunning)
     {
         WaitForSingleObject(_hPaintEnabledEvent, INFINITE);
@@ -206,6 +255,39 @@ DWORD WINAPI RenderThread::_ThreadProc()
 
             // see comment above
             ResetEvent(_hEvent);
+
+            // We had to go to sleep for the next frame request, so whatever
+            // churn we saw has subsided. Paint at full cadence again.
+            backToBackFrames = 0;
+        }
+        else if (backToBackFrames < s_sustainedChurnThreshold)
+        {
+            // The next frame was requested before the previous one finished
+            // painting: output is arriving faster than we can present it.
+            backToBackFrames++;
+        }
+
+        // Under sustained churn (think `find /` scrolling the entire screen)
+        // the intermediate frames are unreadable anyway, and painting them
+        // just steals CPU from the thread producing the output. The engines
+        // pace individual frames to roughly the display refresh rate in
+        // WaitUntilCanRender, so waiting an extra frame period here degrades
+        // the cadence to about half of that and lets the pending
+        // invalidations coalesce into fewer, larger paints. Engines that
+        // require continuous redraw (animated shaders) request a new frame
+        // after every paint by design and are exempt.
+        if (backToBackFrames >= s_sustainedChurnThreshold && !_pRenderer->RequiresContinuousRedraw())
+        {
+            Sleep(s_sustainedChurnDelayMs);
+        }
+
+        // A backgrounded target gets a much lower cadence still - its frames
+        // are glanced at, not read. This waits on the foreground event rather
+        // than sleeping, so a promotion (refocus, bell) interrupts the pacing
+        // immediately instead of eating the remainder of the delay.
+        if (_fBackgroundCadence.load(std::memory_order_acquire))
+        {
+            WaitForSingleObject(_hForegroundEvent, s_backgroundPaintDelayMs);
         }
 
         ResetEvent(_hPaintCompletedEvent);
@@ -241,6 +323,19 @@ void RenderThread::DisablePainting() noexcept
     ResetEvent(_hPaintEnabledEvent);
 }
 
+void RenderThread::SetBackgroundCadence(const bool backgrounded) noexcept
+{
+    _fBackgroundCadence.store(backgrounded, std::memory_order_release);
+    if (backgrounded)
+    {
+        ResetEvent(_hForegroundEvent);
+    }
+    else
+    {
+        SetEvent(_hForegroundEvent);
+    }
+}
+
 void RenderThread::WaitForPaintCompletionAndDisable(const DWORD dwTimeoutMs) noexcept
 {
     // When rendering takes place via DirectX, and a console application
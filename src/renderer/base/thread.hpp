@@ -29,6 +29,7 @@ namespace Microsoft::Console::Render
         void NotifyPaint() noexcept;
         void EnablePainting() noexcept;
         void DisablePainting() noexcept;
+        void SetBackgroundCadence(const bool backgrounded) noexcept;
         void WaitForPaintCompletionAndDisable(const DWORD dwTimeoutMs) noexcept;
 
     private:
@@ -40,11 +41,13 @@ namespace Microsoft::Console::Render
 
         HANDLE _hPaintEnabledEvent;
         HANDLE _hPaintCompletedEvent;
+        HANDLE _hForegroundEvent;
 
         Renderer* _pRenderer; // Non-ownership pointer
 
         bool _fKeepRunning;
         std::atomic<bool> _fNextFrameRequested;
         std::atomic<bool> _fWaiting;
+        std::atomic<bool> _fBackgroundCadence;
     };
 }
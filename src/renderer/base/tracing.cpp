@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include "tracing.hpp"
+
+TRACELOGGING_DEFINE_PROVIDER(g_hConsoleRenderBaseTraceProvider,
+                             "Microsoft.Windows.Console.Render.Base",
+                             // tl:{4bd9f22f-23a9-5bc1-a57e-8f68ce6e9c82}
+                             (0x4bd9f22f, 0x23a9, 0x5bc1, 0xa5, 0x7e, 0x8f, 0x68, 0xce, 0x6e, 0x9c, 0x82),
+                             TraceLoggingOptionMicrosoftTelemetry());
+
+using namespace Microsoft::Console::Render;
+
+std::atomic<size_t> RenderTracing::_tracelogCount{ 0 };
+
+RenderTracing::RenderTracing()
+{
+#ifndef UNIT_TESTING
+    const auto was = _tracelogCount.fetch_add(1);
+    if (was == 0)
+    {
+        TraceLoggingRegister(g_hConsoleRenderBaseTraceProvider);
+    }
+#endif
+}
+
+RenderTracing::~RenderTracing()
+{
+#ifndef UNIT_TESTING
+    const auto was = _tracelogCount.fetch_sub(1);
+    if (was == 1)
+    {
+        TraceLoggingUnregister(g_hConsoleRenderBaseTraceProvider);
+    }
+#endif
+}
+
+// Function Description:
+// - Converts a QueryPerformanceCounter delta into microseconds for emission,
+//   so consumers of the trace don't need to know the counter frequency.
+// Arguments:
+// - ticks: a difference between two RenderTracing::Now() values
+// Return Value:
+// - the same duration in microseconds
+static int64_t _ticksToMicroseconds(const int64_t ticks) noexcept
+{
+    static const int64_t frequency = []() {
+        LARGE_INTEGER freq;
+        QueryPerformanceFrequency(&freq);
+        return freq.QuadPart;
+    }();
+    return ticks * 1'000'000 / frequency;
+}
+
+// Function Description:
+// - Checks whether anyone is listening for the per-frame events, so callers
+//   can skip collecting timestamps entirely when nobody is.
+// Return Value:
+// - true if a trace session has enabled the provider at verbose level.
+bool RenderTracing::IsFrameTracingEnabled() const noexcept
+{
+#ifndef UNIT_TESTING
+    return TraceLoggingProviderEnabled(g_hConsoleRenderBaseTraceProvider, WINEVENT_LEVEL_VERBOSE, TIL_KEYWORD_TRACE);
+#else
+    return false;
+#endif
+}
+
+// Function Description:
+// - Reads the current high-resolution timestamp. Differences between two of
+//   these are what TraceFrame expects for the phase durations.
+// Return Value:
+// - the current QueryPerformanceCounter value.
+int64_t RenderTracing::Now() noexcept
+{
+    LARGE_INTEGER time;
+    QueryPerformanceCounter(&time);
+    return time.QuadPart;
+}
+
+// Function Description:
+// - Emits a single event describing how long each phase of a frame took and
+//   how much of the target was dirty, tagged with the engine pointer so
+//   frames from different engines on the same renderer can be told apart.
+// Arguments:
+// - engine: the engine the frame was painted to, used only as an identifier
+// - dirtyRects: how many dirty rectangles the engine reported for the frame
+// - dirtyCells: the total cell area covered by those rectangles
+// - *Ticks: QPC duration of each phase of Renderer::_PaintFrameForEngine
+void RenderTracing::TraceFrame(const void* engine,
+                               const size_t dirtyRects,
+                               const size_t dirtyCells,
+                               const int64_t prepareTicks,
+                               const int64_t backgroundTicks,
+                               const int64_t textTicks,
+                               const int64_t decorationsTicks,
+                               const int64_t endPaintTicks,
+                               const int64_t presentTicks) const
+{
+#ifndef UNIT_TESTING
+    if (TraceLoggingProviderEnabled(g_hConsoleRenderBaseTraceProvider, WINEVENT_LEVEL_VERBOSE, TIL_KEYWORD_TRACE))
+    {
+        TraceLoggingWrite(g_hConsoleRenderBaseTraceProvider,
+                          "Renderer_PaintFrame",
+                          TraceLoggingPointer(engine, "Engine"),
+                          TraceLoggingUInt64(gsl::narrow_cast<uint64_t>(dirtyRects), "DirtyRects"),
+                          TraceLoggingUInt64(gsl::narrow_cast<uint64_t>(dirtyCells), "DirtyCells"),
+                          TraceLoggingInt64(_ticksToMicroseconds(prepareTicks), "PrepareMicroseconds"),
+                          TraceLoggingInt64(_ticksToMicroseconds(backgroundTicks), "BackgroundMicroseconds"),
+                          TraceLoggingInt64(_ticksToMicroseconds(textTicks), "TextMicroseconds"),
+                          TraceLoggingInt64(_ticksToMicroseconds(decorationsTicks), "DecorationsMicroseconds"),
+                          TraceLoggingInt64(_ticksToMicroseconds(endPaintTicks), "EndPaintMicroseconds"),
+                          TraceLoggingInt64(_ticksToMicroseconds(presentTicks), "PresentMicroseconds"),
+                          TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+                          TraceLoggingKeyword(TIL_KEYWORD_TRACE));
+    }
+#else
+    UNREFERENCED_PARAMETER(engine);
+    UNREFERENCED_PARAMETER(dirtyRects);
+    UNREFERENCED_PARAMETER(dirtyCells);
+    UNREFERENCED_PARAMETER(prepareTicks);
+    UNREFERENCED_PARAMETER(backgroundTicks);
+    UNREFERENCED_PARAMETER(textTicks);
+    UNREFERENCED_PARAMETER(decorationsTicks);
+    UNREFERENCED_PARAMETER(endPaintTicks);
+    UNREFERENCED_PARAMETER(presentTicks);
+#endif
+}
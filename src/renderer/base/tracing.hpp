@@ -0,0 +1,51 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- tracing.hpp
+
+Abstract:
+- This module is used for recording per-frame timing and damage information
+  from the renderer to the tracing ETW channel. It lets us answer "why was
+  that frame slow" on machines we cannot attach a debugger to, regardless of
+  which engine (GDI, DX, Atlas, VT) was painting the frame.
+--*/
+
+#pragma once
+#include <atomic>
+#include <windows.h>
+#include <winmeta.h>
+#include <TraceLoggingProvider.h>
+#include <telemetry/ProjectTelemetry.h>
+
+TRACELOGGING_DECLARE_PROVIDER(g_hConsoleRenderBaseTraceProvider);
+
+namespace Microsoft::Console::Render
+{
+    class RenderTracing final
+    {
+    public:
+        RenderTracing();
+        ~RenderTracing();
+
+        bool IsFrameTracingEnabled() const noexcept;
+        static int64_t Now() noexcept;
+
+        void TraceFrame(const void* engine,
+                        const size_t dirtyRects,
+                        const size_t dirtyCells,
+                        const int64_t prepareTicks,
+                        const int64_t backgroundTicks,
+                        const int64_t textTicks,
+                        const int64_t decorationsTicks,
+                        const int64_t endPaintTicks,
+                        const int64_t presentTicks) const;
+
+    private:
+        // Multiple Renderer instances can exist in one process (one per
+        // terminal control), so registration is reference counted the same
+        // way the DX engine does it.
+        static std::atomic<size_t> _tracelogCount;
+    };
+}
@@ -10,6 +10,8 @@
 #include <wrl/client.h>
 #include <VersionHelpers.h>
 
+#include <til/hash.h>
+
 #include "BoxDrawingEffect.h"
 
 using namespace Microsoft::Console::Render;
@@ -89,6 +91,39 @@ try
 }
 CATCH_RETURN()
 
+// Routine Description:
+// - Sizes the shaped-line cache to the viewport: enough entries to hold a few
+//   screenfuls of distinct lines, so a redraw of the visible region plus the
+//   usual prompt/chrome churn stays resident, without hoarding every line a
+//   long scroll ever produced.
+// Arguments:
+// - viewportRows - the number of rows the engine is currently displaying
+// Return Value:
+// - <none>
+void CustomTextLayout::SetShapedLineCacheSize(const size_t viewportRows)
+{
+    _shapedLineCacheCapacity = std::max(viewportRows * s_shapedLineCacheRowMultiplier, s_shapedLineCacheMinEntries);
+
+    // If the viewport shrank, walk the cold end of the recency list back
+    // within the new capacity.
+    while (_shapedLineCache.size() > _shapedLineCacheCapacity)
+    {
+        _shapedLineCache.erase(_shapedLineList.back().first);
+        _shapedLineList.pop_back();
+    }
+}
+
+// Routine Description:
+// - Reports how the shaped-line cache has been doing, for the engine's tracing.
+// Arguments:
+// - <none>
+// Return Value:
+// - Cumulative hit/miss counts and the current entry count.
+[[nodiscard]] CustomTextLayout::ShapedLineCacheStatistics CustomTextLayout::GetShapedLineCacheStatistics() const noexcept
+{
+    return { _shapedLineCacheHits, _shapedLineCacheMisses, _shapedLineCache.size() };
+}
+
 // Routine Description:
 // - Figures out how many columns this layout should take. This will use the analyze step only.
 // Arguments:
@@ -162,14 +197,72 @@ try
     _formatInUse = _fontRenderData->TextFormatWithAttribute(weight, style, stretch).Get();
     _fontInUse = _fontRenderData->FontFaceWithAttribute(weight, style, stretch).Get();
 
-    RETURN_IF_FAILED(_AnalyzeTextComplexity());
-    RETURN_IF_FAILED(_AnalyzeRuns());
-    RETURN_IF_FAILED(_ShapeGlyphRuns());
-    RETURN_IF_FAILED(_CorrectGlyphRuns());
-    // Correcting box drawing has to come after both font fallback and
-    // the glyph run advance correction (which will apply a font size scaling factor).
-    // We need to know all the proposed X and Y dimension metrics to get this right.
-    RETURN_IF_FAILED(_CorrectBoxDrawing());
+    // Key the cache on a content hash of this line: the text itself, the
+    // column layout of its clusters, and the realized font attributes, all
+    // streamed through the bulk hasher straight out of their existing
+    // buffers. The hash is not trusted on its own - a hit is verified
+    // against the inputs stored in the entry - so a collision costs a
+    // re-shape, never a wrong draw.
+    til::bulk_hasher hasher;
+    hasher.write(_text.data(), _text.size());
+    hasher.write(_textClusterColumns.data(), _textClusterColumns.size());
+    hasher.write(weight);
+    hasher.write(style);
+    hasher.write(stretch);
+    const auto lineHash = hasher.finalize();
+
+    auto cached = _shapedLineCache.find(lineHash);
+    if (cached != _shapedLineCache.end())
+    {
+        const auto& shaped = cached->second->second;
+        if (shaped.text != _text ||
+            shaped.clusterColumns != _textClusterColumns ||
+            shaped.weight != weight ||
+            shaped.style != style ||
+            shaped.stretch != stretch)
+        {
+            // Hash collision; drop the old entry and re-shape below.
+            _shapedLineList.erase(cached->second);
+            _shapedLineCache.erase(cached);
+            cached = _shapedLineCache.end();
+        }
+    }
+
+    if (cached != _shapedLineCache.end())
+    {
+        // We already analyzed and shaped this exact line before. Restore the
+        // results and skip straight to drawing without touching DirectWrite.
+        _shapedLineList.splice(_shapedLineList.begin(), _shapedLineList, cached->second);
+        const auto& shaped = cached->second->second;
+        _runs = shaped.runs;
+        _glyphOffsets = shaped.glyphOffsets;
+        _glyphClusters = shaped.glyphClusters;
+        _glyphIndices = shaped.glyphIndices;
+        _glyphAdvances = shaped.glyphAdvances;
+        ++_shapedLineCacheHits;
+    }
+    else
+    {
+        RETURN_IF_FAILED(_AnalyzeTextComplexity());
+        RETURN_IF_FAILED(_AnalyzeRuns());
+        RETURN_IF_FAILED(_ShapeGlyphRuns());
+        RETURN_IF_FAILED(_CorrectGlyphRuns());
+        // Correcting box drawing has to come after both font fallback and
+        // the glyph run advance correction (which will apply a font size scaling factor).
+        // We need to know all the proposed X and Y dimension metrics to get this right.
+        RETURN_IF_FAILED(_CorrectBoxDrawing());
+
+        // Evict from the cold end of the recency list until the new entry
+        // fits within the capacity the engine derived from the viewport.
+        while (_shapedLineCache.size() >= _shapedLineCacheCapacity)
+        {
+            _shapedLineCache.erase(_shapedLineList.back().first);
+            _shapedLineList.pop_back();
+        }
+        _shapedLineList.emplace_front(lineHash, ShapedLine{ _text, _textClusterColumns, weight, style, stretch, _runs, _glyphOffsets, _glyphClusters, _glyphIndices, _glyphAdvances });
+        _shapedLineCache.emplace(lineHash, _shapedLineList.begin());
+        ++_shapedLineCacheMisses;
+    }
 
     RETURN_IF_FAILED(_DrawGlyphRuns(clientDrawingContext, renderer, { originX, originY }));
 
@@ -29,6 +29,18 @@ namespace Microsoft::Console::Render
 
         [[nodiscard]] HRESULT STDMETHODCALLTYPE GetColumns(_Out_ UINT32* columns);
 
+        // Cumulative counters describing how the shaped-line cache is doing,
+        // for the engine's tracing.
+        struct ShapedLineCacheStatistics
+        {
+            size_t hits;
+            size_t misses;
+            size_t entries;
+        };
+
+        void SetShapedLineCacheSize(const size_t viewportRows);
+        [[nodiscard]] ShapedLineCacheStatistics GetShapedLineCacheStatistics() const noexcept;
+
         // IDWriteTextLayout methods (but we don't actually want to implement them all, so just this one matching the existing interface)
         [[nodiscard]] HRESULT STDMETHODCALLTYPE Draw(_In_opt_ void* clientDrawingContext,
                                                      _In_ IDWriteTextRenderer* renderer,
@@ -206,6 +218,44 @@ namespace Microsoft::Console::Render
         // These are used to further break the runs apart and adjust the font size so glyphs fit inside the cells.
         std::vector<ScaleCorrection> _glyphScaleCorrections;
 
+        // Everything the drawing step needs from a completed analysis and
+        // shaping pass, so a line that was shaped once can be drawn again
+        // without consulting DirectWrite. The inputs that produced the pass
+        // ride along so a hash hit can be verified against them.
+        struct ShapedLine
+        {
+            std::wstring text;
+            std::vector<UINT16> clusterColumns;
+            DWRITE_FONT_WEIGHT weight;
+            DWRITE_FONT_STYLE style;
+            DWRITE_FONT_STRETCH stretch;
+
+            std::vector<LinkedRun> runs;
+            std::vector<DWRITE_GLYPH_OFFSET> glyphOffsets;
+            std::vector<UINT16> glyphClusters;
+            std::vector<UINT16> glyphIndices;
+            std::vector<float> glyphAdvances;
+        };
+
+        // Terminal contents are highly repetitive - prompts, box drawing,
+        // table borders - so in steady state most lines drawn were already
+        // drawn in a previous frame. This caches the shaping results keyed
+        // on a content hash of the text, its cluster columns and the realized
+        // font attributes (see Draw for how the hash is computed and why a
+        // hit is verified). Entries live on a recency-ordered list so the
+        // least recently drawn line is evicted first, with the capacity set
+        // from the viewport height by the engine. The engine recreates this
+        // layout whenever the font changes, which conveniently discards all
+        // entries that the change invalidated.
+        std::list<std::pair<size_t, ShapedLine>> _shapedLineList;
+        std::unordered_map<size_t, std::list<std::pair<size_t, ShapedLine>>::iterator> _shapedLineCache;
+        size_t _shapedLineCacheCapacity = s_shapedLineCacheMinEntries;
+        size_t _shapedLineCacheHits = 0;
+        size_t _shapedLineCacheMisses = 0;
+
+        static constexpr size_t s_shapedLineCacheMinEntries = 128;
+        static constexpr size_t s_shapedLineCacheRowMultiplier = 4;
+
 #ifdef UNIT_TESTING
     public:
         CustomTextLayout() = default;
@@ -11,6 +11,35 @@ static constexpr std::wstring_view FALLBACK_FONT_FACES[] = { L"Consolas", L"Luci
 
 using namespace Microsoft::Console::Render;
 
+// Process-wide cache of resolved font faces.
+// Faces are size-independent (the requested size lives on the text format, not
+// the face), so once a family/weight/stretch/style has been resolved against a
+// given collection, every renderer instance in the process - and every font
+// size change, which rebuilds all the per-renderer maps - can reuse the same
+// face instead of walking the collection again. Missing families are cached
+// too: the name-trimming loop in ResolveFontFaceWithFallback retries the same
+// unresolvable names on every font change otherwise.
+namespace
+{
+    struct ResolvedFontFace
+    {
+        // Pins the collection so its pointer (part of the key) can't be reused
+        // by a different collection while this entry exists.
+        wil::com_ptr<IDWriteFontCollection> collection;
+        Microsoft::WRL::ComPtr<IDWriteFontFace1> face; // nullptr = family known to be missing
+        std::wstring familyName;
+        std::wstring localeName;
+        DWRITE_FONT_WEIGHT weight;
+        DWRITE_FONT_STRETCH stretch;
+        DWRITE_FONT_STYLE style;
+    };
+
+    using ResolvedFontFaceKey = std::tuple<IDWriteFontCollection*, std::wstring, DWRITE_FONT_WEIGHT, DWRITE_FONT_STRETCH, DWRITE_FONT_STYLE, std::wstring>;
+
+    std::mutex resolvedFontFaceLock;
+    std::map<ResolvedFontFaceKey, ResolvedFontFace> resolvedFontFaces;
+}
+
 DxFontInfo::DxFontInfo() noexcept :
     _weight(DWRITE_FONT_WEIGHT_NORMAL),
     _style(DWRITE_FONT_STYLE_NORMAL),
@@ -191,6 +220,28 @@ void DxFontInfo::SetFromEngine(const std::wstring_view familyName,
 #pragma warning(suppress : 26429) // C26429: Symbol 'fontCollection' is never tested for nullness, it can be marked as not_null (f.23).
 [[nodiscard]] Microsoft::WRL::ComPtr<IDWriteFontFace1> DxFontInfo::_FindFontFace(IDWriteFontCollection* fontCollection, std::wstring& localeName)
 {
+    // Check the process-wide cache first; it gives back both the face and the
+    // attributes/names the resolution below would have reported.
+    ResolvedFontFaceKey cacheKey{ fontCollection, _familyName, _weight, _stretch, _style, localeName };
+
+    {
+        std::lock_guard lock{ resolvedFontFaceLock };
+        const auto it = resolvedFontFaces.find(cacheKey);
+        if (it != resolvedFontFaces.end())
+        {
+            const auto& entry = it->second;
+            if (entry.face)
+            {
+                _weight = entry.weight;
+                _stretch = entry.stretch;
+                _style = entry.style;
+                _familyName = entry.familyName;
+                localeName = entry.localeName;
+            }
+            return entry.face;
+        }
+    }
+
     Microsoft::WRL::ComPtr<IDWriteFontFace1> fontFace;
 
     UINT32 familyIndex;
@@ -220,6 +271,14 @@ void DxFontInfo::SetFromEngine(const std::wstring_view familyName,
         _familyName = _GetFontFamilyName(fontFamily.Get(), localeName);
     }
 
+    {
+        std::lock_guard lock{ resolvedFontFaceLock };
+        wil::com_ptr<IDWriteFontCollection> collection;
+        collection.copy_from(fontCollection);
+        resolvedFontFaces.emplace(std::move(cacheKey),
+                                  ResolvedFontFace{ std::move(collection), fontFace, _familyName, localeName, _weight, _stretch, _style });
+    }
+
     return fontFace;
 }
 
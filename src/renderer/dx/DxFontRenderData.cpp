@@ -14,6 +14,87 @@ static constexpr size_t TAG_LENGTH = 4;
 
 using namespace Microsoft::Console::Render;
 
+namespace
+{
+    // A trivial IDWriteTextAnalysisSource over a fixed string, used to drive
+    // MapCharacters when warming the font fallback machinery off the render
+    // thread. Mirrors the source implementation in CustomTextLayout.
+    class FallbackPrefetchSource final : public ::Microsoft::WRL::RuntimeClass<::Microsoft::WRL::RuntimeClassFlags<::Microsoft::WRL::ClassicCom | ::Microsoft::WRL::InhibitFtmBase>, IDWriteTextAnalysisSource>
+    {
+    public:
+        FallbackPrefetchSource(std::wstring text, std::wstring localeName) :
+            _text{ std::move(text) },
+            _localeName{ std::move(localeName) }
+        {
+        }
+
+        [[nodiscard]] HRESULT STDMETHODCALLTYPE GetTextAtPosition(UINT32 textPosition,
+                                                                  _Outptr_result_buffer_(*textLength) WCHAR const** textString,
+                                                                  _Out_ UINT32* textLength) noexcept override
+        {
+            *textString = nullptr;
+            *textLength = 0;
+
+            if (textPosition < _text.size())
+            {
+                *textString = _text.data() + textPosition;
+                *textLength = gsl::narrow_cast<UINT32>(_text.size()) - textPosition;
+            }
+
+            return S_OK;
+        }
+
+        [[nodiscard]] HRESULT STDMETHODCALLTYPE GetTextBeforePosition(UINT32 textPosition,
+                                                                      _Outptr_result_buffer_(*textLength) WCHAR const** textString,
+                                                                      _Out_ UINT32* textLength) noexcept override
+        {
+            *textString = nullptr;
+            *textLength = 0;
+
+            if (textPosition > 0 && textPosition <= _text.size())
+            {
+                *textString = _text.data();
+                *textLength = textPosition;
+            }
+
+            return S_OK;
+        }
+
+        [[nodiscard]] DWRITE_READING_DIRECTION STDMETHODCALLTYPE GetParagraphReadingDirection() noexcept override
+        {
+            return DWRITE_READING_DIRECTION_LEFT_TO_RIGHT;
+        }
+
+        [[nodiscard]] HRESULT STDMETHODCALLTYPE GetLocaleName(UINT32 textPosition,
+                                                              _Out_ UINT32* textLength,
+                                                              _Outptr_result_z_ WCHAR const** localeName) noexcept override
+        {
+            *localeName = _localeName.c_str();
+            *textLength = gsl::narrow_cast<UINT32>(_text.size()) - textPosition;
+            return S_OK;
+        }
+
+        [[nodiscard]] HRESULT STDMETHODCALLTYPE GetNumberSubstitution(UINT32 textPosition,
+                                                                      _Out_ UINT32* textLength,
+                                                                      _COM_Outptr_ IDWriteNumberSubstitution** numberSubstitution) noexcept override
+        {
+            *numberSubstitution = nullptr;
+            *textLength = gsl::narrow_cast<UINT32>(_text.size()) - textPosition;
+            return S_OK;
+        }
+
+    private:
+        std::wstring _text;
+        std::wstring _localeName;
+    };
+
+    // One character from each of the scripts whose fallback resolution we want
+    // warm before the first frame that needs it: a CJK ideograph, hiragana,
+    // katakana, Hangul, Cyrillic, Greek, Hebrew, Arabic, Thai, Devanagari, two
+    // common symbols, and an emoji (surrogate pair).
+    constexpr std::wstring_view FallbackPrefetchSample{ L"\x4E00\x3042\x30A2\xAC00\x0416\x03A9\x05D0\x0634\x0E01\x0905\x2713\x2192\xD83D\xDE00" };
+}
+
 DxFontRenderData::DxFontRenderData(::Microsoft::WRL::ComPtr<IDWriteFactory1> dwriteFactory) :
     _dwriteFactory(dwriteFactory),
     _nearbyCollection{ FontCache::GetCached() },
@@ -202,12 +283,97 @@ DxFontRenderData::DxFontRenderData(::Microsoft::WRL::ComPtr<IDWriteFactory1> dwr
         _SetAxes(axes);
 
         _BuildFontRenderData(desired, actual, dpi);
+
+        // Warm the fallback machinery for the new base font in the background.
+        // Only the family matters for fallback - size changes alone (zooming,
+        // DPI changes) don't alter which fonts the fallback chain picks.
+        if (_defaultFontInfo.GetFamilyName() != _prefetchedFallbackFamily)
+        {
+            _prefetchedFallbackFamily = _defaultFontInfo.GetFamilyName();
+            _PrefetchFontFallback();
+        }
     }
     CATCH_RETURN();
 
     return S_OK;
 }
 
+// Routine Description:
+// - Starts a background warm-up of the DirectWrite font fallback machinery for
+//   the current base font. Without this, the first glyph outside the base font
+//   pays for the full fallback analysis (and font file load) in the middle of a
+//   frame; mapping one character from each common script ahead of time means
+//   that by the time real mixed-script output arrives, DirectWrite answers from
+//   its cache.
+// - The worker thread only uses objects it owns or that are safe to share (the
+//   system fallback and the font collection are thread-safe and immutable), so
+//   it never touches `this` and can safely outlive it.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none> (failures are logged; a cold fallback cache is not an error)
+void DxFontRenderData::_PrefetchFontFallback()
+try
+{
+    ::Microsoft::WRL::ComPtr<IDWriteFactory2> factory2;
+    if (FAILED(_dwriteFactory.As(&factory2)))
+    {
+        // This OS has no font fallback support; there is nothing to warm.
+        return;
+    }
+
+    // Resolve the shared objects on this thread so the worker doesn't race the
+    // lazy initialization that the render thread may be doing concurrently.
+    const auto fallback = SystemFontFallback();
+    const auto collection = _nearbyCollection;
+    std::wstring familyName{ _defaultFontInfo.GetFamilyName() };
+    const auto weight = _defaultFontInfo.GetWeight();
+    const auto style = _defaultFontInfo.GetStyle();
+    const auto stretch = _defaultFontInfo.GetStretch();
+
+    std::thread([fallback, collection, familyName = std::move(familyName), weight, style, stretch, localeName = UserLocaleName()]() {
+        try
+        {
+            const auto source = ::Microsoft::WRL::Make<FallbackPrefetchSource>(std::wstring{ FallbackPrefetchSample }, localeName);
+
+            UINT32 textPosition = 0;
+            auto textLength = gsl::narrow<UINT32>(FallbackPrefetchSample.size());
+            while (textLength > 0)
+            {
+                UINT32 mappedLength = 0;
+                ::Microsoft::WRL::ComPtr<IDWriteFont> mappedFont;
+                FLOAT scale = 0.0f;
+
+                THROW_IF_FAILED(fallback->MapCharacters(source.Get(),
+                                                        textPosition,
+                                                        textLength,
+                                                        collection.get(),
+                                                        familyName.data(),
+                                                        weight,
+                                                        style,
+                                                        stretch,
+                                                        &mappedLength,
+                                                        &mappedFont,
+                                                        &scale));
+                THROW_HR_IF(E_UNEXPECTED, mappedLength == 0);
+
+                if (mappedFont)
+                {
+                    // Creating the face is what makes DirectWrite actually load
+                    // the font file; do it now rather than at first paint.
+                    ::Microsoft::WRL::ComPtr<IDWriteFontFace> face;
+                    LOG_IF_FAILED(mappedFont->CreateFontFace(&face));
+                }
+
+                textPosition += mappedLength;
+                textLength -= mappedLength;
+            }
+        }
+        CATCH_LOG();
+    }).detach();
+}
+CATCH_LOG()
+
 // Routine Description:
 // - Calculates the box drawing scale/translate matrix values to fit a box glyph into the cell as perfectly as possible.
 // Arguments:
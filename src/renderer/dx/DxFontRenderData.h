@@ -123,6 +123,7 @@ namespace Microsoft::Console::Render
         float _FontStyleToSlantFixedAxisValue(DWRITE_FONT_STYLE fontStyle) noexcept;
         void _BuildFontRenderData(const FontInfoDesired& desired, FontInfo& actual, const int dpi);
         Microsoft::WRL::ComPtr<IDWriteTextFormat> _BuildTextFormat(const DxFontInfo& fontInfo, const std::wstring_view localeName);
+        void _PrefetchFontFallback();
 
         std::unordered_map<FontAttributeMapKey, ::Microsoft::WRL::ComPtr<IDWriteTextFormat>> _textFormatMap;
         std::unordered_map<FontAttributeMapKey, ::Microsoft::WRL::ComPtr<IDWriteFontFace1>> _fontFaceMap;
@@ -134,6 +135,7 @@ namespace Microsoft::Console::Render
 
         wil::com_ptr<IDWriteFontCollection> _nearbyCollection;
         std::wstring _userLocaleName;
+        std::wstring _prefetchedFallbackFamily;
         DxFontInfo _defaultFontInfo;
         til::size _glyphCell;
         DWRITE_LINE_SPACING _lineSpacing;
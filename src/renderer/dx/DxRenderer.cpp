@@ -692,6 +692,14 @@ try
             const HRESULT asResult = _dxgiSwapChain.As(&swapChain2);
             if (SUCCEEDED(asResult))
             {
+                // A waitable swap chain defaults to a maximum frame latency of 1,
+                // which blocks the render thread until the GPU has fully consumed
+                // the previous present before we may even start encoding the next
+                // frame. Allowing one frame in flight lets the CPU prepare frame
+                // N+1 while the GPU still works on frame N; the waitable object
+                // (consumed in WaitUntilCanRender) still caps the queue so we
+                // never run further ahead than that.
+                LOG_IF_FAILED(swapChain2->SetMaximumFrameLatency(2));
                 _swapChainFrameLatencyWaitableObject = wil::unique_handle{ swapChain2->GetFrameLatencyWaitableObject() };
             }
             else
@@ -1326,6 +1334,11 @@ try
         {
             _invalidMap.resize(size);
             RETURN_IF_FAILED(InvalidateAll());
+
+            if (_customLayout)
+            {
+                _customLayout->SetShapedLineCacheSize(gsl::narrow_cast<size_t>(std::max(size.height, 0)));
+            }
         }
 
         _d2dDeviceContext->BeginDraw();
@@ -1371,6 +1384,20 @@ try
     {
         _isPainting = false;
 
+        if (_customLayout && TraceLoggingProviderEnabled(g_hDxRenderProvider, WINEVENT_LEVEL_VERBOSE, TIL_KEYWORD_TRACE))
+        {
+            const auto stats = _customLayout->GetShapedLineCacheStatistics();
+
+#pragma warning(suppress : 26477 26485 26494 26482 26446 26447) // We don't control TraceLoggingWrite
+            TraceLoggingWrite(g_hDxRenderProvider,
+                              "ShapedLineCache",
+                              TraceLoggingUInt64(stats.hits, "hits"),
+                              TraceLoggingUInt64(stats.misses, "misses"),
+                              TraceLoggingUInt64(stats.entries, "entries"),
+                              TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+                              TraceLoggingKeyword(TIL_KEYWORD_TRACE));
+        }
+
         // If there's still a clip hanging around, remove it. We're all done.
         LOG_IF_FAILED(_customRenderer->EndClip(_drawingContext.get()));
 
@@ -2007,6 +2034,7 @@ try
 
     // Prepare the text layout.
     _customLayout = WRL::Make<CustomTextLayout>(_fontRenderData.get());
+    _customLayout->SetShapedLineCacheSize(gsl::narrow_cast<size_t>(std::max(_invalidMap.size().height, 0)));
 
     return S_OK;
 }
@@ -453,7 +453,7 @@ bool GdiEngine::FontHasWesternScript(HDC hdc)
 
     if (_cPolyText > 0)
     {
-        for (size_t i = 0; i != _cPolyText; ++i)
+        for (size_t i = 0; i != _cPolyText;)
         {
             const auto& t = _pPolyText[i];
 
@@ -468,11 +468,30 @@ bool GdiEngine::FontHasWesternScript(HDC hdc)
             // text in logical order in order to be compatible with applications like `vim -H`.
             if (_fontHasWesternScript && ScriptIsComplex(t.lpstr, t.n, SIC_COMPLEX) == S_FALSE)
             {
-                if (!ExtTextOutW(_hdcMemoryContext, t.x, t.y, t.uiFlags | ETO_IGNORELANGUAGE, &t.rcl, t.lpstr, t.n, t.pdx))
+                // Find how many of the following strings would also take the direct
+                // route through GDI, so the whole stretch can be issued as a single
+                // PolyTextOutW() call. Complex script processing is a no-op for
+                // these strings (that's what we just verified), but crossing into
+                // the graphics engine - and, over a remote session, onto the wire -
+                // happens once for the set instead of once per string.
+                size_t cStrings = 1;
+                while (i + cStrings != _cPolyText)
+                {
+                    const auto& u = _pPolyText[i + cStrings];
+                    if (ScriptIsComplex(u.lpstr, u.n, SIC_COMPLEX) != S_FALSE)
+                    {
+                        break;
+                    }
+                    ++cStrings;
+                }
+
+                if (!PolyTextOutW(_hdcMemoryContext, &t, gsl::narrow<int>(cStrings)))
                 {
                     hr = E_FAIL;
                     break;
                 }
+
+                i += cStrings;
             }
             else
             {
@@ -492,6 +511,8 @@ bool GdiEngine::FontHasWesternScript(HDC hdc)
                 {
                     break;
                 }
+
+                ++i;
             }
         }
 
@@ -272,13 +272,27 @@ GdiEngine::~GdiEngine()
                                                       const bool usingSoftFont,
                                                       const bool isSettingDefaultBrushes) noexcept
 {
-    RETURN_IF_FAILED(_FlushBufferLines());
-
     RETURN_HR_IF_NULL(HRESULT_FROM_WIN32(ERROR_INVALID_STATE), _hdcMemoryContext);
 
     // Set the colors for painting text
     const auto [colorForeground, colorBackground] = renderSettings.GetAttributeColors(textAttributes);
 
+    // Work out which font variant the new attributes will need (see below).
+    const auto usingItalicFont = textAttributes.IsItalic();
+    const auto fontType = usingSoftFont   ? FontType::Soft :
+                          usingItalicFont ? FontType::Italic :
+                                            FontType::Default;
+
+    // Buffered lines are expecting to be drawn with the colors and font that
+    // were selected when they were queued, so they have to go out before the
+    // DC state can change. When nothing is actually changing - a long stretch
+    // of output in a single attribute, for instance - keep accumulating lines
+    // instead, so they can be flushed together in far fewer GDI calls.
+    if (colorForeground != _lastFg || colorBackground != _lastBg || fontType != _lastFontType || isSettingDefaultBrushes)
+    {
+        RETURN_IF_FAILED(_FlushBufferLines());
+    }
+
     if (colorForeground != _lastFg)
     {
         RETURN_HR_IF(E_FAIL, CLR_INVALID == SetTextColor(_hdcMemoryContext, colorForeground));
@@ -300,10 +314,6 @@ GdiEngine::~GdiEngine()
     }
 
     // If the font type has changed, select an appropriate font variant or soft font.
-    const auto usingItalicFont = textAttributes.IsItalic();
-    const auto fontType = usingSoftFont   ? FontType::Soft :
-                          usingItalicFont ? FontType::Italic :
-                                            FontType::Default;
     if (fontType != _lastFontType)
     {
         switch (fontType)
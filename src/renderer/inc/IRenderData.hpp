@@ -62,7 +62,16 @@ namespace Microsoft::Console::Render
         virtual const std::wstring GetHyperlinkUri(uint16_t id) const noexcept = 0;
         virtual const std::wstring GetHyperlinkCustomId(uint16_t id) const noexcept = 0;
 
-        virtual const std::vector<size_t> GetPatternId(const COORD location) const noexcept = 0;
+        // Advances whenever anything that takes part in color resolution
+        // changes (palette, color aliases, render modes), so consumers that
+        // cache resolved colors can check validity with a single compare.
+        virtual uint64_t GetColorGeneration() const noexcept = 0;
+
+        // Replaces the content of patternIds with the pattern ids found at the
+        // given location. Taking the vector as an out parameter lets the
+        // renderer reuse its storage for the per-cell queries in the paint
+        // loop instead of allocating a new vector for every cell.
+        virtual void GetPatternId(const COORD location, std::vector<size_t>& patternIds) const noexcept = 0;
 
     protected:
         IRenderData() = default;
@@ -66,6 +66,13 @@ namespace Microsoft::Console::Render
         [[nodiscard]] virtual HRESULT InvalidateSystem(const RECT* prcDirtyClient) noexcept = 0;
         [[nodiscard]] virtual HRESULT InvalidateSelection(const std::vector<SMALL_RECT>& rectangles) noexcept = 0;
         [[nodiscard]] virtual HRESULT InvalidateScroll(const COORD* pcoordDelta) noexcept = 0;
+        [[nodiscard]] virtual HRESULT InvalidateScrollRegion(const SMALL_RECT* psrRegion, const COORD* pcoordDelta) noexcept
+        {
+            // A vertical shift confined to a band of the screen. Engines that
+            // can't carry previously-presented content over by the delta just
+            // treat the band as ordinary damage.
+            return Invalidate(psrRegion);
+        }
         [[nodiscard]] virtual HRESULT InvalidateAll() noexcept = 0;
         [[nodiscard]] virtual HRESULT InvalidateFlush(_In_ const bool circled, _Out_ bool* const pForcePaint) noexcept = 0;
         [[nodiscard]] virtual HRESULT InvalidateTitle(std::wstring_view proposedTitle) noexcept = 0;
@@ -85,6 +92,15 @@ namespace Microsoft::Console::Render
         [[nodiscard]] virtual HRESULT UpdateViewport(SMALL_RECT srNewViewport) noexcept = 0;
         [[nodiscard]] virtual HRESULT GetProposedFont(const FontInfoDesired& FontInfoDesired, _Out_ FontInfo& FontInfo, int iDpi) noexcept = 0;
         [[nodiscard]] virtual HRESULT GetDirtyArea(gsl::span<const til::rect>& area) noexcept = 0;
+        [[nodiscard]] virtual HRESULT GetSelectionDirtyArea(gsl::span<const til::rect>& area) noexcept
+        {
+            // Engines that composite the selection into the same surface as the
+            // text fold selection damage into GetDirtyArea() and don't need to
+            // distinguish the two. Engines that keep the selection as a separate
+            // overlay can override this to report selection damage without
+            // forcing the affected rows through the text painting path.
+            return GetDirtyArea(area);
+        }
         [[nodiscard]] virtual HRESULT GetFontSize(_Out_ COORD* pFontSize) noexcept = 0;
         [[nodiscard]] virtual HRESULT IsGlyphWideByFont(std::wstring_view glyph, _Out_ bool* pResult) noexcept = 0;
         [[nodiscard]] virtual HRESULT UpdateTitle(std::wstring_view newTitle) noexcept = 0;
@@ -41,13 +41,31 @@ namespace Microsoft::Console::Render
         size_t GetColorAliasIndex(const ColorAlias alias) const noexcept;
         std::pair<COLORREF, COLORREF> GetAttributeColors(const TextAttribute& attr) const noexcept;
         std::pair<COLORREF, COLORREF> GetAttributeColorsWithAlpha(const TextAttribute& attr) const noexcept;
+        uint64_t GetColorGeneration() const noexcept;
         void ToggleBlinkRendition(class Renderer& renderer) noexcept;
 
     private:
+        std::pair<COLORREF, COLORREF> _CalculateAttributeColors(const TextAttribute& attr) const noexcept;
+        void _InvalidateColorCache() noexcept;
+
+        struct ResolvedColorPair
+        {
+            TextAttribute attr;
+            std::pair<COLORREF, COLORREF> colors;
+        };
+
         til::enumset<Mode> _renderMode{ Mode::BlinkAllowed, Mode::IntenseIsBright };
         std::array<COLORREF, TextColor::TABLE_SIZE> _colorTable;
         std::array<size_t, static_cast<size_t>(ColorAlias::ENUM_COUNT)> _colorAliasIndices;
         std::array<std::array<COLORREF, 18>, 18> _adjustedForegroundColors;
+        // Memoizes recently resolved attribute -> (fg, bg) pairs. A frame
+        // usually contains a handful of distinct attributes but resolves one
+        // per run painted, so nearly every lookup is a repeat. Flushed
+        // whenever anything resolution depends on changes.
+        mutable std::array<ResolvedColorPair, 16> _resolvedColors{};
+        mutable size_t _resolvedColorsUsed = 0;
+        mutable size_t _resolvedColorsNext = 0;
+        uint64_t _colorGeneration = 1;
         size_t _blinkCycle = 0;
         mutable bool _blinkIsInUse = false;
         bool _blinkShouldBeFaint = false;
@@ -86,6 +86,21 @@ using namespace Microsoft::Console::Render;
     return _WriteFormatted(FMT_COMPILE("\x1b[{}X"), chars);
 }
 
+// Method Description:
+// - Emits a conpty glyph width hint: the next `count` printed codepoints are
+//   each `width` columns wide. A terminal that negotiated hints at creation
+//   time uses this to skip re-deriving the width classification our buffer
+//   already performed; anyone else will simply ignore the sequence.
+// Arguments:
+// - count: how many upcoming codepoints the hint covers
+// - width: the column width (1 or 2) shared by all of them
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
+[[nodiscard]] HRESULT VtEngine::_GlyphWidthHint(const size_t count, const size_t width) noexcept
+{
+    return _WriteFormatted(FMT_COMPILE("\x1b[{};{}*w"), count, width);
+}
+
 // Method Description:
 // - Moves the cursor forward (right) a number of characters.
 // Arguments:
@@ -160,6 +175,33 @@ using namespace Microsoft::Console::Render;
     return _InsertDeleteLine(sLines, true);
 }
 
+// Method Description:
+// - Formats and writes the sequences to vertically scroll just the rows
+//      between top and bottom, inclusive. DECSTBM margins confine the scroll
+//      so the rest of the screen is untouched, and are reset immediately
+//      afterwards. Note that both setting and resetting the margins move the
+//      terminal's cursor to the home position.
+// Arguments:
+// - top: the first row of the scrolled band, 0-indexed
+// - bottom: the last row of the scrolled band, 0-indexed, inclusive
+// - dy: the distance the band's contents moved; negative is up
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
+[[nodiscard]] HRESULT VtEngine::_ScrollRegion(const short top, const short bottom, const short dy) noexcept
+{
+    const short distance = static_cast<short>(abs(dy));
+    RETURN_IF_FAILED(_WriteFormatted(FMT_COMPILE("\x1b[{};{}r"), top + 1, bottom + 1));
+    if (dy < 0)
+    {
+        RETURN_IF_FAILED(_WriteFormatted(FMT_COMPILE("\x1b[{}S"), distance));
+    }
+    else
+    {
+        RETURN_IF_FAILED(_WriteFormatted(FMT_COMPILE("\x1b[{}T"), distance));
+    }
+    return _Write("\x1b[r");
+}
+
 // Method Description:
 // - Formats and writes a sequence to move the cursor to the specified
 //      coordinate position. The input coord should be in console coordinates,
@@ -66,6 +66,7 @@ XtermEngine::XtermEngine(_In_ wil::unique_hfile hPipe,
         RETURN_IF_FAILED(_ClearScreen());
         _clearedAllThisFrame = true;
         _firstPaint = false;
+        _InvalidateShadowBuffer();
     }
     else
     {
@@ -351,6 +352,30 @@ try
 {
     _trace.TraceScrollFrame(_scrollDelta);
 
+    // Replay any full-width band scrolls the host reported this frame. The
+    // rows of each band are still marked invalid, but rotating the shadow
+    // record along with the terminal's contents means the rows that merely
+    // moved stay recognizable to the content diff - only the rows the scroll
+    // revealed (or that genuinely changed) will repaint. The margin
+    // sequences home the terminal's cursor both when the margins are set and
+    // when they're reset, so update our record of it accordingly.
+    if (!_regionScrolls.empty())
+    {
+        // The cursor is going to jump to the home position as the margins
+        // are set and reset, so make sure it's hidden for this frame.
+        _needToDisableCursor = true;
+
+        for (const auto& scroll : _regionScrolls)
+        {
+            RETURN_IF_FAILED(_ScrollRegion(scroll.top, scroll.bottom, scroll.dy));
+            _ScrollShadowBufferRegion(scroll.top, scroll.bottom, scroll.dy);
+        }
+        _regionScrolls.clear();
+
+        _lastText = { 0, 0 };
+        _trace.TraceLastText(til::point{ _lastText });
+    }
+
     if (_scrollDelta.x != 0)
     {
         // No easy way to shift left-right. Everything needs repainting.
@@ -398,6 +423,10 @@ try
         RETURN_IF_FAILED(_InsertLine(absDy));
     }
 
+    // Keep the record of previously-transmitted content aligned with the rows
+    // it described, now that they've moved.
+    _ScrollShadowBuffer(dy);
+
     // Restore our wrap state.
     _wrappedRow = oldWrappedRow;
     _delayedEolWrap = oldDelayedEolWrap;
@@ -483,12 +512,67 @@ try
         _invalidMap.translate(delta, true);
 
         _scrollDelta += delta;
+
+        // Drop any pending region scrolls rather than trying to interleave
+        // them correctly with a whole-frame scroll. Their bands were fully
+        // invalidated when they were recorded, so without the replay the
+        // rows just repaint the ordinary way.
+        _regionScrolls.clear();
     }
 
     return S_OK;
 }
 CATCH_RETURN();
 
+// Routine Description:
+// - Notifies us that the console has scrolled a full-width band of the
+//      screen vertically, leaving everything outside the band alone. If the
+//      shift can be expressed with DECSTBM margins, remember it so
+//      ScrollFrame can replay it on the terminal; otherwise treat the band
+//      as ordinary damage.
+// Arguments:
+// - psrRegion - the region whose contents shifted, in viewport coordinates.
+// - pcoordDelta - the distance the region's contents moved.
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for safemath failure
+[[nodiscard]] HRESULT XtermEngine::InvalidateScrollRegion(const SMALL_RECT* const psrRegion, const COORD* const pcoordDelta) noexcept
+try
+{
+    const auto region = Viewport::FromExclusive(*psrRegion);
+    const short dy = pcoordDelta->Y;
+
+    // A margin scroll can only express a pure vertical shift of a band
+    // spanning the terminal's full width, and wintelnet doesn't understand
+    // the sequences at all. A pending deferred wrap would be broken by the
+    // cursor homing the margin sequences perform, and interleaving with a
+    // whole-frame scroll is more trouble than it's worth, so those frames
+    // fall back to plain damage too.
+    if (_fUseAsciiOnly ||
+        _passthrough ||
+        pcoordDelta->X != 0 ||
+        dy == 0 ||
+        abs(dy) >= region.Height() ||
+        region.Left() != 0 ||
+        region.Width() != _lastViewport.Width() ||
+        _wrappedRow.has_value() ||
+        _delayedEolWrap ||
+        _scrollDelta != til::point{ 0, 0 })
+    {
+        return Invalidate(psrRegion);
+    }
+
+    _trace.TraceInvalidateScroll(til::point{ 0, dy });
+    _regionScrolls.push_back({ region.Top(), region.BottomInclusive(), dy });
+
+    // Invalidate the whole band; ScrollFrame sorts out which rows actually
+    // need repainting once the scroll has been replayed.
+    const til::rect rect{ region.ToInclusive() };
+    _trace.TraceInvalidate(rect);
+    _invalidMap.set(rect);
+    return S_OK;
+}
+CATCH_RETURN();
+
 // Routine Description:
 // - Draws one line of the buffer to the screen. Writes the characters to the
 //      pipe, encoded in UTF-8 or ASCII only, depending on the VtIoMode.
@@ -101,6 +101,12 @@ CATCH_RETURN();
 // - Notifies us that we're about to circle the buffer, giving us a chance to
 //      force a repaint before the buffer contents are lost. The VT renderer
 //      needs to be able to render all text before it's lost, so we return true.
+// - Unless the terminal is behind: if a frame we already composed hasn't made
+//      it onto the wire yet, the client is producing frames faster than the
+//      terminal drains them, and rendering this one would only queue bytes
+//      that get scrolled away before they're ever shown. In that case we skip
+//      the paint and mark everything dirty instead, so the next frame that
+//      does go out re-snapshots whatever the buffer looks like by then.
 // Arguments:
 // - Receives a bool indicating if we should force the repaint.
 // Return Value:
@@ -112,6 +118,11 @@ CATCH_RETURN();
     {
         *pForcePaint = false;
     }
+    else if (circled && _PresentBacklogged())
+    {
+        *pForcePaint = false;
+        LOG_IF_FAILED(InvalidateAll());
+    }
     else
     {
         *pForcePaint = true;
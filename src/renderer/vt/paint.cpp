@@ -25,6 +25,15 @@ using namespace Microsoft::Console::Types;
         return S_FALSE;
     }
 
+    // Frames that are going to repaint the whole screen anyway (the first
+    // frame, a resize, or circling the buffer) must go out in full, so toss
+    // the record of previously-transmitted content before we consult it. The
+    // content diff only ever trims steady-state partial repaints.
+    if (_firstPaint || _resized || _circled)
+    {
+        _InvalidateShadowBuffer();
+    }
+
     // If there's nothing to do, quick return
     bool somethingToDo = _invalidMap.any() ||
                          _scrollDelta != til::point{ 0, 0 } ||
@@ -58,6 +67,7 @@ using namespace Microsoft::Console::Types;
     _invalidMap.reset_all();
 
     _scrollDelta = { 0, 0 };
+    _regionScrolls.clear();
     _clearedAllThisFrame = false;
     _cursorMoved = false;
     _firstPaint = false;
@@ -82,7 +92,17 @@ using namespace Microsoft::Console::Types;
         RETURN_IF_FAILED(_MoveCursor(_deferredCursorPos));
     }
 
-    RETURN_IF_FAILED(_Flush());
+    // Hand the composed frame off to be written by Present, which the
+    // renderer calls after releasing the console lock. The pipe write can
+    // block until the terminal drains the pipe, and there's no reason to make
+    // every thread that's waiting on the console wait on that too.
+    try
+    {
+        std::lock_guard<std::mutex> lock{ _flushMutex };
+        _flushBuffer.append(_buffer);
+        _buffer.clear();
+    }
+    CATCH_RETURN();
 
     return S_OK;
 }
@@ -90,14 +110,26 @@ using namespace Microsoft::Console::Types;
 // Routine Description:
 // - Used to perform longer running presentation steps outside the lock so the
 //      other threads can continue.
-// - Not currently used by VtEngine.
+// - This is where the frame EndPaint composed actually goes out on the pipe,
+//      in a single WriteFile. Downstream terminals therefore always receive
+//      whole frames, and the write blocking on a full pipe no longer stalls
+//      everything else that needs the console lock.
 // Arguments:
 // - <none>
 // Return Value:
-// - S_FALSE since we do nothing.
+// - S_OK or suitable HRESULT error from writing pipe.
 [[nodiscard]] HRESULT VtEngine::Present() noexcept
 {
-    return S_FALSE;
+#ifdef UNIT_TESTING
+    if (_hFile.get() == INVALID_HANDLE_VALUE)
+    {
+        // Do not flush during Unit Testing because we won't have a valid file.
+        return S_FALSE;
+    }
+#endif
+
+    std::lock_guard<std::mutex> lock{ _flushMutex };
+    return _WriteToPipe(_flushBuffer);
 }
 
 // Routine Description:
@@ -382,6 +414,19 @@ using namespace Microsoft::Console::Types;
         return S_OK;
     }
 
+    // If every cell this run would emit is identical to what we last
+    // transmitted for these positions - same glyphs, same widths, same
+    // attributes - then the terminal is already displaying it, and repainting
+    // it would only push redundant bytes down the pipe. Applications love
+    // rewriting an entire row to change one cell (status lines, prompts), and
+    // over a slow connection those bytes add up fast. We never take this
+    // shortcut on wrapped rows, since repainting the final cell is how the
+    // wrap state gets re-established downstream (GH#4415, GH#5181).
+    if (!lineWrapped && !clusters.empty() && _RunMatchesShadow(clusters, coord))
+    {
+        return S_OK;
+    }
+
     _bufferLine.clear();
     _bufferLine.reserve(clusters.size());
     short totalWidth = 0;
@@ -489,8 +534,16 @@ using namespace Microsoft::Console::Types;
     // Move the cursor to the start of this run.
     RETURN_IF_FAILED(_MoveCursor(coord));
 
-    // Write the actual text string
-    RETURN_IF_FAILED(VtEngine::_WriteTerminalUtf8({ _bufferLine.data(), cchActual }));
+    // Write the actual text string, with glyph width hints woven in when the
+    // attached terminal negotiated them.
+    if (_glyphWidthHints)
+    {
+        RETURN_IF_FAILED(_WriteTerminalUtf8Hinted(clusters, { _bufferLine.data(), cchActual }));
+    }
+    else
+    {
+        RETURN_IF_FAILED(VtEngine::_WriteTerminalUtf8({ _bufferLine.data(), cchActual }));
+    }
 
     // GH#4415, GH#5181
     // If the renderer told us that this was a wrapped line, then mark
@@ -587,9 +640,318 @@ using namespace Microsoft::Console::Types;
         _newBottomLineBG = std::nullopt;
     }
 
+    // Remember what we actually transmitted, so an identical repaint of these
+    // cells can be skipped next frame. Anything we trimmed or erased instead
+    // of writing is recorded as unknown and will repaint normally.
+    _RecordRunInShadow(clusters, coord, cchActual);
+
     return S_OK;
 }
 
+// Routine Description:
+// - Writes a run of text to the terminal, weaving conpty glyph width hints
+//   (CSI Pn ; Pw * w) ahead of stretches whose widths we already know. Our
+//   clusters carry exactly the classification the buffer derived when the
+//   client's output was first ingested, so for single-codepoint clusters the
+//   attached terminal can reuse it instead of re-deriving it per glyph. Runs
+//   of plain ASCII are written bare - the terminal classifies those with a
+//   trivial range check anyway, and the hint would cost more bytes than the
+//   lookup it saves.
+// Arguments:
+// - clusters - the glyphs (and their column counts) backing the text
+// - str - the wide string to write; a prefix of the clusters' combined text
+//   (trailing space cells may have been trimmed by the caller)
+// Return Value:
+// - S_OK or suitable HRESULT of writing failures.
+[[nodiscard]] HRESULT VtEngine::_WriteTerminalUtf8Hinted(const gsl::span<const Cluster> clusters, const std::wstring_view str) noexcept
+{
+    size_t offset = 0; // wchars of str written so far
+    size_t clusterIndex = 0;
+    while (offset < str.size())
+    {
+        // Collect a maximal run of single-codepoint clusters sharing one
+        // column width, remembering whether any of them sit outside ASCII
+        // (where the downstream width lookup stops being trivial).
+        size_t runChars = 0;
+        size_t runGlyphs = 0;
+        size_t runWidth = 0;
+        bool runOutsideAscii = false;
+        while (clusterIndex < clusters.size())
+        {
+            const auto text = til::at(clusters, clusterIndex).GetText();
+            if (offset + runChars + text.size() > str.size())
+            {
+                // The rest of this cluster was trimmed off the line.
+                break;
+            }
+            const auto width = til::at(clusters, clusterIndex).GetColumns();
+            const auto singleCodepoint = text.size() == 1 ||
+                                         (text.size() == 2 && text.front() >= 0xD800 && text.front() <= 0xDBFF);
+            if (!singleCodepoint || (width != 1 && width != 2) || (runGlyphs > 0 && width != runWidth))
+            {
+                break;
+            }
+            runWidth = width;
+            runOutsideAscii |= text.front() >= 0x80;
+            runChars += text.size();
+            runGlyphs++;
+            clusterIndex++;
+        }
+
+        if (runGlyphs == 0)
+        {
+            // The next cluster can't be described by a hint (several
+            // codepoints composed into one cell, or an unexpected width).
+            // Write it bare; the terminal will classify it as usual.
+            if (clusterIndex >= clusters.size())
+            {
+                // Shouldn't happen - str is backed by the clusters - but
+                // don't spin if they disagree.
+                return VtEngine::_WriteTerminalUtf8(str.substr(offset));
+            }
+            const auto text = til::at(clusters, clusterIndex).GetText();
+            const auto chars = std::min(text.size(), str.size() - offset);
+            if (chars > 0)
+            {
+                RETURN_IF_FAILED(VtEngine::_WriteTerminalUtf8(str.substr(offset, chars)));
+                offset += chars;
+            }
+            clusterIndex++;
+            continue;
+        }
+
+        if (runOutsideAscii)
+        {
+            RETURN_IF_FAILED(_GlyphWidthHint(runGlyphs, runWidth));
+        }
+        RETURN_IF_FAILED(VtEngine::_WriteTerminalUtf8(str.substr(offset, runChars)));
+        offset += runChars;
+    }
+    return S_OK;
+}
+
+// Routine Description:
+// - Checks whether a run of text would reproduce, cell for cell, what we last
+//      transmitted for those viewport positions. When it would, the attached
+//      terminal is already displaying exactly this content and the run can be
+//      skipped instead of sent again.
+// Arguments:
+// - clusters - text and column width data the renderer wants painted
+// - coord - character coordinate target to render within viewport
+// Return Value:
+// - true if every cluster matches the recorded contents at its position.
+bool VtEngine::_RunMatchesShadow(const gsl::span<const Cluster> clusters, const COORD coord) const noexcept
+{
+    if (coord.X < 0 || coord.Y < 0 || static_cast<size_t>(coord.Y) >= _shadowBuffer.size())
+    {
+        return false;
+    }
+
+    const auto& row = _shadowBuffer[coord.Y];
+    size_t col = coord.X;
+    for (const auto& cluster : clusters)
+    {
+        const auto columns = cluster.GetColumns();
+        if (columns == 0 || col + columns > row.size())
+        {
+            return false;
+        }
+
+        const auto& cell = row[col];
+        if (!cell.valid ||
+            cell.columns != columns ||
+            cell.attr != _lastTextAttributes ||
+            cell.text != cluster.GetText())
+        {
+            return false;
+        }
+
+        col += columns;
+    }
+
+    return true;
+}
+
+// Routine Description:
+// - Records a run we just transmitted into the shadow of the viewport
+//      contents. Only the characters that actually went out on the wire are
+//      recorded; columns covered by the run that were trimmed or erased
+//      instead of written are forgotten, so they'll always repaint.
+// Arguments:
+// - clusters - text and column width data that was just painted
+// - coord - character coordinate the run was rendered at
+// - cchWritten - how many characters of the assembled line made it to the pipe
+// Return Value:
+// - <none>
+void VtEngine::_RecordRunInShadow(const gsl::span<const Cluster> clusters, const COORD coord, const size_t cchWritten)
+{
+    if (coord.X < 0 || coord.Y < 0)
+    {
+        return;
+    }
+
+    // (Re)build the shadow storage if the viewport dimensions have changed out
+    // from under it. Everything starts out unrecorded.
+    const auto width = gsl::narrow_cast<size_t>(std::max<short>(0, _lastViewport.Width()));
+    const auto height = gsl::narrow_cast<size_t>(std::max<short>(0, _lastViewport.Height()));
+    if (_shadowBuffer.size() != height || (height > 0 && _shadowBuffer.front().size() != width))
+    {
+        _shadowBuffer.assign(height, std::vector<ShadowCell>(width));
+    }
+
+    if (static_cast<size_t>(coord.Y) >= height)
+    {
+        return;
+    }
+
+    auto& row = _shadowBuffer[coord.Y];
+    size_t col = coord.X;
+    size_t cch = 0;
+    for (const auto& cluster : clusters)
+    {
+        const auto text = cluster.GetText();
+        const auto columns = cluster.GetColumns();
+        if (columns == 0 || col + columns > width)
+        {
+            break;
+        }
+
+        auto& cell = row[col];
+        if (cch + text.size() <= cchWritten)
+        {
+            cell.text = text;
+            cell.columns = columns;
+            cell.attr = _lastTextAttributes;
+            cell.valid = true;
+        }
+        else
+        {
+            // This cluster was trimmed off the end of the line.
+            cell.valid = false;
+        }
+
+        // A wide glyph's trailing column can never start a match on its own.
+        for (size_t i = 1; i < columns; i++)
+        {
+            row[col + i].valid = false;
+        }
+
+        cch += text.size();
+        col += columns;
+    }
+}
+
+// Routine Description:
+// - Rotates the recorded viewport contents to follow a vertical scroll that
+//      ScrollFrame just performed, so cells that merely moved stay
+//      recognizable to the content diff. Rows revealed by the scroll are
+//      forgotten.
+// Arguments:
+// - dy - the vertical distance the frame contents moved (negative is up)
+// Return Value:
+// - <none>
+void VtEngine::_ScrollShadowBuffer(const short dy)
+{
+    const auto height = _shadowBuffer.size();
+    if (dy == 0 || height == 0)
+    {
+        return;
+    }
+
+    const auto absDy = gsl::narrow_cast<size_t>(abs(dy));
+    if (absDy >= height)
+    {
+        _InvalidateShadowBuffer();
+        return;
+    }
+
+    const auto width = _shadowBuffer.front().size();
+    if (dy < 0)
+    {
+        // Content moved up: row N now holds what row N+|dy| held.
+        std::rotate(_shadowBuffer.begin(), _shadowBuffer.begin() + absDy, _shadowBuffer.end());
+        for (auto i = height - absDy; i < height; i++)
+        {
+            _shadowBuffer[i].assign(width, ShadowCell{});
+        }
+    }
+    else
+    {
+        // Content moved down: rows were revealed at the top.
+        std::rotate(_shadowBuffer.begin(), _shadowBuffer.end() - absDy, _shadowBuffer.end());
+        for (size_t i = 0; i < absDy; i++)
+        {
+            _shadowBuffer[i].assign(width, ShadowCell{});
+        }
+    }
+}
+
+// Routine Description:
+// - Rotates the recorded contents of just the rows between top and bottom,
+//      inclusive, to follow a margin scroll that ScrollFrame performed. Rows
+//      the scroll revealed inside the band are forgotten.
+// Arguments:
+// - top - the first row of the scrolled band
+// - bottom - the last row of the scrolled band, inclusive
+// - dy - the vertical distance the band's contents moved (negative is up)
+// Return Value:
+// - <none>
+void VtEngine::_ScrollShadowBufferRegion(const short top, const short bottom, const short dy)
+{
+    const auto height = _shadowBuffer.size();
+    if (dy == 0 || height == 0 || top < 0 || bottom < top || gsl::narrow_cast<size_t>(bottom) >= height)
+    {
+        return;
+    }
+
+    const auto width = _shadowBuffer.front().size();
+    const auto first = _shadowBuffer.begin() + top;
+    const auto last = _shadowBuffer.begin() + bottom + 1;
+    const auto bandHeight = gsl::narrow_cast<size_t>(bottom - top + 1);
+    const auto absDy = gsl::narrow_cast<size_t>(abs(dy));
+    if (absDy >= bandHeight)
+    {
+        for (auto it = first; it != last; ++it)
+        {
+            it->assign(width, ShadowCell{});
+        }
+        return;
+    }
+
+    if (dy < 0)
+    {
+        // Band contents moved up: its row N now holds what row N+|dy| held.
+        std::rotate(first, first + absDy, last);
+        for (auto it = last - absDy; it != last; ++it)
+        {
+            it->assign(width, ShadowCell{});
+        }
+    }
+    else
+    {
+        // Band contents moved down: rows were revealed at its top.
+        std::rotate(first, last - absDy, last);
+        for (auto it = first; it != first + absDy; ++it)
+        {
+            it->assign(width, ShadowCell{});
+        }
+    }
+}
+
+// Routine Description:
+// - Throws away everything we've recorded about previously-transmitted
+//      content. Used whenever the attached terminal's screen no longer
+//      matches what we've sent (clears, resizes, buffer switches), so the
+//      content diff can't skip anything until it re-learns the frame.
+// Arguments:
+// - <none>
+// Return Value:
+// - <none>
+void VtEngine::_InvalidateShadowBuffer() noexcept
+{
+    _shadowBuffer.clear();
+}
+
 // Method Description:
 // - Updates the window's title string. Emits the VT sequence to SetWindowTitle.
 //      Because wintelnet does not understand these sequences by default, we
@@ -4,6 +4,7 @@
 #include "precomp.h"
 #include "vtrenderer.hpp"
 #include "../../inc/conattrs.hpp"
+#include "../../inc/ConptyCapture.h"
 #include "../../host/VtIo.hpp"
 
 // For _vcprintf
@@ -31,7 +32,7 @@ VtEngine::VtEngine(_In_ wil::unique_hfile pipe,
     _hFile(std::move(pipe)),
     _lastTextAttributes(INVALID_COLOR, INVALID_COLOR),
     _lastViewport(initialViewport),
-    _pool(til::pmr::get_default_resource()),
+    _pool(&_poolTally),
     _invalidMap(til::size{ initialViewport.Dimensions() }, false, &_pool),
     _lastText({ 0 }),
     _scrollDelta(0, 0),
@@ -66,6 +67,29 @@ VtEngine::VtEngine(_In_ wil::unique_hfile pipe,
 #endif
 }
 
+VtEngine::~VtEngine()
+{
+    // Give the composition buffers' bytes back to the tally; the pool's own
+    // holdings return through _poolTally when its members destruct.
+    PerfCounters::Instance().rendererAllocations.OnFree(_talliedCompositionBytes);
+}
+
+// Method Description:
+// - Reconciles the renderer allocation tally with what the composition
+//      strings currently hold. Called wherever those strings grow or get
+//      emptied; capacities only ever ratchet up between calls, so this
+//      observes every growth even though it doesn't see each allocation.
+void VtEngine::_TallyCompositionBuffers() noexcept
+{
+    const size_t current = _buffer.capacity() +
+                           _flushBuffer.capacity() +
+                           _formatBuffer.capacity() +
+                           _conversionBuffer.capacity() +
+                           _bufferLine.capacity() * sizeof(wchar_t);
+    PerfCounters::Instance().rendererAllocations.OnResize(_talliedCompositionBytes, current);
+    _talliedCompositionBytes = current;
+}
+
 // Method Description:
 // - Writes a fill of characters to our file handle (repeat of same character over and over)
 [[nodiscard]] HRESULT VtEngine::_WriteFill(const size_t n, const char c) noexcept
@@ -93,6 +117,7 @@ try
 
     // TODO GH10001: Replace me with REP
     _buffer.append(n, c);
+    _TallyCompositionBuffers();
     return S_OK;
 }
 CATCH_RETURN();
@@ -129,6 +154,7 @@ CATCH_RETURN();
     try
     {
         _buffer.append(str);
+        _TallyCompositionBuffers();
 
         return S_OK;
     }
@@ -145,20 +171,88 @@ CATCH_RETURN();
     }
 #endif
 
-    if (!_pipeBroken)
+    std::lock_guard<std::mutex> lock{ _flushMutex };
+
+    // If a composed frame is still waiting on the render thread to present
+    // it, it has to go out first, so the pipe sees bytes in the order they
+    // were produced.
+    RETURN_IF_FAILED(_WriteToPipe(_flushBuffer));
+    return _WriteToPipe(_buffer);
+}
+
+// Method Description:
+// - Determines whether the pipe is behind on frames we've already composed.
+//      That's the case when a Present is blocked in WriteFile right now (the
+//      terminal isn't draining the pipe), or when a finished frame is still
+//      sitting in _flushBuffer waiting for the render thread to present it.
+// Arguments:
+// - <none>
+// Return Value:
+// - true if a previously composed frame hasn't made it onto the wire yet.
+[[nodiscard]] bool VtEngine::_PresentBacklogged() noexcept
+{
+#ifdef UNIT_TESTING
+    if (_hFile.get() == INVALID_HANDLE_VALUE)
     {
-        bool fSuccess = !!WriteFile(_hFile.get(), _buffer.data(), gsl::narrow_cast<DWORD>(_buffer.size()), nullptr, nullptr);
-        _buffer.clear();
-        if (!fSuccess)
+        // Unit tests don't present frames, so nothing is ever backlogged.
+        return false;
+    }
+#endif
+
+    std::unique_lock<std::mutex> lock{ _flushMutex, std::try_to_lock };
+    return !lock.owns_lock() || !_flushBuffer.empty();
+}
+
+// Method Description:
+// - Writes the contents of the given buffer to the pipe and empties it. The
+//      caller is responsible for holding _flushMutex.
+// Arguments:
+// - buffer: the accumulated output to put on the wire.
+// Return Value:
+// - S_OK or suitable HRESULT error from writing pipe.
+[[nodiscard]] HRESULT VtEngine::_WriteToPipe(std::string& buffer) noexcept
+{
+    if (buffer.empty())
+    {
+        return S_OK;
+    }
+
+    if (_pipeBroken)
+    {
+        // There's nobody left to read this. Throw it away, so we don't
+        // accumulate output forever.
+        buffer.clear();
+        return S_OK;
+    }
+
+    // If a capture was requested (CONPTY_CAPTURE_DIR), record exactly the
+    // bytes that are about to go on the wire.
+    if (const auto capture = ConptyCapture::ProcessCapture())
+    {
+        capture->Record(ConptyCapture::Direction::Output, buffer.data(), buffer.size());
+    }
+
+    HRESULT hr = S_OK;
+    if (_outputRing)
+    {
+        // The ring blocks when full exactly the way a full pipe blocks
+        // WriteFile, and fails the same way when the terminal hangs up.
+        hr = _outputRing->Write(buffer);
+    }
+    else if (!WriteFile(_hFile.get(), buffer.data(), gsl::narrow_cast<DWORD>(buffer.size()), nullptr, nullptr))
+    {
+        hr = HRESULT_FROM_WIN32(GetLastError());
+    }
+    buffer.clear();
+    if (FAILED(hr))
+    {
+        _exitResult = hr;
+        _pipeBroken = true;
+        if (_terminalOwner)
         {
-            _exitResult = HRESULT_FROM_WIN32(GetLastError());
-            _pipeBroken = true;
-            if (_terminalOwner)
-            {
-                _terminalOwner->CloseOutput();
-            }
-            return _exitResult;
+            _terminalOwner->CloseOutput();
         }
+        return _exitResult;
     }
 
     return S_OK;
@@ -184,6 +278,22 @@ CATCH_RETURN();
     return _Write(_conversionBuffer);
 }
 
+// Method Description:
+// - Streaming variant of _WriteTerminalUtf8 for back-to-back client writes in
+//      passthrough mode. The conversion state is carried from one call to the
+//      next, so a surrogate pair that a client split across two WriteConsole
+//      calls still encodes as a single UTF-8 sequence instead of two
+//      replacement characters.
+// Arguments:
+// - wstr - wstring of text to be written
+// Return Value:
+// - S_OK or suitable HRESULT error from either conversion or writing pipe.
+[[nodiscard]] HRESULT VtEngine::_WriteTerminalUtf8Stream(const std::wstring_view wstr) noexcept
+{
+    RETURN_IF_FAILED(til::u16u8(wstr, _conversionBuffer, _streamConversionState));
+    return _Write(_conversionBuffer);
+}
+
 // Method Description:
 // - Writes a wstring to the tty, encoded as "utf-8" where characters that are
 //      outside the ASCII range are encoded as '?'
@@ -472,6 +582,19 @@ void VtEngine::SetResizeQuirk(const bool resizeQuirk)
     _resizeQuirk = resizeQuirk;
 }
 
+// Method Description:
+// - Configure the renderer to annotate the text it emits with glyph width
+//   hints (CSI Pn ; Pw * w), so a terminal that negotiated them at handoff
+//   can reuse our width classification instead of re-deriving it per glyph.
+// Arguments:
+// - glyphWidthHints - True to emit the hints. False otherwise.
+// Return Value:
+// - <none>
+void VtEngine::SetGlyphWidthHints(const bool glyphWidthHints) noexcept
+{
+    _glyphWidthHints = glyphWidthHints;
+}
+
 // Method Description:
 // - Configure the renderer to understand that we're operating in limited-draw
 //   passthrough mode. We do not need to handle full responsibility for replicating
@@ -490,6 +613,19 @@ void VtEngine::SetLookingForDSRCallback(std::function<void(bool)> pfnLooking) no
     _pfnSetLookingForDSR = pfnLooking;
 }
 
+// Method Description:
+// - Routes all further output into the shared memory ring negotiated at
+//   handoff instead of the pipe. The ring's destructor hangs up cleanly, so
+//   the attached terminal still sees an end-of-stream when we go away.
+// Arguments:
+// - ring - The producer side of the ring.
+// Return Value:
+// - <none>
+void VtEngine::SetOutputRing(std::unique_ptr<Microsoft::Console::ConptyRing> ring) noexcept
+{
+    _outputRing = std::move(ring);
+}
+
 void VtEngine::SetTerminalCursorTextPosition(const COORD cursor) noexcept
 {
     _lastText = cursor;
@@ -531,6 +667,9 @@ HRESULT VtEngine::RequestWin32Input() noexcept
 HRESULT VtEngine::SwitchScreenBuffer(const bool useAltBuffer) noexcept
 {
     RETURN_IF_FAILED(_SwitchScreenBuffer(useAltBuffer));
+    // The two screen buffers have entirely different contents; nothing we've
+    // transmitted to one describes the other.
+    _InvalidateShadowBuffer();
     RETURN_IF_FAILED(_Flush());
     return S_OK;
 }
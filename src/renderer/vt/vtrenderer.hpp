@@ -17,9 +17,12 @@ Author(s):
 
 #include "../inc/RenderEngineBase.hpp"
 #include "../../types/inc/Viewport.hpp"
+#include "../../inc/ConptyRing.h"
+#include "../../inc/ConsolePerfCounters.h"
 #include "tracing.hpp"
 #include <string>
 #include <functional>
+#include <mutex>
 
 // fwdecl unittest classes
 #ifdef UNIT_TESTING
@@ -45,6 +48,7 @@ namespace Microsoft::Console::Render
 
         VtEngine(_In_ wil::unique_hfile hPipe,
                  const Microsoft::Console::Types::Viewport initialViewport);
+        ~VtEngine() override;
 
         // IRenderEngine
         [[nodiscard]] HRESULT StartPaint() noexcept override;
@@ -81,6 +85,8 @@ namespace Microsoft::Console::Render
         void EndResizeRequest();
         void SetResizeQuirk(const bool resizeQuirk);
         void SetPassthroughMode(const bool passthrough) noexcept;
+        void SetGlyphWidthHints(const bool glyphWidthHints) noexcept;
+        void SetOutputRing(std::unique_ptr<Microsoft::Console::ConptyRing> ring) noexcept;
         void SetLookingForDSRCallback(std::function<void(bool)> pfnLooking) noexcept;
         void SetTerminalCursorTextPosition(const COORD coordCursor) noexcept;
         [[nodiscard]] virtual HRESULT ManuallyClearScrollback() noexcept;
@@ -89,10 +95,26 @@ namespace Microsoft::Console::Render
 
     protected:
         wil::unique_hfile _hFile;
+        // When a shared memory ring was negotiated at handoff, frames go into
+        // it instead of down the pipe. The pipe handle stays open regardless,
+        // since it anchors the conpty's lifetime semantics.
+        std::unique_ptr<Microsoft::Console::ConptyRing> _outputRing;
         std::string _buffer;
 
+        // Frames are composed into _buffer under the console lock, then handed
+        // off here at EndPaint so Present can write them to the pipe after the
+        // lock has been released. _flushMutex guards the handoff and the pipe
+        // write itself, since the out-of-band flush paths (DSR requests,
+        // passthrough writes) still write from under the console lock.
+        std::string _flushBuffer;
+        std::mutex _flushMutex;
+
         std::string _formatBuffer;
         std::string _conversionBuffer;
+        // Carries a trailing high surrogate between consecutive streaming
+        // writes, so pairs split across client WriteConsole calls still
+        // convert as one codepoint.
+        til::u16state _streamConversionState;
 
         TextAttribute _lastTextAttributes;
 
@@ -100,12 +122,27 @@ namespace Microsoft::Console::Render
 
         Microsoft::Console::Types::Viewport _lastViewport;
 
+        // The tally under the invalidation pool attributes its demand to the
+        // renderer in the process-wide allocation statistics.
+        Microsoft::Console::TalliedResource _poolTally{ Microsoft::Console::PerfCounters::Instance().rendererAllocations, til::pmr::get_default_resource() };
         std::pmr::unsynchronized_pool_resource _pool;
         til::pmr::bitmap _invalidMap;
 
         COORD _lastText;
         til::point _scrollDelta;
 
+        // Full-width bands the host scrolled vertically this frame, replayed
+        // by ScrollFrame as DECSTBM margin scrolls ahead of the repaint. Rows
+        // are viewport-relative and inclusive; a negative dy means the band's
+        // contents moved up.
+        struct RegionScroll
+        {
+            short top;
+            short bottom;
+            short dy;
+        };
+        std::vector<RegionScroll> _regionScrolls;
+
         bool _quickReturn;
         bool _clearedAllThisFrame;
         bool _cursorMoved;
@@ -133,19 +170,59 @@ namespace Microsoft::Console::Render
 
         bool _resizeQuirk{ false };
         bool _passthrough{ false };
+        bool _glyphWidthHints{ false };
         std::optional<TextColor> _newBottomLineBG{ std::nullopt };
 
+        // A cell-by-cell record of what we last transmitted for each viewport
+        // position, used by _PaintUtf8BufferLine to drop repaints that
+        // wouldn't change anything on the attached terminal. A cell that
+        // isn't valid always repaints.
+        struct ShadowCell
+        {
+            std::wstring text;
+            size_t columns = 0;
+            TextAttribute attr;
+            bool valid = false;
+        };
+        std::vector<std::vector<ShadowCell>> _shadowBuffer;
+
+        void _InvalidateShadowBuffer() noexcept;
+        void _ScrollShadowBuffer(const short dy);
+        void _ScrollShadowBufferRegion(const short top, const short bottom, const short dy);
+        bool _RunMatchesShadow(const gsl::span<const Cluster> clusters, const COORD coord) const noexcept;
+        void _RecordRunInShadow(const gsl::span<const Cluster> clusters, const COORD coord, const size_t cchWritten);
+
         [[nodiscard]] HRESULT _WriteFill(const size_t n, const char c) noexcept;
         [[nodiscard]] HRESULT _Write(std::string_view const str) noexcept;
         [[nodiscard]] HRESULT _Flush() noexcept;
+        [[nodiscard]] HRESULT _WriteToPipe(std::string& buffer) noexcept;
+        [[nodiscard]] bool _PresentBacklogged() noexcept;
+        void _TallyCompositionBuffers() noexcept;
+
+        // What the composition strings below currently hold against the
+        // renderer allocation tally; see _TallyCompositionBuffers.
+        size_t _talliedCompositionBytes{ 0 };
 
         template<typename S, typename... Args>
         [[nodiscard]] HRESULT _WriteFormatted(S&& format, Args&&... args)
         try
         {
-            fmt::basic_memory_buffer<char, 64> buf;
-            fmt::format_to(std::back_inserter(buf), std::forward<S>(format), std::forward<Args>(args)...);
-            return _Write({ buf.data(), buf.size() });
+#ifdef UNIT_TESTING
+            if (_usingTestCallback)
+            {
+                fmt::basic_memory_buffer<char, 64> buf;
+                fmt::format_to(std::back_inserter(buf), std::forward<S>(format), std::forward<Args>(args)...);
+                return _Write({ buf.data(), buf.size() });
+            }
+#endif
+
+            // Formatting straight into the output buffer spares us an
+            // intermediate stack buffer and a copy for every sequence.
+            const auto offset = _buffer.size();
+            fmt::format_to(std::back_inserter(_buffer), std::forward<S>(format), std::forward<Args>(args)...);
+            _trace.TraceString({ _buffer.data() + offset, _buffer.size() - offset });
+            _TallyCompositionBuffers();
+            return S_OK;
         }
         CATCH_RETURN()
 
@@ -160,8 +237,10 @@ namespace Microsoft::Console::Render
         [[nodiscard]] HRESULT _InsertDeleteLine(const short sLines, const bool fInsertLine) noexcept;
         [[nodiscard]] HRESULT _DeleteLine(const short sLines) noexcept;
         [[nodiscard]] HRESULT _InsertLine(const short sLines) noexcept;
+        [[nodiscard]] HRESULT _ScrollRegion(const short top, const short bottom, const short dy) noexcept;
         [[nodiscard]] HRESULT _CursorForward(const short chars) noexcept;
         [[nodiscard]] HRESULT _EraseCharacter(const short chars) noexcept;
+        [[nodiscard]] HRESULT _GlyphWidthHint(const size_t count, const size_t width) noexcept;
         [[nodiscard]] HRESULT _CursorPosition(const COORD coord) noexcept;
         [[nodiscard]] HRESULT _CursorHome() noexcept;
         [[nodiscard]] HRESULT _ClearScreen() noexcept;
@@ -216,6 +295,8 @@ namespace Microsoft::Console::Render
                                                     const COORD coord) noexcept;
 
         [[nodiscard]] HRESULT _WriteTerminalUtf8(const std::wstring_view str) noexcept;
+        [[nodiscard]] HRESULT _WriteTerminalUtf8Hinted(const gsl::span<const Cluster> clusters, const std::wstring_view str) noexcept;
+        [[nodiscard]] HRESULT _WriteTerminalUtf8Stream(const std::wstring_view str) noexcept;
         [[nodiscard]] HRESULT _WriteTerminalAscii(const std::wstring_view str) noexcept;
 
         [[nodiscard]] virtual HRESULT _DoUpdateTitle(const std::wstring_view newTitle) noexcept override;
@@ -7,11 +7,19 @@
 
 #include "../host/directio.h"
 #include "../host/getset.h"
+#include "../host/globals.h"
+#include "../host/handle.h"
+#include "../host/server.h"
 #include "../host/stream.h"
 #include "../host/srvinit.h"
 #include "../host/telemetry.hpp"
 #include "../host/cmdline.h"
 
+#include "../interactivity/inc/ServiceLocator.hpp"
+#include "../types/inc/Utf16Parser.hpp"
+
+using Microsoft::Console::Interactivity::ServiceLocator;
+
 [[nodiscard]] HRESULT ApiDispatchers::ServerGetConsoleCP(_Inout_ CONSOLE_API_MSG* const m,
                                                          _Inout_ BOOL* const /*pbReplyPending*/)
 {
@@ -108,6 +116,30 @@
     return m->_pApiRoutines->GetNumberOfConsoleInputEventsImpl(*pObj, a->ReadyEvents);
 }
 
+// Routine Description:
+// - When line-atomic write arbitration is on, pushes every staged partial
+//   line out before a client starts reading input, so a prompt that ends
+//   mid-line is visible while its writer waits for the answer.
+static void _CommitStagedWritesBeforeRead()
+{
+    CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+    if (gci.GetLineAtomicWrites())
+    {
+        LockConsole();
+        auto unlock = wil::scope_exit([&] { UnlockConsole(); });
+
+        // While the console is frozen nothing can be written through; the
+        // tails simply stay staged until it thaws.
+        if (WI_AreAllFlagsClear(gci.Flags, CONSOLE_SUSPENDED | CONSOLE_SELECTING | CONSOLE_SCROLLBAR_TRACKING))
+        {
+            for (auto pScreenInfo = gci.ScreenBuffers; pScreenInfo != nullptr; pScreenInfo = pScreenInfo->Next)
+            {
+                pScreenInfo->CommitAllStagedWrites();
+            }
+        }
+    }
+}
+
 [[nodiscard]] HRESULT ApiDispatchers::ServerGetConsoleInput(_Inout_ CONSOLE_API_MSG* const m,
                                                             _Inout_ BOOL* const pbReplyPending)
 {
@@ -137,6 +169,8 @@
     InputBuffer* pInputBuffer;
     RETURN_IF_FAILED(pHandleData->GetInputBuffer(GENERIC_READ, &pInputBuffer));
 
+    _CommitStagedWritesBeforeRead();
+
     // Get output buffer.
     PVOID pvBuffer;
     ULONG cbBufferSize;
@@ -152,14 +186,14 @@
 
     std::unique_ptr<IWaitRoutine> waiter;
     HRESULT hr;
-    std::deque<std::unique_ptr<IInputEvent>> outEvents;
+    std::deque<INPUT_RECORD> outRecords;
     size_t const eventsToRead = cRecords;
     if (a->Unicode)
     {
         if (fIsPeek)
         {
             hr = m->_pApiRoutines->PeekConsoleInputWImpl(*pInputBuffer,
-                                                         outEvents,
+                                                         outRecords,
                                                          eventsToRead,
                                                          *pInputReadHandleData,
                                                          waiter);
@@ -167,7 +201,7 @@
         else
         {
             hr = m->_pApiRoutines->ReadConsoleInputWImpl(*pInputBuffer,
-                                                         outEvents,
+                                                         outRecords,
                                                          eventsToRead,
                                                          *pInputReadHandleData,
                                                          waiter);
@@ -178,7 +212,7 @@
         if (fIsPeek)
         {
             hr = m->_pApiRoutines->PeekConsoleInputAImpl(*pInputBuffer,
-                                                         outEvents,
+                                                         outRecords,
                                                          eventsToRead,
                                                          *pInputReadHandleData,
                                                          waiter);
@@ -186,7 +220,7 @@
         else
         {
             hr = m->_pApiRoutines->ReadConsoleInputAImpl(*pInputBuffer,
-                                                         outEvents,
+                                                         outRecords,
                                                          eventsToRead,
                                                          *pInputReadHandleData,
                                                          waiter);
@@ -195,10 +229,10 @@
 
     // We must return the number of records in the message payload (to alert the client)
     // as well as in the message headers (below in SetReplyInformation) to alert the driver.
-    LOG_IF_FAILED(SizeTToULong(outEvents.size(), &a->NumRecords));
+    LOG_IF_FAILED(SizeTToULong(outRecords.size(), &a->NumRecords));
 
     size_t cbWritten;
-    LOG_IF_FAILED(SizeTMult(outEvents.size(), sizeof(INPUT_RECORD), &cbWritten));
+    LOG_IF_FAILED(SizeTMult(outRecords.size(), sizeof(INPUT_RECORD), &cbWritten));
 
     if (nullptr != waiter.get())
     {
@@ -232,12 +266,12 @@
         {
             for (size_t i = 0; i < cRecords; ++i)
             {
-                if (outEvents.empty())
+                if (outRecords.empty())
                 {
                     break;
                 }
-                rgRecords[i] = outEvents.front()->ToInputRecord();
-                outEvents.pop_front();
+                rgRecords[i] = outRecords.front();
+                outRecords.pop_front();
             }
         }
         CATCH_RETURN();
@@ -267,6 +301,8 @@
     InputBuffer* pInputBuffer;
     RETURN_IF_FAILED(HandleData->GetInputBuffer(GENERIC_READ, &pInputBuffer));
 
+    _CommitStagedWritesBeforeRead();
+
     // Get output parameter buffer.
     PVOID pvBuffer;
     ULONG cbBufferSize;
@@ -385,6 +421,224 @@
     return hr;
 }
 
+// Payloads at least this large take the chunked path below instead of being staged whole.
+constexpr ULONG cbWriteConsoleChunkThreshold = 128 * 1024;
+
+// How many wide characters each chunk reads out of the client's buffer at a time.
+constexpr size_t cchWriteConsoleChunk = 16 * 1024;
+
+// Routine Description:
+// - Streams a large Unicode WriteConsole payload out of the client's buffer in fixed-size
+//   chunks instead of staging the entire payload server-side first. Each ReadMessageInput
+//   has the driver copy straight from the client's (pinned) buffer into a reusable chunk,
+//   and the VT parser consumes it in place; the only bytes handled twice are a carried-over
+//   high surrogate when a chunk boundary would otherwise split a pair.
+// - The caller must hold the console lock and have verified that no write wait can engage
+//   (the wait path needs the complete payload captured up front, which this path avoids).
+// Arguments:
+// - m - The message whose input payload is being written.
+// - screenInfo - The screen buffer receiving the text.
+// - cbPayload - Size of the client's payload in bytes.
+// - requiresVtQuirk - Whether the calling process needs the VT color quirk.
+// - cbRead - Receives how many bytes of the payload were consumed.
+// Return Value:
+// - S_OK or a suitable error; on partial failure, cbRead reports how far we got.
+[[nodiscard]] static HRESULT _WriteConsoleWChunked(_Inout_ CONSOLE_API_MSG* const m,
+                                                   SCREEN_INFORMATION& screenInfo,
+                                                   const ULONG cbPayload,
+                                                   const bool requiresVtQuirk,
+                                                   size_t& cbRead)
+{
+    cbRead = 0;
+
+    // Leave the first slot free so a carried surrogate can be made contiguous with the next chunk.
+    const auto chunk = std::make_unique<wchar_t[]>(cchWriteConsoleChunk + 1);
+    wchar_t* const readTarget = chunk.get() + 1;
+
+    wchar_t carry = UNICODE_NULL;
+    bool haveCarry = false;
+    ULONG cbOffset = 0;
+    while (cbOffset < cbPayload)
+    {
+        const ULONG cbChunk = std::min(gsl::narrow_cast<ULONG>(cchWriteConsoleChunk * sizeof(wchar_t)), cbPayload - cbOffset);
+        RETURN_IF_FAILED(m->ReadMessageInput(cbOffset, readTarget, cbChunk));
+        cbOffset += cbChunk;
+
+        // An odd trailing byte can only occur on the final chunk and is dropped,
+        // exactly as the staged path's character division drops it.
+        auto text = std::wstring_view{ readTarget, cbChunk / sizeof(wchar_t) };
+        if (haveCarry)
+        {
+            chunk[0] = carry;
+            text = { chunk.get(), text.size() + 1 };
+            haveCarry = false;
+        }
+
+        // Hold back a trailing high surrogate so the pair reaches the parser together.
+        if (cbOffset < cbPayload && !text.empty() && Utf16Parser::IsLeadingSurrogate(text.back()))
+        {
+            carry = text.back();
+            text.remove_suffix(1);
+            haveCarry = true;
+        }
+
+        std::unique_ptr<IWaitRoutine> waiter;
+        size_t cchChunkRead = 0;
+        const HRESULT hr = m->_pApiRoutines->WriteConsoleWImpl(screenInfo, text, cchChunkRead, requiresVtQuirk, waiter);
+
+        // The caller checked the wait-provoking console flags under the lock it still
+        // holds, so a wait here would replay with only this chunk's data. Never continue.
+        FAIL_FAST_IF(waiter != nullptr);
+
+        // A carried surrogate isn't counted until the chunk that actually writes it lands.
+        cbRead += cchChunkRead * sizeof(wchar_t);
+        RETURN_IF_FAILED(hr);
+        if (cchChunkRead < text.size())
+        {
+            // The write is allowed to stop partway through the string; report how far it got.
+            return S_OK;
+        }
+    }
+
+    if (haveCarry)
+    {
+        // The payload ended on a lone high surrogate; write it through as-is.
+        std::unique_ptr<IWaitRoutine> waiter;
+        size_t cchChunkRead = 0;
+        const HRESULT hr = m->_pApiRoutines->WriteConsoleWImpl(screenInfo, { &carry, 1 }, cchChunkRead, requiresVtQuirk, waiter);
+        FAIL_FAST_IF(waiter != nullptr);
+        cbRead += cchChunkRead * sizeof(wchar_t);
+        RETURN_IF_FAILED(hr);
+    }
+
+    return S_OK;
+}
+
+// A staged tail may grow to this many bytes while waiting for its newline before
+// being forced through anyway (cursor-addressed output never sends newlines).
+constexpr size_t cbStagedWriteTailCap = 8 * 1024;
+
+// Routine Description:
+// - Performs a WriteConsole call with line-atomic arbitration between clients.
+//   The payload is appended to the calling handle's staged bytes and only the
+//   portion up to (and including) the last newline is written through; the
+//   unfinished final line stays staged until the same handle completes it.
+//   Concurrent writers can then only interleave at line boundaries.
+// - The caller must hold the console lock and have verified that no write wait
+//   can engage. Staged bytes are reported to the client as already written.
+// Arguments:
+// - m - The message whose input payload is being written.
+// - screenInfo - The screen buffer receiving the text.
+// - handleKey - Identity of the client handle doing the writing.
+// - unicode - Whether the payload is UTF-16 (W call) or codepage bytes (A call).
+// - requiresVtQuirk - Whether the calling process needs the VT color quirk.
+// - cbRead - Receives how many bytes of the payload were consumed.
+// Return Value:
+// - S_OK or a suitable error; on failure, cbRead reports how far we got.
+[[nodiscard]] static HRESULT _WriteConsoleLineAtomic(_Inout_ CONSOLE_API_MSG* const m,
+                                                     SCREEN_INFORMATION& screenInfo,
+                                                     const void* const handleKey,
+                                                     const bool unicode,
+                                                     const bool requiresVtQuirk,
+                                                     size_t& cbRead)
+{
+    cbRead = 0;
+
+    PVOID pvBuffer;
+    ULONG cbBufferSize;
+    RETURN_IF_FAILED(m->GetInputBuffer(&pvBuffer, &cbBufferSize));
+
+    // A Unicode payload with an odd trailing byte drops it, exactly as the
+    // regular path's character division does.
+    if (unicode)
+    {
+        cbBufferSize &= ~1ul;
+    }
+
+    // A handle that alternates between the A and W calls can't extend its
+    // staged bytes; push the old flavor through first.
+    auto pTail = &screenInfo.GetStagedWriteTail(handleKey);
+    if (!pTail->bytes.empty() && pTail->unicode != unicode)
+    {
+        screenInfo.CommitStagedWrite(handleKey);
+        pTail = &screenInfo.GetStagedWriteTail(handleKey);
+    }
+    auto& tail = *pTail;
+    tail.unicode = unicode;
+    tail.requiresVtQuirk = requiresVtQuirk;
+
+    const size_t cbOldTail = tail.bytes.size();
+    tail.bytes.append(reinterpret_cast<const char*>(pvBuffer), cbBufferSize);
+
+    // Find the end of the last complete line.
+    size_t cbCommit = 0;
+    if (unicode)
+    {
+        const auto pwchData = reinterpret_cast<const wchar_t*>(tail.bytes.data());
+        for (size_t cch = tail.bytes.size() / sizeof(wchar_t); cch > 0; cch--)
+        {
+            if (pwchData[cch - 1] == L'\n')
+            {
+                cbCommit = cch * sizeof(wchar_t);
+                break;
+            }
+        }
+    }
+    else
+    {
+        const size_t pos = tail.bytes.find_last_of('\n');
+        if (pos != std::string::npos)
+        {
+            cbCommit = pos + 1;
+        }
+    }
+
+    // Without a newline the whole write stays staged - unless the stream has
+    // given up on line orientation entirely (cursor-addressed output); then
+    // force it through so it isn't held back indefinitely.
+    if (cbCommit == 0)
+    {
+        if (tail.bytes.size() <= cbStagedWriteTailCap)
+        {
+            cbRead = cbBufferSize;
+            return S_OK;
+        }
+        cbCommit = tail.bytes.size();
+    }
+
+    std::unique_ptr<IWaitRoutine> waiter;
+    size_t cchWritten = 0;
+    HRESULT hr;
+    if (unicode)
+    {
+        const std::wstring_view text{ reinterpret_cast<const wchar_t*>(tail.bytes.data()), cbCommit / sizeof(wchar_t) };
+        hr = m->_pApiRoutines->WriteConsoleWImpl(screenInfo, text, cchWritten, requiresVtQuirk, waiter);
+    }
+    else
+    {
+        const std::string_view text{ tail.bytes.data(), cbCommit };
+        hr = m->_pApiRoutines->WriteConsoleAImpl(screenInfo, text, cchWritten, requiresVtQuirk, waiter);
+    }
+
+    // The caller checked the wait-provoking console flags under the lock it
+    // still holds, so a wait here would lose the combined buffer. Never continue.
+    FAIL_FAST_IF(waiter != nullptr);
+
+    const size_t cbWritten = unicode ? cchWritten * sizeof(wchar_t) : cchWritten;
+    if (FAILED(hr) || cbWritten < cbCommit)
+    {
+        // Report how much of this payload went through; bytes staged by
+        // earlier calls were already reported to the client back then.
+        cbRead = cbWritten > cbOldTail ? cbWritten - cbOldTail : 0;
+        tail.bytes.clear();
+        return hr;
+    }
+
+    tail.bytes.erase(0, cbCommit);
+    cbRead = cbBufferSize;
+    return S_OK;
+}
+
 [[nodiscard]] HRESULT ApiDispatchers::ServerWriteConsole(_Inout_ CONSOLE_API_MSG* const m,
                                                          _Inout_ BOOL* const pbReplyPending)
 {
@@ -399,6 +653,56 @@
     SCREEN_INFORMATION* pScreenInfo;
     RETURN_IF_FAILED(HandleData->GetScreenBuffer(GENERIC_WRITE, &pScreenInfo));
 
+    // When line-atomic write arbitration is enabled, writes stage per handle
+    // and commit whole lines so concurrent clients can't tear each other's
+    // lines apart. The wait path needs the payload captured in the message,
+    // so this route only engages when no write wait can occur - decided and
+    // acted on under a single console lock acquisition.
+    if (ServiceLocator::LocateGlobals().getConsoleInformation().GetLineAtomicWrites())
+    {
+        LockConsole();
+        auto unlock = wil::scope_exit([&] { UnlockConsole(); });
+
+        const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+        if (WI_AreAllFlagsClear(gci.Flags, CONSOLE_SUSPENDED | CONSOLE_SELECTING | CONSOLE_SCROLLBAR_TRACKING))
+        {
+            const auto requiresVtQuirk{ m->GetProcessHandle()->GetShimPolicy().IsVtColorQuirkRequired() };
+
+            size_t cbAtomicRead;
+            const HRESULT hr = _WriteConsoleLineAtomic(m, *pScreenInfo, HandleData, a->Unicode != FALSE, requiresVtQuirk, cbAtomicRead);
+            LOG_IF_FAILED(SizeTToULong(cbAtomicRead, &a->NumBytes));
+            m->SetReplyInformation(a->NumBytes);
+            return hr;
+        }
+    }
+
+    // Large Unicode payloads stream out of the client's buffer chunk by chunk instead of
+    // being copied into server-side staging in their entirety before the first character
+    // is parsed. The wait path needs the whole payload captured, so only take this route
+    // when no write wait can engage - decided under the console lock and with the lock
+    // held across the whole write so the deciding flags cannot change mid-stream.
+    if (a->Unicode && m->State.ReadOffset <= m->Descriptor.InputSize)
+    {
+        const ULONG cbPayload = m->Descriptor.InputSize - m->State.ReadOffset;
+        if (cbPayload >= cbWriteConsoleChunkThreshold)
+        {
+            LockConsole();
+            auto unlock = wil::scope_exit([&] { UnlockConsole(); });
+
+            const CONSOLE_INFORMATION& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+            if (WI_AreAllFlagsClear(gci.Flags, CONSOLE_SUSPENDED | CONSOLE_SELECTING | CONSOLE_SCROLLBAR_TRACKING))
+            {
+                const auto requiresVtQuirk{ m->GetProcessHandle()->GetShimPolicy().IsVtColorQuirkRequired() };
+
+                size_t cbChunkedRead;
+                const HRESULT hr = _WriteConsoleWChunked(m, *pScreenInfo, cbPayload, requiresVtQuirk, cbChunkedRead);
+                LOG_IF_FAILED(SizeTToULong(cbChunkedRead, &a->NumBytes));
+                m->SetReplyInformation(a->NumBytes);
+                return hr;
+            }
+        }
+    }
+
     // Get input parameter buffer
     PVOID pvBuffer;
     ULONG cbBufferSize;
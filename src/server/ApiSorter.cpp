@@ -34,13 +34,7 @@ typedef struct _CONSOLE_API_DESCRIPTOR
     PCSTR TraceName;
 } CONSOLE_API_DESCRIPTOR, *PCONSOLE_API_DESCRIPTOR;
 
-typedef struct _CONSOLE_API_LAYER_DESCRIPTOR
-{
-    const CONSOLE_API_DESCRIPTOR* Descriptor;
-    ULONG Count;
-} CONSOLE_API_LAYER_DESCRIPTOR, *PCONSOLE_API_LAYER_DESCRIPTOR;
-
-const CONSOLE_API_DESCRIPTOR ConsoleApiLayer1[] = {
+constexpr CONSOLE_API_DESCRIPTOR ConsoleApiLayer1[] = {
     CONSOLE_API_STRUCT(ApiDispatchers::ServerGetConsoleCP, CONSOLE_GETCP_MSG, "GetConsoleCP"),
     CONSOLE_API_STRUCT(ApiDispatchers::ServerGetConsoleMode, CONSOLE_MODE_MSG, "GetConsoleMode"),
     CONSOLE_API_STRUCT(ApiDispatchers::ServerSetConsoleMode, CONSOLE_MODE_MSG, "SetConsoleMode"),
@@ -53,7 +47,7 @@ const CONSOLE_API_DESCRIPTOR ConsoleApiLayer1[] = {
     CONSOLE_API_DEPRECATED(CONSOLE_MAPBITMAP_MSG),
 };
 
-const CONSOLE_API_DESCRIPTOR ConsoleApiLayer2[] = {
+constexpr CONSOLE_API_DESCRIPTOR ConsoleApiLayer2[] = {
     CONSOLE_API_STRUCT(ApiDispatchers::ServerFillConsoleOutput, CONSOLE_FILLCONSOLEOUTPUT_MSG, "FillConsoleOutput"),
     CONSOLE_API_STRUCT(ApiDispatchers::ServerGenerateConsoleCtrlEvent, CONSOLE_CTRLEVENT_MSG, "GenerateConsoleCtrlEvent"),
     CONSOLE_API_NO_PARAMETER(ApiDispatchers::ServerSetConsoleActiveScreenBuffer, "SetConsoleActiveScreenBuffer"),
@@ -78,7 +72,7 @@ const CONSOLE_API_DESCRIPTOR ConsoleApiLayer2[] = {
     CONSOLE_API_STRUCT(ApiDispatchers::ServerSetConsoleTitle, CONSOLE_SETTITLE_MSG, "SetConsoleTitle"),
 };
 
-const CONSOLE_API_DESCRIPTOR ConsoleApiLayer3[] = {
+constexpr CONSOLE_API_DESCRIPTOR ConsoleApiLayer3[] = {
     CONSOLE_API_DEPRECATED(CONSOLE_GETNUMBEROFFONTS_MSG),
     CONSOLE_API_STRUCT(ApiDispatchers::ServerGetConsoleMouseInfo, CONSOLE_GETMOUSEINFO_MSG, "GetNumberOfConsoleMouseButtons"),
     CONSOLE_API_DEPRECATED(CONSOLE_GETFONTINFO_MSG),
@@ -126,12 +120,43 @@ const CONSOLE_API_DESCRIPTOR ConsoleApiLayer3[] = {
     CONSOLE_API_STRUCT(ApiDispatchers::ServerSetConsoleCurrentFont, CONSOLE_CURRENTFONT_MSG, "SetConsoleCurrentFont")
 };
 
-const CONSOLE_API_LAYER_DESCRIPTOR ConsoleApiLayerTable[] = {
-    { ConsoleApiLayer1, RTL_NUMBER_OF(ConsoleApiLayer1) },
-    { ConsoleApiLayer2, RTL_NUMBER_OF(ConsoleApiLayer2) },
-    { ConsoleApiLayer3, RTL_NUMBER_OF(ConsoleApiLayer3) },
+// The layer tables above are kept separate so that the initializers line up with the
+// 1-based layer / 0-based call ID encoding in ApiNumber, but at runtime every dispatch
+// reads from a single flat, contiguous table built from them at compile time. This
+// avoids chasing a layer descriptor pointer to a second cache line on every message.
+constexpr ULONG ConsoleApiLayerCounts[] = {
+    RTL_NUMBER_OF(ConsoleApiLayer1),
+    RTL_NUMBER_OF(ConsoleApiLayer2),
+    RTL_NUMBER_OF(ConsoleApiLayer3),
+};
+
+constexpr ULONG ConsoleApiLayerOffsets[] = {
+    0,
+    ConsoleApiLayerCounts[0],
+    ConsoleApiLayerCounts[0] + ConsoleApiLayerCounts[1],
 };
 
+constexpr auto _BuildConsoleApiTable()
+{
+    std::array<CONSOLE_API_DESCRIPTOR, ConsoleApiLayerCounts[0] + ConsoleApiLayerCounts[1] + ConsoleApiLayerCounts[2]> table{};
+    size_t i = 0;
+    for (const auto& descriptor : ConsoleApiLayer1)
+    {
+        table[i++] = descriptor;
+    }
+    for (const auto& descriptor : ConsoleApiLayer2)
+    {
+        table[i++] = descriptor;
+    }
+    for (const auto& descriptor : ConsoleApiLayer3)
+    {
+        table[i++] = descriptor;
+    }
+    return table;
+}
+
+constexpr auto ConsoleApiTable = _BuildConsoleApiTable();
+
 // Routine Description:
 // - This routine validates a user IO and dispatches it to the appropriate worker routine.
 // Arguments:
@@ -144,13 +169,13 @@ PCONSOLE_API_MSG ApiSorter::ConsoleDispatchRequest(_Inout_ PCONSOLE_API_MSG Mess
     ULONG const LayerNumber = (Message->msgHeader.ApiNumber >> 24) - 1;
     ULONG const ApiNumber = Message->msgHeader.ApiNumber & 0xffffff;
 
-    if ((LayerNumber >= std::size(ConsoleApiLayerTable)) || (ApiNumber >= ConsoleApiLayerTable[LayerNumber].Count))
+    if ((LayerNumber >= std::size(ConsoleApiLayerCounts)) || (ApiNumber >= ConsoleApiLayerCounts[LayerNumber]))
     {
         Message->SetReplyStatus(STATUS_ILLEGAL_FUNCTION);
         return Message;
     }
 
-    CONSOLE_API_DESCRIPTOR const* Descriptor = &ConsoleApiLayerTable[LayerNumber].Descriptor[ApiNumber];
+    CONSOLE_API_DESCRIPTOR const* Descriptor = &ConsoleApiTable[ConsoleApiLayerOffsets[LayerNumber] + ApiNumber];
 
     // Validate the argument size and call the API.
     if ((Message->Descriptor.InputSize < sizeof(CONSOLE_MSG_HEADER)) ||
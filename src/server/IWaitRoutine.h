@@ -41,6 +41,17 @@ public:
 
     virtual void MigrateUserBuffersOnTransitionToBackgroundWait(const void* oldBuffer, void* newBuffer) = 0;
 
+    // Routine Description:
+    // - A cheap filter consulted before Notify when the queue is woken without a
+    //   termination reason. Returning false promises that the wait's condition
+    //   cannot currently be met, so the queue leaves the block queued instead of
+    //   replaying the full API routine just to watch it wait again.
+    // - Termination requests bypass this filter; they must always dispatch.
+    virtual bool CanNotify() const noexcept
+    {
+        return true;
+    }
+
     virtual bool Notify(const WaitTerminationReason TerminationReason,
                         const bool fIsUnicode,
                         _Out_ NTSTATUS* const pReplyStatus,
@@ -0,0 +1,134 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+
+#include "IoReadQueue.h"
+
+#include "DeviceComm.h"
+
+// Routine Description:
+// - Creates the queue and starts the reader thread. The reader immediately puts a
+//   read in flight with the driver, so the next client request is being captured
+//   while the service thread is still busy with the previous one.
+// Arguments:
+// - pComm - The device communication channel to read messages from.
+IoReadQueue::IoReadQueue(_In_ IDeviceComm* const pComm) :
+    _pComm(pComm),
+    _shuttingDown(false)
+{
+    for (auto& buffer : _buffers)
+    {
+        _free.push_back(&buffer);
+    }
+
+    _thread.reset(CreateThread(nullptr, 0, s_ReadThread, this, 0, nullptr));
+    THROW_LAST_ERROR_IF_NULL(_thread.get());
+}
+
+IoReadQueue::~IoReadQueue()
+{
+    // The queue lives for the lifetime of the IO thread, which never returns
+    // (the process is torn down by RundownAndExit). If we do get here, tell the
+    // reader to stop touching our members and let the handle close.
+    {
+        std::lock_guard<std::mutex> lock{ _lock };
+        _shuttingDown = true;
+    }
+    _bufferAvailable.notify_all();
+}
+
+// Routine Description:
+// - Retrieves the next message read from the driver, blocking until one arrives.
+// Arguments:
+// - ppMessage - Receives the message buffer on success. The caller must hand it
+//               back via Recycle once it is done servicing (and completing) it.
+// Return Value:
+// - The result of the driver read. On failure, no buffer is returned and the
+//   failure is the caller's to act on (notably ERROR_PIPE_NOT_CONNECTED).
+[[nodiscard]] HRESULT IoReadQueue::Dequeue(_Outptr_ CONSOLE_API_MSG** const ppMessage)
+{
+    *ppMessage = nullptr;
+
+    std::unique_lock<std::mutex> lock{ _lock };
+    _messageReady.wait(lock, [this] { return !_ready.empty(); });
+
+    const auto result = _ready.front();
+    _ready.pop_front();
+
+    if (FAILED(result.hr))
+    {
+        return result.hr;
+    }
+
+    *ppMessage = result.pMessage;
+    return S_OK;
+}
+
+// Routine Description:
+// - Returns a serviced message buffer to the pool so the reader can fill it with
+//   another request. Call only after the message's buffers have been released and
+//   its completion (if any) has been sent; pended messages are copied by their
+//   wait block and may be recycled immediately.
+void IoReadQueue::Recycle(_In_ CONSOLE_API_MSG* const pMessage)
+{
+    {
+        std::lock_guard<std::mutex> lock{ _lock };
+        _free.push_back(pMessage);
+    }
+    _bufferAvailable.notify_one();
+}
+
+DWORD WINAPI IoReadQueue::s_ReadThread(_In_ LPVOID lpParameter)
+{
+    return static_cast<IoReadQueue*>(lpParameter)->_ReadLoop();
+}
+
+// Routine Description:
+// - The reader thread's main loop. Keeps one read outstanding with the driver at
+//   all times (buffer pool permitting) and hands completed reads to the service
+//   thread. Completions are sent separately via CompleteIo by the service loop,
+//   so the read here never piggybacks a reply the way the old synchronous loop
+//   did - that is the cost of having the read overlap with servicing.
+DWORD IoReadQueue::_ReadLoop()
+{
+    for (;;)
+    {
+        CONSOLE_API_MSG* pMessage;
+        {
+            std::unique_lock<std::mutex> lock{ _lock };
+            _bufferAvailable.wait(lock, [this] { return _shuttingDown || !_free.empty(); });
+            if (_shuttingDown)
+            {
+                return 0;
+            }
+
+            pMessage = _free.front();
+            _free.pop_front();
+        }
+
+        const HRESULT hr = _pComm->ReadIo(nullptr, pMessage);
+
+        {
+            std::lock_guard<std::mutex> lock{ _lock };
+            if (FAILED(hr))
+            {
+                // The buffer was never filled; put it straight back.
+                _free.push_back(pMessage);
+                _ready.push_back({ hr, nullptr });
+            }
+            else
+            {
+                _ready.push_back({ hr, pMessage });
+            }
+        }
+        _messageReady.notify_one();
+
+        if (hr == HRESULT_FROM_WIN32(ERROR_PIPE_NOT_CONNECTED))
+        {
+            // The driver connection is gone; the service thread will run the
+            // process down when it sees this result. Stop reading.
+            return 0;
+        }
+    }
+}
@@ -0,0 +1,66 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- IoReadQueue.h
+
+Abstract:
+- This module keeps a console driver read request in flight ahead of the servicing
+  loop. A dedicated reader thread pulls messages from the driver into a small pool
+  of buffers so that the driver can capture the next client's request while the
+  service thread is still working on the current one, instead of every client
+  queueing behind a strictly serial read/service/reply cycle.
+--*/
+
+#pragma once
+
+#include <array>
+#include <condition_variable>
+
+#include "ApiMessage.h"
+
+class IDeviceComm;
+
+class IoReadQueue
+{
+public:
+    IoReadQueue(_In_ IDeviceComm* const pComm);
+    ~IoReadQueue();
+
+    IoReadQueue(const IoReadQueue&) = delete;
+    IoReadQueue& operator=(const IoReadQueue&) = delete;
+
+    [[nodiscard]] HRESULT Dequeue(_Outptr_ CONSOLE_API_MSG** const ppMessage);
+    void Recycle(_In_ CONSOLE_API_MSG* const pMessage);
+
+private:
+    static DWORD WINAPI s_ReadThread(_In_ LPVOID lpParameter);
+    DWORD _ReadLoop();
+
+    // How many message buffers circulate between the reader and the service
+    // thread. One is being filled by the driver, one is being serviced, and the
+    // rest absorb bursts from independent clients. CONSOLE_API_MSG is a few
+    // hundred bytes, so a small pool is cheap.
+    static constexpr size_t BufferCount = 4;
+
+    IDeviceComm* const _pComm;
+
+    std::array<CONSOLE_API_MSG, BufferCount> _buffers;
+
+    std::mutex _lock;
+    std::condition_variable _bufferAvailable; // wakes the reader when a buffer is recycled
+    std::condition_variable _messageReady; // wakes the service thread when a read completes
+
+    std::deque<CONSOLE_API_MSG*> _free;
+
+    struct ReadResult
+    {
+        HRESULT hr;
+        CONSOLE_API_MSG* pMessage;
+    };
+    std::deque<ReadResult> _ready;
+
+    bool _shuttingDown;
+    wil::unique_handle _thread;
+};
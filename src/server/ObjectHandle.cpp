@@ -18,6 +18,7 @@ ConsoleHandleData::ConsoleHandleData(const ACCESS_MASK amAccess,
     _amAccess(amAccess),
     _ulShareAccess(ulShareAccess),
     _pvClientPointer(nullptr),
+    _pWaitQueue(nullptr),
     _pClientInput(nullptr)
 {
 }
@@ -62,9 +63,19 @@ void ConsoleHandleData::Initialize(const ULONG ulHandleType,
     _ulHandleType = ulHandleType;
     _pvClientPointer = pvClientPointer;
 
+    // Resolve the wait queue for this binding up front. The binding never
+    // changes for the life of the handle, so every later GetWaitQueue call
+    // can be a plain load instead of a type check and a global lookup.
     if (_IsInput())
     {
         _pClientInput = std::make_unique<INPUT_READ_HANDLE_DATA>();
+        _pWaitQueue = &static_cast<InputBuffer*>(_pvClientPointer)->WaitQueue;
+    }
+    else if (_IsOutput())
+    {
+        // TODO MSFT 9405322: shouldn't the output queue be per output object target, not global? https://osgvsowi/9405322
+        CONSOLE_INFORMATION& gci = Microsoft::Console::Interactivity::ServiceLocator::LocateGlobals().getConsoleInformation();
+        _pWaitQueue = &gci.OutputQueue;
     }
 }
 
@@ -182,23 +193,12 @@ bool ConsoleHandleData::IsWriteShared() const
 // - HRESULT S_OK or E_UNEXPECTED if the handle data structure is in an invalid state.
 [[nodiscard]] HRESULT ConsoleHandleData::GetWaitQueue(_Outptr_ ConsoleWaitQueue** const ppWaitQueue) const
 {
-    CONSOLE_INFORMATION& gci = Microsoft::Console::Interactivity::ServiceLocator::LocateGlobals().getConsoleInformation();
-    if (_IsInput())
-    {
-        InputBuffer* const pObj = static_cast<InputBuffer*>(_pvClientPointer);
-        *ppWaitQueue = &pObj->WaitQueue;
-        return S_OK;
-    }
-    else if (_IsOutput())
-    {
-        // TODO MSFT 9405322: shouldn't the output queue be per output object target, not global? https://osgvsowi/9405322
-        *ppWaitQueue = &gci.OutputQueue;
-        return S_OK;
-    }
-    else
-    {
-        return E_UNEXPECTED;
-    }
+    // The queue was resolved when the binding was established in Initialize;
+    // it's only missing if the handle was never made ready.
+    RETURN_HR_IF_NULL(E_UNEXPECTED, _pWaitQueue);
+
+    *ppWaitQueue = _pWaitQueue;
+    return S_OK;
 }
 
 // Routine Description:
@@ -267,6 +267,10 @@ INPUT_READ_HANDLE_DATA* ConsoleHandleData::GetClientInput() const
     FAIL_FAST_IF(!(_IsOutput()));
     SCREEN_INFORMATION* pScreenInfo = static_cast<SCREEN_INFORMATION*>(_pvClientPointer);
 
+    // If this handle still has a staged partial write, let it out before the
+    // handle identity disappears.
+    pScreenInfo->CommitStagedWrite(this);
+
     pScreenInfo = &pScreenInfo->GetMainBuffer();
 
     // TODO: MSFT: 9115192 - THIS IS BAD. It should use a destructor.
@@ -75,10 +75,14 @@ private:
     [[nodiscard]] HRESULT _CloseInputHandle();
     [[nodiscard]] HRESULT _CloseOutputHandle();
 
+    // The handle->object binding is established exactly once in Initialize and
+    // never changes afterward, so these can be consulted on every API call
+    // without any revalidation.
     ACCESS_MASK const _amAccess;
     ULONG const _ulShareAccess;
     ULONG _ulHandleType;
     PVOID _pvClientPointer; // This will be a pointer to a SCREEN_INFORMATION or INPUT_INFORMATION object.
+    ConsoleWaitQueue* _pWaitQueue; // Resolved once in Initialize so the wait path doesn't have to.
     std::unique_ptr<INPUT_READ_HANDLE_DATA> _pClientInput;
 };
 
@@ -67,6 +67,20 @@ using namespace Microsoft::Console::Interactivity;
         // As such, we have to put the newest process into the head of the list.
         _processes.push_front(pProcessData);
 
+        try
+        {
+            _processesById.emplace(dwProcessId, pProcessData);
+            _processesByGroupId.emplace(ulProcessGroupId, pProcessData);
+        }
+        catch (...)
+        {
+            // Keep the list and its indexes consistent if either insertion failed.
+            _processesById.erase(dwProcessId);
+            _processes.pop_front();
+            delete pProcessData;
+            throw;
+        }
+
         if (nullptr != ppProcessData)
         {
             *ppProcessData = pProcessData;
@@ -87,8 +101,20 @@ void ConsoleProcessList::FreeProcessData(_In_ ConsoleProcessHandle* const pProce
 {
     FAIL_FAST_IF(!(ServiceLocator::LocateGlobals().getConsoleInformation().IsConsoleLocked()));
 
-    // Assert that the item exists in the list. If it doesn't exist, the end/last will be returned.
-    FAIL_FAST_IF(!(_processes.cend() != std::find(_processes.cbegin(), _processes.cend(), pProcessData)));
+    // Assert that the item exists in the index. If it doesn't, the lookup comes back empty.
+    const auto itById = _processesById.find(pProcessData->dwProcessId);
+    FAIL_FAST_IF(!(itById != _processesById.end() && itById->second == pProcessData));
+    _processesById.erase(itById);
+
+    const auto groupRange = _processesByGroupId.equal_range(pProcessData->_ulProcessGroupId);
+    for (auto it = groupRange.first; it != groupRange.second; ++it)
+    {
+        if (it->second == pProcessData)
+        {
+            _processesByGroupId.erase(it);
+            break;
+        }
+    }
 
     _processes.remove(pProcessData);
 
@@ -104,28 +130,21 @@ void ConsoleProcessList::FreeProcessData(_In_ ConsoleProcessHandle* const pProce
 // - Pointer to the process handle information or nullptr if no match was found.
 ConsoleProcessHandle* ConsoleProcessList::FindProcessInList(const DWORD dwProcessId) const
 {
-    auto it = _processes.cbegin();
-
-    while (it != _processes.cend())
+    if (ROOT_PROCESS_ID != dwProcessId)
     {
-        ConsoleProcessHandle* const pProcessHandleRecord = *it;
+        const auto it = _processesById.find(dwProcessId);
+        return it != _processesById.end() ? it->second : nullptr;
+    }
 
-        if (ROOT_PROCESS_ID != dwProcessId)
-        {
-            if (pProcessHandleRecord->dwProcessId == dwProcessId)
-            {
-                return pProcessHandleRecord;
-            }
-        }
-        else
+    // The root flag moves between processes after insertion (reassignment on the old
+    // root's exit), so it can't be indexed up front. Root lookups are rare enough
+    // (window close, handoff) that walking the list for them is fine.
+    for (ConsoleProcessHandle* const pProcessHandleRecord : _processes)
+    {
+        if (pProcessHandleRecord->fRootProcess)
         {
-            if (pProcessHandleRecord->fRootProcess)
-            {
-                return pProcessHandleRecord;
-            }
+            return pProcessHandleRecord;
         }
-
-        it = std::next(it);
     }
 
     return nullptr;
@@ -139,20 +158,8 @@ ConsoleProcessHandle* ConsoleProcessList::FindProcessInList(const DWORD dwProces
 // - Pointer to first matching process handle with given group ID. nullptr if no match was found.
 ConsoleProcessHandle* ConsoleProcessList::FindProcessByGroupId(_In_ ULONG ulProcessGroupId) const
 {
-    auto it = _processes.cbegin();
-
-    while (it != _processes.cend())
-    {
-        ConsoleProcessHandle* const pProcessHandleRecord = *it;
-        if (pProcessHandleRecord->_ulProcessGroupId == ulProcessGroupId)
-        {
-            return pProcessHandleRecord;
-        }
-
-        it = std::next(it);
-    }
-
-    return nullptr;
+    const auto it = _processesByGroupId.find(ulProcessGroupId);
+    return it != _processesByGroupId.end() ? it->second : nullptr;
 }
 
 // Routine Description:
@@ -219,41 +226,48 @@ ConsoleProcessHandle* ConsoleProcessList::FindProcessByGroupId(_In_ ULONG ulProc
     {
         std::deque<std::unique_ptr<ConsoleProcessTerminationRecord>> TermRecords;
 
-        // Dig through known processes looking for a match
-        auto it = _processes.cbegin();
-        while (it != _processes.cend())
-        {
-            ConsoleProcessHandle* const pProcessHandleRecord = *it;
+        const auto addRecord = [&](ConsoleProcessHandle* const pProcessHandleRecord) {
+            std::unique_ptr<ConsoleProcessTerminationRecord> pNewRecord = std::make_unique<ConsoleProcessTerminationRecord>();
 
-            // If no limit was specified OR if we have a match, generate a new termination record.
-            if (0 == dwLimitingProcessId ||
-                pProcessHandleRecord->_ulProcessGroupId == dwLimitingProcessId)
-            {
-                std::unique_ptr<ConsoleProcessTerminationRecord> pNewRecord = std::make_unique<ConsoleProcessTerminationRecord>();
+            // If the duplicate failed, the best we can do is to skip including the process in the list and hope it goes away.
+            LOG_IF_WIN32_BOOL_FALSE(DuplicateHandle(GetCurrentProcess(),
+                                                    pProcessHandleRecord->_hProcess.get(),
+                                                    GetCurrentProcess(),
+                                                    &pNewRecord->hProcess,
+                                                    0,
+                                                    0,
+                                                    DUPLICATE_SAME_ACCESS));
 
-                // If the duplicate failed, the best we can do is to skip including the process in the list and hope it goes away.
-                LOG_IF_WIN32_BOOL_FALSE(DuplicateHandle(GetCurrentProcess(),
-                                                        pProcessHandleRecord->_hProcess.get(),
-                                                        GetCurrentProcess(),
-                                                        &pNewRecord->hProcess,
-                                                        0,
-                                                        0,
-                                                        DUPLICATE_SAME_ACCESS));
+            pNewRecord->dwProcessID = pProcessHandleRecord->dwProcessId;
 
-                pNewRecord->dwProcessID = pProcessHandleRecord->dwProcessId;
+            // If we're hard closing the window, increment the counter.
+            if (fCtrlClose)
+            {
+                pProcessHandleRecord->_ulTerminateCount++;
+            }
 
-                // If we're hard closing the window, increment the counter.
-                if (fCtrlClose)
-                {
-                    pProcessHandleRecord->_ulTerminateCount++;
-                }
+            pNewRecord->ulTerminateCount = pProcessHandleRecord->_ulTerminateCount;
 
-                pNewRecord->ulTerminateCount = pProcessHandleRecord->_ulTerminateCount;
+            TermRecords.push_back(std::move(pNewRecord));
+        };
 
-                TermRecords.push_back(std::move(pNewRecord));
+        if (0 == dwLimitingProcessId)
+        {
+            // No limit: every attached process gets a record.
+            for (ConsoleProcessHandle* const pProcessHandleRecord : _processes)
+            {
+                addRecord(pProcessHandleRecord);
+            }
+        }
+        else
+        {
+            // Signaling a group only touches that group's members rather than
+            // filtering them out of the full session.
+            const auto range = _processesByGroupId.equal_range(dwLimitingProcessId);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                addRecord(it->second);
             }
-
-            it = std::next(it);
         }
 
         // From all found matches, convert to C-style array to return
@@ -59,7 +59,12 @@ public:
     bool IsEmpty() const;
 
 private:
+    // The list preserves attachment order (newest first) for GetConsoleProcessList;
+    // the maps index it so that per-PID and per-group lookups on every attach,
+    // detach and CTRL event don't walk the whole session.
     std::list<ConsoleProcessHandle*> _processes;
+    std::unordered_map<DWORD, ConsoleProcessHandle*> _processesById;
+    std::unordered_multimap<ULONG, ConsoleProcessHandle*> _processesByGroupId;
 
     void _ModifyProcessForegroundRights(const HANDLE hProcess, const bool fForeground) const;
 };
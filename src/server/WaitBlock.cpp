@@ -13,6 +13,56 @@
 
 #include "../interactivity/inc/ServiceLocator.hpp"
 
+namespace
+{
+    // Sessions with many clients parked in blocked reads keep roughly one wait block
+    // alive per waiting process, and those blocks are freed and reallocated every time
+    // a wait is satisfied and re-queued. Spent blocks are kept on this free list so the
+    // next wait reuses them instead of hitting the heap. The cap covers a few hundred
+    // simultaneously blocked processes; anything beyond that goes back to the heap.
+    constexpr size_t WaitBlockPoolCap = 512;
+
+    std::mutex s_waitBlockPoolLock;
+    std::vector<void*> s_waitBlockPool;
+}
+
+// Routine Description:
+// - Allocates a wait block, preferring a recycled allocation from the free list.
+// - The size check guards against a derived type ever sneaking in; anything that
+//   isn't exactly a ConsoleWaitBlock goes straight to the heap.
+void* ConsoleWaitBlock::operator new(const size_t size)
+{
+    if (size == sizeof(ConsoleWaitBlock))
+    {
+        std::lock_guard<std::mutex> lock{ s_waitBlockPoolLock };
+        if (!s_waitBlockPool.empty())
+        {
+            void* const ptr = s_waitBlockPool.back();
+            s_waitBlockPool.pop_back();
+            return ptr;
+        }
+    }
+
+    return ::operator new(size);
+}
+
+// Routine Description:
+// - Returns a wait block's memory to the free list for the next wait, or to the
+//   heap once the list is full.
+void ConsoleWaitBlock::operator delete(void* const ptr) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock{ s_waitBlockPoolLock };
+        if (s_waitBlockPool.size() < WaitBlockPoolCap)
+        {
+            s_waitBlockPool.push_back(ptr);
+            return;
+        }
+    }
+
+    ::operator delete(ptr);
+}
+
 // Routine Description:
 // - Initializes a ConsoleWaitBlock
 // - ConsoleWaitBlocks will mostly self-manage their position in their two queues.
@@ -135,7 +185,7 @@ bool ConsoleWaitBlock::Notify(const WaitTerminationReason TerminationReason)
     DWORD dwControlKeyState;
     bool fIsUnicode = true;
 
-    std::deque<std::unique_ptr<IInputEvent>> outEvents;
+    std::deque<INPUT_RECORD> outRecords;
     // TODO: MSFT 14104228 - get rid of this void* and get the data
     // out of the read wait object properly.
     void* pOutputData = nullptr;
@@ -148,7 +198,7 @@ bool ConsoleWaitBlock::Notify(const WaitTerminationReason TerminationReason)
     {
         CONSOLE_GETCONSOLEINPUT_MSG* a = &(_WaitReplyMessage.u.consoleMsgL1.GetConsoleInput);
         fIsUnicode = !!a->Unicode;
-        pOutputData = &outEvents;
+        pOutputData = &outRecords;
         break;
     }
     case API_NUMBER_READCONSOLE:
@@ -192,15 +242,15 @@ bool ConsoleWaitBlock::Notify(const WaitTerminationReason TerminationReason)
             }
 
             INPUT_RECORD* const pRecordBuffer = static_cast<INPUT_RECORD* const>(buffer);
-            a->NumRecords = static_cast<ULONG>(outEvents.size());
+            a->NumRecords = static_cast<ULONG>(outRecords.size());
             for (size_t i = 0; i < a->NumRecords; ++i)
             {
-                if (outEvents.empty())
+                if (outRecords.empty())
                 {
                     break;
                 }
-                pRecordBuffer[i] = outEvents.front()->ToInputRecord();
-                outEvents.pop_front();
+                pRecordBuffer[i] = outRecords.front();
+                outRecords.pop_front();
             }
         }
         else if (API_NUMBER_READCONSOLE == _WaitReplyMessage.msgHeader.ApiNumber)
@@ -32,9 +32,20 @@ public:
 
     bool Notify(const WaitTerminationReason TerminationReason);
 
+    // Forwards the waiter's cheap satisfiability filter; see IWaitRoutine::CanNotify.
+    bool CanNotify() const noexcept
+    {
+        return _pWaiter->CanNotify();
+    }
+
     [[nodiscard]] static HRESULT s_CreateWait(_Inout_ CONSOLE_API_MSG* const pWaitReplymessage,
                                               _In_ IWaitRoutine* const pWaiter);
 
+    // Wait blocks churn quickly when many clients sit in blocked reads, so spent
+    // allocations are recycled through a free list instead of going back to the heap.
+    static void* operator new(const size_t size);
+    static void operator delete(void* const ptr) noexcept;
+
 private:
     ConsoleWaitBlock(_In_ ConsoleWaitQueue* const pProcessQueue,
                      _In_ ConsoleWaitQueue* const pObjectQueue,
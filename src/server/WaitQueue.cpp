@@ -87,6 +87,21 @@ bool ConsoleWaitQueue::NotifyWaiters(const bool fNotifyAll,
 
         auto const nextIt = std::next(it); // we have to capture next before it is potentially erased
 
+        // When nobody is being terminated, ask the waiter's cheap filter whether its
+        // condition could even be met before replaying the whole API routine. A single
+        // keystroke with many parked readers would otherwise re-run every one of them
+        // under the console lock just to watch them all queue right back up.
+        if (WaitTerminationReason::NoReason == TerminationReason && !WaitBlock->CanNotify())
+        {
+            if (!fNotifyAll)
+            {
+                break;
+            }
+
+            it = nextIt;
+            continue;
+        }
+
         if (_NotifyBlock(WaitBlock, TerminationReason))
         {
             fResult = true;
@@ -133,6 +133,8 @@ public:
 
     virtual bool DoConEmuAction(const std::wstring_view string) = 0;
 
+    virtual bool GlyphWidthHint(const size_t count, const size_t width) = 0; // conpty glyph width hint
+
     virtual StringHandler DownloadDRCS(const size_t fontNumber,
                                        const VTParameter startChar,
                                        const DispatchTypes::DrcsEraseControl eraseControl,
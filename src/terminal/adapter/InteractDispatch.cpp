@@ -36,6 +36,21 @@ bool InteractDispatch::WriteInput(std::deque<std::unique_ptr<IInputEvent>>& inpu
     return true;
 }
 
+// Method Description:
+// - Writes a span of flat input records to the host. This is the allocation-free
+//   variant used by the input state machine, whose records are already built
+//   as plain INPUT_RECORDs.
+// Arguments:
+// - records: the records to send to the host.
+// Return Value:
+// - True.
+bool InteractDispatch::WriteInput(const gsl::span<const INPUT_RECORD> records)
+{
+    size_t written = 0;
+    _pConApi->WriteInput(records, written);
+    return true;
+}
+
 // Method Description:
 // - Writes a key event to the host in a fashion that will enable the host to
 //   process special keys such as Ctrl-C or Ctrl+Break. The host will then
@@ -67,13 +82,11 @@ bool InteractDispatch::WriteString(const std::wstring_view string)
 
         for (const auto& wch : string)
         {
-            std::deque<std::unique_ptr<KeyEvent>> convertedEvents = Microsoft::Console::Interactivity::CharToKeyEvents(wch, codepage);
-
-            std::move(convertedEvents.begin(),
-                      convertedEvents.end(),
-                      std::back_inserter(keyEvents));
+            Microsoft::Console::Interactivity::CharToKeyEvents(wch, codepage, keyEvents);
         }
 
+        // The entire string is written as one batch, so a large paste only
+        // costs us a single round trip through the input buffer.
         WriteInput(keyEvents);
     }
     return true;
@@ -67,7 +67,8 @@ void AdaptDispatch::PrintString(const std::wstring_view string)
 {
     if (_termOutput.NeedToTranslate())
     {
-        std::wstring buffer;
+        auto& buffer = _translationBuffer;
+        buffer.clear();
         buffer.reserve(string.size());
         for (auto& wch : string)
         {
@@ -2222,6 +2223,19 @@ bool AdaptDispatch::DoConEmuAction(const std::wstring_view /*string*/) noexcept
     return false;
 }
 
+// Method Description:
+// - Conpty glyph width hint. Only our own VT renderer produces these, for a
+//   terminal that asked for them at creation time; a client application that
+//   emits one at conhost is talking to the wrong end of the pipe. Swallow it
+//   rather than letting it flush through to the connected terminal, where its
+//   count wouldn't line up with the re-rendered output.
+// Return Value:
+// - True. (Handled by discarding.)
+bool AdaptDispatch::GlyphWidthHint(const size_t /*count*/, const size_t /*width*/) noexcept
+{
+    return true;
+}
+
 // Method Description:
 // - DECDLD - Downloads one or more characters of a dynamically redefinable
 //   character set (DRCS) with a specified pixel pattern. The pixel array is
@@ -124,6 +124,8 @@ namespace Microsoft::Console::VirtualTerminal
 
         bool DoConEmuAction(const std::wstring_view string) noexcept override;
 
+        bool GlyphWidthHint(const size_t count, const size_t width) noexcept override; // conpty glyph width hint
+
         StringHandler DownloadDRCS(const size_t fontNumber,
                                    const VTParameter startChar,
                                    const DispatchTypes::DrcsEraseControl eraseControl,
@@ -196,6 +198,10 @@ namespace Microsoft::Console::VirtualTerminal
         std::unique_ptr<FontBuffer> _fontBuffer;
         std::optional<unsigned int> _initialCodePage;
 
+        // scratch buffer for PrintString's character set translation, reused
+        // across calls so back-to-back print runs don't allocate.
+        std::wstring _translationBuffer;
+
         // We have two instances of the saved cursor state, because we need
         // one for the main buffer (at index 0), and another for the alt buffer
         // (at index 1). The _usingAltBuffer property keeps tracks of which
@@ -63,6 +63,23 @@ size_t AdaptDispatch::_SetRgbColorsHelper(const VTParameters options,
     return optionsConsumed;
 }
 
+// Compile-time mapping of the basic SGR color codes to the TextColor table
+// indices. The codes 30-37/40-47 (and their bright variants 90-97/100-107)
+// designate the colors in the order black, red, green, yellow, blue, magenta,
+// cyan, white.
+static constexpr std::array<BYTE, 8> s_basicSgrColors{
+    TextColor::DARK_BLACK,
+    TextColor::DARK_RED,
+    TextColor::DARK_GREEN,
+    TextColor::DARK_YELLOW,
+    TextColor::DARK_BLUE,
+    TextColor::DARK_MAGENTA,
+    TextColor::DARK_CYAN,
+    TextColor::DARK_WHITE
+};
+// The bright color indices directly follow the dark ones in the color table.
+static_assert(TextColor::BRIGHT_BLACK == TextColor::DARK_BLACK + 8);
+
 // Routine Description:
 // - SGR - Modifies the graphical rendering options applied to the next
 //   characters written into the buffer.
@@ -81,6 +98,31 @@ bool AdaptDispatch::SetGraphicsRendition(const VTParameters options)
     for (size_t i = 0; i < options.size(); i++)
     {
         const GraphicsOptions opt = options.at(i);
+
+        // The basic color options vastly outnumber everything else in
+        // colorized output, so resolve them with a table lookup up front
+        // instead of enumerating all 32 of them in the switch below.
+        if (opt >= ForegroundBlack && opt <= ForegroundWhite)
+        {
+            attr.SetIndexedForeground(til::at(s_basicSgrColors, opt - ForegroundBlack));
+            continue;
+        }
+        if (opt >= BackgroundBlack && opt <= BackgroundWhite)
+        {
+            attr.SetIndexedBackground(til::at(s_basicSgrColors, opt - BackgroundBlack));
+            continue;
+        }
+        if (opt >= BrightForegroundBlack && opt <= BrightForegroundWhite)
+        {
+            attr.SetIndexedForeground(gsl::narrow_cast<BYTE>(til::at(s_basicSgrColors, opt - BrightForegroundBlack) + 8));
+            continue;
+        }
+        if (opt >= BrightBackgroundBlack && opt <= BrightBackgroundWhite)
+        {
+            attr.SetIndexedBackground(gsl::narrow_cast<BYTE>(til::at(s_basicSgrColors, opt - BrightBackgroundBlack) + 8));
+            continue;
+        }
+
         switch (opt)
         {
         case Off:
@@ -151,108 +193,14 @@ bool AdaptDispatch::SetGraphicsRendition(const VTParameters options)
         case NoOverline:
             attr.SetOverlined(false);
             break;
-        case ForegroundBlack:
-            attr.SetIndexedForeground(TextColor::DARK_BLACK);
-            break;
-        case ForegroundBlue:
-            attr.SetIndexedForeground(TextColor::DARK_BLUE);
-            break;
-        case ForegroundGreen:
-            attr.SetIndexedForeground(TextColor::DARK_GREEN);
-            break;
-        case ForegroundCyan:
-            attr.SetIndexedForeground(TextColor::DARK_CYAN);
-            break;
-        case ForegroundRed:
-            attr.SetIndexedForeground(TextColor::DARK_RED);
-            break;
-        case ForegroundMagenta:
-            attr.SetIndexedForeground(TextColor::DARK_MAGENTA);
-            break;
-        case ForegroundYellow:
-            attr.SetIndexedForeground(TextColor::DARK_YELLOW);
-            break;
-        case ForegroundWhite:
-            attr.SetIndexedForeground(TextColor::DARK_WHITE);
-            break;
-        case BackgroundBlack:
-            attr.SetIndexedBackground(TextColor::DARK_BLACK);
-            break;
-        case BackgroundBlue:
-            attr.SetIndexedBackground(TextColor::DARK_BLUE);
-            break;
-        case BackgroundGreen:
-            attr.SetIndexedBackground(TextColor::DARK_GREEN);
-            break;
-        case BackgroundCyan:
-            attr.SetIndexedBackground(TextColor::DARK_CYAN);
-            break;
-        case BackgroundRed:
-            attr.SetIndexedBackground(TextColor::DARK_RED);
-            break;
-        case BackgroundMagenta:
-            attr.SetIndexedBackground(TextColor::DARK_MAGENTA);
-            break;
-        case BackgroundYellow:
-            attr.SetIndexedBackground(TextColor::DARK_YELLOW);
-            break;
-        case BackgroundWhite:
-            attr.SetIndexedBackground(TextColor::DARK_WHITE);
-            break;
-        case BrightForegroundBlack:
-            attr.SetIndexedForeground(TextColor::BRIGHT_BLACK);
-            break;
-        case BrightForegroundBlue:
-            attr.SetIndexedForeground(TextColor::BRIGHT_BLUE);
-            break;
-        case BrightForegroundGreen:
-            attr.SetIndexedForeground(TextColor::BRIGHT_GREEN);
-            break;
-        case BrightForegroundCyan:
-            attr.SetIndexedForeground(TextColor::BRIGHT_CYAN);
-            break;
-        case BrightForegroundRed:
-            attr.SetIndexedForeground(TextColor::BRIGHT_RED);
-            break;
-        case BrightForegroundMagenta:
-            attr.SetIndexedForeground(TextColor::BRIGHT_MAGENTA);
-            break;
-        case BrightForegroundYellow:
-            attr.SetIndexedForeground(TextColor::BRIGHT_YELLOW);
-            break;
-        case BrightForegroundWhite:
-            attr.SetIndexedForeground(TextColor::BRIGHT_WHITE);
-            break;
-        case BrightBackgroundBlack:
-            attr.SetIndexedBackground(TextColor::BRIGHT_BLACK);
-            break;
-        case BrightBackgroundBlue:
-            attr.SetIndexedBackground(TextColor::BRIGHT_BLUE);
-            break;
-        case BrightBackgroundGreen:
-            attr.SetIndexedBackground(TextColor::BRIGHT_GREEN);
-            break;
-        case BrightBackgroundCyan:
-            attr.SetIndexedBackground(TextColor::BRIGHT_CYAN);
-            break;
-        case BrightBackgroundRed:
-            attr.SetIndexedBackground(TextColor::BRIGHT_RED);
-            break;
-        case BrightBackgroundMagenta:
-            attr.SetIndexedBackground(TextColor::BRIGHT_MAGENTA);
-            break;
-        case BrightBackgroundYellow:
-            attr.SetIndexedBackground(TextColor::BRIGHT_YELLOW);
-            break;
-        case BrightBackgroundWhite:
-            attr.SetIndexedBackground(TextColor::BRIGHT_WHITE);
-            break;
         case ForegroundExtended:
             i += _SetRgbColorsHelper(options.subspan(i + 1), attr, true);
             break;
         case BackgroundExtended:
             i += _SetRgbColorsHelper(options.subspan(i + 1), attr, false);
             break;
+        default:
+            break;
         }
     }
     _pConApi->SetTextAttributes(attr);
@@ -51,6 +51,7 @@ namespace Microsoft::Console::VirtualTerminal
         virtual SHORT GetLineWidth(const size_t row) const = 0;
 
         virtual void WriteInput(std::deque<std::unique_ptr<IInputEvent>>& events, size_t& eventsWritten) = 0;
+        virtual void WriteInput(const gsl::span<const INPUT_RECORD> records, size_t& eventsWritten) = 0;
         virtual void SetWindowInfo(const bool absolute, const SMALL_RECT& window) = 0;
 
         virtual bool SetInputMode(const TerminalInput::Mode mode, const bool enabled) = 0;
@@ -126,6 +126,8 @@ public:
 
     bool DoConEmuAction(const std::wstring_view /*string*/) override { return false; }
 
+    bool GlyphWidthHint(const size_t /*count*/, const size_t /*width*/) override { return false; } // conpty glyph width hint
+
     StringHandler DownloadDRCS(const size_t /*fontNumber*/,
                                const VTParameter /*startChar*/,
                                const DispatchTypes::DrcsEraseControl /*eraseControl*/,
@@ -222,6 +222,14 @@ public:
         eventsWritten = _events.size();
     }
 
+    void WriteInput(const gsl::span<const INPUT_RECORD> records, size_t& eventsWritten) override
+    {
+        // wrap the flat records and reuse the deque mock so the same
+        // verification state is populated either way
+        auto events = IInputEvent::Create(records);
+        WriteInput(events, eventsWritten);
+    }
+
     void WriteControlInput(_In_ KeyEvent key) override
     {
         Log::Comment(L"WriteControlInput MOCK called...");
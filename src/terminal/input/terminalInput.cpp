@@ -10,10 +10,13 @@
 #define WIL_SUPPORT_BITOPERATION_PASCAL_NAMES
 #include <wil/Common.h>
 
+#include <til/static_map.h>
+
 #include "../../inc/unicode.hpp"
 #include "../../types/inc/Utf16Parser.hpp"
 
 using namespace Microsoft::Console::VirtualTerminal;
+using namespace std::string_view_literals;
 
 TerminalInput::TerminalInput(_In_ std::function<void(std::deque<std::unique_ptr<IInputEvent>>&)> pfn) :
     _leadingSurrogate{}
@@ -21,77 +24,66 @@ TerminalInput::TerminalInput(_In_ std::function<void(std::deque<std::unique_ptr<
     _pfnWriteEvents = pfn;
 }
 
-struct TermKeyMap
-{
-    const WORD vkey;
-    const std::wstring_view sequence;
-    const DWORD modifiers;
-
-    constexpr TermKeyMap(WORD vkey, std::wstring_view sequence) noexcept :
-        TermKeyMap(vkey, 0, sequence)
-    {
-    }
-
-    constexpr TermKeyMap(const WORD vkey, const DWORD modifiers, std::wstring_view sequence) noexcept :
-        vkey(vkey),
-        sequence(sequence),
-        modifiers(modifiers)
-    {
-    }
-};
+// The mappings below are keyed on the virtual key code (or, in the case of
+// s_simpleModifiedKeyMapping, the virtual key code combined with the exact
+// modifier state). til::perfect_map builds a perfect hash function over the
+// keys at compile time, so looking up a keystroke is a single hash and at
+// most one comparison rather than a binary search over the whole table.
+// Unlike with til::presorted_static_map, entries may be listed in any order.
+using VkeySequencePair = std::pair<int, std::wstring_view>;
 
 // See http://invisible-island.net/xterm/ctlseqs/ctlseqs.html#h2-PC-Style-Function-Keys
 //    For the source for these tables.
 // Also refer to the values in terminfo for kcub1, kcud1, kcuf1, kcuu1, kend, khome.
 //   the 'xterm' setting lists the application mode versions of these sequences.
-static constexpr std::array<TermKeyMap, 6> s_cursorKeysNormalMapping = {
-    TermKeyMap{ VK_UP, L"\x1b[A" },
-    TermKeyMap{ VK_DOWN, L"\x1b[B" },
-    TermKeyMap{ VK_RIGHT, L"\x1b[C" },
-    TermKeyMap{ VK_LEFT, L"\x1b[D" },
-    TermKeyMap{ VK_HOME, L"\x1b[H" },
-    TermKeyMap{ VK_END, L"\x1b[F" },
+static constexpr til::perfect_map s_cursorKeysNormalMapping{
+    VkeySequencePair{ VK_END, L"\x1b[F"sv },
+    VkeySequencePair{ VK_HOME, L"\x1b[H"sv },
+    VkeySequencePair{ VK_LEFT, L"\x1b[D"sv },
+    VkeySequencePair{ VK_UP, L"\x1b[A"sv },
+    VkeySequencePair{ VK_RIGHT, L"\x1b[C"sv },
+    VkeySequencePair{ VK_DOWN, L"\x1b[B"sv },
 };
 
-static constexpr std::array<TermKeyMap, 6> s_cursorKeysApplicationMapping{
-    TermKeyMap{ VK_UP, L"\x1bOA" },
-    TermKeyMap{ VK_DOWN, L"\x1bOB" },
-    TermKeyMap{ VK_RIGHT, L"\x1bOC" },
-    TermKeyMap{ VK_LEFT, L"\x1bOD" },
-    TermKeyMap{ VK_HOME, L"\x1bOH" },
-    TermKeyMap{ VK_END, L"\x1bOF" },
+static constexpr til::perfect_map s_cursorKeysApplicationMapping{
+    VkeySequencePair{ VK_END, L"\x1bOF"sv },
+    VkeySequencePair{ VK_HOME, L"\x1bOH"sv },
+    VkeySequencePair{ VK_LEFT, L"\x1bOD"sv },
+    VkeySequencePair{ VK_UP, L"\x1bOA"sv },
+    VkeySequencePair{ VK_RIGHT, L"\x1bOC"sv },
+    VkeySequencePair{ VK_DOWN, L"\x1bOB"sv },
 };
 
-static constexpr std::array<TermKeyMap, 6> s_cursorKeysVt52Mapping{
-    TermKeyMap{ VK_UP, L"\033A" },
-    TermKeyMap{ VK_DOWN, L"\033B" },
-    TermKeyMap{ VK_RIGHT, L"\033C" },
-    TermKeyMap{ VK_LEFT, L"\033D" },
-    TermKeyMap{ VK_HOME, L"\033H" },
-    TermKeyMap{ VK_END, L"\033F" },
+static constexpr til::perfect_map s_cursorKeysVt52Mapping{
+    VkeySequencePair{ VK_END, L"\033F"sv },
+    VkeySequencePair{ VK_HOME, L"\033H"sv },
+    VkeySequencePair{ VK_LEFT, L"\033D"sv },
+    VkeySequencePair{ VK_UP, L"\033A"sv },
+    VkeySequencePair{ VK_RIGHT, L"\033C"sv },
+    VkeySequencePair{ VK_DOWN, L"\033B"sv },
 };
 
-static constexpr std::array<TermKeyMap, 20> s_keypadNumericMapping{
-    TermKeyMap{ VK_TAB, L"\x09" },
-    TermKeyMap{ VK_BACK, L"\x7f" },
-    TermKeyMap{ VK_PAUSE, L"\x1a" },
-    TermKeyMap{ VK_ESCAPE, L"\x1b" },
-    TermKeyMap{ VK_INSERT, L"\x1b[2~" },
-    TermKeyMap{ VK_DELETE, L"\x1b[3~" },
-    TermKeyMap{ VK_PRIOR, L"\x1b[5~" },
-    TermKeyMap{ VK_NEXT, L"\x1b[6~" },
-    TermKeyMap{ VK_F1, L"\x1bOP" }, // also \x1b[11~, PuTTY uses \x1b\x1b[A
-    TermKeyMap{ VK_F2, L"\x1bOQ" }, // also \x1b[12~, PuTTY uses \x1b\x1b[B
-    TermKeyMap{ VK_F3, L"\x1bOR" }, // also \x1b[13~, PuTTY uses \x1b\x1b[C
-    TermKeyMap{ VK_F4, L"\x1bOS" }, // also \x1b[14~, PuTTY uses \x1b\x1b[D
-    TermKeyMap{ VK_F5, L"\x1b[15~" },
-    TermKeyMap{ VK_F6, L"\x1b[17~" },
-    TermKeyMap{ VK_F7, L"\x1b[18~" },
-    TermKeyMap{ VK_F8, L"\x1b[19~" },
-    TermKeyMap{ VK_F9, L"\x1b[20~" },
-    TermKeyMap{ VK_F10, L"\x1b[21~" },
-    TermKeyMap{ VK_F11, L"\x1b[23~" },
-    TermKeyMap{ VK_F12, L"\x1b[24~" },
+static constexpr til::perfect_map s_keypadNumericMapping{
+    VkeySequencePair{ VK_BACK, L"\x7f"sv },
+    VkeySequencePair{ VK_TAB, L"\x09"sv },
+    VkeySequencePair{ VK_PAUSE, L"\x1a"sv },
+    VkeySequencePair{ VK_ESCAPE, L"\x1b"sv },
+    VkeySequencePair{ VK_PRIOR, L"\x1b[5~"sv },
+    VkeySequencePair{ VK_NEXT, L"\x1b[6~"sv },
+    VkeySequencePair{ VK_INSERT, L"\x1b[2~"sv },
+    VkeySequencePair{ VK_DELETE, L"\x1b[3~"sv },
+    VkeySequencePair{ VK_F1, L"\x1bOP"sv }, // also \x1b[11~, PuTTY uses \x1b\x1b[A
+    VkeySequencePair{ VK_F2, L"\x1bOQ"sv }, // also \x1b[12~, PuTTY uses \x1b\x1b[B
+    VkeySequencePair{ VK_F3, L"\x1bOR"sv }, // also \x1b[13~, PuTTY uses \x1b\x1b[C
+    VkeySequencePair{ VK_F4, L"\x1bOS"sv }, // also \x1b[14~, PuTTY uses \x1b\x1b[D
+    VkeySequencePair{ VK_F5, L"\x1b[15~"sv },
+    VkeySequencePair{ VK_F6, L"\x1b[17~"sv },
+    VkeySequencePair{ VK_F7, L"\x1b[18~"sv },
+    VkeySequencePair{ VK_F8, L"\x1b[19~"sv },
+    VkeySequencePair{ VK_F9, L"\x1b[20~"sv },
+    VkeySequencePair{ VK_F10, L"\x1b[21~"sv },
+    VkeySequencePair{ VK_F11, L"\x1b[23~"sv },
+    VkeySequencePair{ VK_F12, L"\x1b[24~"sv },
 };
 
 //Application mode - Some terminals support both a "Numeric" input mode, and an "Application" mode
@@ -103,27 +95,27 @@ static constexpr std::array<TermKeyMap, 20> s_keypadNumericMapping{
 //It seems to me as though this was used for early numpad implementations, where presently numlock would enable
 //  "numeric" mode, outputting the numbers on the keys, while "application" mode does things like pgup/down, arrow keys, etc.
 //These keys aren't translated at all in numeric mode, so I figured I'd leave them out of the numeric table.
-static constexpr std::array<TermKeyMap, 20> s_keypadApplicationMapping{
-    TermKeyMap{ VK_TAB, L"\x09" },
-    TermKeyMap{ VK_BACK, L"\x7f" },
-    TermKeyMap{ VK_PAUSE, L"\x1a" },
-    TermKeyMap{ VK_ESCAPE, L"\x1b" },
-    TermKeyMap{ VK_INSERT, L"\x1b[2~" },
-    TermKeyMap{ VK_DELETE, L"\x1b[3~" },
-    TermKeyMap{ VK_PRIOR, L"\x1b[5~" },
-    TermKeyMap{ VK_NEXT, L"\x1b[6~" },
-    TermKeyMap{ VK_F1, L"\x1bOP" }, // also \x1b[11~, PuTTY uses \x1b\x1b[A
-    TermKeyMap{ VK_F2, L"\x1bOQ" }, // also \x1b[12~, PuTTY uses \x1b\x1b[B
-    TermKeyMap{ VK_F3, L"\x1bOR" }, // also \x1b[13~, PuTTY uses \x1b\x1b[C
-    TermKeyMap{ VK_F4, L"\x1bOS" }, // also \x1b[14~, PuTTY uses \x1b\x1b[D
-    TermKeyMap{ VK_F5, L"\x1b[15~" },
-    TermKeyMap{ VK_F6, L"\x1b[17~" },
-    TermKeyMap{ VK_F7, L"\x1b[18~" },
-    TermKeyMap{ VK_F8, L"\x1b[19~" },
-    TermKeyMap{ VK_F9, L"\x1b[20~" },
-    TermKeyMap{ VK_F10, L"\x1b[21~" },
-    TermKeyMap{ VK_F11, L"\x1b[23~" },
-    TermKeyMap{ VK_F12, L"\x1b[24~" },
+static constexpr til::perfect_map s_keypadApplicationMapping{
+    VkeySequencePair{ VK_BACK, L"\x7f"sv },
+    VkeySequencePair{ VK_TAB, L"\x09"sv },
+    VkeySequencePair{ VK_PAUSE, L"\x1a"sv },
+    VkeySequencePair{ VK_ESCAPE, L"\x1b"sv },
+    VkeySequencePair{ VK_PRIOR, L"\x1b[5~"sv },
+    VkeySequencePair{ VK_NEXT, L"\x1b[6~"sv },
+    VkeySequencePair{ VK_INSERT, L"\x1b[2~"sv },
+    VkeySequencePair{ VK_DELETE, L"\x1b[3~"sv },
+    VkeySequencePair{ VK_F1, L"\x1bOP"sv }, // also \x1b[11~, PuTTY uses \x1b\x1b[A
+    VkeySequencePair{ VK_F2, L"\x1bOQ"sv }, // also \x1b[12~, PuTTY uses \x1b\x1b[B
+    VkeySequencePair{ VK_F3, L"\x1bOR"sv }, // also \x1b[13~, PuTTY uses \x1b\x1b[C
+    VkeySequencePair{ VK_F4, L"\x1bOS"sv }, // also \x1b[14~, PuTTY uses \x1b\x1b[D
+    VkeySequencePair{ VK_F5, L"\x1b[15~"sv },
+    VkeySequencePair{ VK_F6, L"\x1b[17~"sv },
+    VkeySequencePair{ VK_F7, L"\x1b[18~"sv },
+    VkeySequencePair{ VK_F8, L"\x1b[19~"sv },
+    VkeySequencePair{ VK_F9, L"\x1b[20~"sv },
+    VkeySequencePair{ VK_F10, L"\x1b[21~"sv },
+    VkeySequencePair{ VK_F11, L"\x1b[23~"sv },
+    VkeySequencePair{ VK_F12, L"\x1b[24~"sv },
     // The numpad has a variety of mappings, none of which seem standard or really configurable by the OS.
     // See http://invisible-island.net/xterm/ctlseqs/ctlseqs.html#h2-PC-Style-Function-Keys
     //   to see just how convoluted this all is.
@@ -131,93 +123,125 @@ static constexpr std::array<TermKeyMap, 20> s_keypadApplicationMapping{
     // (see http://vim.wikia.com/wiki/PuTTY_numeric_keypad_mappings#Comments)
     // I think the best solution is to just not do any for the time being.
     // Putty also provides configuration for choosing which of the 5 mappings it has through the settings, which is more work than we can manage now.
-    // TermKeyMap{ VK_MULTIPLY, L"\x1bOj" },     // PuTTY: \x1bOR (I believe putty is treating the top row of the numpad as PF1-PF4)
-    // TermKeyMap{ VK_ADD, L"\x1bOk" },          // PuTTY: \x1bOl, \x1bOm (with shift)
-    // TermKeyMap{ VK_SEPARATOR, L"\x1bOl" },    // ? I'm not sure which key this is...
-    // TermKeyMap{ VK_SUBTRACT, L"\x1bOm" },     // \x1bOS
-    // TermKeyMap{ VK_DECIMAL, L"\x1bOn" },      // \x1bOn
-    // TermKeyMap{ VK_DIVIDE, L"\x1bOo" },       // \x1bOQ
-    // TermKeyMap{ VK_NUMPAD0, L"\x1bOp" },
-    // TermKeyMap{ VK_NUMPAD1, L"\x1bOq" },
-    // TermKeyMap{ VK_NUMPAD2, L"\x1bOr" },
-    // TermKeyMap{ VK_NUMPAD3, L"\x1bOs" },
-    // TermKeyMap{ VK_NUMPAD4, L"\x1bOt" },
-    // TermKeyMap{ VK_NUMPAD5, L"\x1bOu" }, // \x1b0E
-    // TermKeyMap{ VK_NUMPAD5, L"\x1bOE" }, // PuTTY \x1b[G
-    // TermKeyMap{ VK_NUMPAD6, L"\x1bOv" },
-    // TermKeyMap{ VK_NUMPAD7, L"\x1bOw" },
-    // TermKeyMap{ VK_NUMPAD8, L"\x1bOx" },
-    // TermKeyMap{ VK_NUMPAD9, L"\x1bOy" },
-    // TermKeyMap{ '=', L"\x1bOX" },      // I've also seen these codes mentioned in some documentation,
-    // TermKeyMap{ VK_SPACE, L"\x1bO " }, //  but I wasn't really sure if they should be included or not...
-    // TermKeyMap{ VK_TAB, L"\x1bOI" },   // So I left them here as a reference just in case.
+    // VkeySequencePair{ VK_MULTIPLY, L"\x1bOj" },     // PuTTY: \x1bOR (I believe putty is treating the top row of the numpad as PF1-PF4)
+    // VkeySequencePair{ VK_ADD, L"\x1bOk" },          // PuTTY: \x1bOl, \x1bOm (with shift)
+    // VkeySequencePair{ VK_SEPARATOR, L"\x1bOl" },    // ? I'm not sure which key this is...
+    // VkeySequencePair{ VK_SUBTRACT, L"\x1bOm" },     // \x1bOS
+    // VkeySequencePair{ VK_DECIMAL, L"\x1bOn" },      // \x1bOn
+    // VkeySequencePair{ VK_DIVIDE, L"\x1bOo" },       // \x1bOQ
+    // VkeySequencePair{ VK_NUMPAD0, L"\x1bOp" },
+    // VkeySequencePair{ VK_NUMPAD1, L"\x1bOq" },
+    // VkeySequencePair{ VK_NUMPAD2, L"\x1bOr" },
+    // VkeySequencePair{ VK_NUMPAD3, L"\x1bOs" },
+    // VkeySequencePair{ VK_NUMPAD4, L"\x1bOt" },
+    // VkeySequencePair{ VK_NUMPAD5, L"\x1bOu" }, // \x1b0E
+    // VkeySequencePair{ VK_NUMPAD5, L"\x1bOE" }, // PuTTY \x1b[G
+    // VkeySequencePair{ VK_NUMPAD6, L"\x1bOv" },
+    // VkeySequencePair{ VK_NUMPAD7, L"\x1bOw" },
+    // VkeySequencePair{ VK_NUMPAD8, L"\x1bOx" },
+    // VkeySequencePair{ VK_NUMPAD9, L"\x1bOy" },
+    // VkeySequencePair{ '=', L"\x1bOX" },      // I've also seen these codes mentioned in some documentation,
+    // VkeySequencePair{ VK_SPACE, L"\x1bO " }, //  but I wasn't really sure if they should be included or not...
+    // VkeySequencePair{ VK_TAB, L"\x1bOI" },   // So I left them here as a reference just in case.
 };
 
-static constexpr std::array<TermKeyMap, 20> s_keypadVt52Mapping{
-    TermKeyMap{ VK_TAB, L"\x09" },
-    TermKeyMap{ VK_BACK, L"\x7f" },
-    TermKeyMap{ VK_PAUSE, L"\x1a" },
-    TermKeyMap{ VK_ESCAPE, L"\x1b" },
-    TermKeyMap{ VK_INSERT, L"\x1b[2~" },
-    TermKeyMap{ VK_DELETE, L"\x1b[3~" },
-    TermKeyMap{ VK_PRIOR, L"\x1b[5~" },
-    TermKeyMap{ VK_NEXT, L"\x1b[6~" },
-    TermKeyMap{ VK_F1, L"\x1bP" },
-    TermKeyMap{ VK_F2, L"\x1bQ" },
-    TermKeyMap{ VK_F3, L"\x1bR" },
-    TermKeyMap{ VK_F4, L"\x1bS" },
-    TermKeyMap{ VK_F5, L"\x1b[15~" },
-    TermKeyMap{ VK_F6, L"\x1b[17~" },
-    TermKeyMap{ VK_F7, L"\x1b[18~" },
-    TermKeyMap{ VK_F8, L"\x1b[19~" },
-    TermKeyMap{ VK_F9, L"\x1b[20~" },
-    TermKeyMap{ VK_F10, L"\x1b[21~" },
-    TermKeyMap{ VK_F11, L"\x1b[23~" },
-    TermKeyMap{ VK_F12, L"\x1b[24~" },
+static constexpr til::perfect_map s_keypadVt52Mapping{
+    VkeySequencePair{ VK_BACK, L"\x7f"sv },
+    VkeySequencePair{ VK_TAB, L"\x09"sv },
+    VkeySequencePair{ VK_PAUSE, L"\x1a"sv },
+    VkeySequencePair{ VK_ESCAPE, L"\x1b"sv },
+    VkeySequencePair{ VK_PRIOR, L"\x1b[5~"sv },
+    VkeySequencePair{ VK_NEXT, L"\x1b[6~"sv },
+    VkeySequencePair{ VK_INSERT, L"\x1b[2~"sv },
+    VkeySequencePair{ VK_DELETE, L"\x1b[3~"sv },
+    VkeySequencePair{ VK_F1, L"\x1bP"sv },
+    VkeySequencePair{ VK_F2, L"\x1bQ"sv },
+    VkeySequencePair{ VK_F3, L"\x1bR"sv },
+    VkeySequencePair{ VK_F4, L"\x1bS"sv },
+    VkeySequencePair{ VK_F5, L"\x1b[15~"sv },
+    VkeySequencePair{ VK_F6, L"\x1b[17~"sv },
+    VkeySequencePair{ VK_F7, L"\x1b[18~"sv },
+    VkeySequencePair{ VK_F8, L"\x1b[19~"sv },
+    VkeySequencePair{ VK_F9, L"\x1b[20~"sv },
+    VkeySequencePair{ VK_F10, L"\x1b[21~"sv },
+    VkeySequencePair{ VK_F11, L"\x1b[23~"sv },
+    VkeySequencePair{ VK_F12, L"\x1b[24~"sv },
 };
 
 // Sequences to send when a modifier is pressed with any of these keys
 // Basically, the 'm' will be replaced with a character indicating which
 //      modifier keys are pressed.
-static constexpr std::array<TermKeyMap, 22> s_modifierKeyMapping{
-    TermKeyMap{ VK_UP, L"\x1b[1;mA" },
-    TermKeyMap{ VK_DOWN, L"\x1b[1;mB" },
-    TermKeyMap{ VK_RIGHT, L"\x1b[1;mC" },
-    TermKeyMap{ VK_LEFT, L"\x1b[1;mD" },
-    TermKeyMap{ VK_HOME, L"\x1b[1;mH" },
-    TermKeyMap{ VK_END, L"\x1b[1;mF" },
-    TermKeyMap{ VK_F1, L"\x1b[1;mP" },
-    TermKeyMap{ VK_F2, L"\x1b[1;mQ" },
-    TermKeyMap{ VK_F3, L"\x1b[1;mR" },
-    TermKeyMap{ VK_F4, L"\x1b[1;mS" },
-    TermKeyMap{ VK_INSERT, L"\x1b[2;m~" },
-    TermKeyMap{ VK_DELETE, L"\x1b[3;m~" },
-    TermKeyMap{ VK_PRIOR, L"\x1b[5;m~" },
-    TermKeyMap{ VK_NEXT, L"\x1b[6;m~" },
-    TermKeyMap{ VK_F5, L"\x1b[15;m~" },
-    TermKeyMap{ VK_F6, L"\x1b[17;m~" },
-    TermKeyMap{ VK_F7, L"\x1b[18;m~" },
-    TermKeyMap{ VK_F8, L"\x1b[19;m~" },
-    TermKeyMap{ VK_F9, L"\x1b[20;m~" },
-    TermKeyMap{ VK_F10, L"\x1b[21;m~" },
-    TermKeyMap{ VK_F11, L"\x1b[23;m~" },
-    TermKeyMap{ VK_F12, L"\x1b[24;m~" },
+static constexpr til::perfect_map s_modifierKeyMapping{
+    VkeySequencePair{ VK_PRIOR, L"\x1b[5;m~"sv },
+    VkeySequencePair{ VK_NEXT, L"\x1b[6;m~"sv },
+    VkeySequencePair{ VK_END, L"\x1b[1;mF"sv },
+    VkeySequencePair{ VK_HOME, L"\x1b[1;mH"sv },
+    VkeySequencePair{ VK_LEFT, L"\x1b[1;mD"sv },
+    VkeySequencePair{ VK_UP, L"\x1b[1;mA"sv },
+    VkeySequencePair{ VK_RIGHT, L"\x1b[1;mC"sv },
+    VkeySequencePair{ VK_DOWN, L"\x1b[1;mB"sv },
+    VkeySequencePair{ VK_INSERT, L"\x1b[2;m~"sv },
+    VkeySequencePair{ VK_DELETE, L"\x1b[3;m~"sv },
+    VkeySequencePair{ VK_F1, L"\x1b[1;mP"sv },
+    VkeySequencePair{ VK_F2, L"\x1b[1;mQ"sv },
+    VkeySequencePair{ VK_F3, L"\x1b[1;mR"sv },
+    VkeySequencePair{ VK_F4, L"\x1b[1;mS"sv },
+    VkeySequencePair{ VK_F5, L"\x1b[15;m~"sv },
+    VkeySequencePair{ VK_F6, L"\x1b[17;m~"sv },
+    VkeySequencePair{ VK_F7, L"\x1b[18;m~"sv },
+    VkeySequencePair{ VK_F8, L"\x1b[19;m~"sv },
+    VkeySequencePair{ VK_F9, L"\x1b[20;m~"sv },
+    VkeySequencePair{ VK_F10, L"\x1b[21;m~"sv },
+    VkeySequencePair{ VK_F11, L"\x1b[23;m~"sv },
+    VkeySequencePair{ VK_F12, L"\x1b[24;m~"sv },
     // Ubuntu's inputrc also defines \x1b[5C, \x1b\x1bC (and D) as 'forward/backward-word' mappings
     // I believe '\x1b\x1bC' is listed because the C1 ESC (x9B) gets encoded as
     //  \xC2\x9B, but then translated to \x1b\x1b if the C1 codepoint isn't supported by the current encoding
 };
 
+// The longest sequence in s_modifierKeyMapping. _searchWithModifier patches
+// the modifier parameter into a stack copy of the matched sequence, so this
+// must be kept up to date if a longer sequence is ever added.
+static constexpr size_t s_modifierKeySequenceMaxLength = 7;
+
+// Routine Description:
+// - Combines a virtual key code and the exact set of modifier keys into the
+//      key used by s_simpleModifiedKeyMapping below. The modifiers occupy the
+//      three least significant bits, in the same order as the xterm modifier
+//      parameter encoding (shift = 1, alt = 2, ctrl = 4).
+// Arguments:
+// - vkey - Virtual key code of the keystroke
+// - modifiers - Active modifier key flags of the keystroke
+// Return Value:
+// - The combined lookup key.
+constexpr int _simpleModifiedKey(const int vkey, const DWORD modifiers) noexcept
+{
+    return (vkey << 3) |
+           ((modifiers & SHIFT_PRESSED) ? 1 : 0) |
+           ((modifiers & ALT_PRESSED) ? 2 : 0) |
+           ((modifiers & CTRL_PRESSED) ? 4 : 0);
+}
+
+static int _simpleModifiedKey(const KeyEvent& keyEvent) noexcept
+{
+    return _simpleModifiedKey(keyEvent.GetVirtualKeyCode(),
+                              (keyEvent.IsShiftPressed() ? SHIFT_PRESSED : 0) |
+                              (keyEvent.IsAltPressed() ? ALT_PRESSED : 0) |
+                              (keyEvent.IsCtrlPressed() ? CTRL_PRESSED : 0));
+}
+
 // Sequences to send when a modifier is pressed with any of these keys
 // These sequences are not later updated to encode the modifier state in the
 //      sequence itself, they are just weird exceptional cases to the general
 //      rules above.
-static constexpr std::array<TermKeyMap, 14> s_simpleModifiedKeyMapping{
-    TermKeyMap{ VK_BACK, CTRL_PRESSED, L"\x8" },
-    TermKeyMap{ VK_BACK, ALT_PRESSED, L"\x1b\x7f" },
-    TermKeyMap{ VK_BACK, CTRL_PRESSED | ALT_PRESSED, L"\x1b\x8" },
-    TermKeyMap{ VK_TAB, CTRL_PRESSED, L"\t" },
-    TermKeyMap{ VK_TAB, SHIFT_PRESSED, L"\x1b[Z" },
-    TermKeyMap{ VK_DIVIDE, CTRL_PRESSED, L"\x1F" },
+// An entry only matches when the pressed modifiers are exactly the ones it
+//      was keyed with - no more, no less.
+static constexpr til::perfect_map s_simpleModifiedKeyMapping{
+    VkeySequencePair{ _simpleModifiedKey(VK_BACK, ALT_PRESSED), L"\x1b\x7f"sv },
+    VkeySequencePair{ _simpleModifiedKey(VK_BACK, CTRL_PRESSED), L"\x8"sv },
+    VkeySequencePair{ _simpleModifiedKey(VK_BACK, CTRL_PRESSED | ALT_PRESSED), L"\x1b\x8"sv },
+    VkeySequencePair{ _simpleModifiedKey(VK_TAB, SHIFT_PRESSED), L"\x1b[Z"sv },
+    VkeySequencePair{ _simpleModifiedKey(VK_TAB, CTRL_PRESSED), L"\t"sv },
 
     // GH#3507 - We should also be encoding Ctrl+# according to the following table:
     // https://vt100.net/docs/vt220-rm/table3-5.html
@@ -226,19 +250,20 @@ static constexpr std::array<TermKeyMap, 14> s_simpleModifiedKeyMapping{
     // * 0 doesn't seem to send even an unmodified '0' through.
     // * Ctrl+2 is already special-cased below in `HandleKey`, so it's not
     //   included here.
-    TermKeyMap{ static_cast<WORD>('1'), CTRL_PRESSED, L"1" },
-    // TermKeyMap{ static_cast<WORD>('2'), CTRL_PRESSED, L"\x00" },
-    TermKeyMap{ static_cast<WORD>('3'), CTRL_PRESSED, L"\x1B" },
-    TermKeyMap{ static_cast<WORD>('4'), CTRL_PRESSED, L"\x1C" },
-    TermKeyMap{ static_cast<WORD>('5'), CTRL_PRESSED, L"\x1D" },
-    TermKeyMap{ static_cast<WORD>('6'), CTRL_PRESSED, L"\x1E" },
-    TermKeyMap{ static_cast<WORD>('7'), CTRL_PRESSED, L"\x1F" },
-    TermKeyMap{ static_cast<WORD>('8'), CTRL_PRESSED, L"\x7F" },
-    TermKeyMap{ static_cast<WORD>('9'), CTRL_PRESSED, L"9" },
+    VkeySequencePair{ _simpleModifiedKey('1', CTRL_PRESSED), L"1"sv },
+    // VkeySequencePair{ _simpleModifiedKey('2', CTRL_PRESSED), L"\x00"sv },
+    VkeySequencePair{ _simpleModifiedKey('3', CTRL_PRESSED), L"\x1B"sv },
+    VkeySequencePair{ _simpleModifiedKey('4', CTRL_PRESSED), L"\x1C"sv },
+    VkeySequencePair{ _simpleModifiedKey('5', CTRL_PRESSED), L"\x1D"sv },
+    VkeySequencePair{ _simpleModifiedKey('6', CTRL_PRESSED), L"\x1E"sv },
+    VkeySequencePair{ _simpleModifiedKey('7', CTRL_PRESSED), L"\x1F"sv },
+    VkeySequencePair{ _simpleModifiedKey('8', CTRL_PRESSED), L"\x7F"sv },
+    VkeySequencePair{ _simpleModifiedKey('9', CTRL_PRESSED), L"9"sv },
+    VkeySequencePair{ _simpleModifiedKey(VK_DIVIDE, CTRL_PRESSED), L"\x1F"sv },
 
     // These two are not implemented here, because they are system keys.
-    // TermKeyMap{ VK_TAB, ALT_PRESSED, L""}, This is the Windows system shortcut for switching windows.
-    // TermKeyMap{ VK_ESCAPE, ALT_PRESSED, L""}, This is another Windows system shortcut for switching windows.
+    // VkeySequencePair{ _simpleModifiedKey(VK_TAB, ALT_PRESSED), L""sv }, This is the Windows system shortcut for switching windows.
+    // VkeySequencePair{ _simpleModifiedKey(VK_ESCAPE, ALT_PRESSED), L""sv }, This is another Windows system shortcut for switching windows.
 };
 
 const wchar_t* const CTRL_SLASH_SEQUENCE = L"\x1f";
@@ -277,87 +302,64 @@ void TerminalInput::ForceDisableWin32InputMode(const bool win32InputMode) noexce
     _forceDisableWin32InputMode = win32InputMode;
 }
 
-static const gsl::span<const TermKeyMap> _getKeyMapping(const KeyEvent& keyEvent,
-                                                        const bool ansiMode,
-                                                        const bool cursorApplicationMode,
-                                                        const bool keypadApplicationMode) noexcept
+// Routine Description:
+// - Searches the keyMapping for an entry corresponding to this key event, and returns it.
+// - The vkey-keyed mappings don't care what the modifiers are on the key.
+//      The caller will likely do something with them.
+// Arguments:
+// - keyEvent - Key event to translate
+// - keyMapping - The mapping to search
+// Return Value:
+// - Has value if there was a match to a key translation.
+template<size_t N>
+static std::optional<std::wstring_view> _searchKeyMapping(const KeyEvent& keyEvent,
+                                                          const til::perfect_map<int, std::wstring_view, N>& keyMapping) noexcept
+{
+    const auto match = keyMapping.find(keyEvent.GetVirtualKeyCode());
+    if (match == keyMapping.end())
+    {
+        return std::nullopt;
+    }
+    return match->second;
+}
+
+// Routine Description:
+// - Picks the default mapping appropriate for the current input modes, and
+//      searches it for an entry corresponding to this key event.
+// Arguments:
+// - keyEvent - Key event to translate
+// - ansiMode - Whether the terminal is in ANSI (as opposed to VT52) mode
+// - cursorApplicationMode - Whether the cursor keys are in application mode
+// - keypadApplicationMode - Whether the keypad is in application mode
+// Return Value:
+// - Has value if there was a match to a key translation.
+static std::optional<std::wstring_view> _searchDefaultMapping(const KeyEvent& keyEvent,
+                                                              const bool ansiMode,
+                                                              const bool cursorApplicationMode,
+                                                              const bool keypadApplicationMode) noexcept
 {
     if (ansiMode)
     {
         if (keyEvent.IsCursorKey())
         {
-            if (cursorApplicationMode)
-            {
-                return { s_cursorKeysApplicationMapping.data(), s_cursorKeysApplicationMapping.size() };
-            }
-            else
-            {
-                return { s_cursorKeysNormalMapping.data(), s_cursorKeysNormalMapping.size() };
-            }
+            return _searchKeyMapping(keyEvent, cursorApplicationMode ? s_cursorKeysApplicationMapping : s_cursorKeysNormalMapping);
         }
         else
         {
-            if (keypadApplicationMode)
-            {
-                return { s_keypadApplicationMapping.data(), s_keypadApplicationMapping.size() };
-            }
-            else
-            {
-                return { s_keypadNumericMapping.data(), s_keypadNumericMapping.size() };
-            }
+            return _searchKeyMapping(keyEvent, keypadApplicationMode ? s_keypadApplicationMapping : s_keypadNumericMapping);
         }
     }
     else
     {
         if (keyEvent.IsCursorKey())
         {
-            return { s_cursorKeysVt52Mapping.data(), s_cursorKeysVt52Mapping.size() };
+            return _searchKeyMapping(keyEvent, s_cursorKeysVt52Mapping);
         }
         else
         {
-            return { s_keypadVt52Mapping.data(), s_keypadVt52Mapping.size() };
-        }
-    }
-}
-
-// Routine Description:
-// - Searches the keyMapping for a entry corresponding to this key event, and returns it.
-// Arguments:
-// - keyEvent - Key event to translate
-// - keyMapping - Array of key mappings to search
-// Return Value:
-// - Has value if there was a match to a key translation.
-static std::optional<const TermKeyMap> _searchKeyMapping(const KeyEvent& keyEvent,
-                                                         gsl::span<const TermKeyMap> keyMapping) noexcept
-{
-    for (auto& map : keyMapping)
-    {
-        if (map.vkey == keyEvent.GetVirtualKeyCode())
-        {
-            // If the mapping has no modifiers set, then it doesn't really care
-            //      what the modifiers are on the key. The caller will likely do
-            //      something with them.
-            // However, if there are modifiers set, then we only want to match
-            //      if the key's modifiers are the same as the modifiers in the
-            //      mapping.
-            bool modifiersMatch = WI_AreAllFlagsClear(map.modifiers, MOD_PRESSED);
-            if (!modifiersMatch)
-            {
-                // The modifier mapping expects certain modifier keys to be
-                //      pressed. Check those as well.
-                modifiersMatch =
-                    (WI_IsFlagSet(map.modifiers, SHIFT_PRESSED) == keyEvent.IsShiftPressed()) &&
-                    (WI_IsAnyFlagSet(map.modifiers, ALT_PRESSED) == keyEvent.IsAltPressed()) &&
-                    (WI_IsAnyFlagSet(map.modifiers, CTRL_PRESSED) == keyEvent.IsCtrlPressed());
-            }
-
-            if (modifiersMatch)
-            {
-                return map;
-            }
+            return _searchKeyMapping(keyEvent, s_keypadVt52Mapping);
         }
     }
-    return std::nullopt;
 }
 
 typedef std::function<void(const std::wstring_view)> InputSender;
@@ -375,19 +377,21 @@ static bool _searchWithModifier(const KeyEvent& keyEvent, InputSender sender)
 {
     bool success = false;
 
-    const auto match = _searchKeyMapping(keyEvent,
-                                         { s_modifierKeyMapping.data(), s_modifierKeyMapping.size() });
+    const auto match = _searchKeyMapping(keyEvent, s_modifierKeyMapping);
     if (match)
     {
-        const auto& v = match.value();
-        if (!v.sequence.empty())
+        const auto sequence = match.value();
+        if (!sequence.empty() && sequence.size() <= s_modifierKeySequenceMaxLength)
         {
-            std::wstring modified{ v.sequence }; // Make a copy so we can modify it.
+            // Make a copy on the stack so we can modify it,
+            //      rather than paying for a heap allocation per keystroke.
+            std::array<wchar_t, s_modifierKeySequenceMaxLength> modified{};
+            std::copy_n(sequence.cbegin(), sequence.size(), modified.begin());
             const bool shift = keyEvent.IsShiftPressed();
             const bool alt = keyEvent.IsAltPressed();
             const bool ctrl = keyEvent.IsCtrlPressed();
-            modified.at(modified.size() - 2) = L'1' + (shift ? 1 : 0) + (alt ? 2 : 0) + (ctrl ? 4 : 0);
-            sender(modified);
+            til::at(modified, sequence.size() - 2) = L'1' + (shift ? 1 : 0) + (alt ? 2 : 0) + (ctrl ? 4 : 0);
+            sender({ modified.data(), sequence.size() });
             success = true;
         }
     }
@@ -396,12 +400,11 @@ static bool _searchWithModifier(const KeyEvent& keyEvent, InputSender sender)
         // We didn't find the key in the map of modified keys that need editing,
         //      maybe it's in the other map of modified keys with sequences that
         //      don't need editing before sending.
-        const auto match2 = _searchKeyMapping(keyEvent,
-                                              { s_simpleModifiedKeyMapping.data(), s_simpleModifiedKeyMapping.size() });
-        if (match2)
+        const auto match2 = s_simpleModifiedKeyMapping.find(_simpleModifiedKey(keyEvent));
+        if (match2 != s_simpleModifiedKeyMapping.end())
         {
             // This mapping doesn't need to be changed at all.
-            sender(match2.value().sequence);
+            sender(match2->second);
             success = true;
         }
         else
@@ -483,23 +486,31 @@ static bool _searchWithModifier(const KeyEvent& keyEvent, InputSender sender)
 }
 
 // Routine Description:
-// - Searches the input array of mappings, and sends it to the input if a match was found.
+// - Synthesize a win32-input-mode sequence for the given keyevent.
 // Arguments:
-// - keyEvent - Key event to translate
-// - keyMapping - Array of key mappings to search
-// - sender - Function to use to dispatch translated event
-// Return Value:
-// - True if there was a match to a key translation, and we successfully sent it to the input
-static bool _translateDefaultMapping(const KeyEvent& keyEvent,
-                                     const gsl::span<const TermKeyMap> keyMapping,
-                                     InputSender sender)
+// - key: the KeyEvent to serialize.
+// - sequence: receives the formatted string representation of this key.
+static void _generateWin32KeySequence(const KeyEvent& key, fmt::basic_memory_buffer<wchar_t, 64>& sequence)
 {
-    const auto match = _searchKeyMapping(keyEvent, keyMapping);
-    if (match)
-    {
-        sender(match->sequence);
-    }
-    return match.has_value();
+    // Sequences are formatted as follows:
+    //
+    // ^[ [ Vk ; Sc ; Uc ; Kd ; Cs ; Rc _
+    //
+    //      Vk: the value of wVirtualKeyCode - any number. If omitted, defaults to '0'.
+    //      Sc: the value of wVirtualScanCode - any number. If omitted, defaults to '0'.
+    //      Uc: the decimal value of UnicodeChar - for example, NUL is "0", LF is
+    //          "10", the character 'A' is "65". If omitted, defaults to '0'.
+    //      Kd: the value of bKeyDown - either a '0' or '1'. If omitted, defaults to '0'.
+    //      Cs: the value of dwControlKeyState - any number. If omitted, defaults to '0'.
+    //      Rc: the value of wRepeatCount - any number. If omitted, defaults to '1'.
+    fmt::format_to(std::back_inserter(sequence),
+                   FMT_COMPILE(L"\x1b[{};{};{};{};{};{}_"),
+                   key.GetVirtualKeyCode(),
+                   key.GetVirtualScanCode(),
+                   static_cast<int>(key.GetCharData()),
+                   key.IsKeyDown() ? 1 : 0,
+                   key.GetActiveModifierKeys(),
+                   key.GetRepeatCount());
 }
 
 // Routine Description:
@@ -535,8 +546,11 @@ bool TerminalInput::HandleKey(const IInputEvent* const pInEvent)
     // Only do this if win32-input-mode support isn't manually disabled.
     if (_inputMode.test(Mode::Win32) && !_forceDisableWin32InputMode)
     {
-        const auto seq = _GenerateWin32KeySequence(keyEvent);
-        _SendInputSequence(seq);
+        // Formatting into a stack buffer spares us a heap allocation for
+        // every keystroke that passes through win32-input mode.
+        fmt::basic_memory_buffer<wchar_t, 64> seq;
+        _generateWin32KeySequence(keyEvent, seq);
+        _SendInputSequence({ seq.data(), seq.size() });
         return true;
     }
 
@@ -658,9 +672,10 @@ bool TerminalInput::HandleKey(const IInputEvent* const pInEvent)
     // Check any other key mappings (like those for the F1-F12 keys).
     // These mappings will kick in no matter which modifiers are pressed and as such
     // must be checked last, or otherwise we'd override more complex key combinations.
-    const auto mapping = _getKeyMapping(keyEvent, _inputMode.test(Mode::Ansi), _inputMode.test(Mode::CursorKey), _inputMode.test(Mode::Keypad));
-    if (_translateDefaultMapping(keyEvent, mapping, senderFunc))
+    const auto match = _searchDefaultMapping(keyEvent, _inputMode.test(Mode::Ansi), _inputMode.test(Mode::CursorKey), _inputMode.test(Mode::Keypad));
+    if (match)
     {
+        _SendInputSequence(match.value());
         return true;
     }
 
@@ -765,31 +780,3 @@ void TerminalInput::_SendInputSequence(const std::wstring_view sequence) const n
         }
     }
 }
-
-// Method Description:
-// - Synthesize a win32-input-mode sequence for the given keyevent.
-// Arguments:
-// - key: the KeyEvent to serialize.
-// Return Value:
-// - the formatted string representation of this key
-std::wstring TerminalInput::_GenerateWin32KeySequence(const KeyEvent& key)
-{
-    // Sequences are formatted as follows:
-    //
-    // ^[ [ Vk ; Sc ; Uc ; Kd ; Cs ; Rc _
-    //
-    //      Vk: the value of wVirtualKeyCode - any number. If omitted, defaults to '0'.
-    //      Sc: the value of wVirtualScanCode - any number. If omitted, defaults to '0'.
-    //      Uc: the decimal value of UnicodeChar - for example, NUL is "0", LF is
-    //          "10", the character 'A' is "65". If omitted, defaults to '0'.
-    //      Kd: the value of bKeyDown - either a '0' or '1'. If omitted, defaults to '0'.
-    //      Cs: the value of dwControlKeyState - any number. If omitted, defaults to '0'.
-    //      Rc: the value of wRepeatCount - any number. If omitted, defaults to '1'.
-    return fmt::format(FMT_COMPILE(L"\x1b[{};{};{};{};{};{}_"),
-                       key.GetVirtualKeyCode(),
-                       key.GetVirtualScanCode(),
-                       static_cast<int>(key.GetCharData()),
-                       key.IsKeyDown() ? 1 : 0,
-                       key.GetActiveModifierKeys(),
-                       key.GetRepeatCount());
-}
@@ -277,12 +277,21 @@ bool InputStateMachineEngine::ActionPassThroughString(const std::wstring_view st
         // similar to TerminalInput::_SendInputSequence
         if (!string.empty())
         {
-            std::deque<std::unique_ptr<IInputEvent>> inputEvents;
+            InputRecordBatch records;
+            records.reserve(string.size());
             for (const auto& wch : string)
             {
-                inputEvents.push_back(std::make_unique<KeyEvent>(true, 1ui16, 0ui16, 0ui16, wch, 0));
+                INPUT_RECORD rec;
+                rec.EventType = KEY_EVENT;
+                rec.Event.KeyEvent.bKeyDown = TRUE;
+                rec.Event.KeyEvent.wRepeatCount = 1;
+                rec.Event.KeyEvent.wVirtualKeyCode = 0;
+                rec.Event.KeyEvent.wVirtualScanCode = 0;
+                rec.Event.KeyEvent.uChar.UnicodeChar = wch;
+                rec.Event.KeyEvent.dwControlKeyState = 0;
+                records.push_back(rec);
             }
-            return _pDispatch->WriteInput(inputEvents);
+            return _pDispatch->WriteInput(gsl::make_span(records.data(), records.size()));
         }
     }
     return ActionPrintString(string);
@@ -546,7 +555,7 @@ bool InputStateMachineEngine::ActionOscDispatch(const wchar_t /*wch*/,
 void InputStateMachineEngine::_GenerateWrappedSequence(const wchar_t wch,
                                                        const short vkey,
                                                        const DWORD modifierState,
-                                                       std::vector<INPUT_RECORD>& input)
+                                                       InputRecordBatch& input)
 {
     input.reserve(input.size() + 8);
 
@@ -656,7 +665,7 @@ void InputStateMachineEngine::_GenerateWrappedSequence(const wchar_t wch,
 void InputStateMachineEngine::_GetSingleKeypress(const wchar_t wch,
                                                  const short vkey,
                                                  const DWORD modifierState,
-                                                 std::vector<INPUT_RECORD>& input)
+                                                 InputRecordBatch& input)
 {
     input.reserve(input.size() + 2);
 
@@ -688,12 +697,13 @@ void InputStateMachineEngine::_GetSingleKeypress(const wchar_t wch,
 // - true iff we successfully wrote the keypress to the input callback.
 bool InputStateMachineEngine::_WriteSingleKey(const wchar_t wch, const short vkey, const DWORD modifierState)
 {
-    // At most 8 records - 2 for each of shift,ctrl,alt up and down, and 2 for the actual key up and down.
-    std::vector<INPUT_RECORD> input;
+    // At most 8 records - 2 for each of shift,ctrl,alt up and down, and 2 for
+    // the actual key up and down - all of which fit in the batch's inline
+    // storage, so building one per keystroke never allocates.
+    InputRecordBatch input;
     _GenerateWrappedSequence(wch, vkey, modifierState, input);
-    std::deque<std::unique_ptr<IInputEvent>> inputEvents = IInputEvent::Create(gsl::make_span(input));
 
-    return _pDispatch->WriteInput(inputEvents);
+    return _pDispatch->WriteInput(gsl::make_span(input.data(), input.size()));
 }
 
 // Method Description:
@@ -731,8 +741,7 @@ bool InputStateMachineEngine::_WriteMouseEvent(const til::point uiPos, const DWO
 
     // pack and write input record
     // 1 record - the modifiers don't get their own events
-    std::deque<std::unique_ptr<IInputEvent>> inputEvents = IInputEvent::Create(gsl::make_span(&rgInput, 1));
-    return _pDispatch->WriteInput(inputEvents);
+    return _pDispatch->WriteInput(gsl::make_span(&rgInput, 1));
 }
 
 // Method Description:
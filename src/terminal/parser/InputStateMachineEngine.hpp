@@ -188,6 +188,10 @@ namespace Microsoft::Console::VirtualTerminal
         bool _GetCursorKeysVkey(const VTID id, short& vkey) const;
         bool _GetSs3KeysVkey(const wchar_t wch, short& vkey) const;
 
+        // A wrapped sequence is at most 8 records (see _GenerateWrappedSequence),
+        // so a batch with that much inline storage never touches the heap.
+        using InputRecordBatch = boost::container::small_vector<INPUT_RECORD, 8>;
+
         bool _WriteSingleKey(const short vkey, const DWORD modifierState);
         bool _WriteSingleKey(const wchar_t wch, const short vkey, const DWORD modifierState);
 
@@ -196,12 +200,12 @@ namespace Microsoft::Console::VirtualTerminal
         void _GenerateWrappedSequence(const wchar_t wch,
                                       const short vkey,
                                       const DWORD modifierState,
-                                      std::vector<INPUT_RECORD>& input);
+                                      InputRecordBatch& input);
 
         void _GetSingleKeypress(const wchar_t wch,
                                 const short vkey,
                                 const DWORD modifierState,
-                                std::vector<INPUT_RECORD>& input);
+                                InputRecordBatch& input);
 
         bool _GetWindowManipulationType(const gsl::span<const size_t> parameters,
                                         unsigned int& function) const noexcept;
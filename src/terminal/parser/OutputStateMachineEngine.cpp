@@ -606,6 +606,9 @@ bool OutputStateMachineEngine::ActionCsiDispatch(const VTID id, const VTParamete
         success = _dispatch->SoftReset();
         TermTelemetry::Instance().Log(TermTelemetry::Codes::DECSTR);
         break;
+    case CsiActionCodes::CONPTY_GlyphWidthHint:
+        success = _dispatch->GlyphWidthHint(parameters.at(0), parameters.at(1));
+        break;
 
     case CsiActionCodes::XT_PushSgr:
     case CsiActionCodes::XT_PushSgrAlias:
@@ -7,6 +7,8 @@
 
 #include "ascii.hpp"
 
+#include "../../inc/ConsolePerfCounters.h"
+
 using namespace Microsoft::Console::VirtualTerminal;
 
 //Takes ownership of the pEngine.
@@ -379,6 +381,76 @@ static constexpr bool _isActionableFromGround(const wchar_t wch) noexcept
 
 #pragma warning(pop)
 
+// Routine Description:
+// - Scans forward for the next character that is actionable from the ground
+//   state (a C0 control, DEL, or a C1 control) and returns its index, or the
+//   length of the string if no such character remains. The overwhelming
+//   majority of a typical output stream is plain printable text, so this is
+//   vectorized to test 8 (or 16) characters per iteration instead of one.
+// Arguments:
+// - string - the string to scan
+// - offset - the index to start scanning from
+// Return Value:
+// - index of the next actionable character, or string.size() if there is none.
+static size_t _findActionableFromGround(const std::wstring_view string, size_t offset) noexcept
+{
+    // A character is actionable when wch <= 0x1f or 0x7f <= wch <= 0x9f
+    // (see _isActionableFromGround). x86 has no unsigned 16-bit comparisons,
+    // so every lane is biased by 0x8000 and the signed ones are used instead.
+#pragma warning(push)
+#pragma warning(disable : 26481) // Don't use pointer arithmetic. Use span instead (bounds.1).
+#pragma warning(disable : 26490) // Don't use reinterpret_cast (type.1).
+#ifdef __AVX2__
+    const auto bias = _mm256_set1_epi16(gsl::narrow_cast<short>(0x8000));
+    const auto c0Limit = _mm256_set1_epi16(0x0020 - 0x8000); // wch < 0x20
+    const auto delLimit = _mm256_set1_epi16(0x007e - 0x8000); // wch > 0x7e
+    const auto c1Limit = _mm256_set1_epi16(0x00a0 - 0x8000); // wch < 0xa0
+    for (; offset + 16 <= string.size(); offset += 16)
+    {
+        const auto chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(string.data() + offset));
+        const auto biased = _mm256_xor_si256(chars, bias);
+        const auto isC0 = _mm256_cmpgt_epi16(c0Limit, biased);
+        const auto isHigh = _mm256_and_si256(_mm256_cmpgt_epi16(biased, delLimit), _mm256_cmpgt_epi16(c1Limit, biased));
+        const auto mask = _mm256_movemask_epi8(_mm256_or_si256(isC0, isHigh));
+        if (mask)
+        {
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            // the mask has two bits per 16-bit lane
+            return offset + index / 2;
+        }
+    }
+#elif _M_AMD64
+    const auto bias = _mm_set1_epi16(gsl::narrow_cast<short>(0x8000));
+    const auto c0Limit = _mm_set1_epi16(0x0020 - 0x8000); // wch < 0x20
+    const auto delLimit = _mm_set1_epi16(0x007e - 0x8000); // wch > 0x7e
+    const auto c1Limit = _mm_set1_epi16(0x00a0 - 0x8000); // wch < 0xa0
+    for (; offset + 8 <= string.size(); offset += 8)
+    {
+        const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(string.data() + offset));
+        const auto biased = _mm_xor_si128(chars, bias);
+        const auto isC0 = _mm_cmplt_epi16(biased, c0Limit);
+        const auto isHigh = _mm_and_si128(_mm_cmpgt_epi16(biased, delLimit), _mm_cmplt_epi16(biased, c1Limit));
+        const auto mask = _mm_movemask_epi8(_mm_or_si128(isC0, isHigh));
+        if (mask)
+        {
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            // the mask has two bits per 16-bit lane
+            return offset + index / 2;
+        }
+    }
+#endif
+#pragma warning(pop)
+
+    // scalar tail (and the whole scan on other architectures)
+    while (offset < string.size() && !_isActionableFromGround(til::at(string, offset)))
+    {
+        ++offset;
+    }
+    return offset;
+}
+
 // Routine Description:
 // - Triggers the Execute action to indicate that the listener should immediately respond to a C0 control character.
 // Arguments:
@@ -447,6 +519,7 @@ void StateMachine::_ActionPrintString(const std::wstring_view string)
 void StateMachine::_ActionEscDispatch(const wchar_t wch) noexcept
 {
     _trace.TraceOnAction(L"EscDispatch");
+    PerfCounters::Instance().sequencesDispatched.fetch_add(1, std::memory_order_relaxed);
     _trace.DispatchSequenceTrace(_SafeExecuteWithLog(wch, [=]() {
         return _engine->ActionEscDispatch(_identifier.Finalize(wch));
     }));
@@ -462,6 +535,7 @@ void StateMachine::_ActionEscDispatch(const wchar_t wch) noexcept
 void StateMachine::_ActionVt52EscDispatch(const wchar_t wch) noexcept
 {
     _trace.TraceOnAction(L"Vt52EscDispatch");
+    PerfCounters::Instance().sequencesDispatched.fetch_add(1, std::memory_order_relaxed);
     _trace.DispatchSequenceTrace(_SafeExecuteWithLog(wch, [=]() {
         return _engine->ActionVt52EscDispatch(_identifier.Finalize(wch), { _parameters.data(), _parameters.size() });
     }));
@@ -477,6 +551,7 @@ void StateMachine::_ActionVt52EscDispatch(const wchar_t wch) noexcept
 void StateMachine::_ActionCsiDispatch(const wchar_t wch) noexcept
 {
     _trace.TraceOnAction(L"CsiDispatch");
+    PerfCounters::Instance().sequencesDispatched.fetch_add(1, std::memory_order_relaxed);
     _trace.DispatchSequenceTrace(_SafeExecuteWithLog(wch, [=]() {
         return _engine->ActionCsiDispatch(_identifier.Finalize(wch), { _parameters.data(), _parameters.size() });
     }));
@@ -622,7 +697,11 @@ void StateMachine::_ActionOscPut(const wchar_t wch)
 {
     _trace.TraceOnAction(L"OscPut");
 
-    _oscString.push_back(wch);
+    // Once we've reached the length cap, additional characters are ignored.
+    if (_oscString.size() < MAX_OSC_STRING_LENGTH)
+    {
+        _oscString.push_back(wch);
+    }
 }
 
 // Routine Description:
@@ -633,10 +712,26 @@ void StateMachine::_ActionOscPut(const wchar_t wch)
 // Return Value:
 // - <none>
 void StateMachine::_ActionOscDispatch(const wchar_t wch) noexcept
+{
+    _ActionOscDispatch(wch, _oscString);
+}
+
+// Routine Description:
+// - As above, but the dispatched string is supplied by the caller. This lets
+//   ProcessString hand the engine a view directly into the source string when
+//   an entire OSC payload arrives in one call, without copying it through
+//   _oscString first.
+// Arguments:
+// - wch - Character to dispatch.
+// - string - The accumulated OSC string to dispatch.
+// Return Value:
+// - <none>
+void StateMachine::_ActionOscDispatch(const wchar_t wch, const std::wstring_view string) noexcept
 {
     _trace.TraceOnAction(L"OscDispatch");
+    PerfCounters::Instance().sequencesDispatched.fetch_add(1, std::memory_order_relaxed);
     _trace.DispatchSequenceTrace(_SafeExecuteWithLog(wch, [=]() {
-        return _engine->ActionOscDispatch(wch, _oscParameter, _oscString);
+        return _engine->ActionOscDispatch(wch, _oscParameter, string);
     }));
 }
 
@@ -650,6 +745,7 @@ void StateMachine::_ActionOscDispatch(const wchar_t wch) noexcept
 void StateMachine::_ActionSs3Dispatch(const wchar_t wch) noexcept
 {
     _trace.TraceOnAction(L"Ss3Dispatch");
+    PerfCounters::Instance().sequencesDispatched.fetch_add(1, std::memory_order_relaxed);
     _trace.DispatchSequenceTrace(_SafeExecuteWithLog(wch, [=]() {
         return _engine->ActionSs3Dispatch(wch, { _parameters.data(), _parameters.size() });
     }));
@@ -665,6 +761,7 @@ void StateMachine::_ActionSs3Dispatch(const wchar_t wch) noexcept
 void StateMachine::_ActionDcsDispatch(const wchar_t wch) noexcept
 {
     _trace.TraceOnAction(L"DcsDispatch");
+    PerfCounters::Instance().sequencesDispatched.fetch_add(1, std::memory_order_relaxed);
 
     const bool success = _SafeExecuteWithLog(wch, [=]() {
         _dcsStringHandler = _engine->ActionDcsDispatch(_identifier.Finalize(wch), { _parameters.data(), _parameters.size() });
@@ -1815,6 +1912,42 @@ bool StateMachine::FlushToTerminal() noexcept
     return success;
 }
 
+// Routine Description:
+// - Consumes a run of OSC string payload characters in bulk rather than
+//   pushing them through the state machine one at a time. If the payload is
+//   terminated by a BEL within the same run, and nothing has been accumulated
+//   from a previous call, the dispatched string is a view directly into the
+//   source - it's never copied into _oscString at all.
+// Arguments:
+// - string - The string currently being processed by ProcessString.
+// - offset - The index of the first unprocessed character.
+// Return Value:
+// - The index of the first character this routine did not consume.
+size_t StateMachine::_ProcessOscPayload(const std::wstring_view string, const size_t offset)
+{
+    // Control characters (including the terminating BEL, ESC, and C1 ST) all
+    // need individual processing, but everything up to the first one of those
+    // is payload, which _findActionableFromGround locates vectorized. (DEL is
+    // a valid payload character, but stopping early on one merely routes it
+    // through _EventOscString as before.)
+    const auto end = _findActionableFromGround(string, offset);
+    const auto payload = string.substr(offset, end - offset);
+
+    if (end < string.size() && _isOscTerminator(til::at(string, end)) && _oscString.empty())
+    {
+        // The entire payload and its terminator arrived in one call: hand the
+        // engine a view of the source string and skip the accumulation.
+        _ActionOscDispatch(til::at(string, end), payload.substr(0, MAX_OSC_STRING_LENGTH));
+        _EnterGround();
+        return end + 1;
+    }
+
+    // Otherwise accumulate the payload (up to the length cap) and let the
+    // character that stopped the scan take the usual one-at-a-time path.
+    _oscString.append(payload.substr(0, MAX_OSC_STRING_LENGTH - std::min(MAX_OSC_STRING_LENGTH, _oscString.size())));
+    return end;
+}
+
 // Routine Description:
 // - Helper for entry to the state machine. Will take an array of characters
 //     and print as many as it can without encountering a character indicating
@@ -1826,6 +1959,15 @@ bool StateMachine::FlushToTerminal() noexcept
 // - <none>
 void StateMachine::ProcessString(const std::wstring_view string)
 {
+    auto& counters = PerfCounters::Instance();
+    counters.bytesIngested.fetch_add(string.size() * sizeof(wchar_t), std::memory_order_relaxed);
+    if (!_isEngineForInput && !string.empty())
+    {
+        // Output arriving while a keystroke is pending is (presumably) its
+        // echo; arm the input-to-present latency sample.
+        counters.NoteOutput();
+    }
+
     size_t start = 0;
     size_t current = start;
 
@@ -1843,6 +1985,24 @@ void StateMachine::ProcessString(const std::wstring_view string)
 
         if (_processingIndividually)
         {
+            // OSC payloads are the one part of a sequence that can be
+            // arbitrarily long, so consume those in bulk instead of one
+            // character at a time.
+            if (_state == VTStates::OscString)
+            {
+                const auto consumed = _ProcessOscPayload(string, current);
+                if (consumed != current)
+                {
+                    current = consumed;
+                    if (_state == VTStates::Ground)
+                    {
+                        _processingIndividually = false;
+                        start = current;
+                    }
+                    continue;
+                }
+            }
+
             // If we're processing characters individually, send it to the state machine.
             ProcessCharacter(til::at(string, current));
             ++current;
@@ -1871,7 +2031,10 @@ void StateMachine::ProcessString(const std::wstring_view string)
             }
             else
             {
-                ++current; // Otherwise, add this char to the current run to be printed.
+                // Otherwise, skip ahead in bulk to the next character that's
+                // actionable from ground (or the end of the string); everything
+                // in between joins the current run to be printed.
+                current = _findActionableFromGround(string, current + 1);
             }
         }
     }
@@ -32,6 +32,12 @@ namespace Microsoft::Console::VirtualTerminal
     // that number.
     constexpr size_t MAX_PARAMETER_COUNT = 32;
 
+    // Most OSC payloads (window titles, color specs) are tiny, but hyperlinks
+    // and OSC 52 clipboard writes can legitimately reach tens of kilobytes.
+    // Anything larger than this is more likely a runaway or malicious string,
+    // so characters beyond the cap are discarded rather than accumulated.
+    constexpr size_t MAX_OSC_STRING_LENGTH = 256 * 1024;
+
     class StateMachine final
     {
 #ifdef UNIT_TESTING
@@ -79,6 +85,7 @@ namespace Microsoft::Console::VirtualTerminal
         void _ActionOscParam(const wchar_t wch) noexcept;
         void _ActionOscPut(const wchar_t wch);
         void _ActionOscDispatch(const wchar_t wch) noexcept;
+        void _ActionOscDispatch(const wchar_t wch, const std::wstring_view string) noexcept;
         void _ActionSs3Dispatch(const wchar_t wch) noexcept;
         void _ActionDcsDispatch(const wchar_t wch) noexcept;
 
@@ -128,6 +135,8 @@ namespace Microsoft::Console::VirtualTerminal
 
         void _AccumulateTo(const wchar_t wch, size_t& value) noexcept;
 
+        size_t _ProcessOscPayload(const std::wstring_view string, const size_t offset);
+
         template<typename TLambda>
         bool _SafeExecute(TLambda&& lambda) noexcept;
         template<typename TLambda>
@@ -179,7 +188,7 @@ namespace Microsoft::Console::VirtualTerminal
         }
 
         VTIDBuilder _identifier;
-        std::vector<VTParameter> _parameters;
+        til::some<VTParameter, MAX_PARAMETER_COUNT> _parameters;
         bool _parameterLimitReached;
 
         std::wstring _oscString;
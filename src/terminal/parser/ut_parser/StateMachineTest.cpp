@@ -35,6 +35,8 @@ public:
         executed.clear();
         csiId = 0;
         csiParams.clear();
+        oscParameter = 0;
+        oscString.clear();
         dcsId = 0;
         dcsParams.clear();
         dcsDataString.clear();
@@ -69,14 +71,16 @@ public:
     bool ActionIgnore() override { return true; };
 
     bool ActionOscDispatch(const wchar_t /* wch */,
-                           const size_t /* parameter */,
-                           const std::wstring_view /* string */) override
+                           const size_t parameter,
+                           const std::wstring_view string) override
     {
         if (pfnFlushToTerminal)
         {
             pfnFlushToTerminal();
             return true;
         }
+        oscParameter = parameter;
+        oscString = string;
         return true;
     };
 
@@ -117,6 +121,10 @@ public:
     uint64_t csiId = 0;
     std::vector<size_t> csiParams;
 
+    // These will only be populated if ActionOscDispatch is called.
+    size_t oscParameter = 0;
+    std::wstring oscString;
+
     // Flush function for pass-through test.
     std::function<bool()> pfnFlushToTerminal;
 
@@ -156,6 +164,9 @@ class Microsoft::Console::VirtualTerminal::StateMachineTest
     TEST_METHOD(BulkTextPrint);
     TEST_METHOD(PassThroughUnhandledSplitAcrossWrites);
 
+    TEST_METHOD(OscStringHandedOffInBulk);
+    TEST_METHOD(OscStringsAreCappedInLength);
+
     TEST_METHOD(DcsDataStringsReceivedByHandler);
 };
 
@@ -275,6 +286,51 @@ void StateMachineTest::PassThroughUnhandledSplitAcrossWrites()
     VERIFY_ARE_EQUAL(L"", engine.printed);
 }
 
+void StateMachineTest::OscStringHandedOffInBulk()
+{
+    auto enginePtr{ std::make_unique<TestStateMachineEngine>() };
+    // this dance is required because StateMachine presumes to take ownership of its engine.
+    auto& engine{ *enginePtr.get() };
+    StateMachine machine{ std::move(enginePtr) };
+
+    // A complete payload in a single write takes the zero-copy path.
+    machine.ProcessString(L"\x1b]0;window title\x07");
+    VERIFY_ARE_EQUAL(0u, engine.oscParameter);
+    VERIFY_ARE_EQUAL(L"window title", engine.oscString);
+
+    engine.ResetTestState();
+
+    // Split across writes, the pieces are accumulated before dispatch.
+    machine.ProcessString(L"\x1b]2;first ");
+    VERIFY_ARE_EQUAL(L"", engine.oscString); // nothing dispatched yet
+    machine.ProcessString(L"second\x1b\\");
+    VERIFY_ARE_EQUAL(2u, engine.oscParameter);
+    VERIFY_ARE_EQUAL(L"first second", engine.oscString);
+}
+
+void StateMachineTest::OscStringsAreCappedInLength()
+{
+    auto enginePtr{ std::make_unique<TestStateMachineEngine>() };
+    // this dance is required because StateMachine presumes to take ownership of its engine.
+    auto& engine{ *enginePtr.get() };
+    StateMachine machine{ std::move(enginePtr) };
+
+    const std::wstring oversized(MAX_OSC_STRING_LENGTH + 50, L'x');
+
+    // A single oversized write is truncated at dispatch.
+    machine.ProcessString(L"\x1b]0;" + oversized + L"\x07");
+    VERIFY_ARE_EQUAL(MAX_OSC_STRING_LENGTH, engine.oscString.size());
+
+    engine.ResetTestState();
+
+    // So is one accumulated across multiple writes.
+    machine.ProcessString(L"\x1b]0;");
+    machine.ProcessString(oversized);
+    machine.ProcessString(oversized);
+    machine.ProcessString(L"\x07");
+    VERIFY_ARE_EQUAL(MAX_OSC_STRING_LENGTH, engine.oscString.size());
+}
+
 void StateMachineTest::DcsDataStringsReceivedByHandler()
 {
     BEGIN_TEST_METHOD_PROPERTIES()
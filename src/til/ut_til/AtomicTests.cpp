@@ -0,0 +1,105 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+
+#include <til/atomic.h>
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+class AtomicTests
+{
+    TEST_CLASS(AtomicTests);
+
+    TEST_METHOD(WaitGroupImmediate)
+    {
+        // A predicate that's already true must not block.
+        til::wait_group group;
+        VERIFY_IS_TRUE(group.wait_until([] { return true; }, 0));
+    }
+
+    TEST_METHOD(WaitGroupTimeout)
+    {
+        til::wait_group group;
+        VERIFY_IS_FALSE(group.wait_until([] { return false; }, 50));
+    }
+
+    TEST_METHOD(WaitGroupAnyOfN)
+    {
+        // The waiter watches two independent flags; setting either one
+        // followed by a notify() must release it.
+        til::wait_group group;
+        std::atomic<bool> first{ false };
+        std::atomic<bool> second{ false };
+
+        std::thread producer{ [&]() {
+            Sleep(20);
+            second.store(true, std::memory_order_release);
+            group.notify();
+        } };
+
+        const auto woken = group.wait_until([&]() {
+            return first.load(std::memory_order_acquire) || second.load(std::memory_order_acquire);
+        });
+
+        producer.join();
+        VERIFY_IS_TRUE(woken);
+        VERIFY_IS_TRUE(second.load());
+    }
+
+    TEST_METHOD(WaitGroupOneNotifyReleasesAll)
+    {
+        til::wait_group group;
+        std::atomic<bool> go{ false };
+        std::atomic<int> released{ 0 };
+
+        std::array<std::thread, 4> consumers;
+        for (auto& consumer : consumers)
+        {
+            consumer = std::thread{ [&]() {
+                if (group.wait_until([&]() { return go.load(std::memory_order_acquire); }, 5000))
+                {
+                    released.fetch_add(1, std::memory_order_relaxed);
+                }
+            } };
+        }
+
+        Sleep(20);
+        go.store(true, std::memory_order_release);
+        group.notify();
+
+        for (auto& consumer : consumers)
+        {
+            consumer.join();
+        }
+
+        VERIFY_ARE_EQUAL(4, released.load());
+    }
+
+    TEST_METHOD(WaitGroupNoLostWakeups)
+    {
+        // Hammer the check-then-wait window: the waiter must always observe
+        // the final value, no matter how the notifies interleave.
+        til::wait_group group;
+        std::atomic<uint32_t> value{ 0 };
+        constexpr uint32_t iterations = 100000;
+
+        std::thread producer{ [&]() {
+            for (uint32_t i = 1; i <= iterations; ++i)
+            {
+                value.store(i, std::memory_order_release);
+                group.notify();
+            }
+        } };
+
+        const auto woken = group.wait_until([&]() {
+            return value.load(std::memory_order_acquire) == iterations;
+        },
+                                            10000);
+
+        producer.join();
+        VERIFY_IS_TRUE(woken);
+    }
+};
@@ -580,6 +580,46 @@ class BitmapTests
         }
     }
 
+    TEST_METHOD(TranslateOutOfBounds)
+    {
+        BEGIN_TEST_METHOD_PROPERTIES()
+            TEST_METHOD_PROPERTY(L"Data:fill", L"{true, false}")
+        END_TEST_METHOD_PROPERTIES()
+
+        bool fill;
+        VERIFY_SUCCEEDED_RETURN(TestData::TryGetValue(L"fill", fill));
+
+        const til::size mapSize{ 4, 4 };
+        til::bitmap map{ mapSize };
+        map.set_all();
+
+        // Any move whose horizontal or vertical magnitude reaches the full
+        // dimension of the map slides every cell out of bounds, so the result
+        // is entirely the fill value.
+        til::bitmap expected{ mapSize };
+        if (fill)
+        {
+            expected.set_all();
+        }
+
+        const til::point deltas[] = {
+            til::point{ 4, 1 }, // off the right edge
+            til::point{ -4, -1 }, // off the left edge
+            til::point{ 1, 4 }, // off the bottom edge
+            til::point{ -1, -4 }, // off the top edge
+            til::point{ -1, 4 }, // off the bottom edge, shifting left
+            til::point{ 1, -4 }, // off the top edge, shifting right
+            til::point{ 5, 5 }, // well past the corner
+        };
+
+        for (const auto& delta : deltas)
+        {
+            auto actual = map;
+            actual.translate(delta, fill);
+            VERIFY_ARE_EQUAL(expected, actual);
+        }
+    }
+
     TEST_METHOD(SetReset)
     {
         const til::size sz{ 4, 4 };
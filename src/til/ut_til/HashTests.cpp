@@ -0,0 +1,118 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+
+#include <til/hash.h>
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+class HashTests
+{
+    TEST_CLASS(HashTests);
+
+    TEST_METHOD(FnvHasherBasic)
+    {
+        til::hasher h1;
+        h1.write(std::string_view{ "hello" });
+        til::hasher h2;
+        h2.write(std::string_view{ "hello" });
+        VERIFY_ARE_EQUAL(h1.finalize(), h2.finalize());
+
+        til::hasher h3;
+        h3.write(std::string_view{ "hellp" });
+        VERIFY_ARE_NOT_EQUAL(h1.finalize(), h3.finalize());
+    }
+
+    TEST_METHOD(BulkHasherBasic)
+    {
+        til::bulk_hasher h1;
+        h1.write(std::wstring_view{ L"the quick brown fox jumps over the lazy dog" }.data(), 43);
+        til::bulk_hasher h2;
+        h2.write(std::wstring_view{ L"the quick brown fox jumps over the lazy dog" }.data(), 43);
+        VERIFY_ARE_EQUAL(h1.finalize(), h2.finalize());
+
+        // A single flipped bit anywhere must change the hash.
+        til::bulk_hasher h3;
+        h3.write(std::wstring_view{ L"the quick brown fox jumps over the lazy doh" }.data(), 43);
+        VERIFY_ARE_NOT_EQUAL(h1.finalize(), h3.finalize());
+
+        // Different seeds must produce different hashes.
+        til::bulk_hasher h4{ 0xbadf00d };
+        h4.write(std::wstring_view{ L"the quick brown fox jumps over the lazy dog" }.data(), 43);
+        VERIFY_ARE_NOT_EQUAL(h1.finalize(), h4.finalize());
+    }
+
+    TEST_METHOD(BulkHasherStreaming)
+    {
+        // Any sequence of writes must hash identically to one big write,
+        // no matter where the input is split relative to the internal
+        // 48-byte block size. This is what incremental row hashing relies on.
+        std::vector<uint8_t> data(513);
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<uint8_t>(i * 131 + 7);
+        }
+
+        til::bulk_hasher reference;
+        reference.write(data.data(), data.size());
+        const auto expected = reference.finalize();
+
+        for (size_t split = 0; split <= data.size(); ++split)
+        {
+            til::bulk_hasher h;
+            h.write(data.data(), split);
+            h.write(data.data() + split, data.size() - split);
+            VERIFY_ARE_EQUAL(expected, h.finalize());
+        }
+
+        // One byte at a time, too.
+        til::bulk_hasher trickle;
+        for (const auto b : data)
+        {
+            trickle.write(&b, 1);
+        }
+        VERIFY_ARE_EQUAL(expected, trickle.finalize());
+    }
+
+    TEST_METHOD(BulkHasherLengthExtension)
+    {
+        // Zero padding in the final block must not collide with genuine
+        // trailing zeros of a different length.
+        const uint8_t zeros[64]{};
+
+        til::bulk_hasher h1;
+        h1.write(&zeros[0], 10);
+        til::bulk_hasher h2;
+        h2.write(&zeros[0], 20);
+        VERIFY_ARE_NOT_EQUAL(h1.finalize(), h2.finalize());
+
+        // The empty input hashes successfully and consistently.
+        til::bulk_hasher e1;
+        til::bulk_hasher e2;
+        VERIFY_ARE_EQUAL(e1.finalize(), e2.finalize());
+        VERIFY_ARE_NOT_EQUAL(e1.finalize(), h1.finalize());
+    }
+
+    TEST_METHOD(BulkHasherDistribution)
+    {
+        // A coarse sanity check rather than a full avalanche test: hashing
+        // every rotation of a repetitive buffer must not collide.
+        std::vector<size_t> hashes;
+        std::vector<uint8_t> data(96, 0xAA);
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = 0xBB;
+            til::bulk_hasher h;
+            h.write(data.data(), data.size());
+            hashes.push_back(h.finalize());
+            data[i] = 0xAA;
+        }
+
+        std::sort(hashes.begin(), hashes.end());
+        VERIFY_ARE_EQUAL(hashes.end(), std::adjacent_find(hashes.begin(), hashes.end()));
+    }
+};
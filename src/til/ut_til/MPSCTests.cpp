@@ -0,0 +1,181 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include "WexTestClass.h"
+
+#include <til/mpsc.h>
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+namespace
+{
+    struct drop_indicator
+    {
+        explicit drop_indicator(int& counter) noexcept :
+            _counter(&counter) {}
+
+        drop_indicator(const drop_indicator&) = delete;
+        drop_indicator& operator=(const drop_indicator&) = delete;
+
+        drop_indicator(drop_indicator&& other) noexcept
+        {
+            _counter = std::exchange(other._counter, nullptr);
+        }
+
+        drop_indicator& operator=(drop_indicator&& other) noexcept
+        {
+            _counter = std::exchange(other._counter, nullptr);
+            return *this;
+        }
+
+        ~drop_indicator()
+        {
+            if (_counter)
+            {
+                ++*_counter;
+            }
+        }
+
+    private:
+        int* _counter = nullptr;
+    };
+
+    template<typename T>
+    void drop(T&& val)
+    {
+        auto _ = std::move(val);
+    }
+}
+
+class MPSCTests
+{
+    BEGIN_TEST_CLASS(MPSCTests)
+        TEST_CLASS_PROPERTY(L"TestTimeout", L"0:0:10") // 10s timeout
+    END_TEST_CLASS()
+
+    TEST_METHOD(SmokeTest);
+    TEST_METHOD(DropTest);
+    TEST_METHOD(DeadSidesTest);
+    TEST_METHOD(IntegrationTest);
+};
+
+void MPSCTests::SmokeTest()
+{
+    // This test mostly ensures that the API wasn't broken.
+
+    // construction
+    auto [tx, rx] = til::mpsc::channel<int>(32);
+    std::array<int, 3> data{};
+
+    // producers are copyable, both sides are movable
+    til::mpsc::producer tx2(tx);
+    til::mpsc::consumer rx2(std::move(rx));
+    tx2 = tx;
+    rx = std::move(rx2);
+
+    // push
+    tx.emplace(0);
+    tx.push(data.begin(), data.end());
+    tx.push(til::mpsc::block_initially, data.begin(), data.end());
+    tx.push(til::mpsc::block_forever, data.begin(), data.end());
+    tx2.push_n(data.begin(), data.size());
+    tx2.push_n(til::mpsc::block_initially, data.begin(), data.size());
+    tx2.push_n(til::mpsc::block_forever, data.begin(), data.size());
+
+    // pop
+    std::optional<int> x = rx.pop();
+    rx.pop_n(til::mpsc::block_initially, data.begin(), data.size());
+    rx.pop_n(til::mpsc::block_forever, data.begin(), data.size());
+}
+
+void MPSCTests::DropTest()
+{
+    auto [tx, rx] = til::mpsc::channel<drop_indicator>(8);
+    int counter = 0;
+
+    for (int i = 0; i < 5; ++i)
+    {
+        tx.emplace(counter);
+    }
+    VERIFY_ARE_EQUAL(counter, 0);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        rx.pop();
+    }
+    VERIFY_ARE_EQUAL(counter, 3);
+
+    // The remaining 2 items are only destroyed once both sides are gone.
+    drop(tx);
+    VERIFY_ARE_EQUAL(counter, 3);
+
+    drop(rx);
+    VERIFY_ARE_EQUAL(counter, 5);
+}
+
+void MPSCTests::DeadSidesTest()
+{
+    {
+        // Once all producers are gone and the channel is drained, pop returns nullopt.
+        auto [tx, rx] = til::mpsc::channel<int>(4);
+        auto tx2 = tx;
+        tx.emplace(11);
+        drop(tx);
+        tx2.emplace(22);
+        drop(tx2);
+
+        VERIFY_ARE_EQUAL(11, rx.pop());
+        VERIFY_ARE_EQUAL(22, rx.pop());
+        VERIFY_IS_FALSE(rx.pop().has_value());
+    }
+    {
+        // Once the consumer is gone, emplace fails.
+        auto [tx, rx] = til::mpsc::channel<int>(4);
+        drop(rx);
+        VERIFY_IS_FALSE(tx.emplace(11));
+    }
+}
+
+void MPSCTests::IntegrationTest()
+{
+    constexpr int producerCount = 4;
+    constexpr int itemsPerProducer = 1000;
+
+    auto [tx, rx] = til::mpsc::channel<std::pair<int, int>>(7);
+
+    std::vector<std::thread> threads;
+    for (int id = 0; id < producerCount; ++id)
+    {
+        threads.emplace_back([id, tx = tx]() {
+            for (int i = 0; i < itemsPerProducer; ++i)
+            {
+                tx.emplace(id, i);
+            }
+        });
+    }
+    // Drop the original handle so that pop() fails once the threads are done.
+    drop(tx);
+
+    // Items from different producers interleave arbitrarily,
+    // but each producer's items must come out in its send order.
+    std::array<int, producerCount> nextExpected{};
+    int received = 0;
+
+    while (const auto item = rx.pop())
+    {
+        const auto [id, i] = *item;
+        VERIFY_ARE_EQUAL(nextExpected[id], i);
+        ++nextExpected[id];
+        ++received;
+    }
+
+    VERIFY_ARE_EQUAL(producerCount * itemsPerProducer, received);
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+}
@@ -0,0 +1,188 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+class PMRTests
+{
+    TEST_CLASS(PMRTests);
+
+    TEST_METHOD(ArenaBasic)
+    {
+        til::pmr::arena_resource arena{ 256 };
+
+        VERIFY_ARE_EQUAL(size_t{ 0 }, arena.bytes_allocated());
+        VERIFY_ARE_EQUAL(size_t{ 0 }, arena.chunk_count());
+
+        const auto a = arena.allocate(16);
+        const auto b = arena.allocate(16);
+        VERIFY_IS_NOT_NULL(a);
+        VERIFY_IS_NOT_NULL(b);
+        VERIFY_ARE_NOT_EQUAL(a, b);
+        VERIFY_ARE_EQUAL(size_t{ 32 }, arena.bytes_allocated());
+        VERIFY_ARE_EQUAL(size_t{ 1 }, arena.chunk_count());
+
+        // Over-aligned requests are honored even though chunks come from the
+        // upstream resource with default alignment.
+        const auto c = arena.allocate(16, 64);
+        VERIFY_ARE_EQUAL(uintptr_t{ 0 }, reinterpret_cast<uintptr_t>(c) % 64);
+
+        // Deallocation is a no-op and must not disturb the statistics.
+        arena.deallocate(a, 16);
+        VERIFY_ARE_EQUAL(size_t{ 48 }, arena.bytes_allocated());
+    }
+
+    TEST_METHOD(ArenaResetRetainsChunks)
+    {
+        til::pmr::arena_resource arena{ 64 };
+
+        // Overflow the first chunk so the arena has to grow.
+        for (auto i = 0; i < 16; ++i)
+        {
+            std::ignore = arena.allocate(32);
+        }
+
+        const auto reserved = arena.bytes_reserved();
+        const auto chunks = arena.chunk_count();
+        VERIFY_IS_GREATER_THAN(chunks, size_t{ 1 });
+
+        // The same workload after a reset must be satisfied entirely from
+        // the retained chunks - this is the per-frame steady state.
+        arena.reset();
+        VERIFY_ARE_EQUAL(size_t{ 0 }, arena.bytes_allocated());
+
+        for (auto i = 0; i < 16; ++i)
+        {
+            std::ignore = arena.allocate(32);
+        }
+
+        VERIFY_ARE_EQUAL(reserved, arena.bytes_reserved());
+        VERIFY_ARE_EQUAL(chunks, arena.chunk_count());
+
+        arena.release();
+        VERIFY_ARE_EQUAL(size_t{ 0 }, arena.bytes_reserved());
+        VERIFY_ARE_EQUAL(size_t{ 0 }, arena.chunk_count());
+    }
+
+    TEST_METHOD(ArenaBacksContainers)
+    {
+        til::pmr::arena_resource arena{ 1024 };
+
+        std::pmr::vector<int> vec{ &arena };
+        for (auto i = 0; i < 100; ++i)
+        {
+            vec.push_back(i);
+        }
+
+        VERIFY_ARE_EQUAL(100u, vec.size());
+        VERIFY_ARE_EQUAL(42, vec.at(42));
+        VERIFY_IS_GREATER_THAN(arena.bytes_allocated(), size_t{ 0 });
+    }
+
+    TEST_METHOD(PoolReusesBlocks)
+    {
+        til::pmr::pool_resource pool{ 32 };
+
+        const auto a = pool.allocate(32);
+        VERIFY_ARE_EQUAL(size_t{ 1 }, pool.blocks_live());
+
+        pool.deallocate(a, 32);
+        VERIFY_ARE_EQUAL(size_t{ 0 }, pool.blocks_live());
+        VERIFY_ARE_EQUAL(size_t{ 1 }, pool.blocks_free());
+
+        // The freed block is handed straight back out.
+        const auto b = pool.allocate(24);
+        VERIFY_ARE_EQUAL(a, b);
+        VERIFY_ARE_EQUAL(size_t{ 0 }, pool.blocks_free());
+        pool.deallocate(b, 24);
+
+        // Requests that don't fit the block size pass through upstream.
+        const auto big = pool.allocate(1024);
+        VERIFY_IS_NOT_NULL(big);
+        VERIFY_ARE_EQUAL(size_t{ 0 }, pool.blocks_live());
+        pool.deallocate(big, 1024);
+    }
+
+    TEST_METHOD(PoolBacksNodeContainers)
+    {
+        til::pmr::pool_resource pool{ 64 };
+
+        {
+            std::pmr::list<int> list{ &pool };
+            for (auto i = 0; i < 50; ++i)
+            {
+                list.push_back(i);
+            }
+            while (!list.empty())
+            {
+                list.pop_front();
+            }
+        }
+
+        VERIFY_ARE_EQUAL(size_t{ 0 }, pool.blocks_live());
+        VERIFY_IS_GREATER_THAN(pool.blocks_free(), size_t{ 0 });
+    }
+
+    TEST_METHOD(GaugeTracksUpstreamBytes)
+    {
+        std::atomic<uint64_t> gauge{ 0 };
+        til::pmr::gauge_resource counted{ gauge };
+
+        const auto a = counted.allocate(128);
+        VERIFY_ARE_EQUAL(uint64_t{ 128 }, gauge.load());
+
+        const auto b = counted.allocate(64);
+        VERIFY_ARE_EQUAL(uint64_t{ 192 }, gauge.load());
+
+        counted.deallocate(a, 128);
+        counted.deallocate(b, 64);
+        VERIFY_ARE_EQUAL(uint64_t{ 0 }, gauge.load());
+
+        // A pool on top of the gauge shows up as the memory it holds from
+        // upstream - freeing a block back to the pool doesn't lower the
+        // gauge, destroying the pool does.
+        {
+            til::pmr::pool_resource pool{ 64, &counted };
+            const auto block = pool.allocate(64);
+            VERIFY_IS_GREATER_THAN(gauge.load(), uint64_t{ 0 });
+
+            pool.deallocate(block, 64);
+            VERIFY_IS_GREATER_THAN(gauge.load(), uint64_t{ 0 });
+        }
+
+        VERIFY_ARE_EQUAL(uint64_t{ 0 }, gauge.load());
+    }
+
+    TEST_METHOD(ScratchArenaScopes)
+    {
+        til::pmr::arena_resource* outerResource = nullptr;
+
+        {
+            til::pmr::scratch_arena outer;
+            outerResource = outer.resource();
+
+            const auto p = outerResource->allocate(128);
+            VERIFY_IS_NOT_NULL(p);
+            VERIFY_ARE_EQUAL(size_t{ 128 }, outerResource->bytes_allocated());
+
+            // A nested scope must not hand out the same arena, or it would
+            // wink out the outer scope's allocations on destruction.
+            {
+                til::pmr::scratch_arena inner;
+                VERIFY_ARE_NOT_EQUAL(outerResource, inner.resource());
+                std::ignore = inner.resource()->allocate(64);
+            }
+
+            VERIFY_ARE_EQUAL(size_t{ 128 }, outerResource->bytes_allocated());
+        }
+
+        // A later scope on this thread gets the shared arena back, rewound.
+        til::pmr::scratch_arena next;
+        VERIFY_ARE_EQUAL(outerResource, next.resource());
+        VERIFY_ARE_EQUAL(size_t{ 0 }, next.resource()->bytes_allocated());
+    }
+};
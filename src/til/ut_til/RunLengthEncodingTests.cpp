@@ -308,7 +308,7 @@ class RunLengthEncodingTests
             std::string_view expected;
         };
 
-        std::array<TestCase, 29> test_cases{
+        std::array<TestCase, 32> test_cases{
             {
                 // empty source
                 { "", 0, 0, "", "" },
@@ -349,6 +349,11 @@ class RunLengthEncodingTests
                 { "1|3 3|2|1 1 1|5 5", 2, 6, "3 3|1", "1|3 3 3|1 1|5 5" }, // middle, within runs
                 { "1|3 3|2|1 1 1|5 5", 1, 6, "1", "1 1 1|5 5" }, // middle, within runs, single run
                 { "1|3 3|2|1 1 1|5 5", 1, 4, "", "1 1 1 1|5 5" }, // middle, within runs, no runs
+
+                // no-op replacements (same value over a single existing run)
+                { "1|3 3|2|1 1 1|5 5", 0, 1, "1", "1|3 3|2|1 1 1|5 5" }, // single cell
+                { "1|3 3|2|1 1 1|5 5", 1, 3, "3 3", "1|3 3|2|1 1 1|5 5" }, // a full run
+                { "1|3 3|2|1 1 1|5 5", 4, 6, "1 1", "1|3 3|2|1 1 1|5 5" }, // part of a run
             }
         };
 
@@ -453,6 +458,18 @@ class RunLengthEncodingTests
         }
     }
 
+    TEST_METHOD(ShrinkToFit)
+    {
+        constexpr std::string_view data{ "133211155" };
+
+        rle_vector rle{ rle_encode(data) };
+        // collapse everything into one run, leaving slack capacity behind
+        rle.replace(0, rle.size(), 1);
+        rle.shrink_to_fit();
+
+        VERIFY_ARE_EQUAL("1 1 1 1 1 1 1 1 1"sv, rle);
+    }
+
     TEST_METHOD(Comparison)
     {
         rle_vector rle1{ { { 1, 1 }, { 3, 2 }, { 2, 1 } } };
@@ -226,6 +226,26 @@ class SomeTests
         VERIFY_ARE_EQUAL(two, s.back());
     }
 
+    TEST_METHOD(MutableAccess)
+    {
+        til::some<int, 2> s;
+        s.push_back(1);
+        s.push_back(2);
+
+        s.front() = 14;
+        s.back() = 28;
+        VERIFY_ARE_EQUAL(14, s.at(0));
+        VERIFY_ARE_EQUAL(28, s.at(1));
+
+        s[0] = 45;
+        s.at(1) = 77;
+        VERIFY_ARE_EQUAL(45, s.front());
+        VERIFY_ARE_EQUAL(77, s.back());
+
+        *s.data() = 99;
+        VERIFY_ARE_EQUAL(99, s[0]);
+    }
+
     TEST_METHOD(Indexing)
     {
         const auto one = 14;
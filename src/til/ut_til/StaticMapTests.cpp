@@ -120,4 +120,86 @@ class StaticMapTests
         VERIFY_THROWS(unused = intIntMap[7], std::runtime_error);
 #pragma warning(pop)
     }
+
+    TEST_METHOD(Perfect)
+    {
+        // Unlike presorted_static_map, the entries don't need to be sorted.
+        static constexpr til::perfect_map intIntMap{
+            std::pair{ 5, 500 },
+            std::pair{ 1, 100 },
+            std::pair{ 3, 300 },
+        };
+
+        VERIFY_ARE_EQUAL(100, intIntMap.at(1));
+        VERIFY_ARE_EQUAL(300, intIntMap.at(3));
+        VERIFY_ARE_EQUAL(500, intIntMap.at(5));
+
+        VERIFY_ARE_NOT_EQUAL(intIntMap.end(), intIntMap.find(5));
+        VERIFY_ARE_EQUAL(intIntMap.end(), intIntMap.find(4));
+
+        int unused{};
+        VERIFY_THROWS(unused = intIntMap.at(0), std::runtime_error);
+        VERIFY_THROWS(unused = intIntMap.at(4), std::runtime_error);
+        VERIFY_THROWS(unused = intIntMap.at(7), std::runtime_error);
+
+#pragma warning(push)
+#pragma warning(disable : 26446) // Suppress bounds.4 check for subscript operator.
+        VERIFY_ARE_EQUAL(500, intIntMap[5]);
+        VERIFY_THROWS(unused = intIntMap[4], std::runtime_error);
+        VERIFY_THROWS(unused = intIntMap[7], std::runtime_error);
+#pragma warning(pop)
+    }
+
+    TEST_METHOD(PerfectExhaustive)
+    {
+        // The same shape as the virtual key tables in terminalInput.cpp:
+        // enough entries to force the hash search through real collisions.
+        static constexpr til::perfect_map intIntMap{
+            std::pair{ 0x08, 800 },
+            std::pair{ 0x09, 900 },
+            std::pair{ 0x13, 1900 },
+            std::pair{ 0x1b, 2700 },
+            std::pair{ 0x21, 3300 },
+            std::pair{ 0x22, 3400 },
+            std::pair{ 0x23, 3500 },
+            std::pair{ 0x24, 3600 },
+            std::pair{ 0x25, 3700 },
+            std::pair{ 0x26, 3800 },
+            std::pair{ 0x27, 3900 },
+            std::pair{ 0x28, 4000 },
+            std::pair{ 0x2d, 4500 },
+            std::pair{ 0x2e, 4600 },
+            std::pair{ 0x70, 11200 },
+            std::pair{ 0x71, 11300 },
+            std::pair{ 0x72, 11400 },
+            std::pair{ 0x73, 11500 },
+            std::pair{ 0x74, 11600 },
+            std::pair{ 0x75, 11700 },
+            std::pair{ 0x76, 11800 },
+            std::pair{ 0x77, 11900 },
+            std::pair{ 0x78, 12000 },
+            std::pair{ 0x79, 12100 },
+            std::pair{ 0x7a, 12200 },
+            std::pair{ 0x7b, 12300 },
+        };
+
+        // Every key maps to its own value, every other vkey-ish value misses.
+        size_t found = 0;
+        for (int key = 0; key < 0x100; ++key)
+        {
+            const auto match = intIntMap.find(key);
+            if (match != intIntMap.end())
+            {
+                VERIFY_ARE_EQUAL(key, match->first);
+                VERIFY_ARE_EQUAL(key * 100, match->second);
+                ++found;
+            }
+            else
+            {
+                int unused{};
+                VERIFY_THROWS(unused = intIntMap.at(key), std::runtime_error);
+            }
+        }
+        VERIFY_ARE_EQUAL(size_t{ 26 }, found);
+    }
 };
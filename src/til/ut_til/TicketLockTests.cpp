@@ -0,0 +1,141 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+
+// Opt into the contention telemetry so the statistics() path is covered.
+#define TIL_TICKET_LOCK_STATISTICS
+#include <til/ticket_lock.h>
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+class TicketLockTests
+{
+    TEST_CLASS(TicketLockTests);
+
+    // Hammers `lock` from several threads; with proper mutual exclusion the
+    // unprotected counter ends up exactly at threads * iterations.
+    template<typename Lock>
+    static void _verifyMutualExclusion(Lock& lock)
+    {
+        constexpr auto threads = 4;
+        constexpr auto iterations = 10000;
+        auto counter = 0;
+
+        std::array<std::thread, threads> workers;
+        for (auto& worker : workers)
+        {
+            worker = std::thread{ [&]() {
+                for (auto i = 0; i < iterations; ++i)
+                {
+                    std::scoped_lock guard{ lock };
+                    ++counter;
+                }
+            } };
+        }
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        VERIFY_ARE_EQUAL(threads * iterations, counter);
+    }
+
+    TEST_METHOD(MutualExclusion)
+    {
+        til::ticket_lock lock;
+        _verifyMutualExclusion(lock);
+    }
+
+    TEST_METHOD(SpacedMutualExclusion)
+    {
+        til::spaced_ticket_lock lock;
+        _verifyMutualExclusion(lock);
+    }
+
+    TEST_METHOD(Fairness)
+    {
+        // Tickets are handed out in FIFO order: with the lock held, a queued
+        // waiter must get it before a later arrival.
+        til::spaced_ticket_lock lock;
+        std::atomic<int> order{ 0 };
+        int first = 0;
+        int second = 0;
+
+        lock.lock();
+
+        std::thread early{ [&]() {
+            lock.lock();
+            first = order.fetch_add(1) + 1;
+            lock.unlock();
+        } };
+        Sleep(50); // let `early` queue up behind us
+
+        std::thread late{ [&]() {
+            lock.lock();
+            second = order.fetch_add(1) + 1;
+            lock.unlock();
+        } };
+        Sleep(50);
+
+        lock.unlock();
+        early.join();
+        late.join();
+
+        VERIFY_ARE_EQUAL(1, first);
+        VERIFY_ARE_EQUAL(2, second);
+    }
+
+    TEST_METHOD(Statistics)
+    {
+        til::ticket_lock lock;
+
+        // Uncontended: acquisitions tick up, nothing else should.
+        for (auto i = 0; i < 3; ++i)
+        {
+            std::scoped_lock guard{ lock };
+        }
+
+        auto stats = lock.statistics();
+        VERIFY_ARE_EQUAL(3u, stats.acquisitions);
+        VERIFY_ARE_EQUAL(0u, stats.contended);
+
+        // Force contention: a thread blocks on the held lock.
+        lock.lock();
+        std::thread waiter{ [&]() {
+            std::scoped_lock guard{ lock };
+        } };
+        Sleep(50);
+        lock.unlock();
+        waiter.join();
+
+        stats = lock.statistics();
+        VERIFY_ARE_EQUAL(5u, stats.acquisitions);
+        VERIFY_IS_GREATER_THAN_OR_EQUAL(stats.contended, 1u);
+        // The lock was held across a 50ms sleep; the hold time must reflect it.
+        VERIFY_IS_GREATER_THAN(stats.hold_time_qpc, 0u);
+    }
+
+    TEST_METHOD(SpacedStatistics)
+    {
+        til::spaced_ticket_lock lock;
+
+        lock.lock();
+        std::thread waiter{ [&]() {
+            std::scoped_lock guard{ lock };
+        } };
+        Sleep(50);
+        lock.unlock();
+        waiter.join();
+
+        const auto stats = lock.statistics();
+        VERIFY_ARE_EQUAL(2u, stats.acquisitions);
+        VERIFY_IS_GREATER_THAN_OR_EQUAL(stats.contended, 1u);
+        // The waiter was next in line, so it must have taken the spin path.
+        VERIFY_IS_GREATER_THAN(stats.spins, 0u);
+        VERIFY_IS_GREATER_THAN(stats.hold_time_qpc, 0u);
+    }
+};
@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+
+#include "til/scratch_buffer.h"
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+class ScratchBufferTests
+{
+    BEGIN_TEST_CLASS(ScratchBufferTests)
+        TEST_CLASS_PROPERTY(L"TestTimeout", L"0:0:10") // 10s timeout
+    END_TEST_CLASS()
+
+    TEST_METHOD(ClearedButCapacityPersists)
+    {
+        auto& buffer = til::scratch_buffer<std::wstring>::get();
+        buffer.assign(512, L'x');
+        const auto capacity = buffer.capacity();
+
+        auto& again = til::scratch_buffer<std::wstring>::get();
+        VERIFY_ARE_EQUAL(&buffer, &again);
+        VERIFY_IS_TRUE(again.empty());
+        VERIFY_IS_GREATER_THAN_OR_EQUAL(again.capacity(), capacity);
+    }
+
+    TEST_METHOD(DistinctPerContainerType)
+    {
+        auto& narrow = til::scratch_buffer<std::string>::get();
+        auto& wide = til::scratch_buffer<std::wstring>::get();
+        narrow.assign("narrow");
+        wide.assign(L"wide");
+        VERIFY_ARE_EQUAL("narrow", narrow);
+        VERIFY_ARE_EQUAL(L"wide", wide);
+    }
+
+    TEST_METHOD(TrimsBackToHighWaterMark)
+    {
+        // One outsized use followed by many small ones should eventually give
+        // the excess capacity back.
+        auto& buffer = til::scratch_buffer<std::vector<char>>::get();
+        buffer.resize(1024 * 1024);
+        const auto inflated = buffer.capacity();
+
+        for (auto i = 0; i < 1024; ++i)
+        {
+            auto& small = til::scratch_buffer<std::vector<char>>::get();
+            small.resize(16);
+        }
+
+        VERIFY_IS_LESS_THAN(til::scratch_buffer<std::vector<char>>::get().capacity(), inflated);
+    }
+};
@@ -13,6 +13,7 @@ class Utf8Utf16ConvertTests
     TEST_CLASS(Utf8Utf16ConvertTests);
 
     TEST_METHOD(TestU8ToU16);
+    TEST_METHOD(TestU8ToU16Ascii);
     TEST_METHOD(TestU16ToU8);
     TEST_METHOD(TestU8ToU16Partials);
     TEST_METHOD(TestU16ToU8Partials);
@@ -48,6 +49,39 @@ void Utf8Utf16ConvertTests::TestU8ToU16()
     VERIFY_ARE_EQUAL(u16StringComp, u16Out);
 }
 
+void Utf8Utf16ConvertTests::TestU8ToU16Ascii()
+{
+    // long enough to exercise the eight-bytes-at-a-time ASCII shortcut
+    const std::string u8Ascii{ "The quick brown fox jumps over the lazy dog" };
+    const std::wstring u16AsciiComp{ L"The quick brown fox jumps over the lazy dog" };
+
+    std::wstring u16Out1{};
+    VERIFY_SUCCEEDED(til::u8u16(u8Ascii, u16Out1));
+    VERIFY_ARE_EQUAL(u16AsciiComp, u16Out1);
+
+    // an ASCII prefix followed by multi-byte sequences takes the mixed path
+    const std::string u8Mixed{ u8Ascii + "\xE2\x82\xAC\x7E" }; // EURO SIGN, TILDE
+    const std::wstring u16MixedComp{ u16AsciiComp + L"\x20ac\x7e" };
+
+    std::wstring u16Out2{};
+    VERIFY_SUCCEEDED(til::u8u16(u8Mixed, u16Out2));
+    VERIFY_ARE_EQUAL(u16MixedComp, u16Out2);
+
+    // with state, an ASCII run ending in a partial code point still caches it
+    til::u8state state{};
+
+    const std::string u8Chunk1{ u8Ascii + "\xE2\x82" }; // EURO SIGN (first two bytes)
+    const std::string u8Chunk2{ "\xACjumps again" }; // EURO SIGN (last byte), more ASCII
+
+    std::wstring u16Out3{};
+    VERIFY_SUCCEEDED(til::u8u16(u8Chunk1, u16Out3, state));
+    VERIFY_ARE_EQUAL(u16AsciiComp, u16Out3);
+
+    std::wstring u16Out4{};
+    VERIFY_SUCCEEDED(til::u8u16(u8Chunk2, u16Out4, state));
+    VERIFY_ARE_EQUAL(std::wstring{ L"\x20ac" } + L"jumps again", u16Out4);
+}
+
 void Utf8Utf16ConvertTests::TestU16ToU8()
 {
     const std::wstring u16String{
@@ -13,6 +13,13 @@
 
 #include "U8U16Test.hpp"
 
+// til::u8u16 and its prerequisites, so the shipped converter (including its
+// ASCII fast path) can be measured alongside the test algorithms above.
+#include <wil/Result.h>
+#include <gsl/gsl>
+#include <base/numerics/safe_math.h>
+#include <til/u8u16convert.h>
+
 typedef NTSTATUS(WINAPI* t_RtlUTF8ToUnicodeN)(PWSTR, ULONG, PULONG, PCCH, ULONG);
 typedef NTSTATUS(WINAPI* t_RtlUnicodeToUTF8N)(PCHAR, ULONG, PULONG, PCWSTR, ULONG);
 NTSTATUS(WINAPI* p_RtlUTF8ToUnicodeN)
@@ -330,6 +337,42 @@ void u8u16_ptr_Chunks(std::string_view u8Str, size_t u8CharLen, size_t u16ChunkL
               << "\n HRESULT " << hRes << "\n length " << length << "\n elapsed " << duration << std::endl;
 }
 
+void til_u8u16_WholeString(std::string_view u8Str)
+{
+    PrintHeader(__func__);
+    GetDuration();
+    std::wstring u16Str{};
+    const HRESULT hRes = til::u8u16(u8Str, u16Str);
+    const double duration = GetDuration();
+    const wchar_t randElem16 = u16Str.at(RandomIndex(static_cast<ptrdiff_t>(u16Str.length())));
+    std::cout << " ignore me " << static_cast<int>(randElem16)
+              << "\n HRESULT " << hRes << "\n length " << u16Str.length() << "\n elapsed " << duration << std::endl;
+}
+
+void til_u8u16_Chunks(std::string_view u8Str, size_t u8ChunkLen)
+{
+    PrintHeader(__func__);
+    const size_t endLoop{ u8Str.length() / u8ChunkLen };
+    double duration{};
+    size_t length{};
+    HRESULT hRes{};
+    til::u8state state{};
+    std::wstring u16Str{};
+
+    for (size_t i{}; i < endLoop; ++i)
+    {
+        const std::string_view sv{ &u8Str.at(i * u8ChunkLen), u8ChunkLen };
+        GetDuration();
+        hRes = til::u8u16(sv, u16Str, state);
+        duration += GetDuration();
+        length += u16Str.length();
+    }
+
+    const wchar_t randElem16 = u16Str.at(RandomIndex(static_cast<ptrdiff_t>(u16Str.length())));
+    std::cout << " ignore me " << static_cast<int>(randElem16)
+              << "\n HRESULT " << hRes << "\n length " << length << "\n elapsed " << duration << std::endl;
+}
+
 void CompNaturalLang_WholeString(const std::string& fileName)
 {
     std::string head{ __func__ };
@@ -506,6 +549,16 @@ int main()
     RtlUTF8ToUnicodeN_Chunks(u8Str, u8CharLen, chunkLen);
     u8u16_Chunks(u8Str, u8CharLen, chunkLen);
     u8u16_ptr_Chunks(u8Str, u8CharLen, chunkLen);
+    til_u8u16_WholeString(u8Str);
+    til_u8u16_Chunks(u8Str, u8ChunkLen);
+
+    std::cout << "\n\n### UTF-8 To UTF-16, ASCII only ###" << std::endl;
+
+    const std::string u8Ascii(u8Str.length(), '~');
+    MultiByteToWideChar_WholeString(u8Ascii);
+    RtlUTF8ToUnicodeN_WholeString(u8Ascii);
+    til_u8u16_WholeString(u8Ascii);
+    til_u8u16_Chunks(u8Ascii, u8ChunkLen);
 
     std::cout << "\n\n### Natural Languages ###" << std::endl;
 
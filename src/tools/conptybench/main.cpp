@@ -0,0 +1,557 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+// ConptyBench: an end-to-end throughput and latency harness for ConPTY.
+//
+// VtBench measures the parser in isolation; nothing in the tree measures the
+// whole conhost -> ConPTY -> terminal pipeline, so every release we rebuild
+// ad-hoc harnesses to answer "did conpty get slower". This tool spawns a
+// pseudoconsole with CreatePseudoConsole, re-launches itself inside it as a
+// corpus generator (sequential numbers a la `seq`, SGR-heavy colored text,
+// and a vim-style scroll-region workload), drains the conpty output pipe,
+// and reports bytes/s and frames emitted for each corpus. A final echo pass
+// measures input-echo round-trip latency percentiles (p50/p90/p99) by
+// writing single characters to the input pipe and timing their appearance
+// in the output stream.
+//
+// Frames are counted by occurrences of the cursor-show sequence (^[[?25h);
+// conpty re-shows the cursor at the end of every frame it paints, so this is
+// a stable proxy for "frames emitted" as long as the client leaves the
+// cursor visible (all of our generators do).
+
+#include <windows.h>
+
+#include <algorithm>
+#include "../../inc/ConptyCapture.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr COORD defaultSize{ 80, 32 };
+    constexpr int latencySamples = 200;
+    constexpr std::string_view frameMarker{ "\x1b[?25h" };
+
+    // The characters we bounce off the echo client for the latency
+    // measurement. None of these appear in the control sequences conpty
+    // emits, so the first occurrence of one in the output stream after we
+    // send it is its echo.
+    constexpr std::string_view latencyProbes{ "#%*+=@" };
+
+    [[noreturn]] void fail(const char* message)
+    {
+        fprintf(stderr, "conptybench: %s (gle=%lu)\n", message, GetLastError());
+        exit(1);
+    }
+
+    // ------------------------------------------------------------------------
+    // Client side: these run *inside* the pseudoconsole, writing to the
+    // handles conhost gave us. Everything is plain bytes through WriteFile;
+    // conhost does the parsing and conpty does the re-rendering we measure.
+
+    void clientWrite(const std::string& data)
+    {
+        const auto out = GetStdHandle(STD_OUTPUT_HANDLE);
+        DWORD written = 0;
+        if (!WriteFile(out, data.data(), static_cast<DWORD>(data.size()), &written, nullptr))
+        {
+            fail("client WriteFile failed");
+        }
+    }
+
+    // Sequential numbers, one per line - the classic `seq 1 N` smoke test.
+    // Exercises the scrolling path with short, unstyled lines.
+    void clientSeq()
+    {
+        std::string data;
+        data.reserve(1024 * 1024);
+        for (int i = 1; i <= 100000; i++)
+        {
+            data.append(std::to_string(i));
+            data.append("\r\n");
+            if (data.size() >= 64 * 1024)
+            {
+                clientWrite(data);
+                data.clear();
+            }
+        }
+        clientWrite(data);
+    }
+
+    // Full-width lines where every cell changes color - the vtebench
+    // "heavy SGR" shape. Exercises attribute runs and the renderer's SGR
+    // diffing rather than raw text throughput.
+    void clientSgr()
+    {
+        std::string data;
+        data.reserve(1024 * 1024);
+        for (int line = 0; line < 2000; line++)
+        {
+            for (int col = 0; col < defaultSize.X; col++)
+            {
+                char cell[32];
+                sprintf_s(cell, "\x1b[38;5;%dmX", (line + col) % 256);
+                data.append(cell);
+            }
+            data.append("\x1b[m\r\n");
+            if (data.size() >= 64 * 1024)
+            {
+                clientWrite(data);
+                data.clear();
+            }
+        }
+        clientWrite(data);
+    }
+
+    // A vim-style workload: a fixed status line at the bottom, a scroll
+    // region above it, and repeated scrolling of that region with new text
+    // at its bottom edge. This is the shape that page-down in an editor or
+    // pager produces, and the one region-scroll passthrough is meant to
+    // keep cheap.
+    void clientScrollRegion()
+    {
+        char seq[64];
+        std::string data;
+        data.reserve(1024 * 1024);
+
+        // Establish the layout: clear, status line, margins over the rest.
+        data.append("\x1b[2J\x1b[H");
+        sprintf_s(seq, "\x1b[%d;1H\x1b[7m status line \x1b[m", defaultSize.Y);
+        data.append(seq);
+        sprintf_s(seq, "\x1b[1;%dr", defaultSize.Y - 1);
+        data.append(seq);
+
+        for (int i = 0; i < 20000; i++)
+        {
+            // Scroll the region up one line and write the revealed row.
+            sprintf_s(seq, "\x1b[%d;1H", defaultSize.Y - 1);
+            data.append(seq);
+            data.append("\x1b[S");
+            sprintf_s(seq, "line %d: the quick brown fox jumps over the lazy dog", i);
+            data.append(seq);
+            if (data.size() >= 64 * 1024)
+            {
+                clientWrite(data);
+                data.clear();
+            }
+        }
+        data.append("\x1b[r");
+        clientWrite(data);
+    }
+
+    // Plays back a capture recorded with CONPTY_CAPTURE_DIR (see
+    // ConptyCapture.h): output frames are written to stdout at the recorded
+    // cadence, or flat out with --max-speed. Input frames are skipped - the
+    // capture's output stream already reflects what the user's typing caused
+    // the client to produce. This turns a customer's captured workload into
+    // a repeatable corpus for the pipeline measurement below.
+    void clientReplay(const wchar_t* path, bool maxSpeed)
+    {
+        using Microsoft::Console::ConptyCapture;
+
+        const auto file = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            fail("replay: could not open capture file");
+        }
+
+        char magic[sizeof(ConptyCapture::FileMagic)];
+        DWORD read = 0;
+        if (!ReadFile(file, magic, sizeof(magic), &read, nullptr) || read != sizeof(magic) ||
+            memcmp(magic, ConptyCapture::FileMagic, sizeof(magic)) != 0)
+        {
+            fail("replay: not a conpty capture file");
+        }
+
+        const auto out = GetStdHandle(STD_OUTPUT_HANDLE);
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<char> payload;
+        for (;;)
+        {
+            ConptyCapture::FrameHeader header;
+            if (!ReadFile(file, &header, sizeof(header), &read, nullptr) || read != sizeof(header))
+            {
+                break;
+            }
+            payload.resize(header.size);
+            if (!ReadFile(file, payload.data(), header.size, &read, nullptr) || read != header.size)
+            {
+                break;
+            }
+            if (header.direction != static_cast<uint8_t>(ConptyCapture::Direction::Output))
+            {
+                continue;
+            }
+            if (!maxSpeed)
+            {
+                std::this_thread::sleep_until(start + std::chrono::nanoseconds(header.timestampNs));
+            }
+            DWORD written = 0;
+            WriteFile(out, payload.data(), header.size, &written, nullptr);
+        }
+        CloseHandle(file);
+    }
+
+    // Echo client for the latency pass: raw-read single characters from the
+    // console input and print them straight back. Exits on 'q'.
+    void clientEcho()
+    {
+        const auto in = GetStdHandle(STD_INPUT_HANDLE);
+        DWORD mode = 0;
+        GetConsoleMode(in, &mode);
+        SetConsoleMode(in, mode & ~(ENABLE_LINE_INPUT | ENABLE_ECHO_INPUT | ENABLE_PROCESSED_INPUT));
+
+        for (;;)
+        {
+            char ch = 0;
+            DWORD read = 0;
+            if (!ReadFile(in, &ch, 1, &read, nullptr) || read == 0)
+            {
+                return;
+            }
+            if (ch == 'q')
+            {
+                return;
+            }
+            DWORD written = 0;
+            WriteFile(GetStdHandle(STD_OUTPUT_HANDLE), &ch, 1, &written, nullptr);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Host side.
+
+    // Creates the pipe pair and the pseudoconsole over it, the same way
+    // vtpipeterm's VtConsole does.
+    HRESULT createPseudoConsoleAndHandles(COORD size,
+                                          _Out_ HANDLE* phInput,
+                                          _Out_ HANDLE* phOutput,
+                                          _Out_ HPCON* phPC)
+    {
+        HANDLE outPipeOurSide = nullptr;
+        HANDLE inPipeOurSide = nullptr;
+        HANDLE outPipePseudoConsoleSide = nullptr;
+        HANDLE inPipePseudoConsoleSide = nullptr;
+
+        if (!CreatePipe(&inPipePseudoConsoleSide, &inPipeOurSide, nullptr, 0))
+        {
+            return HRESULT_FROM_WIN32(GetLastError());
+        }
+        if (!CreatePipe(&outPipeOurSide, &outPipePseudoConsoleSide, nullptr, 0))
+        {
+            CloseHandle(inPipeOurSide);
+            CloseHandle(inPipePseudoConsoleSide);
+            return HRESULT_FROM_WIN32(GetLastError());
+        }
+
+        const auto hr = CreatePseudoConsole(size, inPipePseudoConsoleSide, outPipePseudoConsoleSide, 0, phPC);
+        CloseHandle(inPipePseudoConsoleSide);
+        CloseHandle(outPipePseudoConsoleSide);
+        if (FAILED(hr))
+        {
+            CloseHandle(inPipeOurSide);
+            CloseHandle(outPipeOurSide);
+            return hr;
+        }
+
+        *phInput = inPipeOurSide;
+        *phOutput = outPipeOurSide;
+        return S_OK;
+    }
+
+    // Launches this same executable inside the given pseudoconsole with
+    // `--client <corpus>` so the generator runs as a real console client.
+    PROCESS_INFORMATION spawnClient(HPCON hPC, const std::wstring& corpus)
+    {
+        wchar_t modulePath[MAX_PATH];
+        if (!GetModuleFileNameW(nullptr, modulePath, MAX_PATH))
+        {
+            fail("GetModuleFileNameW failed");
+        }
+
+        std::wstring cmdline = L"\"";
+        cmdline += modulePath;
+        cmdline += L"\" --client ";
+        cmdline += corpus;
+
+        STARTUPINFOEXW siEx{};
+        siEx.StartupInfo.cb = sizeof(STARTUPINFOEXW);
+
+        SIZE_T attrListSize = 0;
+        InitializeProcThreadAttributeList(nullptr, 1, 0, &attrListSize);
+        std::vector<BYTE> attrListBuffer(attrListSize);
+        siEx.lpAttributeList = reinterpret_cast<LPPROC_THREAD_ATTRIBUTE_LIST>(attrListBuffer.data());
+        if (!InitializeProcThreadAttributeList(siEx.lpAttributeList, 1, 0, &attrListSize))
+        {
+            fail("InitializeProcThreadAttributeList failed");
+        }
+        if (!UpdateProcThreadAttribute(siEx.lpAttributeList,
+                                       0,
+                                       PROC_THREAD_ATTRIBUTE_PSEUDOCONSOLE,
+                                       hPC,
+                                       sizeof(HPCON),
+                                       nullptr,
+                                       nullptr))
+        {
+            fail("UpdateProcThreadAttribute failed");
+        }
+
+        PROCESS_INFORMATION pi{};
+        if (!CreateProcessW(nullptr,
+                            cmdline.data(),
+                            nullptr,
+                            nullptr,
+                            FALSE,
+                            EXTENDED_STARTUPINFO_PRESENT,
+                            nullptr,
+                            nullptr,
+                            &siEx.StartupInfo,
+                            &pi))
+        {
+            fail("CreateProcessW failed");
+        }
+        DeleteProcThreadAttributeList(siEx.lpAttributeList);
+        return pi;
+    }
+
+    // Drains the conpty output pipe until it closes, counting bytes and
+    // frame markers. In latency mode it additionally watches for the current
+    // probe character and timestamps its arrival.
+    struct OutputDrain
+    {
+        HANDLE pipe = nullptr;
+
+        std::atomic<uint64_t> bytes{ 0 };
+        std::atomic<uint64_t> frames{ 0 };
+
+        std::atomic<char> probe{ 0 };
+        std::mutex mutex;
+        std::condition_variable probeSeen;
+        std::chrono::steady_clock::time_point probeTime;
+
+        std::thread thread;
+
+        void start()
+        {
+            thread = std::thread([this]() { _run(); });
+        }
+
+        void join()
+        {
+            thread.join();
+        }
+
+    private:
+        void _run()
+        {
+            std::vector<char> buffer(64 * 1024);
+            // Carry the tail of the previous read so a frame marker split
+            // across two reads is still counted.
+            std::string carry;
+            for (;;)
+            {
+                DWORD read = 0;
+                if (!ReadFile(pipe, buffer.data(), static_cast<DWORD>(buffer.size()), &read, nullptr) || read == 0)
+                {
+                    return;
+                }
+                bytes += read;
+
+                const auto expected = probe.load(std::memory_order_acquire);
+                if (expected != 0 &&
+                    memchr(buffer.data(), expected, read) != nullptr)
+                {
+                    std::lock_guard<std::mutex> lock{ mutex };
+                    probeTime = std::chrono::steady_clock::now();
+                    probe.store(0, std::memory_order_release);
+                    probeSeen.notify_one();
+                }
+
+                carry.append(buffer.data(), read);
+                size_t pos = 0;
+                while ((pos = carry.find(frameMarker, pos)) != std::string::npos)
+                {
+                    frames++;
+                    pos += frameMarker.size();
+                }
+                // Keep just enough to complete a marker straddling the edge.
+                if (carry.size() > frameMarker.size())
+                {
+                    carry.erase(0, carry.size() - frameMarker.size());
+                }
+            }
+        }
+    };
+
+    struct PtySession
+    {
+        HPCON hPC = nullptr;
+        HANDLE input = nullptr;
+        HANDLE output = nullptr;
+        PROCESS_INFORMATION pi{};
+        OutputDrain drain;
+
+        void open(const std::wstring& corpus)
+        {
+            if (FAILED(createPseudoConsoleAndHandles(defaultSize, &input, &output, &hPC)))
+            {
+                fail("CreatePseudoConsole failed");
+            }
+            pi = spawnClient(hPC, corpus);
+            drain.pipe = output;
+            drain.start();
+        }
+
+        void close()
+        {
+            WaitForSingleObject(pi.hProcess, INFINITE);
+            // Closing the pseudoconsole hangs up the output pipe, which
+            // unblocks the drain thread's final ReadFile.
+            ClosePseudoConsole(hPC);
+            drain.join();
+            CloseHandle(pi.hProcess);
+            CloseHandle(pi.hThread);
+            CloseHandle(input);
+            CloseHandle(output);
+        }
+    };
+
+    void runCorpus(const wchar_t* label, const std::wstring& clientArgs)
+    {
+        PtySession session;
+        const auto start = std::chrono::steady_clock::now();
+        session.open(clientArgs);
+        session.close();
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        const auto bytes = session.drain.bytes.load();
+        const auto frames = session.drain.frames.load();
+        printf("%-14ls %10llu bytes  %8.2f MB/s  %6llu frames  %8.1f frames/s\n",
+               label,
+               static_cast<unsigned long long>(bytes),
+               bytes / (1024.0 * 1024.0) / elapsed,
+               static_cast<unsigned long long>(frames),
+               frames / elapsed);
+    }
+
+    void runThroughputCorpus(const wchar_t* name)
+    {
+        runCorpus(name, name);
+    }
+
+    void runReplayCorpus(const wchar_t* path, bool maxSpeed)
+    {
+        std::wstring clientArgs = L"replay \"";
+        clientArgs += path;
+        clientArgs += L"\"";
+        if (maxSpeed)
+        {
+            clientArgs += L" --max-speed";
+        }
+        runCorpus(maxSpeed ? L"replay (max)" : L"replay", clientArgs);
+    }
+
+    void runLatencyCorpus()
+    {
+        PtySession session;
+        session.open(L"echo");
+
+        // Let the client start up and the first frame settle before timing.
+        Sleep(250);
+
+        std::vector<double> samples;
+        samples.reserve(latencySamples);
+        for (int i = 0; i < latencySamples; i++)
+        {
+            const char probe = latencyProbes[i % latencyProbes.size()];
+            std::unique_lock<std::mutex> lock{ session.drain.mutex };
+            session.drain.probe.store(probe, std::memory_order_release);
+
+            const auto sent = std::chrono::steady_clock::now();
+            DWORD written = 0;
+            WriteFile(session.input, &probe, 1, &written, nullptr);
+
+            if (!session.drain.probeSeen.wait_for(lock, std::chrono::seconds(5), [&]() {
+                    return session.drain.probe.load(std::memory_order_acquire) == 0;
+                }))
+            {
+                fail("echo round trip timed out");
+            }
+            samples.push_back(std::chrono::duration<double, std::micro>(session.drain.probeTime - sent).count());
+        }
+
+        const char quit = 'q';
+        DWORD written = 0;
+        WriteFile(session.input, &quit, 1, &written, nullptr);
+        session.close();
+
+        std::sort(samples.begin(), samples.end());
+        const auto percentile = [&](double p) {
+            return samples[std::min(samples.size() - 1, static_cast<size_t>(p * samples.size()))];
+        };
+        printf("%-14ls p50 %7.1f us  p90 %7.1f us  p99 %7.1f us  (%d round trips)\n",
+               L"echo latency",
+               percentile(0.50),
+               percentile(0.90),
+               percentile(0.99),
+               latencySamples);
+    }
+}
+
+int __cdecl wmain(int argc, wchar_t* argv[])
+{
+    if (argc >= 3 && wcscmp(argv[1], L"--client") == 0)
+    {
+        const std::wstring corpus{ argv[2] };
+        if (corpus == L"seq")
+        {
+            clientSeq();
+        }
+        else if (corpus == L"sgr")
+        {
+            clientSgr();
+        }
+        else if (corpus == L"scrollregion")
+        {
+            clientScrollRegion();
+        }
+        else if (corpus == L"echo")
+        {
+            clientEcho();
+        }
+        else if (corpus == L"replay" && argc >= 4)
+        {
+            const bool maxSpeed = argc >= 5 && wcscmp(argv[4], L"--max-speed") == 0;
+            clientReplay(argv[3], maxSpeed);
+        }
+        else
+        {
+            return 1;
+        }
+        return 0;
+    }
+
+    if (argc >= 3 && wcscmp(argv[1], L"replay") == 0)
+    {
+        const bool maxSpeed = argc >= 4 && wcscmp(argv[3], L"--max-speed") == 0;
+        printf("conptybench: %dx%d pseudoconsole, replaying %ls\n\n", defaultSize.X, defaultSize.Y, argv[2]);
+        runReplayCorpus(argv[2], maxSpeed);
+        return 0;
+    }
+
+    printf("conptybench: %dx%d pseudoconsole\n\n", defaultSize.X, defaultSize.Y);
+    runThroughputCorpus(L"seq");
+    runThroughputCorpus(L"sgr");
+    runThroughputCorpus(L"scrollregion");
+    runLatencyCorpus();
+    return 0;
+}
@@ -0,0 +1,292 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+// TilBench: core-pinned microbenchmarks for til primitives.
+//
+// ut_til verifies that the til containers and codecs are correct; nothing in
+// the tree measures whether a change to them is faster. This tool times the
+// hot primitives - rle replacement, bitmap run extraction, spsc hand-off,
+// hashing and UTF-8 <-> UTF-16 conversion - on a pinned core with
+// serializing timestamps, and emits the results as JSON (stdout) alongside a
+// human-readable table (stderr), so container changes can be demonstrated
+// and guarded numerically in-repo.
+//
+// Methodology: the measuring thread is pinned to the first core and raised
+// to THREAD_PRIORITY_HIGHEST. Every sample is bracketed by serializing
+// timestamps (CPUID on x86/x64, ISB on ARM64, then QueryPerformanceCounter)
+// so out-of-order execution can't leak benchmark work across the timing
+// boundary. The batch size is grown until one sample spans at least 10ms,
+// then the fastest of ten samples is reported - on a quiet, pinned core the
+// minimum is the estimator least polluted by interrupts and scheduling.
+
+#include <windows.h>
+#include <intrin.h>
+
+#include "LibraryIncludes.h"
+
+#include "til.h"
+#include <til/hash.h>
+#include <til/spsc.h>
+
+namespace
+{
+    // Results accumulate here so main() can emit one valid JSON array.
+    struct BenchResult
+    {
+        std::string name;
+        uint64_t iterations;
+        double nsPerOp;
+        double opsPerSec;
+    };
+
+    std::vector<BenchResult> g_results;
+
+    // Consumed by every benchmark body to keep the optimizer from deleting
+    // the measured work. Printed (to stderr) at exit so it's genuinely live.
+    volatile uint64_t g_sink = 0;
+
+    [[nodiscard]] uint64_t qpcFrequency() noexcept
+    {
+        LARGE_INTEGER li;
+        QueryPerformanceFrequency(&li);
+        return static_cast<uint64_t>(li.QuadPart);
+    }
+
+    // A serializing timestamp: drain the pipeline first so that previously
+    // issued benchmark work can't retire inside (or outside) the measured
+    // window.
+    [[nodiscard]] uint64_t serializedQpc() noexcept
+    {
+#if defined(_M_X64) || defined(_M_IX86)
+        int regs[4];
+        __cpuid(regs, 0);
+#elif defined(_M_ARM64)
+        __isb(_ARM64_BARRIER_SY);
+#endif
+        LARGE_INTEGER li;
+        QueryPerformanceCounter(&li);
+        return static_cast<uint64_t>(li.QuadPart);
+    }
+
+    // Runs `body` (which performs `opsPerCall` operations) repeatedly and
+    // records the fastest per-operation time.
+    template<typename F>
+    void bench(const char* name, const uint64_t opsPerCall, F&& body)
+    {
+        const auto freq = qpcFrequency();
+
+        // Warm up caches, branch predictors and lazy allocations.
+        body();
+
+        // Grow the batch until one sample spans >= 10ms.
+        uint64_t reps = 1;
+        for (;;)
+        {
+            const auto start = serializedQpc();
+            for (uint64_t i = 0; i < reps; ++i)
+            {
+                body();
+            }
+            const auto elapsed = serializedQpc() - start;
+            if (elapsed * 100 >= freq)
+            {
+                break;
+            }
+            reps *= 2;
+        }
+
+        auto best = UINT64_MAX;
+        for (int sample = 0; sample < 10; ++sample)
+        {
+            const auto start = serializedQpc();
+            for (uint64_t i = 0; i < reps; ++i)
+            {
+                body();
+            }
+            best = std::min(best, serializedQpc() - start);
+        }
+
+        const auto ops = reps * opsPerCall;
+        const auto nsPerOp = static_cast<double>(best) * 1e9 / static_cast<double>(freq) / static_cast<double>(ops);
+        const auto opsPerSec = 1e9 / nsPerOp;
+
+        fprintf(stderr, "%-28s %12.2f ns/op %16.0f ops/s\n", name, nsPerOp, opsPerSec);
+        g_results.push_back({ name, ops, nsPerOp, opsPerSec });
+    }
+
+    // ------------------------------------------------------------------------
+
+    void benchRle()
+    {
+        // The ATTR_ROW workload: replacing a span of a row's attributes.
+        // "same value" hits the no-op fast path (text written with unchanged
+        // attributes); "alternating" forces genuine run splits and merges.
+        // Parentheses matter: braces would pick the initializer-list
+        // constructor and make two runs instead of a 120-cell row.
+        til::rle<uint16_t, uint16_t> row(120, 7);
+        bench("rle_replace_same_value", 1, [&]() {
+            row.replace(20, 100, 7);
+            g_sink += row.size();
+        });
+
+        uint16_t color = 0;
+        bench("rle_replace_alternating", 4, [&]() {
+            row.replace(0, 30, ++color);
+            row.replace(30, 60, ++color);
+            row.replace(60, 90, ++color);
+            row.replace(90, 120, ++color);
+            g_sink += row.size();
+        });
+    }
+
+    void benchBitmap()
+    {
+        // The renderer's dirty-region workload: mark cells, then pull the
+        // rectangles back out. "full" covers the everything-dirty repaint
+        // fast path; "scattered" covers incremental damage.
+        til::bitmap map{ til::size{ 80, 32 } };
+
+        bench("bitmap_full_runs", 1, [&]() {
+            map.reset_all();
+            map.set_all();
+            for (const auto& run : map.runs())
+            {
+                g_sink += static_cast<uint64_t>(run.top);
+            }
+        });
+
+        bench("bitmap_scattered_runs", 1, [&]() {
+            map.reset_all();
+            for (til::CoordType y = 0; y < 32; y += 3)
+            {
+                map.set(til::rect{ til::point{ 10, y }, til::size{ 40, 1 } });
+            }
+            for (const auto& run : map.runs())
+            {
+                g_sink += static_cast<uint64_t>(run.top);
+            }
+        });
+    }
+
+    void benchSpsc()
+    {
+        // Cross-core hand-off cost, the conhost IO shape: the producer is
+        // pinned to the second core (when there is one), the consumer stays
+        // on the first. This one is timed wall-to-wall rather than through
+        // bench(), since the interesting number includes the wait machinery.
+        constexpr uint64_t items = 1'000'000;
+        const auto freq = qpcFrequency();
+
+        auto [tx, rx] = til::spsc::channel<uint64_t>(1024);
+
+        std::thread producer{ [tx = std::move(tx)]() {
+            if (std::thread::hardware_concurrency() > 1)
+            {
+                SetThreadAffinityMask(GetCurrentThread(), 2);
+            }
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                tx.emplace(i);
+            }
+        } };
+
+        uint64_t received = 0;
+        const auto start = serializedQpc();
+        while (received < items)
+        {
+            if (const auto item = rx.pop())
+            {
+                g_sink += *item;
+                ++received;
+            }
+        }
+        const auto elapsed = serializedQpc() - start;
+        producer.join();
+
+        const auto nsPerOp = static_cast<double>(elapsed) * 1e9 / static_cast<double>(freq) / static_cast<double>(items);
+        const auto opsPerSec = 1e9 / nsPerOp;
+        fprintf(stderr, "%-28s %12.2f ns/op %16.0f ops/s\n", "spsc_cross_core", nsPerOp, opsPerSec);
+        g_results.push_back({ "spsc_cross_core", items, nsPerOp, opsPerSec });
+    }
+
+    void benchHash()
+    {
+        // 4KiB is the shape of a row's worth of cells or a shaped-run key.
+        std::vector<uint8_t> data(4096);
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<uint8_t>(i * 131 + 7);
+        }
+
+        bench("hash_fnv1a_4k", 1, [&]() {
+            til::hasher h;
+            h.write(data.data(), data.size());
+            g_sink += h.finalize();
+        });
+
+        bench("hash_bulk_4k", 1, [&]() {
+            til::bulk_hasher h;
+            h.write(data.data(), data.size());
+            g_sink += h.finalize();
+        });
+    }
+
+    void benchU8U16()
+    {
+        // conpty's input shape: overwhelmingly ASCII with the occasional
+        // multi-byte sequence mixed in.
+        std::string ascii(4096, 'x');
+
+        std::string mixed;
+        mixed.reserve(4096);
+        while (mixed.size() < 4000)
+        {
+            mixed += "the quick brown fox \xc3\xa9\xc3\xa0 \xe2\x94\x80\xe2\x94\x82 ";
+        }
+
+        std::wstring out;
+
+        bench("u8u16_ascii_4k", 1, [&]() {
+            LOG_IF_FAILED(til::u8u16(std::string_view{ ascii }, out));
+            g_sink += out.size();
+        });
+
+        bench("u8u16_mixed_4k", 1, [&]() {
+            LOG_IF_FAILED(til::u8u16(std::string_view{ mixed }, out));
+            g_sink += out.size();
+        });
+    }
+}
+
+int main()
+{
+    // Pin to the first core and outrank other ready threads, so samples
+    // aren't diluted by migrations or preemption.
+    SetThreadAffinityMask(GetCurrentThread(), 1);
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_HIGHEST);
+
+    fprintf(stderr, "tilbench: pinned to core 0, %u cores available\n\n", std::thread::hardware_concurrency());
+
+    benchRle();
+    benchBitmap();
+    benchSpsc();
+    benchHash();
+    benchU8U16();
+
+    // JSON on stdout, so `tilbench 2>nul` pipes cleanly into tooling.
+    printf("[\n");
+    for (size_t i = 0; i < g_results.size(); ++i)
+    {
+        const auto& r = g_results[i];
+        printf("  { \"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.3f, \"ops_per_sec\": %.0f }%s\n",
+               r.name.c_str(),
+               static_cast<unsigned long long>(r.iterations),
+               r.nsPerOp,
+               r.opsPerSec,
+               i + 1 < g_results.size() ? "," : "");
+    }
+    printf("]\n");
+
+    fprintf(stderr, "\n(sink: %llu)\n", static_cast<unsigned long long>(g_sink));
+    return 0;
+}
@@ -0,0 +1,187 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+// VtBench: a throughput harness for the VT parser.
+//
+// Replays synthetic VT corpora (plain text, SGR-heavy, cursor movement and
+// OSC-rich streams) through StateMachine + OutputStateMachineEngine against a
+// no-op dispatcher, and reports MB/s and ns per dispatched action for each.
+// The parser's correctness is covered by ut_parser; this tool exists so that
+// throughput regressions (an extra virtual call per character, a run that
+// stopped batching) show up as numbers instead of landing silently.
+
+#include <windows.h>
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "../../terminal/adapter/termDispatch.hpp"
+#include "../../terminal/parser/OutputStateMachineEngine.hpp"
+#include "../../terminal/parser/stateMachine.hpp"
+
+using namespace Microsoft::Console::VirtualTerminal;
+
+namespace
+{
+    // Counts what the engine dispatches, and nothing else. The counters keep
+    // the optimizer from discarding the parse work and give us a denominator
+    // for the per-action cost.
+    class BenchDispatch final : public TermDispatch
+    {
+    public:
+        void Print(const wchar_t /*wchPrintable*/) override { _printedChars++; }
+        void PrintString(const std::wstring_view string) override { _printedChars += string.size(); }
+
+        bool CursorUp(const size_t /*distance*/) override { return _countAction(); }
+        bool CursorDown(const size_t /*distance*/) override { return _countAction(); }
+        bool CursorForward(const size_t /*distance*/) override { return _countAction(); }
+        bool CursorBackward(const size_t /*distance*/) override { return _countAction(); }
+        bool CursorPosition(const size_t /*line*/, const size_t /*column*/) override { return _countAction(); }
+        bool CarriageReturn() override { return _countAction(); }
+        bool LineFeed(const DispatchTypes::LineFeedType /*lineFeedType*/) override { return _countAction(); }
+        bool EraseInDisplay(const DispatchTypes::EraseType /*eraseType*/) override { return _countAction(); }
+        bool EraseInLine(const DispatchTypes::EraseType /*eraseType*/) override { return _countAction(); }
+        bool SetGraphicsRendition(const VTParameters /*options*/) override { return _countAction(); }
+        bool SetWindowTitle(std::wstring_view /*title*/) override { return _countAction(); }
+
+        size_t PrintedChars() const noexcept { return _printedChars; }
+        size_t Actions() const noexcept { return _actions; }
+
+    private:
+        bool _countAction() noexcept
+        {
+            _actions++;
+            return true;
+        }
+
+        size_t _printedChars = 0;
+        size_t _actions = 0;
+    };
+
+    struct Corpus
+    {
+        const wchar_t* name;
+        std::wstring data;
+    };
+
+    std::wstring _buildPlainText()
+    {
+        // 70-column lines of rotating printable text, CRLF terminated - the
+        // shape of a typical build log or `dir /s`.
+        std::wstring out;
+        for (int line = 0; line < 500; line++)
+        {
+            for (int col = 0; col < 70; col++)
+            {
+                out.push_back(L'!' + ((line + col) % 94));
+            }
+            out.append(L"\r\n");
+        }
+        return out;
+    }
+
+    std::wstring _buildHeavySgr()
+    {
+        // short words each wrapped in a truecolor SGR, like colorized diffs
+        // or syntax-highlighted output.
+        std::wstring out;
+        for (int i = 0; i < 2000; i++)
+        {
+            out.append(L"\x1b[38;2;");
+            out.append(std::to_wstring(i % 256));
+            out.append(L";64;");
+            out.append(std::to_wstring((i * 7) % 256));
+            out.append(L"mcolor\x1b[0m ");
+            if (i % 10 == 9)
+            {
+                out.append(L"\r\n");
+            }
+        }
+        return out;
+    }
+
+    std::wstring _buildCursorMovement()
+    {
+        // full-screen-app style: reposition, print a short cell, repeat.
+        std::wstring out;
+        for (int i = 0; i < 2000; i++)
+        {
+            out.append(L"\x1b[");
+            out.append(std::to_wstring(1 + i % 40));
+            out.push_back(L';');
+            out.append(std::to_wstring(1 + (i * 3) % 80));
+            out.append(L"Hxy");
+            out.append(L"\x1b[K");
+        }
+        return out;
+    }
+
+    std::wstring _buildOscRich()
+    {
+        // interleaved title updates and text, like shells that update the
+        // window title on every prompt.
+        std::wstring out;
+        for (int i = 0; i < 1000; i++)
+        {
+            out.append(L"\x1b]0;benchmark window title number ");
+            out.append(std::to_wstring(i));
+            out.push_back(L'\x07');
+            out.append(L"prompt> some typed command output\r\n");
+        }
+        return out;
+    }
+
+    void _runCorpus(const Corpus& corpus)
+    {
+        auto dispatch = std::make_unique<BenchDispatch>();
+        auto* counters = dispatch.get();
+        auto engine = std::make_unique<OutputStateMachineEngine>(std::move(dispatch));
+        StateMachine machine{ std::move(engine) };
+
+        // warm up once so first-touch costs don't pollute the measurement.
+        machine.ProcessString(corpus.data);
+
+        constexpr int iterations = 50;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+        {
+            machine.ProcessString(corpus.data);
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        const auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        const auto bytes = corpus.data.size() * sizeof(wchar_t) * iterations;
+        const auto mbPerSec = (static_cast<double>(bytes) / (1024.0 * 1024.0)) / (static_cast<double>(elapsedNs) / 1e9);
+        const auto totalWork = counters->Actions() + counters->PrintedChars();
+        const auto nsPerAction = totalWork > 0 ? static_cast<double>(elapsedNs) / static_cast<double>(totalWork) : 0.0;
+
+        wprintf(L"%-16s %10.1f MB/s %10.1f ns/action (%zu chars printed, %zu actions)\n",
+                corpus.name,
+                mbPerSec,
+                nsPerAction,
+                counters->PrintedChars(),
+                counters->Actions());
+    }
+}
+
+int __cdecl wmain(int /*argc*/, WCHAR* /*argv*/[])
+{
+    const std::array<Corpus, 4> corpora{ {
+        { L"plain-text", _buildPlainText() },
+        { L"heavy-sgr", _buildHeavySgr() },
+        { L"cursor-movement", _buildCursorMovement() },
+        { L"osc-rich", _buildOscRich() },
+    } };
+
+    wprintf(L"VT parser throughput (%d-iteration average per corpus)\n\n", 50);
+    for (const auto& corpus : corpora)
+    {
+        _runCorpus(corpus);
+    }
+
+    return 0;
+}
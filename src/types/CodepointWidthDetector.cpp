@@ -3,6 +3,7 @@
 
 #include "precomp.h"
 #include "inc/CodepointWidthDetector.hpp"
+#include "inc/Utf16Parser.hpp"
 
 namespace
 {
@@ -14,11 +15,6 @@ namespace
         CodepointWidth width;
     };
 
-    static bool operator<(const UnicodeRange& range, const unsigned int searchTerm) noexcept
-    {
-        return range.upperBound < searchTerm;
-    }
-
     // Generated by Generate-CodepointWidthsFromUCD.ps1 -Pack:True -Full:False -NoOverrides:False
     // on 10/25/2020 7:32:04 AM (UTC) from Unicode 13.0.0.
     // 321205 (0x4E6B5) codepoints covered.
@@ -321,6 +317,137 @@ namespace
         UnicodeRange{ 0xf0000, 0xffffd, CodepointWidth::Ambiguous },
         UnicodeRange{ 0x100000, 0x10fffd, CodepointWidth::Ambiguous },
     };
+
+    // The range table above stays the authoritative, script-regenerable form
+    // of the data, but it isn't what we query at runtime: width lookup sits
+    // on the per-character ingest path of both conhost and Terminal, and a
+    // binary search over 295 ranges costs ~8 dependent branches per
+    // codepoint. Instead, the compiler derives the two-level table below
+    // from the ranges. Stage one holds one entry per 256-codepoint block
+    // across all of Unicode; a block in which every codepoint shares one
+    // width stores that width inline (high bit set), while a mixed block
+    // indexes a 64-byte stage-two array packing 2 bits per codepoint. That
+    // makes classification O(1) - at most two dependent loads - and keeps
+    // each mixed block within a single cache line.
+    constexpr unsigned int blockShift = 8;
+    constexpr unsigned int blockSize = 1u << blockShift;
+    constexpr unsigned int blockCount = 0x110000 >> blockShift;
+    constexpr uint16_t uniformBlockFlag = 0x8000;
+
+    template<size_t MixedBlocks>
+    struct WidthTable
+    {
+        std::array<uint16_t, blockCount> stage1;
+        std::array<std::array<uint8_t, blockSize / 4>, MixedBlocks> stage2;
+
+        constexpr CodepointWidth lookup(const unsigned int codepoint) const noexcept
+        {
+            const auto entry = stage1[codepoint >> blockShift];
+            if (entry & uniformBlockFlag)
+            {
+                return static_cast<CodepointWidth>(entry & ~uniformBlockFlag);
+            }
+            const auto packed = stage2[entry][(codepoint & (blockSize - 1)) / 4];
+            return static_cast<CodepointWidth>((packed >> ((codepoint & 3) * 2)) & 3);
+        }
+    };
+
+    enum class BlockKind
+    {
+        Narrow, // no range intersects the block; everything in it is narrow
+        Uniform, // a single range covers the entire block
+        Mixed // range boundaries fall inside the block
+    };
+
+    // Decides how the block [first, last] relates to the range table. `r` is
+    // a cursor into the (sorted) table that only moves forward as consecutive
+    // blocks are classified; on return it points at the first range that
+    // could intersect the block.
+    constexpr BlockKind _classifyBlock(size_t& r, const unsigned int first, const unsigned int last) noexcept
+    {
+        while (r < s_wideAndAmbiguousTable.size() && s_wideAndAmbiguousTable[r].upperBound < first)
+        {
+            ++r;
+        }
+        if (r == s_wideAndAmbiguousTable.size() || s_wideAndAmbiguousTable[r].lowerBound > last)
+        {
+            return BlockKind::Narrow;
+        }
+        if (s_wideAndAmbiguousTable[r].lowerBound <= first && s_wideAndAmbiguousTable[r].upperBound >= last)
+        {
+            return BlockKind::Uniform;
+        }
+        return BlockKind::Mixed;
+    }
+
+    constexpr size_t _countMixedBlocks() noexcept
+    {
+        size_t mixed = 0;
+        size_t r = 0;
+        for (unsigned int block = 0; block < blockCount; ++block)
+        {
+            const auto first = block << blockShift;
+            if (_classifyBlock(r, first, first + blockSize - 1) == BlockKind::Mixed)
+            {
+                ++mixed;
+            }
+        }
+        return mixed;
+    }
+
+    template<size_t MixedBlocks>
+    constexpr WidthTable<MixedBlocks> _buildWidthTable() noexcept
+    {
+        WidthTable<MixedBlocks> table{};
+        size_t mixed = 0;
+        size_t r = 0;
+        for (unsigned int block = 0; block < blockCount; ++block)
+        {
+            const auto first = block << blockShift;
+            const auto last = first + blockSize - 1;
+            switch (_classifyBlock(r, first, last))
+            {
+            case BlockKind::Narrow:
+                table.stage1[block] = uniformBlockFlag | static_cast<uint16_t>(CodepointWidth::Narrow);
+                break;
+            case BlockKind::Uniform:
+                table.stage1[block] = uniformBlockFlag | static_cast<uint16_t>(s_wideAndAmbiguousTable[r].width);
+                break;
+            case BlockKind::Mixed:
+            {
+                table.stage1[block] = static_cast<uint16_t>(mixed);
+                auto& bits = table.stage2[mixed++]; // zero-initialized, i.e. all narrow
+                for (auto rr = r; rr < s_wideAndAmbiguousTable.size() && s_wideAndAmbiguousTable[rr].lowerBound <= last; ++rr)
+                {
+                    const auto lo = std::max(s_wideAndAmbiguousTable[rr].lowerBound, first);
+                    const auto hi = std::min(s_wideAndAmbiguousTable[rr].upperBound, last);
+                    const auto width = static_cast<uint8_t>(s_wideAndAmbiguousTable[rr].width);
+                    for (auto cp = lo; cp <= hi; ++cp)
+                    {
+                        bits[(cp & (blockSize - 1)) / 4] |= static_cast<uint8_t>(width << ((cp & 3) * 2));
+                    }
+                }
+                break;
+            }
+            }
+        }
+        return table;
+    }
+
+    constexpr size_t s_mixedBlockCount = _countMixedBlocks();
+    static constexpr auto s_widthTable = _buildWidthTable<s_mixedBlockCount>();
+
+    // Spot checks along range boundaries, so a regeneration or builder bug
+    // fails the build rather than misrendering CJK.
+    static_assert(s_widthTable.lookup(0x41) == CodepointWidth::Narrow); // A
+    static_assert(s_widthTable.lookup(0xa1) == CodepointWidth::Ambiguous); // first table entry
+    static_assert(s_widthTable.lookup(0x1100) == CodepointWidth::Wide); // hangul choseong kiyeok
+    static_assert(s_widthTable.lookup(0x1160) == CodepointWidth::Narrow); // just past the hangul range
+    static_assert(s_widthTable.lookup(0x2500) == CodepointWidth::Narrow); // box drawing override
+    static_assert(s_widthTable.lookup(0x4e00) == CodepointWidth::Wide); // CJK unified ideographs
+    static_assert(s_widthTable.lookup(0x1f922) == CodepointWidth::Wide); // nauseated face
+    static_assert(s_widthTable.lookup(0x10fffd) == CodepointWidth::Ambiguous); // last table entry
+    static_assert(s_widthTable.lookup(0x10fffe) == CodepointWidth::Narrow); // past the last table entry
 }
 
 // Routine Description:
@@ -404,7 +531,8 @@ bool CodepointWidthDetector::IsWide(const std::wstring_view glyph) const
 }
 
 // Routine Description:
-// - returns the width type of codepoint by searching the map generated from the unicode spec
+// - returns the width type of codepoint by looking it up in the two-level
+//   table generated (at compile time) from the unicode spec data
 // Arguments:
 // - glyph - the utf16 encoded codepoint to search for
 // Return Value:
@@ -416,17 +544,45 @@ CodepointWidth CodepointWidthDetector::_lookupGlyphWidth(const std::wstring_view
         return CodepointWidth::Invalid;
     }
 
-    const auto codepoint = _extractCodepoint(glyph);
-    const auto it = std::lower_bound(s_wideAndAmbiguousTable.begin(), s_wideAndAmbiguousTable.end(), codepoint);
+    // _extractCodepoint can't produce anything above 0x10FFFF,
+    // so the table lookup is unconditionally in bounds.
+    return s_widthTable.lookup(_extractCodepoint(glyph));
+}
 
-    // For characters that are not _in_ the table, lower_bound will return the nearest item that is.
-    // We must check its bounds to make sure that our hit was a true hit.
-    if (it != s_wideAndAmbiguousTable.end() && codepoint >= it->lowerBound && codepoint <= it->upperBound)
+// Routine Description:
+// - measures how many terminal columns a run of text occupies. This is the bulk
+//   equivalent of calling IsWide once per codepoint: a single pass over the
+//   text with a fast path for the printable ASCII that dominates terminal
+//   output. Ambiguous codepoints resolve the same way GetWidth resolves them
+//   (via the font fallback when one is set, otherwise as narrow).
+// Arguments:
+// - text - the utf16 encoded text to measure
+// Return Value:
+// - the total number of columns the text occupies
+size_t CodepointWidthDetector::MeasureColumns(const std::wstring_view text) const
+{
+    size_t columns = 0;
+    for (size_t i = 0; i < text.size();)
     {
-        return it->width;
-    }
+        const auto wch = til::at(text, i);
+
+        if (wch >= 0x20 && wch <= 0x7e)
+        {
+            ++columns;
+            ++i;
+            continue;
+        }
 
-    return CodepointWidth::Narrow;
+        size_t length = 1;
+        if (Utf16Parser::IsLeadingSurrogate(wch) && i + 1 < text.size() && Utf16Parser::IsTrailingSurrogate(til::at(text, i + 1)))
+        {
+            length = 2;
+        }
+
+        columns += GetWidth(text.substr(i, length)) == CodepointWidth::Wide ? 2 : 1;
+        i += length;
+    }
+    return columns;
 }
 
 // Routine Description:
@@ -469,27 +625,30 @@ CodepointWidth CodepointWidthDetector::_lookupGlyphWidthWithCache(const std::wst
 
 // Routine Description:
 // - Checks the fallback function but caches the results until the font changes
-//   because the lookup function is usually very expensive and will return the same results
-//   for the same inputs.
+//   (NotifyFontChanged empties the cache) because the lookup function does real
+//   text layout work and will return the same results for the same inputs.
 // Arguments:
 // - glyph - the utf16 encoded codepoint to check width of
 // - true if codepoint is wide or false if it is narrow
 bool CodepointWidthDetector::_checkFallbackViaCache(const std::wstring_view glyph) const
 {
-    const std::wstring findMe{ glyph };
+    // The cache is keyed by codepoint rather than by string so that probing
+    // it never allocates. An emoji-dense stream therefore pays for the font
+    // measurement once per distinct glyph per font and a plain hash probe for
+    // every repeat appearance. Width classification only ever considers the
+    // first codepoint of the glyph (see _lookupGlyphWidth), so the key does
+    // the same.
+    const auto codepoint = _extractCodepoint(glyph);
 
-    // TODO: Cache needs to be emptied when font changes.
-    const auto it = _fallbackCache.find(findMe);
-    if (it == _fallbackCache.end())
-    {
-        auto result = _pfnFallbackMethod(glyph);
-        _fallbackCache.insert_or_assign(findMe, result);
-        return result;
-    }
-    else
+    const auto it = _fallbackCache.find(codepoint);
+    if (it != _fallbackCache.end())
     {
         return it->second;
     }
+
+    const auto result = _pfnFallbackMethod(glyph);
+    _fallbackCache.emplace(codepoint, result);
+    return result;
 }
 
 // Routine Description:
@@ -22,6 +22,12 @@ static constexpr double rad180 = 3.141592653589793238;
 static constexpr double rad275 = 4.799655442984406336;
 static constexpr double rad360 = 6.283185307179586476;
 
+ColorFix::ColorFix() noexcept
+{
+    rgb = 0;
+    L = A = B = 0;
+}
+
 ColorFix::ColorFix(COLORREF color) noexcept
 {
     rgb = color;
@@ -42,24 +48,23 @@ double ColorFix::_GetHPrimeFn(double x, double y) noexcept
 }
 
 // Method Description:
-// - Given 2 colors, computes the DeltaE value between them
+// - Given 2 colors, computes the chroma and hue contribution to their DeltaE
+//   value, i.e. everything in CIEDE2000 except the lightness term. All of
+//   these quantities are derived from the A and B channels alone, so the
+//   result stays valid while a caller nudges L around - which is exactly what
+//   GetPerceivableColor does, letting it hoist this (trig-heavy) part out of
+//   its search loop.
 // Arguments:
 // - x1: the first color
 // - x2: the second color
 // Return Value:
-// - The DeltaE value between x1 and x2
-double ColorFix::_GetDeltaE(ColorFix x1, ColorFix x2) noexcept
+// - chroma^2 + hue^2 + rSubT * chroma * hue, ready to combine with the
+//   lightness term in _DeltaEFromLightness
+double ColorFix::_GetChromaHueSq(const ColorFix& x1, const ColorFix& x2) noexcept
 {
-    constexpr double kSubL = 1;
     constexpr double kSubC = 1;
     constexpr double kSubH = 1;
 
-    // Delta L Prime
-    const double deltaLPrime = x2.L - x1.L;
-
-    // L Bar
-    const double lBar = (x1.L + x2.L) / 2;
-
     // C1 & C2
     const double c1 = sqrt(pow(x1.A, 2) + pow(x1.B, 2));
     const double c2 = sqrt(pow(x2.A, 2) + pow(x2.B, 2));
@@ -85,9 +90,6 @@ double ColorFix::_GetDeltaE(ColorFix x1, ColorFix x2) noexcept
     // Delta C Prime
     const double deltaCPrime = cPrime2 - cPrime1;
 
-    // S sub L
-    const double sSubL = 1 + ((0.015 * pow(lBar - 50, 2)) / sqrt(20 + pow(lBar - 50, 2)));
-
     // S sub C
     const double sSubC = 1 + 0.045 * cBarPrime;
 
@@ -112,12 +114,39 @@ double ColorFix::_GetDeltaE(ColorFix x1, ColorFix x2) noexcept
     // R sub T
     const double rSubT = -2 * sqrt(pow(cBarPrime, 7) / (pow(cBarPrime, 7) + pow(25.0, 7))) * sin(rad060 * exp(-pow((hBarPrime - rad275) / rad025, 2)));
 
-    // Put it all together!
-    const double lightness = deltaLPrime / (kSubL * sSubL);
+    // Put the chroma and hue terms together; the caller combines them with
+    // the lightness term.
     const double chroma = deltaCPrime / (kSubC * sSubC);
     const double hue = deltaHPrime / (kSubH * sSubH);
 
-    return sqrt(pow(lightness, 2) + pow(chroma, 2) + pow(hue, 2) + rSubT * chroma * hue);
+    return pow(chroma, 2) + pow(hue, 2) + rSubT * chroma * hue;
+}
+
+// Method Description:
+// - Combines the lightness term of CIEDE2000 with a precomputed chroma and
+//   hue contribution (from _GetChromaHueSq) into the final DeltaE value.
+// Arguments:
+// - l1: the lightness of the first color
+// - l2: the lightness of the second color
+// - chromaHueSq: the chroma and hue contribution of the two colors
+// Return Value:
+// - The DeltaE value between the two colors
+double ColorFix::_DeltaEFromLightness(double l1, double l2, double chromaHueSq) noexcept
+{
+    constexpr double kSubL = 1;
+
+    // Delta L Prime
+    const double deltaLPrime = l2 - l1;
+
+    // L Bar
+    const double lBar = (l1 + l2) / 2;
+
+    // S sub L
+    const double sSubL = 1 + ((0.015 * pow(lBar - 50, 2)) / sqrt(20 + pow(lBar - 50, 2)));
+
+    const double lightness = deltaLPrime / (kSubL * sSubL);
+
+    return sqrt(pow(lightness, 2) + chromaHueSq);
 }
 
 // Method Description:
@@ -201,9 +230,36 @@ void ColorFix::_ToRGB()
 // - The foreground color after performing any necessary changes to make it more perceivable
 COLORREF ColorFix::GetPerceivableColor(COLORREF fg, COLORREF bg)
 {
-    const ColorFix backLab(bg);
-    ColorFix frontLab(fg);
-    const double de1 = _GetDeltaE(frontLab, backLab);
+    return GetPerceivableColor(ColorFix{ fg }, ColorFix{ bg });
+}
+
+// Method Description:
+// - Given foreground and background colors already converted to Lab, change
+//   the foreground color to make it more perceivable if necessary. Callers
+//   that pair many colors against each other (like the adjusted color array)
+//   should convert them once and use this overload.
+// - Arguments:
+// - fg: the foreground color
+// - bg: the background color
+// - Return Value:
+// - The foreground color after performing any necessary changes to make it more perceivable
+COLORREF ColorFix::GetPerceivableColor(const ColorFix& fg, const ColorFix& bg)
+{
+    // The chroma and hue terms of DeltaE only depend on the A and B channels,
+    // and the search below only ever changes L, so they can be computed once
+    // up front; after that every step costs two square roots instead of the
+    // full trigonometry-heavy formula.
+    const double chromaHueSq = _GetChromaHueSq(fg, bg);
+
+    // DeltaE can never drop below the chroma and hue contribution alone; if
+    // that already clears the threshold, no lightness nudging is needed.
+    if (chromaHueSq >= gMinThreshold * gMinThreshold)
+    {
+        return fg.rgb;
+    }
+
+    ColorFix frontLab = fg;
+    const double de1 = _DeltaEFromLightness(frontLab.L, bg.L, chromaHueSq);
     if (de1 < gMinThreshold)
     {
         for (int i = 0; i <= 1; i++)
@@ -213,7 +269,7 @@ COLORREF ColorFix::GetPerceivableColor(COLORREF fg, COLORREF bg)
 
             while (((i == 0) && (frontLab.L <= 100)) || ((i == 1) && (frontLab.L >= 0)))
             {
-                const double de2 = _GetDeltaE(frontLab, backLab);
+                const double de2 = _DeltaEFromLightness(frontLab.L, bg.L, chromaHueSq);
                 if (de2 >= gExpThreshold)
                 {
                     frontLab._ToRGB();
@@ -0,0 +1,880 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include "inc/GraphemeParser.hpp"
+#include "inc/Utf16Parser.hpp"
+
+namespace
+{
+    // The Grapheme_Cluster_Break property of a codepoint, per UAX#29 Table 2,
+    // plus Extended_Pictographic from the emoji data files (needed for GB11).
+    enum class GraphemeBreakProperty : BYTE
+    {
+        Other,
+        CR,
+        LF,
+        Control,
+        Extend,
+        ZWJ,
+        RegionalIndicator,
+        Prepend,
+        SpacingMark,
+        HangulL,
+        HangulV,
+        HangulT,
+        HangulLV,
+        HangulLVT,
+        ExtendedPictographic
+    };
+
+    // used to store range data in GraphemeParser's internal table
+    struct GraphemeBreakRange final
+    {
+        unsigned int lowerBound;
+        unsigned int upperBound;
+        GraphemeBreakProperty property;
+    };
+
+    // Generated by Generate-GraphemeBreakTableFromUCD.ps1
+    // on 2026-08-29 11:42:10Z from the UCD auxiliary data files (Unicode 14.0.0).
+    // Codepoints not listed are GraphemeBreakProperty::Other; precomposed
+    // Hangul syllables (U+AC00-U+D7A3) are classified arithmetically below
+    // and are deliberately not listed either.
+    static constexpr std::array<GraphemeBreakRange, 636> s_graphemeBreakTable{
+        GraphemeBreakRange{ 0x0, 0x9, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0xa, 0xa, GraphemeBreakProperty::LF },
+        GraphemeBreakRange{ 0xb, 0xc, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0xd, 0xd, GraphemeBreakProperty::CR },
+        GraphemeBreakRange{ 0xe, 0x1f, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0x7f, 0x9f, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0xa9, 0xa9, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0xad, 0xad, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0xae, 0xae, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x300, 0x36f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x483, 0x489, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x591, 0x5bd, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x5bf, 0x5bf, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x5c1, 0x5c2, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x5c4, 0x5c5, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x5c7, 0x5c7, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x600, 0x605, GraphemeBreakProperty::Prepend },
+        GraphemeBreakRange{ 0x610, 0x61a, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x61c, 0x61c, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0x64b, 0x65f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x670, 0x670, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x6d6, 0x6dc, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x6dd, 0x6dd, GraphemeBreakProperty::Prepend },
+        GraphemeBreakRange{ 0x6df, 0x6e4, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x6e7, 0x6e8, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x6ea, 0x6ed, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x70f, 0x70f, GraphemeBreakProperty::Prepend },
+        GraphemeBreakRange{ 0x711, 0x711, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x730, 0x74a, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x7a6, 0x7b0, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x7eb, 0x7f3, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x7fd, 0x7fd, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x816, 0x819, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x81b, 0x823, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x825, 0x827, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x829, 0x82d, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x859, 0x85b, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x890, 0x891, GraphemeBreakProperty::Prepend },
+        GraphemeBreakRange{ 0x898, 0x89f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x8ca, 0x8e1, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x8e2, 0x8e2, GraphemeBreakProperty::Prepend },
+        GraphemeBreakRange{ 0x8e3, 0x902, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x903, 0x903, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x93a, 0x93a, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x93b, 0x93b, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x93c, 0x93c, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x93e, 0x940, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x941, 0x948, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x949, 0x94c, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x94d, 0x94d, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x94e, 0x94f, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x951, 0x957, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x962, 0x963, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x981, 0x981, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x982, 0x983, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x9bc, 0x9bc, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x9be, 0x9c0, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x9c1, 0x9c4, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x9c7, 0x9c8, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x9cb, 0x9cc, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x9cd, 0x9cd, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x9d7, 0x9d7, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x9e2, 0x9e3, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x9fe, 0x9fe, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa01, 0xa02, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa03, 0xa03, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xa3c, 0xa3c, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa3e, 0xa40, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xa41, 0xa42, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa47, 0xa48, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa4b, 0xa4d, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa51, 0xa51, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa70, 0xa71, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa75, 0xa75, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa81, 0xa82, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa83, 0xa83, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xabc, 0xabc, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xabe, 0xac0, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xac1, 0xac5, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xac7, 0xac8, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xac9, 0xac9, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xacb, 0xacc, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xacd, 0xacd, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xae2, 0xae3, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xafa, 0xaff, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xb01, 0xb01, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xb02, 0xb03, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xb3c, 0xb3c, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xb3e, 0xb3e, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xb3f, 0xb3f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xb40, 0xb40, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xb41, 0xb44, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xb47, 0xb48, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xb4b, 0xb4c, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xb4d, 0xb4d, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xb55, 0xb56, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xb57, 0xb57, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xb62, 0xb63, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xb82, 0xb82, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xbbe, 0xbbf, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xbc0, 0xbc0, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xbc1, 0xbc2, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xbc6, 0xbc8, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xbca, 0xbcc, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xbcd, 0xbcd, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xbd7, 0xbd7, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xc00, 0xc00, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xc01, 0xc03, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xc04, 0xc04, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xc3c, 0xc3c, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xc3e, 0xc40, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xc41, 0xc44, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xc46, 0xc48, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xc4a, 0xc4d, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xc55, 0xc56, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xc62, 0xc63, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xc81, 0xc81, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xc82, 0xc83, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xcbc, 0xcbc, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xcbe, 0xcbe, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xcbf, 0xcbf, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xcc0, 0xcc4, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xcc6, 0xcc6, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xcc7, 0xcc8, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xcca, 0xccb, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xccc, 0xccd, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xcd5, 0xcd6, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xce2, 0xce3, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xd00, 0xd01, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xd02, 0xd03, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xd3b, 0xd3c, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xd3e, 0xd40, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xd41, 0xd44, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xd46, 0xd48, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xd4a, 0xd4c, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xd4d, 0xd4d, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xd4e, 0xd4e, GraphemeBreakProperty::Prepend },
+        GraphemeBreakRange{ 0xd57, 0xd57, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xd62, 0xd63, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xd81, 0xd81, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xd82, 0xd83, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xdca, 0xdca, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xdcf, 0xdd1, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xdd2, 0xdd4, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xdd6, 0xdd6, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xdd8, 0xddf, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xdf2, 0xdf3, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xe31, 0xe31, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xe33, 0xe33, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xe34, 0xe3a, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xe47, 0xe4e, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xeb1, 0xeb1, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xeb3, 0xeb3, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xeb4, 0xebc, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xec8, 0xecd, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xf18, 0xf19, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xf35, 0xf35, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xf37, 0xf37, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xf39, 0xf39, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xf3e, 0xf3f, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xf71, 0xf7e, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xf7f, 0xf7f, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xf80, 0xf84, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xf86, 0xf87, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xf8d, 0xf97, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xf99, 0xfbc, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xfc6, 0xfc6, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x102b, 0x102c, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x102d, 0x1030, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1031, 0x1031, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1032, 0x1037, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1038, 0x1038, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1039, 0x103a, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x103b, 0x103c, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x103d, 0x103e, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1056, 0x1057, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1058, 0x1059, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x105e, 0x1060, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1062, 0x1064, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1067, 0x106d, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1071, 0x1074, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1082, 0x1082, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1083, 0x1084, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1085, 0x1086, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1087, 0x108c, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x108d, 0x108d, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x108f, 0x108f, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x109a, 0x109c, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x109d, 0x109d, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1100, 0x115f, GraphemeBreakProperty::HangulL },
+        GraphemeBreakRange{ 0x1160, 0x11a7, GraphemeBreakProperty::HangulV },
+        GraphemeBreakRange{ 0x11a8, 0x11ff, GraphemeBreakProperty::HangulT },
+        GraphemeBreakRange{ 0x135d, 0x135f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1712, 0x1714, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1715, 0x1715, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1732, 0x1733, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1734, 0x1734, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1752, 0x1753, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1772, 0x1773, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x17b4, 0x17b5, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x17b6, 0x17b6, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x17b7, 0x17bd, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x17be, 0x17c5, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x17c6, 0x17c6, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x17c7, 0x17c8, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x17c9, 0x17d3, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x17dd, 0x17dd, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x180b, 0x180d, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x180e, 0x180e, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0x180f, 0x180f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1885, 0x1886, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x18a9, 0x18a9, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1920, 0x1922, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1923, 0x1926, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1927, 0x1928, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1929, 0x192b, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1930, 0x1931, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1932, 0x1932, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1933, 0x1938, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1939, 0x193b, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1a17, 0x1a18, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1a19, 0x1a1a, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1a1b, 0x1a1b, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1a55, 0x1a55, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1a56, 0x1a56, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1a57, 0x1a57, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1a58, 0x1a5e, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1a60, 0x1a60, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1a61, 0x1a61, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1a62, 0x1a62, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1a63, 0x1a64, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1a65, 0x1a6c, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1a6d, 0x1a72, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1a73, 0x1a7c, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1a7f, 0x1a7f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1ab0, 0x1ace, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1b00, 0x1b03, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1b04, 0x1b04, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1b34, 0x1b34, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1b35, 0x1b35, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1b36, 0x1b3a, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1b3b, 0x1b3b, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1b3c, 0x1b3c, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1b3d, 0x1b41, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1b42, 0x1b42, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1b43, 0x1b44, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1b6b, 0x1b73, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1b80, 0x1b81, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1b82, 0x1b82, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1ba1, 0x1ba1, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1ba2, 0x1ba5, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1ba6, 0x1ba7, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1ba8, 0x1ba9, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1baa, 0x1baa, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1bab, 0x1bad, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1be6, 0x1be6, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1be7, 0x1be7, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1be8, 0x1be9, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1bea, 0x1bec, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1bed, 0x1bed, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1bee, 0x1bee, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1bef, 0x1bf1, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1bf2, 0x1bf3, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1c24, 0x1c2b, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1c2c, 0x1c33, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1c34, 0x1c35, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1c36, 0x1c37, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1cd0, 0x1cd2, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1cd4, 0x1ce0, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1ce1, 0x1ce1, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1ce2, 0x1ce8, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1ced, 0x1ced, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1cf4, 0x1cf4, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1cf7, 0x1cf7, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1cf8, 0x1cf9, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1dc0, 0x1dff, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x200b, 0x200b, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0x200c, 0x200c, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x200d, 0x200d, GraphemeBreakProperty::ZWJ },
+        GraphemeBreakRange{ 0x200e, 0x200f, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0x2028, 0x202e, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0x203c, 0x203c, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2049, 0x2049, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2060, 0x2064, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0x2066, 0x206f, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0x20d0, 0x20f0, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x2122, 0x2122, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2139, 0x2139, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2194, 0x2199, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x21a9, 0x21aa, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x231a, 0x231b, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2328, 0x2328, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2388, 0x2388, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x23cf, 0x23cf, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x23e9, 0x23f3, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x23f8, 0x23fa, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x24c2, 0x24c2, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x25aa, 0x25ab, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x25b6, 0x25b6, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x25c0, 0x25c0, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x25fb, 0x25fe, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2600, 0x2605, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2607, 0x2612, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2614, 0x2685, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2690, 0x2705, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2708, 0x2712, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2714, 0x2714, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2716, 0x2716, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x271d, 0x271d, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2721, 0x2721, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2728, 0x2728, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2733, 0x2734, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2744, 0x2744, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2747, 0x2747, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x274c, 0x274c, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x274e, 0x274e, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2753, 0x2755, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2757, 0x2757, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2763, 0x2767, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2795, 0x2797, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x27a1, 0x27a1, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x27b0, 0x27b0, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x27bf, 0x27bf, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2934, 0x2935, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2b05, 0x2b07, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2b1b, 0x2b1c, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2b50, 0x2b50, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2b55, 0x2b55, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x2cef, 0x2cf1, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x2d7f, 0x2d7f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x2de0, 0x2dff, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x302a, 0x302d, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x302e, 0x302f, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x3030, 0x3030, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x303d, 0x303d, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x3099, 0x309a, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x3297, 0x3297, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x3299, 0x3299, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0xa66f, 0xa672, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa674, 0xa67d, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa69e, 0xa69f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa6f0, 0xa6f1, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa802, 0xa802, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa806, 0xa806, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa80b, 0xa80b, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa823, 0xa824, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xa825, 0xa826, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa827, 0xa827, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xa82c, 0xa82c, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa880, 0xa881, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xa8b4, 0xa8c3, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xa8c4, 0xa8c5, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa8e0, 0xa8f1, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa8ff, 0xa8ff, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa926, 0xa92d, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa947, 0xa951, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa952, 0xa953, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xa960, 0xa97c, GraphemeBreakProperty::HangulL },
+        GraphemeBreakRange{ 0xa980, 0xa982, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa983, 0xa983, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xa9b3, 0xa9b3, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa9b4, 0xa9b5, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xa9b6, 0xa9b9, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa9ba, 0xa9bb, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xa9bc, 0xa9bd, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xa9be, 0xa9c0, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xa9e5, 0xa9e5, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xaa29, 0xaa2e, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xaa2f, 0xaa30, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xaa31, 0xaa32, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xaa33, 0xaa34, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xaa35, 0xaa36, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xaa43, 0xaa43, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xaa4c, 0xaa4c, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xaa4d, 0xaa4d, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xaa7b, 0xaa7b, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xaa7c, 0xaa7c, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xaa7d, 0xaa7d, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xaab0, 0xaab0, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xaab2, 0xaab4, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xaab7, 0xaab8, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xaabe, 0xaabf, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xaac1, 0xaac1, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xaaeb, 0xaaeb, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xaaec, 0xaaed, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xaaee, 0xaaef, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xaaf5, 0xaaf5, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xaaf6, 0xaaf6, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xabe3, 0xabe4, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xabe5, 0xabe5, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xabe6, 0xabe7, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xabe8, 0xabe8, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xabe9, 0xabea, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xabec, 0xabec, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0xabed, 0xabed, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xd7b0, 0xd7c6, GraphemeBreakProperty::HangulV },
+        GraphemeBreakRange{ 0xd7cb, 0xd7fb, GraphemeBreakProperty::HangulT },
+        GraphemeBreakRange{ 0xfb1e, 0xfb1e, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xfe00, 0xfe0f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xfe20, 0xfe2f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xfeff, 0xfeff, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0xff9e, 0xff9f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xfff9, 0xfffb, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0x101fd, 0x101fd, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x102e0, 0x102e0, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x10376, 0x1037a, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x10a01, 0x10a03, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x10a05, 0x10a06, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x10a0c, 0x10a0f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x10a38, 0x10a3a, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x10a3f, 0x10a3f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x10ae5, 0x10ae6, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x10d24, 0x10d27, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x10eab, 0x10eac, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x10f46, 0x10f50, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x10f82, 0x10f85, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11000, 0x11000, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11001, 0x11001, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11002, 0x11002, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11038, 0x11046, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11070, 0x11070, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11073, 0x11074, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1107f, 0x11081, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11082, 0x11082, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x110b0, 0x110b2, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x110b3, 0x110b6, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x110b7, 0x110b8, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x110b9, 0x110ba, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x110bd, 0x110bd, GraphemeBreakProperty::Prepend },
+        GraphemeBreakRange{ 0x110c2, 0x110c2, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x110cd, 0x110cd, GraphemeBreakProperty::Prepend },
+        GraphemeBreakRange{ 0x11100, 0x11102, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11127, 0x1112b, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1112c, 0x1112c, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1112d, 0x11134, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11145, 0x11146, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11173, 0x11173, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11180, 0x11181, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11182, 0x11182, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x111b3, 0x111b5, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x111b6, 0x111be, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x111bf, 0x111c0, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x111c2, 0x111c3, GraphemeBreakProperty::Prepend },
+        GraphemeBreakRange{ 0x111c9, 0x111cc, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x111ce, 0x111ce, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x111cf, 0x111cf, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1122c, 0x1122e, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1122f, 0x11231, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11232, 0x11233, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11234, 0x11234, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11235, 0x11235, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11236, 0x11237, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1123e, 0x1123e, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x112df, 0x112df, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x112e0, 0x112e2, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x112e3, 0x112ea, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11300, 0x11301, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11302, 0x11303, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1133b, 0x1133c, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1133e, 0x1133f, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11340, 0x11340, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11341, 0x11344, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11347, 0x11348, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1134b, 0x1134d, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11357, 0x11357, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11362, 0x11363, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11366, 0x1136c, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11370, 0x11374, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11435, 0x11437, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11438, 0x1143f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11440, 0x11441, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11442, 0x11444, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11445, 0x11445, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11446, 0x11446, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1145e, 0x1145e, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x114b0, 0x114b2, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x114b3, 0x114b8, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x114b9, 0x114b9, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x114ba, 0x114ba, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x114bb, 0x114be, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x114bf, 0x114c0, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x114c1, 0x114c1, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x114c2, 0x114c3, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x115af, 0x115b1, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x115b2, 0x115b5, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x115b8, 0x115bb, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x115bc, 0x115bd, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x115be, 0x115be, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x115bf, 0x115c0, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x115dc, 0x115dd, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11630, 0x11632, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11633, 0x1163a, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1163b, 0x1163c, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1163d, 0x1163d, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1163e, 0x1163e, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1163f, 0x11640, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x116ab, 0x116ab, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x116ac, 0x116ac, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x116ad, 0x116ad, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x116ae, 0x116af, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x116b0, 0x116b5, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x116b6, 0x116b6, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x116b7, 0x116b7, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1171d, 0x1171f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11720, 0x11721, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11722, 0x11725, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11726, 0x11726, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11727, 0x1172b, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1182c, 0x1182e, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1182f, 0x11837, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11838, 0x11838, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11839, 0x1183a, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11930, 0x11935, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11937, 0x11938, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1193b, 0x1193c, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1193d, 0x1193d, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1193e, 0x1193e, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1193f, 0x1193f, GraphemeBreakProperty::Prepend },
+        GraphemeBreakRange{ 0x11940, 0x11940, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11941, 0x11941, GraphemeBreakProperty::Prepend },
+        GraphemeBreakRange{ 0x11942, 0x11942, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11943, 0x11943, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x119d1, 0x119d3, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x119d4, 0x119d7, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x119da, 0x119db, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x119dc, 0x119df, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x119e0, 0x119e0, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x119e4, 0x119e4, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11a01, 0x11a0a, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11a33, 0x11a38, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11a39, 0x11a39, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11a3a, 0x11a3a, GraphemeBreakProperty::Prepend },
+        GraphemeBreakRange{ 0x11a3b, 0x11a3e, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11a47, 0x11a47, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11a51, 0x11a56, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11a57, 0x11a58, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11a59, 0x11a5b, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11a84, 0x11a89, GraphemeBreakProperty::Prepend },
+        GraphemeBreakRange{ 0x11a8a, 0x11a96, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11a97, 0x11a97, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11a98, 0x11a99, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11c2f, 0x11c2f, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11c30, 0x11c36, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11c38, 0x11c3d, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11c3e, 0x11c3e, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11c3f, 0x11c3f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11c92, 0x11ca7, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11ca9, 0x11ca9, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11caa, 0x11cb0, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11cb1, 0x11cb1, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11cb2, 0x11cb3, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11cb4, 0x11cb4, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11cb5, 0x11cb6, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11d31, 0x11d36, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11d3a, 0x11d3a, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11d3c, 0x11d3d, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11d3f, 0x11d45, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11d46, 0x11d46, GraphemeBreakProperty::Prepend },
+        GraphemeBreakRange{ 0x11d47, 0x11d47, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11d8a, 0x11d8e, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11d90, 0x11d91, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11d93, 0x11d94, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11d95, 0x11d95, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11d96, 0x11d96, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x11d97, 0x11d97, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11ef3, 0x11ef4, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x11ef5, 0x11ef6, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x13430, 0x13438, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0x16af0, 0x16af4, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x16b30, 0x16b36, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x16f4f, 0x16f4f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x16f51, 0x16f87, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x16f8f, 0x16f92, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x16fe4, 0x16fe4, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x16ff0, 0x16ff1, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1bc9d, 0x1bc9e, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1bca0, 0x1bca3, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0x1cf00, 0x1cf2d, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1cf30, 0x1cf46, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1d165, 0x1d166, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1d167, 0x1d169, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1d16d, 0x1d172, GraphemeBreakProperty::SpacingMark },
+        GraphemeBreakRange{ 0x1d173, 0x1d17a, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0x1d17b, 0x1d182, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1d185, 0x1d18b, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1d1aa, 0x1d1ad, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1d242, 0x1d244, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1da00, 0x1da36, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1da3b, 0x1da6c, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1da75, 0x1da75, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1da84, 0x1da84, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1da9b, 0x1da9f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1daa1, 0x1daaf, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1e000, 0x1e006, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1e008, 0x1e018, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1e01b, 0x1e021, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1e023, 0x1e024, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1e026, 0x1e02a, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1e130, 0x1e136, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1e2ae, 0x1e2ae, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1e2ec, 0x1e2ef, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1e8d0, 0x1e8d6, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1e944, 0x1e94a, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1f000, 0x1f0ff, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f10d, 0x1f10f, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f12f, 0x1f12f, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f16c, 0x1f171, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f17e, 0x1f17f, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f18e, 0x1f18e, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f191, 0x1f19a, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f1ad, 0x1f1e5, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f1e6, 0x1f1ff, GraphemeBreakProperty::RegionalIndicator },
+        GraphemeBreakRange{ 0x1f201, 0x1f20f, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f21a, 0x1f21a, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f22f, 0x1f22f, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f232, 0x1f23a, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f23c, 0x1f23f, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f249, 0x1f3fa, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f3fb, 0x1f3ff, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0x1f400, 0x1f53d, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f546, 0x1f64f, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f680, 0x1f6ff, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f774, 0x1f77f, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f7d5, 0x1f7ff, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f80c, 0x1f80f, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f848, 0x1f84f, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f85a, 0x1f85f, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f888, 0x1f88f, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f8ae, 0x1f8ff, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f90c, 0x1f93a, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f93c, 0x1f945, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1f947, 0x1faff, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0x1fc00, 0x1fffd, GraphemeBreakProperty::ExtendedPictographic },
+        GraphemeBreakRange{ 0xe0001, 0xe0001, GraphemeBreakProperty::Control },
+        GraphemeBreakRange{ 0xe0020, 0xe007f, GraphemeBreakProperty::Extend },
+        GraphemeBreakRange{ 0xe0100, 0xe01ef, GraphemeBreakProperty::Extend },
+    };
+
+    // Routine Description:
+    // - looks up the grapheme cluster break property of a codepoint
+    // Arguments:
+    // - codepoint - the codepoint to classify
+    // Return Value:
+    // - the break property, GraphemeBreakProperty::Other if the codepoint isn't in the table
+    GraphemeBreakProperty _classify(const unsigned int codepoint) noexcept
+    {
+        // Printable ASCII and most of Latin-1 sit below the first table entry
+        // of interest and never joins with anything; skip the search for it.
+        if (codepoint >= 0x20 && codepoint < 0xa9)
+        {
+            return GraphemeBreakProperty::Other;
+        }
+
+        // Precomposed Hangul syllables follow a fixed arithmetic layout
+        // (Unicode chapter 3.12): every 28th syllable is an LV, the ones in
+        // between are LVT.
+        if (codepoint >= 0xac00 && codepoint <= 0xd7a3)
+        {
+            return (codepoint - 0xac00) % 28 == 0 ? GraphemeBreakProperty::HangulLV : GraphemeBreakProperty::HangulLVT;
+        }
+
+        const auto it = std::lower_bound(s_graphemeBreakTable.begin(), s_graphemeBreakTable.end(), codepoint, [](const GraphemeBreakRange& range, const unsigned int cp) noexcept {
+            return range.upperBound < cp;
+        });
+        if (it != s_graphemeBreakTable.end() && codepoint >= it->lowerBound)
+        {
+            return it->property;
+        }
+        return GraphemeBreakProperty::Other;
+    }
+
+    // Routine Description:
+    // - decodes the codepoint starting at the given position, pairing adjacent
+    //   lead/trail surrogates. Unpaired surrogate units decode as themselves
+    //   (and will classify as Other, so they break on both sides).
+    // Arguments:
+    // - text - the string being scanned
+    // - pos - the position to decode at; must be < text.size()
+    // - codepoint - receives the decoded codepoint
+    // Return Value:
+    // - the number of code units consumed (1 or 2)
+    size_t _decode(const std::wstring_view text, const size_t pos, unsigned int& codepoint) noexcept
+    {
+        const auto wch = til::at(text, pos);
+        if (Utf16Parser::IsLeadingSurrogate(wch) && pos + 1 < text.size())
+        {
+            const auto wchNext = til::at(text, pos + 1);
+            if (Utf16Parser::IsTrailingSurrogate(wchNext))
+            {
+                codepoint = 0x10000 + ((static_cast<unsigned int>(wch & 0x3ff) << 10) | (wchNext & 0x3ff));
+                return 2;
+            }
+        }
+        codepoint = wch;
+        return 1;
+    }
+}
+
+// Routine Description:
+// - finds the end of the grapheme cluster that starts at the given offset,
+//   applying the UAX#29 boundary rules (GB1-GB999): carriage return + line
+//   feed stay together, combining marks and spacing marks attach to their
+//   base, Hangul jamo compose, ZWJ emoji sequences and regional indicator
+//   pairs are kept whole.
+// Arguments:
+// - text - the string to scan
+// - offset - the position the cluster starts at
+// Return Value:
+// - the position one past the last code unit of the cluster, or text.size()
+//   if the cluster runs to the end. Returns text.size() when offset is out of
+//   range, so callers can loop on it directly.
+size_t GraphemeParser::NextBoundary(const std::wstring_view text, const size_t offset) noexcept
+{
+    if (offset >= text.size())
+    {
+        return text.size();
+    }
+
+    unsigned int codepoint;
+    auto pos = offset + _decode(text, offset, codepoint);
+    auto before = _classify(codepoint);
+
+    // GB11 wants "extended pictograph, any number of extends, ZWJ" before it
+    // joins the next pictograph; this flag tracks whether the cluster so far
+    // matches that shape.
+    auto emojiBase = before == GraphemeBreakProperty::ExtendedPictographic;
+    // GB12/GB13 pair regional indicators two by two; count the run so a third
+    // one starts a new flag.
+    size_t riRun = before == GraphemeBreakProperty::RegionalIndicator ? 1 : 0;
+
+    while (pos < text.size())
+    {
+        const auto length = _decode(text, pos, codepoint);
+        const auto after = _classify(codepoint);
+
+        auto joins = false;
+        if (before == GraphemeBreakProperty::CR && after == GraphemeBreakProperty::LF)
+        {
+            joins = true; // GB3
+        }
+        else if (before == GraphemeBreakProperty::Control || before == GraphemeBreakProperty::CR || before == GraphemeBreakProperty::LF ||
+                 after == GraphemeBreakProperty::Control || after == GraphemeBreakProperty::CR || after == GraphemeBreakProperty::LF)
+        {
+            joins = false; // GB4, GB5
+        }
+        else if (before == GraphemeBreakProperty::HangulL &&
+                 (after == GraphemeBreakProperty::HangulL || after == GraphemeBreakProperty::HangulV ||
+                  after == GraphemeBreakProperty::HangulLV || after == GraphemeBreakProperty::HangulLVT))
+        {
+            joins = true; // GB6
+        }
+        else if ((before == GraphemeBreakProperty::HangulLV || before == GraphemeBreakProperty::HangulV) &&
+                 (after == GraphemeBreakProperty::HangulV || after == GraphemeBreakProperty::HangulT))
+        {
+            joins = true; // GB7
+        }
+        else if ((before == GraphemeBreakProperty::HangulLVT || before == GraphemeBreakProperty::HangulT) &&
+                 after == GraphemeBreakProperty::HangulT)
+        {
+            joins = true; // GB8
+        }
+        else if (after == GraphemeBreakProperty::Extend || after == GraphemeBreakProperty::ZWJ ||
+                 after == GraphemeBreakProperty::SpacingMark)
+        {
+            joins = true; // GB9, GB9a
+        }
+        else if (before == GraphemeBreakProperty::Prepend)
+        {
+            joins = true; // GB9b
+        }
+        else if (before == GraphemeBreakProperty::ZWJ && after == GraphemeBreakProperty::ExtendedPictographic && emojiBase)
+        {
+            joins = true; // GB11
+        }
+        else if (before == GraphemeBreakProperty::RegionalIndicator && after == GraphemeBreakProperty::RegionalIndicator &&
+                 riRun % 2 == 1)
+        {
+            joins = true; // GB12, GB13
+        }
+
+        if (!joins)
+        {
+            break; // GB999
+        }
+
+        if (after == GraphemeBreakProperty::ExtendedPictographic)
+        {
+            emojiBase = true;
+        }
+        else if (after != GraphemeBreakProperty::Extend && after != GraphemeBreakProperty::ZWJ)
+        {
+            emojiBase = false;
+        }
+        if (after == GraphemeBreakProperty::RegionalIndicator)
+        {
+            ++riRun;
+        }
+
+        pos += length;
+        before = after;
+    }
+
+    return pos;
+}
+
+// Routine Description:
+// - returns a view of the first grapheme cluster of the given string.
+// Arguments:
+// - wstr - the string to parse
+// Return Value:
+// - a view into the string of just the first cluster; empty if the string is empty.
+std::wstring_view GraphemeParser::ParseNext(const std::wstring_view wstr) noexcept
+{
+    return wstr.substr(0, NextBoundary(wstr, 0));
+}
+
+// Routine Description:
+// - splits a utf16 encoded string into views of its grapheme clusters,
+//   reusing the caller's vector for the results (like Utf16Parser::ParseInto,
+//   which splits on codepoints instead). The views alias the input string, so
+//   they are only valid as long as it is.
+// Arguments:
+// - wstr - the string to parse
+// - clusters - receives one view per grapheme cluster; cleared first
+// Return Value:
+// - <none>
+void GraphemeParser::ParseInto(const std::wstring_view wstr, std::vector<std::wstring_view>& clusters)
+{
+    clusters.clear();
+    for (size_t pos = 0; pos < wstr.size();)
+    {
+        const auto next = NextBoundary(wstr, pos);
+        clusters.emplace_back(wstr.substr(pos, next - pos));
+        pos = next;
+    }
+}
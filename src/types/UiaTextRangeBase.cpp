@@ -1004,16 +1004,13 @@ std::wstring UiaTextRangeBase::_getTextValue(std::optional<unsigned int> maxLeng
         bufferSize.DecrementInBounds(inclusiveEnd, true);
 
         const auto textRects = buffer.GetTextRects(_start, inclusiveEnd, _blockRange, true);
-        const auto bufferData = buffer.GetText(true,
-                                               false,
-                                               textRects);
 
-        const size_t textDataSize = base::ClampMul(bufferData.text.size(), bufferSize.Width());
+        const size_t textDataSize = base::ClampMul(textRects.size(), bufferSize.Width());
         textData.reserve(textDataSize);
-        for (const auto& text : bufferData.text)
-        {
-            textData += text;
-        }
+
+        // stream the rows straight into our string; we don't need the
+        // color data or the per-row strings that GetText produces
+        buffer.ExtractTextInto(textData, textRects, true, false);
     }
 
     if (maxLength.has_value())
@@ -15,6 +15,21 @@ TRACELOGGING_DEFINE_PROVIDER(g_UiaProviderTraceProvider,
 
 using namespace Microsoft::Console::Types;
 
+// Keywords within this provider's definable space (bits 0..31; the shared
+// TIL keywords start at bit 32). Each one opts a trace session into detail
+// that is too expensive or too noisy to produce by default.
+enum UiaTraceKeyword : uint64_t
+{
+    UIA_KEYWORD_TEXT_CONTENT = 0x1, // include the range's text content in event payloads
+    UIA_KEYWORD_ALL_SIGNALS = 0x2 // write every signal occurrence instead of a sampled subset
+};
+
+// TextChanged/CursorChanged fire for every frame of output in a screen
+// reader session; unless UIA_KEYWORD_ALL_SIGNALS is enabled, only every
+// n-th occurrence is written (the payload carries the running count, so
+// nothing is lost from the record).
+static constexpr uint64_t UiaSignalSampleRate = 100;
+
 // The first valid ID is 1 for each of our traced UIA object types
 // ID assignment is handled between UiaTracing and IUiaTraceable to...
 //  - prevent multiple objects with the same ID
@@ -53,6 +68,21 @@ void UiaTracing::_assignId(ScreenInfoUiaProviderBase& siup) noexcept
     }
 }
 
+// Routine Description:
+// - decide whether a high-frequency signal occurrence should be written
+// Arguments:
+// - count - how many times this signal has fired so far
+// Return Value:
+// - true if the occurrence should be traced
+bool UiaTracing::_shouldTraceSignal(const uint64_t count) noexcept
+{
+    if (TraceLoggingProviderEnabled(g_UiaProviderTraceProvider, WINEVENT_LEVEL_VERBOSE, UIA_KEYWORD_ALL_SIGNALS))
+    {
+        return true;
+    }
+    return count % UiaSignalSampleRate == 1;
+}
+
 UiaTracing::UiaTracing() noexcept
 {
     TraceLoggingRegister(g_UiaProviderTraceProvider);
@@ -82,7 +112,14 @@ try
     stream << " _end: { " << end.X << ", " << end.Y << " }";
     stream << " _degenerate: " << utr.IsDegenerate();
     stream << " _wordDelimiters: " << utr._wordDelimiters;
-    stream << " content: " << utr._getTextValue();
+
+    // the content is by far the most expensive part of the payload to
+    // produce (it re-extracts the range's text under the console lock),
+    // so it stays opt-in via its own keyword
+    if (TraceLoggingProviderEnabled(g_UiaProviderTraceProvider, WINEVENT_LEVEL_VERBOSE, UIA_KEYWORD_TEXT_CONTENT))
+    {
+        stream << " content: " << utr._getTextValue();
+    }
     return stream.str();
 }
 catch (...)
@@ -752,11 +789,17 @@ void UiaTracing::Signal::TextChanged() noexcept
     EnsureRegistration();
     if (TraceLoggingProviderEnabled(g_UiaProviderTraceProvider, WINEVENT_LEVEL_VERBOSE, TIL_KEYWORD_TRACE))
     {
-        TraceLoggingWrite(
-            g_UiaProviderTraceProvider,
-            "Signal::TextChanged",
-            TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
-            TraceLoggingKeyword(TIL_KEYWORD_TRACE));
+        static uint64_t count = 0;
+        ++count;
+        if (_shouldTraceSignal(count))
+        {
+            TraceLoggingWrite(
+                g_UiaProviderTraceProvider,
+                "Signal::TextChanged",
+                TraceLoggingValue(count, "count"),
+                TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+                TraceLoggingKeyword(TIL_KEYWORD_TRACE));
+        }
     }
 }
 
@@ -765,11 +808,17 @@ void UiaTracing::Signal::CursorChanged() noexcept
     EnsureRegistration();
     if (TraceLoggingProviderEnabled(g_UiaProviderTraceProvider, WINEVENT_LEVEL_VERBOSE, TIL_KEYWORD_TRACE))
     {
-        TraceLoggingWrite(
-            g_UiaProviderTraceProvider,
-            "Signal::CursorChanged",
-            TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
-            TraceLoggingKeyword(TIL_KEYWORD_TRACE));
+        static uint64_t count = 0;
+        ++count;
+        if (_shouldTraceSignal(count))
+        {
+            TraceLoggingWrite(
+                g_UiaProviderTraceProvider,
+                "Signal::CursorChanged",
+                TraceLoggingValue(count, "count"),
+                TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+                TraceLoggingKeyword(TIL_KEYWORD_TRACE));
+        }
     }
 }
 
@@ -118,5 +118,7 @@ namespace Microsoft::Console::Types
 
         static void _assignId(UiaTextRangeBase& utr) noexcept;
         static void _assignId(ScreenInfoUiaProviderBase& siup) noexcept;
+
+        static bool _shouldTraceSignal(const uint64_t count) noexcept;
     };
 }
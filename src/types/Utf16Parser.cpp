@@ -53,6 +53,115 @@ std::wstring_view Utf16Parser::ParseNext(std::wstring_view wstr) noexcept
     return std::wstring_view{ &UNICODE_REPLACEMENT, 1 };
 }
 
+// Routine Description:
+// - Scans forward for the next UTF-16 code unit in the surrogate range
+//   (0xD800-0xDFFF) and returns its index, or the length of the string if no
+//   surrogate remains. Most text is made of BMP codepoints that need no
+//   grouping at all, so this is vectorized to test 8 (or 16) characters per
+//   iteration instead of one.
+// Arguments:
+// - wstr - the string to scan
+// - offset - the index to start scanning from
+// Return Value:
+// - index of the next surrogate code unit, or wstr.size() if there is none.
+size_t Utf16Parser::FindNextSurrogate(const std::wstring_view wstr, size_t offset) noexcept
+{
+    // A unit is a surrogate when 0xd800 <= wch <= 0xdfff. x86 has no unsigned
+    // 16-bit comparisons, so every lane is biased by 0x8000 and the signed
+    // ones are used instead.
+#pragma warning(push)
+#pragma warning(disable : 26481) // Don't use pointer arithmetic. Use span instead (bounds.1).
+#pragma warning(disable : 26490) // Don't use reinterpret_cast (type.1).
+#ifdef __AVX2__
+    const auto bias = _mm256_set1_epi16(gsl::narrow_cast<short>(0x8000));
+    const auto lowLimit = _mm256_set1_epi16(0xd800 - 0x8000 - 1); // wch >= 0xd800
+    const auto highLimit = _mm256_set1_epi16(0xdfff - 0x8000 + 1); // wch <= 0xdfff
+    for (; offset + 16 <= wstr.size(); offset += 16)
+    {
+        const auto chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(wstr.data() + offset));
+        const auto biased = _mm256_xor_si256(chars, bias);
+        const auto isSurrogate = _mm256_and_si256(_mm256_cmpgt_epi16(biased, lowLimit), _mm256_cmpgt_epi16(highLimit, biased));
+        const auto mask = _mm256_movemask_epi8(isSurrogate);
+        if (mask)
+        {
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            // the mask has two bits per 16-bit lane
+            return offset + index / 2;
+        }
+    }
+#elif _M_AMD64
+    const auto bias = _mm_set1_epi16(gsl::narrow_cast<short>(0x8000));
+    const auto lowLimit = _mm_set1_epi16(0xd800 - 0x8000 - 1); // wch >= 0xd800
+    const auto highLimit = _mm_set1_epi16(0xdfff - 0x8000 + 1); // wch <= 0xdfff
+    for (; offset + 8 <= wstr.size(); offset += 8)
+    {
+        const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(wstr.data() + offset));
+        const auto biased = _mm_xor_si128(chars, bias);
+        const auto isSurrogate = _mm_and_si128(_mm_cmpgt_epi16(biased, lowLimit), _mm_cmplt_epi16(biased, highLimit));
+        const auto mask = _mm_movemask_epi8(isSurrogate);
+        if (mask)
+        {
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            // the mask has two bits per 16-bit lane
+            return offset + index / 2;
+        }
+    }
+#endif
+#pragma warning(pop)
+
+    // scalar tail (and the whole scan on other architectures)
+    while (offset < wstr.size() && !IsLeadingSurrogate(til::at(wstr, offset)) && !IsTrailingSurrogate(til::at(wstr, offset)))
+    {
+        ++offset;
+    }
+    return offset;
+}
+
+// Routine Description:
+// - splits a utf16 encoded string into views of its codepoints, reusing the
+//   caller's vector for the results. This is the allocation-free counterpart
+//   to Parse: the views alias the input string, so they are only valid as
+//   long as it is, and the output vector's capacity survives across calls.
+// - surrogate pairs must be adjacent to be grouped (like ParseNext); badly
+//   formed leading/trailing units are dropped.
+// Arguments:
+// - wstr - the string to parse
+// - glyphs - receives one view per codepoint; cleared first
+// Return Value:
+// - <none>
+void Utf16Parser::ParseInto(const std::wstring_view wstr, std::vector<std::wstring_view>& glyphs)
+{
+    glyphs.clear();
+    for (size_t pos = 0; pos < wstr.size();)
+    {
+        // Everything up to the next surrogate is single-unit codepoints.
+        const auto nextSurrogate = FindNextSurrogate(wstr, pos);
+        for (; pos < nextSurrogate; ++pos)
+        {
+            glyphs.emplace_back(wstr.substr(pos, 1));
+        }
+
+        if (pos >= wstr.size())
+        {
+            break;
+        }
+
+        // A lead directly followed by a trail forms a pair; anything else is
+        // a broken sequence and gets dropped, one unit at a time.
+        if (IsLeadingSurrogate(til::at(wstr, pos)) && pos + 1 < wstr.size() && IsTrailingSurrogate(til::at(wstr, pos + 1)))
+        {
+            glyphs.emplace_back(wstr.substr(pos, 2));
+            pos += 2;
+        }
+        else
+        {
+            ++pos;
+        }
+    }
+}
+
 // Routine Description:
 // - formats a utf16 encoded wstring and splits the codepoints into individual collections.
 // - will drop badly formatted leading/trailing char sequences.
@@ -452,6 +452,63 @@ void Utils::InitializeColorTable(const gsl::span<COLORREF> table)
     std::copy_n(standard256ColorTable.begin(), tableSize, table.begin());
 }
 
+// Function Description:
+// - Finds the entry of the standard xterm 256-color table that is nearest to
+//   the given color (by squared RGB distance), considering only the color
+//   cube and grayscale ramp (entries 16-255). The first 16 entries are
+//   excluded because terminals commonly let users remap them.
+// - The cube and ramp are regular enough that the match can be computed
+//   arithmetically instead of scanning the table: the channels are
+//   independent within the cube, so each snaps to its nearest cube level, and
+//   the nearest gray to any color is the one nearest the channel mean. The
+//   closer of those two candidates is the global nearest match.
+// Arguments:
+// - color: the color to approximate
+// Return Value:
+// - the index of the nearest table entry, in the range 16-255
+size_t Utils::FindNearestXterm256Index(const til::color color) noexcept
+{
+    // The color cube channel levels are 0, 95, 135, 175, 215, 255: steps of
+    // 40 except for the large first gap. Values up to 47 snap down to 0,
+    // values up to 115 snap to 95, the rest land on (value - 36) / 40 (with
+    // exact midpoints going to the lower level, the way a first-match scan
+    // over the table would resolve them).
+    constexpr std::array<uint8_t, 6> cubeLevels{ 0, 95, 135, 175, 215, 255 };
+    const auto cubeIndexOf = [](const int value) noexcept {
+        return value < 48 ? 0 : (value <= 115 ? 1 : (value - 36) / 40);
+    };
+
+    const auto rIndex = cubeIndexOf(color.r);
+    const auto gIndex = cubeIndexOf(color.g);
+    const auto bIndex = cubeIndexOf(color.b);
+    const til::color cubeColor{ til::at(cubeLevels, rIndex), til::at(cubeLevels, gIndex), til::at(cubeLevels, bIndex) };
+
+    // The grayscale ramp runs 8, 18, ..., 238 in steps of 10. The distance to
+    // a gray is a quadratic in its level with its minimum at the channel
+    // mean, so the winning step is the one nearest (r + g + b) / 3 - computed
+    // on the sum so the fractional part isn't lost, with exact midpoints
+    // again resolving downwards.
+    const auto sum = color.r + color.g + color.b;
+    const auto grayIndex = std::clamp((sum - 10) / 30, 0, 23);
+    const auto grayValue = gsl::narrow_cast<uint8_t>(8 + 10 * grayIndex);
+    const til::color grayColor{ grayValue, grayValue, grayValue };
+
+    const auto distanceSq = [=](const til::color candidate) noexcept {
+        const auto dr = color.r - candidate.r;
+        const auto dg = color.g - candidate.g;
+        const auto db = color.b - candidate.b;
+        return dr * dr + dg * dg + db * db;
+    };
+
+    // On a tie the cube entry wins, which matches what a first-match linear
+    // scan over the table would have returned (the cube precedes the ramp).
+    if (distanceSq(grayColor) < distanceSq(cubeColor))
+    {
+        return 232 + grayIndex;
+    }
+    return 16 + 36 * rIndex + 6 * gIndex + bIndex;
+}
+
 #pragma warning(push)
 #pragma warning(disable : 26447) // This is a false positive.
 
@@ -9,20 +9,115 @@
 #pragma hdrstop
 
 // Routine Description:
-// - Takes a multibyte string, allocates the appropriate amount of memory for the conversion, performs the conversion,
-//   and returns the Unicode UTF-16 result in the smart pointer (and the length).
+// - Returns the length of the leading run of plain ASCII (< 0x80) bytes.
+//   Both conversion directions below use this to skip the Win32 conversion
+//   round trips entirely when the text is all ASCII, so it's vectorized to
+//   test 16 (or 32) bytes per iteration instead of one.
+static size_t _asciiPrefixLength(const std::string_view source) noexcept
+{
+    size_t offset = 0;
+#pragma warning(push)
+#pragma warning(disable : 26481) // Don't use pointer arithmetic. Use span instead (bounds.1).
+#pragma warning(disable : 26490) // Don't use reinterpret_cast (type.1).
+#ifdef __AVX2__
+    for (; offset + 32 <= source.size(); offset += 32)
+    {
+        // the sign bit is set for any byte >= 0x80
+        const auto chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source.data() + offset));
+        const auto mask = _mm256_movemask_epi8(chars);
+        if (mask)
+        {
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return offset + index;
+        }
+    }
+#elif _M_AMD64
+    for (; offset + 16 <= source.size(); offset += 16)
+    {
+        // the sign bit is set for any byte >= 0x80
+        const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + offset));
+        const auto mask = _mm_movemask_epi8(chars);
+        if (mask)
+        {
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return offset + index;
+        }
+    }
+#endif
+#pragma warning(pop)
+
+    // scalar tail (and the whole scan on other architectures)
+    while (offset < source.size() && static_cast<unsigned char>(til::at(source, offset)) < 0x80)
+    {
+        ++offset;
+    }
+    return offset;
+}
+
+// Routine Description:
+// - As above, for UTF-16 text: the length of the leading run of code units < 0x80.
+static size_t _asciiPrefixLength(const std::wstring_view source) noexcept
+{
+    size_t offset = 0;
+#pragma warning(push)
+#pragma warning(disable : 26481) // Don't use pointer arithmetic. Use span instead (bounds.1).
+#pragma warning(disable : 26490) // Don't use reinterpret_cast (type.1).
+#if defined(__AVX2__) || defined(_M_AMD64)
+    // a lane is non-ASCII when any of the top 9 bits is set
+    const auto highBits = _mm_set1_epi16(gsl::narrow_cast<short>(0xff80));
+    for (; offset + 8 <= source.size(); offset += 8)
+    {
+        const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data() + offset));
+        const auto isAscii = _mm_cmpeq_epi16(_mm_and_si128(chars, highBits), _mm_setzero_si128());
+        const auto mask = _mm_movemask_epi8(isAscii) ^ 0xffff;
+        if (mask)
+        {
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            // the mask has two bits per 16-bit lane
+            return offset + index / 2;
+        }
+    }
+#endif
+#pragma warning(pop)
+
+    // scalar tail (and the whole scan on other architectures)
+    while (offset < source.size() && til::at(source, offset) < 0x80)
+    {
+        ++offset;
+    }
+    return offset;
+}
+
+// Routine Description:
+// - Takes a multibyte string and performs the conversion into a caller-supplied
+//   buffer, so repeated conversions can reuse one allocation.
 // Arguments:
 // - codepage - Windows Code Page representing the multibyte source text
 // - source - View of multibyte characters of source text
+// - out - Receives the UTF-16 result; cleared first, capacity is retained
 // Return Value:
-// - The UTF-16 wide string.
+// - <none>
 // - NOTE: Throws suitable HRESULT errors from memory allocation, safe math, or MultiByteToWideChar failures.
-[[nodiscard]] std::wstring ConvertToW(const UINT codePage, const std::string_view source)
+void ConvertToW(const UINT codePage, const std::string_view source, std::wstring& out)
 {
+    out.clear();
+
     // If there's nothing to convert, bail early.
     if (source.empty())
     {
-        return {};
+        return;
+    }
+
+    // Plain ASCII converts to UTF-16 by widening each byte, skipping the two
+    // MultiByteToWideChar round trips. This is only valid for UTF-8: narrow
+    // codepages are not all ASCII-transparent (CP864 remaps '%', say).
+    if (codePage == CP_UTF8 && _asciiPrefixLength(source) == source.size())
+    {
+        out.append(source.begin(), source.end());
+        return;
     }
 
     int iSource; // convert to int because Mb2Wc requires it.
@@ -42,32 +137,57 @@
     size_t cchNeeded;
     THROW_IF_FAILED(IntToSizeT(iTarget, &cchNeeded));
 
-    // Allocate ourselves some space
-    std::wstring out;
+    // Make ourselves some space (reusing whatever the caller's buffer already holds)
     out.resize(cchNeeded);
 
     // Attempt conversion for real.
     THROW_LAST_ERROR_IF_AND_IGNORE_BAD_GLE(0 == MultiByteToWideChar(codePage, 0, source.data(), iSource, out.data(), iTarget));
+}
 
-    // Return as a string
+// Routine Description:
+// - Takes a multibyte string, allocates the appropriate amount of memory for the conversion, performs the conversion,
+//   and returns the Unicode UTF-16 result in the smart pointer (and the length).
+// Arguments:
+// - codepage - Windows Code Page representing the multibyte source text
+// - source - View of multibyte characters of source text
+// Return Value:
+// - The UTF-16 wide string.
+// - NOTE: Throws suitable HRESULT errors from memory allocation, safe math, or MultiByteToWideChar failures.
+[[nodiscard]] std::wstring ConvertToW(const UINT codePage, const std::string_view source)
+{
+    std::wstring out;
+    ConvertToW(codePage, source, out);
     return out;
 }
 
 // Routine Description:
-// - Takes a wide string, allocates the appropriate amount of memory for the conversion, performs the conversion,
-//   and returns the Multibyte result
+// - Takes a wide string and performs the conversion into a caller-supplied
+//   buffer, so repeated conversions can reuse one allocation.
 // Arguments:
 // - codepage - Windows Code Page representing the multibyte destination text
 // - source - Unicode (UTF-16) characters of source text
+// - out - Receives the multibyte result; cleared first, capacity is retained
 // Return Value:
-// - The multibyte string encoded in the given codepage
+// - <none>
 // - NOTE: Throws suitable HRESULT errors from memory allocation, safe math, or MultiByteToWideChar failures.
-[[nodiscard]] std::string ConvertToA(const UINT codepage, const std::wstring_view source)
+void ConvertToA(const UINT codepage, const std::wstring_view source, std::string& out)
 {
+    out.clear();
+
     // If there's nothing to convert, bail early.
     if (source.empty())
     {
-        return {};
+        return;
+    }
+
+    // Plain ASCII converts by narrowing each unit; see ConvertToW for why
+    // this shortcut is restricted to UTF-8.
+    if (codepage == CP_UTF8 && _asciiPrefixLength(source) == source.size())
+    {
+        std::transform(source.begin(), source.end(), std::back_inserter(out), [](const wchar_t wch) {
+            return gsl::narrow_cast<char>(wch);
+        });
+        return;
     }
 
     int iSource; // convert to int because Wc2Mb requires it.
@@ -83,8 +203,7 @@
     size_t cchNeeded;
     THROW_IF_FAILED(IntToSizeT(iTarget, &cchNeeded));
 
-    // Allocate ourselves some space
-    std::string out;
+    // Make ourselves some space (reusing whatever the caller's buffer already holds)
     out.resize(cchNeeded);
 
     // Attempt conversion for real.
@@ -92,8 +211,21 @@
 #pragma prefast(suppress: __WARNING_W2A_BEST_FIT, "WC_NO_BEST_FIT_CHARS doesn't work in many codepages. Retain old behavior.")
     // clang-format on
     THROW_LAST_ERROR_IF(0 == WideCharToMultiByte(codepage, 0, source.data(), iSource, out.data(), iTarget, nullptr, nullptr));
+}
 
-    // Return as a string
+// Routine Description:
+// - Takes a wide string, allocates the appropriate amount of memory for the conversion, performs the conversion,
+//   and returns the Multibyte result
+// Arguments:
+// - codepage - Windows Code Page representing the multibyte destination text
+// - source - Unicode (UTF-16) characters of source text
+// Return Value:
+// - The multibyte string encoded in the given codepage
+// - NOTE: Throws suitable HRESULT errors from memory allocation, safe math, or MultiByteToWideChar failures.
+[[nodiscard]] std::string ConvertToA(const UINT codepage, const std::wstring_view source)
+{
+    std::string out;
+    ConvertToA(codepage, source, out);
     return out;
 }
 
@@ -113,6 +245,12 @@
         return 0;
     }
 
+    // Plain ASCII is one byte per unit in UTF-8; no need to ask.
+    if (codepage == CP_UTF8 && _asciiPrefixLength(source) == source.size())
+    {
+        return source.size();
+    }
+
     int iSource; // convert to int because Wc2Mb requires it
     THROW_IF_FAILED(SizeTToInt(source.size(), &iSource));
 
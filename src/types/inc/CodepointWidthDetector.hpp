@@ -31,6 +31,7 @@ public:
     CodepointWidthDetector& operator=(CodepointWidthDetector&&) = delete;
 
     CodepointWidth GetWidth(const std::wstring_view glyph) const;
+    size_t MeasureColumns(const std::wstring_view text) const;
     bool IsWide(const std::wstring_view glyph) const;
     bool IsWide(const wchar_t wch) const noexcept;
     void SetFallbackMethod(std::function<bool(const std::wstring_view)> pfnFallback);
@@ -46,6 +47,8 @@ private:
     bool _checkFallbackViaCache(const std::wstring_view glyph) const;
     static unsigned int _extractCodepoint(const std::wstring_view glyph) noexcept;
 
-    mutable std::unordered_map<std::wstring, bool> _fallbackCache;
+    // Memoizes the fallback measurements for the current font, keyed by
+    // codepoint so lookups don't allocate. Cleared by NotifyFontChanged.
+    mutable std::unordered_map<unsigned int, bool> _fallbackCache;
     std::function<bool(std::wstring_view)> _pfnFallbackMethod;
 };
@@ -21,9 +21,11 @@ Author(s):
 struct ColorFix
 {
 public:
+    ColorFix() noexcept;
     ColorFix(COLORREF color) noexcept;
 
     static COLORREF GetPerceivableColor(COLORREF fg, COLORREF bg);
+    static COLORREF GetPerceivableColor(const ColorFix& fg, const ColorFix& bg);
 
 #pragma warning(push)
     // CL will complain about the both nameless and anonymous struct.
@@ -47,7 +49,8 @@ public:
 
 private:
     static double _GetHPrimeFn(double x, double y) noexcept;
-    static double _GetDeltaE(ColorFix x1, ColorFix x2) noexcept;
+    static double _GetChromaHueSq(const ColorFix& x1, const ColorFix& x2) noexcept;
+    static double _DeltaEFromLightness(double l1, double l2, double chromaHueSq) noexcept;
     void _ToLab() noexcept;
     void _ToRGB();
 };
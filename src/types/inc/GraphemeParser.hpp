@@ -0,0 +1,23 @@
+/*++
+Copyright (c) Microsoft Corporation
+
+Module Name:
+- GraphemeParser.hpp
+
+Abstract:
+- Segments utf16 encoded text into grapheme clusters (user-perceived characters)
+  following the rules of UAX#29, so that combining marks, ZWJ emoji sequences,
+  regional indicator pairs, and Hangul jamo stay together as single units.
+--*/
+
+#pragma once
+
+#include <vector>
+
+class GraphemeParser final
+{
+public:
+    static size_t NextBoundary(std::wstring_view text, size_t offset) noexcept;
+    static std::wstring_view ParseNext(std::wstring_view wstr) noexcept;
+    static void ParseInto(std::wstring_view wstr, std::vector<std::wstring_view>& clusters);
+};
@@ -28,7 +28,9 @@ private:
 
 public:
     static std::vector<std::vector<wchar_t>> Parse(std::wstring_view wstr);
+    static void ParseInto(std::wstring_view wstr, std::vector<std::wstring_view>& glyphs);
     static std::wstring_view ParseNext(std::wstring_view wstr) noexcept;
+    static size_t FindNextSurrogate(std::wstring_view wstr, size_t offset) noexcept;
 
     // Routine Description:
     // - checks if wchar is a utf16 leading surrogate
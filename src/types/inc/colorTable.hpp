@@ -14,6 +14,7 @@ namespace Microsoft::Console::Utils
 {
     void InitializeColorTable(const gsl::span<COLORREF> table);
     gsl::span<const til::color> CampbellColorTable();
+    size_t FindNearestXterm256Index(const til::color color) noexcept;
 
     std::optional<til::color> ColorFromXOrgAppColorName(const std::wstring_view wstr) noexcept;
 }
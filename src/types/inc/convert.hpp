@@ -28,9 +28,17 @@ enum class CodepointWidth : BYTE
 [[nodiscard]] std::wstring ConvertToW(const UINT codepage,
                                       const std::string_view source);
 
+void ConvertToW(const UINT codepage,
+                const std::string_view source,
+                std::wstring& out);
+
 [[nodiscard]] std::string ConvertToA(const UINT codepage,
                                      const std::wstring_view source);
 
+void ConvertToA(const UINT codepage,
+                const std::wstring_view source,
+                std::string& out);
+
 [[nodiscard]] size_t GetALengthFromW(const UINT codepage,
                                      const std::wstring_view source);
 
@@ -0,0 +1,110 @@
+# Copyright (c) Microsoft Corporation.
+# Licensed under the MIT license.
+
+#Requires -Version 7
+
+################################################################################
+# This script generates the range table at the heart of
+# src/types/GraphemeParser.cpp from the plain-text UCD auxiliary data files:
+#
+#   GraphemeBreakProperty.txt (from [1], under auxiliary/)
+#   emoji-data.txt            (from [2])
+#
+# Precomposed Hangul syllables (LV/LVT, U+AC00..U+D7A3) are classified
+# arithmetically at runtime, so their (huge) ranges are dropped from the
+# output. CR, LF, and ZWJ keep their own enum values because the state
+# machine special-cases them.
+#
+# Invoke as ./Generate-GraphemeBreakTableFromUCD.ps1 GraphemeBreakProperty.txt emoji-data.txt |
+#           Out-File -Encoding UTF-8 Temporary.cpp
+#
+# [1]: https://www.unicode.org/Public/UCD/latest/ucd/
+# [2]: https://www.unicode.org/Public/UCD/latest/ucd/emoji/
+################################################################################
+
+[CmdletBinding()]
+Param(
+    [Parameter(Position=0, Mandatory=$true)]
+    [string]$GraphemeBreakPropertyPath,
+
+    [Parameter(Position=1, Mandatory=$true)]
+    [string]$EmojiDataPath
+)
+
+# Maps the UCD property value aliases onto the names GraphemeParser.cpp uses.
+$propertyNames = @{
+    "CR"                 = "CR";
+    "LF"                 = "LF";
+    "Control"            = "Control";
+    "Extend"             = "Extend";
+    "ZWJ"                = "ZWJ";
+    "Regional_Indicator" = "RegionalIndicator";
+    "Prepend"            = "Prepend";
+    "SpacingMark"        = "SpacingMark";
+    "L"                  = "HangulL";
+    "V"                  = "HangulV";
+    "T"                  = "HangulT";
+}
+
+Class BreakRange {
+    [int]$Start
+    [int]$End
+    [string]$Property
+}
+
+Function Parse-UCDRanges([string]$path, [hashtable]$nameMap, [string]$onlyProperty) {
+    Get-Content $path | ForEach-Object {
+        # lines look like "0600..0605    ; Prepend # ..." or "00AD ; Control # ..."
+        If ($_ -notmatch "^([0-9A-F]+)(?:\.\.([0-9A-F]+))?\s*;\s*(\w+)\s*#") {
+            Return
+        }
+        $property = $Matches[3]
+        If ($null -ne $onlyProperty -and $property -cne $onlyProperty) {
+            Return
+        }
+        If ($null -ne $nameMap) {
+            $property = $nameMap[$property]
+            If ($null -eq $property) {
+                Return
+            }
+        }
+        $range = [BreakRange]::new()
+        $range.Start = [int]("0x" + $Matches[1])
+        $range.End = [int]("0x" + ($Matches[2] ?? $Matches[1]))
+        $range.Property = $property
+        $range
+    }
+}
+
+$ranges = [System.Collections.Generic.List[BreakRange]](
+    Parse-UCDRanges $GraphemeBreakPropertyPath $propertyNames $null)
+
+# Extended_Pictographic wins over the (absent) GCB classification of its
+# codepoints; the two files don't overlap for anything else we keep.
+$ranges.AddRange([BreakRange[]](
+    Parse-UCDRanges $EmojiDataPath $null "Extended_Pictographic" |
+        ForEach-Object { $_.Property = "ExtendedPictographic"; $_ }))
+
+# Drop LV/LVT (derived arithmetically) and sort & merge what's left.
+$ranges = $ranges | Where-Object { $_.Property -notin "LV", "LVT" } | Sort-Object Start
+
+$merged = [System.Collections.Generic.List[BreakRange]]::new(512)
+ForEach ($range in $ranges) {
+    $last = $merged.Count -gt 0 ? $merged[$merged.Count - 1] : $null
+    If ($null -ne $last -and $last.Property -ceq $range.Property -and $last.End -eq $range.Start - 1) {
+        $last.End = $range.End
+    } Else {
+        $merged.Add($range)
+    }
+}
+
+"    // Generated by Generate-GraphemeBreakTableFromUCD.ps1"
+"    // on {0:u} from the UCD auxiliary data files." -f (Get-Date -AsUTC)
+"    // Codepoints not listed are GraphemeBreakProperty::Other; precomposed"
+"    // Hangul syllables (U+AC00-U+D7A3) are classified arithmetically below"
+"    // and are deliberately not listed either."
+"    static constexpr std::array<GraphemeBreakRange, {0}> s_graphemeBreakTable{{" -f $merged.Count
+ForEach ($range in $merged) {
+    "        GraphemeBreakRange{{ 0x{0:x}, 0x{1:x}, GraphemeBreakProperty::{2} }}," -f $range.Start, $range.End, $range.Property
+}
+"    };"